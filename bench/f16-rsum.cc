@@ -0,0 +1,125 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <fp16/fp16.h>
+#include "bench/utils.h"
+#include <xnnpack/aligned-allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/params.h>
+#include <xnnpack/reduce.h>
+
+
+static void f16_rsum(
+  benchmark::State& state,
+  xnn_f16_rsum_ukernel_function f16_rsum,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t elements = state.range(0);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+  auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+
+  std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> input(elements);
+  std::generate(input.begin(), input.end(), std::ref(f16rng));
+
+  float output;
+  for (auto _ : state) {
+    f16_rsum(elements * sizeof(uint16_t), input.data(), &output);
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  const size_t elements_per_iteration = elements;
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * elements_per_iteration, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = elements * sizeof(uint16_t);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(f16_rsum, neonfp16_x8, xnn_f16_rsum_ukernel__neonfp16_x8, benchmark::utils::CheckNEONFP16)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f16_rsum, neonfp16_x16_acc2, xnn_f16_rsum_ukernel__neonfp16_x16_acc2, benchmark::utils::CheckNEONFP16)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f16_rsum, neonfp16_x32_acc4, xnn_f16_rsum_ukernel__neonfp16_x32_acc4, benchmark::utils::CheckNEONFP16)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(f16_rsum, f16c_x8, xnn_f16_rsum_ukernel__f16c_x8, benchmark::utils::CheckF16C)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f16_rsum, f16c_x16_acc2, xnn_f16_rsum_ukernel__f16c_x16_acc2, benchmark::utils::CheckF16C)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f16_rsum, f16c_x32_acc4, xnn_f16_rsum_ukernel__f16c_x32_acc4, benchmark::utils::CheckF16C)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f16_rsum, avx512skx_x16, xnn_f16_rsum_ukernel__avx512skx_x16, benchmark::utils::CheckAVX512SKX)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f16_rsum, avx512skx_x32_acc2, xnn_f16_rsum_ukernel__avx512skx_x32_acc2, benchmark::utils::CheckAVX512SKX)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f16_rsum, avx512skx_x64_acc4, xnn_f16_rsum_ukernel__avx512skx_x64_acc4, benchmark::utils::CheckAVX512SKX)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+BENCHMARK_CAPTURE(f16_rsum, scalar_x1, xnn_f16_rsum_ukernel__scalar_x1)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(f16_rsum, scalar_x2_acc2, xnn_f16_rsum_ukernel__scalar_x2_acc2)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(f16_rsum, scalar_x4_acc4, xnn_f16_rsum_ukernel__scalar_x4_acc4)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
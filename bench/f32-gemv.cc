@@ -0,0 +1,186 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+#include <xnnpack/aligned-allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/gemm.h>
+#include <xnnpack/pack.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+// Matrix-vector products are bound by the bandwidth of streaming the weights, so the benchmarks below report the
+// achieved weight bandwidth ("bytes" rate), and the STREAM-like copy baseline reports the attainable bandwidth on
+// the same buffer sizes.
+
+static void GEMVBenchmark(benchmark::State& state,
+  xnn_f32_gemm_minmax_ukernel_function gemv,
+  size_t nr, size_t kr, size_t sr,
+  xnn_init_f32_minmax_params_fn init_params,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t nc = state.range(0);
+  const size_t kc = state.range(1);
+
+  const size_t nc_stride = benchmark::utils::RoundUp(nc, nr);
+  const size_t kc_stride = benchmark::utils::RoundUp(kc, kr * sr);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(), std::ref(rng));
+
+  std::vector<float> a(kc);
+  std::generate(a.begin(), a.end(), std::ref(f32rng));
+  std::vector<float> k(nc * kc);
+  std::generate(k.begin(), k.end(), std::ref(f32rng));
+  std::vector<float> b(nc);
+  std::generate(b.begin(), b.end(), std::ref(f32rng));
+
+  const size_t w_elements = nc_stride * kc_stride + nc_stride;
+  const size_t num_buffers = 1 +
+    benchmark::utils::DivideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(), sizeof(float) * w_elements);
+
+  std::vector<float, AlignedAllocator<float, 64>> w(w_elements * num_buffers);
+  std::fill(w.begin(), w.end(), 0.0f);
+  xnn_pack_f32_gemm_goi_w(1 /* groups */, nc, kc, nr, kr, sr, k.data(), b.data(), w.data(), 0, nullptr);
+  for (size_t n = 1; n < num_buffers; n++) {
+    std::copy(w.cbegin(), w.cbegin() + w_elements, w.begin() + n * w_elements);
+  }
+  std::vector<float> c(nc);
+
+  xnn_f32_minmax_params params;
+  init_params(&params,
+    -std::numeric_limits<float>::infinity(), +std::numeric_limits<float>::infinity());
+
+  size_t buffer_index = 0;
+  for (auto _ : state) {
+    // Use circular buffers (exceeding cache size) to keep W out of cache, as it would be for a large layer.
+    state.PauseTiming();
+    benchmark::utils::PrefetchToL1(a.data(), a.size() * sizeof(float));
+    buffer_index = (buffer_index + 1) % num_buffers;
+    state.ResumeTiming();
+
+    gemv(
+      1, nc, kc * sizeof(float),
+      a.data(), kc * sizeof(float),
+      w.data() + buffer_index * w_elements,
+      c.data(), nc * sizeof(float), nr * sizeof(float),
+      &params);
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  state.counters["FLOPS"] = benchmark::Counter(
+    uint64_t(state.iterations()) * 2 * nc * kc, benchmark::Counter::kIsRate);
+
+  state.counters["bytes"] = benchmark::Counter(
+    uint64_t(state.iterations()) * sizeof(float) * w_elements, benchmark::Counter::kIsRate);
+}
+
+static void StreamCopyBenchmark(benchmark::State& state) {
+  const size_t nc = state.range(0);
+  const size_t kc = state.range(1);
+
+  const size_t elements = nc * kc + nc;
+  const size_t num_buffers = 1 +
+    benchmark::utils::DivideRoundUp<size_t>(benchmark::utils::GetMaxCacheSize(), sizeof(float) * elements);
+
+  std::vector<float, AlignedAllocator<float, 64>> x(elements * num_buffers, 1.0f);
+  std::vector<float, AlignedAllocator<float, 64>> y(elements);
+
+  size_t buffer_index = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    buffer_index = (buffer_index + 1) % num_buffers;
+    state.ResumeTiming();
+
+    std::memcpy(y.data(), x.data() + buffer_index * elements, elements * sizeof(float));
+    benchmark::DoNotOptimize(y.data());
+  }
+
+  // Only the reads are counted to match the weight traffic of GEMV.
+  state.counters["bytes"] = benchmark::Counter(
+    uint64_t(state.iterations()) * sizeof(float) * elements, benchmark::Counter::kIsRate);
+}
+
+static void GEMVArguments(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"N", "K"});
+  b->Args({256, 256});
+  b->Args({1024, 1024});
+  b->Args({4096, 1024});
+  b->Args({1024, 4096});
+  b->Args({4096, 4096});
+  b->Args({1000, 1280});
+}
+
+#define BENCHMARK_GEMV(gemv_fn) \
+  BENCHMARK_CAPTURE(gemv_fn, fc, "Fully Connected")->Apply(GEMVArguments)->UseRealTime();
+
+BENCHMARK(StreamCopyBenchmark)->Apply(GEMVArguments)->UseRealTime();
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  static void f32_gemm_1x8__sse_load1(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x8__sse_load1, 8, 1, 1,
+      xnn_init_f32_minmax_sse_params);
+  }
+  static void f32_gemv_1x8__sse_load1_acc4_prfm(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, 8, 1, 1,
+      xnn_init_f32_minmax_sse_params);
+  }
+  static void f32_gemm_1x16__avx_broadcast(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast, 16, 1, 1,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
+  static void f32_gemv_1x16__avx_broadcast_acc4_prfm(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, 16, 1, 1,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckAVX);
+  }
+  static void f32_gemm_1x16__fma3_broadcast(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast, 16, 1, 1,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void f32_gemv_1x16__fma3_broadcast_acc4_prfm(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, 16, 1, 1,
+      xnn_init_f32_minmax_avx_params, benchmark::utils::CheckFMA3);
+  }
+  static void f32_gemm_1x16__avx512f_broadcast(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast, 16, 1, 1,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
+  static void f32_gemv_1x16__avx512f_broadcast_acc4_prfm(benchmark::State& state, const char* net) {
+    GEMVBenchmark(state, xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, 16, 1, 1,
+      xnn_init_f32_minmax_scalar_params, benchmark::utils::CheckAVX512F);
+  }
+
+  BENCHMARK_GEMV(f32_gemm_1x8__sse_load1)
+  BENCHMARK_GEMV(f32_gemv_1x8__sse_load1_acc4_prfm)
+  BENCHMARK_GEMV(f32_gemm_1x16__avx_broadcast)
+  BENCHMARK_GEMV(f32_gemv_1x16__avx_broadcast_acc4_prfm)
+  BENCHMARK_GEMV(f32_gemm_1x16__fma3_broadcast)
+  BENCHMARK_GEMV(f32_gemv_1x16__fma3_broadcast_acc4_prfm)
+  BENCHMARK_GEMV(f32_gemm_1x16__avx512f_broadcast)
+  BENCHMARK_GEMV(f32_gemv_1x16__avx512f_broadcast_acc4_prfm)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
@@ -0,0 +1,138 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+#include <xnnpack/aligned-allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/params.h>
+#include <xnnpack/reduce.h>
+
+
+static void f32_rminmax(
+  benchmark::State& state,
+  xnn_f32_rminmax_ukernel_function f32_rminmax,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t elements = state.range(0);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-10.0f, 10.0f), std::ref(rng));
+
+  std::vector<float, AlignedAllocator<float, 64>> input(elements);
+  std::generate(input.begin(), input.end(), std::ref(f32rng));
+
+  float output[2];
+  for (auto _ : state) {
+    f32_rminmax(elements * sizeof(float), input.data(), output);
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  const size_t elements_per_iteration = elements;
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * elements_per_iteration, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = elements * sizeof(float);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(f32_rminmax, neon_x4, xnn_f32_rminmax_ukernel__neon_x4, benchmark::utils::CheckNEON)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, neon_x8_acc2, xnn_f32_rminmax_ukernel__neon_x8_acc2, benchmark::utils::CheckNEON)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, neon_x16_acc4, xnn_f32_rminmax_ukernel__neon_x16_acc4, benchmark::utils::CheckNEON)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(f32_rminmax, sse_x4, xnn_f32_rminmax_ukernel__sse_x4)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, sse_x8_acc2, xnn_f32_rminmax_ukernel__sse_x8_acc2)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, sse_x16_acc4, xnn_f32_rminmax_ukernel__sse_x16_acc4)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, avx_x8, xnn_f32_rminmax_ukernel__avx_x8, benchmark::utils::CheckAVX)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, avx_x16_acc2, xnn_f32_rminmax_ukernel__avx_x16_acc2, benchmark::utils::CheckAVX)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, avx_x32_acc4, xnn_f32_rminmax_ukernel__avx_x32_acc4, benchmark::utils::CheckAVX)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, avx512f_x16, xnn_f32_rminmax_ukernel__avx512f_x16, benchmark::utils::CheckAVX512F)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, avx512f_x32_acc2, xnn_f32_rminmax_ukernel__avx512f_x32_acc2, benchmark::utils::CheckAVX512F)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(f32_rminmax, avx512f_x64_acc4, xnn_f32_rminmax_ukernel__avx512f_x64_acc4, benchmark::utils::CheckAVX512F)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+BENCHMARK_CAPTURE(f32_rminmax, scalar_x1, xnn_f32_rminmax_ukernel__scalar_x1)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(f32_rminmax, scalar_x2_acc2, xnn_f32_rminmax_ukernel__scalar_x2_acc2)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(f32_rminmax, scalar_x4_acc4, xnn_f32_rminmax_ukernel__scalar_x4_acc4)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
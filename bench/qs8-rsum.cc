@@ -0,0 +1,126 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include "bench/utils.h"
+#include <xnnpack/aligned-allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/params.h>
+#include <xnnpack/reduce.h>
+
+
+static void qs8_rsum(
+  benchmark::State& state,
+  xnn_qs8_rsum_ukernel_function qs8_rsum,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  const size_t elements = state.range(0);
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+
+  std::vector<int8_t, AlignedAllocator<int8_t, 64>> input(elements);
+  std::generate(input.begin(), input.end(), std::ref(i8rng));
+
+  int32_t output;
+  for (auto _ : state) {
+    qs8_rsum(elements * sizeof(int8_t), input.data(), &output);
+  }
+
+  const uint64_t cpu_frequency = benchmark::utils::GetCurrentCpuFrequency();
+  if (cpu_frequency != 0) {
+    state.counters["cpufreq"] = cpu_frequency;
+  }
+
+  const size_t elements_per_iteration = elements;
+  state.counters["elements"] =
+    benchmark::Counter(uint64_t(state.iterations()) * elements_per_iteration, benchmark::Counter::kIsRate);
+
+  const size_t bytes_per_iteration = elements * sizeof(int8_t);
+  state.counters["bytes"] =
+    benchmark::Counter(uint64_t(state.iterations()) * bytes_per_iteration, benchmark::Counter::kIsRate);
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  BENCHMARK_CAPTURE(qs8_rsum, neon_x16, xnn_qs8_rsum_ukernel__neon_x16, benchmark::utils::CheckNEON)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(qs8_rsum, neon_x32_acc2, xnn_qs8_rsum_ukernel__neon_x32_acc2, benchmark::utils::CheckNEON)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(qs8_rsum, neon_x64_acc4, xnn_qs8_rsum_ukernel__neon_x64_acc4, benchmark::utils::CheckNEON)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  BENCHMARK_CAPTURE(qs8_rsum, sse2_x16, xnn_qs8_rsum_ukernel__sse2_x16)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(qs8_rsum, sse2_x32_acc2, xnn_qs8_rsum_ukernel__sse2_x32_acc2)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(qs8_rsum, sse2_x64_acc4, xnn_qs8_rsum_ukernel__sse2_x64_acc4)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(qs8_rsum, avx2_x32, xnn_qs8_rsum_ukernel__avx2_x32, benchmark::utils::CheckAVX2)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(qs8_rsum, avx2_x64_acc2, xnn_qs8_rsum_ukernel__avx2_x64_acc2, benchmark::utils::CheckAVX2)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+
+  BENCHMARK_CAPTURE(qs8_rsum, avx2_x128_acc4, xnn_qs8_rsum_ukernel__avx2_x128_acc4, benchmark::utils::CheckAVX2)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000000)
+    ->UseRealTime();
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+BENCHMARK_CAPTURE(qs8_rsum, scalar_x1, xnn_qs8_rsum_ukernel__scalar_x1)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(qs8_rsum, scalar_x2_acc2, xnn_qs8_rsum_ukernel__scalar_x2_acc2)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+BENCHMARK_CAPTURE(qs8_rsum, scalar_x4_acc4, xnn_qs8_rsum_ukernel__scalar_x4_acc4)
+  ->RangeMultiplier(10)
+  ->Range(1000, 100000000)
+  ->UseRealTime();
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
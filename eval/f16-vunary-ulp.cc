@@ -0,0 +1,211 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <cpuinfo.h>
+#include <pthreadpool.h>
+
+#include <benchmark/benchmark.h>
+#include <fp16.h>
+
+#include "bench/utils.h"
+#include <xnnpack/aligned-allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/params.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/vunary.h>
+
+
+// Evaluates the accuracy of F16 vector unary micro-kernels against an FP32 reference, in ULPs of the FP16 result.
+// Inputs sweep all finite FP16 values; inputs whose reference result is not a finite normalized FP16 number are not
+// counted.
+
+typedef float (*ReferenceFunction)(float);
+typedef std::function<void(size_t batch, const uint16_t* input, uint16_t* output)> UKernelFunction;
+
+struct ComputeErrorContext {
+  const uint16_t* input;
+  const uint16_t* output;
+  float* error;
+  ReferenceFunction reference;
+};
+
+static void ComputeError(
+  struct ComputeErrorContext* context,
+  size_t start,
+  size_t range)
+{
+  const uint16_t* input = context->input;
+  const uint16_t* output = context->output;
+  float* error = context->error;
+  for (size_t i = start; i < start + range; i++) {
+    const float output_ref = context->reference(fp16_ieee_to_fp32_value(input[i]));
+    const float output_ref_abs = std::abs(output_ref);
+    if (!(output_ref_abs >= 6.103515625e-5f /* 0x1.0p-14 */ && output_ref_abs <= 65504.0f)) {
+      error[i] = 0.0f;
+      continue;
+    }
+    const float abs_error = std::abs(output_ref - fp16_ieee_to_fp32_value(output[i]));
+    const uint16_t output_abs = fp16_ieee_from_fp32_value(output_ref_abs);
+    const float output_ulp = fp16_ieee_to_fp32_value(output_abs + 1) - fp16_ieee_to_fp32_value(output_abs);
+    error[i] = float(abs_error / output_ulp);
+  }
+}
+
+static void VUnaryError(benchmark::State& state,
+  UKernelFunction ukernel,
+  ReferenceFunction reference,
+  benchmark::utils::IsaCheckFunction isa_check = nullptr)
+{
+  if (!cpuinfo_initialize()) {
+    state.SkipWithError("failed cpuinfo init");
+    return;
+  }
+  if (isa_check && !isa_check(state)) {
+    return;
+  }
+
+  // Number of elements in one block of inputs/outputs.
+  // Combining multiple elements in a block reduce function call overhead.
+  const size_t block_size = 16384;
+  // Number of elements in one parallelization tile. Worker threads process this many elements in each task.
+  const size_t tile_size = 64;
+
+  uint32_t num_threads = cpuinfo_get_cores_count();
+  #if XNN_ARCH_ARM || XNN_ARCH_ARM64
+    // Use all cores except for the least performant cluster
+    if (cpuinfo_get_clusters_count() > 1) {
+      num_threads -= cpuinfo_get_cluster(cpuinfo_get_clusters_count() - 1)->core_count;
+    }
+  #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+  std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> threadpool(
+    pthreadpool_create(num_threads), pthreadpool_destroy);
+
+  std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> x(block_size);
+  std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> y(block_size);
+  std::vector<float> ulp_error(block_size);
+  float max_ulp_error = 0.0f;
+
+  ComputeErrorContext context;
+  context.input = x.data();
+  context.output = y.data();
+  context.error = ulp_error.data();
+  context.reference = reference;
+  for (auto _ : state) {
+    for (uint32_t n = 0; n < UINT32_C(0x10000); n += block_size) {
+      for (uint32_t i = 0; i < block_size; i++) {
+        // Replace infinities and NaNs with zeroes, which do not contribute to the error.
+        const uint16_t bits = uint16_t(n + i);
+        x[i] = (bits & UINT16_C(0x7C00)) == UINT16_C(0x7C00) ? UINT16_C(0) : bits;
+      }
+      std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+
+      ukernel(block_size * sizeof(uint16_t), x.data(), y.data());
+
+      pthreadpool_parallelize_1d_tile_1d(
+          threadpool.get(),
+          reinterpret_cast<pthreadpool_task_1d_tile_1d_t>(ComputeError),
+          static_cast<void*>(&context),
+          block_size, tile_size, 0 /* flags */);
+
+      max_ulp_error = std::accumulate(ulp_error.cbegin(), ulp_error.cend(), max_ulp_error,
+        static_cast<const float& (*)(const float&, const float&)>(std::max<float>));
+    }
+  }
+
+  state.counters["ULPERROR"] = benchmark::Counter(max_ulp_error);
+}
+
+static float ExpReference(float x) {
+  return std::exp(x);
+}
+
+// GELU operators use the tanh approximation of the Gaussian CDF.
+static float GELUReference(float x) {
+  const double x_val = double(x);
+  return float(0.5 * x_val * (1.0 + std::tanh(std::sqrt(2.0 / M_PI) * (x_val + 0.044715 * x_val * x_val * x_val))));
+}
+
+static float LogReference(float x) {
+  return std::log(x);
+}
+
+static float SiLUReference(float x) {
+  return x / (1.0f + std::exp(-x));
+}
+
+static float TanhReference(float x) {
+  return std::tanh(x);
+}
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  static void f16_vexp__avx2_rr2_p5_x16(size_t batch, const uint16_t* input, uint16_t* output) {
+    union xnn_f16_exp_params params;
+    xnn_init_f16_exp_avx2_rr2_p5_params(&params);
+    xnn_f16_vexp_ukernel__avx2_rr2_p5_x16(batch, input, output, &params);
+  }
+
+  static void f16_vgelu__avx2_rr1_p5_div_x16(size_t batch, const uint16_t* input, uint16_t* output) {
+    union xnn_f16_gelu_params params;
+    xnn_init_f16_gelu_avx2_rr1_p5_params(&params);
+    xnn_f16_vgelu_ukernel__avx2_rr1_p5_div_x16(batch, input, output, &params);
+  }
+
+  static void f16_vlog__avx2_p4_div_x16(size_t batch, const uint16_t* input, uint16_t* output) {
+    union xnn_f16_log_params params;
+    xnn_init_f16_log_avx2_p4_params(&params);
+    xnn_f16_vlog_ukernel__avx2_p4_div_x16(batch, input, output, &params);
+  }
+
+  static void f16_vsilu__avx2_rr1_p5_div_x16(size_t batch, const uint16_t* input, uint16_t* output) {
+    union xnn_f16_silu_params params;
+    xnn_init_f16_silu_avx2_rr1_p5_params(&params);
+    xnn_f16_vsilu_ukernel__avx2_rr1_p5_div_x16(batch, input, output, &params);
+  }
+
+  static void f16_vtanh__avx2_expm1minus_rr1_p6_div_x16(size_t batch, const uint16_t* input, uint16_t* output) {
+    union xnn_f16_tanh_params params;
+    xnn_init_f16_tanh_avx2_expm1minus_rr1_p6_params(&params);
+    xnn_f16_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x16(batch, input, output, &params);
+  }
+
+  BENCHMARK_CAPTURE(VUnaryError, exp__avx2_rr2_p5,
+                    f16_vexp__avx2_rr2_p5_x16, ExpReference,
+                    benchmark::utils::CheckAVX2)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+  BENCHMARK_CAPTURE(VUnaryError, gelu__avx2_rr1_p5_div,
+                    f16_vgelu__avx2_rr1_p5_div_x16, GELUReference,
+                    benchmark::utils::CheckAVX2)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+  BENCHMARK_CAPTURE(VUnaryError, log__avx2_p4_div,
+                    f16_vlog__avx2_p4_div_x16, LogReference,
+                    benchmark::utils::CheckAVX2)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+  BENCHMARK_CAPTURE(VUnaryError, silu__avx2_rr1_p5_div,
+                    f16_vsilu__avx2_rr1_p5_div_x16, SiLUReference,
+                    benchmark::utils::CheckAVX2)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+  BENCHMARK_CAPTURE(VUnaryError, tanh__avx2_expm1minus_rr1_p6_div,
+                    f16_vtanh__avx2_expm1minus_rr1_p6_div_x16, TanhReference,
+                    benchmark::utils::CheckAVX2)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#ifndef XNNPACK_BENCHMARK_NO_MAIN
+BENCHMARK_MAIN();
+#endif
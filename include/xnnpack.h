@@ -48,6 +48,24 @@ extern "C" {
 /// Enable timing of each operator's runtime.
 #define XNN_FLAG_BASIC_PROFILING 0x00000008
 
+/// Record the running minimum and maximum of every FP32 Value produced by an operator in a Runtime.
+///
+/// Note: the recorded ranges can be queried with @ref xnn_get_runtime_value_range to calibrate quantization parameters.
+#define XNN_FLAG_COLLECT_VALUE_RANGES 0x00000100
+
+/// Allow BF16 storage of activations and static weights in a Runtime.
+///
+/// Note: this flag hints XNNPACK to consider BF16 inference, but does not guarantee it. Computations accumulate in FP32.
+/// Fully Connected Nodes run in BF16, other Nodes stay in FP32, and Convert Nodes are inserted between them.
+#define XNN_FLAG_HINT_BF16_INFERENCE 0x00000080
+
+/// Allow signed 8-bit quantized inference in a Runtime.
+///
+/// FP32 Values are quantized with parameters derived from the ranges set by @ref xnn_set_subgraph_value_range, and
+/// FP32 static weights are quantized per output channel when the Runtime is created.
+/// Note: this flag hints XNNPACK to consider QS8 inference, but does not guarantee it.
+#define XNN_FLAG_HINT_QS8_INFERENCE 0x00000200
+
 /// The convolution operator represents a depthwise convolution, and use HWGo layout for filters.
 #define XNN_FLAG_DEPTHWISE_CONVOLUTION 0x00000001
 
@@ -66,6 +84,9 @@ extern "C" {
 /// Match behaviour of TensorFlow 1.x.
 #define XNN_FLAG_TENSORFLOW_LEGACY_MODE 0x00000004
 
+/// Apply causal masking in attention: every query attends only to the keys at or before its own position.
+#define XNN_FLAG_CAUSAL_ATTENTION 0x00000004
+
 /// Static weights of the FP16 operator are in FP32 format.
 #define XNN_FLAG_FP32_STATIC_WEIGHTS 0x00000008
 
@@ -75,6 +96,21 @@ extern "C" {
 /// Yield worker threads of the thread pool to the system scheduler after the inference.
 #define XNN_FLAG_YIELD_WORKERS 0x00000010
 
+/// Do not use Winograd transforms in the convolution operator, even when they would be faster.
+///
+/// Note: Winograd convolution reorders floating-point computations and may produce slightly different results.
+#define XNN_FLAG_DISABLE_WINOGRAD 0x00000020
+
+/// Store static weights of the FP32 Fully Connected and Convolution operators in FP16 format, and convert them to FP32
+/// on the fly.
+///
+/// Note: weights and bias are rounded to FP16, and the results may differ from the FP32 computation. The flag is
+/// ignored for depthwise Convolution, and if the target does not support FP16-weight micro-kernels.
+#define XNN_FLAG_FP16_STATIC_WEIGHTS 0x00000040
+
+/// Keep reduced dimensions with size 1 in the output of Reduce operators.
+#define XNN_FLAG_KEEP_DIMS 0x00000400
+
 /// Status code for any XNNPACK function call.
 enum xnn_status {
   /// The call succeeded, and all output arguments now contain valid data.
@@ -203,6 +239,14 @@ enum xnn_datatype {
   xnn_datatype_qcint8 = 6,
   /// Quantized 32-bit signed integer with shared per-channel quantization parameters.
   xnn_datatype_qcint32 = 7,
+  /// Quantized 4-bit unsigned integer with shared per-channel scales and a shared zero point. Two elements are packed
+  /// in every byte, with the even element in the low nibble, and every row along the last dimension starts at a byte
+  /// boundary.
+  xnn_datatype_qcint4 = 8,
+  /// Brain floating-point: the upper 16 bits of an IEEE754 single-precision floating-point number.
+  xnn_datatype_bf16 = 9,
+  /// 32-bit signed integer without quantization parameters, e.g. indices of an Embedding Lookup Node.
+  xnn_datatype_int32 = 10,
 };
 
 /// Define a tensor-type Value and add it to a Subgraph.
@@ -297,6 +341,40 @@ enum xnn_status xnn_define_channelwise_quantized_tensor_value(
   uint32_t flags,
   uint32_t* id_out);
 
+/// Define a channelwise quantized tensor-type Value with a zero point and add it to a Subgraph.
+///
+/// Parameters are the same as in xnn_define_channelwise_quantized_tensor_value, except for:
+/// @param zero_point - quantization zero point shared by all channels. Must be in [0, 15] range for the
+///                     xnn_datatype_qcint4 datatype, and 0 for other datatypes.
+enum xnn_status xnn_define_channelwise_quantized_tensor_value_v2(
+  xnn_subgraph_t subgraph,
+  enum xnn_datatype datatype,
+  int32_t zero_point,
+  const float* scale,
+  size_t num_dims,
+  size_t channel_dim,
+  const size_t* dims,
+  const void* data,
+  uint32_t external_id,
+  uint32_t flags,
+  uint32_t* id_out);
+
+/// Set the expected range of elements of a Dense Tensor Value.
+///
+/// The range is used to derive quantization parameters of the Value when a Runtime is created with the
+/// XNN_FLAG_HINT_QS8_INFERENCE flag. Ranges observed on calibration data can be obtained from a Runtime created with the
+/// XNN_FLAG_COLLECT_VALUE_RANGES flag.
+///
+/// @param subgraph - a Subgraph object that owns the Value.
+/// @param value_id - Value ID of a non-static FP32 Dense Tensor Value defined in the @a subgraph.
+/// @param min - lower bound of the elements of the Value. Must be finite.
+/// @param max - upper bound of the elements of the Value. Must be finite and not less than @a min.
+enum xnn_status xnn_set_subgraph_value_range(
+  xnn_subgraph_t subgraph,
+  uint32_t value_id,
+  float min,
+  float max);
+
 /// Define a Convert Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -366,6 +444,118 @@ enum xnn_status xnn_define_convolution_2d(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a 3D Convolution Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_padding_front - implicit zero-padding before the first frame of 3D input data. Must be 0 if
+///                              XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_back - implicit zero-padding after the last frame of 3D input data. Must be 0 if
+///                             XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_top - implicit zero-padding above 3D input data. Must be 0 if XNN_FLAG_TENSORFLOW_SAME_PADDING
+///                            flag is specified.
+/// @param input_padding_right - implicit zero-padding to the right of 3D input data. Must be 0 if
+///                              XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_bottom - implicit zero-padding below 3D input data. Must be 0 if
+///                               XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_left - implicit zero-padding to the left of 3D input data. Must be 0 if
+///                             XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param kernel_depth - kernel (filter) depth.
+/// @param kernel_height - kernel (filter) height.
+/// @param kernel_width - kernel (filter) width.
+/// @param subsampling_depth - depth of subsampling region for convolution output (convolution depth stride).
+/// @param subsampling_height - height of subsampling region for convolution output (convolution height stride).
+/// @param subsampling_width - width of subsampling region for convolution output (convolution width stride).
+/// @param dilation_depth - dilation of kernel elements along the depth dimension.
+/// @param dilation_height - dilation of kernel elements along the height dimension.
+/// @param dilation_width - dilation of kernel elements along the width dimension.
+/// @param groups - number of convolution groups.
+/// @param group_input_channels - number of input channels per group.
+/// @param group_output_channels - number of output channels per group.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 5D tensor defined in the @a subgraph
+///                   with [N, ID, IH, IW, groups * group_input_channels] dimensions
+/// @param filter_id - Value ID for the filter tensor. The filter tensor must ge a 5D tensor defined in the @a subgraph
+///                    with [groups * group_output_channels, kernel_depth, kernel_height, kernel_width,
+///                    group_input_channels] dimensions.
+/// @param bias_id - Value ID for the bias tensor, or XNN_INVALID_VALUE_ID for a 3D Convolution Node without bias. If
+///                  present, the bias tensor must be a 1D tensor defined in the @a subgraph with
+///                  [groups * group_output_channels] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 5D tensor defined in the @a subgraph
+///                    with [N, OD, OH, OW, groups * group_output_channels] dimensions.
+/// @param flags - binary features of the 3D Convolution Node. The only currently supported values is
+///                XNN_FLAG_TENSORFLOW_SAME_PADDING.
+enum xnn_status xnn_define_convolution_3d(
+  xnn_subgraph_t subgraph,
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_depth,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_depth,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_depth,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  float output_min,
+  float output_max,
+  uint32_t input_id,
+  uint32_t filter_id,
+  uint32_t bias_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Streaming 1D Convolution Node and add it to a Subgraph.
+///
+/// The Streaming 1D Convolution Node computes a causal 1D convolution over a stream of frames: every invocation of the
+/// Runtime processes only the new frames of the input, and the Node keeps the last (kernel_size - 1) * dilation input
+/// frames of every batch element until the next invocation. Before the first invocation, and after
+/// @ref xnn_reset_runtime_state, the history consists of zero frames.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param kernel_size - kernel (filter) size, in frames.
+/// @param dilation - dilation of kernel elements.
+/// @param groups - number of convolution groups.
+/// @param group_input_channels - number of input channels per group.
+/// @param group_output_channels - number of output channels per group.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 3D tensor defined in the @a subgraph
+///                   with [N, T, groups * group_input_channels] dimensions, where T is the number of new frames.
+/// @param filter_id - Value ID for the filter tensor. The filter tensor must be a 3D tensor defined in the @a subgraph
+///                    with [groups * group_output_channels, kernel_size, group_input_channels] dimensions, or with
+///                    [1, kernel_size, groups * group_output_channels] dimensions if XNN_FLAG_DEPTHWISE_CONVOLUTION is
+///                    specified.
+/// @param bias_id - Value ID for the bias tensor, or XNN_INVALID_VALUE_ID for a Streaming 1D Convolution Node without
+///                  bias. If present, the bias tensor must be a 1D tensor defined in the @a subgraph with
+///                  [groups * group_output_channels] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 3D tensor defined in the @a subgraph
+///                    with [N, T, groups * group_output_channels] dimensions.
+/// @param flags - binary features of the Streaming 1D Convolution Node. The only currently supported value is
+///                XNN_FLAG_DEPTHWISE_CONVOLUTION, which requires group_input_channels to be 1.
+enum xnn_status xnn_define_streaming_convolution_1d(
+  xnn_subgraph_t subgraph,
+  uint32_t kernel_size,
+  uint32_t dilation,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  float output_min,
+  float output_max,
+  uint32_t input_id,
+  uint32_t filter_id,
+  uint32_t bias_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 2D Deconvolution (Transposed Convolution) Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -556,6 +746,58 @@ enum xnn_status xnn_define_average_pooling_2d(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a 3D Average Pooling Node and add it to a Subgraph. Padding pixels are excluded from the average.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_padding_front - implicit zero-padding before the first frame of 3D input data. Must be 0 if
+///                              XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_back - implicit zero-padding after the last frame of 3D input data. Must be 0 if
+///                             XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_top - implicit zero-padding above 3D input data. Must be 0 if XNN_FLAG_TENSORFLOW_SAME_PADDING
+///                            flag is specified.
+/// @param input_padding_right - implicit zero-padding to the right of 3D input data. Must be 0 if
+///                              XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_bottom - implicit zero-padding below 3D input data. Must be 0 if
+///                               XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_left - implicit zero-padding to the left of 3D input data. Must be 0 if
+///                             XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param pooling_depth - pooling (kernel) depth.
+/// @param pooling_height - pooling (kernel) height.
+/// @param pooling_width - pooling (kernel) width.
+/// @param stride_depth - displacing of the pooling window in the depth dimension of the input pixels corresponding
+///                       to adjacent output frames.
+/// @param stride_height - displacing of the pooling window in the vertical dimension of the input pixels corresponding
+///                        to vertically adjacent output pixels.
+/// @param stride_width - displacing of the pooling window in the horizontal dimension of the input pixels corresponding
+///                        to horizontally adjacent output pixels.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 5D tensor defined in the @a subgraph
+///                   with [N, ID, IH, IW, channels] dimensions
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 5D tensor defined in the @a subgraph
+///                    with [N, OD, OH, OW, channels] dimensions.
+/// @param flags - binary features of the 3D Average Pooling Node. The only currently supported values is
+///                XNN_FLAG_TENSORFLOW_SAME_PADDING.
+enum xnn_status xnn_define_average_pooling_3d(
+  xnn_subgraph_t subgraph,
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_depth,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_depth,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  float output_min,
+  float output_max,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Fully Connected Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -574,6 +816,9 @@ enum xnn_status xnn_define_average_pooling_2d(
 ///                    If the XNN_FLAG_TRANSPOSE_WEIGHTS flag is not specified, the filter tensor must have
 ///                    [output_channels, input_channels] dimensions. If the XNN_FLAG_TRANSPOSE_WEIGHTS flag is
 ///                    specified, the filter tensor must have [input_channels, output_channels] dimensions.
+///                    With FP32 input and output, the filter tensor may be a channelwise-quantized INT8 tensor,
+///                    quantized along the output channels dimension. In this case, the input is quantized to INT8
+///                    dynamically, row by row.
 /// @param bias_id - Value ID for the bias tensor, or XNN_INVALID_VALUE_ID for a Fully Connected Node without a bias.
 ///                  If present, the bias tensor must be a 1D tensor defined in the @a subgraph with [output_channels]
 ///                  dimensions.
@@ -587,7 +832,7 @@ enum xnn_status xnn_define_average_pooling_2d(
 ///                    [num_input_elements / input_channels, output_channels] dimensions where num_input_elements is the
 ///                    total number of elements in the input tensor.
 /// @param flags - binary features of the Fully Connected Node. The only currently supported values are
-///                XNN_FLAG_TENSORFLOW_RESHAPE_2D and XNN_FLAG_TRANSPOSE_WEIGHTS.
+///                XNN_FLAG_TENSORFLOW_RESHAPE_2D, XNN_FLAG_TRANSPOSE_WEIGHTS, and XNN_FLAG_FP16_STATIC_WEIGHTS.
 enum xnn_status xnn_define_fully_connected(
   xnn_subgraph_t subgraph,
   float output_min,
@@ -598,6 +843,38 @@ enum xnn_status xnn_define_fully_connected(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Scaled Dot-Product Attention Node and add it to a Subgraph.
+///
+/// The Node computes softmax(scale * query x key^T + mask) x value for every batch element and head. Attention is
+/// computed for a tile of queries at a time while streaming tiles of keys and values with an online softmax, and the
+/// full matrix of attention scores is never materialized.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param scale - multiplier for the dot products of queries and keys, typically 1 / sqrt(channels).
+/// @param query_id - Value ID for the query tensor. The query tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, H, T, C] dimensions: batch size, number of heads, number of query tokens, and channels.
+/// @param key_id - Value ID for the key tensor. The key tensor must be a 4D tensor defined in the @a subgraph with
+///                 [N, H, S, C] dimensions, where S is the number of key tokens.
+/// @param value_id - Value ID for the value tensor. The value tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, H, S, V] dimensions, where V is the number of value channels.
+/// @param mask_id - Value ID for the additive attention mask, or XNN_INVALID_VALUE_ID for a Node without a mask. If
+///                  present, the mask tensor must be a 2D tensor defined in the @a subgraph with [T, S] dimensions,
+///                  and it is shared by all batch elements and heads.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, H, T, V] dimensions.
+/// @param flags - binary features of the Scaled Dot-Product Attention Node. The only currently supported value is
+///                XNN_FLAG_CAUSAL_ATTENTION. With causal attention, query token i attends to key tokens up to
+///                i + S - T, and S must be at least T.
+enum xnn_status xnn_define_scaled_dot_product_attention(
+  xnn_subgraph_t subgraph,
+  float scale,
+  uint32_t query_id,
+  uint32_t key_id,
+  uint32_t value_id,
+  uint32_t mask_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 2D Max Pooling Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -643,6 +920,58 @@ enum xnn_status xnn_define_max_pooling_2d(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a 3D Max Pooling Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_padding_front - implicit zero-padding before the first frame of 3D input data. Must be 0 if
+///                              XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_back - implicit zero-padding after the last frame of 3D input data. Must be 0 if
+///                             XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_top - implicit zero-padding above 3D input data. Must be 0 if XNN_FLAG_TENSORFLOW_SAME_PADDING
+///                            flag is specified.
+/// @param input_padding_right - implicit zero-padding to the right of 3D input data. Must be 0 if
+///                              XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_bottom - implicit zero-padding below 3D input data. Must be 0 if
+///                               XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param input_padding_left - implicit zero-padding to the left of 3D input data. Must be 0 if
+///                             XNN_FLAG_TENSORFLOW_SAME_PADDING flag is specified.
+/// @param pooling_depth - pooling (kernel) depth.
+/// @param pooling_height - pooling (kernel) height.
+/// @param pooling_width - pooling (kernel) width.
+/// @param stride_depth - displacing of the pooling window in the depth dimension of the input pixels corresponding
+///                       to adjacent output frames.
+/// @param stride_height - displacing of the pooling window in the vertical dimension of the input pixels corresponding
+///                        to vertically adjacent output pixels.
+/// @param stride_width - displacing of the pooling window in the horizontal dimension of the input pixels corresponding
+///                        to horizontally adjacent output pixels.
+/// @param output_min - lower bound for clipping output values.
+/// @param output_max - upper bound for clipping output values.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 5D tensor defined in the @a subgraph
+///                   with [N, ID, IH, IW, channels] dimensions
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 5D tensor defined in the @a subgraph
+///                    with [N, OD, OH, OW, channels] dimensions.
+/// @param flags - binary features of the 3D Max Pooling Node. The only currently supported values is
+///                XNN_FLAG_TENSORFLOW_SAME_PADDING.
+enum xnn_status xnn_define_max_pooling_3d(
+  xnn_subgraph_t subgraph,
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_depth,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_depth,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  float output_min,
+  float output_max,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 2D ArgMax Pooling Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -909,6 +1238,187 @@ enum xnn_status xnn_define_static_constant_pad(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Slice Node with static offsets and sizes and add it to a Subgraph.
+///
+/// When the slice selects a contiguous block of the input tensor (e.g. a range of the outermost dimension), and the
+/// output is not an external Value, the output aliases the memory of the input and no data is copied at runtime.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_dims - number of dimensions in the input and output tensors.
+/// @param offsets - offsets of the first sliced element in every dimension of the input tensor. This array must have
+///                  @a num_dims elements.
+/// @param sizes - number of sliced elements in every dimension. This array must have @a num_dims non-zero elements,
+///                and offsets[i] + sizes[i] must not exceed the i-th dimension of the input tensor.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a @a num_dims-dimensional tensor defined
+///                   in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a @a num_dims-dimensional tensor
+///                    defined in the @a subgraph with the same datatype and quantization parameters as the input
+///                    tensor, and its shape must match @a sizes.
+/// @param flags - binary features of the Slice Node. No supported flags are currently defined.
+enum xnn_status xnn_define_static_slice(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* offsets,
+  const size_t* sizes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Type of reduction computed by Reduce operators and Nodes.
+enum xnn_reduce_operator {
+  xnn_reduce_invalid = -1,
+  /// Sum of the elements.
+  xnn_reduce_sum,
+  /// Arithmetic mean of the elements.
+  xnn_reduce_mean,
+  /// Maximum of the elements.
+  xnn_reduce_max,
+};
+
+/// Define a Sum Node with static reduction axes and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which the sum is computed.
+/// @param reduction_axes - axes along which the sum is computed, in increasing order. Each axis must be smaller than
+///                         the number of dimensions in the input tensor.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor with the reduction axes removed, or set to 1 if
+///                    XNN_FLAG_KEEP_DIMS is specified.
+/// @param flags - binary features of the Sum Node. The only currently supported value is XNN_FLAG_KEEP_DIMS.
+enum xnn_status xnn_define_static_reduce_sum(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Mean Node with static reduction axes and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which the mean is computed.
+/// @param reduction_axes - axes along which the mean is computed, in increasing order. Each axis must be smaller than
+///                         the number of dimensions in the input tensor.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor with the reduction axes removed, or set to 1 if
+///                    XNN_FLAG_KEEP_DIMS is specified.
+/// @param flags - binary features of the Mean Node. The only currently supported value is XNN_FLAG_KEEP_DIMS.
+enum xnn_status xnn_define_static_reduce_mean(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a Max Node with static reduction axes and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param num_reduction_axes - number of axes along which the maximum is computed.
+/// @param reduction_axes - axes along which the maximum is computed, in increasing order. Each axis must be smaller
+///                         than the number of dimensions in the input tensor.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor with the reduction axes removed, or set to 1 if
+///                    XNN_FLAG_KEEP_DIMS is specified.
+/// @param flags - binary features of the Max Node. The only currently supported value is XNN_FLAG_KEEP_DIMS.
+enum xnn_status xnn_define_static_reduce_max(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define an ArgMax Node and add it to a Subgraph.
+///
+/// The ArgMax Node computes the index of the largest element along the innermost dimension of the input. When several
+/// elements are equal to the maximum, the smallest index is produced. NaN is greater than any other value.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional tensor defined in the
+///                   @a subgraph with at least one dimension.
+/// @param output_id - Value ID for the output tensor. The output tensor must be an INT32 tensor defined in the
+///                    @a subgraph, with the number of elements equal to the number of elements of the input tensor
+///                    divided by its innermost dimension.
+/// @param flags - binary features of the ArgMax Node. No supported flags are currently defined.
+enum xnn_status xnn_define_argmax(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a TopK Node and add it to a Subgraph.
+///
+/// The TopK Node computes the k largest elements along the innermost dimension of the input, and their indices, in
+/// order of decreasing value. Equal elements are ordered by increasing index. NaN is greater than any other value.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param k - number of elements to produce. Must not exceed the innermost dimension of the input.
+/// @param input_id - Value ID for the input tensor. The input tensor must be an N-dimensional FP32 tensor defined in
+///                   the @a subgraph with at least one dimension.
+/// @param output_values_id - Value ID for the output tensor of the largest values. The tensor must be an FP32 tensor
+///                           defined in the @a subgraph with the shape of the input, except for the innermost
+///                           dimension, which must be k.
+/// @param output_indices_id - Value ID for the output tensor of the indices of the largest values. The tensor must be
+///                            an INT32 tensor defined in the @a subgraph with the same shape as the output values.
+/// @param flags - binary features of the TopK Node. No supported flags are currently defined.
+enum xnn_status xnn_define_topk(
+  xnn_subgraph_t subgraph,
+  size_t k,
+  uint32_t input_id,
+  uint32_t output_values_id,
+  uint32_t output_indices_id,
+  uint32_t flags);
+
+/// Define an Embedding Lookup Node and add it to a Subgraph.
+///
+/// The Embedding Lookup Node gathers rows of a static embedding table at the specified indices.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param table_id - Value ID for the embedding table. The table must be a static 2D tensor defined in the @a subgraph,
+///                   with [num_embeddings, embedding_dim] dimensions.
+/// @param indices_id - Value ID for the indices tensor. The indices tensor must be an INT32 tensor defined in the
+///                     @a subgraph, and every index must be in the [0, num_embeddings) range. Indices are checked
+///                     when the Node runs, and out-of-range indices fail the invocation of the Runtime.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph with the
+///                    datatype of the table, and its shape must be the shape of the indices with an extra innermost
+///                    dimension of embedding_dim elements. For quantized tables, the output tensor must have the same
+///                    quantization parameters as the table.
+/// @param flags - binary features of the Embedding Lookup Node. No supported flags are currently defined.
+enum xnn_status xnn_define_embedding_lookup(
+  xnn_subgraph_t subgraph,
+  uint32_t table_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define an Embedding Bag Node and add it to a Subgraph.
+///
+/// The Embedding Bag Node gathers rows of a static embedding table at the specified indices, and reduces the rows
+/// gathered for every bag to a single row.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param bag_operator - reduction of the rows in a bag: xnn_reduce_sum or xnn_reduce_mean.
+/// @param table_id - Value ID for the embedding table. The table must be a static 2D FP32 tensor defined in the
+///                   @a subgraph, with [num_embeddings, embedding_dim] dimensions.
+/// @param indices_id - Value ID for the indices tensor. The indices tensor must be an INT32 tensor with at least one
+///                     dimension defined in the @a subgraph. The innermost dimension enumerates indices in a bag, and
+///                     every index must be in the [0, num_embeddings) range. Indices are checked when the Node runs,
+///                     and out-of-range indices fail the invocation of the Runtime.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must be the shape of the indices with the innermost dimension replaced by embedding_dim.
+/// @param flags - binary features of the Embedding Bag Node. No supported flags are currently defined.
+enum xnn_status xnn_define_embedding_bag(
+  xnn_subgraph_t subgraph,
+  enum xnn_reduce_operator bag_operator,
+  uint32_t table_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a 2-Input Concatenate Node and add it to a Subgraph.
 ///
 /// The 2-Input Concatenate Node concatenates two tensors along a specified axis.
@@ -1115,6 +1625,25 @@ enum xnn_status xnn_define_static_resize_bilinear_2d(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a 2D Resize Nearest Neighbor Node with static output height & width specification and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param new_height - height dimension of the output tensor.
+/// @param new_width - width dimension of the output tensor.
+/// @param input_id - Value ID for the input tensor. The input tensor must be a 4D tensor defined in the @a subgraph
+///                   with [N, H, W, C] dimensions.
+/// @param output_id - Value ID for the output tensor. The output tensor must be a 4D tensor defined in the @a subgraph
+///                    with [N, new_height, new_width, C] dimensions.
+/// @param flags - binary features of the 2D Resize Nearest Neighbor Node. The only currently supported values are
+///                XNN_FLAG_TENSORFLOW_LEGACY_MODE and XNN_FLAG_ALIGN_CORNERS, which are mutually exclusive.
+enum xnn_status xnn_define_static_resize_nearest_neighbor_2d(
+  xnn_subgraph_t subgraph,
+  size_t new_height,
+  size_t new_width,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a PReLU (Parametric ReLU) Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1203,20 +1732,48 @@ enum xnn_status xnn_define_elu(
   uint32_t output_id,
   uint32_t flags);
 
-/// Define a Floor Node and add it to a Subgraph.
+/// Define an Exp Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
 /// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
 /// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
 ///                    shape must match the shape of the input tensor.
-/// @param flags - binary features of the Floor Node. No supported flags are currently defined.
-enum xnn_status xnn_define_floor(
+/// @param flags - binary features of the Exp Node. No supported flags are currently defined.
+enum xnn_status xnn_define_exp(
   xnn_subgraph_t subgraph,
   uint32_t input_id,
   uint32_t output_id,
   uint32_t flags);
 
-/// Define a HardSwish Node and add it to a Subgraph.
+/// Define a Floor Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Floor Node. No supported flags are currently defined.
+enum xnn_status xnn_define_floor(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a GELU (Gaussian Error Linear Unit) Node and add it to a Subgraph.
+///
+/// GELU is computed with the tanh approximation, x * sigmoid(sqrt(8 / pi) * (x + 0.044715 * x**3)).
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the GELU Node. No supported flags are currently defined.
+enum xnn_status xnn_define_gelu(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
+/// Define a HardSwish Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
 /// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
@@ -1229,6 +1786,31 @@ enum xnn_status xnn_define_hardswish(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Layer Normalization Node and add it to a Subgraph.
+///
+/// The Node normalizes the input over its last (channel) dimension to zero mean and unit variance, then applies a
+/// per-channel scale and offset: output = (input - mean) / sqrt(variance + epsilon) * gamma + beta.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param epsilon - small positive value added to the variance to avoid division by zero.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph, and have at
+///                   least one dimension.
+/// @param gamma_id - Value ID for the scale tensor. The scale tensor must be a static tensor defined in the
+///                   @a subgraph with as many elements as the last dimension of the input tensor.
+/// @param beta_id - Value ID for the offset tensor. The offset tensor must be a static tensor defined in the
+///                  @a subgraph with as many elements as the last dimension of the input tensor.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Layer Normalization Node. No supported flags are currently defined.
+enum xnn_status xnn_define_layer_normalization(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t beta_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Leaky ReLU Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1244,6 +1826,19 @@ enum xnn_status xnn_define_leaky_relu(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Log (natural logarithm) Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Log Node. No supported flags are currently defined.
+enum xnn_status xnn_define_log(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a Negate Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
@@ -1270,13 +1865,27 @@ enum xnn_status xnn_define_sigmoid(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a SiLU (Sigmoid Linear Unit, also known as Swish) Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the SiLU Node. No supported flags are currently defined.
+enum xnn_status xnn_define_silu(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Define a SoftMax Node and add it to a Subgraph.
 ///
 /// @param subgraph - a Subgraph object that will own the created Node.
 /// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph, and have at
 ///                   least one dimension.
 /// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
-///                    shape must match the shape of the input tensor.
+///                    shape must match the shape of the input tensor. If the output tensor is quantized, its scale
+///                    must be 1/256, and its zero point must be -128 for QINT8 and 0 for QUINT8 datatype.
 /// @param flags - binary features of the SoftMax Node. No supported flags are currently defined.
 enum xnn_status xnn_define_softmax(
   xnn_subgraph_t subgraph,
@@ -1310,6 +1919,19 @@ enum xnn_status xnn_define_square_root(
   uint32_t output_id,
   uint32_t flags);
 
+/// Define a Tanh Node and add it to a Subgraph.
+///
+/// @param subgraph - a Subgraph object that will own the created Node.
+/// @param input_id - Value ID for the input tensor. The input tensor must be defined in the @a subgraph.
+/// @param output_id - Value ID for the output tensor. The output tensor must be defined in the @a subgraph, and its
+///                    shape must match the shape of the input tensor.
+/// @param flags - binary features of the Tanh Node. No supported flags are currently defined.
+enum xnn_status xnn_define_tanh(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags);
+
 /// Weights cache is a cache for packed weights. It can be reused between runtimes.
 typedef struct xnn_weights_cache* xnn_weights_cache_t;
 
@@ -1353,6 +1975,28 @@ enum xnn_status xnn_get_runtime_profiling_info(xnn_runtime_t runtime,
                                                void* param_value,
                                                size_t* param_value_size_ret);
 
+/// Return the range of values observed in a Value across all invocations of a Runtime.
+///
+/// The range is recorded only for FP32 Values produced by operators in the Runtime, i.e. internal Values and external
+/// outputs. Before any invocation, or if the Value was fused away during Runtime creation, the returned minimum is
+/// +infinity and the returned maximum is -infinity.
+///
+/// @param runtime - a Runtime object created with the XNN_FLAG_COLLECT_VALUE_RANGES flag.
+/// @param value_id - ID of the Value in the Subgraph the Runtime was created from.
+/// @param min_out - pointer to the variable that will be initialized with the minimum observed value.
+/// @param max_out - pointer to the variable that will be initialized with the maximum observed value.
+enum xnn_status xnn_get_runtime_value_range(
+  xnn_runtime_t runtime,
+  uint32_t value_id,
+  float* min_out,
+  float* max_out);
+
+/// Discard the ranges of values recorded by a Runtime created with the XNN_FLAG_COLLECT_VALUE_RANGES flag.
+///
+/// @param runtime - a Runtime object created with the XNN_FLAG_COLLECT_VALUE_RANGES flag.
+enum xnn_status xnn_reset_runtime_value_ranges(
+  xnn_runtime_t runtime);
+
 /// Create a Runtime object from a subgraph.
 ///
 /// @param subgraph - a Subgraph object with all Values and Nodes that would be handled by the runtime. No Values or
@@ -1362,8 +2006,9 @@ enum xnn_status xnn_get_runtime_profiling_info(xnn_runtime_t runtime,
 /// @param threadpool - the thread pool to be used for parallelisation of computations in the runtime. If the thread
 ///                     pool is NULL, the computation would run on the caller thread without parallelization.
 /// @param flags - binary features of the runtime. The only currently supported values are
-///                XNN_FLAG_HINT_SPARSE_INFERENCE, XNN_FLAG_HINT_FP16_INFERENCE, XNN_FLAG_FORCE_FP16_INFERENCE, and
-///                XNN_FLAG_YIELD_WORKERS. If XNN_FLAG_YIELD_WORKERS is specified, worker threads would be yielded to
+///                XNN_FLAG_HINT_SPARSE_INFERENCE, XNN_FLAG_HINT_FP16_INFERENCE, XNN_FLAG_FORCE_FP16_INFERENCE,
+///                XNN_FLAG_HINT_BF16_INFERENCE, XNN_FLAG_HINT_QS8_INFERENCE, XNN_FLAG_BASIC_PROFILING,
+///                XNN_FLAG_COLLECT_VALUE_RANGES, and XNN_FLAG_YIELD_WORKERS. If XNN_FLAG_YIELD_WORKERS is specified, worker threads would be yielded to
 ///                the system scheduler after processing the last operator in the Runtime.
 /// @param runtime_out - pointer to the variable that will be initialized with a handle to the Runtime object upon
 ///                      successful return. Once constructed, the Runtime object is independent of the Subgraph object
@@ -1408,6 +2053,13 @@ enum xnn_status xnn_setup_runtime(
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime);
 
+/// Clear the state that stateful operators in the runtime keep between invocations, e.g. the history of Streaming 1D
+/// Convolution Nodes, as if the runtime was never invoked.
+///
+/// @param runtime - the Runtime object to reset.
+enum xnn_status xnn_reset_runtime_state(
+  xnn_runtime_t runtime);
+
 /// Destroy a Runtime object, as well as operators and memory associated with it.
 ///
 /// @param runtime - the Runtime object to destroy.
@@ -1423,6 +2075,12 @@ enum xnn_status xnn_run_operator(
 enum xnn_status xnn_delete_operator(
   xnn_operator_t op);
 
+/// Clear the history of a Streaming Convolution operator, as if it had not processed any frames yet.
+///
+/// @param convolution_op - a Streaming Convolution operator of any datatype.
+enum xnn_status xnn_reset_streaming_convolution1d_nwc(
+  xnn_operator_t convolution_op);
+
 #ifndef XNN_NO_F32_OPERATORS
 
 enum xnn_status xnn_create_abs_nc_f32(
@@ -1456,6 +2114,19 @@ enum xnn_status xnn_setup_add_nd_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_argmax_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  uint32_t flags,
+  xnn_operator_t* argmax_op_out);
+
+enum xnn_status xnn_setup_argmax_nc_f32(
+  xnn_operator_t argmax_op,
+  size_t batch_size,
+  const float* input,
+  int32_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_argmax_pooling2d_nhwc_f32(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -1505,6 +2176,37 @@ enum xnn_status xnn_setup_average_pooling2d_nhwc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_average_pooling3d_ndhwc_f32(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_depth,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_depth,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* average_pooling_op_out);
+
+enum xnn_status xnn_setup_average_pooling3d_ndhwc_f32(
+  xnn_operator_t average_pooling_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_bankers_rounding_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1584,6 +2286,45 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_convolution3d_ndhwc_f32(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_depth,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_depth,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_depth,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_convolution3d_ndhwc_f32(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_deconvolution2d_nhwc_f32(
   uint32_t output_padding_top,
   uint32_t output_padding_right,
@@ -1651,6 +2392,36 @@ enum xnn_status xnn_setup_elu_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_embedding_bag_nc_f32(
+  enum xnn_reduce_operator bag_operator,
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const float* table,
+  uint32_t flags,
+  xnn_operator_t* embedding_bag_op_out);
+
+enum xnn_status xnn_setup_embedding_bag_nc_f32(
+  xnn_operator_t embedding_bag_op,
+  size_t batch_size,
+  size_t bag_size,
+  const int32_t* indices,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_exp_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* exp_op_out);
+
+enum xnn_status xnn_setup_exp_nc_f32(
+  xnn_operator_t exp_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_floor_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1685,6 +2456,53 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+/// Create a Fully Connected operator with FP32 input and output, and 4-bit weights with per-channel scales.
+///
+/// Weights are dequantized on the fly as (weight - kernel_zero_point) * kernel_scale[output_channel], and the products
+/// are accumulated in FP32.
+///
+/// @param kernel_zero_point - zero point of the 4-bit weights, in [0, 15] range.
+/// @param kernel_scale - per-output-channel scales of the kernel, an array of output_channels elements.
+/// @param kernel - 4-bit weights in OI layout: every row of input_channels elements takes (input_channels + 1) / 2
+///                 bytes, with the even element in the low nibble of a byte, and the odd element in the high nibble.
+///                 XNN_FLAG_TRANSPOSE_WEIGHTS is not supported.
+/// @param bias - an optional FP32 bias with output_channels elements.
+enum xnn_status xnn_create_fully_connected_nc_f32_qc4w(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint8_t kernel_zero_point,
+  const float* kernel_scale,
+  const void* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_f32_qc4w(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_gelu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* gelu_op_out);
+
+enum xnn_status xnn_setup_gelu_nc_f32(
+  xnn_operator_t gelu_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_f32(
   size_t channels,
   size_t input_stride,
@@ -1716,6 +2534,23 @@ enum xnn_status xnn_setup_hardswish_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_layer_normalization_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  const float* gamma,
+  const float* beta,
+  uint32_t flags,
+  xnn_operator_t* layer_normalization_op_out);
+
+enum xnn_status xnn_setup_layer_normalization_nc_f32(
+  xnn_operator_t layer_normalization_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_leaky_relu_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -1731,6 +2566,20 @@ enum xnn_status xnn_setup_leaky_relu_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_log_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* log_op_out);
+
+enum xnn_status xnn_setup_log_nc_f32(
+  xnn_operator_t log_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_max_pooling2d_nhwc_f32(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -1759,6 +2608,37 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_max_pooling3d_ndhwc_f32(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_depth,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_depth,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* max_pooling_op_out);
+
+enum xnn_status xnn_setup_max_pooling3d_ndhwc_f32(
+  xnn_operator_t max_pooling_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_maximum_nd_f32(
   uint32_t flags,
   xnn_operator_t* maximum_op_out);
@@ -1836,6 +2716,21 @@ enum xnn_status xnn_setup_prelu_nc_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_reduce_nd_f32(
+  enum xnn_reduce_operator reduce_operator,
+  uint32_t flags,
+  xnn_operator_t* reduce_op_out);
+
+enum xnn_status xnn_setup_reduce_nd_f32(
+  xnn_operator_t reduce_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_resize_bilinear2d_nchw_f32(
   size_t channels,
   size_t input_pixel_stride,
@@ -1872,15 +2767,85 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_f32(
   float* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_sigmoid_nc_f32(
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_f32(
   size_t channels,
-  size_t input_stride,
-  size_t output_stride,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
   uint32_t flags,
-  xnn_operator_t* sigmoid_op_out);
+  xnn_operator_t* resize_op_out);
 
-enum xnn_status xnn_setup_sigmoid_nc_f32(
-  xnn_operator_t sigmoid_op,
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_f32(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nhwc_f32(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nhwc_f32(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_scaled_dot_product_attention_nhtc_f32(
+  float scale,
+  uint32_t flags,
+  xnn_operator_t* attention_op_out);
+
+enum xnn_status xnn_setup_scaled_dot_product_attention_nhtc_f32(
+  xnn_operator_t attention_op,
+  size_t batch_size,
+  size_t heads,
+  size_t query_tokens,
+  size_t key_tokens,
+  size_t channels,
+  size_t value_channels,
+  const float* query,
+  const float* key,
+  const float* value,
+  const float* mask,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_sigmoid_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* sigmoid_op_out);
+
+enum xnn_status xnn_setup_sigmoid_nc_f32(
+  xnn_operator_t sigmoid_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_silu_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* silu_op_out);
+
+enum xnn_status xnn_setup_silu_nc_f32(
+  xnn_operator_t silu_op,
   size_t batch_size,
   const float* input,
   float* output,
@@ -1943,6 +2908,30 @@ enum xnn_status xnn_setup_squared_difference_nd_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_streaming_convolution1d_nwc_f32(
+  uint32_t kernel_size,
+  uint32_t dilation,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  const float* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_streaming_convolution1d_nwc_f32(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_frames,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_subtract_nd_f32(
   float output_min,
   float output_max,
@@ -1960,6 +2949,35 @@ enum xnn_status xnn_setup_subtract_nd_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_tanh_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* tanh_op_out);
+
+enum xnn_status xnn_setup_tanh_nc_f32(
+  xnn_operator_t tanh_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_topk_nc_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t k,
+  uint32_t flags,
+  xnn_operator_t* topk_op_out);
+
+enum xnn_status xnn_setup_topk_nc_f32(
+  xnn_operator_t topk_op,
+  size_t batch_size,
+  const float* input,
+  float* output_values,
+  int32_t* output_indices,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_truncation_nc_f32(
   size_t channels,
   size_t input_stride,
@@ -2060,6 +3078,20 @@ enum xnn_status xnn_setup_constant_pad_nd_x32(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_slice_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x32(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_copy_nc_x32(
   size_t channels,
   size_t input_stride,
@@ -2108,6 +3140,20 @@ enum xnn_status xnn_setup_depth_to_space_nchw2nhwc_x32(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_embedding_lookup_nc_x32(
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const void* table,
+  uint32_t flags,
+  xnn_operator_t* embedding_lookup_op_out);
+
+enum xnn_status xnn_setup_embedding_lookup_nc_x32(
+  xnn_operator_t embedding_lookup_op,
+  size_t batch_size,
+  const int32_t* indices,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_transpose_nd_x32(
     uint32_t flags,
     xnn_operator_t* transpose_op_out);
@@ -2146,6 +3192,39 @@ enum xnn_status xnn_setup_unpooling2d_nhwc_x32(
 
 #endif  // XNN_NO_X32_OPERATORS
 
+#ifndef XNN_NO_BF16_OPERATORS
+
+/// Create a Fully Connected operator with BF16 inputs, weights, and outputs.
+///
+/// Products are accumulated in FP32, and biases are specified and stored in FP32. Packed weights take half the memory
+/// of FP32 weights.
+///
+/// @param kernel - BF16 weights, in [output_channels, input_channels] layout, or in [input_channels, output_channels]
+///                 layout with XNN_FLAG_TRANSPOSE_WEIGHTS. With XNN_FLAG_FP32_STATIC_WEIGHTS the weights are FP32 and
+///                 are rounded to BF16 when packed.
+/// @param bias - FP32 biases, or NULL to omit the bias.
+enum xnn_status xnn_create_fully_connected_nc_bf16(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const void* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_bf16(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+#endif  // XNN_NO_BF16_OPERATORS
+
 #ifndef XNN_NO_F16_OPERATORS
 
 enum xnn_status xnn_create_add_nd_f16(
@@ -2165,6 +3244,19 @@ enum xnn_status xnn_setup_add_nd_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_argmax_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  uint32_t flags,
+  xnn_operator_t* argmax_op_out);
+
+enum xnn_status xnn_setup_argmax_nc_f16(
+  xnn_operator_t argmax_op,
+  size_t batch_size,
+  const void* input,
+  int32_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_clamp_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -2214,6 +3306,45 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_convolution3d_ndhwc_f16(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_depth,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_depth,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_depth,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  const void* kernel,
+  const void* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_convolution3d_ndhwc_f16(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_deconvolution2d_nhwc_f16(
   uint32_t output_padding_top,
   uint32_t output_padding_right,
@@ -2249,6 +3380,36 @@ enum xnn_status xnn_setup_deconvolution2d_nhwc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_embedding_bag_nc_f16(
+  enum xnn_reduce_operator bag_operator,
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const void* table,
+  uint32_t flags,
+  xnn_operator_t* embedding_bag_op_out);
+
+enum xnn_status xnn_setup_embedding_bag_nc_f16(
+  xnn_operator_t embedding_bag_op,
+  size_t batch_size,
+  size_t bag_size,
+  const int32_t* indices,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_exp_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* exp_op_out);
+
+enum xnn_status xnn_setup_exp_nc_f16(
+  xnn_operator_t exp_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_fully_connected_nc_f16(
   size_t input_channels,
   size_t output_channels,
@@ -2269,6 +3430,20 @@ enum xnn_status xnn_setup_fully_connected_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_gelu_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* gelu_op_out);
+
+enum xnn_status xnn_setup_gelu_nc_f16(
+  xnn_operator_t gelu_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_global_average_pooling_nwc_f16(
   size_t channels,
   size_t input_stride,
@@ -2300,6 +3475,23 @@ enum xnn_status xnn_setup_hardswish_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_layer_normalization_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float epsilon,
+  const void* gamma,
+  const void* beta,
+  uint32_t flags,
+  xnn_operator_t* layer_normalization_op_out);
+
+enum xnn_status xnn_setup_layer_normalization_nc_f16(
+  xnn_operator_t layer_normalization_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_leaky_relu_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -2315,6 +3507,20 @@ enum xnn_status xnn_setup_leaky_relu_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_log_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* log_op_out);
+
+enum xnn_status xnn_setup_log_nc_f16(
+  xnn_operator_t log_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_max_pooling2d_nhwc_f16(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -2343,6 +3549,37 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_max_pooling3d_ndhwc_f16(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_depth,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_depth,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_operator_t* max_pooling_op_out);
+
+enum xnn_status xnn_setup_max_pooling3d_ndhwc_f16(
+  xnn_operator_t max_pooling_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_multiply_nd_f16(
   float output_min,
   float output_max,
@@ -2376,6 +3613,21 @@ enum xnn_status xnn_setup_prelu_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_reduce_nd_f16(
+  enum xnn_reduce_operator reduce_operator,
+  uint32_t flags,
+  xnn_operator_t* reduce_op_out);
+
+enum xnn_status xnn_setup_reduce_nd_f16(
+  xnn_operator_t reduce_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_resize_bilinear2d_nhwc_f16(
   size_t channels,
   size_t input_pixel_stride,
@@ -2394,24 +3646,94 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_f16(
   void* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_sigmoid_nc_f16(
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_f16(
   size_t channels,
-  size_t input_stride,
-  size_t output_stride,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
   uint32_t flags,
-  xnn_operator_t* sigmoid_op_out);
+  xnn_operator_t* resize_op_out);
 
-enum xnn_status xnn_setup_sigmoid_nc_f16(
-  xnn_operator_t sigmoid_op,
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_f16(
+  xnn_operator_t resize_op,
   size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
   const void* input,
   void* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_softmax_nc_f16(
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nhwc_f16(
   size_t channels,
-  size_t input_stride,
-  size_t output_stride,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nhwc_f16(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_scaled_dot_product_attention_nhtc_f16(
+  float scale,
+  uint32_t flags,
+  xnn_operator_t* attention_op_out);
+
+enum xnn_status xnn_setup_scaled_dot_product_attention_nhtc_f16(
+  xnn_operator_t attention_op,
+  size_t batch_size,
+  size_t heads,
+  size_t query_tokens,
+  size_t key_tokens,
+  size_t channels,
+  size_t value_channels,
+  const void* query,
+  const void* key,
+  const void* value,
+  const void* mask,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_sigmoid_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* sigmoid_op_out);
+
+enum xnn_status xnn_setup_sigmoid_nc_f16(
+  xnn_operator_t sigmoid_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_silu_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* silu_op_out);
+
+enum xnn_status xnn_setup_silu_nc_f16(
+  xnn_operator_t silu_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_softmax_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
   uint32_t flags,
   xnn_operator_t* softmax_op_out);
 
@@ -2422,6 +3744,44 @@ enum xnn_status xnn_setup_softmax_nc_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_streaming_convolution1d_nwc_f16(
+  uint32_t kernel_size,
+  uint32_t dilation,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  const void* kernel,
+  const void* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_streaming_convolution1d_nwc_f16(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_frames,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_tanh_nc_f16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* tanh_op_out);
+
+enum xnn_status xnn_setup_tanh_nc_f16(
+  xnn_operator_t tanh_op,
+  size_t batch_size,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_F16_OPERATORS
 
 #ifndef XNN_NO_X16_OPERATORS
@@ -2441,6 +3801,20 @@ enum xnn_status xnn_setup_constant_pad_nd_x16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_slice_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x16(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_copy_nc_x16(
   size_t channels,
   size_t input_stride,
@@ -2472,6 +3846,20 @@ enum xnn_status xnn_setup_depth_to_space_nhwc_x16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_embedding_lookup_nc_x16(
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const void* table,
+  uint32_t flags,
+  xnn_operator_t* embedding_lookup_op_out);
+
+enum xnn_status xnn_setup_embedding_lookup_nc_x16(
+  xnn_operator_t embedding_lookup_op,
+  size_t batch_size,
+  const int32_t* indices,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_transpose_nd_x16(
     uint32_t flags,
     xnn_operator_t* transpose_op_out);
@@ -2527,6 +3915,119 @@ enum xnn_status xnn_setup_convolution2d_nhwc_qc8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_fully_connected_nc_qc8(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  const float* kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qc8(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+/// Create a Fully Connected operator with FP32 input and output, and INT8 weights with per-channel scales.
+///
+/// Rows of the input are quantized to INT8 on the fly, with the scale and the zero point computed from the range of
+/// every row, and the products are accumulated in INT32 and converted back to FP32.
+///
+/// @param kernel_scale - per-output-channel scales of the kernel, an array of output_channels elements.
+/// @param bias - an optional FP32 bias with output_channels elements.
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  const float* kernel_scale,
+  const int8_t* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+/// Create a Fully Connected operator with QS8 input, FP32 output, and INT8 weights with per-channel scales.
+///
+/// The input is quantized with the static @a input_zero_point and @a input_scale, and the products are accumulated in
+/// INT32 and converted to FP32 as in xnn_create_fully_connected_nc_qd8_f32_qc8w.
+///
+/// @param kernel_scale - per-output-channel scales of the kernel, an array of output_channels elements.
+/// @param bias - an optional FP32 bias with output_channels elements.
+enum xnn_status xnn_create_fully_connected_nc_qs8_f32_qc8w(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  const float* kernel_scale,
+  const int8_t* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qs8_f32_qc8w(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const int8_t* input,
+  float* output,
+  pthreadpool_t threadpool);
+
+/// Create a Fully Connected operator with FP32 input and output, and 4-bit weights with per-channel scales.
+///
+/// Rows of the input are quantized to INT8 on the fly, as in xnn_create_fully_connected_nc_qd8_f32_qc8w, and the
+/// weights use the same layout as in xnn_create_fully_connected_nc_f32_qc4w.
+///
+/// @param kernel_zero_point - zero point of the 4-bit weights, in [0, 15] range.
+/// @param kernel_scale - per-output-channel scales of the kernel, an array of output_channels elements.
+/// @param bias - an optional FP32 bias with output_channels elements.
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc4w(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint8_t kernel_zero_point,
+  const float* kernel_scale,
+  const void* kernel,
+  const float* bias,
+  float output_min,
+  float output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc4w(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_QC8_OPERATORS
 
 #ifndef XNN_NO_QS8_OPERATORS
@@ -2554,6 +4055,49 @@ enum xnn_status xnn_setup_add_nd_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_argmax_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  uint32_t flags,
+  xnn_operator_t* argmax_op_out);
+
+enum xnn_status xnn_setup_argmax_nc_qs8(
+  xnn_operator_t argmax_op,
+  size_t batch_size,
+  const int8_t* input,
+  int32_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_average_pooling2d_nhwc_qs8(
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* average_pooling_op_out);
+
+enum xnn_status xnn_setup_average_pooling2d_nhwc_qs8(
+  xnn_operator_t average_pooling_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_convolution2d_nhwc_qs8(
   uint32_t input_padding_top,
   uint32_t input_padding_right,
@@ -2592,6 +4136,50 @@ enum xnn_status xnn_setup_convolution2d_nhwc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_convolution3d_ndhwc_qs8(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t kernel_depth,
+  uint32_t kernel_height,
+  uint32_t kernel_width,
+  uint32_t subsampling_depth,
+  uint32_t subsampling_height,
+  uint32_t subsampling_width,
+  uint32_t dilation_depth,
+  uint32_t dilation_height,
+  uint32_t dilation_width,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  float kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* convolution_op_out);
+
+enum xnn_status xnn_setup_convolution3d_ndhwc_qs8(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_deconvolution2d_nhwc_qs8(
   uint32_t output_padding_top,
   uint32_t output_padding_right,
@@ -2632,74 +4220,263 @@ enum xnn_status xnn_setup_deconvolution2d_nhwc_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_elu_nc_qs8(
-  size_t channels,
-  size_t input_stride,
-  size_t output_stride,
-  float alpha,
+enum xnn_status xnn_create_divide_nd_qs8(
+  int8_t input1_zero_point,
+  float input1_scale,
+  int8_t input2_zero_point,
+  float input2_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* divide_op_out);
+
+enum xnn_status xnn_setup_divide_nd_qs8(
+  xnn_operator_t divide_op,
+  size_t num_input1_dims,
+  const size_t* input1_shape,
+  size_t num_input2_dims,
+  const size_t* input2_shape,
+  const int8_t* input1,
+  const int8_t* input2,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_elu_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float alpha,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* elu_op_out);
+
+enum xnn_status xnn_setup_elu_nc_qs8(
+  xnn_operator_t elu_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_fully_connected_nc_qs8(
+  size_t input_channels,
+  size_t output_channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  float kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_caches_t caches,
+  xnn_operator_t* fully_connected_op_out);
+
+enum xnn_status xnn_setup_fully_connected_nc_qs8(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_global_average_pooling_nwc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* global_average_pooling_op_out);
+
+enum xnn_status xnn_setup_global_average_pooling_nwc_qs8(
+  xnn_operator_t global_average_pooling_op,
+  size_t batch_size,
+  size_t width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_hardswish_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* hardswish_op_out);
+
+enum xnn_status xnn_setup_hardswish_nc_qs8(
+  xnn_operator_t hardswish_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_leaky_relu_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float negative_slope,
+  int8_t input_zero_point,
+  float input_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* leaky_relu_op_out);
+
+enum xnn_status xnn_setup_leaky_relu_nc_qs8(
+  xnn_operator_t leaky_relu_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_maximum_nd_qs8(
+  int8_t input1_zero_point,
+  float input1_scale,
+  int8_t input2_zero_point,
+  float input2_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* maximum_op_out);
+
+enum xnn_status xnn_setup_maximum_nd_qs8(
+  xnn_operator_t maximum_op,
+  size_t num_input1_dims,
+  const size_t* input1_shape,
+  size_t num_input2_dims,
+  const size_t* input2_shape,
+  const int8_t* input1,
+  const int8_t* input2,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_minimum_nd_qs8(
+  int8_t input1_zero_point,
+  float input1_scale,
+  int8_t input2_zero_point,
+  float input2_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* minimum_op_out);
+
+enum xnn_status xnn_setup_minimum_nd_qs8(
+  xnn_operator_t minimum_op,
+  size_t num_input1_dims,
+  const size_t* input1_shape,
+  size_t num_input2_dims,
+  const size_t* input2_shape,
+  const int8_t* input1,
+  const int8_t* input2,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_multiply_nd_qs8(
+  int8_t input1_zero_point,
+  float input1_scale,
+  int8_t input2_zero_point,
+  float input2_scale,
+  int8_t output_zero_point,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* multiply_op_out);
+
+enum xnn_status xnn_setup_multiply_nd_qs8(
+  xnn_operator_t multiply_op,
+  size_t num_input1_dims,
+  const size_t* input1_shape,
+  size_t num_input2_dims,
+  const size_t* input2_shape,
+  const int8_t* input1,
+  const int8_t* input2,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_reduce_nd_qs8(
+  enum xnn_reduce_operator reduce_operator,
   int8_t input_zero_point,
   float input_scale,
   int8_t output_zero_point,
   float output_scale,
-  int8_t output_min,
-  int8_t output_max,
   uint32_t flags,
-  xnn_operator_t* elu_op_out);
+  xnn_operator_t* reduce_op_out);
 
-enum xnn_status xnn_setup_elu_nc_qs8(
-  xnn_operator_t elu_op,
-  size_t batch_size,
+enum xnn_status xnn_setup_reduce_nd_qs8(
+  xnn_operator_t reduce_op,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  size_t num_input_dims,
+  const size_t* input_shape,
   const int8_t* input,
   int8_t* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_fully_connected_nc_qs8(
-  size_t input_channels,
-  size_t output_channels,
+enum xnn_status xnn_create_sigmoid_nc_qs8(
+  size_t channels,
   size_t input_stride,
   size_t output_stride,
   int8_t input_zero_point,
   float input_scale,
-  float kernel_scale,
-  const int8_t* kernel,
-  const int32_t* bias,
   int8_t output_zero_point,
   float output_scale,
   int8_t output_min,
   int8_t output_max,
   uint32_t flags,
-  xnn_caches_t caches,
-  xnn_operator_t* fully_connected_op_out);
+  xnn_operator_t* sigmoid_op_out);
 
-enum xnn_status xnn_setup_fully_connected_nc_qs8(
-  xnn_operator_t fully_connected_op,
+enum xnn_status xnn_setup_sigmoid_nc_qs8(
+  xnn_operator_t sigmoid_op,
   size_t batch_size,
   const int8_t* input,
   int8_t* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_global_average_pooling_nwc_qs8(
+enum xnn_status xnn_create_softmax_nc_qs8(
   size_t channels,
   size_t input_stride,
   size_t output_stride,
-  int8_t input_zero_point,
   float input_scale,
   int8_t output_zero_point,
   float output_scale,
-  int8_t output_min,
-  int8_t output_max,
   uint32_t flags,
-  xnn_operator_t* global_average_pooling_op_out);
+  xnn_operator_t* softmax_op_out);
 
-enum xnn_status xnn_setup_global_average_pooling_nwc_qs8(
-  xnn_operator_t global_average_pooling_op,
+enum xnn_status xnn_setup_softmax_nc_qs8(
+  xnn_operator_t softmax_op,
   size_t batch_size,
-  size_t width,
   const int8_t* input,
   int8_t* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_multiply_nd_qs8(
+enum xnn_status xnn_create_squared_difference_nd_qs8(
   int8_t input1_zero_point,
   float input1_scale,
   int8_t input2_zero_point,
@@ -2709,10 +4486,10 @@ enum xnn_status xnn_create_multiply_nd_qs8(
   int8_t output_min,
   int8_t output_max,
   uint32_t flags,
-  xnn_operator_t* multiply_op_out);
+  xnn_operator_t* squared_difference_op_out);
 
-enum xnn_status xnn_setup_multiply_nd_qs8(
-  xnn_operator_t multiply_op,
+enum xnn_status xnn_setup_squared_difference_nd_qs8(
+  xnn_operator_t squared_difference_op,
   size_t num_input1_dims,
   const size_t* input1_shape,
   size_t num_input2_dims,
@@ -2722,22 +4499,31 @@ enum xnn_status xnn_setup_multiply_nd_qs8(
   int8_t* output,
   pthreadpool_t threadpool);
 
-enum xnn_status xnn_create_sigmoid_nc_qs8(
-  size_t channels,
-  size_t input_stride,
-  size_t output_stride,
+enum xnn_status xnn_create_streaming_convolution1d_nwc_qs8(
+  uint32_t kernel_size,
+  uint32_t dilation,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  size_t input_channel_stride,
+  size_t output_channel_stride,
   int8_t input_zero_point,
   float input_scale,
+  float kernel_scale,
+  const int8_t* kernel,
+  const int32_t* bias,
   int8_t output_zero_point,
   float output_scale,
   int8_t output_min,
   int8_t output_max,
   uint32_t flags,
-  xnn_operator_t* sigmoid_op_out);
+  xnn_caches_t caches,
+  xnn_operator_t* convolution_op_out);
 
-enum xnn_status xnn_setup_sigmoid_nc_qs8(
-  xnn_operator_t sigmoid_op,
+enum xnn_status xnn_setup_streaming_convolution1d_nwc_qs8(
+  xnn_operator_t convolution_op,
   size_t batch_size,
+  size_t input_frames,
   const int8_t* input,
   int8_t* output,
   pthreadpool_t threadpool);
@@ -3141,6 +4927,37 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_s8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_max_pooling3d_ndhwc_s8(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_depth,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_depth,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  int8_t output_min,
+  int8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* max_pooling_op_out);
+
+enum xnn_status xnn_setup_max_pooling3d_ndhwc_s8(
+  xnn_operator_t max_pooling_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_resize_bilinear2d_nhwc_s8(
   size_t channels,
   size_t input_pixel_stride,
@@ -3159,6 +4976,42 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_s8(
   int8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_s8(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_s8(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nhwc_s8(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nhwc_s8(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_S8_OPERATORS
 
 #ifndef XNN_NO_U8_OPERATORS
@@ -3207,6 +5060,37 @@ enum xnn_status xnn_setup_max_pooling2d_nhwc_u8(
   uint8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_max_pooling3d_ndhwc_u8(
+  uint32_t input_padding_front,
+  uint32_t input_padding_back,
+  uint32_t input_padding_top,
+  uint32_t input_padding_right,
+  uint32_t input_padding_bottom,
+  uint32_t input_padding_left,
+  uint32_t pooling_depth,
+  uint32_t pooling_height,
+  uint32_t pooling_width,
+  uint32_t stride_depth,
+  uint32_t stride_height,
+  uint32_t stride_width,
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint8_t output_min,
+  uint8_t output_max,
+  uint32_t flags,
+  xnn_operator_t* max_pooling_op_out);
+
+enum xnn_status xnn_setup_max_pooling3d_ndhwc_u8(
+  xnn_operator_t max_pooling_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const uint8_t* input,
+  uint8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_resize_bilinear2d_nhwc_u8(
   size_t channels,
   size_t input_pixel_stride,
@@ -3225,6 +5109,42 @@ enum xnn_status xnn_setup_resize_bilinear2d_nhwc_u8(
   uint8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_u8(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_u8(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const uint8_t* input,
+  uint8_t* output,
+  pthreadpool_t threadpool);
+
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nhwc_u8(
+  size_t channels,
+  size_t input_pixel_stride,
+  size_t output_pixel_stride,
+  uint32_t flags,
+  xnn_operator_t* resize_op_out);
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nhwc_u8(
+  xnn_operator_t resize_op,
+  size_t batch_size,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  const uint8_t* input,
+  uint8_t* output,
+  pthreadpool_t threadpool);
+
 #endif  // XNN_NO_U8_OPERATORS
 
 #ifndef XNN_NO_X8_OPERATORS
@@ -3273,6 +5193,20 @@ enum xnn_status xnn_setup_constant_pad_nd_x8(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_slice_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out);
+
+enum xnn_status xnn_setup_slice_nd_x8(
+  xnn_operator_t slice_op,
+  size_t num_dims,
+  const size_t* input_shape,
+  const size_t* offsets,
+  const size_t* sizes,
+  const void* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_depth_to_space_nhwc_x8(
   size_t output_channels,
   size_t input_channel_stride,
@@ -3290,6 +5224,20 @@ enum xnn_status xnn_setup_depth_to_space_nhwc_x8(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_embedding_lookup_nc_x8(
+  size_t num_embeddings,
+  size_t embedding_dim,
+  const void* table,
+  uint32_t flags,
+  xnn_operator_t* embedding_lookup_op_out);
+
+enum xnn_status xnn_setup_embedding_lookup_nc_x8(
+  xnn_operator_t embedding_lookup_op,
+  size_t batch_size,
+  const int32_t* indices,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_transpose_nd_x8(
     uint32_t flags,
     xnn_operator_t* transpose_op_out);
@@ -3307,6 +5255,20 @@ enum xnn_status xnn_setup_transpose_nd_x8(
 
 #ifndef XNN_NO_CVT_OPERATORS
 
+enum xnn_status xnn_create_convert_nc_bf16_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_bf16_f32(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const void* input,
+  float* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_convert_nc_f16_f32(
   size_t channels,
   size_t input_stride,
@@ -3335,6 +5297,20 @@ enum xnn_status xnn_setup_convert_nc_f32_f16(
   void* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_convert_nc_f32_bf16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_f32_bf16(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const float* input,
+  void* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_convert_nc_f32_qs8(
   size_t channels,
   size_t input_stride,
@@ -3371,6 +5347,24 @@ enum xnn_status xnn_setup_convert_nc_f32_qu8(
   uint8_t* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_convert_nc_qs8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float input_scale,
+  int8_t input_zero_point,
+  float output_scale,
+  int8_t output_zero_point,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_qs8(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_convert_nc_qs8_f32(
   size_t channels,
   size_t input_stride,
@@ -3387,6 +5381,24 @@ enum xnn_status xnn_setup_convert_nc_qs8_f32(
   float* output,
   pthreadpool_t threadpool);
 
+enum xnn_status xnn_create_convert_nc_qu8(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  float input_scale,
+  uint8_t input_zero_point,
+  float output_scale,
+  uint8_t output_zero_point,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out);
+
+enum xnn_status xnn_setup_convert_nc_qu8(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const uint8_t* input,
+  uint8_t* output,
+  pthreadpool_t threadpool);
+
 enum xnn_status xnn_create_convert_nc_qu8_f32(
   size_t channels,
   size_t input_stride,
@@ -0,0 +1,22 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################# x86 128-bit #################################
+tools/xngen src/bf16-f32-vcvt/sse2.c.in -D BATCH_TILE=8  -o src/bf16-f32-vcvt/gen/vcvt-sse2-x8.c &
+tools/xngen src/bf16-f32-vcvt/sse2.c.in -D BATCH_TILE=16 -o src/bf16-f32-vcvt/gen/vcvt-sse2-x16.c &
+
+################################# x86 256-bit #################################
+tools/xngen src/bf16-f32-vcvt/avx2.c.in -D BATCH_TILE=8  -o src/bf16-f32-vcvt/gen/vcvt-avx2-x8.c &
+tools/xngen src/bf16-f32-vcvt/avx2.c.in -D BATCH_TILE=16 -o src/bf16-f32-vcvt/gen/vcvt-avx2-x16.c &
+
+#################################### Scalar ###################################
+tools/xngen src/bf16-f32-vcvt/scalar.c.in -D BATCH_TILE=1 -o src/bf16-f32-vcvt/gen/vcvt-scalar-x1.c &
+tools/xngen src/bf16-f32-vcvt/scalar.c.in -D BATCH_TILE=4 -o src/bf16-f32-vcvt/gen/vcvt-scalar-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vcvt-test.py --spec test/bf16-f32-vcvt.yaml --output test/bf16-f32-vcvt.cc &
+
+wait
@@ -0,0 +1,18 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 AVX2 ##################################
+tools/xngen src/bf16-gemm/avx2-broadcast.c.in -D MR=1 -D NR=16 -o src/bf16-gemm/gen/1x16-minmax-avx2-broadcast.c &
+tools/xngen src/bf16-gemm/avx2-broadcast.c.in -D MR=4 -D NR=16 -o src/bf16-gemm/gen/4x16-minmax-avx2-broadcast.c &
+
+#################################### Scalar ###################################
+tools/xngen src/bf16-gemm/scalar.c.in -D MR=1 -D NR=4 -o src/bf16-gemm/gen/1x4-minmax-scalar.c &
+tools/xngen src/bf16-gemm/scalar.c.in -D MR=4 -D NR=4 -o src/bf16-gemm/gen/4x4-minmax-scalar.c &
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/bf16-gemm-minmax.yaml --output test/bf16-gemm-minmax.cc &
+
+wait
@@ -0,0 +1,13 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f16-gemv/avx2-broadcast.c.in -D NR=16 -D ACCUMULATORS=4 -D PREFETCH=512 -o src/f16-gemv/gen/1x16-minmax-avx2-broadcast-acc4-prfm.c &
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/f16-gemv-minmax.yaml --output test/f16-gemv-minmax.cc &
+
+wait
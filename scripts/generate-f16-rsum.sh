@@ -0,0 +1,32 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## ARM NEON ###################################
+tools/xngen src/f16-rsum/neonfp16.c.in -D BATCH_TILE=8  -D ACCUMULATORS=1 -o src/f16-rsum/gen/neonfp16-x8.c &
+tools/xngen src/f16-rsum/neonfp16.c.in -D BATCH_TILE=16 -D ACCUMULATORS=2 -o src/f16-rsum/gen/neonfp16-x16-acc2.c &
+tools/xngen src/f16-rsum/neonfp16.c.in -D BATCH_TILE=32 -D ACCUMULATORS=4 -o src/f16-rsum/gen/neonfp16-x32-acc4.c &
+
+################################## x86 F16C ###################################
+tools/xngen src/f16-rsum/f16c.c.in -D BATCH_TILE=8  -D ACCUMULATORS=1 -o src/f16-rsum/gen/f16c-x8.c &
+tools/xngen src/f16-rsum/f16c.c.in -D BATCH_TILE=16 -D ACCUMULATORS=2 -o src/f16-rsum/gen/f16c-x16-acc2.c &
+tools/xngen src/f16-rsum/f16c.c.in -D BATCH_TILE=32 -D ACCUMULATORS=4 -o src/f16-rsum/gen/f16c-x32-acc4.c &
+
+################################# x86 AVX512 ##################################
+tools/xngen src/f16-rsum/avx512skx.c.in -D BATCH_TILE=16 -D ACCUMULATORS=1 -o src/f16-rsum/gen/avx512skx-x16.c &
+tools/xngen src/f16-rsum/avx512skx.c.in -D BATCH_TILE=32 -D ACCUMULATORS=2 -o src/f16-rsum/gen/avx512skx-x32-acc2.c &
+tools/xngen src/f16-rsum/avx512skx.c.in -D BATCH_TILE=64 -D ACCUMULATORS=4 -o src/f16-rsum/gen/avx512skx-x64-acc4.c &
+
+################################### Scalar ####################################
+tools/xngen src/f16-rsum/scalar.c.in -D BATCH_TILE=1  -D ACCUMULATORS=1 -o src/f16-rsum/gen/scalar-x1.c &
+tools/xngen src/f16-rsum/scalar.c.in -D BATCH_TILE=2  -D ACCUMULATORS=2 -o src/f16-rsum/gen/scalar-x2-acc2.c &
+tools/xngen src/f16-rsum/scalar.c.in -D BATCH_TILE=4  -D ACCUMULATORS=4 -o src/f16-rsum/gen/scalar-x4-acc4.c &
+
+wait
+
+################################## Unit tests #################################
+tools/generate-reduce-test.py --spec test/f16-rsum.yaml --output test/f16-rsum.cc &
+
+wait
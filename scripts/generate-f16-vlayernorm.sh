@@ -0,0 +1,20 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################ ARM NEONFP16 #################################
+tools/xngen src/f16-vlayernorm/neonfp16.c.in -D BATCH_TILE=8  -o src/f16-vlayernorm/gen/neonfp16-x8.c &
+tools/xngen src/f16-vlayernorm/neonfp16.c.in -D BATCH_TILE=16 -o src/f16-vlayernorm/gen/neonfp16-x16.c &
+
+################################### x86 F16C ##################################
+tools/xngen src/f16-vlayernorm/f16c.c.in -D BATCH_TILE=8  -o src/f16-vlayernorm/gen/f16c-x8.c &
+tools/xngen src/f16-vlayernorm/f16c.c.in -D BATCH_TILE=16 -o src/f16-vlayernorm/gen/f16c-x16.c &
+
+wait
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f16-vlayernorm.yaml --output test/f16-vlayernorm.cc &
+
+wait
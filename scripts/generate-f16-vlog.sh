@@ -0,0 +1,14 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f16-vlog/avx2.c.in -D BATCH_TILE=8  -o src/f16-vlog/gen/vlog-avx2-p4-div-x8.c &
+tools/xngen src/f16-vlog/avx2.c.in -D BATCH_TILE=16 -o src/f16-vlog/gen/vlog-avx2-p4-div-x16.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f16-vlog.yaml --output test/f16-vlog.cc &
+
+wait
@@ -0,0 +1,14 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f16-vsilu/avx2.c.in -D BATCH_TILE=8  -D DIV_ALGO=div -o src/f16-vsilu/gen/vsilu-avx2-rr1-p5-div-x8.c &
+tools/xngen src/f16-vsilu/avx2.c.in -D BATCH_TILE=16 -D DIV_ALGO=div -o src/f16-vsilu/gen/vsilu-avx2-rr1-p5-div-x16.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f16-vsilu.yaml --output test/f16-vsilu.cc &
+
+wait
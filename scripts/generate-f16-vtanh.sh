@@ -0,0 +1,14 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f16-vtanh/avx2.c.in -D BATCH_TILE=8  -o src/f16-vtanh/gen/vtanh-avx2-expm1minus-rr1-p6-div-x8.c &
+tools/xngen src/f16-vtanh/avx2.c.in -D BATCH_TILE=16 -o src/f16-vtanh/gen/vtanh-avx2-expm1minus-rr1-p6-div-x16.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f16-vtanh.yaml --output test/f16-vtanh.cc &
+
+wait
@@ -0,0 +1,14 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 FMA3 ##################################
+tools/xngen src/f32-f16w-igemm/fma3-broadcast.c.in -D MR=1 -D NR=16 -o src/f32-f16w-igemm/gen/1x16-minmax-fma3-broadcast.c &
+tools/xngen src/f32-f16w-igemm/fma3-broadcast.c.in -D MR=5 -D NR=16 -o src/f32-f16w-igemm/gen/5x16-minmax-fma3-broadcast.c &
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/f32-f16w-igemm-minmax.yaml --output test/f32-f16w-igemm-minmax.cc &
+
+wait
@@ -0,0 +1,20 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-gemv/sse-load1.c.in -D NR=8 -D ACCUMULATORS=4 -D PREFETCH=1024 -o src/f32-gemv/gen/1x8-minmax-sse-load1-acc4-prfm.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-gemv/avx-broadcast.c.in -D NR=16 -D FMA=0 -D ACCUMULATORS=4 -D PREFETCH=1024 -o src/f32-gemv/gen/1x16-minmax-avx-broadcast-acc4-prfm.c &
+tools/xngen src/f32-gemv/avx-broadcast.c.in -D NR=16 -D FMA=3 -D ACCUMULATORS=4 -D PREFETCH=1024 -o src/f32-gemv/gen/1x16-minmax-fma3-broadcast-acc4-prfm.c &
+
+################################# x86 AVX512F #################################
+tools/xngen src/f32-gemv/avx512-broadcast.c.in -D NR=16 -D ACCUMULATORS=4 -D PREFETCH=1024 -o src/f32-gemv/gen/1x16-minmax-avx512f-broadcast-acc4-prfm.c &
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/f32-gemv-minmax.yaml --output test/f32-gemv-minmax.cc &
+
+wait
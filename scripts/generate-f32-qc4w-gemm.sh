@@ -0,0 +1,27 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-qc4w-gemm/neon-ld64.c.in -D MR=1 -D NR=8 -D FMA=0 -o src/f32-qc4w-gemm/gen/1x8-minmax-neon-lane-ld64.c &
+tools/xngen src/f32-qc4w-gemm/neon-ld64.c.in -D MR=4 -D NR=8 -D FMA=0 -o src/f32-qc4w-gemm/gen/4x8-minmax-neon-lane-ld64.c &
+
+tools/xngen src/f32-qc4w-gemm/neon-ld64.c.in -D MR=1 -D NR=8 -D FMA=1 -o src/f32-qc4w-gemm/gen/1x8-minmax-neonfma-lane-ld64.c &
+tools/xngen src/f32-qc4w-gemm/neon-ld64.c.in -D MR=4 -D NR=8 -D FMA=1 -o src/f32-qc4w-gemm/gen/4x8-minmax-neonfma-lane-ld64.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f32-qc4w-gemm/avx2-broadcast.c.in -D MR=1 -D NR=16 -o src/f32-qc4w-gemm/gen/1x16-minmax-avx2-broadcast.c &
+tools/xngen src/f32-qc4w-gemm/avx2-broadcast.c.in -D MR=3 -D NR=16 -o src/f32-qc4w-gemm/gen/3x16-minmax-avx2-broadcast.c &
+tools/xngen src/f32-qc4w-gemm/avx2-broadcast.c.in -D MR=4 -D NR=16 -o src/f32-qc4w-gemm/gen/4x16-minmax-avx2-broadcast.c &
+
+#################################### Scalar ###################################
+tools/xngen src/f32-qc4w-gemm/scalar.c.in -D MR=1 -D NR=4 -o src/f32-qc4w-gemm/gen/1x4-minmax-scalar.c &
+tools/xngen src/f32-qc4w-gemm/scalar.c.in -D MR=2 -D NR=4 -o src/f32-qc4w-gemm/gen/2x4-minmax-scalar.c &
+tools/xngen src/f32-qc4w-gemm/scalar.c.in -D MR=4 -D NR=4 -o src/f32-qc4w-gemm/gen/4x4-minmax-scalar.c &
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/f32-qc4w-gemm-minmax.yaml --output test/f32-qc4w-gemm-minmax.cc &
+
+wait
@@ -0,0 +1,28 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-rmoments/neon.c.in -D BATCH_TILE=8  -o src/f32-rmoments/gen/neon-x8.c &
+tools/xngen src/f32-rmoments/neon.c.in -D BATCH_TILE=16 -o src/f32-rmoments/gen/neon-x16.c &
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-rmoments/sse.c.in -D BATCH_TILE=8  -o src/f32-rmoments/gen/sse-x8.c &
+tools/xngen src/f32-rmoments/sse.c.in -D BATCH_TILE=16 -o src/f32-rmoments/gen/sse-x16.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-rmoments/avx.c.in -D BATCH_TILE=16 -o src/f32-rmoments/gen/avx-x16.c &
+tools/xngen src/f32-rmoments/avx.c.in -D BATCH_TILE=32 -o src/f32-rmoments/gen/avx-x32.c &
+
+################################### Scalar ####################################
+tools/xngen src/f32-rmoments/scalar.c.in -D BATCH_TILE=1 -o src/f32-rmoments/gen/scalar-x1.c &
+tools/xngen src/f32-rmoments/scalar.c.in -D BATCH_TILE=4 -o src/f32-rmoments/gen/scalar-x4.c &
+
+wait
+
+################################## Unit tests #################################
+tools/generate-reduce-test.py --spec test/f32-rmoments.yaml --output test/f32-rmoments.cc &
+
+wait
@@ -0,0 +1,37 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-rsum/neon.c.in -D BATCH_TILE=4  -D ACCUMULATORS=1 -o src/f32-rsum/gen/neon-x4.c &
+tools/xngen src/f32-rsum/neon.c.in -D BATCH_TILE=8  -D ACCUMULATORS=2 -o src/f32-rsum/gen/neon-x8-acc2.c &
+tools/xngen src/f32-rsum/neon.c.in -D BATCH_TILE=16 -D ACCUMULATORS=4 -o src/f32-rsum/gen/neon-x16-acc4.c &
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-rsum/sse.c.in -D BATCH_TILE=4  -D ACCUMULATORS=1 -o src/f32-rsum/gen/sse-x4.c &
+tools/xngen src/f32-rsum/sse.c.in -D BATCH_TILE=8  -D ACCUMULATORS=2 -o src/f32-rsum/gen/sse-x8-acc2.c &
+tools/xngen src/f32-rsum/sse.c.in -D BATCH_TILE=16 -D ACCUMULATORS=4 -o src/f32-rsum/gen/sse-x16-acc4.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-rsum/avx.c.in -D BATCH_TILE=8  -D ACCUMULATORS=1 -o src/f32-rsum/gen/avx-x8.c &
+tools/xngen src/f32-rsum/avx.c.in -D BATCH_TILE=16 -D ACCUMULATORS=2 -o src/f32-rsum/gen/avx-x16-acc2.c &
+tools/xngen src/f32-rsum/avx.c.in -D BATCH_TILE=32 -D ACCUMULATORS=4 -o src/f32-rsum/gen/avx-x32-acc4.c &
+
+################################# x86 AVX512 ##################################
+tools/xngen src/f32-rsum/avx512f.c.in -D BATCH_TILE=16 -D ACCUMULATORS=1 -o src/f32-rsum/gen/avx512f-x16.c &
+tools/xngen src/f32-rsum/avx512f.c.in -D BATCH_TILE=32 -D ACCUMULATORS=2 -o src/f32-rsum/gen/avx512f-x32-acc2.c &
+tools/xngen src/f32-rsum/avx512f.c.in -D BATCH_TILE=64 -D ACCUMULATORS=4 -o src/f32-rsum/gen/avx512f-x64-acc4.c &
+
+################################### Scalar ####################################
+tools/xngen src/f32-rsum/scalar.c.in -D BATCH_TILE=1  -D ACCUMULATORS=1 -o src/f32-rsum/gen/scalar-x1.c &
+tools/xngen src/f32-rsum/scalar.c.in -D BATCH_TILE=2  -D ACCUMULATORS=2 -o src/f32-rsum/gen/scalar-x2-acc2.c &
+tools/xngen src/f32-rsum/scalar.c.in -D BATCH_TILE=4  -D ACCUMULATORS=4 -o src/f32-rsum/gen/scalar-x4-acc4.c &
+
+wait
+
+################################## Unit tests #################################
+tools/generate-reduce-test.py --spec test/f32-rsum.yaml --output test/f32-rsum.cc &
+
+wait
@@ -0,0 +1,30 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-vexp/neon-rr2-p5.c.in -D BATCH_TILE=4  -D FMA=1 -o src/f32-vexp/gen/vexp-neonfma-rr2-p5-x4.c &
+tools/xngen src/f32-vexp/neon-rr2-p5.c.in -D BATCH_TILE=8  -D FMA=1 -o src/f32-vexp/gen/vexp-neonfma-rr2-p5-x8.c &
+
+tools/xngen src/f32-vexp/neon-rr2-p5.c.in -D BATCH_TILE=4  -D FMA=0 -o src/f32-vexp/gen/vexp-neon-rr2-p5-x4.c &
+tools/xngen src/f32-vexp/neon-rr2-p5.c.in -D BATCH_TILE=8  -D FMA=0 -o src/f32-vexp/gen/vexp-neon-rr2-p5-x8.c &
+
+################################### x86 SSE2 ##################################
+tools/xngen src/f32-vexp/sse2-rr2-p5.c.in -D BATCH_TILE=4  -o src/f32-vexp/gen/vexp-sse2-rr2-p5-x4.c &
+tools/xngen src/f32-vexp/sse2-rr2-p5.c.in -D BATCH_TILE=8  -o src/f32-vexp/gen/vexp-sse2-rr2-p5-x8.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f32-vexp/avx2-rr2-p5.c.in -D BATCH_TILE=8  -o src/f32-vexp/gen/vexp-avx2-rr2-p5-x8.c &
+tools/xngen src/f32-vexp/avx2-rr2-p5.c.in -D BATCH_TILE=16 -o src/f32-vexp/gen/vexp-avx2-rr2-p5-x16.c &
+
+#################################### Scalar ###################################
+tools/xngen src/f32-vexp/scalar-rr2-p5.c.in -D BATCH_TILE=1  -o src/f32-vexp/gen/vexp-scalar-rr2-p5-x1.c &
+tools/xngen src/f32-vexp/scalar-rr2-p5.c.in -D BATCH_TILE=2  -o src/f32-vexp/gen/vexp-scalar-rr2-p5-x2.c &
+tools/xngen src/f32-vexp/scalar-rr2-p5.c.in -D BATCH_TILE=4  -o src/f32-vexp/gen/vexp-scalar-rr2-p5-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vexp.yaml --output test/f32-vexp.cc &
+
+wait
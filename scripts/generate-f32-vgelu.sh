@@ -0,0 +1,36 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-vgelu/neon-p5.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-neonfma-rr1-p5-div-x4.c &
+tools/xngen src/f32-vgelu/neon-p5.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-neonfma-rr1-p5-div-x8.c &
+
+tools/xngen src/f32-vgelu/neon-p5.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neonfma-rr1-p5-nr2recps-x4.c &
+tools/xngen src/f32-vgelu/neon-p5.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neonfma-rr1-p5-nr2recps-x8.c &
+
+tools/xngen src/f32-vgelu/neon-p5.c.in -D BATCH_TILE=4  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neon-rr2-p5-nr2recps-x4.c &
+tools/xngen src/f32-vgelu/neon-p5.c.in -D BATCH_TILE=8  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vgelu/gen/vgelu-neon-rr2-p5-nr2recps-x8.c &
+
+################################### x86 SSE2 ##################################
+tools/xngen src/f32-vgelu/sse2-rr2-p5-div.c.in -D BATCH_TILE=4  -o src/f32-vgelu/gen/vgelu-sse2-rr2-p5-div-x4.c &
+tools/xngen src/f32-vgelu/sse2-rr2-p5-div.c.in -D BATCH_TILE=8  -o src/f32-vgelu/gen/vgelu-sse2-rr2-p5-div-x8.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f32-vgelu/avx2-rr1-p5.c.in -D BATCH_TILE=8  -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-avx2-rr1-p5-div-x8.c &
+tools/xngen src/f32-vgelu/avx2-rr1-p5.c.in -D BATCH_TILE=16 -D DIV_ALGO=div -o src/f32-vgelu/gen/vgelu-avx2-rr1-p5-div-x16.c &
+
+tools/xngen src/f32-vgelu/avx2-rr1-p5.c.in -D BATCH_TILE=8  -D DIV_ALGO=nr1fma -o src/f32-vgelu/gen/vgelu-avx2-rr1-p5-nr1fma-x8.c &
+tools/xngen src/f32-vgelu/avx2-rr1-p5.c.in -D BATCH_TILE=16 -D DIV_ALGO=nr1fma -o src/f32-vgelu/gen/vgelu-avx2-rr1-p5-nr1fma-x16.c &
+
+#################################### Scalar ###################################
+tools/xngen src/f32-vgelu/scalar-rr2-p5-div.c.in -D BATCH_TILE=1  -o src/f32-vgelu/gen/vgelu-scalar-rr2-p5-div-x1.c &
+tools/xngen src/f32-vgelu/scalar-rr2-p5-div.c.in -D BATCH_TILE=2  -o src/f32-vgelu/gen/vgelu-scalar-rr2-p5-div-x2.c &
+tools/xngen src/f32-vgelu/scalar-rr2-p5-div.c.in -D BATCH_TILE=4  -o src/f32-vgelu/gen/vgelu-scalar-rr2-p5-div-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vgelu.yaml --output test/f32-vgelu.cc &
+
+wait
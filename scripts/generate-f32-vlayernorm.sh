@@ -0,0 +1,28 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## ARM NEON ###################################
+tools/xngen src/f32-vlayernorm/neon.c.in -D BATCH_TILE=4 -o src/f32-vlayernorm/gen/neon-x4.c &
+tools/xngen src/f32-vlayernorm/neon.c.in -D BATCH_TILE=8 -o src/f32-vlayernorm/gen/neon-x8.c &
+
+################################### x86 SSE ###################################
+tools/xngen src/f32-vlayernorm/sse.c.in -D BATCH_TILE=4 -o src/f32-vlayernorm/gen/sse-x4.c &
+tools/xngen src/f32-vlayernorm/sse.c.in -D BATCH_TILE=8 -o src/f32-vlayernorm/gen/sse-x8.c &
+
+################################### x86 AVX ###################################
+tools/xngen src/f32-vlayernorm/avx.c.in -D BATCH_TILE=8  -o src/f32-vlayernorm/gen/avx-x8.c &
+tools/xngen src/f32-vlayernorm/avx.c.in -D BATCH_TILE=16 -o src/f32-vlayernorm/gen/avx-x16.c &
+
+################################### Scalar ####################################
+tools/xngen src/f32-vlayernorm/scalar.c.in -D BATCH_TILE=1 -o src/f32-vlayernorm/gen/scalar-x1.c &
+tools/xngen src/f32-vlayernorm/scalar.c.in -D BATCH_TILE=4 -o src/f32-vlayernorm/gen/scalar-x4.c &
+
+wait
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vlayernorm.yaml --output test/f32-vlayernorm.cc &
+
+wait
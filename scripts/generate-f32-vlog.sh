@@ -0,0 +1,33 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### ARM NEON ##################################
+tools/xngen src/f32-vlog/neon-p4.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=div -o src/f32-vlog/gen/vlog-neonfma-p4-div-x4.c &
+tools/xngen src/f32-vlog/neon-p4.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=div -o src/f32-vlog/gen/vlog-neonfma-p4-div-x8.c &
+
+tools/xngen src/f32-vlog/neon-p4.c.in -D BATCH_TILE=4  -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vlog/gen/vlog-neonfma-p4-nr2recps-x4.c &
+tools/xngen src/f32-vlog/neon-p4.c.in -D BATCH_TILE=8  -D FMA=1 -D DIV_ALGO=nr2recps -o src/f32-vlog/gen/vlog-neonfma-p4-nr2recps-x8.c &
+
+tools/xngen src/f32-vlog/neon-p4.c.in -D BATCH_TILE=4  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vlog/gen/vlog-neon-p4-nr2recps-x4.c &
+tools/xngen src/f32-vlog/neon-p4.c.in -D BATCH_TILE=8  -D FMA=0 -D DIV_ALGO=nr2recps -o src/f32-vlog/gen/vlog-neon-p4-nr2recps-x8.c &
+
+################################### x86 SSE2 ##################################
+tools/xngen src/f32-vlog/sse2-p4-div.c.in -D BATCH_TILE=4  -o src/f32-vlog/gen/vlog-sse2-p4-div-x4.c &
+tools/xngen src/f32-vlog/sse2-p4-div.c.in -D BATCH_TILE=8  -o src/f32-vlog/gen/vlog-sse2-p4-div-x8.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/f32-vlog/avx2-p4-div.c.in -D BATCH_TILE=8  -o src/f32-vlog/gen/vlog-avx2-p4-div-x8.c &
+tools/xngen src/f32-vlog/avx2-p4-div.c.in -D BATCH_TILE=16 -o src/f32-vlog/gen/vlog-avx2-p4-div-x16.c &
+
+#################################### Scalar ###################################
+tools/xngen src/f32-vlog/scalar-p4-div.c.in -D BATCH_TILE=1  -o src/f32-vlog/gen/vlog-scalar-p4-div-x1.c &
+tools/xngen src/f32-vlog/scalar-p4-div.c.in -D BATCH_TILE=2  -o src/f32-vlog/gen/vlog-scalar-p4-div-x2.c &
+tools/xngen src/f32-vlog/scalar-p4-div.c.in -D BATCH_TILE=4  -o src/f32-vlog/gen/vlog-scalar-p4-div-x4.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/f32-vlog.yaml --output test/f32-vlog.cc &
+
+wait
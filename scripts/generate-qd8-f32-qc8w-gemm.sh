@@ -0,0 +1,21 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=1 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/1x4-minmax-scalar.c &
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=2 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/2x4-minmax-scalar.c &
+tools/xngen src/qd8-f32-qc8w-gemm/scalar.c.in -D MR=4 -D NR=4 -o src/qd8-f32-qc8w-gemm/gen/4x4-minmax-scalar.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/qd8-f32-qc8w-gemm/MRx8c8-avx2.c.in -D MR=1 -o src/qd8-f32-qc8w-gemm/gen/1x8c8-minmax-avx2.c &
+tools/xngen src/qd8-f32-qc8w-gemm/MRx8c8-avx2.c.in -D MR=2 -o src/qd8-f32-qc8w-gemm/gen/2x8c8-minmax-avx2.c &
+tools/xngen src/qd8-f32-qc8w-gemm/MRx8c8-avx2.c.in -D MR=3 -o src/qd8-f32-qc8w-gemm/gen/3x8c8-minmax-avx2.c &
+tools/xngen src/qd8-f32-qc8w-gemm/MRx8c8-avx2.c.in -D MR=4 -o src/qd8-f32-qc8w-gemm/gen/4x8c8-minmax-avx2.c &
+
+################################## Unit tests #################################
+tools/generate-gemm-test.py --spec test/qd8-f32-qc8w-gemm-minmax.yaml --output test/qd8-f32-qc8w-gemm-minmax.cc &
+
+wait
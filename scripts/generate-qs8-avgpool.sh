@@ -0,0 +1,19 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### Scalar ####################################
+tools/xngen src/qs8-avgpool/unipass-scalar.c.in -D PRIMARY_TILE=9 -D CHANNEL_TILE=1 -D REQUANTIZATION=FP32 -D VARIANT=FMAGIC -o src/qs8-avgpool/gen/9x-minmax-fp32-scalar-fmagic-c1.c &
+tools/xngen src/qs8-avgpool/multipass-scalar.c.in -D PRIMARY_TILE=9 -D INCREMENTAL_TILE=8 -D CHANNEL_TILE=1 -D REQUANTIZATION=FP32 -D VARIANT=FMAGIC -o src/qs8-avgpool/gen/9p8x-minmax-fp32-scalar-fmagic-c1.c &
+
+################################## ARM NEON ###################################
+tools/xngen src/qs8-avgpool/unipass-neon.c.in -D PRIMARY_TILE=9 -D CHANNEL_TILE=8 -D REQUANTIZATION=FP32 -o src/qs8-avgpool/gen/9x-minmax-fp32-neon-c8.c &
+tools/xngen src/qs8-avgpool/multipass-neon.c.in -D PRIMARY_TILE=9 -D INCREMENTAL_TILE=8 -D CHANNEL_TILE=8 -D REQUANTIZATION=FP32 -o src/qs8-avgpool/gen/9p8x-minmax-fp32-neon-c8.c &
+
+################################## x86 SSE4.1 #################################
+tools/xngen src/qs8-avgpool/unipass-sse4.c.in -D PRIMARY_TILE=9 -D CHANNEL_TILE=8 -D REQUANTIZATION=FP32 -o src/qs8-avgpool/gen/9x-minmax-fp32-sse41-c8.c &
+tools/xngen src/qs8-avgpool/multipass-sse4.c.in -D PRIMARY_TILE=9 -D INCREMENTAL_TILE=8 -D CHANNEL_TILE=8 -D REQUANTIZATION=FP32 -o src/qs8-avgpool/gen/9p8x-minmax-fp32-sse41-c8.c &
+
+wait
@@ -0,0 +1,23 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### x86 SSE ###################################
+tools/xngen src/qs8-gemm/MRx4c8-acc32-sse.c.in -D MR=1 -D SSE=2 -o src/qs8-gemm/gen/1x4c8-acc32-sse2.c &
+tools/xngen src/qs8-gemm/MRx4c8-acc32-sse.c.in -D MR=3 -D SSE=2 -o src/qs8-gemm/gen/3x4c8-acc32-sse2.c &
+
+tools/xngen src/qs8-gemm/MRx4c8-acc32-sse.c.in -D MR=1 -D SSE=4 -o src/qs8-gemm/gen/1x4c8-acc32-sse41.c &
+tools/xngen src/qs8-gemm/MRx4c8-acc32-sse.c.in -D MR=2 -D SSE=4 -o src/qs8-gemm/gen/2x4c8-acc32-sse41.c &
+tools/xngen src/qs8-gemm/MRx4c8-acc32-sse.c.in -D MR=3 -D SSE=4 -o src/qs8-gemm/gen/3x4c8-acc32-sse41.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/qs8-gemm/MRx8c8-acc32-avx2.c.in -D MR=1 -o src/qs8-gemm/gen/1x8c8-acc32-avx2.c &
+tools/xngen src/qs8-gemm/MRx8c8-acc32-avx2.c.in -D MR=3 -o src/qs8-gemm/gen/3x8c8-acc32-avx2.c &
+
+################################## x86 AVX512 #################################
+tools/xngen src/qs8-gemm/MRx16c8-acc32-avx512skx.c.in -D MR=1 -o src/qs8-gemm/gen/1x16c8-acc32-avx512skx.c &
+tools/xngen src/qs8-gemm/MRx16c8-acc32-avx512skx.c.in -D MR=4 -o src/qs8-gemm/gen/4x16c8-acc32-avx512skx.c &
+
+wait
@@ -0,0 +1,32 @@
+#!/bin/sh
+# Copyright 2022 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################## ARM NEON ###################################
+tools/xngen src/qs8-rsum/neon.c.in -D BATCH_TILE=16 -D ACCUMULATORS=1 -o src/qs8-rsum/gen/neon-x16.c &
+tools/xngen src/qs8-rsum/neon.c.in -D BATCH_TILE=32 -D ACCUMULATORS=2 -o src/qs8-rsum/gen/neon-x32-acc2.c &
+tools/xngen src/qs8-rsum/neon.c.in -D BATCH_TILE=64 -D ACCUMULATORS=4 -o src/qs8-rsum/gen/neon-x64-acc4.c &
+
+################################## x86 SSE2 ###################################
+tools/xngen src/qs8-rsum/sse2.c.in -D BATCH_TILE=16 -D ACCUMULATORS=1 -o src/qs8-rsum/gen/sse2-x16.c &
+tools/xngen src/qs8-rsum/sse2.c.in -D BATCH_TILE=32 -D ACCUMULATORS=2 -o src/qs8-rsum/gen/sse2-x32-acc2.c &
+tools/xngen src/qs8-rsum/sse2.c.in -D BATCH_TILE=64 -D ACCUMULATORS=4 -o src/qs8-rsum/gen/sse2-x64-acc4.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/qs8-rsum/avx2.c.in -D BATCH_TILE=32 -D ACCUMULATORS=1 -o src/qs8-rsum/gen/avx2-x32.c &
+tools/xngen src/qs8-rsum/avx2.c.in -D BATCH_TILE=64 -D ACCUMULATORS=2 -o src/qs8-rsum/gen/avx2-x64-acc2.c &
+tools/xngen src/qs8-rsum/avx2.c.in -D BATCH_TILE=128 -D ACCUMULATORS=4 -o src/qs8-rsum/gen/avx2-x128-acc4.c &
+
+################################### Scalar ####################################
+tools/xngen src/qs8-rsum/scalar.c.in -D BATCH_TILE=1  -D ACCUMULATORS=1 -o src/qs8-rsum/gen/scalar-x1.c &
+tools/xngen src/qs8-rsum/scalar.c.in -D BATCH_TILE=2  -D ACCUMULATORS=2 -o src/qs8-rsum/gen/scalar-x2-acc2.c &
+tools/xngen src/qs8-rsum/scalar.c.in -D BATCH_TILE=4  -D ACCUMULATORS=4 -o src/qs8-rsum/gen/scalar-x4-acc4.c &
+
+wait
+
+################################## Unit tests #################################
+tools/generate-reduce-test.py --spec test/qs8-rsum.yaml --output test/qs8-rsum.cc &
+
+wait
@@ -0,0 +1,19 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### Scalar ###################################
+tools/xngen src/qs8-softmax/scalar.c.in -D DATATYPE=QS8 -o src/qs8-softmax/gen/scalar.c &
+tools/xngen src/qs8-softmax/scalar.c.in -D DATATYPE=QU8 -o src/qu8-softmax/gen/scalar.c &
+
+################################### ARM NEON ##################################
+tools/xngen src/qs8-softmax/neon.c.in -D DATATYPE=QS8 -o src/qs8-softmax/gen/neon.c &
+tools/xngen src/qs8-softmax/neon.c.in -D DATATYPE=QU8 -o src/qu8-softmax/gen/neon.c &
+
+################################### x86 AVX2 ##################################
+tools/xngen src/qs8-softmax/avx2.c.in -D DATATYPE=QS8 -o src/qs8-softmax/gen/avx2.c &
+tools/xngen src/qs8-softmax/avx2.c.in -D DATATYPE=QU8 -o src/qu8-softmax/gen/avx2.c &
+
+wait
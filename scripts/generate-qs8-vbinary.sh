@@ -0,0 +1,60 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+#################################### Scalar ###################################
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=DIV     -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vdiv-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=DIV     -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vdiv-minmax-scalar-x4.c &
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=MAX     -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vmax-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=MAX     -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vmax-minmax-scalar-x4.c &
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=MIN     -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vmin-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=MIN     -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vmin-minmax-scalar-x4.c &
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=SQRDIFF -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vsqrdiff-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vop-scalar.c.in -D OP=SQRDIFF -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vsqrdiff-minmax-scalar-x4.c &
+
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=DIV     -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vdivc-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=DIV     -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vdivc-minmax-scalar-x4.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=RDIV    -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vrdivc-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=RDIV    -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vrdivc-minmax-scalar-x4.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=MAX     -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vmaxc-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=MAX     -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vmaxc-minmax-scalar-x4.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=MIN     -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vminc-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=MIN     -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vminc-minmax-scalar-x4.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=SQRDIFF -D BATCH_TILE=1 -o src/qs8-vbinary/gen/vsqrdiffc-minmax-scalar-x1.c &
+tools/xngen src/qs8-vbinary/vopc-scalar.c.in -D OP=SQRDIFF -D BATCH_TILE=4 -o src/qs8-vbinary/gen/vsqrdiffc-minmax-scalar-x4.c &
+
+################################## x86 SSE4.1 #################################
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=DIV     -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vdiv-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=DIV     -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vdiv-minmax-sse41-x16.c &
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=MAX     -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vmax-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=MAX     -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vmax-minmax-sse41-x16.c &
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=MIN     -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vmin-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=MIN     -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vmin-minmax-sse41-x16.c &
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=SQRDIFF -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vsqrdiff-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vop-sse41.c.in -D OP=SQRDIFF -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vsqrdiff-minmax-sse41-x16.c &
+
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=DIV     -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vdivc-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=DIV     -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vdivc-minmax-sse41-x16.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=RDIV    -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vrdivc-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=RDIV    -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vrdivc-minmax-sse41-x16.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=MAX     -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vmaxc-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=MAX     -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vmaxc-minmax-sse41-x16.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=MIN     -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vminc-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=MIN     -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vminc-minmax-sse41-x16.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=SQRDIFF -D BATCH_TILE=8  -o src/qs8-vbinary/gen/vsqrdiffc-minmax-sse41-x8.c &
+tools/xngen src/qs8-vbinary/vopc-sse41.c.in -D OP=SQRDIFF -D BATCH_TILE=16 -o src/qs8-vbinary/gen/vsqrdiffc-minmax-sse41-x16.c &
+
+################################## Unit tests #################################
+tools/generate-vbinary-test.py --tester VBinaryMicrokernelTester --spec test/qs8-vdiv-minmax.yaml --output test/qs8-vdiv-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryMicrokernelTester --spec test/qs8-vmax-minmax.yaml --output test/qs8-vmax-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryMicrokernelTester --spec test/qs8-vmin-minmax.yaml --output test/qs8-vmin-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryMicrokernelTester --spec test/qs8-vsqrdiff-minmax.yaml --output test/qs8-vsqrdiff-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryCMicrokernelTester --spec test/qs8-vdivc-minmax.yaml --output test/qs8-vdivc-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryCMicrokernelTester --spec test/qs8-vrdivc-minmax.yaml --output test/qs8-vrdivc-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryCMicrokernelTester --spec test/qs8-vmaxc-minmax.yaml --output test/qs8-vmaxc-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryCMicrokernelTester --spec test/qs8-vminc-minmax.yaml --output test/qs8-vminc-minmax.cc &
+tools/generate-vbinary-test.py --tester VBinaryCMicrokernelTester --spec test/qs8-vsqrdiffc-minmax.yaml --output test/qs8-vsqrdiffc-minmax.cc &
+
+wait
@@ -0,0 +1,22 @@
+#!/bin/sh
+# Copyright 2023 Google LLC
+#
+# This source code is licensed under the BSD-style license found in the
+# LICENSE file in the root directory of this source tree.
+
+################################### Scalar ####################################
+tools/xngen src/qs8-vlrelu/scalar.c.in -D BATCH_TILE=1 -o src/qs8-vlrelu/gen/vlrelu-scalar-x1.c &
+tools/xngen src/qs8-vlrelu/scalar.c.in -D BATCH_TILE=4 -o src/qs8-vlrelu/gen/vlrelu-scalar-x4.c &
+
+################################## ARM NEON ###################################
+tools/xngen src/qs8-vlrelu/neon.c.in -D BATCH_TILE=8  -o src/qs8-vlrelu/gen/vlrelu-neon-x8.c &
+tools/xngen src/qs8-vlrelu/neon.c.in -D BATCH_TILE=16 -o src/qs8-vlrelu/gen/vlrelu-neon-x16.c &
+
+################################## x86 SSE4.1 #################################
+tools/xngen src/qs8-vlrelu/sse4.c.in -D BATCH_TILE=8  -o src/qs8-vlrelu/gen/vlrelu-sse41-x8.c &
+tools/xngen src/qs8-vlrelu/sse4.c.in -D BATCH_TILE=16 -o src/qs8-vlrelu/gen/vlrelu-sse41-x16.c &
+
+################################## Unit tests #################################
+tools/generate-vunary-test.py --spec test/qs8-vlrelu.yaml --output test/qs8-vlrelu.cc &
+
+wait
@@ -20,6 +20,7 @@ tools/generate-maxpool-test.py --spec test/u8-maxpool-minmax.yaml --output test/
 ### Tests for AvgPool micro-kernels
 tools/generate-avgpool-test.py --spec test/f16-avgpool-minmax.yaml --output test/f16-avgpool-minmax.cc &
 tools/generate-avgpool-test.py --spec test/f32-avgpool-minmax.yaml --output test/f32-avgpool-minmax.cc &
+tools/generate-avgpool-test.py --spec test/qs8-avgpool-minmax-fp32.yaml --output test/qs8-avgpool-minmax-fp32.cc &
 tools/generate-avgpool-test.py --spec test/qu8-avgpool-minmax.yaml --output test/qu8-avgpool-minmax.cc &
 
 ### Tests for GAvgPool micro-kernels
@@ -0,0 +1,73 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-f32-vcvt/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_bf16_f32_vcvt_ukernel__avx2_x16(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // BF16 numbers are the upper halves of FP32 numbers: zero-extension followed by a 16-bit left shift widens them.
+  const uint16_t* i = (const uint16_t*) input;
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const __m256i vw0 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) i));
+    const __m256i vw1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    const __m256 vf0 = _mm256_castsi256_ps(_mm256_slli_epi32(vw0, 16));
+    const __m256 vf1 = _mm256_castsi256_ps(_mm256_slli_epi32(vw1, 16));
+
+    _mm256_storeu_ps(output, vf0);
+    _mm256_storeu_ps(output + 8, vf1);
+    output += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m256i vw = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    const __m256 vf = _mm256_castsi256_ps(_mm256_slli_epi32(vw, 16));
+
+    _mm256_storeu_ps(output, vf);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(uint16_t));
+    assert(n <= 7 * sizeof(uint16_t));
+    const __m256i vw = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vf = _mm256_castsi256_ps(_mm256_slli_epi32(vw, 16));
+
+    __m128 vf_lo = _mm256_castps256_ps128(vf);
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storeu_ps(output, vf_lo);
+      vf_lo = _mm256_extractf128_ps(vf, 1);
+      output += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      _mm_storel_pi((__m64*) output, vf_lo);
+      vf_lo = _mm_movehl_ps(vf_lo, vf_lo);
+      output += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      _mm_store_ss(output, vf_lo);
+    }
+  }
+}
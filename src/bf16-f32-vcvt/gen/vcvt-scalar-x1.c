@@ -0,0 +1,36 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-f32-vcvt/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_bf16_f32_vcvt_ukernel__scalar_x1(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // BF16 numbers are the upper halves of FP32 numbers: widening is a 16-bit left shift of the bit representation.
+  const uint16_t* i = (const uint16_t*) input;
+  uint32_t* o = (uint32_t*) output;
+  do {
+    const uint32_t vh = (uint32_t) *i++;
+    *o++ = vh << 16;
+
+    n -= sizeof(uint16_t);
+  } while (n != 0);
+}
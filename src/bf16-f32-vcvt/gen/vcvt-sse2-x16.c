@@ -0,0 +1,79 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-f32-vcvt/sse2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_bf16_f32_vcvt_ukernel__sse2_x16(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // BF16 numbers are the upper halves of FP32 numbers: interleaving them with zeroes widens them to FP32.
+  const __m128i vzero = _mm_setzero_si128();
+  const uint16_t* i = (const uint16_t*) input;
+  for (; n >= 16 * sizeof(uint16_t); n -= 16 * sizeof(uint16_t)) {
+    const __m128i vh0 = _mm_loadu_si128((const __m128i*) i);
+    const __m128i vh1 = _mm_loadu_si128((const __m128i*) (i + 8));
+    i += 16;
+
+    const __m128 vf0 = _mm_castsi128_ps(_mm_unpacklo_epi16(vzero, vh0));
+    const __m128 vf1 = _mm_castsi128_ps(_mm_unpackhi_epi16(vzero, vh0));
+    const __m128 vf2 = _mm_castsi128_ps(_mm_unpacklo_epi16(vzero, vh1));
+    const __m128 vf3 = _mm_castsi128_ps(_mm_unpackhi_epi16(vzero, vh1));
+
+    _mm_storeu_ps(output, vf0);
+    _mm_storeu_ps(output + 4, vf1);
+    _mm_storeu_ps(output + 8, vf2);
+    _mm_storeu_ps(output + 12, vf3);
+    output += 16;
+  }
+  for (; n >= 8 * sizeof(uint16_t); n -= 8 * sizeof(uint16_t)) {
+    const __m128i vh = _mm_loadu_si128((const __m128i*) i);
+    i += 8;
+
+    const __m128 vf_lo = _mm_castsi128_ps(_mm_unpacklo_epi16(vzero, vh));
+    const __m128 vf_hi = _mm_castsi128_ps(_mm_unpackhi_epi16(vzero, vh));
+
+    _mm_storeu_ps(output, vf_lo);
+    _mm_storeu_ps(output + 4, vf_hi);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(uint16_t));
+    assert(n <= 7 * sizeof(uint16_t));
+    const __m128i vh = _mm_loadu_si128((const __m128i*) i);
+
+    __m128 vf = _mm_castsi128_ps(_mm_unpacklo_epi16(vzero, vh));
+    if (n & (4 * sizeof(uint16_t))) {
+      _mm_storeu_ps(output, vf);
+      vf = _mm_castsi128_ps(_mm_unpackhi_epi16(vzero, vh));
+      output += 4;
+    }
+    if (n & (2 * sizeof(uint16_t))) {
+      _mm_storel_pi((__m64*) output, vf);
+      vf = _mm_movehl_ps(vf, vf);
+      output += 2;
+    }
+    if (n & (1 * sizeof(uint16_t))) {
+      _mm_store_ss(output, vf);
+    }
+  }
+}
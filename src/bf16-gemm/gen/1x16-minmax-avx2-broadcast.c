@@ -0,0 +1,122 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-gemm/avx2-broadcast.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void*restrict a,
+    size_t a_stride,
+    const void*restrict w,
+    void*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const uint16_t* a0 = (const uint16_t*) a;
+  uint16_t* c0 = (uint16_t*) c;
+
+  // Rounding of FP32 accumulators to BF16 outputs: add 0x7FFF plus the lowest retained bit, and keep the upper half.
+  // Accumulators are never NaN after clamping, so no special handling of NaNs is needed.
+  const __m256i vbias = _mm256_set1_epi32(0x7FFF);
+  const __m256i vone = _mm256_set1_epi32(1);
+  do {
+    // Packed weights start with FP32 biases, followed by BF16 weights.
+    __m256 vacc0x01234567 = _mm256_loadu_ps((const float*) w + 0);
+    __m256 vacc0x89ABCDEF = _mm256_loadu_ps((const float*) w + 8);
+    w = (const float*) w + 16;
+
+    // BF16 numbers are the upper halves of FP32 numbers: a 16-bit left shift of the zero-extended BF16 bits widens
+    // them to FP32 without any BF16-specific instructions.
+    size_t k = kc;
+    do {
+      const __m256 va0 = _mm256_castsi256_ps(_mm256_set1_epi32((int) ((uint32_t) *a0 << 16)));
+      a0 += 1;
+
+      const __m256 vb01234567 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) w)), 16));
+      const __m256 vb89ABCDEF = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) ((const uint16_t*) w + 8))), 16));
+      w = (const uint16_t*) w + 16;
+
+      vacc0x01234567 = _mm256_fmadd_ps(va0, vb01234567, vacc0x01234567);
+      vacc0x89ABCDEF = _mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF);
+
+      k -= sizeof(uint16_t);
+    } while (k != 0);
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+
+    const __m256i vw0x01234567 = _mm256_castps_si256(vacc0x01234567);
+    const __m256i vw0x89ABCDEF = _mm256_castps_si256(vacc0x89ABCDEF);
+    const __m256i vr0x01234567 = _mm256_srai_epi32(
+      _mm256_add_epi32(_mm256_add_epi32(vw0x01234567, vbias), _mm256_and_si256(_mm256_srli_epi32(vw0x01234567, 16), vone)), 16);
+    const __m256i vr0x89ABCDEF = _mm256_srai_epi32(
+      _mm256_add_epi32(_mm256_add_epi32(vw0x89ABCDEF, vbias), _mm256_and_si256(_mm256_srli_epi32(vw0x89ABCDEF, 16), vone)), 16);
+    __m128i vh0x01234567 = _mm_packs_epi32(_mm256_castsi256_si128(vr0x01234567), _mm256_extracti128_si256(vr0x01234567, 1));
+    __m128i vh0x89ABCDEF = _mm_packs_epi32(_mm256_castsi256_si128(vr0x89ABCDEF), _mm256_extracti128_si256(vr0x89ABCDEF, 1));
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm_storeu_si128((__m128i*) c0, vh0x01234567);
+      _mm_storeu_si128((__m128i*) (c0 + 8), vh0x89ABCDEF);
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const uint16_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      if (nc & 8) {
+        _mm_storeu_si128((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = vh0x89ABCDEF;
+
+        c0 += 8;
+      }
+      if (nc & 4) {
+        _mm_storel_epi64((__m128i*) c0, vh0x01234567);
+
+        vh0x01234567 = _mm_unpackhi_epi64(vh0x01234567, vh0x01234567);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        *((uint32_t*) c0) = (uint32_t) _mm_cvtsi128_si32(vh0x01234567);
+
+        vh0x01234567 = _mm_srli_epi64(vh0x01234567, 32);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        *c0 = (uint16_t) _mm_extract_epi16(vh0x01234567, 0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
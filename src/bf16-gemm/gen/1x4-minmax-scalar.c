@@ -0,0 +1,102 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-gemm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_bf16_gemm_minmax_ukernel_1x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    void* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const uint16_t* a0 = (const uint16_t*) a;
+  uint16_t* c0 = (uint16_t*) c;
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  do {
+    // Packed weights start with FP32 biases, followed by BF16 weights.
+    float vacc0x0 = ((const float*) w)[0];
+    float vacc0x1 = ((const float*) w)[1];
+    float vacc0x2 = ((const float*) w)[2];
+    float vacc0x3 = ((const float*) w)[3];
+    w = (const float*) w + 4;
+
+    size_t k = kc;
+    do {
+      const float va0 = math_cvt_fp32_bf16(*a0++);
+
+      const float vb0 = math_cvt_fp32_bf16(((const uint16_t*) w)[0]);
+      const float vb1 = math_cvt_fp32_bf16(((const uint16_t*) w)[1]);
+      const float vb2 = math_cvt_fp32_bf16(((const uint16_t*) w)[2]);
+      const float vb3 = math_cvt_fp32_bf16(((const uint16_t*) w)[3]);
+      w = (const uint16_t*) w + 4;
+
+      vacc0x0 = math_muladd_f32(va0, vb0, vacc0x0);
+      vacc0x1 = math_muladd_f32(va0, vb1, vacc0x1);
+      vacc0x2 = math_muladd_f32(va0, vb2, vacc0x2);
+      vacc0x3 = math_muladd_f32(va0, vb3, vacc0x3);
+
+      k -= sizeof(uint16_t);
+    } while (k != 0);
+
+    vacc0x0 = math_max_f32(vacc0x0, vmin);
+    vacc0x1 = math_max_f32(vacc0x1, vmin);
+    vacc0x2 = math_max_f32(vacc0x2, vmin);
+    vacc0x3 = math_max_f32(vacc0x3, vmin);
+
+    vacc0x0 = math_min_f32(vacc0x0, vmax);
+    vacc0x1 = math_min_f32(vacc0x1, vmax);
+    vacc0x2 = math_min_f32(vacc0x2, vmax);
+    vacc0x3 = math_min_f32(vacc0x3, vmax);
+
+    if XNN_LIKELY(nc >= 4) {
+      c0[0] = math_cvt_bf16_fp32(vacc0x0);
+      c0[1] = math_cvt_bf16_fp32(vacc0x1);
+      c0[2] = math_cvt_bf16_fp32(vacc0x2);
+      c0[3] = math_cvt_bf16_fp32(vacc0x3);
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const uint16_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c0[0] = math_cvt_bf16_fp32(vacc0x0);
+        c0[1] = math_cvt_bf16_fp32(vacc0x1);
+        vacc0x0 = vacc0x2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c0[0] = math_cvt_bf16_fp32(vacc0x0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -0,0 +1,204 @@
+// Auto-generated file. Do not edit!
+//   Template: src/bf16-gemm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_bf16_gemm_minmax_ukernel_4x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const void* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    void* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 4);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(uint16_t) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const uint16_t* a0 = (const uint16_t*) a;
+  uint16_t* c0 = (uint16_t*) c;
+  const uint16_t* a1 = (const uint16_t*) ((uintptr_t) a0 + a_stride);
+  uint16_t* c1 = (uint16_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const uint16_t* a2 = (const uint16_t*) ((uintptr_t) a1 + a_stride);
+  uint16_t* c2 = (uint16_t*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+  const uint16_t* a3 = (const uint16_t*) ((uintptr_t) a2 + a_stride);
+  uint16_t* c3 = (uint16_t*) ((uintptr_t) c2 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 4) {
+    a3 = a2;
+    c3 = c2;
+  }
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  do {
+    // Packed weights start with FP32 biases, followed by BF16 weights.
+    float vacc0x0 = ((const float*) w)[0];
+    float vacc0x1 = ((const float*) w)[1];
+    float vacc0x2 = ((const float*) w)[2];
+    float vacc0x3 = ((const float*) w)[3];
+    float vacc1x0 = vacc0x0;
+    float vacc1x1 = vacc0x1;
+    float vacc1x2 = vacc0x2;
+    float vacc1x3 = vacc0x3;
+    float vacc2x0 = vacc0x0;
+    float vacc2x1 = vacc0x1;
+    float vacc2x2 = vacc0x2;
+    float vacc2x3 = vacc0x3;
+    float vacc3x0 = vacc0x0;
+    float vacc3x1 = vacc0x1;
+    float vacc3x2 = vacc0x2;
+    float vacc3x3 = vacc0x3;
+    w = (const float*) w + 4;
+
+    size_t k = kc;
+    do {
+      const float va0 = math_cvt_fp32_bf16(*a0++);
+      const float va1 = math_cvt_fp32_bf16(*a1++);
+      const float va2 = math_cvt_fp32_bf16(*a2++);
+      const float va3 = math_cvt_fp32_bf16(*a3++);
+
+      const float vb0 = math_cvt_fp32_bf16(((const uint16_t*) w)[0]);
+      const float vb1 = math_cvt_fp32_bf16(((const uint16_t*) w)[1]);
+      const float vb2 = math_cvt_fp32_bf16(((const uint16_t*) w)[2]);
+      const float vb3 = math_cvt_fp32_bf16(((const uint16_t*) w)[3]);
+      w = (const uint16_t*) w + 4;
+
+      vacc0x0 = math_muladd_f32(va0, vb0, vacc0x0);
+      vacc0x1 = math_muladd_f32(va0, vb1, vacc0x1);
+      vacc0x2 = math_muladd_f32(va0, vb2, vacc0x2);
+      vacc0x3 = math_muladd_f32(va0, vb3, vacc0x3);
+      vacc1x0 = math_muladd_f32(va1, vb0, vacc1x0);
+      vacc1x1 = math_muladd_f32(va1, vb1, vacc1x1);
+      vacc1x2 = math_muladd_f32(va1, vb2, vacc1x2);
+      vacc1x3 = math_muladd_f32(va1, vb3, vacc1x3);
+      vacc2x0 = math_muladd_f32(va2, vb0, vacc2x0);
+      vacc2x1 = math_muladd_f32(va2, vb1, vacc2x1);
+      vacc2x2 = math_muladd_f32(va2, vb2, vacc2x2);
+      vacc2x3 = math_muladd_f32(va2, vb3, vacc2x3);
+      vacc3x0 = math_muladd_f32(va3, vb0, vacc3x0);
+      vacc3x1 = math_muladd_f32(va3, vb1, vacc3x1);
+      vacc3x2 = math_muladd_f32(va3, vb2, vacc3x2);
+      vacc3x3 = math_muladd_f32(va3, vb3, vacc3x3);
+
+      k -= sizeof(uint16_t);
+    } while (k != 0);
+
+    vacc0x0 = math_max_f32(vacc0x0, vmin);
+    vacc0x1 = math_max_f32(vacc0x1, vmin);
+    vacc0x2 = math_max_f32(vacc0x2, vmin);
+    vacc0x3 = math_max_f32(vacc0x3, vmin);
+    vacc1x0 = math_max_f32(vacc1x0, vmin);
+    vacc1x1 = math_max_f32(vacc1x1, vmin);
+    vacc1x2 = math_max_f32(vacc1x2, vmin);
+    vacc1x3 = math_max_f32(vacc1x3, vmin);
+    vacc2x0 = math_max_f32(vacc2x0, vmin);
+    vacc2x1 = math_max_f32(vacc2x1, vmin);
+    vacc2x2 = math_max_f32(vacc2x2, vmin);
+    vacc2x3 = math_max_f32(vacc2x3, vmin);
+    vacc3x0 = math_max_f32(vacc3x0, vmin);
+    vacc3x1 = math_max_f32(vacc3x1, vmin);
+    vacc3x2 = math_max_f32(vacc3x2, vmin);
+    vacc3x3 = math_max_f32(vacc3x3, vmin);
+
+    vacc0x0 = math_min_f32(vacc0x0, vmax);
+    vacc0x1 = math_min_f32(vacc0x1, vmax);
+    vacc0x2 = math_min_f32(vacc0x2, vmax);
+    vacc0x3 = math_min_f32(vacc0x3, vmax);
+    vacc1x0 = math_min_f32(vacc1x0, vmax);
+    vacc1x1 = math_min_f32(vacc1x1, vmax);
+    vacc1x2 = math_min_f32(vacc1x2, vmax);
+    vacc1x3 = math_min_f32(vacc1x3, vmax);
+    vacc2x0 = math_min_f32(vacc2x0, vmax);
+    vacc2x1 = math_min_f32(vacc2x1, vmax);
+    vacc2x2 = math_min_f32(vacc2x2, vmax);
+    vacc2x3 = math_min_f32(vacc2x3, vmax);
+    vacc3x0 = math_min_f32(vacc3x0, vmax);
+    vacc3x1 = math_min_f32(vacc3x1, vmax);
+    vacc3x2 = math_min_f32(vacc3x2, vmax);
+    vacc3x3 = math_min_f32(vacc3x3, vmax);
+
+    if XNN_LIKELY(nc >= 4) {
+      c3[0] = math_cvt_bf16_fp32(vacc3x0);
+      c3[1] = math_cvt_bf16_fp32(vacc3x1);
+      c3[2] = math_cvt_bf16_fp32(vacc3x2);
+      c3[3] = math_cvt_bf16_fp32(vacc3x3);
+      c3 = (uint16_t*) ((uintptr_t) c3 + cn_stride);
+      c2[0] = math_cvt_bf16_fp32(vacc2x0);
+      c2[1] = math_cvt_bf16_fp32(vacc2x1);
+      c2[2] = math_cvt_bf16_fp32(vacc2x2);
+      c2[3] = math_cvt_bf16_fp32(vacc2x3);
+      c2 = (uint16_t*) ((uintptr_t) c2 + cn_stride);
+      c1[0] = math_cvt_bf16_fp32(vacc1x0);
+      c1[1] = math_cvt_bf16_fp32(vacc1x1);
+      c1[2] = math_cvt_bf16_fp32(vacc1x2);
+      c1[3] = math_cvt_bf16_fp32(vacc1x3);
+      c1 = (uint16_t*) ((uintptr_t) c1 + cn_stride);
+      c0[0] = math_cvt_bf16_fp32(vacc0x0);
+      c0[1] = math_cvt_bf16_fp32(vacc0x1);
+      c0[2] = math_cvt_bf16_fp32(vacc0x2);
+      c0[3] = math_cvt_bf16_fp32(vacc0x3);
+      c0 = (uint16_t*) ((uintptr_t) c0 + cn_stride);
+
+      a3 = (const uint16_t*) ((uintptr_t) a3 - kc);
+      a2 = (const uint16_t*) ((uintptr_t) a2 - kc);
+      a1 = (const uint16_t*) ((uintptr_t) a1 - kc);
+      a0 = (const uint16_t*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c3[0] = math_cvt_bf16_fp32(vacc3x0);
+        c3[1] = math_cvt_bf16_fp32(vacc3x1);
+        vacc3x0 = vacc3x2;
+        c3 += 2;
+        c2[0] = math_cvt_bf16_fp32(vacc2x0);
+        c2[1] = math_cvt_bf16_fp32(vacc2x1);
+        vacc2x0 = vacc2x2;
+        c2 += 2;
+        c1[0] = math_cvt_bf16_fp32(vacc1x0);
+        c1[1] = math_cvt_bf16_fp32(vacc1x1);
+        vacc1x0 = vacc1x2;
+        c1 += 2;
+        c0[0] = math_cvt_bf16_fp32(vacc0x0);
+        c0[1] = math_cvt_bf16_fp32(vacc0x1);
+        vacc0x0 = vacc0x2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c3[0] = math_cvt_bf16_fp32(vacc3x0);
+        c2[0] = math_cvt_bf16_fp32(vacc2x0);
+        c1[0] = math_cvt_bf16_fp32(vacc1x0);
+        c0[0] = math_cvt_bf16_fp32(vacc0x0);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
@@ -22,6 +22,8 @@ const char* xnn_datatype_to_string(enum xnn_datatype type) {
       return "FP32";
     case xnn_datatype_fp16:
       return "FP16";
+    case xnn_datatype_bf16:
+      return "BF16";
     case xnn_datatype_qint8:
       return "QINT8";
     case xnn_datatype_quint8:
@@ -32,6 +34,10 @@ const char* xnn_datatype_to_string(enum xnn_datatype type) {
       return "QCINT8";
     case xnn_datatype_qcint32:
       return "QCINT32";
+    case xnn_datatype_qcint4:
+      return "QCINT4";
+    case xnn_datatype_int32:
+      return "INT32";
   }
   XNN_UNREACHABLE;
   return NULL;
@@ -0,0 +1,77 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rmoments/neonfp16.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f16_rmoments_ukernel__neonfp16_x8(
+    size_t batch,
+    const void* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  // Deviations are accumulated around the first element to avoid catastrophic cancellation in the variance.
+  const float32x4_t vshift = vdupq_lane_f32(vget_low_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_dup_u16(i)))), 0);
+  const float vscale = 1.0f / (float) (batch / sizeof(uint16_t));
+  float32x4_t vsum0 = vmovq_n_f32(0.0f);
+  float32x4_t vsum1 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq0 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq1 = vmovq_n_f32(0.0f);
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const float16x8_t vh0 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+
+    const float32x4_t vt0 = vsubq_f32(vcvt_f32_f16(vget_low_f16(vh0)), vshift);
+    const float32x4_t vt1 = vsubq_f32(vcvt_f32_f16(vget_high_f16(vh0)), vshift);
+
+    vsum0 = vaddq_f32(vsum0, vt0);
+    vsum1 = vaddq_f32(vsum1, vt1);
+    vsumsq0 = vmlaq_f32(vsumsq0, vt0, vt0);
+    vsumsq1 = vmlaq_f32(vsumsq1, vt1, vt1);
+  }
+  vsum0 = vaddq_f32(vsum0, vsum1);
+  vsumsq0 = vaddq_f32(vsumsq0, vsumsq1);
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vt = vsubq_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))), vshift); i += 4;
+
+    vsum0 = vaddq_f32(vsum0, vt);
+    vsumsq0 = vmlaq_f32(vsumsq0, vt, vt);
+  }
+  const float32x2_t vshift_lo = vget_low_f32(vshift);
+  float32x2_t vsum = vadd_f32(vget_low_f32(vsum0), vget_high_f32(vsum0));
+  float32x2_t vsumsq = vadd_f32(vget_low_f32(vsumsq0), vget_high_f32(vsumsq0));
+  if XNN_UNLIKELY(batch != 0) {
+    // Only the low lane holds an element: the high lane is zeroed after subtracting the shift.
+    const uint32x2_t vmask = vset_lane_u32(0, vmov_n_u32(UINT32_C(0xFFFFFFFF)), 1);
+    do {
+      float32x2_t vt = vget_low_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_lane_u16(i, vmov_n_u16(0), 0)))); i += 1;
+      vt = vreinterpret_f32_u32(vand_u32(vreinterpret_u32_f32(vsub_f32(vt, vshift_lo)), vmask));
+
+      vsum = vadd_f32(vsum, vt);
+      vsumsq = vmla_f32(vsumsq, vt, vt);
+      batch -= sizeof(uint16_t);
+    } while (batch != 0);
+  }
+  vsum = vpadd_f32(vsum, vsum);
+  vsumsq = vpadd_f32(vsumsq, vsumsq);
+
+  const float vmean = vget_lane_f32(vsum, 0) * vscale;
+  output[0] = vget_lane_f32(vshift_lo, 0) + vmean;
+  output[1] = math_max_f32(vget_lane_f32(vsumsq, 0) * vscale - vmean * vmean, 0.0f);
+}
@@ -0,0 +1,49 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rsum/avx512skx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f16_rsum_ukernel__avx512skx_x16(
+    size_t batch,
+    const void* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  __m512 vacc0 = _mm512_setzero_ps();
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m512 vt0 = _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) i));
+    i += 16;
+
+    vacc0 = _mm512_add_ps(vacc0, vt0);
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 15 * sizeof(uint16_t));
+    // Prepare mask for valid 16-bit elements (depends on batch).
+    batch >>= 1 /* log2(sizeof(uint16_t)) */;
+    const __mmask16 vmask = _cvtu32_mask16((uint16_t) ((uint32_t) (UINT32_C(1) << batch) - UINT32_C(1)));
+
+    const __m512 vt = _mm512_cvtph_ps(_mm256_maskz_loadu_epi16(vmask, i));
+
+    vacc0 = _mm512_add_ps(vacc0, vt);
+  }
+  *output = _mm512_reduce_add_ps(vacc0);
+}
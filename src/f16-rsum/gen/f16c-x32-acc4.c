@@ -0,0 +1,67 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rsum/f16c.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f16_rsum_ukernel__f16c_x32_acc4(
+    size_t batch,
+    const void* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  __m256 vacc0 = _mm256_setzero_ps();
+  __m256 vacc1 = _mm256_setzero_ps();
+  __m256 vacc2 = _mm256_setzero_ps();
+  __m256 vacc3 = _mm256_setzero_ps();
+  for (; batch >= 32 * sizeof(uint16_t); batch -= 32 * sizeof(uint16_t)) {
+    const __m256 vt0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vt1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    const __m256 vt2 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 16)));
+    const __m256 vt3 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 24)));
+    i += 32;
+
+    vacc0 = _mm256_add_ps(vacc0, vt0);
+    vacc1 = _mm256_add_ps(vacc1, vt1);
+    vacc2 = _mm256_add_ps(vacc2, vt2);
+    vacc3 = _mm256_add_ps(vacc3, vt3);
+  }
+  vacc0 = _mm256_add_ps(vacc0, vacc1);
+  vacc2 = _mm256_add_ps(vacc2, vacc3);
+  vacc0 = _mm256_add_ps(vacc0, vacc2);
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vt = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    vacc0 = _mm256_add_ps(vacc0, vt);
+  }
+  __m128 vacc = _mm_add_ps(_mm256_castps256_ps128(vacc0), _mm256_extractf128_ps(vacc0, 1));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vt = _mm_cvtph_ps(_mm_cvtsi32_si128((int) (uint32_t) *i));
+      i += 1;
+
+      vacc = _mm_add_ss(vacc, vt);
+      batch -= sizeof(uint16_t);
+    } while (batch != 0);
+  }
+  vacc = _mm_add_ps(vacc, _mm_movehl_ps(vacc, vacc));
+  vacc = _mm_add_ss(vacc, _mm_movehdup_ps(vacc));
+  _mm_store_ss(output, vacc);
+}
@@ -0,0 +1,62 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rsum/neonfp16.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f16_rsum_ukernel__neonfp16_x16_acc2(
+    size_t batch,
+    const void* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  float32x4_t vacc0 = vmovq_n_f32(0.0f);
+  float32x4_t vacc1 = vmovq_n_f32(0.0f);
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const float16x8_t vh0 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+    const float16x8_t vh1 = vreinterpretq_f16_u16(vld1q_u16(i)); i += 8;
+
+    const float32x4_t vt0 = vcvt_f32_f16(vget_low_f16(vh0));
+    const float32x4_t vt1 = vcvt_f32_f16(vget_high_f16(vh0));
+    const float32x4_t vt2 = vcvt_f32_f16(vget_low_f16(vh1));
+    const float32x4_t vt3 = vcvt_f32_f16(vget_high_f16(vh1));
+
+    vacc0 = vaddq_f32(vacc0, vt0);
+    vacc1 = vaddq_f32(vacc1, vt1);
+    vacc0 = vaddq_f32(vacc0, vt2);
+    vacc1 = vaddq_f32(vacc1, vt3);
+  }
+  vacc0 = vaddq_f32(vacc0, vacc1);
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vt = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))); i += 4;
+
+    vacc0 = vaddq_f32(vacc0, vt);
+  }
+  float32x2_t vacc = vadd_f32(vget_low_f32(vacc0), vget_high_f32(vacc0));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float32x2_t vt = vget_low_f32(vcvt_f32_f16(vreinterpret_f16_u16(vld1_lane_u16(i, vmov_n_u16(0), 0)))); i += 1;
+
+      vacc = vadd_f32(vacc, vt);
+      batch -= sizeof(uint16_t);
+    } while (batch != 0);
+  }
+  vacc = vpadd_f32(vacc, vacc);
+  vst1_lane_f32(output, vacc, 0);
+}
@@ -0,0 +1,49 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-rsum/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+#include <fp16.h>
+
+
+void xnn_f16_rsum_ukernel__scalar_x2_acc2(
+    size_t batch,
+    const void* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  float vacc0 = 0.0f;
+  float vacc1 = 0.0f;
+  for (; batch >= 2 * sizeof(uint16_t); batch -= 2 * sizeof(uint16_t)) {
+    const float vt0 = fp16_ieee_to_fp32_value(i[0]);
+    const float vt1 = fp16_ieee_to_fp32_value(i[1]);
+    i += 2;
+
+    vacc0 += vt0;
+    vacc1 += vt1;
+  }
+  vacc0 += vacc1;
+
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vt = fp16_ieee_to_fp32_value(*i++);
+      vacc0 += vt;
+      batch -= sizeof(uint16_t);
+    } while (batch != 0);
+  }
+  *output = vacc0;
+}
@@ -0,0 +1,188 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vexp/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vexp_ukernel__avx2_rr2_p5_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch % sizeof(uint16_t) == 0);
+
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_rr2_p5.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_rr2_p5.magic_bias);
+  const __m256 vminus_ln2_hi = _mm256_load_ps(params->avx2_rr2_p5.minus_ln2_hi);
+  const __m256 vminus_ln2_lo = _mm256_load_ps(params->avx2_rr2_p5.minus_ln2_lo);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_rr2_p5.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_rr2_p5.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_rr2_p5.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_rr2_p5.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_rr2_p5.c1);
+  const __m256i vmin_exponent = _mm256_load_si256((const __m256i*) params->avx2_rr2_p5.min_exponent);
+  const __m256i vmax_exponent = _mm256_load_si256((const __m256i*) params->avx2_rr2_p5.max_exponent);
+  const __m256 vzero_cutoff = _mm256_load_ps(params->avx2_rr2_p5.zero_cutoff);
+  const __m256 vinf_cutoff = _mm256_load_ps(params->avx2_rr2_p5.inf_cutoff);
+  const __m256 vplus_inf = _mm256_load_ps(params->avx2_rr2_p5.plus_inf);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    __m256 vn0 = _mm256_fmadd_ps(vx0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vx1, vlog2e, vmagic_bias);
+
+    __m256i veo0 = _mm256_slli_epi32(_mm256_castps_si256(vn0), 23);
+    __m256i veo1 = _mm256_slli_epi32(_mm256_castps_si256(vn1), 23);
+
+    __m256i ven0 = _mm256_max_epi32(veo0, vmin_exponent);
+    __m256i ven1 = _mm256_max_epi32(veo1, vmin_exponent);
+
+    ven0 = _mm256_min_epi32(ven0, vmax_exponent);
+    ven1 = _mm256_min_epi32(ven1, vmax_exponent);
+
+    veo0 = _mm256_sub_epi32(veo0, ven0);
+    veo1 = _mm256_sub_epi32(veo1, ven1);
+
+    const __m256 vsn0 = _mm256_castsi256_ps(_mm256_add_epi32(ven0, vmax_exponent));
+    const __m256 vsn1 = _mm256_castsi256_ps(_mm256_add_epi32(ven1, vmax_exponent));
+
+    const __m256 vso0 = _mm256_castsi256_ps(_mm256_add_epi32(veo0, vmax_exponent));
+    const __m256 vso1 = _mm256_castsi256_ps(_mm256_add_epi32(veo1, vmax_exponent));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vso0);
+    vt1 = _mm256_mul_ps(vt1, vso1);
+
+    __m256 vy0 = _mm256_mul_ps(vsn0, _mm256_fmadd_ps(vt0, vp0, vso0));
+    __m256 vy1 = _mm256_mul_ps(vsn1, _mm256_fmadd_ps(vt1, vp1, vso1));
+
+    vy0 = _mm256_andnot_ps(_mm256_cmp_ps(vx0, vzero_cutoff, _CMP_LT_OS), vy0);
+    vy1 = _mm256_andnot_ps(_mm256_cmp_ps(vx1, vzero_cutoff, _CMP_LT_OS), vy1);
+
+    const __m256 vm0 = _mm256_cmp_ps(vx0, vinf_cutoff, _CMP_GT_OS);
+    const __m256 vm1 = _mm256_cmp_ps(vx1, vinf_cutoff, _CMP_GT_OS);
+
+    vy0 = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm0), _mm256_andnot_ps(vm0, vy0));
+    vy1 = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm1), _mm256_andnot_ps(vm1, vy1));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_NO_EXC));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_NO_EXC));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vmax_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vmax_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    const __m256 vm = _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS);
+    vy = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm), _mm256_andnot_ps(vm, vy));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vmax_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vmax_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    const __m256 vm = _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS);
+    vy = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm), _mm256_andnot_ps(vm, vy));
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
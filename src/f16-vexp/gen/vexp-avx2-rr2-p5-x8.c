@@ -0,0 +1,122 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vexp/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vexp_ukernel__avx2_rr2_p5_x8(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch % sizeof(uint16_t) == 0);
+
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_rr2_p5.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_rr2_p5.magic_bias);
+  const __m256 vminus_ln2_hi = _mm256_load_ps(params->avx2_rr2_p5.minus_ln2_hi);
+  const __m256 vminus_ln2_lo = _mm256_load_ps(params->avx2_rr2_p5.minus_ln2_lo);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_rr2_p5.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_rr2_p5.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_rr2_p5.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_rr2_p5.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_rr2_p5.c1);
+  const __m256i vmin_exponent = _mm256_load_si256((const __m256i*) params->avx2_rr2_p5.min_exponent);
+  const __m256i vmax_exponent = _mm256_load_si256((const __m256i*) params->avx2_rr2_p5.max_exponent);
+  const __m256 vzero_cutoff = _mm256_load_ps(params->avx2_rr2_p5.zero_cutoff);
+  const __m256 vinf_cutoff = _mm256_load_ps(params->avx2_rr2_p5.inf_cutoff);
+  const __m256 vplus_inf = _mm256_load_ps(params->avx2_rr2_p5.plus_inf);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vmax_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vmax_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    const __m256 vm = _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS);
+    vy = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm), _mm256_andnot_ps(vm, vy));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vmax_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vmax_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    const __m256 vm = _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS);
+    vy = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm), _mm256_andnot_ps(vm, vy));
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
@@ -0,0 +1,123 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vgelu/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+// GELU is evaluated with the tanh approximation: 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x**3))), which
+// equals x * sigmoid(alpha * x + beta * x**3) with alpha = sqrt(8 / pi) and beta = 0.044715 * alpha.
+void xnn_f16_vgelu_ukernel__avx2_rr1_p5_div_x8(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch % sizeof(uint16_t) == 0);
+
+  const __m256 valpha = _mm256_load_ps(params->avx2_rr1_p5.alpha);
+  const __m256 vbeta = _mm256_load_ps(params->avx2_rr1_p5.beta);
+  const __m256 vsign_mask = _mm256_load_ps(params->avx2_rr1_p5.sign_mask);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_rr1_p5.magic_bias);
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_rr1_p5.log2e);
+  const __m256 vminus_ln2 = _mm256_load_ps(params->avx2_rr1_p5.minus_ln2);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_rr1_p5.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_rr1_p5.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_rr1_p5.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_rr1_p5.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_rr1_p5.c1);
+  const __m256 vone = _mm256_load_ps(params->avx2_rr1_p5.one);
+  const __m256 vdenorm_cutoff = _mm256_load_ps(params->avx2_rr1_p5.denorm_cutoff);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    const __m256 va = _mm256_mul_ps(_mm256_fmadd_ps(_mm256_mul_ps(vx, vx), vbeta, valpha), vx);
+
+    const __m256 vz = _mm256_or_ps(va, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+
+    const __m256 vd = _mm256_add_ps(ve, vone);
+    __m256 vf = _mm256_div_ps(ve, vd);
+
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, va);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    const __m256 va = _mm256_mul_ps(_mm256_fmadd_ps(_mm256_mul_ps(vx, vx), vbeta, valpha), vx);
+
+    const __m256 vz = _mm256_or_ps(va, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+
+    const __m256 vd = _mm256_add_ps(ve, vone);
+    __m256 vf = _mm256_div_ps(ve, vd);
+
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, va);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
@@ -0,0 +1,78 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vlayernorm/f16c.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vlayernorm_ukernel__f16c_x8(
+    size_t batch,
+    const void* input,
+    const float* stats,
+    const void* gamma,
+    const void* beta,
+    void* output) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(stats != NULL);
+  assert(gamma != NULL);
+  assert(beta != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  const uint16_t* g = (const uint16_t*) gamma;
+  const uint16_t* b = (const uint16_t*) beta;
+  uint16_t* o = (uint16_t*) output;
+
+  const __m256 vmean = _mm256_broadcast_ss(stats);
+  const __m256 vinv_stddev = _mm256_broadcast_ss(stats + 1);
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vy = _mm256_mul_ps(_mm256_sub_ps(vx, vmean), vinv_stddev);
+    vy = _mm256_add_ps(
+      _mm256_mul_ps(vy, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) g))),
+      _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b)));
+    g += 8;
+    b += 8;
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vy = _mm256_mul_ps(_mm256_sub_ps(vx, vmean), vinv_stddev);
+    vy = _mm256_add_ps(
+      _mm256_mul_ps(vy, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) g))),
+      _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) b)));
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
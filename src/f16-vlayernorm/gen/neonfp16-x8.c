@@ -0,0 +1,81 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vlayernorm/neonfp16.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vlayernorm_ukernel__neonfp16_x8(
+    size_t batch,
+    const void* input,
+    const float* stats,
+    const void* gamma,
+    const void* beta,
+    void* output) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(uint16_t) == 0);
+  assert(input != NULL);
+  assert(stats != NULL);
+  assert(gamma != NULL);
+  assert(beta != NULL);
+  assert(output != NULL);
+
+  const uint16_t* i = (const uint16_t*) input;
+  const uint16_t* g = (const uint16_t*) gamma;
+  const uint16_t* b = (const uint16_t*) beta;
+  uint16_t* o = (uint16_t*) output;
+
+  const float32x4_t vmean = vld1q_dup_f32(stats);
+  const float32x4_t vinv_stddev = vld1q_dup_f32(stats + 1);
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const float32x4_t vx0123 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))); i += 4;
+    const float32x4_t vx4567 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))); i += 4;
+    const float32x4_t vgamma0123 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(g))); g += 4;
+    const float32x4_t vgamma4567 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(g))); g += 4;
+    const float32x4_t vbeta0123 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(b))); b += 4;
+    const float32x4_t vbeta4567 = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(b))); b += 4;
+
+    const float32x4_t vy0123 = vmulq_f32(vsubq_f32(vx0123, vmean), vinv_stddev);
+    const float32x4_t vy4567 = vmulq_f32(vsubq_f32(vx4567, vmean), vinv_stddev);
+
+    const uint16x8_t vh01234567 = vreinterpretq_u16_f16(vcombine_f16(
+      vcvt_f16_f32(vmlaq_f32(vbeta0123, vy0123, vgamma0123)),
+      vcvt_f16_f32(vmlaq_f32(vbeta4567, vy4567, vgamma4567))));
+
+    vst1q_u16(o, vh01234567); o += 8;
+  }
+  for (; batch >= 4 * sizeof(uint16_t); batch -= 4 * sizeof(uint16_t)) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i))); i += 4;
+    const float32x4_t vgamma = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(g))); g += 4;
+    const float32x4_t vbeta = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(b))); b += 4;
+
+    const float32x4_t vy = vmulq_f32(vsubq_f32(vx, vmean), vinv_stddev);
+    vst1_u16(o, vreinterpret_u16_f16(vcvt_f16_f32(vmlaq_f32(vbeta, vy, vgamma)))); o += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(i)));
+    const float32x4_t vgamma = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(g)));
+    const float32x4_t vbeta = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(b)));
+
+    const float32x4_t vy = vmulq_f32(vsubq_f32(vx, vmean), vinv_stddev);
+    uint16x4_t vh = vreinterpret_u16_f16(vcvt_f16_f32(vmlaq_f32(vbeta, vy, vgamma)));
+    if (batch & (2 * sizeof(uint16_t))) {
+      vst1_lane_u32((void*) o, vreinterpret_u32_u16(vh), 0); o += 2;
+      vh = vext_u16(vh, vh, 2);
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      vst1_lane_u16(o, vh, 0);
+    }
+  }
+}
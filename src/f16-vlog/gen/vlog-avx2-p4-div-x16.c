@@ -0,0 +1,166 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vlog/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vlog_ukernel__avx2_p4_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_log_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch % sizeof(uint16_t) == 0);
+
+  const __m256i vsqrt_half = _mm256_load_si256((const __m256i*) params->avx2_p4.sqrt_half);
+  const __m256i vmantissa_mask = _mm256_load_si256((const __m256i*) params->avx2_p4.mantissa_mask);
+  const __m256 vone = _mm256_load_ps(params->avx2_p4.one);
+  const __m256 vtwo = _mm256_load_ps(params->avx2_p4.two);
+  const __m256 vhalf = _mm256_load_ps(params->avx2_p4.half);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_p4.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_p4.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_p4.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_p4.c1);
+  const __m256 vln2_hi = _mm256_load_ps(params->avx2_p4.ln2_hi);
+  const __m256 vln2_lo = _mm256_load_ps(params->avx2_p4.ln2_lo);
+  const __m256 vminus_inf = _mm256_load_ps(params->avx2_p4.minus_inf);
+  const __m256 vplus_inf = _mm256_load_ps(params->avx2_p4.plus_inf);
+  const __m256 vnan = _mm256_load_ps(params->avx2_p4.nan);
+  const __m256 vzero = _mm256_setzero_ps();
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    const __m256i vi0 = _mm256_sub_epi32(_mm256_castps_si256(vx0), vsqrt_half);
+    const __m256i vi1 = _mm256_sub_epi32(_mm256_castps_si256(vx1), vsqrt_half);
+
+    const __m256 ve0 = _mm256_cvtepi32_ps(_mm256_srai_epi32(vi0, 23));
+    const __m256 ve1 = _mm256_cvtepi32_ps(_mm256_srai_epi32(vi1, 23));
+
+    const __m256 vf0 = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi0, vmantissa_mask), vsqrt_half)), vone);
+    const __m256 vf1 = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi1, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m256 vs0 = _mm256_div_ps(vf0, _mm256_add_ps(vtwo, vf0));
+    const __m256 vs1 = _mm256_div_ps(vf1, _mm256_add_ps(vtwo, vf1));
+
+    const __m256 vz0 = _mm256_mul_ps(vs0, vs0);
+    const __m256 vz1 = _mm256_mul_ps(vs1, vs1);
+
+    const __m256 vw0 = _mm256_mul_ps(vz0, vz0);
+    const __m256 vw1 = _mm256_mul_ps(vz1, vz1);
+
+    const __m256 vr0 = _mm256_fmadd_ps(
+        vz0, _mm256_fmadd_ps(vw0, vc3, vc1),
+        _mm256_mul_ps(vw0, _mm256_fmadd_ps(vw0, vc4, vc2)));
+    const __m256 vr1 = _mm256_fmadd_ps(
+        vz1, _mm256_fmadd_ps(vw1, vc3, vc1),
+        _mm256_mul_ps(vw1, _mm256_fmadd_ps(vw1, vc4, vc2)));
+
+    const __m256 vhfsq0 = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf0), vf0);
+    const __m256 vhfsq1 = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf1), vf1);
+
+    __m256 vy0 = _mm256_fmadd_ps(vs0, _mm256_add_ps(vhfsq0, vr0), _mm256_mul_ps(ve0, vln2_lo));
+    __m256 vy1 = _mm256_fmadd_ps(vs1, _mm256_add_ps(vhfsq1, vr1), _mm256_mul_ps(ve1, vln2_lo));
+
+    vy0 = _mm256_add_ps(_mm256_sub_ps(vy0, vhfsq0), vf0);
+    vy1 = _mm256_add_ps(_mm256_sub_ps(vy1, vhfsq1), vf1);
+
+    vy0 = _mm256_fmadd_ps(ve0, vln2_hi, vy0);
+    vy1 = _mm256_fmadd_ps(ve1, vln2_hi, vy1);
+
+    vy0 = _mm256_blendv_ps(vy0, vnan, _mm256_cmp_ps(vx0, vzero, _CMP_NGT_UQ));
+    vy1 = _mm256_blendv_ps(vy1, vnan, _mm256_cmp_ps(vx1, vzero, _CMP_NGT_UQ));
+
+    vy0 = _mm256_blendv_ps(vy0, vminus_inf, _mm256_cmp_ps(vx0, vzero, _CMP_EQ_OQ));
+    vy1 = _mm256_blendv_ps(vy1, vminus_inf, _mm256_cmp_ps(vx1, vzero, _CMP_EQ_OQ));
+
+    vy0 = _mm256_blendv_ps(vy0, vplus_inf, _mm256_cmp_ps(vx0, vplus_inf, _CMP_EQ_OQ));
+    vy1 = _mm256_blendv_ps(vy1, vplus_inf, _mm256_cmp_ps(vx1, vplus_inf, _CMP_EQ_OQ));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_NO_EXC));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_NO_EXC));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    const __m256i vi = _mm256_sub_epi32(_mm256_castps_si256(vx), vsqrt_half);
+    const __m256 ve = _mm256_cvtepi32_ps(_mm256_srai_epi32(vi, 23));
+    const __m256 vf = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m256 vs = _mm256_div_ps(vf, _mm256_add_ps(vtwo, vf));
+    const __m256 vz = _mm256_mul_ps(vs, vs);
+    const __m256 vw = _mm256_mul_ps(vz, vz);
+    const __m256 vr = _mm256_fmadd_ps(
+        vz, _mm256_fmadd_ps(vw, vc3, vc1),
+        _mm256_mul_ps(vw, _mm256_fmadd_ps(vw, vc4, vc2)));
+    const __m256 vhfsq = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf), vf);
+
+    __m256 vy = _mm256_fmadd_ps(vs, _mm256_add_ps(vhfsq, vr), _mm256_mul_ps(ve, vln2_lo));
+    vy = _mm256_add_ps(_mm256_sub_ps(vy, vhfsq), vf);
+    vy = _mm256_fmadd_ps(ve, vln2_hi, vy);
+
+    vy = _mm256_blendv_ps(vy, vnan, _mm256_cmp_ps(vx, vzero, _CMP_NGT_UQ));
+    vy = _mm256_blendv_ps(vy, vminus_inf, _mm256_cmp_ps(vx, vzero, _CMP_EQ_OQ));
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vplus_inf, _CMP_EQ_OQ));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    const __m256i vi = _mm256_sub_epi32(_mm256_castps_si256(vx), vsqrt_half);
+    const __m256 ve = _mm256_cvtepi32_ps(_mm256_srai_epi32(vi, 23));
+    const __m256 vf = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m256 vs = _mm256_div_ps(vf, _mm256_add_ps(vtwo, vf));
+    const __m256 vz = _mm256_mul_ps(vs, vs);
+    const __m256 vw = _mm256_mul_ps(vz, vz);
+    const __m256 vr = _mm256_fmadd_ps(
+        vz, _mm256_fmadd_ps(vw, vc3, vc1),
+        _mm256_mul_ps(vw, _mm256_fmadd_ps(vw, vc4, vc2)));
+    const __m256 vhfsq = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf), vf);
+
+    __m256 vy = _mm256_fmadd_ps(vs, _mm256_add_ps(vhfsq, vr), _mm256_mul_ps(ve, vln2_lo));
+    vy = _mm256_add_ps(_mm256_sub_ps(vy, vhfsq), vf);
+    vy = _mm256_fmadd_ps(ve, vln2_hi, vy);
+
+    vy = _mm256_blendv_ps(vy, vnan, _mm256_cmp_ps(vx, vzero, _CMP_NGT_UQ));
+    vy = _mm256_blendv_ps(vy, vminus_inf, _mm256_cmp_ps(vx, vzero, _CMP_EQ_OQ));
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vplus_inf, _CMP_EQ_OQ));
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
@@ -0,0 +1,172 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vsilu/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vsilu_ukernel__avx2_rr1_p5_div_x16(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_silu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch % sizeof(uint16_t) == 0);
+
+  const __m256 vsign_mask = _mm256_load_ps(params->avx2_rr1_p5.sign_mask);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_rr1_p5.magic_bias);
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_rr1_p5.log2e);
+  const __m256 vminus_ln2 = _mm256_load_ps(params->avx2_rr1_p5.minus_ln2);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_rr1_p5.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_rr1_p5.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_rr1_p5.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_rr1_p5.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_rr1_p5.c1);
+  const __m256 vone = _mm256_load_ps(params->avx2_rr1_p5.one);
+  const __m256 vdenorm_cutoff = _mm256_load_ps(params->avx2_rr1_p5.denorm_cutoff);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 16 * sizeof(uint16_t); batch -= 16 * sizeof(uint16_t)) {
+    const __m256 vx0 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    const __m256 vx1 = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) (i + 8)));
+    i += 16;
+
+    const __m256 vz0 = _mm256_or_ps(vx0, vsign_mask);
+    const __m256 vz1 = _mm256_or_ps(vx1, vsign_mask);
+
+    __m256 vn0 = _mm256_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vz1, vlog2e, vmagic_bias);
+
+    const __m256 vs0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn0), 23));
+    const __m256 vs1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn1), 23));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2, vz0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2, vz1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+
+    const __m256 ve0 = _mm256_fmadd_ps(vt0, vp0, vs0);
+    const __m256 ve1 = _mm256_fmadd_ps(vt1, vp1, vs1);
+
+    const __m256 vd0 = _mm256_add_ps(ve0, vone);
+    const __m256 vd1 = _mm256_add_ps(ve1, vone);
+
+    __m256 vf0 = _mm256_div_ps(ve0, vd0);
+    __m256 vf1 = _mm256_div_ps(ve1, vd1);
+
+    vf0 = _mm256_andnot_ps(_mm256_cmp_ps(vz0, vdenorm_cutoff, _CMP_LT_OS), vf0);
+    vf1 = _mm256_andnot_ps(_mm256_cmp_ps(vz1, vdenorm_cutoff, _CMP_LT_OS), vf1);
+
+    vf0 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf0), vf0, vx0);
+    vf1 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf1), vf1, vx1);
+
+    const __m256 vy0 = _mm256_mul_ps(vx0, vf0);
+    const __m256 vy1 = _mm256_mul_ps(vx1, vf1);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy0, _MM_FROUND_NO_EXC));
+    _mm_storeu_si128((__m128i*) (o + 8), _mm256_cvtps_ph(vy1, _MM_FROUND_NO_EXC));
+    o += 16;
+  }
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+
+    const __m256 vd = _mm256_add_ps(ve, vone);
+    __m256 vf = _mm256_div_ps(ve, vd);
+
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    const __m256 vz = _mm256_or_ps(vx, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+
+    const __m256 vd = _mm256_add_ps(ve, vone);
+    __m256 vf = _mm256_div_ps(ve, vd);
+
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, vx);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
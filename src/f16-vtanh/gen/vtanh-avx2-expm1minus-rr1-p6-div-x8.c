@@ -0,0 +1,116 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f16-vtanh/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f16_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x8(
+    size_t batch,
+    const void* input,
+    void* output,
+    const union xnn_f16_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(batch % sizeof(uint16_t) == 0);
+
+  const __m256 vsign_mask = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sign_mask);
+  const __m256 vsat_cutoff = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sat_cutoff);
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.magic_bias);
+  const __m256 vminus_ln2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_ln2);
+  const __m256 vc6 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c6);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c2);
+  const __m256 vminus_two = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_two);
+  const __m256 vone = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.one);
+
+  const uint16_t* i = (const uint16_t*) input;
+  uint16_t* o = (uint16_t*) output;
+  for (; batch >= 8 * sizeof(uint16_t); batch -= 8 * sizeof(uint16_t)) {
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+    i += 8;
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vem1 = _mm256_add_ps(vp, vsm1);
+
+    const __m256 vd = _mm256_sub_ps(vminus_two, vem1);
+    const __m256 vabsy = _mm256_div_ps(vem1, vd);
+    const __m256 vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy), _mm256_and_ps(vsign_mask, vx));
+
+    _mm_storeu_si128((__m128i*) o, _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC));
+    o += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    assert(batch >= 1 * sizeof(uint16_t));
+    assert(batch <= 7 * sizeof(uint16_t));
+    const __m256 vx = _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) i));
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vem1 = _mm256_add_ps(vp, vsm1);
+
+    const __m256 vd = _mm256_sub_ps(vminus_two, vem1);
+    const __m256 vabsy = _mm256_div_ps(vem1, vd);
+    const __m256 vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy), _mm256_and_ps(vsign_mask, vx));
+
+    __m128i vh = _mm256_cvtps_ph(vy, _MM_FROUND_NO_EXC);
+    if (batch & (4 * sizeof(uint16_t))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (batch & (2 * sizeof(uint16_t))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (batch & (1 * sizeof(uint16_t))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
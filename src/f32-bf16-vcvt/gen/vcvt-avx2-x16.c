@@ -0,0 +1,104 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-bf16-vcvt/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_bf16_vcvt_ukernel__avx2_x16(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Rounding to nearest-even adds 0x7FFF plus the lowest retained bit to the FP32 bit representation, and keeps its
+  // upper half. NaNs are quieted instead of rounded, as rounding could turn them into infinities.
+  const __m256i vbias = _mm256_set1_epi32(0x7FFF);
+  const __m256i vone = _mm256_set1_epi32(1);
+  const __m256i vquiet = _mm256_set1_epi32(0x00400000);
+
+  uint16_t* o = (uint16_t*) output;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(input);
+    const __m256 vx1 = _mm256_loadu_ps(input + 8);
+    input += 16;
+
+    const __m256i vw0 = _mm256_castps_si256(vx0);
+    const __m256i vw1 = _mm256_castps_si256(vx1);
+
+    const __m256i vrounded0 = _mm256_add_epi32(_mm256_add_epi32(vw0, vbias), _mm256_and_si256(_mm256_srli_epi32(vw0, 16), vone));
+    const __m256i vrounded1 = _mm256_add_epi32(_mm256_add_epi32(vw1, vbias), _mm256_and_si256(_mm256_srli_epi32(vw1, 16), vone));
+
+    const __m256i vresult0 = _mm256_blendv_epi8(
+      vrounded0, _mm256_or_si256(vw0, vquiet), _mm256_castps_si256(_mm256_cmp_ps(vx0, vx0, _CMP_UNORD_Q)));
+    const __m256i vresult1 = _mm256_blendv_epi8(
+      vrounded1, _mm256_or_si256(vw1, vquiet), _mm256_castps_si256(_mm256_cmp_ps(vx1, vx1, _CMP_UNORD_Q)));
+
+    const __m256i vhw0 = _mm256_srai_epi32(vresult0, 16);
+    const __m256i vhw1 = _mm256_srai_epi32(vresult1, 16);
+
+    const __m128i vh0 = _mm_packs_epi32(_mm256_castsi256_si128(vhw0), _mm256_extracti128_si256(vhw0, 1));
+    const __m128i vh1 = _mm_packs_epi32(_mm256_castsi256_si128(vhw1), _mm256_extracti128_si256(vhw1, 1));
+
+    _mm_storeu_si128((__m128i*) o, vh0);
+    _mm_storeu_si128((__m128i*) (o + 8), vh1);
+    o += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(input);
+    input += 8;
+
+    const __m256i vw = _mm256_castps_si256(vx);
+    const __m256i vrounded = _mm256_add_epi32(_mm256_add_epi32(vw, vbias), _mm256_and_si256(_mm256_srli_epi32(vw, 16), vone));
+    const __m256i vresult = _mm256_blendv_epi8(
+      vrounded, _mm256_or_si256(vw, vquiet), _mm256_castps_si256(_mm256_cmp_ps(vx, vx, _CMP_UNORD_Q)));
+    const __m256i vhw = _mm256_srai_epi32(vresult, 16);
+    const __m128i vh = _mm_packs_epi32(_mm256_castsi256_si128(vhw), _mm256_extracti128_si256(vhw, 1));
+
+    _mm_storeu_si128((__m128i*) o, vh);
+    o += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m128 vx_lo = _mm_loadu_ps(input);
+    const float* input_hi = (const float*) ((uintptr_t) input + (n & (4 * sizeof(float))));
+    const __m256 vx = _mm256_insertf128_ps(_mm256_castps128_ps256(vx_lo), _mm_loadu_ps(input_hi), 1);
+
+    const __m256i vw = _mm256_castps_si256(vx);
+    const __m256i vrounded = _mm256_add_epi32(_mm256_add_epi32(vw, vbias), _mm256_and_si256(_mm256_srli_epi32(vw, 16), vone));
+    const __m256i vresult = _mm256_blendv_epi8(
+      vrounded, _mm256_or_si256(vw, vquiet), _mm256_castps_si256(_mm256_cmp_ps(vx, vx, _CMP_UNORD_Q)));
+    const __m256i vhw = _mm256_srai_epi32(vresult, 16);
+    __m128i vh = _mm_packs_epi32(_mm256_castsi256_si128(vhw), _mm256_extracti128_si256(vhw, 1));
+
+    if (n & (4 * sizeof(float))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      *o = (uint16_t) _mm_extract_epi16(vh, 0);
+    }
+  }
+}
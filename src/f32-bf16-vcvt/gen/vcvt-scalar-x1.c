@@ -0,0 +1,35 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-bf16-vcvt/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_bf16_vcvt_ukernel__scalar_x1(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  uint16_t* o = (uint16_t*) output;
+  do {
+    const float vx = *input++;
+    *o++ = math_cvt_bf16_fp32(vx);
+
+    n -= sizeof(float);
+  } while (n != 0);
+}
@@ -0,0 +1,50 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-bf16-vcvt/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_bf16_vcvt_ukernel__scalar_x4(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params)
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  uint16_t* o = (uint16_t*) output;
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    o[0] = math_cvt_bf16_fp32(vx0);
+    o[1] = math_cvt_bf16_fp32(vx1);
+    o[2] = math_cvt_bf16_fp32(vx2);
+    o[3] = math_cvt_bf16_fp32(vx3);
+    o += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = *input++;
+      *o++ = math_cvt_bf16_fp32(vx);
+
+      n -= sizeof(float);
+    } while (n != 0);
+  }
+}
@@ -0,0 +1,130 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-bf16-vcvt/sse2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vcvt.h>
+
+
+void xnn_f32_bf16_vcvt_ukernel__sse2_x16(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Rounding to nearest-even adds 0x7FFF plus the lowest retained bit to the FP32 bit representation, and keeps its
+  // upper half. NaNs are quieted instead of rounded, as rounding could turn them into infinities. The arithmetic shift
+  // sign-extends the upper halves, so the signed saturating pack preserves them exactly.
+  const __m128i vbias = _mm_set1_epi32(0x7FFF);
+  const __m128i vone = _mm_set1_epi32(1);
+  const __m128i vquiet = _mm_set1_epi32(0x00400000);
+
+  uint16_t* o = (uint16_t*) output;
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m128 vx0 = _mm_loadu_ps(input);
+    const __m128 vx1 = _mm_loadu_ps(input + 4);
+    const __m128 vx2 = _mm_loadu_ps(input + 8);
+    const __m128 vx3 = _mm_loadu_ps(input + 12);
+    input += 16;
+
+    const __m128i vw0 = _mm_castps_si128(vx0);
+    const __m128i vw1 = _mm_castps_si128(vx1);
+    const __m128i vw2 = _mm_castps_si128(vx2);
+    const __m128i vw3 = _mm_castps_si128(vx3);
+
+    const __m128i vnanmask0 = _mm_castps_si128(_mm_cmpunord_ps(vx0, vx0));
+    const __m128i vnanmask1 = _mm_castps_si128(_mm_cmpunord_ps(vx1, vx1));
+    const __m128i vnanmask2 = _mm_castps_si128(_mm_cmpunord_ps(vx2, vx2));
+    const __m128i vnanmask3 = _mm_castps_si128(_mm_cmpunord_ps(vx3, vx3));
+
+    const __m128i vrounded0 = _mm_add_epi32(_mm_add_epi32(vw0, vbias), _mm_and_si128(_mm_srli_epi32(vw0, 16), vone));
+    const __m128i vrounded1 = _mm_add_epi32(_mm_add_epi32(vw1, vbias), _mm_and_si128(_mm_srli_epi32(vw1, 16), vone));
+    const __m128i vrounded2 = _mm_add_epi32(_mm_add_epi32(vw2, vbias), _mm_and_si128(_mm_srli_epi32(vw2, 16), vone));
+    const __m128i vrounded3 = _mm_add_epi32(_mm_add_epi32(vw3, vbias), _mm_and_si128(_mm_srli_epi32(vw3, 16), vone));
+
+    const __m128i vresult0 = _mm_or_si128(
+      _mm_and_si128(vnanmask0, _mm_or_si128(vw0, vquiet)), _mm_andnot_si128(vnanmask0, vrounded0));
+    const __m128i vresult1 = _mm_or_si128(
+      _mm_and_si128(vnanmask1, _mm_or_si128(vw1, vquiet)), _mm_andnot_si128(vnanmask1, vrounded1));
+    const __m128i vresult2 = _mm_or_si128(
+      _mm_and_si128(vnanmask2, _mm_or_si128(vw2, vquiet)), _mm_andnot_si128(vnanmask2, vrounded2));
+    const __m128i vresult3 = _mm_or_si128(
+      _mm_and_si128(vnanmask3, _mm_or_si128(vw3, vquiet)), _mm_andnot_si128(vnanmask3, vrounded3));
+
+    const __m128i vh0 = _mm_packs_epi32(_mm_srai_epi32(vresult0, 16), _mm_srai_epi32(vresult1, 16));
+    const __m128i vh1 = _mm_packs_epi32(_mm_srai_epi32(vresult2, 16), _mm_srai_epi32(vresult3, 16));
+
+    _mm_storeu_si128((__m128i*) o, vh0);
+    _mm_storeu_si128((__m128i*) (o + 8), vh1);
+    o += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m128 vx_lo = _mm_loadu_ps(input);
+    const __m128 vx_hi = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    const __m128i vw_lo = _mm_castps_si128(vx_lo);
+    const __m128i vw_hi = _mm_castps_si128(vx_hi);
+    const __m128i vnanmask_lo = _mm_castps_si128(_mm_cmpunord_ps(vx_lo, vx_lo));
+    const __m128i vnanmask_hi = _mm_castps_si128(_mm_cmpunord_ps(vx_hi, vx_hi));
+    const __m128i vrounded_lo = _mm_add_epi32(_mm_add_epi32(vw_lo, vbias), _mm_and_si128(_mm_srli_epi32(vw_lo, 16), vone));
+    const __m128i vrounded_hi = _mm_add_epi32(_mm_add_epi32(vw_hi, vbias), _mm_and_si128(_mm_srli_epi32(vw_hi, 16), vone));
+    const __m128i vresult_lo = _mm_or_si128(
+      _mm_and_si128(vnanmask_lo, _mm_or_si128(vw_lo, vquiet)), _mm_andnot_si128(vnanmask_lo, vrounded_lo));
+    const __m128i vresult_hi = _mm_or_si128(
+      _mm_and_si128(vnanmask_hi, _mm_or_si128(vw_hi, vquiet)), _mm_andnot_si128(vnanmask_hi, vrounded_hi));
+
+    const __m128i vh = _mm_packs_epi32(_mm_srai_epi32(vresult_lo, 16), _mm_srai_epi32(vresult_hi, 16));
+
+    _mm_storeu_si128((__m128i*) o, vh);
+    o += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m128 vx_lo = _mm_loadu_ps(input);
+    const float* input_hi = (const float*) ((uintptr_t) input + (n & (4 * sizeof(float))));
+    const __m128 vx_hi = _mm_loadu_ps(input_hi);
+
+    const __m128i vw_lo = _mm_castps_si128(vx_lo);
+    const __m128i vw_hi = _mm_castps_si128(vx_hi);
+    const __m128i vnanmask_lo = _mm_castps_si128(_mm_cmpunord_ps(vx_lo, vx_lo));
+    const __m128i vnanmask_hi = _mm_castps_si128(_mm_cmpunord_ps(vx_hi, vx_hi));
+    const __m128i vrounded_lo = _mm_add_epi32(_mm_add_epi32(vw_lo, vbias), _mm_and_si128(_mm_srli_epi32(vw_lo, 16), vone));
+    const __m128i vrounded_hi = _mm_add_epi32(_mm_add_epi32(vw_hi, vbias), _mm_and_si128(_mm_srli_epi32(vw_hi, 16), vone));
+    const __m128i vresult_lo = _mm_or_si128(
+      _mm_and_si128(vnanmask_lo, _mm_or_si128(vw_lo, vquiet)), _mm_andnot_si128(vnanmask_lo, vrounded_lo));
+    const __m128i vresult_hi = _mm_or_si128(
+      _mm_and_si128(vnanmask_hi, _mm_or_si128(vw_hi, vquiet)), _mm_andnot_si128(vnanmask_hi, vrounded_hi));
+
+    __m128i vh = _mm_packs_epi32(_mm_srai_epi32(vresult_lo, 16), _mm_srai_epi32(vresult_hi, 16));
+
+    if (n & (4 * sizeof(float))) {
+      _mm_storel_epi64((__m128i*) o, vh);
+      vh = _mm_unpackhi_epi64(vh, vh);
+      o += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      *((uint32_t*) o) = (uint32_t) _mm_cvtsi128_si32(vh);
+      vh = _mm_srli_epi64(vh, 32);
+      o += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      *o = (uint16_t) _mm_cvtsi128_si32(vh);
+    }
+  }
+}
@@ -0,0 +1,138 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qc4w-gemm/avx2-broadcast.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+
+
+void xnn_f32_qc4w_gemm_minmax_ukernel_1x16__avx2_broadcast(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float*restrict a,
+    size_t a_stride,
+    const void*restrict w,
+    float*restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_qc4w_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  // Lookup table maps 4-bit weights to their values with the kernel zero point subtracted.
+  const __m128i vkernel_lut = _mm_load_si128((const __m128i*) params->avx.kernel_lut);
+  const __m128i vmask = _mm_set1_epi8(0x0F);
+  do {
+    __m256 vacc0x01234567 = _mm256_setzero_ps();
+    __m256 vacc0x89ABCDEF = _mm256_setzero_ps();
+
+    // Every byte of packed weights holds two consecutive elements along K of an output channel: the even element in
+    // the low nibble, and the odd element in the high nibble.
+    size_t k = kc;
+    for (; k >= 2 * sizeof(float); k -= 2 * sizeof(float)) {
+      const __m256 va0c0 = _mm256_broadcast_ss(a0);
+      const __m256 va0c1 = _mm256_broadcast_ss(a0 + 1);
+      a0 += 2;
+
+      const __m128i vbi = _mm_loadu_si128((const __m128i*) w);
+      w = (const uint8_t*) w + 16;
+      const __m128i vbc0 = _mm_shuffle_epi8(vkernel_lut, _mm_and_si128(vbi, vmask));
+      const __m128i vbc1 = _mm_shuffle_epi8(vkernel_lut, _mm_and_si128(_mm_srli_epi16(vbi, 4), vmask));
+      const __m256 vb01234567c0 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(vbc0));
+      const __m256 vb89ABCDEFc0 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_unpackhi_epi64(vbc0, vbc0)));
+      const __m256 vb01234567c1 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(vbc1));
+      const __m256 vb89ABCDEFc1 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_unpackhi_epi64(vbc1, vbc1)));
+
+      vacc0x01234567 = _mm256_fmadd_ps(va0c0, vb01234567c0, vacc0x01234567);
+      vacc0x89ABCDEF = _mm256_fmadd_ps(va0c0, vb89ABCDEFc0, vacc0x89ABCDEF);
+      vacc0x01234567 = _mm256_fmadd_ps(va0c1, vb01234567c1, vacc0x01234567);
+      vacc0x89ABCDEF = _mm256_fmadd_ps(va0c1, vb89ABCDEFc1, vacc0x89ABCDEF);
+    }
+    if XNN_UNLIKELY(k != 0) {
+      const __m256 va0 = _mm256_broadcast_ss(a0);
+      a0 += 1;
+
+      const __m128i vbi = _mm_loadu_si128((const __m128i*) w);
+      w = (const uint8_t*) w + 16;
+      const __m128i vb = _mm_shuffle_epi8(vkernel_lut, _mm_and_si128(vbi, vmask));
+      const __m256 vb01234567 = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(vb));
+      const __m256 vb89ABCDEF = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_unpackhi_epi64(vb, vb)));
+
+      vacc0x01234567 = _mm256_fmadd_ps(va0, vb01234567, vacc0x01234567);
+      vacc0x89ABCDEF = _mm256_fmadd_ps(va0, vb89ABCDEF, vacc0x89ABCDEF);
+    }
+
+    const __m256 vscale01234567 = _mm256_loadu_ps((const float*) w + 0);
+    const __m256 vscale89ABCDEF = _mm256_loadu_ps((const float*) w + 8);
+    const __m256 vbias01234567 = _mm256_loadu_ps((const float*) w + 16);
+    const __m256 vbias89ABCDEF = _mm256_loadu_ps((const float*) w + 24);
+    w = (const float*) w + 32;
+    vacc0x01234567 = _mm256_fmadd_ps(vacc0x01234567, vscale01234567, vbias01234567);
+    vacc0x89ABCDEF = _mm256_fmadd_ps(vacc0x89ABCDEF, vscale89ABCDEF, vbias89ABCDEF);
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vacc0x01234567 = _mm256_max_ps(vacc0x01234567, vmin);
+    vacc0x89ABCDEF = _mm256_max_ps(vacc0x89ABCDEF, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vacc0x01234567 = _mm256_min_ps(vacc0x01234567, vmax);
+    vacc0x89ABCDEF = _mm256_min_ps(vacc0x89ABCDEF, vmax);
+
+    if XNN_LIKELY(nc >= 16) {
+      _mm256_storeu_ps(c0, vacc0x01234567);
+      _mm256_storeu_ps(c0 + 8, vacc0x89ABCDEF);
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 16;
+    } else {
+      if (nc & 8) {
+        _mm256_storeu_ps(c0, vacc0x01234567);
+
+        vacc0x01234567 = vacc0x89ABCDEF;
+
+        c0 += 8;
+      }
+      __m128 vacc0x0123 = _mm256_castps256_ps128(vacc0x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c0, vacc0x0123);
+
+        vacc0x0123 = _mm256_extractf128_ps(vacc0x01234567, 1);
+
+        c0 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c0, vacc0x0123);
+
+        vacc0x0123 = _mm_movehl_ps(vacc0x0123, vacc0x0123);
+
+        c0 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c0, vacc0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
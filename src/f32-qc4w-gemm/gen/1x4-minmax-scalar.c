@@ -0,0 +1,149 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-qc4w-gemm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_f32_qc4w_gemm_minmax_ukernel_1x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const float* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_qc4w_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(kc % sizeof(float) == 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  const float* a0 = a;
+  float* c0 = c;
+
+  const int32_t vminus_kernel_zero_point = params->scalar.minus_kernel_zero_point;
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  do {
+    float vacc0x0 = 0.0f;
+    float vacc0x1 = 0.0f;
+    float vacc0x2 = 0.0f;
+    float vacc0x3 = 0.0f;
+
+    // Every byte of packed weights holds two consecutive elements along K of an output channel: the even element in
+    // the low nibble, and the odd element in the high nibble.
+    size_t k = kc;
+    for (; k >= 2 * sizeof(float); k -= 2 * sizeof(float)) {
+      const float va0c0 = a0[0];
+      const float va0c1 = a0[1];
+      a0 += 2;
+
+      const uint32_t vbi0 = (uint32_t) ((const uint8_t*) w)[0];
+      const uint32_t vbi1 = (uint32_t) ((const uint8_t*) w)[1];
+      const uint32_t vbi2 = (uint32_t) ((const uint8_t*) w)[2];
+      const uint32_t vbi3 = (uint32_t) ((const uint8_t*) w)[3];
+      w = (const uint8_t*) w + 4;
+      const float vb0c0 = (float) ((int32_t) (vbi0 & UINT32_C(0xF)) + vminus_kernel_zero_point);
+      const float vb0c1 = (float) ((int32_t) (vbi0 >> 4) + vminus_kernel_zero_point);
+      const float vb1c0 = (float) ((int32_t) (vbi1 & UINT32_C(0xF)) + vminus_kernel_zero_point);
+      const float vb1c1 = (float) ((int32_t) (vbi1 >> 4) + vminus_kernel_zero_point);
+      const float vb2c0 = (float) ((int32_t) (vbi2 & UINT32_C(0xF)) + vminus_kernel_zero_point);
+      const float vb2c1 = (float) ((int32_t) (vbi2 >> 4) + vminus_kernel_zero_point);
+      const float vb3c0 = (float) ((int32_t) (vbi3 & UINT32_C(0xF)) + vminus_kernel_zero_point);
+      const float vb3c1 = (float) ((int32_t) (vbi3 >> 4) + vminus_kernel_zero_point);
+
+      vacc0x0 = math_muladd_f32(va0c0, vb0c0, vacc0x0);
+      vacc0x1 = math_muladd_f32(va0c0, vb1c0, vacc0x1);
+      vacc0x2 = math_muladd_f32(va0c0, vb2c0, vacc0x2);
+      vacc0x3 = math_muladd_f32(va0c0, vb3c0, vacc0x3);
+      vacc0x0 = math_muladd_f32(va0c1, vb0c1, vacc0x0);
+      vacc0x1 = math_muladd_f32(va0c1, vb1c1, vacc0x1);
+      vacc0x2 = math_muladd_f32(va0c1, vb2c1, vacc0x2);
+      vacc0x3 = math_muladd_f32(va0c1, vb3c1, vacc0x3);
+    }
+    if XNN_UNLIKELY(k != 0) {
+      const float va0 = *a0++;
+
+      const float vb0 = (float) ((int32_t) (((const uint8_t*) w)[0] & UINT8_C(0xF)) + vminus_kernel_zero_point);
+      const float vb1 = (float) ((int32_t) (((const uint8_t*) w)[1] & UINT8_C(0xF)) + vminus_kernel_zero_point);
+      const float vb2 = (float) ((int32_t) (((const uint8_t*) w)[2] & UINT8_C(0xF)) + vminus_kernel_zero_point);
+      const float vb3 = (float) ((int32_t) (((const uint8_t*) w)[3] & UINT8_C(0xF)) + vminus_kernel_zero_point);
+      w = (const uint8_t*) w + 4;
+
+      vacc0x0 = math_muladd_f32(va0, vb0, vacc0x0);
+      vacc0x1 = math_muladd_f32(va0, vb1, vacc0x1);
+      vacc0x2 = math_muladd_f32(va0, vb2, vacc0x2);
+      vacc0x3 = math_muladd_f32(va0, vb3, vacc0x3);
+    }
+
+    const float vscale0 = ((const float*) w)[0];
+    const float vscale1 = ((const float*) w)[1];
+    const float vscale2 = ((const float*) w)[2];
+    const float vscale3 = ((const float*) w)[3];
+    vacc0x0 *= vscale0;
+    vacc0x1 *= vscale1;
+    vacc0x2 *= vscale2;
+    vacc0x3 *= vscale3;
+    w = (const float*) w + 4;
+
+    const float vbias0 = ((const float*) w)[0];
+    const float vbias1 = ((const float*) w)[1];
+    const float vbias2 = ((const float*) w)[2];
+    const float vbias3 = ((const float*) w)[3];
+    vacc0x0 += vbias0;
+    vacc0x1 += vbias1;
+    vacc0x2 += vbias2;
+    vacc0x3 += vbias3;
+    w = (const float*) w + 4;
+
+    vacc0x0 = math_max_f32(vacc0x0, vmin);
+    vacc0x1 = math_max_f32(vacc0x1, vmin);
+    vacc0x2 = math_max_f32(vacc0x2, vmin);
+    vacc0x3 = math_max_f32(vacc0x3, vmin);
+
+    vacc0x0 = math_min_f32(vacc0x0, vmax);
+    vacc0x1 = math_min_f32(vacc0x1, vmax);
+    vacc0x2 = math_min_f32(vacc0x2, vmax);
+    vacc0x3 = math_min_f32(vacc0x3, vmax);
+
+    if XNN_LIKELY(nc >= 4) {
+      c0[0] = vacc0x0;
+      c0[1] = vacc0x1;
+      c0[2] = vacc0x2;
+      c0[3] = vacc0x3;
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      a0 = (const float*) ((uintptr_t) a0 - kc);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c0[0] = vacc0x0;
+        c0[1] = vacc0x1;
+        vacc0x0 = vacc0x2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c0[0] = vacc0x0;
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
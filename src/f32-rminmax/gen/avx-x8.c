@@ -0,0 +1,55 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rminmax/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rminmax_ukernel__avx_x8(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  __m256 vmin0 = _mm256_broadcast_ss(input);
+  __m256 vmax0 = vmin0;
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vt0 = _mm256_loadu_ps(input);
+    input += 8;
+
+    vmin0 = _mm256_min_ps(vmin0, vt0);
+    vmax0 = _mm256_max_ps(vmax0, vt0);
+  }
+  __m128 vmin = _mm_min_ps(_mm256_castps256_ps128(vmin0), _mm256_extractf128_ps(vmin0, 1));
+  __m128 vmax = _mm_max_ps(_mm256_castps256_ps128(vmax0), _mm256_extractf128_ps(vmax0, 1));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vt = _mm_load_ss(input);
+      input += 1;
+
+      vmin = _mm_min_ss(vmin, vt);
+      vmax = _mm_max_ss(vmax, vt);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+  vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+  vmin = _mm_min_ss(vmin, _mm_movehdup_ps(vmin));
+  vmax = _mm_max_ss(vmax, _mm_movehdup_ps(vmax));
+  _mm_store_ss(output, vmin);
+  _mm_store_ss(output + 1, vmax);
+}
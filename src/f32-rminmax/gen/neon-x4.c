@@ -0,0 +1,51 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rminmax/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rminmax_ukernel__neon_x4(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float32x4_t vmin0 = vld1q_dup_f32(input);
+  float32x4_t vmax0 = vmin0;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vt0 = vld1q_f32(input); input += 4;
+
+    vmin0 = vminq_f32(vmin0, vt0);
+    vmax0 = vmaxq_f32(vmax0, vt0);
+  }
+  float32x2_t vmin = vmin_f32(vget_low_f32(vmin0), vget_high_f32(vmin0));
+  float32x2_t vmax = vmax_f32(vget_low_f32(vmax0), vget_high_f32(vmax0));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float32x2_t vt = vld1_dup_f32(input); input += 1;
+
+      vmin = vmin_f32(vmin, vt);
+      vmax = vmax_f32(vmax, vt);
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vmin = vpmin_f32(vmin, vmin);
+  vmax = vpmax_f32(vmax, vmax);
+  vst1_lane_f32(output, vmin, 0);
+  vst1_lane_f32(output + 1, vmax, 0);
+}
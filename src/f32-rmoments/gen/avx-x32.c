@@ -0,0 +1,90 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rmoments/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rmoments_ukernel__avx_x32(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Deviations are accumulated around the first element to avoid catastrophic cancellation in the variance.
+  const __m256 vshift = _mm256_broadcast_ss(input);
+  const float vscale = 1.0f / (float) (batch / sizeof(float));
+  __m256 vsum0 = _mm256_setzero_ps();
+  __m256 vsum1 = _mm256_setzero_ps();
+  __m256 vsum2 = _mm256_setzero_ps();
+  __m256 vsum3 = _mm256_setzero_ps();
+  __m256 vsumsq0 = _mm256_setzero_ps();
+  __m256 vsumsq1 = _mm256_setzero_ps();
+  __m256 vsumsq2 = _mm256_setzero_ps();
+  __m256 vsumsq3 = _mm256_setzero_ps();
+  for (; batch >= 32 * sizeof(float); batch -= 32 * sizeof(float)) {
+    const __m256 vt0 = _mm256_sub_ps(_mm256_loadu_ps(input), vshift);
+    const __m256 vt1 = _mm256_sub_ps(_mm256_loadu_ps(input + 8), vshift);
+    const __m256 vt2 = _mm256_sub_ps(_mm256_loadu_ps(input + 16), vshift);
+    const __m256 vt3 = _mm256_sub_ps(_mm256_loadu_ps(input + 24), vshift);
+    input += 32;
+
+    vsum0 = _mm256_add_ps(vsum0, vt0);
+    vsum1 = _mm256_add_ps(vsum1, vt1);
+    vsum2 = _mm256_add_ps(vsum2, vt2);
+    vsum3 = _mm256_add_ps(vsum3, vt3);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vt0, vt0));
+    vsumsq1 = _mm256_add_ps(vsumsq1, _mm256_mul_ps(vt1, vt1));
+    vsumsq2 = _mm256_add_ps(vsumsq2, _mm256_mul_ps(vt2, vt2));
+    vsumsq3 = _mm256_add_ps(vsumsq3, _mm256_mul_ps(vt3, vt3));
+  }
+  vsum0 = _mm256_add_ps(vsum0, vsum1);
+  vsumsq0 = _mm256_add_ps(vsumsq0, vsumsq1);
+  vsum2 = _mm256_add_ps(vsum2, vsum3);
+  vsumsq2 = _mm256_add_ps(vsumsq2, vsumsq3);
+  vsum0 = _mm256_add_ps(vsum0, vsum2);
+  vsumsq0 = _mm256_add_ps(vsumsq0, vsumsq2);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vt = _mm256_sub_ps(_mm256_loadu_ps(input), vshift);
+    input += 8;
+
+    vsum0 = _mm256_add_ps(vsum0, vt);
+    vsumsq0 = _mm256_add_ps(vsumsq0, _mm256_mul_ps(vt, vt));
+  }
+  const __m128 vshift_lo = _mm256_castps256_ps128(vshift);
+  __m128 vsum = _mm_add_ps(_mm256_castps256_ps128(vsum0), _mm256_extractf128_ps(vsum0, 1));
+  __m128 vsumsq = _mm_add_ps(_mm256_castps256_ps128(vsumsq0), _mm256_extractf128_ps(vsumsq0, 1));
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vt = _mm_sub_ss(_mm_load_ss(input), vshift_lo);
+      input += 1;
+
+      vsum = _mm_add_ss(vsum, vt);
+      vsumsq = _mm_add_ss(vsumsq, _mm_mul_ss(vt, vt));
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vsum = _mm_add_ps(vsum, _mm_movehl_ps(vsum, vsum));
+  vsumsq = _mm_add_ps(vsumsq, _mm_movehl_ps(vsumsq, vsumsq));
+  vsum = _mm_add_ss(vsum, _mm_movehdup_ps(vsum));
+  vsumsq = _mm_add_ss(vsumsq, _mm_movehdup_ps(vsumsq));
+
+  const float vmean = _mm_cvtss_f32(vsum) * vscale;
+  output[0] = _mm_cvtss_f32(vshift_lo) + vmean;
+  output[1] = math_max_f32(_mm_cvtss_f32(vsumsq) * vscale - vmean * vmean, 0.0f);
+}
@@ -0,0 +1,86 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rmoments/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rmoments_ukernel__neon_x16(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Deviations are accumulated around the first element to avoid catastrophic cancellation in the variance.
+  const float32x4_t vshift = vld1q_dup_f32(input);
+  const float vscale = 1.0f / (float) (batch / sizeof(float));
+  float32x4_t vsum0 = vmovq_n_f32(0.0f);
+  float32x4_t vsum1 = vmovq_n_f32(0.0f);
+  float32x4_t vsum2 = vmovq_n_f32(0.0f);
+  float32x4_t vsum3 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq0 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq1 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq2 = vmovq_n_f32(0.0f);
+  float32x4_t vsumsq3 = vmovq_n_f32(0.0f);
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const float32x4_t vt0 = vsubq_f32(vld1q_f32(input), vshift); input += 4;
+    const float32x4_t vt1 = vsubq_f32(vld1q_f32(input), vshift); input += 4;
+    const float32x4_t vt2 = vsubq_f32(vld1q_f32(input), vshift); input += 4;
+    const float32x4_t vt3 = vsubq_f32(vld1q_f32(input), vshift); input += 4;
+
+    vsum0 = vaddq_f32(vsum0, vt0);
+    vsum1 = vaddq_f32(vsum1, vt1);
+    vsum2 = vaddq_f32(vsum2, vt2);
+    vsum3 = vaddq_f32(vsum3, vt3);
+    vsumsq0 = vmlaq_f32(vsumsq0, vt0, vt0);
+    vsumsq1 = vmlaq_f32(vsumsq1, vt1, vt1);
+    vsumsq2 = vmlaq_f32(vsumsq2, vt2, vt2);
+    vsumsq3 = vmlaq_f32(vsumsq3, vt3, vt3);
+  }
+  vsum0 = vaddq_f32(vsum0, vsum1);
+  vsumsq0 = vaddq_f32(vsumsq0, vsumsq1);
+  vsum2 = vaddq_f32(vsum2, vsum3);
+  vsumsq2 = vaddq_f32(vsumsq2, vsumsq3);
+  vsum0 = vaddq_f32(vsum0, vsum2);
+  vsumsq0 = vaddq_f32(vsumsq0, vsumsq2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vt = vsubq_f32(vld1q_f32(input), vshift); input += 4;
+
+    vsum0 = vaddq_f32(vsum0, vt);
+    vsumsq0 = vmlaq_f32(vsumsq0, vt, vt);
+  }
+  const float32x2_t vshift_lo = vget_low_f32(vshift);
+  float32x2_t vsum = vadd_f32(vget_low_f32(vsum0), vget_high_f32(vsum0));
+  float32x2_t vsumsq = vadd_f32(vget_low_f32(vsumsq0), vget_high_f32(vsumsq0));
+  if XNN_UNLIKELY(batch & (2 * sizeof(float))) {
+    const float32x2_t vt = vsub_f32(vld1_f32(input), vshift_lo); input += 2;
+    vsum = vadd_f32(vsum, vt);
+    vsumsq = vmla_f32(vsumsq, vt, vt);
+  }
+  vsum = vpadd_f32(vsum, vsum);
+  vsumsq = vpadd_f32(vsumsq, vsumsq);
+  if XNN_UNLIKELY(batch & (1 * sizeof(float))) {
+    const float32x2_t vt = vsub_f32(vld1_dup_f32(input), vshift_lo);
+    vsum = vadd_f32(vsum, vt);
+    vsumsq = vmla_f32(vsumsq, vt, vt);
+  }
+
+  const float vmean = vget_lane_f32(vsum, 0) * vscale;
+  output[0] = vget_lane_f32(vshift_lo, 0) + vmean;
+  output[1] = math_max_f32(vget_lane_f32(vsumsq, 0) * vscale - vmean * vmean, 0.0f);
+}
@@ -0,0 +1,41 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rmoments/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rmoments_ukernel__scalar_x1(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Deviations are accumulated around the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = *input;
+  const float vscale = 1.0f / (float) (batch / sizeof(float));
+  float vsum0 = 0.0f;
+  float vsumsq0 = 0.0f;
+  do {
+    const float vt = *input++ - vshift;
+    vsum0 += vt;
+    vsumsq0 += vt * vt;
+    batch -= sizeof(float);
+  } while (batch != 0);
+  const float vmean = vsum0 * vscale;
+  output[0] = vshift + vmean;
+  output[1] = math_max_f32(vsumsq0 * vscale - vmean * vmean, 0.0f);
+}
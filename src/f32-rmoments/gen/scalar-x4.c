@@ -0,0 +1,72 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rmoments/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rmoments_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Deviations are accumulated around the first element to avoid catastrophic cancellation in the variance.
+  const float vshift = *input;
+  const float vscale = 1.0f / (float) (batch / sizeof(float));
+  float vsum0 = 0.0f;
+  float vsum1 = 0.0f;
+  float vsum2 = 0.0f;
+  float vsum3 = 0.0f;
+  float vsumsq0 = 0.0f;
+  float vsumsq1 = 0.0f;
+  float vsumsq2 = 0.0f;
+  float vsumsq3 = 0.0f;
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vt0 = input[0] - vshift;
+    const float vt1 = input[1] - vshift;
+    const float vt2 = input[2] - vshift;
+    const float vt3 = input[3] - vshift;
+    input += 4;
+
+    vsum0 += vt0;
+    vsum1 += vt1;
+    vsum2 += vt2;
+    vsum3 += vt3;
+    vsumsq0 += vt0 * vt0;
+    vsumsq1 += vt1 * vt1;
+    vsumsq2 += vt2 * vt2;
+    vsumsq3 += vt3 * vt3;
+  }
+  vsum0 += vsum1;
+  vsumsq0 += vsumsq1;
+  vsum2 += vsum3;
+  vsumsq2 += vsumsq3;
+  vsum0 += vsum2;
+  vsumsq0 += vsumsq2;
+
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vt = *input++ - vshift;
+      vsum0 += vt;
+      vsumsq0 += vt * vt;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  const float vmean = vsum0 * vscale;
+  output[0] = vshift + vmean;
+  output[1] = math_max_f32(vsumsq0 * vscale - vmean * vmean, 0.0f);
+}
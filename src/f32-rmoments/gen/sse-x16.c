@@ -0,0 +1,87 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rmoments/sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rmoments_ukernel__sse_x16(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Deviations are accumulated around the first element to avoid catastrophic cancellation in the variance.
+  const __m128 vshift = _mm_load1_ps(input);
+  const float vscale = 1.0f / (float) (batch / sizeof(float));
+  __m128 vsum0 = _mm_setzero_ps();
+  __m128 vsum1 = _mm_setzero_ps();
+  __m128 vsum2 = _mm_setzero_ps();
+  __m128 vsum3 = _mm_setzero_ps();
+  __m128 vsumsq0 = _mm_setzero_ps();
+  __m128 vsumsq1 = _mm_setzero_ps();
+  __m128 vsumsq2 = _mm_setzero_ps();
+  __m128 vsumsq3 = _mm_setzero_ps();
+  for (; batch >= 16 * sizeof(float); batch -= 16 * sizeof(float)) {
+    const __m128 vt0 = _mm_sub_ps(_mm_loadu_ps(input), vshift);
+    const __m128 vt1 = _mm_sub_ps(_mm_loadu_ps(input + 4), vshift);
+    const __m128 vt2 = _mm_sub_ps(_mm_loadu_ps(input + 8), vshift);
+    const __m128 vt3 = _mm_sub_ps(_mm_loadu_ps(input + 12), vshift);
+    input += 16;
+
+    vsum0 = _mm_add_ps(vsum0, vt0);
+    vsum1 = _mm_add_ps(vsum1, vt1);
+    vsum2 = _mm_add_ps(vsum2, vt2);
+    vsum3 = _mm_add_ps(vsum3, vt3);
+    vsumsq0 = _mm_add_ps(vsumsq0, _mm_mul_ps(vt0, vt0));
+    vsumsq1 = _mm_add_ps(vsumsq1, _mm_mul_ps(vt1, vt1));
+    vsumsq2 = _mm_add_ps(vsumsq2, _mm_mul_ps(vt2, vt2));
+    vsumsq3 = _mm_add_ps(vsumsq3, _mm_mul_ps(vt3, vt3));
+  }
+  vsum0 = _mm_add_ps(vsum0, vsum1);
+  vsumsq0 = _mm_add_ps(vsumsq0, vsumsq1);
+  vsum2 = _mm_add_ps(vsum2, vsum3);
+  vsumsq2 = _mm_add_ps(vsumsq2, vsumsq3);
+  vsum0 = _mm_add_ps(vsum0, vsum2);
+  vsumsq0 = _mm_add_ps(vsumsq0, vsumsq2);
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vt = _mm_sub_ps(_mm_loadu_ps(input), vshift);
+    input += 4;
+
+    vsum0 = _mm_add_ps(vsum0, vt);
+    vsumsq0 = _mm_add_ps(vsumsq0, _mm_mul_ps(vt, vt));
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const __m128 vt = _mm_sub_ss(_mm_load_ss(input), vshift);
+      input += 1;
+
+      vsum0 = _mm_add_ss(vsum0, vt);
+      vsumsq0 = _mm_add_ss(vsumsq0, _mm_mul_ss(vt, vt));
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+  vsum0 = _mm_add_ps(vsum0, _mm_movehl_ps(vsum0, vsum0));
+  vsumsq0 = _mm_add_ps(vsumsq0, _mm_movehl_ps(vsumsq0, vsumsq0));
+  vsum0 = _mm_add_ss(vsum0, _mm_shuffle_ps(vsum0, vsum0, _MM_SHUFFLE(1, 1, 1, 1)));
+  vsumsq0 = _mm_add_ss(vsumsq0, _mm_shuffle_ps(vsumsq0, vsumsq0, _MM_SHUFFLE(1, 1, 1, 1)));
+
+  const float vmean = _mm_cvtss_f32(vsum0) * vscale;
+  output[0] = _mm_cvtss_f32(vshift) + vmean;
+  output[1] = math_max_f32(_mm_cvtss_f32(vsumsq0) * vscale - vmean * vmean, 0.0f);
+}
@@ -0,0 +1,33 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-rsum/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_f32_rsum_ukernel__scalar_x1(
+    size_t batch,
+    const float* input,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  float vacc0 = 0.0f;
+  do {
+    const float vt = *input++;
+    vacc0 += vt;
+    batch -= sizeof(float);
+  } while (batch != 0);
+  *output = vacc0;
+}
@@ -0,0 +1,188 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vexp/avx2-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vexp_ukernel__avx2_rr2_p5_x16(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_rr2_p5.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_rr2_p5.magic_bias);
+  const __m256 vminus_ln2_hi = _mm256_load_ps(params->avx2_rr2_p5.minus_ln2_hi);
+  const __m256 vminus_ln2_lo = _mm256_load_ps(params->avx2_rr2_p5.minus_ln2_lo);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_rr2_p5.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_rr2_p5.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_rr2_p5.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_rr2_p5.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_rr2_p5.c1);
+  const __m256i vmin_exponent = _mm256_load_si256((const __m256i*) params->avx2_rr2_p5.min_exponent);
+  const __m256i vmax_exponent = _mm256_load_si256((const __m256i*) params->avx2_rr2_p5.max_exponent);
+  const __m256 vzero_cutoff = _mm256_load_ps(params->avx2_rr2_p5.zero_cutoff);
+  const __m256 vinf_cutoff = _mm256_load_ps(params->avx2_rr2_p5.inf_cutoff);
+  const __m256 vplus_inf = _mm256_load_ps(params->avx2_rr2_p5.plus_inf);
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    x += 16;
+
+    __m256 vn0 = _mm256_fmadd_ps(vx0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vx1, vlog2e, vmagic_bias);
+
+    __m256i veo0 = _mm256_slli_epi32(_mm256_castps_si256(vn0), 23);
+    __m256i veo1 = _mm256_slli_epi32(_mm256_castps_si256(vn1), 23);
+
+    __m256i ven0 = _mm256_max_epi32(veo0, vmin_exponent);
+    __m256i ven1 = _mm256_max_epi32(veo1, vmin_exponent);
+
+    ven0 = _mm256_min_epi32(ven0, vmax_exponent);
+    ven1 = _mm256_min_epi32(ven1, vmax_exponent);
+
+    veo0 = _mm256_sub_epi32(veo0, ven0);
+    veo1 = _mm256_sub_epi32(veo1, ven1);
+
+    const __m256 vsn0 = _mm256_castsi256_ps(_mm256_add_epi32(ven0, vmax_exponent));
+    const __m256 vsn1 = _mm256_castsi256_ps(_mm256_add_epi32(ven1, vmax_exponent));
+
+    const __m256 vso0 = _mm256_castsi256_ps(_mm256_add_epi32(veo0, vmax_exponent));
+    const __m256 vso1 = _mm256_castsi256_ps(_mm256_add_epi32(veo1, vmax_exponent));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_hi, vx0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_hi, vx1);
+
+    vt0 = _mm256_fmadd_ps(vn0, vminus_ln2_lo, vt0);
+    vt1 = _mm256_fmadd_ps(vn1, vminus_ln2_lo, vt1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vso0);
+    vt1 = _mm256_mul_ps(vt1, vso1);
+
+    __m256 vy0 = _mm256_mul_ps(vsn0, _mm256_fmadd_ps(vt0, vp0, vso0));
+    __m256 vy1 = _mm256_mul_ps(vsn1, _mm256_fmadd_ps(vt1, vp1, vso1));
+
+    vy0 = _mm256_andnot_ps(_mm256_cmp_ps(vx0, vzero_cutoff, _CMP_LT_OS), vy0);
+    vy1 = _mm256_andnot_ps(_mm256_cmp_ps(vx1, vzero_cutoff, _CMP_LT_OS), vy1);
+
+    const __m256 vm0 = _mm256_cmp_ps(vx0, vinf_cutoff, _CMP_GT_OS);
+    const __m256 vm1 = _mm256_cmp_ps(vx1, vinf_cutoff, _CMP_GT_OS);
+
+    vy0 = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm0), _mm256_andnot_ps(vm0, vy0));
+    vy1 = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm1), _mm256_andnot_ps(vm1, vy1));
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vmax_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vmax_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    const __m256 vm = _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS);
+    vy = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm), _mm256_andnot_ps(vm, vy));
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx2_rr2_p5.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    __m256 vn = _mm256_fmadd_ps(vx, vlog2e, vmagic_bias);
+
+    __m256i veo = _mm256_slli_epi32(_mm256_castps_si256(vn), 23);
+    __m256i ven = _mm256_max_epi32(veo, vmin_exponent);
+    ven = _mm256_min_epi32(ven, vmax_exponent);
+    veo = _mm256_sub_epi32(veo, ven);
+    const __m256 vsn = _mm256_castsi256_ps(_mm256_add_epi32(ven, vmax_exponent));
+    const __m256 vso = _mm256_castsi256_ps(_mm256_add_epi32(veo, vmax_exponent));
+
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2_hi, vx);
+    vt = _mm256_fmadd_ps(vn, vminus_ln2_lo, vt);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vso);
+    __m256 vy = _mm256_mul_ps(vsn, _mm256_fmadd_ps(vt, vp, vso));
+
+    vy = _mm256_andnot_ps(_mm256_cmp_ps(vx, vzero_cutoff, _CMP_LT_OS), vy);
+    const __m256 vm = _mm256_cmp_ps(vx, vinf_cutoff, _CMP_GT_OS);
+    vy = _mm256_or_ps(_mm256_and_ps(vplus_inf, vm), _mm256_andnot_ps(vm, vy));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
@@ -0,0 +1,159 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vexp/neon-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vexp_ukernel__neon_rr2_p5_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const float32x4_t vlog2e = vld1q_dup_f32(&params->neon_rr2_p5.log2e);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neon_rr2_p5.magic_bias);
+  const float32x4_t vminus_ln2_hi = vld1q_dup_f32(&params->neon_rr2_p5.minus_ln2_hi);
+  const float32x4_t vminus_ln2_lo = vld1q_dup_f32(&params->neon_rr2_p5.minus_ln2_lo);
+  const float32x4_t vc5 = vld1q_dup_f32(&params->neon_rr2_p5.c5);
+  const float32x4_t vc4 = vld1q_dup_f32(&params->neon_rr2_p5.c4);
+  const float32x4_t vc3 = vld1q_dup_f32(&params->neon_rr2_p5.c3);
+  const float32x4_t vc2 = vld1q_dup_f32(&params->neon_rr2_p5.c2);
+  const float32x4_t vc1 = vld1q_dup_f32(&params->neon_rr2_p5.c1);
+  const int32x4_t vmin_exponent = vld1q_dup_s32(&params->neon_rr2_p5.min_exponent);
+  const int32x4_t vmax_exponent = vld1q_dup_s32(&params->neon_rr2_p5.max_exponent);
+  const float32x4_t vzero_cutoff = vld1q_dup_f32(&params->neon_rr2_p5.zero_cutoff);
+  const float32x4_t vinf_cutoff = vld1q_dup_f32(&params->neon_rr2_p5.inf_cutoff);
+  const float32x4_t vplus_inf = vmovq_n_f32(INFINITY);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(x); x += 4;
+    const float32x4_t vx4567 = vld1q_f32(x); x += 4;
+
+    float32x4_t vn0123 = vmlaq_f32(vmagic_bias, vx0123, vlog2e);
+    float32x4_t vn4567 = vmlaq_f32(vmagic_bias, vx4567, vlog2e);
+
+    int32x4_t veo0123 = vshlq_n_s32(vreinterpretq_s32_f32(vn0123), 23);
+    int32x4_t veo4567 = vshlq_n_s32(vreinterpretq_s32_f32(vn4567), 23);
+
+    const int32x4_t ven0123 = vminq_s32(vmaxq_s32(veo0123, vmin_exponent), vmax_exponent);
+    const int32x4_t ven4567 = vminq_s32(vmaxq_s32(veo4567, vmin_exponent), vmax_exponent);
+
+    veo0123 = vsubq_s32(veo0123, ven0123);
+    veo4567 = vsubq_s32(veo4567, ven4567);
+
+    const float32x4_t vsn0123 = vreinterpretq_f32_s32(vaddq_s32(ven0123, vmax_exponent));
+    const float32x4_t vsn4567 = vreinterpretq_f32_s32(vaddq_s32(ven4567, vmax_exponent));
+
+    const float32x4_t vso0123 = vreinterpretq_f32_s32(vaddq_s32(veo0123, vmax_exponent));
+    const float32x4_t vso4567 = vreinterpretq_f32_s32(vaddq_s32(veo4567, vmax_exponent));
+
+    vn0123 = vsubq_f32(vn0123, vmagic_bias);
+    vn4567 = vsubq_f32(vn4567, vmagic_bias);
+
+    float32x4_t vt0123 = vmlaq_f32(vx0123, vn0123, vminus_ln2_hi);
+    float32x4_t vt4567 = vmlaq_f32(vx4567, vn4567, vminus_ln2_hi);
+
+    vt0123 = vmlaq_f32(vt0123, vn0123, vminus_ln2_lo);
+    vt4567 = vmlaq_f32(vt4567, vn4567, vminus_ln2_lo);
+
+    float32x4_t vp0123 = vmlaq_f32(vc4, vc5, vt0123);
+    float32x4_t vp4567 = vmlaq_f32(vc4, vc5, vt4567);
+
+    vp0123 = vmlaq_f32(vc3, vp0123, vt0123);
+    vp4567 = vmlaq_f32(vc3, vp4567, vt4567);
+
+    vp0123 = vmlaq_f32(vc2, vp0123, vt0123);
+    vp4567 = vmlaq_f32(vc2, vp4567, vt4567);
+
+    vp0123 = vmlaq_f32(vc1, vp0123, vt0123);
+    vp4567 = vmlaq_f32(vc1, vp4567, vt4567);
+
+    vt0123 = vmulq_f32(vt0123, vso0123);
+    vt4567 = vmulq_f32(vt4567, vso4567);
+
+    float32x4_t vy0123 = vmulq_f32(vsn0123, vmlaq_f32(vso0123, vt0123, vp0123));
+    float32x4_t vy4567 = vmulq_f32(vsn4567, vmlaq_f32(vso4567, vt4567, vp4567));
+
+    vy0123 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy0123), vcltq_f32(vx0123, vzero_cutoff)));
+    vy4567 = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy4567), vcltq_f32(vx4567, vzero_cutoff)));
+
+    vy0123 = vbslq_f32(vcgtq_f32(vx0123, vinf_cutoff), vplus_inf, vy0123);
+    vy4567 = vbslq_f32(vcgtq_f32(vx4567, vinf_cutoff), vplus_inf, vy4567);
+
+    vst1q_f32(y, vy0123); y += 4;
+    vst1q_f32(y, vy4567); y += 4;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vx, vlog2e);
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    const int32x4_t ven = vminq_s32(vmaxq_s32(veo, vmin_exponent), vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vmax_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vmax_exponent));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vmlaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vmlaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vmlaq_f32(vso, vt, vp));
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vx, vlog2e);
+    int32x4_t veo = vshlq_n_s32(vreinterpretq_s32_f32(vn), 23);
+    const int32x4_t ven = vminq_s32(vmaxq_s32(veo, vmin_exponent), vmax_exponent);
+    veo = vsubq_s32(veo, ven);
+    const float32x4_t vsn = vreinterpretq_f32_s32(vaddq_s32(ven, vmax_exponent));
+    const float32x4_t vso = vreinterpretq_f32_s32(vaddq_s32(veo, vmax_exponent));
+    vn = vsubq_f32(vn, vmagic_bias);
+
+    float32x4_t vt = vmlaq_f32(vx, vn, vminus_ln2_hi);
+    vt = vmlaq_f32(vt, vn, vminus_ln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vso);
+    float32x4_t vy = vmulq_f32(vsn, vmlaq_f32(vso, vt, vp));
+    vy = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vy), vcltq_f32(vx, vzero_cutoff)));
+    vy = vbslq_f32(vcgtq_f32(vx, vinf_cutoff), vplus_inf, vy);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
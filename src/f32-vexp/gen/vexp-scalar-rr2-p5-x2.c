@@ -0,0 +1,139 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vexp/scalar-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+#include <fp16/bitcasts.h>
+
+
+void xnn_f32_vexp_ukernel__scalar_rr2_p5_x2(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const float vlog2e = params->scalar_rr2_p5.log2e;
+  const float vmagic_bias = params->scalar_rr2_p5.magic_bias;
+  const float vminus_ln2_hi = params->scalar_rr2_p5.minus_ln2_hi;
+  const float vminus_ln2_lo = params->scalar_rr2_p5.minus_ln2_lo;
+  const float vc5 = params->scalar_rr2_p5.c5;
+  const float vc4 = params->scalar_rr2_p5.c4;
+  const float vc3 = params->scalar_rr2_p5.c3;
+  const float vc2 = params->scalar_rr2_p5.c2;
+  const float vc1 = params->scalar_rr2_p5.c1;
+  const int32_t vmin_exponent = params->scalar_rr2_p5.min_exponent;
+  const int32_t vmax_exponent = params->scalar_rr2_p5.max_exponent;
+  const float vzero_cutoff = params->scalar_rr2_p5.zero_cutoff;
+  const float vinf_cutoff = params->scalar_rr2_p5.inf_cutoff;
+
+  for (; n >= 2 * sizeof(float); n -= 2 * sizeof(float)) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    x += 2;
+
+    float vn0 = vx0 * vlog2e + vmagic_bias;
+    float vn1 = vx1 * vlog2e + vmagic_bias;
+
+    uint32_t veo0 = fp32_to_bits(vn0) << 23;
+    uint32_t veo1 = fp32_to_bits(vn1) << 23;
+
+    const int32_t ven0 = math_min_s32(math_max_s32((int32_t) veo0, vmin_exponent), vmax_exponent);
+    const int32_t ven1 = math_min_s32(math_max_s32((int32_t) veo1, vmin_exponent), vmax_exponent);
+
+    veo0 -= (uint32_t) ven0;
+    veo1 -= (uint32_t) ven1;
+
+    const float vsn0 = fp32_from_bits((uint32_t) ven0 + (uint32_t) vmax_exponent);
+    const float vsn1 = fp32_from_bits((uint32_t) ven1 + (uint32_t) vmax_exponent);
+
+    const float vso0 = fp32_from_bits(veo0 + (uint32_t) vmax_exponent);
+    const float vso1 = fp32_from_bits(veo1 + (uint32_t) vmax_exponent);
+
+    vn0 -= vmagic_bias;
+    vn1 -= vmagic_bias;
+
+    float vt0 = vn0 * vminus_ln2_hi + vx0;
+    float vt1 = vn1 * vminus_ln2_hi + vx1;
+
+    vt0 = vn0 * vminus_ln2_lo + vt0;
+    vt1 = vn1 * vminus_ln2_lo + vt1;
+
+    float vp0 = vc5 * vt0 + vc4;
+    float vp1 = vc5 * vt1 + vc4;
+
+    vp0 = vp0 * vt0 + vc3;
+    vp1 = vp1 * vt1 + vc3;
+
+    vp0 = vp0 * vt0 + vc2;
+    vp1 = vp1 * vt1 + vc2;
+
+    vp0 = vp0 * vt0 + vc1;
+    vp1 = vp1 * vt1 + vc1;
+
+    vt0 *= vso0;
+    vt1 *= vso1;
+
+    float vy0 = vsn0 * (vt0 * vp0 + vso0);
+    float vy1 = vsn1 * (vt1 * vp1 + vso1);
+
+    if XNN_UNPREDICTABLE(vx0 < vzero_cutoff) {
+      vy0 = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vx1 < vzero_cutoff) {
+      vy1 = 0.0f;
+    }
+
+    if XNN_UNPREDICTABLE(vx0 > vinf_cutoff) {
+      vy0 = INFINITY;
+    }
+    if XNN_UNPREDICTABLE(vx1 > vinf_cutoff) {
+      vy1 = INFINITY;
+    }
+
+    y[0] = vy0;
+    y[1] = vy1;
+    y += 2;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float vx = *x;
+
+    float vn = vx * vlog2e + vmagic_bias;
+    uint32_t veo = fp32_to_bits(vn) << 23;
+    const int32_t ven = math_min_s32(math_max_s32((int32_t) veo, vmin_exponent), vmax_exponent);
+    veo -= (uint32_t) ven;
+    const float vsn = fp32_from_bits((uint32_t) ven + (uint32_t) vmax_exponent);
+    const float vso = fp32_from_bits(veo + (uint32_t) vmax_exponent);
+    vn -= vmagic_bias;
+
+    float vt = vn * vminus_ln2_hi + vx;
+    vt = vn * vminus_ln2_lo + vt;
+
+    float vp = vc5 * vt + vc4;
+    vp = vp * vt + vc3;
+    vp = vp * vt + vc2;
+    vp = vp * vt + vc1;
+
+    vt *= vso;
+    float vy = vsn * (vt * vp + vso);
+    if XNN_UNPREDICTABLE(vx < vzero_cutoff) {
+      vy = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(vx > vinf_cutoff) {
+      vy = INFINITY;
+    }
+    *y = vy;
+  }
+}
@@ -0,0 +1,112 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vexp/sse2-rr2-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vexp_ukernel__sse2_rr2_p5_x4(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_exp_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m128 vlog2e = _mm_load_ps(params->sse2_rr2_p5.log2e);
+  const __m128 vmagic_bias = _mm_load_ps(params->sse2_rr2_p5.magic_bias);
+  const __m128 vminus_ln2_hi = _mm_load_ps(params->sse2_rr2_p5.minus_ln2_hi);
+  const __m128 vminus_ln2_lo = _mm_load_ps(params->sse2_rr2_p5.minus_ln2_lo);
+  const __m128 vc5 = _mm_load_ps(params->sse2_rr2_p5.c5);
+  const __m128 vc4 = _mm_load_ps(params->sse2_rr2_p5.c4);
+  const __m128 vc3 = _mm_load_ps(params->sse2_rr2_p5.c3);
+  const __m128 vc2 = _mm_load_ps(params->sse2_rr2_p5.c2);
+  const __m128 vc1 = _mm_load_ps(params->sse2_rr2_p5.c1);
+  const __m128i vmin_exponent = _mm_load_si128((const __m128i*) params->sse2_rr2_p5.min_exponent);
+  const __m128i vmax_exponent = _mm_load_si128((const __m128i*) params->sse2_rr2_p5.max_exponent);
+  const __m128 vzero_cutoff = _mm_load_ps(params->sse2_rr2_p5.zero_cutoff);
+  const __m128 vinf_cutoff = _mm_load_ps(params->sse2_rr2_p5.inf_cutoff);
+  const __m128 vplus_inf = _mm_load_ps(params->sse2_rr2_p5.plus_inf);
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vmax_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vmax_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    _mm_storeu_ps(y, vy);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vx, vlog2e), vmagic_bias);
+
+    __m128i veo = _mm_slli_epi32(_mm_castps_si128(vn), 23);
+    __m128i ven = _mm_max_epi16(veo, vmin_exponent);
+    ven = _mm_min_epi16(ven, vmax_exponent);
+    veo = _mm_sub_epi32(veo, ven);
+    const __m128 vsn = _mm_castsi128_ps(_mm_add_epi32(ven, vmax_exponent));
+    const __m128 vso = _mm_castsi128_ps(_mm_add_epi32(veo, vmax_exponent));
+
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vx);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vso);
+    __m128 vy = _mm_mul_ps(vsn, _mm_add_ps(_mm_mul_ps(vt, vp), vso));
+
+    vy = _mm_andnot_ps(_mm_cmplt_ps(vx, vzero_cutoff), vy);
+    const __m128 vm = _mm_cmpgt_ps(vx, vinf_cutoff);
+    vy = _mm_or_ps(_mm_and_ps(vplus_inf, vm), _mm_andnot_ps(vm, vy));
+
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
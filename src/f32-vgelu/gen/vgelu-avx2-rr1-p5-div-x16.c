@@ -0,0 +1,183 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/avx2-rr1-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+// GELU is evaluated with the tanh approximation: 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x**3))), which
+// equals x * sigmoid(alpha * x + beta * x**3) with alpha = sqrt(8 / pi) and beta = 0.044715 * alpha.
+void xnn_f32_vgelu_ukernel__avx2_rr1_p5_div_x16(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m256 valpha = _mm256_load_ps(params->avx2_rr1_p5.alpha);
+  const __m256 vbeta = _mm256_load_ps(params->avx2_rr1_p5.beta);
+  const __m256 vsign_mask = _mm256_load_ps(params->avx2_rr1_p5.sign_mask);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_rr1_p5.magic_bias);
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_rr1_p5.log2e);
+  const __m256 vminus_ln2 = _mm256_load_ps(params->avx2_rr1_p5.minus_ln2);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_rr1_p5.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_rr1_p5.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_rr1_p5.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_rr1_p5.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_rr1_p5.c1);
+  const __m256 vone = _mm256_load_ps(params->avx2_rr1_p5.one);
+  const __m256 vdenorm_cutoff = _mm256_load_ps(params->avx2_rr1_p5.denorm_cutoff);
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    x += 16;
+
+    const __m256 va0 = _mm256_mul_ps(_mm256_fmadd_ps(_mm256_mul_ps(vx0, vx0), vbeta, valpha), vx0);
+    const __m256 va1 = _mm256_mul_ps(_mm256_fmadd_ps(_mm256_mul_ps(vx1, vx1), vbeta, valpha), vx1);
+
+    const __m256 vz0 = _mm256_or_ps(va0, vsign_mask);
+    const __m256 vz1 = _mm256_or_ps(va1, vsign_mask);
+
+    __m256 vn0 = _mm256_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vz1, vlog2e, vmagic_bias);
+
+    const __m256 vs0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn0), 23));
+    const __m256 vs1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn1), 23));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2, vz0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2, vz1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc5, vt0, vc4);
+    __m256 vp1 = _mm256_fmadd_ps(vc5, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc1);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc1);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+
+    const __m256 ve0 = _mm256_fmadd_ps(vt0, vp0, vs0);
+    const __m256 ve1 = _mm256_fmadd_ps(vt1, vp1, vs1);
+
+    const __m256 vd0 = _mm256_add_ps(ve0, vone);
+    const __m256 vd1 = _mm256_add_ps(ve1, vone);
+
+    __m256 vf0 = _mm256_div_ps(ve0, vd0);
+    __m256 vf1 = _mm256_div_ps(ve1, vd1);
+
+    vf0 = _mm256_andnot_ps(_mm256_cmp_ps(vz0, vdenorm_cutoff, _CMP_LT_OS), vf0);
+    vf1 = _mm256_andnot_ps(_mm256_cmp_ps(vz1, vdenorm_cutoff, _CMP_LT_OS), vf1);
+
+    vf0 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf0), vf0, va0);
+    vf1 = _mm256_blendv_ps(_mm256_sub_ps(vone, vf1), vf1, va1);
+
+    const __m256 vy0 = _mm256_mul_ps(vx0, vf0);
+    const __m256 vy1 = _mm256_mul_ps(vx1, vf1);
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    const __m256 va = _mm256_mul_ps(_mm256_fmadd_ps(_mm256_mul_ps(vx, vx), vbeta, valpha), vx);
+
+    const __m256 vz = _mm256_or_ps(va, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+
+    const __m256 vd = _mm256_add_ps(ve, vone);
+    __m256 vf = _mm256_div_ps(ve, vd);
+
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, va);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx2_rr1_p5.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    const __m256 va = _mm256_mul_ps(_mm256_fmadd_ps(_mm256_mul_ps(vx, vx), vbeta, valpha), vx);
+
+    const __m256 vz = _mm256_or_ps(va, vsign_mask);
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc5, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_fmadd_ps(vp, vt, vc1);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 ve = _mm256_fmadd_ps(vt, vp, vs);
+
+    const __m256 vd = _mm256_add_ps(ve, vone);
+    __m256 vf = _mm256_div_ps(ve, vd);
+
+    vf = _mm256_andnot_ps(_mm256_cmp_ps(vz, vdenorm_cutoff, _CMP_LT_OS), vf);
+    vf = _mm256_blendv_ps(_mm256_sub_ps(vone, vf), vf, va);
+
+    const __m256 vy = _mm256_mul_ps(vx, vf);
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
@@ -0,0 +1,117 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/neon-p5.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+// GELU is evaluated with the tanh approximation: 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x**3))), which
+// equals x * sigmoid(alpha * x + beta * x**3) with alpha = sqrt(8 / pi) and beta = 0.044715 * alpha.
+void xnn_f32_vgelu_ukernel__neon_rr2_p5_nr2recps_x4(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const float32x4_t valpha = vld1q_dup_f32(&params->neon_rr2_p5.alpha);
+  const float32x4_t vbeta = vld1q_dup_f32(&params->neon_rr2_p5.beta);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neon_rr2_p5.magic_bias);
+  const float32x4_t vminus_log2e = vld1q_dup_f32(&params->neon_rr2_p5.minus_log2e);
+  const float32x4_t vln2_hi = vld1q_dup_f32(&params->neon_rr2_p5.ln2_hi);
+  const float32x4_t vln2_lo = vld1q_dup_f32(&params->neon_rr2_p5.ln2_lo);
+  const float32x4_t vc5 = vld1q_dup_f32(&params->neon_rr2_p5.c5);
+  const float32x4_t vc4 = vld1q_dup_f32(&params->neon_rr2_p5.c4);
+  const float32x4_t vc3 = vld1q_dup_f32(&params->neon_rr2_p5.c3);
+  const float32x4_t vc2 = vld1q_dup_f32(&params->neon_rr2_p5.c2);
+  const float32x4_t vc1 = vld1q_dup_f32(&params->neon_rr2_p5.c1);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vdenorm_cutoff = vld1q_dup_f32(&params->neon_rr2_p5.denorm_cutoff);
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    const float32x4_t va = vmulq_f32(vmlaq_f32(valpha, vmulq_f32(vx, vx), vbeta), vx);
+
+    const float32x4_t vz = vabsq_f32(va);
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
+    vt = vmlaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vmlaq_f32(vs, vp, vt);
+    const float32x4_t vd = vaddq_f32(ve, vone);
+
+    float32x4_t vr = vrecpeq_f32(vd);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+
+    float32x4_t vf = vmulq_f32(ve, vr);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(va, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(va, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    const float32x4_t va = vmulq_f32(vmlaq_f32(valpha, vmulq_f32(vx, vx), vbeta), vx);
+
+    const float32x4_t vz = vabsq_f32(va);
+
+    float32x4_t vn = vmlaq_f32(vmagic_bias, vz, vminus_log2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vmlaq_f32(vz, vn, vln2_hi);
+    vt = vmlaq_f32(vt, vn, vln2_lo);
+
+    float32x4_t vp = vmlaq_f32(vc4, vc5, vt);
+    vp = vmlaq_f32(vc3, vp, vt);
+    vp = vmlaq_f32(vc2, vp, vt);
+    vp = vmlaq_f32(vc1, vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t ve = vmlaq_f32(vs, vp, vt);
+    const float32x4_t vd = vaddq_f32(ve, vone);
+
+    float32x4_t vr = vrecpeq_f32(vd);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+
+    float32x4_t vf = vmulq_f32(ve, vr);
+    vf = vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vf), vcagtq_f32(va, vdenorm_cutoff)));
+    const uint32x4_t vm = vcltq_f32(va, vmovq_n_f32(0.0f));
+    vf = vbslq_f32(vm, vf, vsubq_f32(vone, vf));
+
+    const float32x4_t vy = vmulq_f32(vx, vf);
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,79 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/scalar-rr2-p5-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+#include <fp16/bitcasts.h>
+
+
+// GELU is evaluated with the tanh approximation: 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x**3))), which
+// equals x * sigmoid(alpha * x + beta * x**3) with alpha = sqrt(8 / pi) and beta = 0.044715 * alpha.
+void xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x1(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const float valpha = params->scalar_rr2_p5.alpha;
+  const float vbeta = params->scalar_rr2_p5.beta;
+  const float vmagic_bias = params->scalar_rr2_p5.magic_bias;
+  const float vminus_log2e = params->scalar_rr2_p5.minus_log2e;
+  const float vln2_hi = params->scalar_rr2_p5.ln2_hi;
+  const float vln2_lo = params->scalar_rr2_p5.ln2_lo;
+  const float vc5 = params->scalar_rr2_p5.c5;
+  const float vc4 = params->scalar_rr2_p5.c4;
+  const float vc3 = params->scalar_rr2_p5.c3;
+  const float vc2 = params->scalar_rr2_p5.c2;
+  const float vc1 = params->scalar_rr2_p5.c1;
+  const float vone = params->scalar_rr2_p5.one;
+  const float vdenorm_cutoff = params->scalar_rr2_p5.denorm_cutoff;
+
+  do {
+    const float vx = *x++;
+
+    const float va = (vx * vx * vbeta + valpha) * vx;
+
+    const float vz = fabsf(va);
+
+    float vn = vz * vminus_log2e + vmagic_bias;
+    const float vs = fp32_from_bits(fp32_to_bits(vn) << 23);
+    vn -= vmagic_bias;
+
+    float vt = vn * vln2_hi + vz;
+    vt = vn * vln2_lo + vt;
+
+    float vp = vt * vc5 + vc4;
+    vp = vt * vp + vc3;
+    vp = vt * vp + vc2;
+    vp = vt * vp + vc1;
+
+    vt *= vs;
+    const float ve = vt * vp + vs;
+    const float vd = ve + vone;
+
+    float vf = ve / vd;
+    if XNN_UNPREDICTABLE(vz > vdenorm_cutoff) {
+      vf = 0.0f;
+    }
+    if XNN_UNPREDICTABLE(va > 0.0f) {
+      vf = vone - vf;
+    }
+
+    const float vy = vx * vf;
+    *y++ = vy;
+
+    n -= sizeof(float);
+  } while (n != 0);
+}
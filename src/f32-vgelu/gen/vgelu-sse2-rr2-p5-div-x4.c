@@ -0,0 +1,118 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/sse2-rr2-p5-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+// GELU is evaluated with the tanh approximation: 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x**3))), which
+// equals x * sigmoid(alpha * x + beta * x**3) with alpha = sqrt(8 / pi) and beta = 0.044715 * alpha.
+void xnn_f32_vgelu_ukernel__sse2_rr2_p5_div_x4(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m128 valpha = _mm_load_ps(params->sse2_rr2_p5.alpha);
+  const __m128 vbeta = _mm_load_ps(params->sse2_rr2_p5.beta);
+  const __m128 vsign_mask = _mm_load_ps(params->sse2_rr2_p5.sign_mask);
+  const __m128 vmagic_bias = _mm_load_ps(params->sse2_rr2_p5.magic_bias);
+  const __m128 vlog2e = _mm_load_ps(params->sse2_rr2_p5.log2e);
+  const __m128 vminus_ln2_hi = _mm_load_ps(params->sse2_rr2_p5.minus_ln2_hi);
+  const __m128 vminus_ln2_lo = _mm_load_ps(params->sse2_rr2_p5.minus_ln2_lo);
+  const __m128 vc5 = _mm_load_ps(params->sse2_rr2_p5.c5);
+  const __m128 vc4 = _mm_load_ps(params->sse2_rr2_p5.c4);
+  const __m128 vc3 = _mm_load_ps(params->sse2_rr2_p5.c3);
+  const __m128 vc2 = _mm_load_ps(params->sse2_rr2_p5.c2);
+  const __m128 vc1 = _mm_load_ps(params->sse2_rr2_p5.c1);
+  const __m128 vone = _mm_load_ps(params->sse2_rr2_p5.one);
+  const __m128 vdenorm_cutoff = _mm_load_ps(params->sse2_rr2_p5.denorm_cutoff);
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    const __m128 va = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(vx, vx), vbeta), valpha), vx);
+
+    const __m128 vz = _mm_or_ps(va, vsign_mask);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vs);
+    __m128 ve = _mm_add_ps(_mm_mul_ps(vt, vp), vs);
+
+    __m128 vd = _mm_add_ps(ve, vone);
+    __m128 vf = _mm_div_ps(ve, vd);
+
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(va)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    const __m128 vy = _mm_mul_ps(vx, vf);
+
+    _mm_storeu_ps(y, vy);
+
+    x += 4;
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    const __m128 va = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(vx, vx), vbeta), valpha), vx);
+
+    const __m128 vz = _mm_or_ps(va, vsign_mask);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vs);
+    __m128 ve = _mm_add_ps(_mm_mul_ps(vt, vp), vs);
+
+    __m128 vd = _mm_add_ps(ve, vone);
+    __m128 vf = _mm_div_ps(ve, vd);
+
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(va)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    __m128 vy = _mm_mul_ps(vx, vf);
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
@@ -0,0 +1,185 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vgelu/sse2-rr2-p5-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+// GELU is evaluated with the tanh approximation: 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x**3))), which
+// equals x * sigmoid(alpha * x + beta * x**3) with alpha = sqrt(8 / pi) and beta = 0.044715 * alpha.
+void xnn_f32_vgelu_ukernel__sse2_rr2_p5_div_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m128 valpha = _mm_load_ps(params->sse2_rr2_p5.alpha);
+  const __m128 vbeta = _mm_load_ps(params->sse2_rr2_p5.beta);
+  const __m128 vsign_mask = _mm_load_ps(params->sse2_rr2_p5.sign_mask);
+  const __m128 vmagic_bias = _mm_load_ps(params->sse2_rr2_p5.magic_bias);
+  const __m128 vlog2e = _mm_load_ps(params->sse2_rr2_p5.log2e);
+  const __m128 vminus_ln2_hi = _mm_load_ps(params->sse2_rr2_p5.minus_ln2_hi);
+  const __m128 vminus_ln2_lo = _mm_load_ps(params->sse2_rr2_p5.minus_ln2_lo);
+  const __m128 vc5 = _mm_load_ps(params->sse2_rr2_p5.c5);
+  const __m128 vc4 = _mm_load_ps(params->sse2_rr2_p5.c4);
+  const __m128 vc3 = _mm_load_ps(params->sse2_rr2_p5.c3);
+  const __m128 vc2 = _mm_load_ps(params->sse2_rr2_p5.c2);
+  const __m128 vc1 = _mm_load_ps(params->sse2_rr2_p5.c1);
+  const __m128 vone = _mm_load_ps(params->sse2_rr2_p5.one);
+  const __m128 vdenorm_cutoff = _mm_load_ps(params->sse2_rr2_p5.denorm_cutoff);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(x);
+    const __m128 vx4567 = _mm_loadu_ps(x + 4);
+
+    const __m128 va0123 = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(vx0123, vx0123), vbeta), valpha), vx0123);
+    const __m128 va4567 = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(vx4567, vx4567), vbeta), valpha), vx4567);
+
+    const __m128 vz0123 = _mm_or_ps(va0123, vsign_mask);
+    const __m128 vz4567 = _mm_or_ps(va4567, vsign_mask);
+
+    __m128 vn0123 = _mm_add_ps(_mm_mul_ps(vz0123, vlog2e), vmagic_bias);
+    __m128 vn4567 = _mm_add_ps(_mm_mul_ps(vz4567, vlog2e), vmagic_bias);
+
+    const __m128 vs0123 = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn0123), 23));
+    const __m128 vs4567 = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn4567), 23));
+
+    vn0123 = _mm_sub_ps(vn0123, vmagic_bias);
+    vn4567 = _mm_sub_ps(vn4567, vmagic_bias);
+
+    __m128 vt0123 = _mm_add_ps(_mm_mul_ps(vn0123, vminus_ln2_hi), vz0123);
+    __m128 vt4567 = _mm_add_ps(_mm_mul_ps(vn4567, vminus_ln2_hi), vz4567);
+
+    vt0123 = _mm_add_ps(_mm_mul_ps(vn0123, vminus_ln2_lo), vt0123);
+    vt4567 = _mm_add_ps(_mm_mul_ps(vn4567, vminus_ln2_lo), vt4567);
+
+    __m128 vp0123 = _mm_add_ps(_mm_mul_ps(vc5, vt0123), vc4);
+    __m128 vp4567 = _mm_add_ps(_mm_mul_ps(vc5, vt4567), vc4);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vt0123), vc3);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vt4567), vc3);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vt0123), vc2);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vt4567), vc2);
+
+    vp0123 = _mm_add_ps(_mm_mul_ps(vp0123, vt0123), vc1);
+    vp4567 = _mm_add_ps(_mm_mul_ps(vp4567, vt4567), vc1);
+
+    vt0123 = _mm_mul_ps(vt0123, vs0123);
+    vt4567 = _mm_mul_ps(vt4567, vs4567);
+
+    __m128 ve0123 = _mm_add_ps(_mm_mul_ps(vt0123, vp0123), vs0123);
+    __m128 ve4567 = _mm_add_ps(_mm_mul_ps(vt4567, vp4567), vs4567);
+
+    __m128 vd0123 = _mm_add_ps(ve0123, vone);
+    __m128 vd4567 = _mm_add_ps(ve4567, vone);
+
+    __m128 vf0123 = _mm_div_ps(ve0123, vd0123);
+    __m128 vf4567 = _mm_div_ps(ve4567, vd4567);
+
+    vf0123 = _mm_andnot_ps(_mm_cmplt_ps(vz0123, vdenorm_cutoff), vf0123);
+    vf4567 = _mm_andnot_ps(_mm_cmplt_ps(vz4567, vdenorm_cutoff), vf4567);
+
+    const __m128 vm0123 = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(va0123)));
+    const __m128 vm4567 = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(va4567)));
+
+    vf0123 = _mm_or_ps(_mm_and_ps(vf0123, vm0123), _mm_andnot_ps(vm0123, _mm_sub_ps(vone, vf0123)));
+    vf4567 = _mm_or_ps(_mm_and_ps(vf4567, vm4567), _mm_andnot_ps(vm4567, _mm_sub_ps(vone, vf4567)));
+
+    const __m128 vy0123 = _mm_mul_ps(vx0123, vf0123);
+    const __m128 vy4567 = _mm_mul_ps(vx4567, vf4567);
+
+    _mm_storeu_ps(y, vy0123);
+    _mm_storeu_ps(y + 4, vy4567);
+
+    x += 8;
+    y += 8;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    const __m128 va = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(vx, vx), vbeta), valpha), vx);
+
+    const __m128 vz = _mm_or_ps(va, vsign_mask);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vs);
+    __m128 ve = _mm_add_ps(_mm_mul_ps(vt, vp), vs);
+
+    __m128 vd = _mm_add_ps(ve, vone);
+    __m128 vf = _mm_div_ps(ve, vd);
+
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(va)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    const __m128 vy = _mm_mul_ps(vx, vf);
+
+    _mm_storeu_ps(y, vy);
+
+    x += 4;
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    const __m128 va = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(vx, vx), vbeta), valpha), vx);
+
+    const __m128 vz = _mm_or_ps(va, vsign_mask);
+
+    __m128 vn = _mm_add_ps(_mm_mul_ps(vz, vlog2e), vmagic_bias);
+    const __m128 vs = _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(vn), 23));
+    vn = _mm_sub_ps(vn, vmagic_bias);
+
+    __m128 vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_hi), vz);
+    vt = _mm_add_ps(_mm_mul_ps(vn, vminus_ln2_lo), vt);
+
+    __m128 vp = _mm_add_ps(_mm_mul_ps(vc5, vt), vc4);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc3);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc2);
+    vp = _mm_add_ps(_mm_mul_ps(vp, vt), vc1);
+
+    vt = _mm_mul_ps(vt, vs);
+    __m128 ve = _mm_add_ps(_mm_mul_ps(vt, vp), vs);
+
+    __m128 vd = _mm_add_ps(ve, vone);
+    __m128 vf = _mm_div_ps(ve, vd);
+
+    vf = _mm_andnot_ps(_mm_cmplt_ps(vz, vdenorm_cutoff), vf);
+    const __m128 vm = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_setzero_si128(), _mm_castps_si128(va)));
+    vf = _mm_or_ps(_mm_and_ps(vf, vm), _mm_andnot_ps(vm, _mm_sub_ps(vone, vf)));
+
+    __m128 vy = _mm_mul_ps(vx, vf);
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
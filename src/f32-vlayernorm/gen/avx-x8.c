@@ -0,0 +1,80 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlayernorm/avx.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlayernorm_ukernel__avx_x8(
+    size_t batch,
+    const float* input,
+    const float* stats,
+    const float* gamma,
+    const float* beta,
+    float* output) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(stats != NULL);
+  assert(gamma != NULL);
+  assert(beta != NULL);
+  assert(output != NULL);
+
+  const __m256 vmean = _mm256_broadcast_ss(stats);
+  const __m256 vinv_stddev = _mm256_broadcast_ss(stats + 1);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m256 vx01234567 = _mm256_loadu_ps(input);
+    input += 8;
+
+    __m256 vy01234567 = _mm256_mul_ps(_mm256_sub_ps(vx01234567, vmean), vinv_stddev);
+
+    vy01234567 = _mm256_add_ps(_mm256_mul_ps(vy01234567, _mm256_loadu_ps(gamma + 0)), _mm256_loadu_ps(beta + 0));
+    gamma += 8;
+    beta += 8;
+
+    _mm256_storeu_ps(output, vy01234567);
+    output += 8;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vmean_lo = _mm256_castps256_ps128(vmean);
+    const __m128 vinv_stddev_lo = _mm256_castps256_ps128(vinv_stddev);
+    if (batch & (4 * sizeof(float))) {
+      const __m128 vx = _mm_loadu_ps(input);
+      input += 4;
+
+      __m128 vy = _mm_mul_ps(_mm_sub_ps(vx, vmean_lo), vinv_stddev_lo);
+      vy = _mm_add_ps(_mm_mul_ps(vy, _mm_loadu_ps(gamma)), _mm_loadu_ps(beta));
+      gamma += 4;
+      beta += 4;
+
+      _mm_storeu_ps(output, vy);
+      output += 4;
+    }
+    if (batch & (3 * sizeof(float))) {
+      const __m128 vx = _mm_loadu_ps(input);
+
+      __m128 vy = _mm_mul_ps(_mm_sub_ps(vx, vmean_lo), vinv_stddev_lo);
+      vy = _mm_add_ps(_mm_mul_ps(vy, _mm_loadu_ps(gamma)), _mm_loadu_ps(beta));
+
+      if (batch & (2 * sizeof(float))) {
+        _mm_storel_pi((__m64*) output, vy);
+        vy = _mm_movehl_ps(vy, vy);
+        output += 2;
+      }
+      if (batch & (1 * sizeof(float))) {
+        _mm_store_ss(output, vy);
+      }
+    }
+  }
+}
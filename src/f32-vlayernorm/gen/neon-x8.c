@@ -0,0 +1,73 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlayernorm/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlayernorm_ukernel__neon_x8(
+    size_t batch,
+    const float* input,
+    const float* stats,
+    const float* gamma,
+    const float* beta,
+    float* output) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(stats != NULL);
+  assert(gamma != NULL);
+  assert(beta != NULL);
+  assert(output != NULL);
+
+  const float32x4_t vmean = vld1q_dup_f32(stats);
+  const float32x4_t vinv_stddev = vld1q_dup_f32(stats + 1);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(input); input += 4;
+    const float32x4_t vx4567 = vld1q_f32(input); input += 4;
+    const float32x4_t vgamma0123 = vld1q_f32(gamma); gamma += 4;
+    const float32x4_t vgamma4567 = vld1q_f32(gamma); gamma += 4;
+    const float32x4_t vbeta0123 = vld1q_f32(beta); beta += 4;
+    const float32x4_t vbeta4567 = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vy0123 = vmulq_f32(vsubq_f32(vx0123, vmean), vinv_stddev);
+    const float32x4_t vy4567 = vmulq_f32(vsubq_f32(vx4567, vmean), vinv_stddev);
+
+    vst1q_f32(output, vmlaq_f32(vbeta0123, vy0123, vgamma0123)); output += 4;
+    vst1q_f32(output, vmlaq_f32(vbeta4567, vy4567, vgamma4567)); output += 4;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(input); input += 4;
+    const float32x4_t vgamma = vld1q_f32(gamma); gamma += 4;
+    const float32x4_t vbeta = vld1q_f32(beta); beta += 4;
+
+    const float32x4_t vy = vmulq_f32(vsubq_f32(vx, vmean), vinv_stddev);
+    vst1q_f32(output, vmlaq_f32(vbeta, vy, vgamma)); output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const float32x4_t vx = vld1q_f32(input);
+    const float32x4_t vgamma = vld1q_f32(gamma);
+    const float32x4_t vbeta = vld1q_f32(beta);
+
+    const float32x4_t vy = vmlaq_f32(vbeta, vmulq_f32(vsubq_f32(vx, vmean), vinv_stddev), vgamma);
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (batch & (2 * sizeof(float))) {
+      vst1_f32(output, vy_lo); output += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (batch & (1 * sizeof(float))) {
+      vst1_lane_f32(output, vy_lo, 0);
+    }
+  }
+}
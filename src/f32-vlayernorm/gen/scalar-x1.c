@@ -0,0 +1,40 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlayernorm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlayernorm_ukernel__scalar_x1(
+    size_t batch,
+    const float* input,
+    const float* stats,
+    const float* gamma,
+    const float* beta,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(stats != NULL);
+  assert(gamma != NULL);
+  assert(beta != NULL);
+  assert(output != NULL);
+
+  const float vmean = stats[0];
+  const float vinv_stddev = stats[1];
+  do {
+    const float vx = *input++;
+    const float vy = (vx - vmean) * vinv_stddev;
+    *output++ = vy * *gamma++ + *beta++;
+    batch -= sizeof(float);
+  } while (batch != 0);
+}
@@ -0,0 +1,67 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlayernorm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlayernorm_ukernel__scalar_x4(
+    size_t batch,
+    const float* input,
+    const float* stats,
+    const float* gamma,
+    const float* beta,
+    float* output)
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(stats != NULL);
+  assert(gamma != NULL);
+  assert(beta != NULL);
+  assert(output != NULL);
+
+  const float vmean = stats[0];
+  const float vinv_stddev = stats[1];
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const float vx0 = input[0];
+    const float vx1 = input[1];
+    const float vx2 = input[2];
+    const float vx3 = input[3];
+    input += 4;
+
+    float vy0 = (vx0 - vmean) * vinv_stddev;
+    float vy1 = (vx1 - vmean) * vinv_stddev;
+    float vy2 = (vx2 - vmean) * vinv_stddev;
+    float vy3 = (vx3 - vmean) * vinv_stddev;
+
+    vy0 = vy0 * gamma[0] + beta[0];
+    vy1 = vy1 * gamma[1] + beta[1];
+    vy2 = vy2 * gamma[2] + beta[2];
+    vy3 = vy3 * gamma[3] + beta[3];
+    gamma += 4;
+    beta += 4;
+
+    output[0] = vy0;
+    output[1] = vy1;
+    output[2] = vy2;
+    output[3] = vy3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const float vx = *input++;
+      const float vy = (vx - vmean) * vinv_stddev;
+      *output++ = vy * *gamma++ + *beta++;
+      batch -= sizeof(float);
+    } while (batch != 0);
+  }
+}
@@ -0,0 +1,80 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlayernorm/sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlayernorm_ukernel__sse_x8(
+    size_t batch,
+    const float* input,
+    const float* stats,
+    const float* gamma,
+    const float* beta,
+    float* output) XNN_OOB_READS
+{
+  assert(batch != 0);
+  assert(batch % sizeof(float) == 0);
+  assert(input != NULL);
+  assert(stats != NULL);
+  assert(gamma != NULL);
+  assert(beta != NULL);
+  assert(output != NULL);
+
+  const __m128 vmean = _mm_load1_ps(stats);
+  const __m128 vinv_stddev = _mm_load1_ps(stats + 1);
+  for (; batch >= 8 * sizeof(float); batch -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(input);
+    const __m128 vx4567 = _mm_loadu_ps(input + 4);
+    input += 8;
+
+    __m128 vy0123 = _mm_mul_ps(_mm_sub_ps(vx0123, vmean), vinv_stddev);
+    __m128 vy4567 = _mm_mul_ps(_mm_sub_ps(vx4567, vmean), vinv_stddev);
+
+    vy0123 = _mm_add_ps(_mm_mul_ps(vy0123, _mm_loadu_ps(gamma + 0)), _mm_loadu_ps(beta + 0));
+    vy4567 = _mm_add_ps(_mm_mul_ps(vy4567, _mm_loadu_ps(gamma + 4)), _mm_loadu_ps(beta + 4));
+    gamma += 8;
+    beta += 8;
+
+    _mm_storeu_ps(output, vy0123);
+    _mm_storeu_ps(output + 4, vy4567);
+    output += 8;
+  }
+  for (; batch >= 4 * sizeof(float); batch -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(input);
+    input += 4;
+
+    __m128 vy = _mm_mul_ps(_mm_sub_ps(vx, vmean), vinv_stddev);
+    vy = _mm_add_ps(_mm_mul_ps(vy, _mm_loadu_ps(gamma)), _mm_loadu_ps(beta));
+    gamma += 4;
+    beta += 4;
+
+    _mm_storeu_ps(output, vy);
+    output += 4;
+  }
+  if XNN_UNLIKELY(batch != 0) {
+    const __m128 vx = _mm_loadu_ps(input);
+
+    __m128 vy = _mm_mul_ps(_mm_sub_ps(vx, vmean), vinv_stddev);
+    vy = _mm_add_ps(_mm_mul_ps(vy, _mm_loadu_ps(gamma)), _mm_loadu_ps(beta));
+
+    if (batch & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) output, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      output += 2;
+    }
+    if (batch & (1 * sizeof(float))) {
+      _mm_store_ss(output, vy);
+    }
+  }
+}
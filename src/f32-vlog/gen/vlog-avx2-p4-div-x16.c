@@ -0,0 +1,181 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlog/avx2-p4-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlog_ukernel__avx2_p4_div_x16(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_log_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m256 vmin_normal = _mm256_load_ps(params->avx2_p4.min_normal);
+  const __m256 vdenorm_scale = _mm256_load_ps(params->avx2_p4.denorm_scale);
+  const __m256 vdenorm_exponent = _mm256_load_ps(params->avx2_p4.denorm_exponent);
+  const __m256i vsqrt_half = _mm256_load_si256((const __m256i*) params->avx2_p4.sqrt_half);
+  const __m256i vmantissa_mask = _mm256_load_si256((const __m256i*) params->avx2_p4.mantissa_mask);
+  const __m256 vone = _mm256_load_ps(params->avx2_p4.one);
+  const __m256 vtwo = _mm256_load_ps(params->avx2_p4.two);
+  const __m256 vhalf = _mm256_load_ps(params->avx2_p4.half);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_p4.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_p4.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_p4.c2);
+  const __m256 vc1 = _mm256_load_ps(params->avx2_p4.c1);
+  const __m256 vln2_hi = _mm256_load_ps(params->avx2_p4.ln2_hi);
+  const __m256 vln2_lo = _mm256_load_ps(params->avx2_p4.ln2_lo);
+  const __m256 vminus_inf = _mm256_load_ps(params->avx2_p4.minus_inf);
+  const __m256 vplus_inf = _mm256_load_ps(params->avx2_p4.plus_inf);
+  const __m256 vnan = _mm256_load_ps(params->avx2_p4.nan);
+  const __m256 vzero = _mm256_setzero_ps();
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    x += 16;
+
+    const __m256 vdenorm0 = _mm256_cmp_ps(vx0, vmin_normal, _CMP_LT_OQ);
+    const __m256 vdenorm1 = _mm256_cmp_ps(vx1, vmin_normal, _CMP_LT_OQ);
+
+    const __m256 vm0 = _mm256_blendv_ps(vx0, _mm256_mul_ps(vx0, vdenorm_scale), vdenorm0);
+    const __m256 vm1 = _mm256_blendv_ps(vx1, _mm256_mul_ps(vx1, vdenorm_scale), vdenorm1);
+
+    const __m256i vi0 = _mm256_sub_epi32(_mm256_castps_si256(vm0), vsqrt_half);
+    const __m256i vi1 = _mm256_sub_epi32(_mm256_castps_si256(vm1), vsqrt_half);
+
+    const __m256 ve0 = _mm256_sub_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(vi0, 23)), _mm256_and_ps(vdenorm0, vdenorm_exponent));
+    const __m256 ve1 = _mm256_sub_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(vi1, 23)), _mm256_and_ps(vdenorm1, vdenorm_exponent));
+
+    const __m256 vf0 = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi0, vmantissa_mask), vsqrt_half)), vone);
+    const __m256 vf1 = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi1, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m256 vs0 = _mm256_div_ps(vf0, _mm256_add_ps(vtwo, vf0));
+    const __m256 vs1 = _mm256_div_ps(vf1, _mm256_add_ps(vtwo, vf1));
+
+    const __m256 vz0 = _mm256_mul_ps(vs0, vs0);
+    const __m256 vz1 = _mm256_mul_ps(vs1, vs1);
+
+    const __m256 vw0 = _mm256_mul_ps(vz0, vz0);
+    const __m256 vw1 = _mm256_mul_ps(vz1, vz1);
+
+    const __m256 vr0 = _mm256_fmadd_ps(
+        vz0, _mm256_fmadd_ps(vw0, vc3, vc1),
+        _mm256_mul_ps(vw0, _mm256_fmadd_ps(vw0, vc4, vc2)));
+    const __m256 vr1 = _mm256_fmadd_ps(
+        vz1, _mm256_fmadd_ps(vw1, vc3, vc1),
+        _mm256_mul_ps(vw1, _mm256_fmadd_ps(vw1, vc4, vc2)));
+
+    const __m256 vhfsq0 = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf0), vf0);
+    const __m256 vhfsq1 = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf1), vf1);
+
+    __m256 vy0 = _mm256_fmadd_ps(vs0, _mm256_add_ps(vhfsq0, vr0), _mm256_mul_ps(ve0, vln2_lo));
+    __m256 vy1 = _mm256_fmadd_ps(vs1, _mm256_add_ps(vhfsq1, vr1), _mm256_mul_ps(ve1, vln2_lo));
+
+    vy0 = _mm256_add_ps(_mm256_sub_ps(vy0, vhfsq0), vf0);
+    vy1 = _mm256_add_ps(_mm256_sub_ps(vy1, vhfsq1), vf1);
+
+    vy0 = _mm256_fmadd_ps(ve0, vln2_hi, vy0);
+    vy1 = _mm256_fmadd_ps(ve1, vln2_hi, vy1);
+
+    vy0 = _mm256_blendv_ps(vy0, vnan, _mm256_cmp_ps(vx0, vzero, _CMP_NGT_UQ));
+    vy1 = _mm256_blendv_ps(vy1, vnan, _mm256_cmp_ps(vx1, vzero, _CMP_NGT_UQ));
+
+    vy0 = _mm256_blendv_ps(vy0, vminus_inf, _mm256_cmp_ps(vx0, vzero, _CMP_EQ_OQ));
+    vy1 = _mm256_blendv_ps(vy1, vminus_inf, _mm256_cmp_ps(vx1, vzero, _CMP_EQ_OQ));
+
+    vy0 = _mm256_blendv_ps(vy0, vplus_inf, _mm256_cmp_ps(vx0, vplus_inf, _CMP_EQ_OQ));
+    vy1 = _mm256_blendv_ps(vy1, vplus_inf, _mm256_cmp_ps(vx1, vplus_inf, _CMP_EQ_OQ));
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    const __m256 vdenorm = _mm256_cmp_ps(vx, vmin_normal, _CMP_LT_OQ);
+    const __m256 vm = _mm256_blendv_ps(vx, _mm256_mul_ps(vx, vdenorm_scale), vdenorm);
+
+    const __m256i vi = _mm256_sub_epi32(_mm256_castps_si256(vm), vsqrt_half);
+    const __m256 ve = _mm256_sub_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(vi, 23)), _mm256_and_ps(vdenorm, vdenorm_exponent));
+    const __m256 vf = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m256 vs = _mm256_div_ps(vf, _mm256_add_ps(vtwo, vf));
+    const __m256 vz = _mm256_mul_ps(vs, vs);
+    const __m256 vw = _mm256_mul_ps(vz, vz);
+    const __m256 vr = _mm256_fmadd_ps(
+        vz, _mm256_fmadd_ps(vw, vc3, vc1),
+        _mm256_mul_ps(vw, _mm256_fmadd_ps(vw, vc4, vc2)));
+    const __m256 vhfsq = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf), vf);
+
+    __m256 vy = _mm256_fmadd_ps(vs, _mm256_add_ps(vhfsq, vr), _mm256_mul_ps(ve, vln2_lo));
+    vy = _mm256_add_ps(_mm256_sub_ps(vy, vhfsq), vf);
+    vy = _mm256_fmadd_ps(ve, vln2_hi, vy);
+
+    vy = _mm256_blendv_ps(vy, vnan, _mm256_cmp_ps(vx, vzero, _CMP_NGT_UQ));
+    vy = _mm256_blendv_ps(vy, vminus_inf, _mm256_cmp_ps(vx, vzero, _CMP_EQ_OQ));
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vplus_inf, _CMP_EQ_OQ));
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx2_p4.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    const __m256 vdenorm = _mm256_cmp_ps(vx, vmin_normal, _CMP_LT_OQ);
+    const __m256 vm = _mm256_blendv_ps(vx, _mm256_mul_ps(vx, vdenorm_scale), vdenorm);
+
+    const __m256i vi = _mm256_sub_epi32(_mm256_castps_si256(vm), vsqrt_half);
+    const __m256 ve = _mm256_sub_ps(_mm256_cvtepi32_ps(_mm256_srai_epi32(vi, 23)), _mm256_and_ps(vdenorm, vdenorm_exponent));
+    const __m256 vf = _mm256_sub_ps(_mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m256 vs = _mm256_div_ps(vf, _mm256_add_ps(vtwo, vf));
+    const __m256 vz = _mm256_mul_ps(vs, vs);
+    const __m256 vw = _mm256_mul_ps(vz, vz);
+    const __m256 vr = _mm256_fmadd_ps(
+        vz, _mm256_fmadd_ps(vw, vc3, vc1),
+        _mm256_mul_ps(vw, _mm256_fmadd_ps(vw, vc4, vc2)));
+    const __m256 vhfsq = _mm256_mul_ps(_mm256_mul_ps(vhalf, vf), vf);
+
+    __m256 vy = _mm256_fmadd_ps(vs, _mm256_add_ps(vhfsq, vr), _mm256_mul_ps(ve, vln2_lo));
+    vy = _mm256_add_ps(_mm256_sub_ps(vy, vhfsq), vf);
+    vy = _mm256_fmadd_ps(ve, vln2_hi, vy);
+
+    vy = _mm256_blendv_ps(vy, vnan, _mm256_cmp_ps(vx, vzero, _CMP_NGT_UQ));
+    vy = _mm256_blendv_ps(vy, vminus_inf, _mm256_cmp_ps(vx, vzero, _CMP_EQ_OQ));
+    vy = _mm256_blendv_ps(vy, vplus_inf, _mm256_cmp_ps(vx, vplus_inf, _CMP_EQ_OQ));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
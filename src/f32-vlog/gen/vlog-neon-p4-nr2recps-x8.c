@@ -0,0 +1,188 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlog/neon-p4.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlog_ukernel__neon_p4_nr2recps_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_log_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const float32x4_t vmin_normal = vld1q_dup_f32(&params->neon_p4.min_normal);
+  const float32x4_t vdenorm_scale = vld1q_dup_f32(&params->neon_p4.denorm_scale);
+  const float32x4_t vdenorm_exponent = vld1q_dup_f32(&params->neon_p4.denorm_exponent);
+  const int32x4_t vsqrt_half = vld1q_dup_s32(&params->neon_p4.sqrt_half);
+  const int32x4_t vmantissa_mask = vld1q_dup_s32(&params->neon_p4.mantissa_mask);
+  const float32x4_t vhalf = vld1q_dup_f32(&params->neon_p4.half);
+  const float32x4_t vc4 = vld1q_dup_f32(&params->neon_p4.c4);
+  const float32x4_t vc3 = vld1q_dup_f32(&params->neon_p4.c3);
+  const float32x4_t vc2 = vld1q_dup_f32(&params->neon_p4.c2);
+  const float32x4_t vc1 = vld1q_dup_f32(&params->neon_p4.c1);
+  const float32x4_t vln2_hi = vld1q_dup_f32(&params->neon_p4.ln2_hi);
+  const float32x4_t vln2_lo = vld1q_dup_f32(&params->neon_p4.ln2_lo);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vtwo = vmovq_n_f32(2.0f);
+  const float32x4_t vzero = vmovq_n_f32(0.0f);
+  const float32x4_t vminus_inf = vmovq_n_f32(-INFINITY);
+  const float32x4_t vplus_inf = vmovq_n_f32(INFINITY);
+  const float32x4_t vnan = vmovq_n_f32(NAN);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(x); x += 4;
+    const float32x4_t vx4567 = vld1q_f32(x); x += 4;
+
+    const uint32x4_t vdenorm0123 = vcltq_f32(vx0123, vmin_normal);
+    const uint32x4_t vdenorm4567 = vcltq_f32(vx4567, vmin_normal);
+
+    const float32x4_t vm0123 = vbslq_f32(vdenorm0123, vmulq_f32(vx0123, vdenorm_scale), vx0123);
+    const float32x4_t vm4567 = vbslq_f32(vdenorm4567, vmulq_f32(vx4567, vdenorm_scale), vx4567);
+
+    const int32x4_t vi0123 = vsubq_s32(vreinterpretq_s32_f32(vm0123), vsqrt_half);
+    const int32x4_t vi4567 = vsubq_s32(vreinterpretq_s32_f32(vm4567), vsqrt_half);
+
+    const float32x4_t ve0123 = vsubq_f32(vcvtq_f32_s32(vshrq_n_s32(vi0123, 23)), vreinterpretq_f32_u32(vandq_u32(vdenorm0123, vreinterpretq_u32_f32(vdenorm_exponent))));
+    const float32x4_t ve4567 = vsubq_f32(vcvtq_f32_s32(vshrq_n_s32(vi4567, 23)), vreinterpretq_f32_u32(vandq_u32(vdenorm4567, vreinterpretq_u32_f32(vdenorm_exponent))));
+
+    const float32x4_t vf0123 = vsubq_f32(vreinterpretq_f32_s32(vaddq_s32(vandq_s32(vi0123, vmantissa_mask), vsqrt_half)), vone);
+    const float32x4_t vf4567 = vsubq_f32(vreinterpretq_f32_s32(vaddq_s32(vandq_s32(vi4567, vmantissa_mask), vsqrt_half)), vone);
+
+    const float32x4_t vd0123 = vaddq_f32(vtwo, vf0123);
+    const float32x4_t vd4567 = vaddq_f32(vtwo, vf4567);
+
+    float32x4_t vrecip0123 = vrecpeq_f32(vd0123);
+    float32x4_t vrecip4567 = vrecpeq_f32(vd4567);
+
+    vrecip0123 = vmulq_f32(vrecip0123, vrecpsq_f32(vrecip0123, vd0123));
+    vrecip4567 = vmulq_f32(vrecip4567, vrecpsq_f32(vrecip4567, vd4567));
+
+    vrecip0123 = vmulq_f32(vrecip0123, vrecpsq_f32(vrecip0123, vd0123));
+    vrecip4567 = vmulq_f32(vrecip4567, vrecpsq_f32(vrecip4567, vd4567));
+
+    const float32x4_t vs0123 = vmulq_f32(vf0123, vrecip0123);
+    const float32x4_t vs4567 = vmulq_f32(vf4567, vrecip4567);
+
+    const float32x4_t vz0123 = vmulq_f32(vs0123, vs0123);
+    const float32x4_t vz4567 = vmulq_f32(vs4567, vs4567);
+
+    const float32x4_t vw0123 = vmulq_f32(vz0123, vz0123);
+    const float32x4_t vw4567 = vmulq_f32(vz4567, vz4567);
+
+    const float32x4_t vr0123 = vmlaq_f32(
+        vmulq_f32(vw0123, vmlaq_f32(vc2, vw0123, vc4)),
+        vz0123, vmlaq_f32(vc1, vw0123, vc3));
+    const float32x4_t vr4567 = vmlaq_f32(
+        vmulq_f32(vw4567, vmlaq_f32(vc2, vw4567, vc4)),
+        vz4567, vmlaq_f32(vc1, vw4567, vc3));
+
+    const float32x4_t vhfsq0123 = vmulq_f32(vmulq_f32(vhalf, vf0123), vf0123);
+    const float32x4_t vhfsq4567 = vmulq_f32(vmulq_f32(vhalf, vf4567), vf4567);
+
+    float32x4_t vy0123 = vmlaq_f32(vmulq_f32(ve0123, vln2_lo), vs0123, vaddq_f32(vhfsq0123, vr0123));
+    float32x4_t vy4567 = vmlaq_f32(vmulq_f32(ve4567, vln2_lo), vs4567, vaddq_f32(vhfsq4567, vr4567));
+
+    vy0123 = vaddq_f32(vsubq_f32(vy0123, vhfsq0123), vf0123);
+    vy4567 = vaddq_f32(vsubq_f32(vy4567, vhfsq4567), vf4567);
+
+    vy0123 = vmlaq_f32(vy0123, ve0123, vln2_hi);
+    vy4567 = vmlaq_f32(vy4567, ve4567, vln2_hi);
+
+    vy0123 = vbslq_f32(vcgtq_f32(vx0123, vzero), vy0123, vnan);
+    vy4567 = vbslq_f32(vcgtq_f32(vx4567, vzero), vy4567, vnan);
+
+    vy0123 = vbslq_f32(vceqq_f32(vx0123, vzero), vminus_inf, vy0123);
+    vy4567 = vbslq_f32(vceqq_f32(vx4567, vzero), vminus_inf, vy4567);
+
+    vy0123 = vbslq_f32(vceqq_f32(vx0123, vplus_inf), vplus_inf, vy0123);
+    vy4567 = vbslq_f32(vceqq_f32(vx4567, vplus_inf), vplus_inf, vy4567);
+
+    vst1q_f32(y, vy0123); y += 4;
+    vst1q_f32(y, vy4567); y += 4;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    const uint32x4_t vdenorm = vcltq_f32(vx, vmin_normal);
+    const float32x4_t vm = vbslq_f32(vdenorm, vmulq_f32(vx, vdenorm_scale), vx);
+
+    const int32x4_t vi = vsubq_s32(vreinterpretq_s32_f32(vm), vsqrt_half);
+    const float32x4_t ve = vsubq_f32(vcvtq_f32_s32(vshrq_n_s32(vi, 23)), vreinterpretq_f32_u32(vandq_u32(vdenorm, vreinterpretq_u32_f32(vdenorm_exponent))));
+    const float32x4_t vf = vsubq_f32(vreinterpretq_f32_s32(vaddq_s32(vandq_s32(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const float32x4_t vd = vaddq_f32(vtwo, vf);
+    float32x4_t vrecip = vrecpeq_f32(vd);
+    vrecip = vmulq_f32(vrecip, vrecpsq_f32(vrecip, vd));
+    vrecip = vmulq_f32(vrecip, vrecpsq_f32(vrecip, vd));
+    const float32x4_t vs = vmulq_f32(vf, vrecip);
+    const float32x4_t vz = vmulq_f32(vs, vs);
+    const float32x4_t vw = vmulq_f32(vz, vz);
+    const float32x4_t vr = vmlaq_f32(
+        vmulq_f32(vw, vmlaq_f32(vc2, vw, vc4)),
+        vz, vmlaq_f32(vc1, vw, vc3));
+    const float32x4_t vhfsq = vmulq_f32(vmulq_f32(vhalf, vf), vf);
+
+    float32x4_t vy = vmlaq_f32(vmulq_f32(ve, vln2_lo), vs, vaddq_f32(vhfsq, vr));
+    vy = vaddq_f32(vsubq_f32(vy, vhfsq), vf);
+    vy = vmlaq_f32(vy, ve, vln2_hi);
+
+    vy = vbslq_f32(vcgtq_f32(vx, vzero), vy, vnan);
+    vy = vbslq_f32(vceqq_f32(vx, vzero), vminus_inf, vy);
+    vy = vbslq_f32(vceqq_f32(vx, vplus_inf), vplus_inf, vy);
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    const uint32x4_t vdenorm = vcltq_f32(vx, vmin_normal);
+    const float32x4_t vm = vbslq_f32(vdenorm, vmulq_f32(vx, vdenorm_scale), vx);
+
+    const int32x4_t vi = vsubq_s32(vreinterpretq_s32_f32(vm), vsqrt_half);
+    const float32x4_t ve = vsubq_f32(vcvtq_f32_s32(vshrq_n_s32(vi, 23)), vreinterpretq_f32_u32(vandq_u32(vdenorm, vreinterpretq_u32_f32(vdenorm_exponent))));
+    const float32x4_t vf = vsubq_f32(vreinterpretq_f32_s32(vaddq_s32(vandq_s32(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const float32x4_t vd = vaddq_f32(vtwo, vf);
+    float32x4_t vrecip = vrecpeq_f32(vd);
+    vrecip = vmulq_f32(vrecip, vrecpsq_f32(vrecip, vd));
+    vrecip = vmulq_f32(vrecip, vrecpsq_f32(vrecip, vd));
+    const float32x4_t vs = vmulq_f32(vf, vrecip);
+    const float32x4_t vz = vmulq_f32(vs, vs);
+    const float32x4_t vw = vmulq_f32(vz, vz);
+    const float32x4_t vr = vmlaq_f32(
+        vmulq_f32(vw, vmlaq_f32(vc2, vw, vc4)),
+        vz, vmlaq_f32(vc1, vw, vc3));
+    const float32x4_t vhfsq = vmulq_f32(vmulq_f32(vhalf, vf), vf);
+
+    float32x4_t vy = vmlaq_f32(vmulq_f32(ve, vln2_lo), vs, vaddq_f32(vhfsq, vr));
+    vy = vaddq_f32(vsubq_f32(vy, vhfsq), vf);
+    vy = vmlaq_f32(vy, ve, vln2_hi);
+
+    vy = vbslq_f32(vcgtq_f32(vx, vzero), vy, vnan);
+    vy = vbslq_f32(vceqq_f32(vx, vzero), vminus_inf, vy);
+    vy = vbslq_f32(vceqq_f32(vx, vplus_inf), vplus_inf, vy);
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,75 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlog/scalar-p4-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+#include <fp16/bitcasts.h>
+
+
+void xnn_f32_vlog_ukernel__scalar_p4_div_x1(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_log_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const float vmin_normal = params->scalar_p4.min_normal;
+  const float vdenorm_scale = params->scalar_p4.denorm_scale;
+  const float vdenorm_exponent = params->scalar_p4.denorm_exponent;
+  const int32_t vsqrt_half = params->scalar_p4.sqrt_half;
+  const int32_t vmantissa_mask = params->scalar_p4.mantissa_mask;
+  const float vone = params->scalar_p4.one;
+  const float vtwo = params->scalar_p4.two;
+  const float vhalf = params->scalar_p4.half;
+  const float vc4 = params->scalar_p4.c4;
+  const float vc3 = params->scalar_p4.c3;
+  const float vc2 = params->scalar_p4.c2;
+  const float vc1 = params->scalar_p4.c1;
+  const float vln2_hi = params->scalar_p4.ln2_hi;
+  const float vln2_lo = params->scalar_p4.ln2_lo;
+
+  do {
+    const float vx = *x++;
+
+    float vm = vx;
+    float vdenorm_adj = 0.0f;
+    if XNN_UNPREDICTABLE(vx < vmin_normal) {
+      vm = vx * vdenorm_scale;
+      vdenorm_adj = vdenorm_exponent;
+    }
+
+    const uint32_t vi = fp32_to_bits(vm) - (uint32_t) vsqrt_half;
+    const float ve = (float) asr_s32((int32_t) vi, 23) - vdenorm_adj;
+    const float vf = fp32_from_bits((vi & (uint32_t) vmantissa_mask) + (uint32_t) vsqrt_half) - vone;
+
+    const float vs = vf / (vtwo + vf);
+    const float vz = vs * vs;
+    const float vw = vz * vz;
+    const float vr = vz * (vw * vc3 + vc1) + vw * (vw * vc4 + vc2);
+    const float vhfsq = vhalf * vf * vf;
+    float vy = ((vs * (vhfsq + vr) + ve * vln2_lo) - vhfsq + vf) + ve * vln2_hi;
+
+    if XNN_UNPREDICTABLE(!(vx > 0.0f)) {
+      vy = vx == 0.0f ? -INFINITY : NAN;
+    }
+    if XNN_UNPREDICTABLE(vx == INFINITY) {
+      vy = INFINITY;
+    }
+
+    *y++ = vy;
+
+    n -= sizeof(float);
+  } while (n != 0);
+}
@@ -0,0 +1,186 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vlog/sse2-p4-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vlog_ukernel__sse2_p4_div_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_log_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m128 vmin_normal = _mm_load_ps(params->sse2_p4.min_normal);
+  const __m128 vdenorm_scale = _mm_load_ps(params->sse2_p4.denorm_scale);
+  const __m128 vdenorm_exponent = _mm_load_ps(params->sse2_p4.denorm_exponent);
+  const __m128i vsqrt_half = _mm_load_si128((const __m128i*) params->sse2_p4.sqrt_half);
+  const __m128i vmantissa_mask = _mm_load_si128((const __m128i*) params->sse2_p4.mantissa_mask);
+  const __m128 vone = _mm_load_ps(params->sse2_p4.one);
+  const __m128 vtwo = _mm_load_ps(params->sse2_p4.two);
+  const __m128 vhalf = _mm_load_ps(params->sse2_p4.half);
+  const __m128 vc4 = _mm_load_ps(params->sse2_p4.c4);
+  const __m128 vc3 = _mm_load_ps(params->sse2_p4.c3);
+  const __m128 vc2 = _mm_load_ps(params->sse2_p4.c2);
+  const __m128 vc1 = _mm_load_ps(params->sse2_p4.c1);
+  const __m128 vln2_hi = _mm_load_ps(params->sse2_p4.ln2_hi);
+  const __m128 vln2_lo = _mm_load_ps(params->sse2_p4.ln2_lo);
+  const __m128 vminus_inf = _mm_load_ps(params->sse2_p4.minus_inf);
+  const __m128 vplus_inf = _mm_load_ps(params->sse2_p4.plus_inf);
+  const __m128 vnan = _mm_load_ps(params->sse2_p4.nan);
+  const __m128 vzero = _mm_setzero_ps();
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m128 vx0123 = _mm_loadu_ps(x);
+    const __m128 vx4567 = _mm_loadu_ps(x + 4);
+    x += 8;
+
+    const __m128 vdenorm0123 = _mm_cmplt_ps(vx0123, vmin_normal);
+    const __m128 vdenorm4567 = _mm_cmplt_ps(vx4567, vmin_normal);
+
+    const __m128 vm0123 = _mm_or_ps(_mm_and_ps(vdenorm0123, _mm_mul_ps(vx0123, vdenorm_scale)), _mm_andnot_ps(vdenorm0123, vx0123));
+    const __m128 vm4567 = _mm_or_ps(_mm_and_ps(vdenorm4567, _mm_mul_ps(vx4567, vdenorm_scale)), _mm_andnot_ps(vdenorm4567, vx4567));
+
+    const __m128i vi0123 = _mm_sub_epi32(_mm_castps_si128(vm0123), vsqrt_half);
+    const __m128i vi4567 = _mm_sub_epi32(_mm_castps_si128(vm4567), vsqrt_half);
+
+    const __m128 ve0123 = _mm_sub_ps(_mm_cvtepi32_ps(_mm_srai_epi32(vi0123, 23)), _mm_and_ps(vdenorm0123, vdenorm_exponent));
+    const __m128 ve4567 = _mm_sub_ps(_mm_cvtepi32_ps(_mm_srai_epi32(vi4567, 23)), _mm_and_ps(vdenorm4567, vdenorm_exponent));
+
+    const __m128 vf0123 = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(vi0123, vmantissa_mask), vsqrt_half)), vone);
+    const __m128 vf4567 = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(vi4567, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m128 vs0123 = _mm_div_ps(vf0123, _mm_add_ps(vtwo, vf0123));
+    const __m128 vs4567 = _mm_div_ps(vf4567, _mm_add_ps(vtwo, vf4567));
+
+    const __m128 vz0123 = _mm_mul_ps(vs0123, vs0123);
+    const __m128 vz4567 = _mm_mul_ps(vs4567, vs4567);
+
+    const __m128 vw0123 = _mm_mul_ps(vz0123, vz0123);
+    const __m128 vw4567 = _mm_mul_ps(vz4567, vz4567);
+
+    const __m128 vr0123 = _mm_add_ps(
+        _mm_mul_ps(vz0123, _mm_add_ps(_mm_mul_ps(vw0123, vc3), vc1)),
+        _mm_mul_ps(vw0123, _mm_add_ps(_mm_mul_ps(vw0123, vc4), vc2)));
+    const __m128 vr4567 = _mm_add_ps(
+        _mm_mul_ps(vz4567, _mm_add_ps(_mm_mul_ps(vw4567, vc3), vc1)),
+        _mm_mul_ps(vw4567, _mm_add_ps(_mm_mul_ps(vw4567, vc4), vc2)));
+
+    const __m128 vhfsq0123 = _mm_mul_ps(_mm_mul_ps(vhalf, vf0123), vf0123);
+    const __m128 vhfsq4567 = _mm_mul_ps(_mm_mul_ps(vhalf, vf4567), vf4567);
+
+    __m128 vy0123 = _mm_add_ps(_mm_mul_ps(vs0123, _mm_add_ps(vhfsq0123, vr0123)), _mm_mul_ps(ve0123, vln2_lo));
+    __m128 vy4567 = _mm_add_ps(_mm_mul_ps(vs4567, _mm_add_ps(vhfsq4567, vr4567)), _mm_mul_ps(ve4567, vln2_lo));
+
+    vy0123 = _mm_add_ps(_mm_sub_ps(vy0123, vhfsq0123), vf0123);
+    vy4567 = _mm_add_ps(_mm_sub_ps(vy4567, vhfsq4567), vf4567);
+
+    vy0123 = _mm_add_ps(vy0123, _mm_mul_ps(ve0123, vln2_hi));
+    vy4567 = _mm_add_ps(vy4567, _mm_mul_ps(ve4567, vln2_hi));
+
+    const __m128 vinvalid0123 = _mm_cmpngt_ps(vx0123, vzero);
+    const __m128 vinvalid4567 = _mm_cmpngt_ps(vx4567, vzero);
+
+    vy0123 = _mm_or_ps(_mm_and_ps(vinvalid0123, vnan), _mm_andnot_ps(vinvalid0123, vy0123));
+    vy4567 = _mm_or_ps(_mm_and_ps(vinvalid4567, vnan), _mm_andnot_ps(vinvalid4567, vy4567));
+
+    const __m128 vzero_mask0123 = _mm_cmpeq_ps(vx0123, vzero);
+    const __m128 vzero_mask4567 = _mm_cmpeq_ps(vx4567, vzero);
+
+    vy0123 = _mm_or_ps(_mm_and_ps(vzero_mask0123, vminus_inf), _mm_andnot_ps(vzero_mask0123, vy0123));
+    vy4567 = _mm_or_ps(_mm_and_ps(vzero_mask4567, vminus_inf), _mm_andnot_ps(vzero_mask4567, vy4567));
+
+    const __m128 vinf_mask0123 = _mm_cmpeq_ps(vx0123, vplus_inf);
+    const __m128 vinf_mask4567 = _mm_cmpeq_ps(vx4567, vplus_inf);
+
+    vy0123 = _mm_or_ps(_mm_and_ps(vinf_mask0123, vplus_inf), _mm_andnot_ps(vinf_mask0123, vy0123));
+    vy4567 = _mm_or_ps(_mm_and_ps(vinf_mask4567, vplus_inf), _mm_andnot_ps(vinf_mask4567, vy4567));
+
+    _mm_storeu_ps(y, vy0123);
+    _mm_storeu_ps(y + 4, vy4567);
+    y += 8;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const __m128 vx = _mm_loadu_ps(x);
+    x += 4;
+
+    const __m128 vdenorm = _mm_cmplt_ps(vx, vmin_normal);
+    const __m128 vm = _mm_or_ps(_mm_and_ps(vdenorm, _mm_mul_ps(vx, vdenorm_scale)), _mm_andnot_ps(vdenorm, vx));
+
+    const __m128i vi = _mm_sub_epi32(_mm_castps_si128(vm), vsqrt_half);
+    const __m128 ve = _mm_sub_ps(_mm_cvtepi32_ps(_mm_srai_epi32(vi, 23)), _mm_and_ps(vdenorm, vdenorm_exponent));
+    const __m128 vf = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m128 vs = _mm_div_ps(vf, _mm_add_ps(vtwo, vf));
+    const __m128 vz = _mm_mul_ps(vs, vs);
+    const __m128 vw = _mm_mul_ps(vz, vz);
+    const __m128 vr = _mm_add_ps(
+        _mm_mul_ps(vz, _mm_add_ps(_mm_mul_ps(vw, vc3), vc1)),
+        _mm_mul_ps(vw, _mm_add_ps(_mm_mul_ps(vw, vc4), vc2)));
+    const __m128 vhfsq = _mm_mul_ps(_mm_mul_ps(vhalf, vf), vf);
+
+    __m128 vy = _mm_add_ps(_mm_mul_ps(vs, _mm_add_ps(vhfsq, vr)), _mm_mul_ps(ve, vln2_lo));
+    vy = _mm_add_ps(_mm_sub_ps(vy, vhfsq), vf);
+    vy = _mm_add_ps(vy, _mm_mul_ps(ve, vln2_hi));
+
+    const __m128 vinvalid = _mm_cmpngt_ps(vx, vzero);
+    vy = _mm_or_ps(_mm_and_ps(vinvalid, vnan), _mm_andnot_ps(vinvalid, vy));
+    const __m128 vzero_mask = _mm_cmpeq_ps(vx, vzero);
+    vy = _mm_or_ps(_mm_and_ps(vzero_mask, vminus_inf), _mm_andnot_ps(vzero_mask, vy));
+    const __m128 vinf_mask = _mm_cmpeq_ps(vx, vplus_inf);
+    vy = _mm_or_ps(_mm_and_ps(vinf_mask, vplus_inf), _mm_andnot_ps(vinf_mask, vy));
+
+    _mm_storeu_ps(y, vy);
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const __m128 vx = _mm_loadu_ps(x);
+
+    const __m128 vdenorm = _mm_cmplt_ps(vx, vmin_normal);
+    const __m128 vm = _mm_or_ps(_mm_and_ps(vdenorm, _mm_mul_ps(vx, vdenorm_scale)), _mm_andnot_ps(vdenorm, vx));
+
+    const __m128i vi = _mm_sub_epi32(_mm_castps_si128(vm), vsqrt_half);
+    const __m128 ve = _mm_sub_ps(_mm_cvtepi32_ps(_mm_srai_epi32(vi, 23)), _mm_and_ps(vdenorm, vdenorm_exponent));
+    const __m128 vf = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(vi, vmantissa_mask), vsqrt_half)), vone);
+
+    const __m128 vs = _mm_div_ps(vf, _mm_add_ps(vtwo, vf));
+    const __m128 vz = _mm_mul_ps(vs, vs);
+    const __m128 vw = _mm_mul_ps(vz, vz);
+    const __m128 vr = _mm_add_ps(
+        _mm_mul_ps(vz, _mm_add_ps(_mm_mul_ps(vw, vc3), vc1)),
+        _mm_mul_ps(vw, _mm_add_ps(_mm_mul_ps(vw, vc4), vc2)));
+    const __m128 vhfsq = _mm_mul_ps(_mm_mul_ps(vhalf, vf), vf);
+
+    __m128 vy = _mm_add_ps(_mm_mul_ps(vs, _mm_add_ps(vhfsq, vr)), _mm_mul_ps(ve, vln2_lo));
+    vy = _mm_add_ps(_mm_sub_ps(vy, vhfsq), vf);
+    vy = _mm_add_ps(vy, _mm_mul_ps(ve, vln2_hi));
+
+    const __m128 vinvalid = _mm_cmpngt_ps(vx, vzero);
+    vy = _mm_or_ps(_mm_and_ps(vinvalid, vnan), _mm_andnot_ps(vinvalid, vy));
+    const __m128 vzero_mask = _mm_cmpeq_ps(vx, vzero);
+    vy = _mm_or_ps(_mm_and_ps(vzero_mask, vminus_inf), _mm_andnot_ps(vzero_mask, vy));
+    const __m128 vinf_mask = _mm_cmpeq_ps(vx, vplus_inf);
+    vy = _mm_or_ps(_mm_and_ps(vinf_mask, vplus_inf), _mm_andnot_ps(vinf_mask, vy));
+
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy);
+      vy = _mm_movehl_ps(vy, vy);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy);
+    }
+  }
+}
@@ -0,0 +1,179 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/avx2-expm1minus-rr1-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x16(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m256 vsign_mask = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sign_mask);
+  const __m256 vsat_cutoff = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sat_cutoff);
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.magic_bias);
+  const __m256 vminus_ln2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_ln2);
+  const __m256 vc6 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c6);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c2);
+  const __m256 vminus_two = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_two);
+  const __m256 vone = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.one);
+
+  for (; n >= 16 * sizeof(float); n -= 16 * sizeof(float)) {
+    const __m256 vx0 = _mm256_loadu_ps(x);
+    const __m256 vx1 = _mm256_loadu_ps(x + 8);
+    x += 16;
+
+    __m256 vz0 = _mm256_or_ps(vx0, vsign_mask);
+    __m256 vz1 = _mm256_or_ps(vx1, vsign_mask);
+
+    vz0 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz0, vz0));
+    vz1 = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz1, vz1));
+
+    __m256 vn0 = _mm256_fmadd_ps(vz0, vlog2e, vmagic_bias);
+    __m256 vn1 = _mm256_fmadd_ps(vz1, vlog2e, vmagic_bias);
+
+    const __m256 vs0 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn0), 23));
+    const __m256 vs1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn1), 23));
+
+    vn0 = _mm256_sub_ps(vn0, vmagic_bias);
+    vn1 = _mm256_sub_ps(vn1, vmagic_bias);
+
+    __m256 vt0 = _mm256_fmadd_ps(vn0, vminus_ln2, vz0);
+    __m256 vt1 = _mm256_fmadd_ps(vn1, vminus_ln2, vz1);
+
+    __m256 vp0 = _mm256_fmadd_ps(vc6, vt0, vc5);
+    __m256 vp1 = _mm256_fmadd_ps(vc6, vt1, vc5);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc4);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc4);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc3);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc3);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vc2);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vc2);
+
+    vp0 = _mm256_mul_ps(vp0, vt0);
+    vp1 = _mm256_mul_ps(vp1, vt1);
+
+    vt0 = _mm256_mul_ps(vt0, vs0);
+    vt1 = _mm256_mul_ps(vt1, vs1);
+
+    const __m256 vsm10 = _mm256_sub_ps(vs0, vone);
+    const __m256 vsm11 = _mm256_sub_ps(vs1, vone);
+
+    vp0 = _mm256_fmadd_ps(vp0, vt0, vt0);
+    vp1 = _mm256_fmadd_ps(vp1, vt1, vt1);
+
+    const __m256 vem10 = _mm256_add_ps(vp0, vsm10);
+    const __m256 vem11 = _mm256_add_ps(vp1, vsm11);
+
+    const __m256 vd0 = _mm256_sub_ps(vminus_two, vem10);
+    const __m256 vd1 = _mm256_sub_ps(vminus_two, vem11);
+
+    const __m256 vabsy0 = _mm256_div_ps(vem10, vd0);
+    const __m256 vabsy1 = _mm256_div_ps(vem11, vd1);
+
+    const __m256 vy0 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy0), _mm256_and_ps(vsign_mask, vx0));
+    const __m256 vy1 = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy1), _mm256_and_ps(vsign_mask, vx1));
+
+    _mm256_storeu_ps(y, vy0);
+    _mm256_storeu_ps(y + 8, vy1);
+    y += 16;
+  }
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vem1 = _mm256_add_ps(vp, vsm1);
+
+    const __m256 vd = _mm256_sub_ps(vminus_two, vem1);
+    const __m256 vabsy = _mm256_div_ps(vem1, vd);
+    const __m256 vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy), _mm256_and_ps(vsign_mask, vx));
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx2_expm1minus_rr1_p6.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vem1 = _mm256_add_ps(vp, vsm1);
+
+    const __m256 vd = _mm256_sub_ps(vminus_two, vem1);
+    const __m256 vabsy = _mm256_div_ps(vem1, vd);
+    const __m256 vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy), _mm256_and_ps(vsign_mask, vx));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
@@ -0,0 +1,116 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/avx2-expm1minus-rr1-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const __m256 vsign_mask = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sign_mask);
+  const __m256 vsat_cutoff = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.sat_cutoff);
+  const __m256 vlog2e = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.log2e);
+  const __m256 vmagic_bias = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.magic_bias);
+  const __m256 vminus_ln2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_ln2);
+  const __m256 vc6 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c6);
+  const __m256 vc5 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c5);
+  const __m256 vc4 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c4);
+  const __m256 vc3 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c3);
+  const __m256 vc2 = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.c2);
+  const __m256 vminus_two = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.minus_two);
+  const __m256 vone = _mm256_load_ps(params->avx2_expm1minus_rr1_p6.one);
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const __m256 vx = _mm256_loadu_ps(x);
+    x += 8;
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vem1 = _mm256_add_ps(vp, vsm1);
+
+    const __m256 vd = _mm256_sub_ps(vminus_two, vem1);
+    const __m256 vabsy = _mm256_div_ps(vem1, vd);
+    const __m256 vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy), _mm256_and_ps(vsign_mask, vx));
+
+    _mm256_storeu_ps(y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(float));
+    assert(n <= 7 * sizeof(float));
+    const __m256i vmask = _mm256_loadu_si256((const __m256i*) ((uintptr_t) &params->avx2_expm1minus_rr1_p6.mask_table[7] - n));
+
+    const __m256 vx = _mm256_maskload_ps(x, vmask);
+
+    __m256 vz = _mm256_or_ps(vx, vsign_mask);
+    vz = _mm256_max_ps(vsat_cutoff, _mm256_add_ps(vz, vz));
+
+    __m256 vn = _mm256_fmadd_ps(vz, vlog2e, vmagic_bias);
+    const __m256 vs = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(vn), 23));
+    vn = _mm256_sub_ps(vn, vmagic_bias);
+
+    __m256 vt = _mm256_fmadd_ps(vn, vminus_ln2, vz);
+
+    __m256 vp = _mm256_fmadd_ps(vc6, vt, vc5);
+    vp = _mm256_fmadd_ps(vp, vt, vc4);
+    vp = _mm256_fmadd_ps(vp, vt, vc3);
+    vp = _mm256_fmadd_ps(vp, vt, vc2);
+    vp = _mm256_mul_ps(vp, vt);
+
+    vt = _mm256_mul_ps(vt, vs);
+    const __m256 vsm1 = _mm256_sub_ps(vs, vone);
+    vp = _mm256_fmadd_ps(vp, vt, vt);
+    const __m256 vem1 = _mm256_add_ps(vp, vsm1);
+
+    const __m256 vd = _mm256_sub_ps(vminus_two, vem1);
+    const __m256 vabsy = _mm256_div_ps(vem1, vd);
+    const __m256 vy = _mm256_or_ps(_mm256_andnot_ps(vsign_mask, vabsy), _mm256_and_ps(vsign_mask, vx));
+
+    __m128 vy_lo = _mm256_castps256_ps128(vy);
+    if (n & (4 * sizeof(float))) {
+      _mm_storeu_ps(y, vy_lo);
+      vy_lo = _mm256_extractf128_ps(vy, 1);
+      y += 4;
+    }
+    if (n & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) y, vy_lo);
+      vy_lo = _mm_movehl_ps(vy_lo, vy_lo);
+      y += 2;
+    }
+    if (n & (1 * sizeof(float))) {
+      _mm_store_ss(y, vy_lo);
+    }
+  }
+}
@@ -0,0 +1,163 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/neon-expm1minus-p6.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x8(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const float32x4_t vsat_cutoff = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.sat_cutoff);
+  const float32x4_t vlog2e = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.log2e);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.magic_bias);
+  const float32x4_t vminus_ln2 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.minus_ln2);
+  const float32x4_t vc6 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c6);
+  const float32x4_t vc5 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c5);
+  const float32x4_t vc4 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c4);
+  const float32x4_t vc3 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c3);
+  const float32x4_t vc2 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c2);
+  const float32x4_t vminus_two = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.minus_two);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const uint32x4_t vsign_mask = vmovq_n_u32(UINT32_C(0x80000000));
+
+  for (; n >= 8 * sizeof(float); n -= 8 * sizeof(float)) {
+    const float32x4_t vx0123 = vld1q_f32(x); x += 4;
+    const float32x4_t vx4567 = vld1q_f32(x); x += 4;
+
+    float32x4_t vz0123 = vmulq_f32(vabsq_f32(vx0123), vminus_two);
+    float32x4_t vz4567 = vmulq_f32(vabsq_f32(vx4567), vminus_two);
+
+    vz0123 = vmaxq_f32(vsat_cutoff, vz0123);
+    vz4567 = vmaxq_f32(vsat_cutoff, vz4567);
+
+    float32x4_t vn0123 = vfmaq_f32(vmagic_bias, vz0123, vlog2e);
+    float32x4_t vn4567 = vfmaq_f32(vmagic_bias, vz4567, vlog2e);
+
+    const float32x4_t vs0123 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn0123), 23));
+    const float32x4_t vs4567 = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn4567), 23));
+
+    vn0123 = vsubq_f32(vn0123, vmagic_bias);
+    vn4567 = vsubq_f32(vn4567, vmagic_bias);
+
+    float32x4_t vt0123 = vfmaq_f32(vz0123, vn0123, vminus_ln2);
+    float32x4_t vt4567 = vfmaq_f32(vz4567, vn4567, vminus_ln2);
+
+    float32x4_t vp0123 = vfmaq_f32(vc5, vc6, vt0123);
+    float32x4_t vp4567 = vfmaq_f32(vc5, vc6, vt4567);
+
+    vp0123 = vfmaq_f32(vc4, vp0123, vt0123);
+    vp4567 = vfmaq_f32(vc4, vp4567, vt4567);
+
+    vp0123 = vfmaq_f32(vc3, vp0123, vt0123);
+    vp4567 = vfmaq_f32(vc3, vp4567, vt4567);
+
+    vp0123 = vfmaq_f32(vc2, vp0123, vt0123);
+    vp4567 = vfmaq_f32(vc2, vp4567, vt4567);
+
+    vp0123 = vmulq_f32(vp0123, vt0123);
+    vp4567 = vmulq_f32(vp4567, vt4567);
+
+    vt0123 = vmulq_f32(vt0123, vs0123);
+    vt4567 = vmulq_f32(vt4567, vs4567);
+
+    const float32x4_t vsm10123 = vsubq_f32(vs0123, vone);
+    const float32x4_t vsm14567 = vsubq_f32(vs4567, vone);
+
+    vp0123 = vfmaq_f32(vt0123, vp0123, vt0123);
+    vp4567 = vfmaq_f32(vt4567, vp4567, vt4567);
+
+    const float32x4_t vem10123 = vaddq_f32(vp0123, vsm10123);
+    const float32x4_t vem14567 = vaddq_f32(vp4567, vsm14567);
+
+    const float32x4_t vd0123 = vsubq_f32(vminus_two, vem10123);
+    const float32x4_t vd4567 = vsubq_f32(vminus_two, vem14567);
+
+    const float32x4_t vabsy0123 = vdivq_f32(vem10123, vd0123);
+    const float32x4_t vabsy4567 = vdivq_f32(vem14567, vd4567);
+
+    const float32x4_t vy0123 = vbslq_f32(vsign_mask, vx0123, vabsq_f32(vabsy0123));
+    const float32x4_t vy4567 = vbslq_f32(vsign_mask, vx4567, vabsq_f32(vabsy4567));
+
+    vst1q_f32(y, vy0123); y += 4;
+    vst1q_f32(y, vy4567); y += 4;
+  }
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    float32x4_t vz = vmulq_f32(vabsq_f32(vx), vminus_two);
+    vz = vmaxq_f32(vsat_cutoff, vz);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vlog2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vfmaq_f32(vz, vn, vminus_ln2);
+
+    float32x4_t vp = vfmaq_f32(vc5, vc6, vt);
+    vp = vfmaq_f32(vc4, vp, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vmulq_f32(vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t vsm1 = vsubq_f32(vs, vone);
+    vp = vfmaq_f32(vt, vp, vt);
+    const float32x4_t vem1 = vaddq_f32(vp, vsm1);
+
+    const float32x4_t vd = vsubq_f32(vminus_two, vem1);
+    const float32x4_t vabsy = vdivq_f32(vem1, vd);
+    const float32x4_t vy = vbslq_f32(vsign_mask, vx, vabsq_f32(vabsy));
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    float32x4_t vz = vmulq_f32(vabsq_f32(vx), vminus_two);
+    vz = vmaxq_f32(vsat_cutoff, vz);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vlog2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vfmaq_f32(vz, vn, vminus_ln2);
+
+    float32x4_t vp = vfmaq_f32(vc5, vc6, vt);
+    vp = vfmaq_f32(vc4, vp, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vmulq_f32(vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t vsm1 = vsubq_f32(vs, vone);
+    vp = vfmaq_f32(vt, vp, vt);
+    const float32x4_t vem1 = vaddq_f32(vp, vsm1);
+
+    const float32x4_t vd = vsubq_f32(vminus_two, vem1);
+    const float32x4_t vabsy = vdivq_f32(vem1, vd);
+    const float32x4_t vy = vbslq_f32(vsign_mask, vx, vabsq_f32(vabsy));
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,108 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/neon-expm1minus-p6.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x4(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n % sizeof(float) == 0);
+
+  const float32x4_t vsat_cutoff = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.sat_cutoff);
+  const float32x4_t vlog2e = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.log2e);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.magic_bias);
+  const float32x4_t vminus_ln2 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.minus_ln2);
+  const float32x4_t vc6 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c6);
+  const float32x4_t vc5 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c5);
+  const float32x4_t vc4 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c4);
+  const float32x4_t vc3 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c3);
+  const float32x4_t vc2 = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.c2);
+  const float32x4_t vminus_two = vld1q_dup_f32(&params->neonfma_expm1minus_rr1_p6.minus_two);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const uint32x4_t vsign_mask = vmovq_n_u32(UINT32_C(0x80000000));
+
+  for (; n >= 4 * sizeof(float); n -= 4 * sizeof(float)) {
+    const float32x4_t vx = vld1q_f32(x); x += 4;
+
+    float32x4_t vz = vmulq_f32(vabsq_f32(vx), vminus_two);
+    vz = vmaxq_f32(vsat_cutoff, vz);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vlog2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vfmaq_f32(vz, vn, vminus_ln2);
+
+    float32x4_t vp = vfmaq_f32(vc5, vc6, vt);
+    vp = vfmaq_f32(vc4, vp, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vmulq_f32(vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t vsm1 = vsubq_f32(vs, vone);
+    vp = vfmaq_f32(vt, vp, vt);
+    const float32x4_t vem1 = vaddq_f32(vp, vsm1);
+
+    const float32x4_t vd = vsubq_f32(vminus_two, vem1);
+    float32x4_t vr = vrecpeq_f32(vd);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    const float32x4_t vabsy = vmulq_f32(vem1, vr);
+    const float32x4_t vy = vbslq_f32(vsign_mask, vx, vabsq_f32(vabsy));
+
+    vst1q_f32(y, vy); y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float32x4_t vx = vld1q_f32(x);
+
+    float32x4_t vz = vmulq_f32(vabsq_f32(vx), vminus_two);
+    vz = vmaxq_f32(vsat_cutoff, vz);
+
+    float32x4_t vn = vfmaq_f32(vmagic_bias, vz, vlog2e);
+    const float32x4_t vs = vreinterpretq_f32_s32(vshlq_n_s32(vreinterpretq_s32_f32(vn), 23));
+    vn = vsubq_f32(vn, vmagic_bias);
+    float32x4_t vt = vfmaq_f32(vz, vn, vminus_ln2);
+
+    float32x4_t vp = vfmaq_f32(vc5, vc6, vt);
+    vp = vfmaq_f32(vc4, vp, vt);
+    vp = vfmaq_f32(vc3, vp, vt);
+    vp = vfmaq_f32(vc2, vp, vt);
+    vp = vmulq_f32(vp, vt);
+
+    vt = vmulq_f32(vt, vs);
+    const float32x4_t vsm1 = vsubq_f32(vs, vone);
+    vp = vfmaq_f32(vt, vp, vt);
+    const float32x4_t vem1 = vaddq_f32(vp, vsm1);
+
+    const float32x4_t vd = vsubq_f32(vminus_two, vem1);
+    float32x4_t vr = vrecpeq_f32(vd);
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    vr = vmulq_f32(vr, vrecpsq_f32(vr, vd));
+    const float32x4_t vabsy = vmulq_f32(vem1, vr);
+    const float32x4_t vy = vbslq_f32(vsign_mask, vx, vabsq_f32(vabsy));
+
+    float32x2_t vy_lo = vget_low_f32(vy);
+    if (n & (2 * sizeof(float))) {
+      vst1_f32(y, vy_lo); y += 2;
+      vy_lo = vget_high_f32(vy);
+    }
+    if (n & (1 * sizeof(float))) {
+      vst1_lane_f32(y, vy_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,141 @@
+// Auto-generated file. Do not edit!
+//   Template: src/f32-vtanh/scalar-expm1minus-rr2-p6-div.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+#include <fp16/bitcasts.h>
+
+
+void xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x2(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n % sizeof(float) == 0);
+
+  const float vsat_cutoff = params->scalar_expm1minus_rr2_p6.sat_cutoff;
+  const float vlog2e = params->scalar_expm1minus_rr2_p6.log2e;
+  const float vmagic_bias = params->scalar_expm1minus_rr2_p6.magic_bias;
+  const float vminus_ln2_hi = params->scalar_expm1minus_rr2_p6.minus_ln2_hi;
+  const float vminus_ln2_lo = params->scalar_expm1minus_rr2_p6.minus_ln2_lo;
+  const float vc6 = params->scalar_expm1minus_rr2_p6.c6;
+  const float vc5 = params->scalar_expm1minus_rr2_p6.c5;
+  const float vc4 = params->scalar_expm1minus_rr2_p6.c4;
+  const float vc3 = params->scalar_expm1minus_rr2_p6.c3;
+  const float vc2 = params->scalar_expm1minus_rr2_p6.c2;
+  const float vminus_two = params->scalar_expm1minus_rr2_p6.minus_two;
+  const float vone = params->scalar_expm1minus_rr2_p6.one;
+
+  for (; n >= 2 * sizeof(float); n -= 2 * sizeof(float)) {
+    const float vx0 = x[0];
+    const float vx1 = x[1];
+    x += 2;
+
+    float vz0 = fabsf(vx0) * vminus_two;
+    float vz1 = fabsf(vx1) * vminus_two;
+
+    if XNN_UNPREDICTABLE(vz0 < vsat_cutoff) {
+      vz0 = vsat_cutoff;
+    }
+    if XNN_UNPREDICTABLE(vz1 < vsat_cutoff) {
+      vz1 = vsat_cutoff;
+    }
+
+    float vn0 = vz0 * vlog2e + vmagic_bias;
+    float vn1 = vz1 * vlog2e + vmagic_bias;
+
+    const float vs0 = fp32_from_bits(fp32_to_bits(vn0) << 23);
+    const float vs1 = fp32_from_bits(fp32_to_bits(vn1) << 23);
+
+    vn0 -= vmagic_bias;
+    vn1 -= vmagic_bias;
+
+    float vt0 = vn0 * vminus_ln2_hi + vz0;
+    float vt1 = vn1 * vminus_ln2_hi + vz1;
+
+    vt0 = vn0 * vminus_ln2_lo + vt0;
+    vt1 = vn1 * vminus_ln2_lo + vt1;
+
+    float vp0 = vc6 * vt0 + vc5;
+    float vp1 = vc6 * vt1 + vc5;
+
+    vp0 = vp0 * vt0 + vc4;
+    vp1 = vp1 * vt1 + vc4;
+
+    vp0 = vp0 * vt0 + vc3;
+    vp1 = vp1 * vt1 + vc3;
+
+    vp0 = vp0 * vt0 + vc2;
+    vp1 = vp1 * vt1 + vc2;
+
+    vp0 *= vt0;
+    vp1 *= vt1;
+
+    vt0 *= vs0;
+    vt1 *= vs1;
+
+    const float vsm10 = vs0 - vone;
+    const float vsm11 = vs1 - vone;
+
+    vp0 = vp0 * vt0 + vt0;
+    vp1 = vp1 * vt1 + vt1;
+
+    const float vem10 = vp0 + vsm10;
+    const float vem11 = vp1 + vsm11;
+
+    const float vd0 = vminus_two - vem10;
+    const float vd1 = vminus_two - vem11;
+
+    const float vabsy0 = vem10 / vd0;
+    const float vabsy1 = vem11 / vd1;
+
+    const float vy0 = copysignf(vabsy0, vx0);
+    const float vy1 = copysignf(vabsy1, vx1);
+
+    y[0] = vy0;
+    y[1] = vy1;
+    y += 2;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    const float vx = *x;
+
+    float vz = fabsf(vx) * vminus_two;
+    if XNN_UNPREDICTABLE(vz < vsat_cutoff) {
+      vz = vsat_cutoff;
+    }
+
+    float vn = vz * vlog2e + vmagic_bias;
+    const float vs = fp32_from_bits(fp32_to_bits(vn) << 23);
+    vn -= vmagic_bias;
+
+    float vt = vn * vminus_ln2_hi + vz;
+    vt = vn * vminus_ln2_lo + vt;
+
+    float vp = vc6 * vt + vc5;
+    vp = vp * vt + vc4;
+    vp = vp * vt + vc3;
+    vp = vp * vt + vc2;
+    vp *= vt;
+
+    vt *= vs;
+    const float vsm1 = vs - vone;
+    vp = vp * vt + vt;
+    const float vem1 = vp + vsm1;
+
+    const float vd = vminus_two - vem1;
+    const float vabsy = vem1 / vd;
+    const float vy = copysignf(vabsy, vx);
+    *y = vy;
+  }
+}
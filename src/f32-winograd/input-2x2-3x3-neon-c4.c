@@ -0,0 +1,232 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/winograd.h>
+
+void xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float* i00 = input[0];
+  const float* i01 = input[1];
+  const float* i02 = input[2];
+  const float* i03 = input[3];
+  const float* i10 = input[4];
+  const float* i11 = input[5];
+  const float* i12 = input[6];
+  const float* i13 = input[7];
+  const float* i20 = input[8];
+  const float* i21 = input[9];
+  const float* i22 = input[10];
+  const float* i23 = input[11];
+  const float* i30 = input[12];
+  const float* i31 = input[13];
+  const float* i32 = input[14];
+  const float* i33 = input[15];
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_stride);
+  float* o2 = (float*) ((uintptr_t) o1 + output_stride);
+  float* o3 = (float*) ((uintptr_t) o2 + output_stride);
+  float* o4 = (float*) ((uintptr_t) o3 + output_stride);
+  float* o5 = (float*) ((uintptr_t) o4 + output_stride);
+  float* o6 = (float*) ((uintptr_t) o5 + output_stride);
+  float* o7 = (float*) ((uintptr_t) o6 + output_stride);
+  float* o8 = (float*) ((uintptr_t) o7 + output_stride);
+  float* o9 = (float*) ((uintptr_t) o8 + output_stride);
+  float* o10 = (float*) ((uintptr_t) o9 + output_stride);
+  float* o11 = (float*) ((uintptr_t) o10 + output_stride);
+  float* o12 = (float*) ((uintptr_t) o11 + output_stride);
+  float* o13 = (float*) ((uintptr_t) o12 + output_stride);
+  float* o14 = (float*) ((uintptr_t) o13 + output_stride);
+  float* o15 = (float*) ((uintptr_t) o14 + output_stride);
+
+  for (; channels >= 4 * sizeof(float); channels -= 4 * sizeof(float)) {
+    const float32x4_t vi00 = vld1q_f32(i00); i00 += 4;
+    const float32x4_t vi01 = vld1q_f32(i01); i01 += 4;
+    const float32x4_t vi02 = vld1q_f32(i02); i02 += 4;
+    const float32x4_t vi03 = vld1q_f32(i03); i03 += 4;
+    const float32x4_t vi10 = vld1q_f32(i10); i10 += 4;
+    const float32x4_t vi11 = vld1q_f32(i11); i11 += 4;
+    const float32x4_t vi12 = vld1q_f32(i12); i12 += 4;
+    const float32x4_t vi13 = vld1q_f32(i13); i13 += 4;
+    const float32x4_t vi20 = vld1q_f32(i20); i20 += 4;
+    const float32x4_t vi21 = vld1q_f32(i21); i21 += 4;
+    const float32x4_t vi22 = vld1q_f32(i22); i22 += 4;
+    const float32x4_t vi23 = vld1q_f32(i23); i23 += 4;
+    const float32x4_t vi30 = vld1q_f32(i30); i30 += 4;
+    const float32x4_t vi31 = vld1q_f32(i31); i31 += 4;
+    const float32x4_t vi32 = vld1q_f32(i32); i32 += 4;
+    const float32x4_t vi33 = vld1q_f32(i33); i33 += 4;
+
+    // Rows: T = B^T * D.
+    const float32x4_t vt00 = vsubq_f32(vi00, vi20);
+    const float32x4_t vt01 = vsubq_f32(vi01, vi21);
+    const float32x4_t vt02 = vsubq_f32(vi02, vi22);
+    const float32x4_t vt03 = vsubq_f32(vi03, vi23);
+    const float32x4_t vt10 = vaddq_f32(vi10, vi20);
+    const float32x4_t vt11 = vaddq_f32(vi11, vi21);
+    const float32x4_t vt12 = vaddq_f32(vi12, vi22);
+    const float32x4_t vt13 = vaddq_f32(vi13, vi23);
+    const float32x4_t vt20 = vsubq_f32(vi20, vi10);
+    const float32x4_t vt21 = vsubq_f32(vi21, vi11);
+    const float32x4_t vt22 = vsubq_f32(vi22, vi12);
+    const float32x4_t vt23 = vsubq_f32(vi23, vi13);
+    const float32x4_t vt30 = vsubq_f32(vi10, vi30);
+    const float32x4_t vt31 = vsubq_f32(vi11, vi31);
+    const float32x4_t vt32 = vsubq_f32(vi12, vi32);
+    const float32x4_t vt33 = vsubq_f32(vi13, vi33);
+
+    // Columns: V = T * B.
+    vst1q_f32(o0, vsubq_f32(vt00, vt02)); o0 += 4;
+    vst1q_f32(o1, vaddq_f32(vt01, vt02)); o1 += 4;
+    vst1q_f32(o2, vsubq_f32(vt02, vt01)); o2 += 4;
+    vst1q_f32(o3, vsubq_f32(vt01, vt03)); o3 += 4;
+    vst1q_f32(o4, vsubq_f32(vt10, vt12)); o4 += 4;
+    vst1q_f32(o5, vaddq_f32(vt11, vt12)); o5 += 4;
+    vst1q_f32(o6, vsubq_f32(vt12, vt11)); o6 += 4;
+    vst1q_f32(o7, vsubq_f32(vt11, vt13)); o7 += 4;
+    vst1q_f32(o8, vsubq_f32(vt20, vt22)); o8 += 4;
+    vst1q_f32(o9, vaddq_f32(vt21, vt22)); o9 += 4;
+    vst1q_f32(o10, vsubq_f32(vt22, vt21)); o10 += 4;
+    vst1q_f32(o11, vsubq_f32(vt21, vt23)); o11 += 4;
+    vst1q_f32(o12, vsubq_f32(vt30, vt32)); o12 += 4;
+    vst1q_f32(o13, vaddq_f32(vt31, vt32)); o13 += 4;
+    vst1q_f32(o14, vsubq_f32(vt32, vt31)); o14 += 4;
+    vst1q_f32(o15, vsubq_f32(vt31, vt33)); o15 += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float32x4_t vi00 = vld1q_f32(i00);
+    const float32x4_t vi01 = vld1q_f32(i01);
+    const float32x4_t vi02 = vld1q_f32(i02);
+    const float32x4_t vi03 = vld1q_f32(i03);
+    const float32x4_t vi10 = vld1q_f32(i10);
+    const float32x4_t vi11 = vld1q_f32(i11);
+    const float32x4_t vi12 = vld1q_f32(i12);
+    const float32x4_t vi13 = vld1q_f32(i13);
+    const float32x4_t vi20 = vld1q_f32(i20);
+    const float32x4_t vi21 = vld1q_f32(i21);
+    const float32x4_t vi22 = vld1q_f32(i22);
+    const float32x4_t vi23 = vld1q_f32(i23);
+    const float32x4_t vi30 = vld1q_f32(i30);
+    const float32x4_t vi31 = vld1q_f32(i31);
+    const float32x4_t vi32 = vld1q_f32(i32);
+    const float32x4_t vi33 = vld1q_f32(i33);
+
+    const float32x4_t vt00 = vsubq_f32(vi00, vi20);
+    const float32x4_t vt01 = vsubq_f32(vi01, vi21);
+    const float32x4_t vt02 = vsubq_f32(vi02, vi22);
+    const float32x4_t vt03 = vsubq_f32(vi03, vi23);
+    const float32x4_t vt10 = vaddq_f32(vi10, vi20);
+    const float32x4_t vt11 = vaddq_f32(vi11, vi21);
+    const float32x4_t vt12 = vaddq_f32(vi12, vi22);
+    const float32x4_t vt13 = vaddq_f32(vi13, vi23);
+    const float32x4_t vt20 = vsubq_f32(vi20, vi10);
+    const float32x4_t vt21 = vsubq_f32(vi21, vi11);
+    const float32x4_t vt22 = vsubq_f32(vi22, vi12);
+    const float32x4_t vt23 = vsubq_f32(vi23, vi13);
+    const float32x4_t vt30 = vsubq_f32(vi10, vi30);
+    const float32x4_t vt31 = vsubq_f32(vi11, vi31);
+    const float32x4_t vt32 = vsubq_f32(vi12, vi32);
+    const float32x4_t vt33 = vsubq_f32(vi13, vi33);
+
+    const float32x4_t vo0 = vsubq_f32(vt00, vt02);
+    const float32x4_t vo1 = vaddq_f32(vt01, vt02);
+    const float32x4_t vo2 = vsubq_f32(vt02, vt01);
+    const float32x4_t vo3 = vsubq_f32(vt01, vt03);
+    const float32x4_t vo4 = vsubq_f32(vt10, vt12);
+    const float32x4_t vo5 = vaddq_f32(vt11, vt12);
+    const float32x4_t vo6 = vsubq_f32(vt12, vt11);
+    const float32x4_t vo7 = vsubq_f32(vt11, vt13);
+    const float32x4_t vo8 = vsubq_f32(vt20, vt22);
+    const float32x4_t vo9 = vaddq_f32(vt21, vt22);
+    const float32x4_t vo10 = vsubq_f32(vt22, vt21);
+    const float32x4_t vo11 = vsubq_f32(vt21, vt23);
+    const float32x4_t vo12 = vsubq_f32(vt30, vt32);
+    const float32x4_t vo13 = vaddq_f32(vt31, vt32);
+    const float32x4_t vo14 = vsubq_f32(vt32, vt31);
+    const float32x4_t vo15 = vsubq_f32(vt31, vt33);
+
+    float32x2_t vo0_lo = vget_low_f32(vo0);
+    float32x2_t vo1_lo = vget_low_f32(vo1);
+    float32x2_t vo2_lo = vget_low_f32(vo2);
+    float32x2_t vo3_lo = vget_low_f32(vo3);
+    float32x2_t vo4_lo = vget_low_f32(vo4);
+    float32x2_t vo5_lo = vget_low_f32(vo5);
+    float32x2_t vo6_lo = vget_low_f32(vo6);
+    float32x2_t vo7_lo = vget_low_f32(vo7);
+    float32x2_t vo8_lo = vget_low_f32(vo8);
+    float32x2_t vo9_lo = vget_low_f32(vo9);
+    float32x2_t vo10_lo = vget_low_f32(vo10);
+    float32x2_t vo11_lo = vget_low_f32(vo11);
+    float32x2_t vo12_lo = vget_low_f32(vo12);
+    float32x2_t vo13_lo = vget_low_f32(vo13);
+    float32x2_t vo14_lo = vget_low_f32(vo14);
+    float32x2_t vo15_lo = vget_low_f32(vo15);
+
+    if (channels & (2 * sizeof(float))) {
+      vst1_f32(o0, vo0_lo); o0 += 2;
+      vst1_f32(o1, vo1_lo); o1 += 2;
+      vst1_f32(o2, vo2_lo); o2 += 2;
+      vst1_f32(o3, vo3_lo); o3 += 2;
+      vst1_f32(o4, vo4_lo); o4 += 2;
+      vst1_f32(o5, vo5_lo); o5 += 2;
+      vst1_f32(o6, vo6_lo); o6 += 2;
+      vst1_f32(o7, vo7_lo); o7 += 2;
+      vst1_f32(o8, vo8_lo); o8 += 2;
+      vst1_f32(o9, vo9_lo); o9 += 2;
+      vst1_f32(o10, vo10_lo); o10 += 2;
+      vst1_f32(o11, vo11_lo); o11 += 2;
+      vst1_f32(o12, vo12_lo); o12 += 2;
+      vst1_f32(o13, vo13_lo); o13 += 2;
+      vst1_f32(o14, vo14_lo); o14 += 2;
+      vst1_f32(o15, vo15_lo); o15 += 2;
+
+      vo0_lo = vget_high_f32(vo0);
+      vo1_lo = vget_high_f32(vo1);
+      vo2_lo = vget_high_f32(vo2);
+      vo3_lo = vget_high_f32(vo3);
+      vo4_lo = vget_high_f32(vo4);
+      vo5_lo = vget_high_f32(vo5);
+      vo6_lo = vget_high_f32(vo6);
+      vo7_lo = vget_high_f32(vo7);
+      vo8_lo = vget_high_f32(vo8);
+      vo9_lo = vget_high_f32(vo9);
+      vo10_lo = vget_high_f32(vo10);
+      vo11_lo = vget_high_f32(vo11);
+      vo12_lo = vget_high_f32(vo12);
+      vo13_lo = vget_high_f32(vo13);
+      vo14_lo = vget_high_f32(vo14);
+      vo15_lo = vget_high_f32(vo15);
+    }
+    if (channels & (1 * sizeof(float))) {
+      vst1_lane_f32(o0, vo0_lo, 0);
+      vst1_lane_f32(o1, vo1_lo, 0);
+      vst1_lane_f32(o2, vo2_lo, 0);
+      vst1_lane_f32(o3, vo3_lo, 0);
+      vst1_lane_f32(o4, vo4_lo, 0);
+      vst1_lane_f32(o5, vo5_lo, 0);
+      vst1_lane_f32(o6, vo6_lo, 0);
+      vst1_lane_f32(o7, vo7_lo, 0);
+      vst1_lane_f32(o8, vo8_lo, 0);
+      vst1_lane_f32(o9, vo9_lo, 0);
+      vst1_lane_f32(o10, vo10_lo, 0);
+      vst1_lane_f32(o11, vo11_lo, 0);
+      vst1_lane_f32(o12, vo12_lo, 0);
+      vst1_lane_f32(o13, vo13_lo, 0);
+      vst1_lane_f32(o14, vo14_lo, 0);
+      vst1_lane_f32(o15, vo15_lo, 0);
+    }
+  }
+}
@@ -0,0 +1,96 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride)
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float* i00 = input[0];
+  const float* i01 = input[1];
+  const float* i02 = input[2];
+  const float* i03 = input[3];
+  const float* i10 = input[4];
+  const float* i11 = input[5];
+  const float* i12 = input[6];
+  const float* i13 = input[7];
+  const float* i20 = input[8];
+  const float* i21 = input[9];
+  const float* i22 = input[10];
+  const float* i23 = input[11];
+  const float* i30 = input[12];
+  const float* i31 = input[13];
+  const float* i32 = input[14];
+  const float* i33 = input[15];
+
+  float* o = output;
+  do {
+    const float vi00 = *i00++;
+    const float vi01 = *i01++;
+    const float vi02 = *i02++;
+    const float vi03 = *i03++;
+    const float vi10 = *i10++;
+    const float vi11 = *i11++;
+    const float vi12 = *i12++;
+    const float vi13 = *i13++;
+    const float vi20 = *i20++;
+    const float vi21 = *i21++;
+    const float vi22 = *i22++;
+    const float vi23 = *i23++;
+    const float vi30 = *i30++;
+    const float vi31 = *i31++;
+    const float vi32 = *i32++;
+    const float vi33 = *i33++;
+
+    // Rows: T = B^T * D.
+    const float vt00 = vi00 - vi20;
+    const float vt01 = vi01 - vi21;
+    const float vt02 = vi02 - vi22;
+    const float vt03 = vi03 - vi23;
+    const float vt10 = vi10 + vi20;
+    const float vt11 = vi11 + vi21;
+    const float vt12 = vi12 + vi22;
+    const float vt13 = vi13 + vi23;
+    const float vt20 = vi20 - vi10;
+    const float vt21 = vi21 - vi11;
+    const float vt22 = vi22 - vi12;
+    const float vt23 = vi23 - vi13;
+    const float vt30 = vi10 - vi30;
+    const float vt31 = vi11 - vi31;
+    const float vt32 = vi12 - vi32;
+    const float vt33 = vi13 - vi33;
+
+    // Columns: V = T * B.
+    float* o0 = o;
+    *o0 = vt00 - vt02; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt01 + vt02; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt02 - vt01; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt01 - vt03; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt10 - vt12; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt11 + vt12; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt12 - vt11; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt11 - vt13; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt20 - vt22; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt21 + vt22; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt22 - vt21; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt21 - vt23; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt30 - vt32; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt31 + vt32; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt32 - vt31; o0 = (float*) ((uintptr_t) o0 + output_stride);
+    *o0 = vt31 - vt33;
+    o += 1;
+
+    channels -= sizeof(float);
+  } while (channels != 0);
+}
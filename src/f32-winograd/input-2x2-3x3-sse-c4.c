@@ -0,0 +1,216 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float* i00 = input[0];
+  const float* i01 = input[1];
+  const float* i02 = input[2];
+  const float* i03 = input[3];
+  const float* i10 = input[4];
+  const float* i11 = input[5];
+  const float* i12 = input[6];
+  const float* i13 = input[7];
+  const float* i20 = input[8];
+  const float* i21 = input[9];
+  const float* i22 = input[10];
+  const float* i23 = input[11];
+  const float* i30 = input[12];
+  const float* i31 = input[13];
+  const float* i32 = input[14];
+  const float* i33 = input[15];
+
+  float* o0 = output;
+  float* o1 = (float*) ((uintptr_t) o0 + output_stride);
+  float* o2 = (float*) ((uintptr_t) o1 + output_stride);
+  float* o3 = (float*) ((uintptr_t) o2 + output_stride);
+  float* o4 = (float*) ((uintptr_t) o3 + output_stride);
+  float* o5 = (float*) ((uintptr_t) o4 + output_stride);
+  float* o6 = (float*) ((uintptr_t) o5 + output_stride);
+  float* o7 = (float*) ((uintptr_t) o6 + output_stride);
+  float* o8 = (float*) ((uintptr_t) o7 + output_stride);
+  float* o9 = (float*) ((uintptr_t) o8 + output_stride);
+  float* o10 = (float*) ((uintptr_t) o9 + output_stride);
+  float* o11 = (float*) ((uintptr_t) o10 + output_stride);
+  float* o12 = (float*) ((uintptr_t) o11 + output_stride);
+  float* o13 = (float*) ((uintptr_t) o12 + output_stride);
+  float* o14 = (float*) ((uintptr_t) o13 + output_stride);
+  float* o15 = (float*) ((uintptr_t) o14 + output_stride);
+
+  for (; channels >= 4 * sizeof(float); channels -= 4 * sizeof(float)) {
+    const __m128 vi00 = _mm_loadu_ps(i00); i00 += 4;
+    const __m128 vi01 = _mm_loadu_ps(i01); i01 += 4;
+    const __m128 vi02 = _mm_loadu_ps(i02); i02 += 4;
+    const __m128 vi03 = _mm_loadu_ps(i03); i03 += 4;
+    const __m128 vi10 = _mm_loadu_ps(i10); i10 += 4;
+    const __m128 vi11 = _mm_loadu_ps(i11); i11 += 4;
+    const __m128 vi12 = _mm_loadu_ps(i12); i12 += 4;
+    const __m128 vi13 = _mm_loadu_ps(i13); i13 += 4;
+    const __m128 vi20 = _mm_loadu_ps(i20); i20 += 4;
+    const __m128 vi21 = _mm_loadu_ps(i21); i21 += 4;
+    const __m128 vi22 = _mm_loadu_ps(i22); i22 += 4;
+    const __m128 vi23 = _mm_loadu_ps(i23); i23 += 4;
+    const __m128 vi30 = _mm_loadu_ps(i30); i30 += 4;
+    const __m128 vi31 = _mm_loadu_ps(i31); i31 += 4;
+    const __m128 vi32 = _mm_loadu_ps(i32); i32 += 4;
+    const __m128 vi33 = _mm_loadu_ps(i33); i33 += 4;
+
+    // Rows: T = B^T * D.
+    const __m128 vt00 = _mm_sub_ps(vi00, vi20);
+    const __m128 vt01 = _mm_sub_ps(vi01, vi21);
+    const __m128 vt02 = _mm_sub_ps(vi02, vi22);
+    const __m128 vt03 = _mm_sub_ps(vi03, vi23);
+    const __m128 vt10 = _mm_add_ps(vi10, vi20);
+    const __m128 vt11 = _mm_add_ps(vi11, vi21);
+    const __m128 vt12 = _mm_add_ps(vi12, vi22);
+    const __m128 vt13 = _mm_add_ps(vi13, vi23);
+    const __m128 vt20 = _mm_sub_ps(vi20, vi10);
+    const __m128 vt21 = _mm_sub_ps(vi21, vi11);
+    const __m128 vt22 = _mm_sub_ps(vi22, vi12);
+    const __m128 vt23 = _mm_sub_ps(vi23, vi13);
+    const __m128 vt30 = _mm_sub_ps(vi10, vi30);
+    const __m128 vt31 = _mm_sub_ps(vi11, vi31);
+    const __m128 vt32 = _mm_sub_ps(vi12, vi32);
+    const __m128 vt33 = _mm_sub_ps(vi13, vi33);
+
+    // Columns: V = T * B.
+    _mm_storeu_ps(o0, _mm_sub_ps(vt00, vt02)); o0 += 4;
+    _mm_storeu_ps(o1, _mm_add_ps(vt01, vt02)); o1 += 4;
+    _mm_storeu_ps(o2, _mm_sub_ps(vt02, vt01)); o2 += 4;
+    _mm_storeu_ps(o3, _mm_sub_ps(vt01, vt03)); o3 += 4;
+    _mm_storeu_ps(o4, _mm_sub_ps(vt10, vt12)); o4 += 4;
+    _mm_storeu_ps(o5, _mm_add_ps(vt11, vt12)); o5 += 4;
+    _mm_storeu_ps(o6, _mm_sub_ps(vt12, vt11)); o6 += 4;
+    _mm_storeu_ps(o7, _mm_sub_ps(vt11, vt13)); o7 += 4;
+    _mm_storeu_ps(o8, _mm_sub_ps(vt20, vt22)); o8 += 4;
+    _mm_storeu_ps(o9, _mm_add_ps(vt21, vt22)); o9 += 4;
+    _mm_storeu_ps(o10, _mm_sub_ps(vt22, vt21)); o10 += 4;
+    _mm_storeu_ps(o11, _mm_sub_ps(vt21, vt23)); o11 += 4;
+    _mm_storeu_ps(o12, _mm_sub_ps(vt30, vt32)); o12 += 4;
+    _mm_storeu_ps(o13, _mm_add_ps(vt31, vt32)); o13 += 4;
+    _mm_storeu_ps(o14, _mm_sub_ps(vt32, vt31)); o14 += 4;
+    _mm_storeu_ps(o15, _mm_sub_ps(vt31, vt33)); o15 += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const __m128 vi00 = _mm_loadu_ps(i00);
+    const __m128 vi01 = _mm_loadu_ps(i01);
+    const __m128 vi02 = _mm_loadu_ps(i02);
+    const __m128 vi03 = _mm_loadu_ps(i03);
+    const __m128 vi10 = _mm_loadu_ps(i10);
+    const __m128 vi11 = _mm_loadu_ps(i11);
+    const __m128 vi12 = _mm_loadu_ps(i12);
+    const __m128 vi13 = _mm_loadu_ps(i13);
+    const __m128 vi20 = _mm_loadu_ps(i20);
+    const __m128 vi21 = _mm_loadu_ps(i21);
+    const __m128 vi22 = _mm_loadu_ps(i22);
+    const __m128 vi23 = _mm_loadu_ps(i23);
+    const __m128 vi30 = _mm_loadu_ps(i30);
+    const __m128 vi31 = _mm_loadu_ps(i31);
+    const __m128 vi32 = _mm_loadu_ps(i32);
+    const __m128 vi33 = _mm_loadu_ps(i33);
+
+    const __m128 vt00 = _mm_sub_ps(vi00, vi20);
+    const __m128 vt01 = _mm_sub_ps(vi01, vi21);
+    const __m128 vt02 = _mm_sub_ps(vi02, vi22);
+    const __m128 vt03 = _mm_sub_ps(vi03, vi23);
+    const __m128 vt10 = _mm_add_ps(vi10, vi20);
+    const __m128 vt11 = _mm_add_ps(vi11, vi21);
+    const __m128 vt12 = _mm_add_ps(vi12, vi22);
+    const __m128 vt13 = _mm_add_ps(vi13, vi23);
+    const __m128 vt20 = _mm_sub_ps(vi20, vi10);
+    const __m128 vt21 = _mm_sub_ps(vi21, vi11);
+    const __m128 vt22 = _mm_sub_ps(vi22, vi12);
+    const __m128 vt23 = _mm_sub_ps(vi23, vi13);
+    const __m128 vt30 = _mm_sub_ps(vi10, vi30);
+    const __m128 vt31 = _mm_sub_ps(vi11, vi31);
+    const __m128 vt32 = _mm_sub_ps(vi12, vi32);
+    const __m128 vt33 = _mm_sub_ps(vi13, vi33);
+
+    __m128 vo0 = _mm_sub_ps(vt00, vt02);
+    __m128 vo1 = _mm_add_ps(vt01, vt02);
+    __m128 vo2 = _mm_sub_ps(vt02, vt01);
+    __m128 vo3 = _mm_sub_ps(vt01, vt03);
+    __m128 vo4 = _mm_sub_ps(vt10, vt12);
+    __m128 vo5 = _mm_add_ps(vt11, vt12);
+    __m128 vo6 = _mm_sub_ps(vt12, vt11);
+    __m128 vo7 = _mm_sub_ps(vt11, vt13);
+    __m128 vo8 = _mm_sub_ps(vt20, vt22);
+    __m128 vo9 = _mm_add_ps(vt21, vt22);
+    __m128 vo10 = _mm_sub_ps(vt22, vt21);
+    __m128 vo11 = _mm_sub_ps(vt21, vt23);
+    __m128 vo12 = _mm_sub_ps(vt30, vt32);
+    __m128 vo13 = _mm_add_ps(vt31, vt32);
+    __m128 vo14 = _mm_sub_ps(vt32, vt31);
+    __m128 vo15 = _mm_sub_ps(vt31, vt33);
+
+    if (channels & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) o0, vo0); o0 += 2;
+      _mm_storel_pi((__m64*) o1, vo1); o1 += 2;
+      _mm_storel_pi((__m64*) o2, vo2); o2 += 2;
+      _mm_storel_pi((__m64*) o3, vo3); o3 += 2;
+      _mm_storel_pi((__m64*) o4, vo4); o4 += 2;
+      _mm_storel_pi((__m64*) o5, vo5); o5 += 2;
+      _mm_storel_pi((__m64*) o6, vo6); o6 += 2;
+      _mm_storel_pi((__m64*) o7, vo7); o7 += 2;
+      _mm_storel_pi((__m64*) o8, vo8); o8 += 2;
+      _mm_storel_pi((__m64*) o9, vo9); o9 += 2;
+      _mm_storel_pi((__m64*) o10, vo10); o10 += 2;
+      _mm_storel_pi((__m64*) o11, vo11); o11 += 2;
+      _mm_storel_pi((__m64*) o12, vo12); o12 += 2;
+      _mm_storel_pi((__m64*) o13, vo13); o13 += 2;
+      _mm_storel_pi((__m64*) o14, vo14); o14 += 2;
+      _mm_storel_pi((__m64*) o15, vo15); o15 += 2;
+
+      vo0 = _mm_movehl_ps(vo0, vo0);
+      vo1 = _mm_movehl_ps(vo1, vo1);
+      vo2 = _mm_movehl_ps(vo2, vo2);
+      vo3 = _mm_movehl_ps(vo3, vo3);
+      vo4 = _mm_movehl_ps(vo4, vo4);
+      vo5 = _mm_movehl_ps(vo5, vo5);
+      vo6 = _mm_movehl_ps(vo6, vo6);
+      vo7 = _mm_movehl_ps(vo7, vo7);
+      vo8 = _mm_movehl_ps(vo8, vo8);
+      vo9 = _mm_movehl_ps(vo9, vo9);
+      vo10 = _mm_movehl_ps(vo10, vo10);
+      vo11 = _mm_movehl_ps(vo11, vo11);
+      vo12 = _mm_movehl_ps(vo12, vo12);
+      vo13 = _mm_movehl_ps(vo13, vo13);
+      vo14 = _mm_movehl_ps(vo14, vo14);
+      vo15 = _mm_movehl_ps(vo15, vo15);
+    }
+    if (channels & (1 * sizeof(float))) {
+      _mm_store_ss(o0, vo0);
+      _mm_store_ss(o1, vo1);
+      _mm_store_ss(o2, vo2);
+      _mm_store_ss(o3, vo3);
+      _mm_store_ss(o4, vo4);
+      _mm_store_ss(o5, vo5);
+      _mm_store_ss(o6, vo6);
+      _mm_store_ss(o7, vo7);
+      _mm_store_ss(o8, vo8);
+      _mm_store_ss(o9, vo9);
+      _mm_store_ss(o10, vo10);
+      _mm_store_ss(o11, vo11);
+      _mm_store_ss(o12, vo12);
+      _mm_store_ss(o13, vo13);
+      _mm_store_ss(o14, vo14);
+      _mm_store_ss(o15, vo15);
+    }
+  }
+}
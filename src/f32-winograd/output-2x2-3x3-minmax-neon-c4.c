@@ -0,0 +1,164 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/winograd.h>
+
+void xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4(
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    const float* bias,
+    float** output,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float* i00 = input;
+  const float* i01 = (const float*) ((uintptr_t) i00 + input_stride);
+  const float* i02 = (const float*) ((uintptr_t) i01 + input_stride);
+  const float* i03 = (const float*) ((uintptr_t) i02 + input_stride);
+  const float* i10 = (const float*) ((uintptr_t) i03 + input_stride);
+  const float* i11 = (const float*) ((uintptr_t) i10 + input_stride);
+  const float* i12 = (const float*) ((uintptr_t) i11 + input_stride);
+  const float* i13 = (const float*) ((uintptr_t) i12 + input_stride);
+  const float* i20 = (const float*) ((uintptr_t) i13 + input_stride);
+  const float* i21 = (const float*) ((uintptr_t) i20 + input_stride);
+  const float* i22 = (const float*) ((uintptr_t) i21 + input_stride);
+  const float* i23 = (const float*) ((uintptr_t) i22 + input_stride);
+  const float* i30 = (const float*) ((uintptr_t) i23 + input_stride);
+  const float* i31 = (const float*) ((uintptr_t) i30 + input_stride);
+  const float* i32 = (const float*) ((uintptr_t) i31 + input_stride);
+  const float* i33 = (const float*) ((uintptr_t) i32 + input_stride);
+
+  // Output pixels outside of the output image alias the in-bounds pixels and are stored first.
+  float* o00 = output[0];
+  float* o01 = output[1];
+  float* o10 = output[2];
+  float* o11 = output[3];
+
+  const float32x4_t vmin = vld1q_dup_f32(&params->scalar.min);
+  const float32x4_t vmax = vld1q_dup_f32(&params->scalar.max);
+  for (; channels >= 4 * sizeof(float); channels -= 4 * sizeof(float)) {
+    const float32x4_t vi00 = vld1q_f32(i00); i00 += 4;
+    const float32x4_t vi01 = vld1q_f32(i01); i01 += 4;
+    const float32x4_t vi02 = vld1q_f32(i02); i02 += 4;
+    const float32x4_t vi03 = vld1q_f32(i03); i03 += 4;
+    const float32x4_t vi10 = vld1q_f32(i10); i10 += 4;
+    const float32x4_t vi11 = vld1q_f32(i11); i11 += 4;
+    const float32x4_t vi12 = vld1q_f32(i12); i12 += 4;
+    const float32x4_t vi13 = vld1q_f32(i13); i13 += 4;
+    const float32x4_t vi20 = vld1q_f32(i20); i20 += 4;
+    const float32x4_t vi21 = vld1q_f32(i21); i21 += 4;
+    const float32x4_t vi22 = vld1q_f32(i22); i22 += 4;
+    const float32x4_t vi23 = vld1q_f32(i23); i23 += 4;
+    const float32x4_t vi30 = vld1q_f32(i30); i30 += 4;
+    const float32x4_t vi31 = vld1q_f32(i31); i31 += 4;
+    const float32x4_t vi32 = vld1q_f32(i32); i32 += 4;
+    const float32x4_t vi33 = vld1q_f32(i33); i33 += 4;
+
+    // Rows: S = A^T * M.
+    const float32x4_t vs00 = vaddq_f32(vaddq_f32(vi00, vi10), vi20);
+    const float32x4_t vs01 = vaddq_f32(vaddq_f32(vi01, vi11), vi21);
+    const float32x4_t vs02 = vaddq_f32(vaddq_f32(vi02, vi12), vi22);
+    const float32x4_t vs03 = vaddq_f32(vaddq_f32(vi03, vi13), vi23);
+    const float32x4_t vs10 = vsubq_f32(vsubq_f32(vi10, vi20), vi30);
+    const float32x4_t vs11 = vsubq_f32(vsubq_f32(vi11, vi21), vi31);
+    const float32x4_t vs12 = vsubq_f32(vsubq_f32(vi12, vi22), vi32);
+    const float32x4_t vs13 = vsubq_f32(vsubq_f32(vi13, vi23), vi33);
+
+    // Columns: Y = S * A.
+    const float32x4_t vbias = vld1q_f32(bias); bias += 4;
+    float32x4_t vacc00 = vaddq_f32(vaddq_f32(vaddq_f32(vs00, vs01), vs02), vbias);
+    float32x4_t vacc01 = vaddq_f32(vsubq_f32(vsubq_f32(vs01, vs02), vs03), vbias);
+    float32x4_t vacc10 = vaddq_f32(vaddq_f32(vaddq_f32(vs10, vs11), vs12), vbias);
+    float32x4_t vacc11 = vaddq_f32(vsubq_f32(vsubq_f32(vs11, vs12), vs13), vbias);
+
+    vacc00 = vmaxq_f32(vacc00, vmin);
+    vacc01 = vmaxq_f32(vacc01, vmin);
+    vacc10 = vmaxq_f32(vacc10, vmin);
+    vacc11 = vmaxq_f32(vacc11, vmin);
+
+    vacc00 = vminq_f32(vacc00, vmax);
+    vacc01 = vminq_f32(vacc01, vmax);
+    vacc10 = vminq_f32(vacc10, vmax);
+    vacc11 = vminq_f32(vacc11, vmax);
+
+    vst1q_f32(o11, vacc11); o11 += 4;
+    vst1q_f32(o10, vacc10); o10 += 4;
+    vst1q_f32(o01, vacc01); o01 += 4;
+    vst1q_f32(o00, vacc00); o00 += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const float32x4_t vi00 = vld1q_f32(i00);
+    const float32x4_t vi01 = vld1q_f32(i01);
+    const float32x4_t vi02 = vld1q_f32(i02);
+    const float32x4_t vi03 = vld1q_f32(i03);
+    const float32x4_t vi10 = vld1q_f32(i10);
+    const float32x4_t vi11 = vld1q_f32(i11);
+    const float32x4_t vi12 = vld1q_f32(i12);
+    const float32x4_t vi13 = vld1q_f32(i13);
+    const float32x4_t vi20 = vld1q_f32(i20);
+    const float32x4_t vi21 = vld1q_f32(i21);
+    const float32x4_t vi22 = vld1q_f32(i22);
+    const float32x4_t vi23 = vld1q_f32(i23);
+    const float32x4_t vi30 = vld1q_f32(i30);
+    const float32x4_t vi31 = vld1q_f32(i31);
+    const float32x4_t vi32 = vld1q_f32(i32);
+    const float32x4_t vi33 = vld1q_f32(i33);
+
+    const float32x4_t vs00 = vaddq_f32(vaddq_f32(vi00, vi10), vi20);
+    const float32x4_t vs01 = vaddq_f32(vaddq_f32(vi01, vi11), vi21);
+    const float32x4_t vs02 = vaddq_f32(vaddq_f32(vi02, vi12), vi22);
+    const float32x4_t vs03 = vaddq_f32(vaddq_f32(vi03, vi13), vi23);
+    const float32x4_t vs10 = vsubq_f32(vsubq_f32(vi10, vi20), vi30);
+    const float32x4_t vs11 = vsubq_f32(vsubq_f32(vi11, vi21), vi31);
+    const float32x4_t vs12 = vsubq_f32(vsubq_f32(vi12, vi22), vi32);
+    const float32x4_t vs13 = vsubq_f32(vsubq_f32(vi13, vi23), vi33);
+
+    const float32x4_t vbias = vld1q_f32(bias);
+    float32x4_t vacc00 = vaddq_f32(vaddq_f32(vaddq_f32(vs00, vs01), vs02), vbias);
+    float32x4_t vacc01 = vaddq_f32(vsubq_f32(vsubq_f32(vs01, vs02), vs03), vbias);
+    float32x4_t vacc10 = vaddq_f32(vaddq_f32(vaddq_f32(vs10, vs11), vs12), vbias);
+    float32x4_t vacc11 = vaddq_f32(vsubq_f32(vsubq_f32(vs11, vs12), vs13), vbias);
+
+    vacc00 = vmaxq_f32(vacc00, vmin);
+    vacc01 = vmaxq_f32(vacc01, vmin);
+    vacc10 = vmaxq_f32(vacc10, vmin);
+    vacc11 = vmaxq_f32(vacc11, vmin);
+
+    vacc00 = vminq_f32(vacc00, vmax);
+    vacc01 = vminq_f32(vacc01, vmax);
+    vacc10 = vminq_f32(vacc10, vmax);
+    vacc11 = vminq_f32(vacc11, vmax);
+
+    float32x2_t vacc11_lo = vget_low_f32(vacc11);
+    float32x2_t vacc10_lo = vget_low_f32(vacc10);
+    float32x2_t vacc01_lo = vget_low_f32(vacc01);
+    float32x2_t vacc00_lo = vget_low_f32(vacc00);
+
+    if (channels & (2 * sizeof(float))) {
+      vst1_f32(o11, vacc11_lo); o11 += 2;
+      vst1_f32(o10, vacc10_lo); o10 += 2;
+      vst1_f32(o01, vacc01_lo); o01 += 2;
+      vst1_f32(o00, vacc00_lo); o00 += 2;
+
+      vacc11_lo = vget_high_f32(vacc11);
+      vacc10_lo = vget_high_f32(vacc10);
+      vacc01_lo = vget_high_f32(vacc01);
+      vacc00_lo = vget_high_f32(vacc00);
+    }
+    if (channels & (1 * sizeof(float))) {
+      vst1_lane_f32(o11, vacc11_lo, 0);
+      vst1_lane_f32(o10, vacc10_lo, 0);
+      vst1_lane_f32(o01, vacc01_lo, 0);
+      vst1_lane_f32(o00, vacc00_lo, 0);
+    }
+  }
+}
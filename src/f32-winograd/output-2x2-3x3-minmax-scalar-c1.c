@@ -0,0 +1,100 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1(
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    const float* bias,
+    float** output,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float* i00 = input;
+  const float* i01 = (const float*) ((uintptr_t) i00 + input_stride);
+  const float* i02 = (const float*) ((uintptr_t) i01 + input_stride);
+  const float* i03 = (const float*) ((uintptr_t) i02 + input_stride);
+  const float* i10 = (const float*) ((uintptr_t) i03 + input_stride);
+  const float* i11 = (const float*) ((uintptr_t) i10 + input_stride);
+  const float* i12 = (const float*) ((uintptr_t) i11 + input_stride);
+  const float* i13 = (const float*) ((uintptr_t) i12 + input_stride);
+  const float* i20 = (const float*) ((uintptr_t) i13 + input_stride);
+  const float* i21 = (const float*) ((uintptr_t) i20 + input_stride);
+  const float* i22 = (const float*) ((uintptr_t) i21 + input_stride);
+  const float* i23 = (const float*) ((uintptr_t) i22 + input_stride);
+  const float* i30 = (const float*) ((uintptr_t) i23 + input_stride);
+  const float* i31 = (const float*) ((uintptr_t) i30 + input_stride);
+  const float* i32 = (const float*) ((uintptr_t) i31 + input_stride);
+  const float* i33 = (const float*) ((uintptr_t) i32 + input_stride);
+
+  // Output pixels outside of the output image alias the in-bounds pixels and are stored first.
+  float* o00 = output[0];
+  float* o01 = output[1];
+  float* o10 = output[2];
+  float* o11 = output[3];
+
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  do {
+    const float vi00 = *i00++;
+    const float vi01 = *i01++;
+    const float vi02 = *i02++;
+    const float vi03 = *i03++;
+    const float vi10 = *i10++;
+    const float vi11 = *i11++;
+    const float vi12 = *i12++;
+    const float vi13 = *i13++;
+    const float vi20 = *i20++;
+    const float vi21 = *i21++;
+    const float vi22 = *i22++;
+    const float vi23 = *i23++;
+    const float vi30 = *i30++;
+    const float vi31 = *i31++;
+    const float vi32 = *i32++;
+    const float vi33 = *i33++;
+
+    // Rows: S = A^T * M.
+    const float vs00 = vi00 + vi10 + vi20;
+    const float vs01 = vi01 + vi11 + vi21;
+    const float vs02 = vi02 + vi12 + vi22;
+    const float vs03 = vi03 + vi13 + vi23;
+    const float vs10 = vi10 - vi20 - vi30;
+    const float vs11 = vi11 - vi21 - vi31;
+    const float vs12 = vi12 - vi22 - vi32;
+    const float vs13 = vi13 - vi23 - vi33;
+
+    // Columns: Y = S * A.
+    const float vbias = *bias++;
+    float vacc00 = vs00 + vs01 + vs02 + vbias;
+    float vacc01 = vs01 - vs02 - vs03 + vbias;
+    float vacc10 = vs10 + vs11 + vs12 + vbias;
+    float vacc11 = vs11 - vs12 - vs13 + vbias;
+
+    vacc00 = math_max_f32(vacc00, vmin);
+    vacc01 = math_max_f32(vacc01, vmin);
+    vacc10 = math_max_f32(vacc10, vmin);
+    vacc11 = math_max_f32(vacc11, vmin);
+
+    vacc00 = math_min_f32(vacc00, vmax);
+    vacc01 = math_min_f32(vacc01, vmax);
+    vacc10 = math_min_f32(vacc10, vmax);
+    vacc11 = math_min_f32(vacc11, vmax);
+
+    *o11++ = vacc11;
+    *o10++ = vacc10;
+    *o01++ = vacc01;
+    *o00++ = vacc00;
+
+    channels -= sizeof(float);
+  } while (channels != 0);
+}
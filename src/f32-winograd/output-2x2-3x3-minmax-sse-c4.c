@@ -0,0 +1,160 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xmmintrin.h>
+
+#include <xnnpack/winograd.h>
+
+
+void xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4(
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    const float* bias,
+    float** output,
+    const union xnn_f32_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(channels != 0);
+  assert(channels % sizeof(float) == 0);
+
+  const float* i00 = input;
+  const float* i01 = (const float*) ((uintptr_t) i00 + input_stride);
+  const float* i02 = (const float*) ((uintptr_t) i01 + input_stride);
+  const float* i03 = (const float*) ((uintptr_t) i02 + input_stride);
+  const float* i10 = (const float*) ((uintptr_t) i03 + input_stride);
+  const float* i11 = (const float*) ((uintptr_t) i10 + input_stride);
+  const float* i12 = (const float*) ((uintptr_t) i11 + input_stride);
+  const float* i13 = (const float*) ((uintptr_t) i12 + input_stride);
+  const float* i20 = (const float*) ((uintptr_t) i13 + input_stride);
+  const float* i21 = (const float*) ((uintptr_t) i20 + input_stride);
+  const float* i22 = (const float*) ((uintptr_t) i21 + input_stride);
+  const float* i23 = (const float*) ((uintptr_t) i22 + input_stride);
+  const float* i30 = (const float*) ((uintptr_t) i23 + input_stride);
+  const float* i31 = (const float*) ((uintptr_t) i30 + input_stride);
+  const float* i32 = (const float*) ((uintptr_t) i31 + input_stride);
+  const float* i33 = (const float*) ((uintptr_t) i32 + input_stride);
+
+  // Output pixels outside of the output image alias the in-bounds pixels and are stored first.
+  float* o00 = output[0];
+  float* o01 = output[1];
+  float* o10 = output[2];
+  float* o11 = output[3];
+
+  const __m128 vmin = _mm_load_ps(params->sse.min);
+  const __m128 vmax = _mm_load_ps(params->sse.max);
+  for (; channels >= 4 * sizeof(float); channels -= 4 * sizeof(float)) {
+    const __m128 vi00 = _mm_loadu_ps(i00); i00 += 4;
+    const __m128 vi01 = _mm_loadu_ps(i01); i01 += 4;
+    const __m128 vi02 = _mm_loadu_ps(i02); i02 += 4;
+    const __m128 vi03 = _mm_loadu_ps(i03); i03 += 4;
+    const __m128 vi10 = _mm_loadu_ps(i10); i10 += 4;
+    const __m128 vi11 = _mm_loadu_ps(i11); i11 += 4;
+    const __m128 vi12 = _mm_loadu_ps(i12); i12 += 4;
+    const __m128 vi13 = _mm_loadu_ps(i13); i13 += 4;
+    const __m128 vi20 = _mm_loadu_ps(i20); i20 += 4;
+    const __m128 vi21 = _mm_loadu_ps(i21); i21 += 4;
+    const __m128 vi22 = _mm_loadu_ps(i22); i22 += 4;
+    const __m128 vi23 = _mm_loadu_ps(i23); i23 += 4;
+    const __m128 vi30 = _mm_loadu_ps(i30); i30 += 4;
+    const __m128 vi31 = _mm_loadu_ps(i31); i31 += 4;
+    const __m128 vi32 = _mm_loadu_ps(i32); i32 += 4;
+    const __m128 vi33 = _mm_loadu_ps(i33); i33 += 4;
+
+    // Rows: S = A^T * M.
+    const __m128 vs00 = _mm_add_ps(_mm_add_ps(vi00, vi10), vi20);
+    const __m128 vs01 = _mm_add_ps(_mm_add_ps(vi01, vi11), vi21);
+    const __m128 vs02 = _mm_add_ps(_mm_add_ps(vi02, vi12), vi22);
+    const __m128 vs03 = _mm_add_ps(_mm_add_ps(vi03, vi13), vi23);
+    const __m128 vs10 = _mm_sub_ps(_mm_sub_ps(vi10, vi20), vi30);
+    const __m128 vs11 = _mm_sub_ps(_mm_sub_ps(vi11, vi21), vi31);
+    const __m128 vs12 = _mm_sub_ps(_mm_sub_ps(vi12, vi22), vi32);
+    const __m128 vs13 = _mm_sub_ps(_mm_sub_ps(vi13, vi23), vi33);
+
+    // Columns: Y = S * A.
+    const __m128 vbias = _mm_loadu_ps(bias); bias += 4;
+    __m128 vacc00 = _mm_add_ps(_mm_add_ps(_mm_add_ps(vs00, vs01), vs02), vbias);
+    __m128 vacc01 = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(vs01, vs02), vs03), vbias);
+    __m128 vacc10 = _mm_add_ps(_mm_add_ps(_mm_add_ps(vs10, vs11), vs12), vbias);
+    __m128 vacc11 = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(vs11, vs12), vs13), vbias);
+
+    vacc00 = _mm_max_ps(vacc00, vmin);
+    vacc01 = _mm_max_ps(vacc01, vmin);
+    vacc10 = _mm_max_ps(vacc10, vmin);
+    vacc11 = _mm_max_ps(vacc11, vmin);
+
+    vacc00 = _mm_min_ps(vacc00, vmax);
+    vacc01 = _mm_min_ps(vacc01, vmax);
+    vacc10 = _mm_min_ps(vacc10, vmax);
+    vacc11 = _mm_min_ps(vacc11, vmax);
+
+    _mm_storeu_ps(o11, vacc11); o11 += 4;
+    _mm_storeu_ps(o10, vacc10); o10 += 4;
+    _mm_storeu_ps(o01, vacc01); o01 += 4;
+    _mm_storeu_ps(o00, vacc00); o00 += 4;
+  }
+  if XNN_UNLIKELY(channels != 0) {
+    const __m128 vi00 = _mm_loadu_ps(i00);
+    const __m128 vi01 = _mm_loadu_ps(i01);
+    const __m128 vi02 = _mm_loadu_ps(i02);
+    const __m128 vi03 = _mm_loadu_ps(i03);
+    const __m128 vi10 = _mm_loadu_ps(i10);
+    const __m128 vi11 = _mm_loadu_ps(i11);
+    const __m128 vi12 = _mm_loadu_ps(i12);
+    const __m128 vi13 = _mm_loadu_ps(i13);
+    const __m128 vi20 = _mm_loadu_ps(i20);
+    const __m128 vi21 = _mm_loadu_ps(i21);
+    const __m128 vi22 = _mm_loadu_ps(i22);
+    const __m128 vi23 = _mm_loadu_ps(i23);
+    const __m128 vi30 = _mm_loadu_ps(i30);
+    const __m128 vi31 = _mm_loadu_ps(i31);
+    const __m128 vi32 = _mm_loadu_ps(i32);
+    const __m128 vi33 = _mm_loadu_ps(i33);
+
+    const __m128 vs00 = _mm_add_ps(_mm_add_ps(vi00, vi10), vi20);
+    const __m128 vs01 = _mm_add_ps(_mm_add_ps(vi01, vi11), vi21);
+    const __m128 vs02 = _mm_add_ps(_mm_add_ps(vi02, vi12), vi22);
+    const __m128 vs03 = _mm_add_ps(_mm_add_ps(vi03, vi13), vi23);
+    const __m128 vs10 = _mm_sub_ps(_mm_sub_ps(vi10, vi20), vi30);
+    const __m128 vs11 = _mm_sub_ps(_mm_sub_ps(vi11, vi21), vi31);
+    const __m128 vs12 = _mm_sub_ps(_mm_sub_ps(vi12, vi22), vi32);
+    const __m128 vs13 = _mm_sub_ps(_mm_sub_ps(vi13, vi23), vi33);
+
+    const __m128 vbias = _mm_loadu_ps(bias);
+    __m128 vacc00 = _mm_add_ps(_mm_add_ps(_mm_add_ps(vs00, vs01), vs02), vbias);
+    __m128 vacc01 = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(vs01, vs02), vs03), vbias);
+    __m128 vacc10 = _mm_add_ps(_mm_add_ps(_mm_add_ps(vs10, vs11), vs12), vbias);
+    __m128 vacc11 = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(vs11, vs12), vs13), vbias);
+
+    vacc00 = _mm_max_ps(vacc00, vmin);
+    vacc01 = _mm_max_ps(vacc01, vmin);
+    vacc10 = _mm_max_ps(vacc10, vmin);
+    vacc11 = _mm_max_ps(vacc11, vmin);
+
+    vacc00 = _mm_min_ps(vacc00, vmax);
+    vacc01 = _mm_min_ps(vacc01, vmax);
+    vacc10 = _mm_min_ps(vacc10, vmax);
+    vacc11 = _mm_min_ps(vacc11, vmax);
+
+    if (channels & (2 * sizeof(float))) {
+      _mm_storel_pi((__m64*) o11, vacc11); o11 += 2;
+      _mm_storel_pi((__m64*) o10, vacc10); o10 += 2;
+      _mm_storel_pi((__m64*) o01, vacc01); o01 += 2;
+      _mm_storel_pi((__m64*) o00, vacc00); o00 += 2;
+
+      vacc00 = _mm_movehl_ps(vacc00, vacc00);
+      vacc01 = _mm_movehl_ps(vacc01, vacc01);
+      vacc10 = _mm_movehl_ps(vacc10, vacc10);
+      vacc11 = _mm_movehl_ps(vacc11, vacc11);
+    }
+    if (channels & (1 * sizeof(float))) {
+      _mm_store_ss(o11, vacc11);
+      _mm_store_ss(o10, vacc10);
+      _mm_store_ss(o01, vacc01);
+      _mm_store_ss(o00, vacc00);
+    }
+  }
+}
@@ -78,6 +78,70 @@ void xnn_indirection_init_conv2d(
   }
 }
 
+void xnn_indirection_init_conv3d(
+  xnn_operator_t op,
+  size_t output_tile_size,
+  uint32_t log2_element_size)
+{
+  const void** indirection_buffer          = op->indirection_buffer;
+  const void* input                        = op->input;
+  const void* zero                         = op->zero_buffer;
+  const size_t input_pixel_stride          = op->input_pixel_stride << log2_element_size;
+  const size_t input_depth                 = op->input_depth;
+  const size_t input_height                = op->input_height;
+  const size_t input_width                 = op->input_width;
+  const size_t output_depth                = op->output_depth;
+  const size_t output_height               = op->output_height;
+  const size_t output_width                = op->output_width;
+  const size_t kernel_depth                = op->kernel_depth;
+  const size_t kernel_height               = op->kernel_height;
+  const size_t kernel_width                = op->kernel_width;
+  const size_t stride_depth                = op->stride_depth;
+  const size_t stride_height               = op->stride_height;
+  const size_t stride_width                = op->stride_width;
+  const size_t dilation_depth              = op->dilation_depth;
+  const size_t dilation_height             = op->dilation_height;
+  const size_t dilation_width              = op->dilation_width;
+  const size_t input_padding_front         = op->padding_front;
+  const size_t input_padding_top           = op->padding_top;
+  const size_t input_padding_left          = op->padding_left;
+
+  const size_t output_size = output_depth * output_height * output_width;
+  const size_t tiled_output_size = round_up(output_size, output_tile_size);
+  const size_t kernel_size = kernel_depth * kernel_height * kernel_width;
+
+  const struct fxdiv_divisor_size_t output_width_divisor = fxdiv_init_size_t(output_width);
+  const struct fxdiv_divisor_size_t output_height_divisor = fxdiv_init_size_t(output_height);
+
+  for (size_t output_tile_start = 0; output_tile_start < tiled_output_size; output_tile_start += output_tile_size) {
+    for (size_t output_tile_offset = 0; output_tile_offset < output_tile_size; output_tile_offset++) {
+      const size_t output_index = min(output_tile_start + output_tile_offset, output_size - 1);
+      const struct fxdiv_result_size_t output_zy_x = fxdiv_divide_size_t(output_index, output_width_divisor);
+      const struct fxdiv_result_size_t output_z_y = fxdiv_divide_size_t(output_zy_x.quotient, output_height_divisor);
+      const size_t output_x = output_zy_x.remainder;
+      const size_t output_y = output_z_y.remainder;
+      const size_t output_z = output_z_y.quotient;
+      for (size_t kernel_z = 0; kernel_z < kernel_depth; kernel_z++) {
+        const size_t input_z = output_z * stride_depth + kernel_z * dilation_depth - input_padding_front;
+        for (size_t kernel_y = 0; kernel_y < kernel_height; kernel_y++) {
+          const size_t input_y = output_y * stride_height + kernel_y * dilation_height - input_padding_top;
+          for (size_t kernel_x = 0; kernel_x < kernel_width; kernel_x++) {
+            const size_t input_x = output_x * stride_width + kernel_x * dilation_width - input_padding_left;
+            const size_t kernel_index = (kernel_z * kernel_height + kernel_y) * kernel_width + kernel_x;
+            const size_t index = output_tile_start * kernel_size + kernel_index * output_tile_size + output_tile_offset;
+            if (input_z < input_depth && input_y < input_height && input_x < input_width) {
+              indirection_buffer[index] = (const void*)
+                ((uintptr_t) input + ((input_z * input_height + input_y) * input_width + input_x) * input_pixel_stride);
+            } else {
+              indirection_buffer[index] = zero;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 void xnn_indirection_init_deconv2d(
   xnn_operator_t op,
   size_t output_tile_size,
@@ -327,6 +391,116 @@ void xnn_indirection_init_maxpool2d(
   }
 }
 
+// Pooling windows of 3D Pooling operators are stored column by column, where a column holds the pooling_depth x
+// pooling_height pixels of a window at the same horizontal position. Adjacent output pixels in a row share the
+// overlapping columns of their windows, same as in the 2D Pooling operators.
+void xnn_indirection_init_maxpool3d(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width,
+  uint32_t log2_element_size)
+{
+  const void** indirection_buffer  = op->indirection_buffer;
+  const void* input                = op->input;
+  const size_t input_pixel_stride  = op->input_pixel_stride << log2_element_size;
+  const size_t input_depth         = op->input_depth;
+  const size_t input_height        = op->input_height;
+  const size_t input_width         = op->input_width;
+  const size_t output_depth        = op->output_depth;
+  const size_t output_height       = op->output_height;
+  const size_t output_width        = op->output_width;
+  const size_t pooling_depth       = op->kernel_depth;
+  const size_t pooling_height      = op->kernel_height;
+  const size_t pooling_width       = op->kernel_width;
+  const size_t stride_depth        = op->stride_depth;
+  const size_t stride_height       = op->stride_height;
+  const size_t stride_width        = op->stride_width;
+  const size_t input_padding_front = op->padding_front;
+  const size_t input_padding_top   = op->padding_top;
+  const size_t input_padding_left  = op->padding_left;
+
+  // Padding pixels are replaced with the nearest pixel of the input, which doesn't change the maximum.
+  const size_t input_x_max = input_width - 1;
+  const size_t input_y_max = input_height - 1;
+  const size_t input_z_max = input_depth - 1;
+  const size_t column_size = pooling_depth * pooling_height;
+  for (size_t output_z = 0; output_z < output_depth; output_z++) {
+    for (size_t output_y = 0; output_y < output_height; output_y++) {
+      const size_t output_row = output_z * output_height + output_y;
+      for (size_t pooling_z = 0; pooling_z < pooling_depth; pooling_z++) {
+        const size_t input_z = min(doz(output_z * stride_depth + pooling_z, input_padding_front), input_z_max);
+        for (size_t pooling_y = 0; pooling_y < pooling_height; pooling_y++) {
+          const size_t input_y = min(doz(output_y * stride_height + pooling_y, input_padding_top), input_y_max);
+          const size_t column_offset = pooling_z * pooling_height + pooling_y;
+          for (size_t output_x = 0; output_x < output_width; output_x++) {
+            for (size_t pooling_x = 0; pooling_x < pooling_width; pooling_x++) {
+              const size_t input_x = min(doz(output_x * stride_width + pooling_x, input_padding_left), input_x_max);
+              const size_t index =
+                output_row * step_height + (output_x * step_width + pooling_x) * column_size + column_offset;
+              indirection_buffer[index] = (const void*)
+                ((uintptr_t) input + ((input_z * input_height + input_y) * input_width + input_x) * input_pixel_stride);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+void xnn_indirection_init_avgpool3d(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width,
+  uint32_t log2_element_size)
+{
+  const void** indirection_buffer  = op->indirection_buffer;
+  const void* input                = op->input;
+  const void* zero                 = op->zero_buffer;
+  const size_t input_pixel_stride  = op->input_pixel_stride << log2_element_size;
+  const size_t input_depth         = op->input_depth;
+  const size_t input_height        = op->input_height;
+  const size_t input_width         = op->input_width;
+  const size_t output_depth        = op->output_depth;
+  const size_t output_height       = op->output_height;
+  const size_t output_width        = op->output_width;
+  const size_t pooling_depth       = op->kernel_depth;
+  const size_t pooling_height      = op->kernel_height;
+  const size_t pooling_width       = op->kernel_width;
+  const size_t stride_depth        = op->stride_depth;
+  const size_t stride_height       = op->stride_height;
+  const size_t stride_width        = op->stride_width;
+  const size_t input_padding_front = op->padding_front;
+  const size_t input_padding_top   = op->padding_top;
+  const size_t input_padding_left  = op->padding_left;
+
+  const size_t column_size = pooling_depth * pooling_height;
+  for (size_t output_z = 0; output_z < output_depth; output_z++) {
+    for (size_t output_y = 0; output_y < output_height; output_y++) {
+      const size_t output_row = output_z * output_height + output_y;
+      for (size_t pooling_z = 0; pooling_z < pooling_depth; pooling_z++) {
+        const size_t input_z = output_z * stride_depth + pooling_z - input_padding_front;
+        for (size_t pooling_y = 0; pooling_y < pooling_height; pooling_y++) {
+          const size_t input_y = output_y * stride_height + pooling_y - input_padding_top;
+          const size_t column_offset = pooling_z * pooling_height + pooling_y;
+          for (size_t output_x = 0; output_x < output_width; output_x++) {
+            for (size_t pooling_x = 0; pooling_x < pooling_width; pooling_x++) {
+              const size_t input_x = output_x * stride_width + pooling_x - input_padding_left;
+              const size_t index =
+                output_row * step_height + (output_x * step_width + pooling_x) * column_size + column_offset;
+              if (input_z < input_depth && input_y < input_height && input_x < input_width) {
+                indirection_buffer[index] = (const void*)
+                  ((uintptr_t) input + ((input_z * input_height + input_y) * input_width + input_x) * input_pixel_stride);
+              } else {
+                indirection_buffer[index] = zero;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 void xnn_indirection_init_resize_bilinear2d_hwc_f16(
   size_t input_pixel_stride,
   size_t input_height,
@@ -713,6 +887,52 @@ void xnn_indirection_init_resize_bilinear2d_chw_f32(
   }
 }
 
+void xnn_indirection_init_resize_nearest_neighbor2d(
+  size_t input_pixel_stride,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  size_t* input_row_offsets,
+  size_t* input_pixel_offsets,
+  bool align_corners,
+  bool tensorflow_legacy)
+{
+  assert(input_height != 0);
+  assert(input_height < 16777216 /* 2**24 */);
+  assert(input_width != 0);
+  assert(input_width < 16777216 /* 2**24 */);
+  assert(output_height != 0);
+  assert(output_height < 16777216 /* 2**24 */);
+  assert(output_width != 0);
+  assert(output_width < 16777216 /* 2**24 */);
+
+  const int32_t width_adjustment = (int32_t) (align_corners && output_width != 1);
+  const int32_t height_adjustment = (int32_t) (align_corners && output_height != 1);
+  const float width_scale =
+    (float) ((int32_t) input_width - width_adjustment) / (float) ((int32_t) output_width - width_adjustment);
+  const float height_scale =
+    (float) ((int32_t) input_height - height_adjustment) / (float) ((int32_t) output_height - height_adjustment);
+  // Pixel centers are aligned unless the coordinates follow TensorFlow 1.x or corner alignment.
+  const float offset = (tensorflow_legacy || align_corners) ? 0.0f : 0.5f;
+
+  const uint32_t input_y_max = (uint32_t) input_height - 1;
+  const uint32_t input_x_max = (uint32_t) input_width - 1;
+  const size_t input_row_stride = input_width * input_pixel_stride;
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    const float input_y = ((float) (int32_t) output_y + offset) * height_scale;
+    assert(input_y >= 0.0f);
+    const uint32_t input_y_nearest = align_corners ? (uint32_t) (int32_t) roundf(input_y) : (uint32_t) (int32_t) input_y;
+    input_row_offsets[output_y] = (size_t) math_min_u32(input_y_nearest, input_y_max) * input_row_stride;
+  }
+  for (size_t output_x = 0; output_x < output_width; output_x++) {
+    const float input_x = ((float) (int32_t) output_x + offset) * width_scale;
+    assert(input_x >= 0.0f);
+    const uint32_t input_x_nearest = align_corners ? (uint32_t) (int32_t) roundf(input_x) : (uint32_t) (int32_t) input_x;
+    input_pixel_offsets[output_x] = (size_t) math_min_u32(input_x_nearest, input_x_max) * input_pixel_stride;
+  }
+}
+
 void xnn_indirection_init_unpool2d(
   xnn_operator_t op,
   size_t batch_start,
@@ -48,6 +48,7 @@
 #include <xnnpack/pavgpool.h>
 #include <xnnpack/prelu.h>
 #include <xnnpack/raddstoreexpminusmax.h>
+#include <xnnpack/reduce.h>
 #include <xnnpack/rmax.h>
 #include <xnnpack/spmm.h>
 #include <xnnpack/unpool.h>
@@ -58,6 +59,7 @@
 #include <xnnpack/vmul.h>
 #include <xnnpack/vmulcaddc.h>
 #include <xnnpack/vunary.h>
+#include <xnnpack/winograd.h>
 #include <xnnpack/zip.h>
 
 #ifndef XNN_ENABLE_ASSEMBLY
@@ -87,6 +89,32 @@ static void init(void) {
 #endif
   uint32_t init_flags = XNN_INIT_FLAG_XNNPACK;
 
+  /**************************** QC4W portable micro-kernels ****************************/
+  #ifndef XNN_NO_F32_OPERATORS
+    // Scalar micro-kernels are the default on every architecture, and are overridden by faster micro-kernels below.
+    xnn_params.f32.gemm_qc4w.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_qc4w_gemm_minmax_ukernel_4x4__scalar);
+    xnn_params.f32.gemm_qc4w.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_qc4w_gemm_minmax_ukernel_1x4__scalar);
+    xnn_params.f32.gemm_qc4w.init.f32_qc4w = xnn_init_f32_qc4w_minmax_scalar_params;
+    xnn_params.f32.gemm_qc4w.mr = 4;
+    xnn_params.f32.gemm_qc4w.nr = 4;
+  #endif  // XNN_NO_F32_OPERATORS
+
+  /**************************** QD8 portable micro-kernels ****************************/
+  #ifndef XNN_NO_QC8_OPERATORS
+    // Scalar micro-kernels are the default on every architecture, and are overridden by faster micro-kernels below.
+    xnn_params.qd8_f32_qc8w.gemm.minmax.dqgemm = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc8w_gemm_minmax_ukernel_4x4__scalar);
+    xnn_params.qd8_f32_qc8w.gemm.minmax.dqgemm1 = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4__scalar);
+    xnn_params.qd8_f32_qc8w.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+    xnn_params.qd8_f32_qc8w.gemm.mr = 4;
+    xnn_params.qd8_f32_qc8w.gemm.nr = 4;
+
+    xnn_params.qd8_f32_qc4w.gemm.minmax.dqgemm = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc4w_gemm_minmax_ukernel_4x4__scalar);
+    xnn_params.qd8_f32_qc4w.gemm.minmax.dqgemm1 = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc4w_gemm_minmax_ukernel_1x4__scalar);
+    xnn_params.qd8_f32_qc4w.gemm.init.f32_qc4w = xnn_init_f32_qc4w_minmax_scalar_params;
+    xnn_params.qd8_f32_qc4w.gemm.mr = 4;
+    xnn_params.qd8_f32_qc4w.gemm.nr = 4;
+  #endif  // XNN_NO_QC8_OPERATORS
+
 #if XNN_ARCH_ARM
   #if XNN_PLATFORM_MOBILE
     if (!cpuinfo_has_arm_neon()) {
@@ -491,6 +519,14 @@ static void init(void) {
       xnn_params.qs8.dwconv[1].channel_tile = 8;
       xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__neon_c8,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__neon_c8,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_neon_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 8,
+      };
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7x__neon_c8,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7p7x__neon_c8,
@@ -500,6 +536,45 @@ static void init(void) {
         .channel_tile = 8,
       };
 
+      xnn_params.qs8.hswish = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__neon_x16,
+        .init.qs8_hswish = xnn_init_qs8_hswish_neon_params,
+        .element_tile = 16,
+      };
+      xnn_params.qs8.lrelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__neon_x16,
+        .init.qs8_lrelu = xnn_init_qs8_lrelu_neon_params,
+        .element_tile = 16,
+      };
+      xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vmax = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vmin = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+
       xnn_params.qs8.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vadd_minmax_ukernel__neon_ld64_x16,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vaddc_minmax_ukernel__neon_ld64_x16,
@@ -514,6 +589,8 @@ static void init(void) {
         .init.qs8_mul = xnn_init_qs8_mul_minmax_rndnu_neon_params,
         .element_tile = 16,
       };
+      xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__neon_x32_acc2;
+      xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__neon;
     #endif  // XNN_NO_QS8_OPERATORS
 
     /*************************** QU8 AArch32 micro-kernels ***************************/
@@ -690,6 +767,7 @@ static void init(void) {
         .init.qu8_mul = xnn_init_qu8_mul_minmax_rndnu_neon_params,
         .element_tile = 16,
       };
+      xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__neon;
     #endif  // XNN_NO_QU8_OPERATORS
 
     /**************************** S8 AArch32 micro-kernels ****************************/
@@ -735,7 +813,6 @@ static void init(void) {
         .qr = 8,
       };
       xnn_params.u8.rmax = xnn_u8_rmax_ukernel__neon;
-      xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
     #endif  // XNN_NO_U8_OPERATORS
 
     /**************************** X8 AArch32 micro-kernels ****************************/
@@ -1037,6 +1114,31 @@ static void init(void) {
         .init.f32_sigmoid = xnn_init_f32_sigmoid_neon_rr2_lut64_p2_params,
         .element_tile = 8,
       };
+      xnn_params.f32.exp = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__neon_rr2_p5_x8,
+        .init.f32_exp = xnn_init_f32_exp_neon_rr2_p5_params,
+        .element_tile = 8,
+      };
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__neon_rr2_p5_nr2recps_x8,
+        .init.f32_gelu = xnn_init_f32_gelu_neon_rr2_p5_params,
+        .element_tile = 8,
+      };
+      xnn_params.f32.log = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__neon_p4_nr2recps_x8,
+        .init.f32_log = xnn_init_f32_log_neon_p4_params,
+        .element_tile = 8,
+      };
+      xnn_params.f32.silu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__neon_rr2_p5_nr2recps_x8,
+        .init.f32_silu = xnn_init_f32_silu_neon_rr2_p5_params,
+        .element_tile = 8,
+      };
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x8,
+        .init.f32_tanh = xnn_init_f32_tanh_neon_expm1minus_rr2_p6_params,
+        .element_tile = 8,
+      };
       xnn_params.f32.sqr = (struct vunary_parameters) {
         .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqr_ukernel__neon_x8,
         .element_tile = 8,
@@ -1056,6 +1158,12 @@ static void init(void) {
         .element_tile = 8,
       };
       xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__neon;
+      xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__neon_x16_acc4;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__neon_x16_acc4;
+      xnn_params.f32.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__neon_x16,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__neon_x8,
+      };
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__neon_x8,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__neon_x8,
@@ -1108,6 +1216,12 @@ static void init(void) {
         .channel_tile = 4,
         .row_tile = 2,
       };
+      xnn_params.f32.winograd = (struct winograd_parameters) {
+        .input = xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4,
+        .output = xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4,
+        .init.f32 = xnn_init_f32_minmax_scalar_params,
+        .channel_tile = 4,
+      };
       #ifndef XNN_NO_NCHW_OPERATORS
         init_flags |= XNN_INIT_FLAG_CHW_OPT;
 
@@ -1155,10 +1269,30 @@ static void init(void) {
       #endif  // XNN_NO_NCHW_OPERATORS
     #endif  // XNN_NO_F32_OPERATORS
 
+    /*************************** BF16 AArch32 micro-kernels ***************************/
+    #ifndef XNN_NO_BF16_OPERATORS
+      init_flags |= XNN_INIT_FLAG_BF16;
+
+      xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x4__scalar);
+      xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x4__scalar);
+      xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+      xnn_params.bf16.gemm.mr = 4;
+      xnn_params.bf16.gemm.nr = 4;
+    #endif  // XNN_NO_BF16_OPERATORS
+
     /*************************** VCVT AArch32 micro-kernels ***************************/
     #ifndef XNN_NO_VCVT_OPERATORS
       init_flags |= XNN_INIT_FLAG_VCVT;
 
+      xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__scalar_x4,
+        .element_tile = 4,
+      };
+      xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__scalar_x4,
+        .element_tile = 4,
+      };
+
       if (cpuinfo_has_arm_neon_fp16()) {
         xnn_params.vcvt.f16_to_f32 = (struct vunary_parameters) {
           .ukernel = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__neonfp16_x16,
@@ -1282,6 +1416,14 @@ static void init(void) {
       xnn_params.qs8.dwconv[1].channel_tile = 1;
       xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_fmagic_c1,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_fmagic_c1,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_fmagic_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 1,
+      };
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__scalar_imagic_c1,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__scalar_imagic_c1,
@@ -1290,6 +1432,46 @@ static void init(void) {
         .row_tile = 7,
         .channel_tile = 1,
       };
+
+      xnn_params.qs8.hswish = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__scalar_x4,
+        .init.qs8_hswish = xnn_init_qs8_hswish_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.lrelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__scalar_x4,
+        .init.qs8_lrelu = xnn_init_qs8_lrelu_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vmax = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vmin = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+
       xnn_params.qs8.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vadd_minmax_ukernel__scalar_x1,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vaddc_minmax_ukernel__scalar_x1,
@@ -1304,6 +1486,8 @@ static void init(void) {
         .init.qs8_mul = xnn_init_qs8_mul_minmax_fp32_scalar_params,
         .element_tile = 4,
       };
+      xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__scalar_x4_acc4;
+      xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__scalar;
     #endif  // XNN_NO_QS8_OPERATORS
 
     /*************************** QU8 AArch32 Pre-NEON micro-kernels ***************************/
@@ -1357,6 +1541,7 @@ static void init(void) {
         .init.qu8_mul = xnn_init_qu8_mul_minmax_fp32_scalar_params,
         .element_tile = 4,
       };
+      xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__scalar;
     #endif  // XNN_NO_QU8_OPERATORS
 
     /**************************** S8 AArch32 Pre-NEON micro-kernels ****************************/
@@ -1401,7 +1586,6 @@ static void init(void) {
         .mr = 9,
         .qr = 8,
       };
-      xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
       xnn_params.u8.rmax = xnn_u8_rmax_ukernel__scalar;
     #endif  // XNN_NO_U8_OPERATORS
 
@@ -1582,6 +1766,31 @@ static void init(void) {
         .init.f32_sigmoid = xnn_init_f32_sigmoid_scalar_rr2_lut64_p2_params,
         .element_tile = 2,
       };
+      xnn_params.f32.exp = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__scalar_rr2_p5_x4,
+        .init.f32_exp = xnn_init_f32_exp_scalar_rr2_p5_params,
+        .element_tile = 4,
+      };
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x4,
+        .init.f32_gelu = xnn_init_f32_gelu_scalar_rr2_p5_params,
+        .element_tile = 4,
+      };
+      xnn_params.f32.log = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__scalar_p4_div_x4,
+        .init.f32_log = xnn_init_f32_log_scalar_p4_params,
+        .element_tile = 4,
+      };
+      xnn_params.f32.silu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4,
+        .init.f32_silu = xnn_init_f32_silu_scalar_rr2_p5_params,
+        .element_tile = 4,
+      };
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x4,
+        .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+        .element_tile = 4,
+      };
       xnn_params.f32.sqr = (struct vunary_parameters) {
         .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqr_ukernel__scalar_x4,
         .element_tile = 4,
@@ -1601,6 +1810,12 @@ static void init(void) {
         .element_tile = 4,
       };
       xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__scalar;
+      xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__scalar_x4_acc4;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar_x4_acc4;
+      xnn_params.f32.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__scalar_x4,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__scalar_x4,
+      };
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__scalar_x8,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__scalar_x8,
@@ -1653,6 +1868,12 @@ static void init(void) {
         .channel_tile = 1,
         .row_tile = 2,
       };
+      xnn_params.f32.winograd = (struct winograd_parameters) {
+        .input = xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1,
+        .output = xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1,
+        .init.f32 = xnn_init_f32_minmax_scalar_params,
+        .channel_tile = 1,
+      };
       #ifndef XNN_NO_NCHW_OPERATORS
         init_flags |= XNN_INIT_FLAG_CHW_OPT;
 
@@ -1710,10 +1931,30 @@ static void init(void) {
       #endif  // XNN_NO_NCHW_OPERATORS
     #endif  // XNN_NO_F32_OPERATORS
 
+    /*************************** BF16 AArch32 Pre-NEON micro-kernels ***************************/
+    #ifndef XNN_NO_BF16_OPERATORS
+      init_flags |= XNN_INIT_FLAG_BF16;
+
+      xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x4__scalar);
+      xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x4__scalar);
+      xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+      xnn_params.bf16.gemm.mr = 4;
+      xnn_params.bf16.gemm.nr = 4;
+    #endif  // XNN_NO_BF16_OPERATORS
+
     /*************************** VCVT AArch32 Pre-NEON micro-kernels ***************************/
     #ifndef XNN_NO_VCVT_OPERATORS
       init_flags |= XNN_INIT_FLAG_VCVT;
 
+      xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__scalar_x4,
+        .element_tile = 4,
+      };
+      xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__scalar_x4,
+        .element_tile = 4,
+      };
+
       xnn_params.vcvt.f16_to_f32 = (struct vunary_parameters) {
         .ukernel = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__scalar_x4,
         .init.f16_f32_cvt = xnn_init_f16_f32_cvt_scalar_params,
@@ -2174,6 +2415,14 @@ static void init(void) {
     xnn_params.qs8.dwconv[1].channel_tile = 16;
     xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__neon_c8,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__neon_c8,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_neon_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 8,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7x__neon_c8,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_rndnu_ukernel_7p7x__neon_c8,
@@ -2183,6 +2432,45 @@ static void init(void) {
       .channel_tile = 8,
     };
 
+    xnn_params.qs8.hswish = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__neon_x16,
+      .init.qs8_hswish = xnn_init_qs8_hswish_neon_params,
+      .element_tile = 16,
+    };
+    xnn_params.qs8.lrelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__neon_x16,
+      .init.qs8_lrelu = xnn_init_qs8_lrelu_neon_params,
+      .element_tile = 16,
+    };
+    xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmax = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmin = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+
     xnn_params.qs8.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vadd_minmax_ukernel__neon_ld64_x32,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vaddc_minmax_ukernel__neon_ld64_x32,
@@ -2197,6 +2485,8 @@ static void init(void) {
       .init.qs8_mul = xnn_init_qs8_mul_minmax_rndnu_neon_params,
       .element_tile = 16,
     };
+    xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__neon_x32_acc2;
+    xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__neon;
   #endif  // XNN_NO_QS8_OPERATORS
 
   /**************************** QU8 AArch64 micro-kernels ****************************/
@@ -2373,6 +2663,7 @@ static void init(void) {
       .init.qu8_mul = xnn_init_qu8_mul_minmax_rndnu_neon_params,
       .element_tile = 16,
     };
+    xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__neon;
   #endif  // XNN_NO_QU8_OPERATORS
 
   /**************************** S8 AArch64 micro-kernels ****************************/
@@ -2417,7 +2708,6 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
-    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
     xnn_params.u8.rmax = xnn_u8_rmax_ukernel__neon;
   #endif  // XNN_NO_U8_OPERATORS
 
@@ -2603,6 +2893,11 @@ static void init(void) {
         .element_tile = 40,
       };
       xnn_params.f16.rmax = (xnn_rmax_ukernel_function) xnn_f16_rmax_ukernel__neonfp16arith;
+      xnn_params.f16.rsum = xnn_f16_rsum_ukernel__neonfp16_x32_acc4;
+      xnn_params.f16.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f16_rmoments_ukernel__neonfp16_x16,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f16_vlayernorm_ukernel__neonfp16_x16,
+      };
 
       xnn_params.f16.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vadd_minmax_ukernel__neonfp16arith_x16,
@@ -3002,6 +3297,31 @@ static void init(void) {
       .init.f32_sigmoid = xnn_init_f32_sigmoid_neonfma_rr1_lut64_p2_params,
       .element_tile = 16,
     };
+    xnn_params.f32.exp = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8,
+      .init.f32_exp = xnn_init_f32_exp_neon_rr2_p5_params,
+      .element_tile = 8,
+    };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__neonfma_rr1_p5_div_x8,
+      .init.f32_gelu = xnn_init_f32_gelu_neonfma_rr1_p5_params,
+      .element_tile = 8,
+    };
+    xnn_params.f32.log = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__neonfma_p4_div_x8,
+      .init.f32_log = xnn_init_f32_log_neon_p4_params,
+      .element_tile = 8,
+    };
+    xnn_params.f32.silu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__neonfma_rr1_p5_div_x8,
+      .init.f32_silu = xnn_init_f32_silu_neonfma_rr1_p5_params,
+      .element_tile = 8,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x8,
+      .init.f32_tanh = xnn_init_f32_tanh_neonfma_expm1minus_rr1_p6_params,
+      .element_tile = 8,
+    };
     xnn_params.f32.sqr = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqr_ukernel__neon_x8,
       .element_tile = 8,
@@ -3021,6 +3341,12 @@ static void init(void) {
       .element_tile = 16,
     };
     xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__neon;
+    xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__neon_x16_acc4;
+    xnn_params.f32.rsum = xnn_f32_rsum_ukernel__neon_x16_acc4;
+    xnn_params.f32.layernorm = (struct layernorm_parameters) {
+      .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__neon_x16,
+      .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__neon_x8,
+    };
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__neon_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__neon_x8,
@@ -3073,6 +3399,12 @@ static void init(void) {
       .channel_tile = 4,
       .row_tile = 2,
     };
+    xnn_params.f32.winograd = (struct winograd_parameters) {
+      .input = xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4,
+      .output = xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4,
+      .init.f32 = xnn_init_f32_minmax_scalar_params,
+      .channel_tile = 4,
+    };
     #ifndef XNN_NO_NCHW_OPERATORS
       init_flags |= XNN_INIT_FLAG_CHW_OPT;
 
@@ -3130,10 +3462,30 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_F32_OPERATORS
 
+  /*************************** BF16 AArch64 micro-kernels ***************************/
+  #ifndef XNN_NO_BF16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_BF16;
+
+    xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x4__scalar);
+    xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x4__scalar);
+    xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+    xnn_params.bf16.gemm.mr = 4;
+    xnn_params.bf16.gemm.nr = 4;
+  #endif  // XNN_NO_BF16_OPERATORS
+
   /*************************** VCVT AArch64 micro-kernels ***************************/
   #ifndef XNN_NO_VCVT_OPERATORS
     init_flags |= XNN_INIT_FLAG_VCVT;
 
+    xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+    xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+
     xnn_params.vcvt.f16_to_f32 = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__neonfp16_x16,
       .element_tile = 16,
@@ -3223,6 +3575,7 @@ static void init(void) {
       xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x16c8__avx512skx);
       xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_1x16c8__avx512skx);
+      xnn_params.qc8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx;
       xnn_params.qc8.gemm.init.qc8 = xnn_init_qs8_minmax_avx512_params;
       xnn_params.qc8.gemm.mr = 4;
       xnn_params.qc8.gemm.nr = 16;
@@ -3233,6 +3586,7 @@ static void init(void) {
       xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_2x4c8__xop_ld64);
       xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x4c8__xop_ld64);
       xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_1x4c8__xop_ld64);
+      xnn_params.qc8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41;
       xnn_params.qc8.gemm.init.qc8 = xnn_init_qs8_minmax_sse4_params;
       xnn_params.qc8.gemm.mr = 2;
       xnn_params.qc8.gemm.nr = 4;
@@ -3242,6 +3596,7 @@ static void init(void) {
       xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_3x8c8__avx2);
       xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x8c8__avx2);
       xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_1x8c8__avx2);
+      xnn_params.qc8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2;
       xnn_params.qc8.gemm.init.qc8 = xnn_init_qs8_minmax_avx2_params;
       xnn_params.qc8.gemm.mr = 3;
       xnn_params.qc8.gemm.nr = 8;
@@ -3251,6 +3606,7 @@ static void init(void) {
       xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_2x4c8__avx_ld128);
       xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x4c8__avx_ld128);
       xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_1x4c8__avx_ld128);
+      xnn_params.qc8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41;
       xnn_params.qc8.gemm.init.qc8 = xnn_init_qs8_minmax_sse4_params;
       xnn_params.qc8.gemm.mr = 2;
       xnn_params.qc8.gemm.nr = 4;
@@ -3260,6 +3616,7 @@ static void init(void) {
       xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_3x4c8__sse41_ld64);
       xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x4c8__sse41_ld64);
       xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_1x4c8__sse41_ld64);
+      xnn_params.qc8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41;
       xnn_params.qc8.gemm.init.qc8 = xnn_init_qs8_minmax_sse4_params;
       xnn_params.qc8.gemm.mr = 3;
       xnn_params.qc8.gemm.nr = 4;
@@ -3269,6 +3626,7 @@ static void init(void) {
       xnn_params.qc8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_3x4c8__sse2_ld64);
       xnn_params.qc8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qc8_gemm_minmax_fp32_ukernel_1x4c8__sse2_ld64);
       xnn_params.qc8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qc8_igemm_minmax_fp32_ukernel_1x4c8__sse2_ld64);
+      xnn_params.qc8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2;
       xnn_params.qc8.gemm.init.qc8 = xnn_init_qs8_minmax_sse2_params;
       xnn_params.qc8.gemm.mr = 3;
       xnn_params.qc8.gemm.nr = 4;
@@ -3321,6 +3679,22 @@ static void init(void) {
     }
     xnn_params.qc8.dwconv[0].primary_tile = 9;
     xnn_params.qc8.dwconv[1].primary_tile = 25;
+
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.qd8_f32_qc8w.gemm.minmax.dqgemm = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc8w_gemm_minmax_ukernel_3x8c8__avx2);
+      xnn_params.qd8_f32_qc8w.gemm.minmax.dqgemm1 = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x8c8__avx2);
+      xnn_params.qd8_f32_qc8w.gemm.init.f32 = xnn_init_f32_minmax_avx_params;
+      xnn_params.qd8_f32_qc8w.gemm.mr = 3;
+      xnn_params.qd8_f32_qc8w.gemm.nr = 8;
+      xnn_params.qd8_f32_qc8w.gemm.log2_kr = 3;
+
+      xnn_params.qd8_f32_qc4w.gemm.minmax.dqgemm = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc4w_gemm_minmax_ukernel_3x8c8__avx2);
+      xnn_params.qd8_f32_qc4w.gemm.minmax.dqgemm1 = xnn_init_hmp_dqgemm_ukernel((xnn_dqgemm_ukernel_function) xnn_qd8_f32_qc4w_gemm_minmax_ukernel_1x8c8__avx2);
+      xnn_params.qd8_f32_qc4w.gemm.init.f32_qc4w = xnn_init_f32_qc4w_minmax_avx_params;
+      xnn_params.qd8_f32_qc4w.gemm.mr = 3;
+      xnn_params.qd8_f32_qc4w.gemm.nr = 8;
+      xnn_params.qd8_f32_qc4w.gemm.log2_kr = 3;
+    }
   #endif  // XNN_NO_QC8_OPERATORS
 
   /**************************** QS8 x86 micro-kernels ****************************/
@@ -3332,6 +3706,7 @@ static void init(void) {
       xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_4x16c8__avx512skx);
       xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x16c8__avx512skx);
       xnn_params.qs8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_1x16c8__avx512skx);
+      xnn_params.qs8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx;
       xnn_params.qs8.gemm.init.qs8 = xnn_init_qs8_conv_minmax_fp32_avx512_params;
       xnn_params.qs8.gemm.mr = 4;
       xnn_params.qs8.gemm.nr = 16;
@@ -3342,6 +3717,7 @@ static void init(void) {
       xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_2x4c8__xop_ld64);
       xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x4c8__xop_ld64);
       xnn_params.qs8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_1x4c8__xop_ld64);
+      xnn_params.qs8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41;
       xnn_params.qs8.gemm.init.qs8 = xnn_init_qs8_conv_minmax_fp32_sse4_params;
       xnn_params.qs8.gemm.mr = 2;
       xnn_params.qs8.gemm.nr = 4;
@@ -3351,6 +3727,7 @@ static void init(void) {
       xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_3x8c8__avx2);
       xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x8c8__avx2);
       xnn_params.qs8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_1x8c8__avx2);
+      xnn_params.qs8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2;
       xnn_params.qs8.gemm.init.qs8 = xnn_init_qs8_conv_minmax_fp32_avx2_params;
       xnn_params.qs8.gemm.mr = 3;
       xnn_params.qs8.gemm.nr = 8;
@@ -3360,6 +3737,7 @@ static void init(void) {
       xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_2x4c8__avx_ld128);
       xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x4c8__avx_ld128);
       xnn_params.qs8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_1x4c8__avx_ld128);
+      xnn_params.qs8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41;
       xnn_params.qs8.gemm.init.qs8 = xnn_init_qs8_conv_minmax_fp32_sse4_params;
       xnn_params.qs8.gemm.mr = 2;
       xnn_params.qs8.gemm.nr = 4;
@@ -3369,6 +3747,7 @@ static void init(void) {
       xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_3x4c8__sse41_ld64);
       xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x4c8__sse41_ld64);
       xnn_params.qs8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_1x4c8__sse41_ld64);
+      xnn_params.qs8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41;
       xnn_params.qs8.gemm.init.qs8 = xnn_init_qs8_conv_minmax_fp32_sse4_params;
       xnn_params.qs8.gemm.mr = 3;
       xnn_params.qs8.gemm.nr = 4;
@@ -3378,6 +3757,7 @@ static void init(void) {
       xnn_params.qs8.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_3x4c8__sse2_ld64);
       xnn_params.qs8.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_qs8_gemm_minmax_fp32_ukernel_1x4c8__sse2_ld64);
       xnn_params.qs8.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_qs8_igemm_minmax_fp32_ukernel_1x4c8__sse2_ld64);
+      xnn_params.qs8.gemm_acc32 = xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2;
       xnn_params.qs8.gemm.init.qs8 = xnn_init_qs8_conv_minmax_fp32_sse2_params;
       xnn_params.qs8.gemm.mr = 3;
       xnn_params.qs8.gemm.nr = 4;
@@ -3432,6 +3812,14 @@ static void init(void) {
     xnn_params.qs8.dwconv[1].primary_tile = 25;
 
     if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__sse41_c8,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__sse41_c8,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_sse4_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 8,
+      };
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__sse41_c8,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__sse41_c8,
@@ -3441,6 +3829,14 @@ static void init(void) {
         .channel_tile = 8,
       };
     } else {
+      xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+        .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_fmagic_c1,
+        .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_fmagic_c1,
+        .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_fmagic_params,
+        .primary_tile = 9,
+        .incremental_tile = 8,
+        .channel_tile = 1,
+      };
       xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
         .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__sse2_c8,
         .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__sse2_c8,
@@ -3451,6 +3847,86 @@ static void init(void) {
       };
     }
 
+    if (cpuinfo_has_x86_sse4_1()) {
+      xnn_params.qs8.hswish = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__sse41_x16,
+        .init.qs8_hswish = xnn_init_qs8_hswish_sse4_params,
+        .element_tile = 16,
+      };
+      xnn_params.qs8.lrelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__sse41_x16,
+        .init.qs8_lrelu = xnn_init_qs8_lrelu_sse4_params,
+        .element_tile = 16,
+      };
+      xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__sse41_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__sse41_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__sse41_x16,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_sse4_params,
+        .element_tile = 16,
+      };
+      xnn_params.qs8.vmax = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__sse41_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__sse41_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__sse41_x16,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_sse4_params,
+        .element_tile = 16,
+      };
+      xnn_params.qs8.vmin = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__sse41_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__sse41_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__sse41_x16,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_sse4_params,
+        .element_tile = 16,
+      };
+      xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__sse41_x16,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__sse41_x16,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__sse41_x16,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_sse4_params,
+        .element_tile = 16,
+      };
+    } else {
+      xnn_params.qs8.hswish = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__scalar_x4,
+        .init.qs8_hswish = xnn_init_qs8_hswish_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.lrelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__scalar_x4,
+        .init.qs8_lrelu = xnn_init_qs8_lrelu_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vmax = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vmin = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+      xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+        .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4,
+        .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+        .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+        .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+        .element_tile = 4,
+      };
+    }
+
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
       xnn_params.qs8.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vadd_minmax_ukernel__avx512skx_mul32_ld128_x16,
@@ -3525,6 +4001,13 @@ static void init(void) {
         .element_tile = 8,
       };
     }
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__avx2_x64_acc2;
+      xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__avx2;
+    } else {
+      xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__sse2_x32_acc2;
+      xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__scalar;
+    }
   #endif  // XNN_NO_QS8_OPERATORS
 
   /**************************** QU8 x86 micro-kernels ****************************/
@@ -3737,6 +4220,11 @@ static void init(void) {
         .element_tile = 8,
       };
     }
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__avx2;
+    } else {
+      xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__scalar;
+    }
   #endif  // XNN_NO_QU8_OPERATORS
 
   /**************************** U8 x86 micro-kernels ****************************/
@@ -3808,7 +4296,6 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
-    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
     xnn_params.u8.rmax = xnn_u8_rmax_ukernel__sse2;
   #endif  // XNN_NO_U8_OPERATORS
 
@@ -3857,7 +4344,7 @@ static void init(void) {
 
       xnn_params.f16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_4x16__avx2_broadcast);
       xnn_params.f16.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_4x16__avx2_broadcast);
-      xnn_params.f16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemm_minmax_ukernel_1x16__avx2_broadcast);
+      xnn_params.f16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f16_gemv_minmax_ukernel_1x16__avx2_broadcast_acc4_prfm);
       xnn_params.f16.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f16_igemm_minmax_ukernel_1x16__avx2_broadcast);
       xnn_params.f16.gemm.init.f16 = xnn_init_f16_minmax_avx_params;
       xnn_params.f16.gemm.mr = 4;
@@ -3916,6 +4403,15 @@ static void init(void) {
         .element_tile = 40,
       };
       xnn_params.f16.rmax = (xnn_rmax_ukernel_function) xnn_f16_rmax_ukernel__f16c;
+      if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
+        xnn_params.f16.rsum = xnn_f16_rsum_ukernel__avx512skx_x64_acc4;
+      } else {
+        xnn_params.f16.rsum = xnn_f16_rsum_ukernel__f16c_x32_acc4;
+      }
+      xnn_params.f16.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f16_rmoments_ukernel__f16c_x32,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f16_vlayernorm_ukernel__f16c_x16,
+      };
 
       xnn_params.f16.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f16_vadd_minmax_ukernel__f16c_x16,
@@ -3958,6 +4454,31 @@ static void init(void) {
         .init.f16_sigmoid = xnn_init_f16_sigmoid_avx2_rr1_p2_params,
         .element_tile = 32,
       };
+      xnn_params.f16.exp = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f16_vexp_ukernel__avx2_rr2_p5_x16,
+        .init.f16_exp = xnn_init_f16_exp_avx2_rr2_p5_params,
+        .element_tile = 16,
+      };
+      xnn_params.f16.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f16_vgelu_ukernel__avx2_rr1_p5_div_x16,
+        .init.f16_gelu = xnn_init_f16_gelu_avx2_rr1_p5_params,
+        .element_tile = 16,
+      };
+      xnn_params.f16.log = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f16_vlog_ukernel__avx2_p4_div_x16,
+        .init.f16_log = xnn_init_f16_log_avx2_p4_params,
+        .element_tile = 16,
+      };
+      xnn_params.f16.silu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f16_vsilu_ukernel__avx2_rr1_p5_div_x16,
+        .init.f16_silu = xnn_init_f16_silu_avx2_rr1_p5_params,
+        .element_tile = 16,
+      };
+      xnn_params.f16.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f16_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x16,
+        .init.f16_tanh = xnn_init_f16_tanh_avx2_expm1minus_rr1_p6_params,
+        .element_tile = 16,
+      };
     }
   #endif  // XNN_NO_F16_OPERATORS
 
@@ -3968,8 +4489,9 @@ static void init(void) {
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_7x16__avx512f_broadcast);
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_7x16__avx512f_broadcast);
-      xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__avx512f_broadcast);
+      xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__avx512f_broadcast);
+      xnn_params.f32.gemminc = xnn_f32_gemminc_minmax_ukernel_7x16__avx512f_broadcast;
       xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
       xnn_params.f32.gemm.mr = 7;
       xnn_params.f32.gemm.nr = 16;
@@ -3981,6 +4503,7 @@ static void init(void) {
           xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x16s4__fma3_broadcast);
           xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16s4__fma3_broadcast);
           xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16s4__fma3_broadcast);
+          xnn_params.f32.gemminc = xnn_f32_gemminc_minmax_ukernel_4x16s4__fma3_broadcast;
           xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_avx_params;
           xnn_params.f32.gemm.mr = 4;
           xnn_params.f32.gemm.nr = 16;
@@ -3989,8 +4512,9 @@ static void init(void) {
         default:
           xnn_params.f32.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_5x16__fma3_broadcast);
           xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_5x16__fma3_broadcast);
-          xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__fma3_broadcast);
+          xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm);
           xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__fma3_broadcast);
+          xnn_params.f32.gemminc = xnn_f32_gemminc_minmax_ukernel_5x16__fma3_broadcast;
           xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_avx_params;
           xnn_params.f32.gemm.mr = 5;
           xnn_params.f32.gemm.nr = 16;
@@ -3999,16 +4523,18 @@ static void init(void) {
     } else if (cpuinfo_has_x86_avx()) {
       xnn_params.f32.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_5x16__avx_broadcast);
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_5x16__avx_broadcast);
-      xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x16__avx_broadcast);
+      xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x16__avx_broadcast);
+      xnn_params.f32.gemminc = xnn_f32_gemminc_minmax_ukernel_5x16__avx_broadcast;
       xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_avx_params;
       xnn_params.f32.gemm.mr = 5;
       xnn_params.f32.gemm.nr = 16;
     } else {
       xnn_params.f32.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_4x8__sse_load1);
       xnn_params.f32.gemm.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_4x8__sse_load1);
-      xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemm_minmax_ukernel_1x8__sse_load1);
+      xnn_params.f32.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm);
       xnn_params.f32.gemm.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_igemm_minmax_ukernel_1x8__sse_load1);
+      xnn_params.f32.gemminc = xnn_f32_gemminc_minmax_ukernel_4x8__sse_load1;
       xnn_params.f32.gemm.init.f32 = xnn_init_f32_minmax_sse_params;
       xnn_params.f32.gemm.mr = 4;
       xnn_params.f32.gemm.nr = 8;
@@ -4020,6 +4546,24 @@ static void init(void) {
     xnn_params.f32.gemm2.nr = 2;
     xnn_params.f32.gemm2.log2_kr = 2;
 
+    if (cpuinfo_has_x86_fma3() && cpuinfo_has_x86_f16c()) {
+      xnn_params.f32.gemm_f16w.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_minmax_ukernel_5x16__fma3_broadcast);
+      xnn_params.f32.gemm_f16w.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_f16w_gemm_minmax_ukernel_1x16__fma3_broadcast);
+      xnn_params.f32.gemm_f16w.minmax.igemm = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_f16w_igemm_minmax_ukernel_5x16__fma3_broadcast);
+      xnn_params.f32.gemm_f16w.minmax.igemm1 = xnn_init_hmp_igemm_ukernel((xnn_igemm_ukernel_function) xnn_f32_f16w_igemm_minmax_ukernel_1x16__fma3_broadcast);
+      xnn_params.f32.gemm_f16w.init.f32 = xnn_init_f32_minmax_avx_params;
+      xnn_params.f32.gemm_f16w.mr = 5;
+      xnn_params.f32.gemm_f16w.nr = 16;
+    }
+
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.gemm_qc4w.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_qc4w_gemm_minmax_ukernel_4x16__avx2_broadcast);
+      xnn_params.f32.gemm_qc4w.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_f32_qc4w_gemm_minmax_ukernel_1x16__avx2_broadcast);
+      xnn_params.f32.gemm_qc4w.init.f32_qc4w = xnn_init_f32_qc4w_minmax_avx_params;
+      xnn_params.f32.gemm_qc4w.mr = 4;
+      xnn_params.f32.gemm_qc4w.nr = 16;
+    }
+
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.dwconv[0].minmax.unipass = (xnn_dwconv_unipass_ukernel_function) xnn_f32_dwconv_minmax_ukernel_up16x3__avx512f;
       xnn_params.f32.dwconv[0].init.f32 = xnn_init_f32_minmax_scalar_params;
@@ -4389,6 +4933,71 @@ static void init(void) {
         .element_tile = 8,
       };
     }
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.exp = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__avx2_rr2_p5_x16,
+        .init.f32_exp = xnn_init_f32_exp_avx2_rr2_p5_params,
+        .element_tile = 16,
+      };
+    } else {
+      xnn_params.f32.exp = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__sse2_rr2_p5_x8,
+        .init.f32_exp = xnn_init_f32_exp_sse2_rr2_p5_params,
+        .element_tile = 8,
+      };
+    }
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__avx2_rr1_p5_div_x16,
+        .init.f32_gelu = xnn_init_f32_gelu_avx2_rr1_p5_params,
+        .element_tile = 16,
+      };
+    } else {
+      xnn_params.f32.gelu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__sse2_rr2_p5_div_x8,
+        .init.f32_gelu = xnn_init_f32_gelu_sse2_rr2_p5_params,
+        .element_tile = 8,
+      };
+    }
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.log = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__avx2_p4_div_x16,
+        .init.f32_log = xnn_init_f32_log_avx2_p4_params,
+        .element_tile = 16,
+      };
+    } else {
+      xnn_params.f32.log = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__sse2_p4_div_x8,
+        .init.f32_log = xnn_init_f32_log_sse2_p4_params,
+        .element_tile = 8,
+      };
+    }
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.silu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__avx2_rr1_p5_div_x16,
+        .init.f32_silu = xnn_init_f32_silu_avx2_rr1_p5_params,
+        .element_tile = 16,
+      };
+    } else {
+      xnn_params.f32.silu = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__sse2_rr2_p5_div_x8,
+        .init.f32_silu = xnn_init_f32_silu_sse2_rr2_p5_params,
+        .element_tile = 8,
+      };
+    }
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x16,
+        .init.f32_tanh = xnn_init_f32_tanh_avx2_expm1minus_rr1_p6_params,
+        .element_tile = 16,
+      };
+    } else {
+      xnn_params.f32.tanh = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x8,
+        .init.f32_tanh = xnn_init_f32_tanh_sse2_expm1minus_rr2_p6_params,
+        .element_tile = 8,
+      };
+    }
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.sqr = (struct vunary_parameters) {
         .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqr_ukernel__avx512f_x16,
@@ -4449,6 +5058,27 @@ static void init(void) {
       .element_tile = 20,
     };
     xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__sse;
+    if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
+      xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__avx512f_x64_acc4;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__avx512f_x64_acc4;
+    } else if (cpuinfo_has_x86_avx()) {
+      xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__avx_x32_acc4;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__avx_x32_acc4;
+    } else {
+      xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__sse_x16_acc4;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__sse_x16_acc4;
+    }
+    if (cpuinfo_has_x86_avx()) {
+      xnn_params.f32.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__avx_x32,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__avx_x16,
+      };
+    } else {
+      xnn_params.f32.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__sse_x16,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__sse_x8,
+      };
+    }
     if (!XNN_PLATFORM_MOBILE && cpuinfo_has_x86_avx512f()) {
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__avx512f_x32,
@@ -4600,6 +5230,12 @@ static void init(void) {
       .channel_tile = 4,
       .row_tile = 2,
     };
+    xnn_params.f32.winograd = (struct winograd_parameters) {
+      .input = xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4,
+      .output = xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4,
+      .init.f32 = xnn_init_f32_minmax_sse_params,
+      .channel_tile = 4,
+    };
     #ifndef XNN_NO_NCHW_OPERATORS
       // Sparse microkernels on x86 currently target only SSE, and on processors
       // with AVX ISA dense inference is expected to be faster than sparse.
@@ -4659,10 +5295,49 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_F32_OPERATORS
 
+  /*************************** BF16 x86 micro-kernels ***************************/
+  #ifndef XNN_NO_BF16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_BF16;
+
+    if (cpuinfo_has_x86_fma3() && cpuinfo_has_x86_avx2()) {
+      xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast);
+      xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast);
+      xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_avx_params;
+      xnn_params.bf16.gemm.mr = 4;
+      xnn_params.bf16.gemm.nr = 16;
+    } else {
+      xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x4__scalar);
+      xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x4__scalar);
+      xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+      xnn_params.bf16.gemm.mr = 4;
+      xnn_params.bf16.gemm.nr = 4;
+    }
+  #endif  // XNN_NO_BF16_OPERATORS
+
   /*************************** VCVT x86 micro-kernels ***************************/
   #ifndef XNN_NO_VCVT_OPERATORS
     init_flags |= XNN_INIT_FLAG_VCVT;
 
+    if (cpuinfo_has_x86_avx2()) {
+      xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__avx2_x16,
+        .element_tile = 16,
+      };
+      xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__avx2_x16,
+        .element_tile = 16,
+      };
+    } else {
+      xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__sse2_x16,
+        .element_tile = 16,
+      };
+      xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+        .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__sse2_x16,
+        .element_tile = 16,
+      };
+    }
+
     if (cpuinfo_has_x86_avx512f() && cpuinfo_has_x86_avx512bw() && cpuinfo_has_x86_avx512dq() && cpuinfo_has_x86_avx512vl()) {
       xnn_params.vcvt.f16_to_f32 = (struct vunary_parameters) {
         .ukernel = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__avx512skx_x16,
@@ -4923,6 +5598,14 @@ static void init(void) {
     xnn_params.qs8.dwconv[1].channel_tile = 16;
     xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_fmagic_c1,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_fmagic_c1,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_fmagic_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 1,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__wasmsimd_c16,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__wasmsimd_c16,
@@ -4932,6 +5615,45 @@ static void init(void) {
       .channel_tile = 16,
     };
 
+    xnn_params.qs8.hswish = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__scalar_x4,
+      .init.qs8_hswish = xnn_init_qs8_hswish_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.lrelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__scalar_x4,
+      .init.qs8_lrelu = xnn_init_qs8_lrelu_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmax = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmin = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+
     xnn_params.qs8.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vadd_minmax_ukernel__wasmsimd_x32,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vaddc_minmax_ukernel__wasmsimd_x32,
@@ -4946,6 +5668,8 @@ static void init(void) {
       .init.qs8_mul = xnn_init_qs8_mul_minmax_fp32_wasmsimd_params,
       .element_tile = 8,
     };
+    xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__scalar_x4_acc4;
+    xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__scalar;
   #endif  // XNN_NO_QS8_OPERATORS
 
   /**************************** QU8 WAsm SIMD micro-kernels****************************/
@@ -5002,6 +5726,7 @@ static void init(void) {
       .init.qu8_mul = xnn_init_qu8_mul_minmax_fp32_wasmsimd_params,
       .element_tile = 8,
     };
+    xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__scalar;
   #endif  // XNN_NO_QU8_OPERATORS
 
   /**************************** S8 WAsm SIMD micro-kernels****************************/
@@ -5046,7 +5771,6 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
-    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
     xnn_params.u8.rmax = xnn_u8_rmax_ukernel__scalar;
   #endif  // XNN_NO_U8_OPERATORS
 
@@ -5385,6 +6109,31 @@ static void init(void) {
       .init.f32_sigmoid = xnn_init_f32_sigmoid_wasmsimd_rr2_p5_params,
       .element_tile = 16,
     };
+    xnn_params.f32.exp = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__scalar_rr2_p5_x4,
+      .init.f32_exp = xnn_init_f32_exp_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x4,
+      .init.f32_gelu = xnn_init_f32_gelu_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.log = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__scalar_p4_div_x4,
+      .init.f32_log = xnn_init_f32_log_scalar_p4_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.silu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4,
+      .init.f32_silu = xnn_init_f32_silu_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x4,
+      .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+      .element_tile = 4,
+    };
     xnn_params.f32.sqr = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqr_ukernel__wasmsimd_x8,
       .element_tile = 16,
@@ -5413,6 +6162,12 @@ static void init(void) {
     };
     if (is_wasm_x86) {
       xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__wasmsimd_x86;
+      xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__scalar_x4_acc4;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar_x4_acc4;
+      xnn_params.f32.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__scalar_x4,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__scalar_x4,
+      };
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__wasmsimd_x86_x16,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__wasmsimd_x86_x16,
@@ -5467,6 +6222,12 @@ static void init(void) {
       };
     } else {
       xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__wasmsimd_arm;
+      xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__scalar_x4_acc4;
+      xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar_x4_acc4;
+      xnn_params.f32.layernorm = (struct layernorm_parameters) {
+        .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__scalar_x4,
+        .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__scalar_x4,
+      };
       xnn_params.f32.vadd = (struct vbinary_parameters) {
         .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__wasmsimd_arm_x16,
         .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__wasmsimd_arm_x16,
@@ -5541,6 +6302,12 @@ static void init(void) {
         .row_tile = 2,
       };
     }
+    xnn_params.f32.winograd = (struct winograd_parameters) {
+      .input = xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1,
+      .output = xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1,
+      .init.f32 = xnn_init_f32_minmax_scalar_params,
+      .channel_tile = 1,
+    };
     #ifndef XNN_NO_NCHW_OPERATORS
       init_flags |= XNN_INIT_FLAG_CHW_OPT;
 
@@ -5626,10 +6393,30 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_F32_OPERATORS
 
+  /*************************** BF16 WAsm SIMD micro-kernels ***************************/
+  #ifndef XNN_NO_BF16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_BF16;
+
+    xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x4__scalar);
+    xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x4__scalar);
+    xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+    xnn_params.bf16.gemm.mr = 4;
+    xnn_params.bf16.gemm.nr = 4;
+  #endif  // XNN_NO_BF16_OPERATORS
+
   /*************************** VCVT WAsm SIMD micro-kernels***************************/
   #ifndef XNN_NO_VCVT_OPERATORS
     init_flags |= XNN_INIT_FLAG_VCVT;
 
+    xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+    xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+
     xnn_params.vcvt.f16_to_f32 = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__wasmsimd_int16_x16,
       .init.f16_f32_cvt = xnn_init_f16_f32_cvt_wasmsimd_int16_params,
@@ -5793,6 +6580,14 @@ static void init(void) {
       xnn_params.qs8.dwconv[1].primary_tile = 25;
     }
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_fmagic_c1,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_fmagic_c1,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_fmagic_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 1,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__scalar_imagic_c4,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__scalar_imagic_c4,
@@ -5802,6 +6597,45 @@ static void init(void) {
       .channel_tile = 4,
     };
 
+    xnn_params.qs8.hswish = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__scalar_x4,
+      .init.qs8_hswish = xnn_init_qs8_hswish_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.lrelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__scalar_x4,
+      .init.qs8_lrelu = xnn_init_qs8_lrelu_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmax = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmin = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+
     xnn_params.qs8.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vadd_minmax_ukernel__scalar_x4,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vaddc_minmax_ukernel__scalar_x4,
@@ -5816,6 +6650,8 @@ static void init(void) {
       .init.qs8_mul = xnn_init_qs8_mul_minmax_fp32_scalar_params,
       .element_tile = 4,
     };
+    xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__scalar_x4_acc4;
+    xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__scalar;
   #endif  // XNN_NO_QS8_OPERATORS
 
   /**************************** QU8 WAsm micro-kernels****************************/
@@ -5891,6 +6727,7 @@ static void init(void) {
       .init.qu8_mul = xnn_init_qu8_mul_minmax_fp32_scalar_params,
       .element_tile = 4,
     };
+    xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__scalar;
   #endif  // XNN_NO_QU8_OPERATORS
 
   /**************************** S8 WAsm micro-kernels****************************/
@@ -5935,7 +6772,6 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
-    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
     xnn_params.u8.rmax = xnn_u8_rmax_ukernel__scalar;
   #endif  // XNN_NO_U8_OPERATORS
 
@@ -6160,6 +6996,31 @@ static void init(void) {
       .init.f32_sigmoid = xnn_init_f32_sigmoid_scalar_rr2_lut64_p2_params,
       .element_tile = 2,
     };
+    xnn_params.f32.exp = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__scalar_rr2_p5_x4,
+      .init.f32_exp = xnn_init_f32_exp_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x4,
+      .init.f32_gelu = xnn_init_f32_gelu_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.log = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__scalar_p4_div_x4,
+      .init.f32_log = xnn_init_f32_log_scalar_p4_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.silu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4,
+      .init.f32_silu = xnn_init_f32_silu_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x4,
+      .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+      .element_tile = 4,
+    };
     xnn_params.f32.sqr = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqr_ukernel__scalar_x4,
       .element_tile = 4,
@@ -6187,6 +7048,12 @@ static void init(void) {
       .element_tile = 4,
     };
     xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__scalar;
+    xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__scalar_x4_acc4;
+    xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar_x4_acc4;
+    xnn_params.f32.layernorm = (struct layernorm_parameters) {
+      .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__scalar_x4,
+      .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__scalar_x4,
+    };
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__wasm_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__wasm_x8,
@@ -6239,6 +7106,12 @@ static void init(void) {
       .channel_tile = 1,
       .row_tile = 2,
     };
+    xnn_params.f32.winograd = (struct winograd_parameters) {
+      .input = xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1,
+      .output = xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1,
+      .init.f32 = xnn_init_f32_minmax_scalar_params,
+      .channel_tile = 1,
+    };
     #ifndef XNN_NO_NCHW_OPERATORS
       init_flags |= XNN_INIT_FLAG_CHW_OPT;
 
@@ -6296,10 +7169,30 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_F32_OPERATORS
 
+  /*************************** BF16 WAsm micro-kernels ***************************/
+  #ifndef XNN_NO_BF16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_BF16;
+
+    xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x4__scalar);
+    xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x4__scalar);
+    xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+    xnn_params.bf16.gemm.mr = 4;
+    xnn_params.bf16.gemm.nr = 4;
+  #endif  // XNN_NO_BF16_OPERATORS
+
   /*************************** VCVT WAsm micro-kernels***************************/
   #ifndef XNN_NO_VCVT_OPERATORS
     init_flags |= XNN_INIT_FLAG_VCVT;
 
+    xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+    xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+
     xnn_params.vcvt.f16_to_f32 = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__scalar_x1,
       .init.f16_f32_cvt = xnn_init_f16_f32_cvt_scalar_params,
@@ -6434,6 +7327,14 @@ static void init(void) {
     xnn_params.qs8.dwconv[1].channel_tile = 2;
     xnn_params.qs8.dwconv[1].primary_tile = 25;
 
+    xnn_params.qs8.avgpool = (struct avgpool_parameters) {
+      .unipass = (xnn_avgpool_unipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9x__scalar_fmagic_c1,
+      .multipass = (xnn_avgpool_multipass_ukernel_function) xnn_qs8_avgpool_minmax_fp32_ukernel_9p8x__scalar_fmagic_c1,
+      .init.qs8 = xnn_init_qs8_avgpool_minmax_fp32_scalar_fmagic_params,
+      .primary_tile = 9,
+      .incremental_tile = 8,
+      .channel_tile = 1,
+    };
     xnn_params.qs8.gavgpool = (struct gavgpool_parameters) {
       .unipass = (xnn_gavgpool_unipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7x__scalar_imagic_c1,
       .multipass = (xnn_gavgpool_multipass_ukernel_function) xnn_qs8_gavgpool_minmax_fp32_ukernel_7p7x__scalar_imagic_c1,
@@ -6443,6 +7344,45 @@ static void init(void) {
       .channel_tile = 1,
     };
 
+    xnn_params.qs8.hswish = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vhswish_ukernel__scalar_x4,
+      .init.qs8_hswish = xnn_init_qs8_hswish_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.lrelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_qs8_vlrelu_ukernel__scalar_x4,
+      .init.qs8_lrelu = xnn_init_qs8_lrelu_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vdiv = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdiv_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vdivc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vrdivc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmax = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmax_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmaxc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vmin = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vmin_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vminc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+    xnn_params.qs8.vsqrdiff = (struct vbinary_parameters) {
+      .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4,
+      .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .minmax.ropc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4,
+      .init.qs8_binary = xnn_init_qs8_binary_minmax_scalar_params,
+      .element_tile = 4,
+    };
+
     xnn_params.qs8.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vadd_minmax_ukernel__scalar_x4,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_qs8_vaddc_minmax_ukernel__scalar_x4,
@@ -6457,6 +7397,8 @@ static void init(void) {
       .init.qs8_mul = xnn_init_qs8_mul_minmax_fp32_scalar_params,
       .element_tile = 4,
     };
+    xnn_params.qs8.rsum = xnn_qs8_rsum_ukernel__scalar_x4_acc4;
+    xnn_params.qs8.softmax = xnn_qs8_softmax_ukernel__scalar;
   #endif  // XNN_NO_QS8_OPERATORS
 
   /************************** QU8 RISC-V micro-kernels **************************/
@@ -6511,6 +7453,7 @@ static void init(void) {
       .init.qu8_mul = xnn_init_qu8_mul_minmax_fp32_scalar_params,
       .element_tile = 4,
     };
+    xnn_params.qu8.softmax = xnn_qu8_softmax_ukernel__scalar;
   #endif  // XNN_NO_QU8_OPERATORS
 
   /************************** S8 RISC-V micro-kernels ***************************/
@@ -6555,7 +7498,6 @@ static void init(void) {
       .mr = 9,
       .qr = 8,
     };
-    xnn_params.u8.lut32norm = xnn_u8_lut32norm_ukernel__scalar;
     xnn_params.u8.rmax = xnn_u8_rmax_ukernel__scalar;
   #endif  // XNN_NO_U8_OPERATORS
 
@@ -6736,6 +7678,31 @@ static void init(void) {
       .init.f32_sigmoid = xnn_init_f32_sigmoid_scalar_rr2_lut64_p2_params,
       .element_tile = 2,
     };
+    xnn_params.f32.exp = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vexp_ukernel__scalar_rr2_p5_x4,
+      .init.f32_exp = xnn_init_f32_exp_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.gelu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x4,
+      .init.f32_gelu = xnn_init_f32_gelu_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.log = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vlog_ukernel__scalar_p4_div_x4,
+      .init.f32_log = xnn_init_f32_log_scalar_p4_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.silu = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4,
+      .init.f32_silu = xnn_init_f32_silu_scalar_rr2_p5_params,
+      .element_tile = 4,
+    };
+    xnn_params.f32.tanh = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x4,
+      .init.f32_tanh = xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params,
+      .element_tile = 4,
+    };
     xnn_params.f32.sqr = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f32_vsqr_ukernel__scalar_x4,
       .element_tile = 4,
@@ -6755,6 +7722,12 @@ static void init(void) {
       .element_tile = 4,
     };
     xnn_params.f32.rmax = (xnn_rmax_ukernel_function) xnn_f32_rmax_ukernel__scalar;
+    xnn_params.f32.rminmax = xnn_f32_rminmax_ukernel__scalar_x4_acc4;
+    xnn_params.f32.rsum = xnn_f32_rsum_ukernel__scalar_x4_acc4;
+    xnn_params.f32.layernorm = (struct layernorm_parameters) {
+      .rmoments = (xnn_rmoments_ukernel_function) xnn_f32_rmoments_ukernel__scalar_x4,
+      .vlayernorm = (xnn_vlayernorm_ukernel_function) xnn_f32_vlayernorm_ukernel__scalar_x4,
+    };
     xnn_params.f32.vadd = (struct vbinary_parameters) {
       .minmax.op_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vadd_minmax_ukernel__scalar_x8,
       .minmax.opc_ukernel = (xnn_vbinary_ukernel_function) xnn_f32_vaddc_minmax_ukernel__scalar_x8,
@@ -6807,6 +7780,12 @@ static void init(void) {
       .channel_tile = 1,
       .row_tile = 2,
     };
+    xnn_params.f32.winograd = (struct winograd_parameters) {
+      .input = xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1,
+      .output = xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1,
+      .init.f32 = xnn_init_f32_minmax_scalar_params,
+      .channel_tile = 1,
+    };
     #ifndef XNN_NO_NCHW_OPERATORS
       init_flags |= XNN_INIT_FLAG_CHW_OPT;
 
@@ -6864,10 +7843,30 @@ static void init(void) {
     #endif  // XNN_NO_NCHW_OPERATORS
   #endif  // XNN_NO_F32_OPERATORS
 
+  /*************************** BF16 RISC-V micro-kernels ***************************/
+  #ifndef XNN_NO_BF16_OPERATORS
+    init_flags |= XNN_INIT_FLAG_BF16;
+
+    xnn_params.bf16.gemm.minmax.gemm = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_4x4__scalar);
+    xnn_params.bf16.gemm.minmax.gemm1 = xnn_init_hmp_gemm_ukernel((xnn_gemm_ukernel_function) xnn_bf16_gemm_minmax_ukernel_1x4__scalar);
+    xnn_params.bf16.gemm.init.f32 = xnn_init_f32_minmax_scalar_params;
+    xnn_params.bf16.gemm.mr = 4;
+    xnn_params.bf16.gemm.nr = 4;
+  #endif  // XNN_NO_BF16_OPERATORS
+
   /************************** VCVT RISC-V micro-kernels *************************/
   #ifndef XNN_NO_VCVT_OPERATORS
     init_flags |= XNN_INIT_FLAG_VCVT;
 
+    xnn_params.vcvt.bf16_to_f32 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_bf16_f32_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+    xnn_params.vcvt.f32_to_bf16 = (struct vunary_parameters) {
+      .ukernel = (xnn_univector_ukernel_function) xnn_f32_bf16_vcvt_ukernel__scalar_x4,
+      .element_tile = 4,
+    };
+
     xnn_params.vcvt.f16_to_f32 = (struct vunary_parameters) {
       .ukernel = (xnn_univector_ukernel_function) xnn_f16_f32_vcvt_ukernel__scalar_x4,
       .init.f16_f32_cvt = xnn_init_f16_f32_cvt_scalar_params,
@@ -6948,6 +7947,17 @@ static void init(void) {
   #error "Unsupported architecture"
 #endif
 
+  #if !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV
+    const struct cpuinfo_cache* l1d_cache = cpuinfo_get_l1d_cache(0);
+    if (l1d_cache != NULL) {
+      xnn_params.l1d_cache_size = l1d_cache->size;
+    }
+    const struct cpuinfo_cache* l2_cache = cpuinfo_get_l2_cache(0);
+    if (l2_cache != NULL) {
+      xnn_params.l2_cache_size = l2_cache->size;
+    }
+  #endif  // !XNN_PLATFORM_WEB && !XNN_ARCH_RISCV
+
   memcpy(&xnn_params.allocator, init_allocator, sizeof(struct xnn_allocator));
   xnn_params.init_flags = init_flags;
 }
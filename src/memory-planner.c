@@ -148,6 +148,19 @@ void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* track
   tracker->max_value_id = value_id;
 }
 
+void xnn_add_view_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
+                                     uint32_t view_value_id,
+                                     uint32_t base_value_id) {
+  assert(tracker->usage[view_value_id].tensor_size == 0);
+#if XNN_ENABLE_MEMOPT
+  struct xnn_value_usage* base = tracker->usage + base_value_id;
+  const struct xnn_value_usage* view = tracker->usage + view_value_id;
+  if (base->last_node < view->last_node) {
+    base->last_node = view->last_node;
+  }
+#endif
+}
+
 void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker) {
 #if XNN_ENABLE_MEMOPT
   if (tracker->min_value_id == XNN_INVALID_VALUE_ID) {
@@ -22,10 +22,14 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Abs";
     case xnn_node_type_add2:
       return "Add2";
+    case xnn_node_type_argmax:
+      return "ArgMax";
     case xnn_node_type_argmax_pooling_2d:
       return "ArgMax Pooling 2D";
     case xnn_node_type_average_pooling_2d:
       return "Average Pooling 2D";
+    case xnn_node_type_average_pooling_3d:
+      return "Average Pooling 3D";
     case xnn_node_type_bankers_rounding:
       return "Bankers Rounding";
     case xnn_node_type_ceiling:
@@ -42,6 +46,8 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Convert";
     case xnn_node_type_convolution_2d:
       return "Convolution 2D";
+    case xnn_node_type_convolution_3d:
+      return "Convolution 3D";
     case xnn_node_type_deconvolution_2d:
       return "Deconvolution 2D";
     case xnn_node_type_depthwise_convolution_2d:
@@ -52,16 +58,26 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Divide";
     case xnn_node_type_elu:
       return "ELU";
+    case xnn_node_type_embedding_lookup:
+      return "Embedding Lookup";
+    case xnn_node_type_exp:
+      return "Exp";
     case xnn_node_type_fully_connected:
       return "Fully Connected";
     case xnn_node_type_floor:
       return "Floor";
+    case xnn_node_type_gelu:
+      return "GELU";
     case xnn_node_type_global_average_pooling_2d:
       return "Global Average Pooling 2D";
     case xnn_node_type_hardswish:
       return "HardSwish";
+    case xnn_node_type_layer_normalization:
+      return "Layer Normalization";
     case xnn_node_type_leaky_relu:
       return "Leaky ReLU";
+    case xnn_node_type_log:
+      return "Log";
     case xnn_node_type_maximum2:
       return "Maximum2";
     case xnn_node_type_minimum2:
@@ -70,12 +86,18 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Multiply2";
     case xnn_node_type_max_pooling_2d:
       return "Max Pooling 2D";
+    case xnn_node_type_max_pooling_3d:
+      return "Max Pooling 3D";
     case xnn_node_type_negate:
       return "Negate";
     case xnn_node_type_prelu:
       return "PReLU";
+    case xnn_node_type_scaled_dot_product_attention:
+      return "Scaled Dot-Product Attention";
     case xnn_node_type_sigmoid:
       return "Sigmoid";
+    case xnn_node_type_silu:
+      return "SiLU";
     case xnn_node_type_even_split2:
       return "Even Split2";
     case xnn_node_type_even_split3:
@@ -86,10 +108,18 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Softmax";
     case xnn_node_type_static_constant_pad:
       return "Static Constant Pad";
+    case xnn_node_type_static_reduce:
+      return "Static Reduce";
     case xnn_node_type_static_reshape:
       return "Static Reshape";
     case xnn_node_type_static_resize_bilinear_2d:
       return "Static Resize Bilinear 2D";
+    case xnn_node_type_static_resize_nearest_neighbor_2d:
+      return "Static Resize Nearest Neighbor 2D";
+    case xnn_node_type_static_slice:
+      return "Static Slice";
+    case xnn_node_type_streaming_convolution_1d:
+      return "Streaming 1D Convolution";
     case xnn_node_type_square:
       return "Square";
     case xnn_node_type_square_root:
@@ -98,6 +128,10 @@ const char* xnn_node_type_to_string(enum xnn_node_type type) {
       return "Squared Difference";
     case xnn_node_type_subtract:
       return "Subtract";
+    case xnn_node_type_tanh:
+      return "Tanh";
+    case xnn_node_type_topk:
+      return "TopK";
     case xnn_node_type_unpooling_2d:
       return "Unpooling 2D";
   }
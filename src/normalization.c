@@ -3,6 +3,7 @@
 // This source code is licensed under the BSD-style license found in the
 // LICENSE file in the root directory of this source tree.
 
+#include <stdbool.h>
 #include <string.h>
 #include <stddef.h>
 
@@ -68,3 +69,66 @@ void xnn_normalize_transpose_permutation(
   *normalized_element_size_out = normalized_element_size;
   *normalized_num_dims = output_dims;
 }
+
+void xnn_normalize_reduction(
+    size_t* num_reduction_axes_ptr,
+    size_t* reduction_axes,
+    size_t* num_input_dims_ptr,
+    size_t* input_dims)
+{
+  // Dimensions of size 1 do not change the result and are dropped, and adjacent dimensions which are either both
+  // reduced or both kept are merged, so reduced and kept dimensions alternate in the normalized shape.
+  // Reduction axes are in increasing order, and are overwritten only after they are read.
+  const size_t num_reduction_axes = *num_reduction_axes_ptr;
+  size_t num_normalized_dims = 0;
+  size_t num_normalized_axes = 0;
+  size_t axis = 0;
+  for (size_t i = 0; i < *num_input_dims_ptr; i++) {
+    const bool is_reduction = axis < num_reduction_axes && reduction_axes[axis] == i;
+    if (is_reduction) {
+      axis++;
+    }
+    if (input_dims[i] == 1) {
+      continue;
+    }
+    const bool previous_is_reduction =
+      num_normalized_axes != 0 && reduction_axes[num_normalized_axes - 1] + 1 == num_normalized_dims;
+    if (num_normalized_dims != 0 && is_reduction == previous_is_reduction) {
+      input_dims[num_normalized_dims - 1] *= input_dims[i];
+    } else {
+      if (is_reduction) {
+        reduction_axes[num_normalized_axes++] = num_normalized_dims;
+      }
+      input_dims[num_normalized_dims++] = input_dims[i];
+    }
+  }
+  *num_reduction_axes_ptr = num_normalized_axes;
+  *num_input_dims_ptr = num_normalized_dims;
+}
+
+void xnn_normalize_slice(
+    size_t* num_dims_ptr,
+    size_t* offsets,
+    size_t* sizes,
+    size_t* input_shape)
+{
+  // A dimension merges into the preceding one when it is sliced in full (this includes dimensions of size 1), or when
+  // the preceding dimension is sliced to a single element: in both cases the merged dimension is sliced to a single
+  // contiguous range. A slice which is contiguous in memory is thus normalized to a single dimension.
+  size_t num_normalized_dims = 0;
+  for (size_t i = 0; i < *num_dims_ptr; i++) {
+    const bool is_full_slice = offsets[i] == 0 && sizes[i] == input_shape[i];
+    if (num_normalized_dims != 0 && (is_full_slice || sizes[num_normalized_dims - 1] == 1)) {
+      const size_t j = num_normalized_dims - 1;
+      offsets[j] = offsets[j] * input_shape[i] + offsets[i];
+      sizes[j] = (sizes[j] - 1) * input_shape[i] + sizes[i];
+      input_shape[j] *= input_shape[i];
+    } else {
+      offsets[num_normalized_dims] = offsets[i];
+      sizes[num_normalized_dims] = sizes[i];
+      input_shape[num_normalized_dims] = input_shape[i];
+      num_normalized_dims++;
+    }
+  }
+  *num_dims_ptr = num_normalized_dims;
+}
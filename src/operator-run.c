@@ -7,10 +7,14 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <math.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
+#include <fp16.h>
+
 #include <xnnpack.h>
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
@@ -331,6 +335,241 @@ void xnn_compute_gemm(
       &context->params);
 }
 
+void xnn_compute_blocked_gemm(
+    const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t nr_block_start,
+    size_t mr_block_start,
+    size_t nr_block_size,
+    size_t mr_block_size)
+{
+  const size_t k_scaled = context->k_scaled;
+  const size_t kc_scaled = context->kc_scaled;
+  const size_t a_stride = context->a_stride;
+  const size_t cm_stride = context->cm_stride;
+  const size_t mr = context->mr;
+  const size_t nr = context->nr;
+  const size_t acc_cm_stride = nr * sizeof(float);
+  const size_t mr_block_end = mr_block_start + mr_block_size;
+  const size_t nr_block_end = nr_block_start + nr_block_size;
+
+  // Loop order follows the classic cache-blocked GEMM: for every KC-block of the reduction dimension, a KC x NR panel of
+  // packed weights is reused across all MR-blocks of this tile while it is hot in L1, and the KC-wide slice of the
+  // input stays in L2 across all NR-blocks.
+  for (size_t k_start = 0; k_start < k_scaled; k_start += kc_scaled) {
+    const size_t k_size = min(k_scaled - k_start, kc_scaled);
+    const bool first_block = k_start == 0;
+    const bool last_block = k_start + k_size == k_scaled;
+    for (size_t n = nr_block_start; n < nr_block_end; n += nr) {
+      const size_t nr_size = min(nr_block_end - n, nr);
+      const uintptr_t w = (uintptr_t) context->packed_w + n * context->w_stride;
+      for (size_t m = mr_block_start; m < mr_block_end; m += mr) {
+        const size_t mr_size = min(mr_block_end - m, mr);
+        const void* a = (const void*) ((uintptr_t) context->a + m * a_stride + k_start);
+        void* acc = (void*) ((uintptr_t) context->acc + (m / mr) * context->acc_m_stride + (n / nr) * context->acc_n_stride);
+        void* c = (void*) ((uintptr_t) context->c + m * cm_stride + n * sizeof(float));
+        if (first_block) {
+          // The regular GEMM micro-kernel reads the bias and the first KC-block of weights.
+          context->ukernel(
+              mr_size, nr_size, k_size, a, a_stride, (const void*) w,
+              last_block ? c : acc, last_block ? cm_stride : acc_cm_stride, context->cn_stride,
+              last_block ? &context->params : &context->acc_params);
+        } else {
+          // Accumulators of a tile are loaded before any of them are stored, so updating them in place is safe.
+          context->inc_ukernel(
+              mr_size, nr_size, k_size, (const float*) a, a_stride,
+              (const float*) (w + context->w_bias_size + k_start * nr),
+              last_block ? (float*) c : (float*) acc, last_block ? cm_stride : acc_cm_stride, context->cn_stride,
+              (const float*) acc,
+              last_block ? &context->params : &context->acc_params);
+        }
+      }
+    }
+  }
+}
+
+void xnn_compute_splitk_gemm(
+    const struct splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t slice_index,
+    size_t mr_block_start,
+    size_t mr_block_size)
+{
+  const size_t a_stride = context->a_stride;
+  const size_t nr = context->nr;
+  const size_t n = context->n;
+  const size_t partial_m_stride = context->partial_m_stride;
+  const size_t k_start = slice_index * context->kc_scaled;
+  const size_t k_size = min(context->k_scaled - k_start, context->kc_scaled);
+
+  const void* a = (const void*) ((uintptr_t) context->a + mr_block_start * a_stride + k_start);
+  void* partial = (void*) ((uintptr_t) context->partial + slice_index * context->partial_slice_stride +
+    mr_block_start * partial_m_stride);
+  for (size_t nr_block_start = 0; nr_block_start < n; nr_block_start += nr) {
+    const size_t nr_block_size = min(n - nr_block_start, nr);
+    const uintptr_t w = (uintptr_t) context->packed_w + nr_block_start * context->w_stride;
+    void* c = (void*) ((uintptr_t) partial + nr_block_start * sizeof(float));
+    if (slice_index == 0) {
+      // The regular GEMM micro-kernel reads the bias and the first slice of weights.
+      context->ukernel(
+          mr_block_size, nr_block_size, k_size, a, a_stride, (const void*) w,
+          c, partial_m_stride, nr * sizeof(float), &context->gemm_params);
+    } else {
+      context->inc_ukernel(
+          mr_block_size, nr_block_size, k_size, (const float*) a, a_stride,
+          (const float*) (w + context->w_bias_size + k_start * nr),
+          (float*) c, partial_m_stride, nr * sizeof(float),
+          (const float*) context->zero, &context->gemm_params);
+    }
+  }
+}
+
+void xnn_compute_splitk_reduce(
+    const struct splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t channel_start,
+    size_t channel_size)
+{
+  const size_t num_slices = context->num_slices;
+  const size_t partial_slice_stride = context->partial_slice_stride;
+  const size_t size = channel_size * sizeof(float);
+
+  // Intermediate sums are accumulated into the partial product of the first slice, so that micro-kernels never read
+  // from the output.
+  void* partial = (void*) ((uintptr_t) context->partial +
+    batch_index * context->partial_m_stride + channel_start * sizeof(float));
+  for (size_t slice_index = 1; slice_index + 1 < num_slices; slice_index++) {
+    context->vadd_ukernel(
+        size, partial, (const void*) ((uintptr_t) partial + slice_index * partial_slice_stride), partial,
+        &context->acc_params);
+  }
+  void* c = (void*) ((uintptr_t) context->c + batch_index * context->cm_stride + channel_start * sizeof(float));
+  context->vadd_ukernel(
+      size, partial, (const void*) ((uintptr_t) partial + (num_slices - 1) * partial_slice_stride), c,
+      &context->params);
+}
+
+void xnn_compute_qs8_splitk_gemm(
+    const struct qs8_splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t slice_index,
+    size_t mr_block_start,
+    size_t mr_block_size)
+{
+  const size_t a_stride = context->a_stride;
+  const size_t nr = context->nr;
+  const size_t n = context->n;
+  const size_t partial_m_stride = context->partial_m_stride;
+  const size_t k_start = slice_index * context->kc;
+  const size_t k_size = min(context->k - k_start, context->kc);
+
+  const int8_t* a = (const int8_t*) ((uintptr_t) context->a + mr_block_start * a_stride) + k_start;
+  int32_t* partial = (int32_t*) ((uintptr_t) context->partial + slice_index * context->partial_slice_stride +
+    mr_block_start * partial_m_stride);
+  for (size_t nr_block_start = 0; nr_block_start < n; nr_block_start += nr) {
+    const size_t nr_block_size = min(n - nr_block_start, nr);
+    // Weights of the slice follow the bias of the NR-block.
+    const void* w = (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride +
+      nr * sizeof(int32_t) + k_start * nr);
+    context->ukernel(
+        mr_block_size, nr_block_size, k_size, a, a_stride, w,
+        partial + nr_block_start, partial_m_stride);
+  }
+}
+
+void xnn_compute_qs8_splitk_reduce(
+    const struct qs8_splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t channel_start,
+    size_t channel_size)
+{
+  const size_t nr = context->nr;
+  const size_t num_slices = context->num_slices;
+  const size_t partial_slice_stride = context->partial_slice_stride;
+  const size_t w_stride = context->w_stride;
+  const size_t w_scale_offset = context->w_scale_offset;
+  const float vscale = context->params.fp32_scalar_lrintf.scale;
+  const float voutput_min_less_zero_point = context->params.fp32_scalar_lrintf.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = context->params.fp32_scalar_lrintf.output_max_less_zero_point;
+  const int32_t voutput_zero_point = context->params.fp32_scalar_lrintf.output_zero_point;
+
+  const int32_t* partial = (const int32_t*) ((uintptr_t) context->partial + batch_index * context->partial_m_stride);
+  int8_t* c = (int8_t*) ((uintptr_t) context->c + batch_index * context->cm_stride);
+  for (size_t channel = channel_start; channel < channel_start + channel_size; channel++) {
+    const size_t nr_block_start = channel / nr * nr;
+    const size_t nr_block_offset = channel - nr_block_start;
+    const uintptr_t w = (uintptr_t) context->packed_w + nr_block_start * w_stride;
+
+    // The bias in packed weights already includes the input zero point correction.
+    int32_t vacc = ((const int32_t*) w)[nr_block_offset];
+    for (size_t slice_index = 0; slice_index < num_slices; slice_index++) {
+      vacc += *(const int32_t*) ((uintptr_t) (partial + channel) + slice_index * partial_slice_stride);
+    }
+
+    float vfpacc = (float) vacc;
+    if (w_scale_offset != 0) {
+      vfpacc *= ((const float*) (w + w_scale_offset))[nr_block_offset];
+    } else {
+      vfpacc *= vscale;
+    }
+    vfpacc = math_max_f32(vfpacc, voutput_min_less_zero_point);
+    vfpacc = math_min_f32(vfpacc, voutput_max_less_zero_point);
+    c[channel] = (int8_t) ((int32_t) lrintf(vfpacc) + voutput_zero_point);
+  }
+}
+
+void xnn_compute_f32_qd8_convert(
+    const struct dqgemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const size_t n = context->k_scaled;
+  const float* input = (const float*) ((uintptr_t) context->a + batch_index * context->a_stride);
+
+  float vminmax[2];
+  context->rminmax_ukernel(n * sizeof(float), input, vminmax);
+  const float vmin = math_min_f32(vminmax[0], 0.0f);
+  const float vmax = math_max_f32(vminmax[1], 0.0f);
+
+  // The quantized range covers [-128, 127] and includes zero exactly.
+  float scale = (vmax - vmin) / 255.0f;
+  if (!isnormal(scale)) {
+    scale = 1.0f;
+  }
+  const long zero_point = lrintf(-128.0f - vmin / scale);
+  const int8_t output_zero_point = (int8_t) math_max_s32(math_min_s32((int32_t) zero_point, 127), -128);
+
+  union xnn_f32_qs8_cvt_params params;
+  context->init_convert_params(&params, 1.0f / scale, output_zero_point, INT8_MIN, INT8_MAX);
+  context->convert_ukernel(
+      n * sizeof(float), input, (void*) ((uintptr_t) context->qa + batch_index * context->qa_stride), &params);
+
+  context->quantization_params[batch_index] = (struct xnn_qd8_quantization_params) {
+    .zero_point = output_zero_point,
+    .scale = scale,
+  };
+}
+
+void xnn_compute_dqgemm(
+    const struct dqgemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t qa_stride = context->qa_stride;
+  const size_t cm_stride = context->cm_stride;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      context->k_scaled,
+      (const int8_t*) ((uintptr_t) context->qa + mr_block_start * qa_stride),
+      qa_stride,
+      (const void*) ((uintptr_t) context->packed_w + nr_block_start * context->w_stride),
+      (float*) ((uintptr_t) context->c + mr_block_start * cm_stride + nr_block_start * sizeof(float)),
+      cm_stride,
+      context->cn_stride,
+      &context->params,
+      &context->quantization_params[mr_block_start]);
+}
+
 void xnn_compute_spmm(
     const struct spmm_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index,
@@ -453,6 +692,118 @@ void xnn_compute_igemm(
       &context->params);
 }
 
+static void compute_winograd_block(
+    const struct winograd_context context[restrict XNN_MIN_ELEMENTS(1)],
+    void* transformed_input,
+    void* transformed_output,
+    size_t tile_start,
+    size_t tile_count)
+{
+  const size_t tiles_width = context->tiles_width;
+  const size_t tiles_per_image = context->tiles_height * tiles_width;
+
+  // Input transform of the block.
+  const size_t input_height = context->input_height;
+  const size_t input_width = context->input_width;
+  const size_t input_pixel_stride = context->input_pixel_stride;
+  const float* zero = (const float*) context->zero;
+  const float* indirection[16];
+  void* a = transformed_input;
+  for (size_t tile = tile_start; tile < tile_start + tile_count; tile++) {
+    const size_t batch_index = tile / tiles_per_image;
+    const size_t tile_y = (tile % tiles_per_image) / tiles_width;
+    const size_t tile_x = tile % tiles_width;
+    const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+    for (size_t r = 0; r < 4; r++) {
+      // Unsigned wrap-around turns negative coordinates into large out-of-bounds values.
+      const size_t iy = tile_y * 2 + r - context->input_padding_top;
+      for (size_t c = 0; c < 4; c++) {
+        const size_t ix = tile_x * 2 + c - context->input_padding_left;
+        if (iy < input_height && ix < input_width) {
+          indirection[r * 4 + c] = (const float*) ((uintptr_t) input + (iy * input_width + ix) * input_pixel_stride);
+        } else {
+          indirection[r * 4 + c] = zero;
+        }
+      }
+    }
+    context->input_ukernel(
+      context->input_channels * sizeof(float),
+      indirection,
+      (float*) a,
+      context->transformed_input_position_stride);
+    a = (void*) ((uintptr_t) a + context->transformed_input_tile_stride);
+  }
+
+  // Elementwise products in the transformed domain: one GEMM per each of the 16 tile positions.
+  const size_t mr = context->mr;
+  const size_t kc = context->input_channels * sizeof(float);
+  const size_t a_stride = context->transformed_input_tile_stride;
+  const size_t cm_stride = context->transformed_output_tile_stride;
+  for (size_t position = 0; position < 16; position++) {
+    const void* a_position = (const void*) ((uintptr_t) transformed_input + position * context->transformed_input_position_stride);
+    void* c_position = (void*) ((uintptr_t) transformed_output + position * context->transformed_output_position_stride);
+    const void* w_position = (const void*) ((uintptr_t) context->packed_w + position * context->packed_w_position_stride);
+    for (size_t m = 0; m < tile_count; m += mr) {
+      context->gemm_ukernel.function[XNN_UARCH_DEFAULT](
+          min(tile_count - m, mr),
+          context->output_channels,
+          kc,
+          (const void*) ((uintptr_t) a_position + m * a_stride),
+          a_stride,
+          w_position,
+          (void*) ((uintptr_t) c_position + m * cm_stride),
+          cm_stride,
+          context->cn_stride,
+          &context->gemm_params);
+    }
+  }
+
+  // Output transform of the block.
+  const size_t output_height = context->output_height;
+  const size_t output_width = context->output_width;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  const void* c = transformed_output;
+  float* output[4];
+  for (size_t tile = tile_start; tile < tile_start + tile_count; tile++) {
+    const size_t batch_index = tile / tiles_per_image;
+    const size_t tile_y = (tile % tiles_per_image) / tiles_width;
+    const size_t tile_x = tile % tiles_width;
+    const size_t oy0 = tile_y * 2;
+    const size_t ox0 = tile_x * 2;
+    // Pixels past the bottom/right edge alias their in-bounds neighbours, which the ukernel stores last.
+    const size_t oy1 = min(oy0 + 1, output_height - 1);
+    const size_t ox1 = min(ox0 + 1, output_width - 1);
+    void* output_image = (void*) ((uintptr_t) context->output + batch_index * context->output_batch_stride);
+    output[0] = (float*) ((uintptr_t) output_image + (oy0 * output_width + ox0) * output_pixel_stride);
+    output[1] = (float*) ((uintptr_t) output_image + (oy0 * output_width + ox1) * output_pixel_stride);
+    output[2] = (float*) ((uintptr_t) output_image + (oy1 * output_width + ox0) * output_pixel_stride);
+    output[3] = (float*) ((uintptr_t) output_image + (oy1 * output_width + ox1) * output_pixel_stride);
+    context->output_ukernel(
+      context->output_channels * sizeof(float),
+      (const float*) c,
+      context->transformed_output_position_stride,
+      (const float*) context->bias,
+      output,
+      &context->output_params);
+    c = (const void*) ((uintptr_t) c + cm_stride);
+  }
+}
+
+void xnn_compute_winograd(
+    const struct winograd_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t slot)
+{
+  // Every slot owns one block buffer in the workspace and processes every num_slots-th block of tiles.
+  void* transformed_input = (void*) ((uintptr_t) context->workspace + slot * context->slot_stride);
+  void* transformed_output = (void*) ((uintptr_t) transformed_input + context->transformed_output_offset);
+  const size_t tiles = context->tiles;
+  const size_t tile_block = context->tile_block;
+  for (size_t tile_start = slot * tile_block; tile_start < tiles; tile_start += context->num_slots * tile_block) {
+    compute_winograd_block(
+      context, transformed_input, transformed_output, tile_start, min(tiles - tile_start, tile_block));
+  }
+}
+
 void xnn_compute_grouped_subgemm2d(
       const struct subgemm_context context[restrict XNN_MIN_ELEMENTS(1)],
       size_t batch_index,
@@ -978,6 +1329,112 @@ void xnn_compute_resize_bilinear_chw(
     context->input_channel_stride);
 }
 
+void xnn_compute_resize_nearest_neighbor(
+    const struct resize_nearest_neighbor_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t output_y_start,
+    size_t output_y_range)
+{
+  const size_t scaled_channels = context->scaled_channels;
+  const size_t output_width = context->output_width;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  const size_t output_row_stride = output_width * output_pixel_stride;
+  const size_t* input_row_offsets = context->input_row_offsets;
+  const size_t* input_pixel_offsets = context->input_pixel_offsets;
+  const xnn_univector_ukernel_function copy_ukernel = context->copy_ukernel;
+
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+  void* output = (void*) ((uintptr_t) context->output + batch_index * context->output_batch_stride +
+    output_y_start * output_row_stride);
+  for (size_t output_y = output_y_start; output_y < output_y_start + output_y_range; output_y++) {
+    if (output_y != output_y_start && input_row_offsets[output_y] == input_row_offsets[output_y - 1]) {
+      // Same input row as the previous output row: replicate the output row written last.
+      const void* previous_output = (const void*) ((uintptr_t) output - output_row_stride);
+      if (output_pixel_stride == scaled_channels) {
+        copy_ukernel(output_row_stride, previous_output, output, NULL);
+      } else {
+        for (size_t output_x = 0; output_x < output_width; output_x++) {
+          copy_ukernel(scaled_channels,
+            (const void*) ((uintptr_t) previous_output + output_x * output_pixel_stride),
+            (void*) ((uintptr_t) output + output_x * output_pixel_stride), NULL);
+        }
+      }
+    } else {
+      const void* input_row = (const void*) ((uintptr_t) input + input_row_offsets[output_y]);
+      for (size_t output_x = 0; output_x < output_width; output_x++) {
+        copy_ukernel(scaled_channels,
+          (const void*) ((uintptr_t) input_row + input_pixel_offsets[output_x]),
+          (void*) ((uintptr_t) output + output_x * output_pixel_stride), NULL);
+      }
+    }
+    output = (void*) ((uintptr_t) output + output_row_stride);
+  }
+}
+
+#define XNN_RESIZE_NEAREST_NEIGHBOR_GATHER_ROW(type)                                     \
+  do {                                                                                   \
+    const type* i = (const type*) input_row;                                             \
+    type* o = (type*) output_row;                                                        \
+    if (width_scale != 0) {                                                              \
+      for (size_t n = output_width; n != 0; n -= width_scale) {                          \
+        const type value = *i++;                                                         \
+        for (size_t k = 0; k < width_scale; k++) {                                       \
+          *o++ = value;                                                                  \
+        }                                                                                \
+      }                                                                                  \
+    } else {                                                                             \
+      for (size_t output_x = 0; output_x < output_width; output_x++) {                   \
+        *o++ = *((const type*) ((uintptr_t) input_row + input_pixel_offsets[output_x])); \
+      }                                                                                  \
+    }                                                                                    \
+  } while (0)
+
+void xnn_compute_resize_nearest_neighbor_chw(
+    const struct resize_nearest_neighbor_chw_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t channel_start,
+    size_t channel_range)
+{
+  const size_t output_height = context->output_height;
+  const size_t output_width = context->output_width;
+  const size_t width_scale = context->width_scale;
+  const uint32_t log2_element_size = context->log2_element_size;
+  const size_t output_row_stride = output_width << log2_element_size;
+  const size_t* input_row_offsets = context->input_row_offsets;
+  const size_t* input_pixel_offsets = context->input_pixel_offsets;
+
+  for (size_t channel = channel_start; channel < channel_start + channel_range; channel++) {
+    const void* input = (const void*) ((uintptr_t) context->input +
+      batch_index * context->input_batch_stride + channel * context->input_channel_stride);
+    void* output_row = (void*) ((uintptr_t) context->output +
+      batch_index * context->output_batch_stride + channel * context->output_channel_stride);
+    for (size_t output_y = 0; output_y < output_height; output_y++) {
+      if (output_y != 0 && input_row_offsets[output_y] == input_row_offsets[output_y - 1]) {
+        // Same input row as the previous output row: replicate the output row written last.
+        context->copy_ukernel(
+          output_row_stride, (const void*) ((uintptr_t) output_row - output_row_stride), output_row, NULL);
+      } else {
+        const void* input_row = (const void*) ((uintptr_t) input + input_row_offsets[output_y]);
+        switch (log2_element_size) {
+          case 0:
+            XNN_RESIZE_NEAREST_NEIGHBOR_GATHER_ROW(uint8_t);
+            break;
+          case 1:
+            XNN_RESIZE_NEAREST_NEIGHBOR_GATHER_ROW(uint16_t);
+            break;
+          default:
+            assert(log2_element_size == 2);
+            XNN_RESIZE_NEAREST_NEIGHBOR_GATHER_ROW(uint32_t);
+            break;
+        }
+      }
+      output_row = (void*) ((uintptr_t) output_row + output_row_stride);
+    }
+  }
+}
+
+#undef XNN_RESIZE_NEAREST_NEIGHBOR_GATHER_ROW
+
 void xnn_compute_prelu(
     const struct prelu_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_start,
@@ -1025,6 +1482,18 @@ void xnn_compute_pad_5d(
   }
 }
 
+void xnn_compute_slice_5d(
+    const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t i, size_t j, size_t k, size_t l, size_t m)
+{
+  const void* input = (const void*) ((uintptr_t) context->input +
+    i * context->input_stride[0] + j * context->input_stride[1] + k * context->input_stride[2] + l * context->input_stride[3] + m * context->input_stride[4]);
+  void* output = (void*) ((uintptr_t) context->output +
+    i * context->output_stride[0] + j * context->output_stride[1] + k * context->output_stride[2] + l * context->output_stride[3] + m * context->output_stride[4]);
+
+  context->ukernel(context->contiguous_size, input, output, NULL);
+}
+
 void xnn_compute_elementwise_binary_5d(
     const struct elementwise_binary_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t i, size_t j, size_t k, size_t l, size_t m)
@@ -1108,19 +1577,13 @@ void xnn_compute_univector_contiguous(
   context->ukernel(size, x, y, &context->params);
 }
 
-void xnn_compute_u8_softmax(
-    const struct u8_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
+void xnn_compute_quantized_softmax(
+    const struct quantized_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_index)
 {
-  const uint8_t* x = (const uint8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
-  uint8_t* y = (uint8_t*) ((uintptr_t) context->y + context->y_stride * batch_index);
-  const size_t n = context->n;
-
-  uint8_t x_max = 0;
-  context->rmax_ukernel(n, x, &x_max);
-  const size_t adjustment = x_max ^ 255;
-  const uint32_t* t = (const uint32_t*) context->t + adjustment;
-  context->lut_norm_ukernel(n, x, t, y);
+  const void* x = (const void*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  void* y = (void*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  context->ukernel(context->n, x, context->t, y);
 }
 
 void xnn_compute_floating_point_softmax(
@@ -1154,6 +1617,598 @@ void xnn_compute_floating_point_softmax(
   context->vmulc_ukernel(n, y, &y_scale, y, &context->minmax_params);
 }
 
+void xnn_compute_layer_normalization(
+    const struct layer_normalization_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const void* x = (const void*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  void* y = (void*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  const size_t n = context->n;
+
+  // First pass: reduce to mean and variance
+  float stats[2];
+  context->rmoments_ukernel(n, x, stats);
+
+  // Second pass: normalize, scale, and offset
+  stats[1] = 1.0f / sqrtf(stats[1] + context->epsilon);
+  context->vlayernorm_ukernel(n, x, stats, context->gamma, context->beta, y);
+}
+
+void xnn_compute_scaled_dot_product_attention_pack(
+    const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t head_index)
+{
+  const uint32_t log2_element_size = context->log2_element_size;
+  const size_t key_tokens = context->key_tokens;
+  const size_t key_tile = context->key_tile;
+
+  // Keys are packed as weights of a GEMM with key tokens as output channels, and pre-multiplied by the scale.
+  void* packed_k = (void*) ((uintptr_t) context->packed_k + context->packed_k_head_stride * head_index);
+  memset(packed_k, 0, context->packed_k_head_stride);
+  context->pack_gemm_goi_w(
+    1, key_tokens, context->channels, context->nr, context->kr, context->sr,
+    (const void*) ((uintptr_t) context->k + context->k_head_stride * head_index), NULL,
+    packed_k, 0, NULL);
+  context->vmulc_ukernel(context->packed_k_head_stride, packed_k, &context->scale, packed_k, &context->minmax_params);
+
+  // Values are packed separately for every tile of keys, as weights of a GEMM with key tokens as the reduction
+  // dimension.
+  void* packed_v = (void*) ((uintptr_t) context->packed_v + context->packed_v_head_stride * head_index);
+  memset(packed_v, 0, context->packed_v_head_stride);
+  const size_t value_channels = context->value_channels;
+  const void* v = (const void*) ((uintptr_t) context->v + context->v_head_stride * head_index);
+  for (size_t key_start = 0; key_start < key_tokens; key_start += key_tile) {
+    context->pack_gemm_io_w(
+      value_channels, min(key_tokens - key_start, key_tile), context->nr, context->kr, context->sr,
+      (const void*) ((uintptr_t) v + ((key_start * value_channels) << log2_element_size)), NULL,
+      packed_v, 0, NULL);
+    packed_v = (void*) ((uintptr_t) packed_v + context->packed_v_tile_stride);
+  }
+}
+
+void xnn_compute_scaled_dot_product_attention(
+    const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t head_index,
+    size_t query_tile_index)
+{
+  const uint32_t log2_element_size = context->log2_element_size;
+  const size_t query_tokens = context->query_tokens;
+  const size_t key_tokens = context->key_tokens;
+  const size_t key_tile = context->key_tile;
+  const size_t mr = context->mr;
+  const size_t query_start = query_tile_index * mr;
+  const size_t query_tile = min(query_tokens - query_start, mr);
+  const size_t scores_stride = key_tile << log2_element_size;
+  const size_t value_channels_size = context->value_channels << log2_element_size;
+  const size_t cn_stride = context->nr << log2_element_size;
+
+  const void* q = (const void*) ((uintptr_t) context->q + context->q_head_stride * head_index +
+    ((query_start * context->channels) << log2_element_size));
+  const void* packed_k = (const void*) ((uintptr_t) context->packed_k + context->packed_k_head_stride * head_index);
+  const void* packed_v = (const void*) ((uintptr_t) context->packed_v + context->packed_v_head_stride * head_index);
+  void* scores = (void*) ((uintptr_t) context->scratch + context->scratch_head_stride * head_index +
+    context->scratch_tile_stride * query_tile_index);
+  void* accumulators = (void*) ((uintptr_t) scores + mr * scores_stride);
+  void* partial_outputs = (void*) ((uintptr_t) accumulators + mr * value_channels_size);
+  float* running_max = (float*) round_up_po2((uintptr_t) partial_outputs + mr * value_channels_size, sizeof(float));
+  float* running_sum = running_max + mr;
+  float* rescale = running_sum + mr;
+
+  // With causal masking, query i attends to keys up to i + (key_tokens - query_tokens), and the tiles past the last
+  // query's horizon are skipped entirely.
+  size_t key_end = key_tokens;
+  if (context->causal) {
+    key_end = query_start + query_tile + (key_tokens - query_tokens);
+  }
+
+  for (size_t i = 0; i < query_tile; i++) {
+    running_max[i] = -INFINITY;
+    running_sum[i] = 0.0f;
+  }
+  for (size_t key_start = 0; key_start < key_end; key_start += key_tile) {
+    const size_t key_count = min(key_tokens - key_start, key_tile);
+    const size_t key_count_size = key_count << log2_element_size;
+
+    // Scores for a tile of queries and a tile of keys: S = Q x (scale * K)^T.
+    context->gemm_ukernel(
+      query_tile, key_count, context->channels << log2_element_size,
+      q, context->channels << log2_element_size,
+      packed_k, scores, scores_stride, cn_stride,
+      &context->gemm_params);
+
+    for (size_t i = 0; i < query_tile; i++) {
+      void* s = (void*) ((uintptr_t) scores + i * scores_stride);
+      const size_t query_index = query_start + i;
+      if (context->mask != NULL) {
+        const void* m = (const void*) ((uintptr_t) context->mask + context->mask_stride * query_index +
+          (key_start << log2_element_size));
+        context->vadd_ukernel(key_count_size, s, m, s, &context->minmax_params);
+      }
+      if (context->causal) {
+        const size_t horizon = query_index + (key_tokens - query_tokens);
+        const size_t valid_keys = horizon < key_start ? 0 : min(horizon - key_start + 1, key_count);
+        for (size_t k = valid_keys; k < key_count; k++) {
+          context->from_fp32(-INFINITY, (void*) ((uintptr_t) s + (k << log2_element_size)));
+        }
+      }
+
+      // Online softmax: update the running maximum, and compute exp(s - max) and its sum.
+      union {
+        float as_float;
+        uint16_t as_half;
+      } tile_max, new_max, tile_sum;
+      context->rmax_ukernel(key_count_size, s, &tile_max);
+      const float previous_max = running_max[i];
+      const float max = math_max_f32(previous_max, context->to_fp32(&tile_max));
+      if (max == -INFINITY) {
+        // All keys seen so far are masked out for this query: the tile contributes nothing.
+        memset(s, 0, key_count_size);
+        rescale[i] = 1.0f;
+        continue;
+      }
+      context->from_fp32(max, &new_max);
+      context->raddstoreexpminusmax_ukernel(key_count_size, s, &new_max, s, &tile_sum, &context->expminus_params);
+
+      const float scale = previous_max == -INFINITY ? 0.0f : expf(previous_max - max);
+      running_max[i] = max;
+      running_sum[i] = running_sum[i] * scale + context->to_fp32(&tile_sum);
+      rescale[i] = scale;
+    }
+
+    // Outputs for the tile of keys: O = P x V. The first tile initializes the accumulators, and later tiles rescale
+    // the accumulators to the new running maximum before adding their contribution.
+    context->gemm_ukernel(
+      query_tile, context->value_channels, key_count_size,
+      scores, scores_stride,
+      packed_v, key_start == 0 ? accumulators : partial_outputs, value_channels_size, cn_stride,
+      &context->gemm_params);
+    if (key_start != 0) {
+      for (size_t i = 0; i < query_tile; i++) {
+        void* acc = (void*) ((uintptr_t) accumulators + i * value_channels_size);
+        const void* partial = (const void*) ((uintptr_t) partial_outputs + i * value_channels_size);
+        if (rescale[i] != 1.0f) {
+          union {
+            float as_float;
+            uint16_t as_half;
+          } acc_scale;
+          context->from_fp32(rescale[i], &acc_scale);
+          context->vmulc_ukernel(value_channels_size, acc, &acc_scale, acc, &context->minmax_params);
+        }
+        context->vadd_ukernel(value_channels_size, acc, partial, acc, &context->minmax_params);
+      }
+    }
+
+    packed_k = (const void*) ((uintptr_t) packed_k + context->packed_k_tile_stride);
+    packed_v = (const void*) ((uintptr_t) packed_v + context->packed_v_tile_stride);
+  }
+
+  // Normalize the accumulators by the sum of exponentials.
+  void* o = (void*) ((uintptr_t) context->o + context->o_head_stride * head_index + query_start * value_channels_size);
+  for (size_t i = 0; i < query_tile; i++) {
+    union {
+      float as_float;
+      uint16_t as_half;
+    } output_scale;
+    context->from_fp32(1.0f / running_sum[i], &output_scale);
+    context->vmulc_ukernel(
+      value_channels_size, (const void*) ((uintptr_t) accumulators + i * value_channels_size), &output_scale,
+      (void*) ((uintptr_t) o + i * value_channels_size), &context->minmax_params);
+  }
+}
+
+void xnn_compute_contiguous_reduce(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t output_idx0,
+    size_t output_idx1,
+    size_t output_idx2,
+    size_t output1_block_size,
+    size_t output2_block_size)
+{
+  assert(output1_block_size == 1);
+  const size_t* input_shape = context->input_shape;
+  const size_t* input_stride = context->input_stride;
+  const size_t row_size = input_shape[5] << context->log2_input_element_size;
+  const size_t output_offset =
+    output_idx0 * context->output_stride[0] + output_idx1 * context->output_stride[1] + output_idx2;
+
+  float* accumulators = context->accumulators != NULL ?
+    context->accumulators + output_offset : (float*) context->output + output_offset;
+  for (size_t k = 0; k < output2_block_size; k++) {
+    const uintptr_t input_base = (uintptr_t) context->input +
+      output_idx0 * input_stride[0] + output_idx1 * input_stride[2] + (output_idx2 + k) * input_stride[4];
+    float acc = context->compute_max ? -INFINITY : 0.0f;
+    for (size_t i = 0; i < input_shape[1]; i++) {
+      for (size_t j = 0; j < input_shape[3]; j++) {
+        const void* row = (const void*) (input_base + i * input_stride[1] + j * input_stride[3]);
+        if (context->rmax_ukernel != NULL) {
+          union {
+            float as_float;
+            uint16_t as_half;
+          } max;
+          context->rmax_ukernel(row_size, row, &max);
+          acc = math_max_f32(acc, context->to_fp32(&max));
+        } else if (context->u8_rmax_ukernel != NULL) {
+          // Flipping the sign bit maps signed elements onto unsigned elements with the same order.
+          const int8_t* x = (const int8_t*) row;
+          uint8_t chunk[256];
+          uint8_t row_max = 0;
+          for (size_t chunk_start = 0; chunk_start < input_shape[5]; chunk_start += sizeof(chunk)) {
+            const size_t chunk_size = min(input_shape[5] - chunk_start, sizeof(chunk));
+            for (size_t c = 0; c < chunk_size; c++) {
+              chunk[c] = (uint8_t) x[chunk_start + c] ^ UINT8_C(0x80);
+            }
+            uint8_t chunk_max;
+            context->u8_rmax_ukernel(chunk_size, chunk, &chunk_max);
+            row_max = row_max > chunk_max ? row_max : chunk_max;
+          }
+          const int32_t max_element = (int32_t) (int8_t) (row_max ^ UINT8_C(0x80));
+          acc = math_max_f32(acc, (float) (max_element - context->zero_point_correction));
+        } else if (context->qs8_rsum_ukernel != NULL) {
+          int32_t sum;
+          context->qs8_rsum_ukernel(row_size, row, &sum);
+          acc += (float) (sum - context->zero_point_correction);
+        } else {
+          float sum;
+          context->rsum_ukernel(row_size, row, &sum);
+          acc += sum;
+        }
+      }
+    }
+    accumulators[k] = acc * context->scale;
+  }
+
+  if (context->cvt_output_ukernel != NULL) {
+    context->cvt_output_ukernel(
+      output2_block_size * sizeof(float), accumulators,
+      (void*) ((uintptr_t) context->output + (output_offset << context->log2_output_element_size)),
+      &context->cvt_output_params);
+  }
+}
+
+void xnn_compute_discontiguous_reduce(
+    const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t output_idx0,
+    size_t output_idx1,
+    size_t output_idx2,
+    size_t output1_block_size,
+    size_t output2_block_size)
+{
+  assert(output1_block_size == 1);
+  const size_t* input_shape = context->input_shape;
+  const size_t* input_stride = context->input_stride;
+  const size_t output_offset =
+    output_idx0 * context->output_stride[0] + output_idx1 * context->output_stride[1] + output_idx2;
+  const size_t accumulators_size = output2_block_size * sizeof(float);
+
+  float* accumulators = context->accumulators != NULL ?
+    context->accumulators + output_offset : (float*) context->output + output_offset;
+  const uintptr_t input_base = (uintptr_t) context->input +
+    output_idx0 * input_stride[1] + output_idx1 * input_stride[3] + (output_idx2 << context->log2_input_element_size);
+  bool first_row = true;
+  for (size_t i = 0; i < input_shape[0]; i++) {
+    for (size_t j = 0; j < input_shape[2]; j++) {
+      for (size_t k = 0; k < input_shape[4]; k++) {
+        const void* row = (const void*) (input_base + i * input_stride[0] + j * input_stride[2] + k * input_stride[4]);
+        if (context->cvt_input_ukernel != NULL) {
+          float* converted_row = first_row ? accumulators : context->scratch + output_offset;
+          context->cvt_input_ukernel(
+            output2_block_size << context->log2_input_element_size, row, converted_row,
+            &context->cvt_input_params);
+          row = converted_row;
+        } else if (first_row) {
+          memcpy(accumulators, row, accumulators_size);
+        }
+        if (!first_row) {
+          context->vbinary_ukernel(accumulators_size, accumulators, row, accumulators, &context->vbinary_params);
+        }
+        first_row = false;
+      }
+    }
+  }
+
+  if (context->scale != 1.0f) {
+    context->vmulc_ukernel(accumulators_size, accumulators, &context->scale, accumulators, &context->vbinary_params);
+  }
+  if (context->cvt_output_ukernel != NULL) {
+    context->cvt_output_ukernel(
+      accumulators_size, accumulators,
+      (void*) ((uintptr_t) context->output + (output_offset << context->log2_output_element_size)),
+      &context->cvt_output_params);
+  }
+}
+
+// Total order of candidates for ArgMax and TopK operators: NaN is greater than any other value, and all NaNs are
+// equal to each other.
+static inline bool topk_greater(float a, float b) {
+  return a > b || (isnan(a) && !isnan(b));
+}
+
+// Inserts a candidate into the list of the largest values, sorted in descending order. Candidates are offered in
+// the order of increasing index, and a candidate goes after the equal values already in the list, so ties keep the
+// lower index first. Returns the new number of values in the list.
+static size_t topk_insert(
+    float* values,
+    int32_t* indices,
+    size_t count,
+    size_t k,
+    float value,
+    int32_t index)
+{
+  size_t position = count;
+  if (count == k) {
+    if (!topk_greater(value, values[k - 1])) {
+      return count;
+    }
+    position = k - 1;
+  } else {
+    count += 1;
+  }
+  while (position != 0 && topk_greater(value, values[position - 1])) {
+    values[position] = values[position - 1];
+    indices[position] = indices[position - 1];
+    position -= 1;
+  }
+  values[position] = value;
+  indices[position] = index;
+  return count;
+}
+
+// Finds the maximum of n elements and the lowest index where it occurs. RMAX micro-kernels may ignore NaN, so NaN is
+// detected by its propagation through the sum of the elements, and the first NaN is the maximum.
+static void argmax_block(
+    const struct topk_context context[restrict XNN_MIN_ELEMENTS(1)],
+    const void* input,
+    size_t n,
+    float* value,
+    int32_t* index)
+{
+  size_t max_index = 0;
+  switch (context->datatype) {
+    case xnn_datatype_fp32:
+    {
+      const float* x = (const float*) input;
+      float sum;
+      context->f32_rsum_ukernel(n * sizeof(float), x, &sum);
+      if XNN_UNLIKELY(isnan(sum)) {
+        // The sum is NaN for NaN elements, but also for infinities of both signs.
+        for (size_t i = 0; i < n; i++) {
+          if (isnan(x[i])) {
+            max_index = i;
+            goto f32_found;
+          }
+        }
+      }
+      float max_value;
+      context->rmax_ukernel(n * sizeof(float), x, &max_value);
+      for (size_t i = 0; i < n; i++) {
+        if (x[i] == max_value) {
+          max_index = i;
+          break;
+        }
+      }
+    f32_found:
+      *value = x[max_index];
+      break;
+    }
+    case xnn_datatype_fp16:
+    {
+      const uint16_t* x = (const uint16_t*) input;
+      float sum;
+      context->f16_rsum_ukernel(n * sizeof(uint16_t), x, &sum);
+      if XNN_UNLIKELY(isnan(sum)) {
+        for (size_t i = 0; i < n; i++) {
+          if ((x[i] & UINT16_C(0x7FFF)) > UINT16_C(0x7C00)) {
+            max_index = i;
+            goto f16_found;
+          }
+        }
+      }
+      uint16_t max_value;
+      context->rmax_ukernel(n * sizeof(uint16_t), x, &max_value);
+      for (size_t i = 0; i < n; i++) {
+        // Positive and negative zero compare equal.
+        if (x[i] == max_value || ((x[i] | max_value) & UINT16_C(0x7FFF)) == 0) {
+          max_index = i;
+          break;
+        }
+      }
+    f16_found:
+      *value = fp16_ieee_to_fp32_value(x[max_index]);
+      break;
+    }
+    case xnn_datatype_qint8:
+    {
+      // Flipping the sign bit maps signed elements onto unsigned elements with the same order.
+      const int8_t* x = (const int8_t*) input;
+      uint8_t chunk[256];
+      uint8_t max_value = 0;
+      size_t max_chunk_start = 0;
+      for (size_t chunk_start = 0; chunk_start < n; chunk_start += sizeof(chunk)) {
+        const size_t chunk_size = min(n - chunk_start, sizeof(chunk));
+        for (size_t i = 0; i < chunk_size; i++) {
+          chunk[i] = (uint8_t) x[chunk_start + i] ^ UINT8_C(0x80);
+        }
+        uint8_t chunk_max;
+        context->u8_rmax_ukernel(chunk_size, chunk, &chunk_max);
+        if (chunk_start == 0 || chunk_max > max_value) {
+          max_value = chunk_max;
+          max_chunk_start = chunk_start;
+        }
+      }
+      const int8_t max_element = (int8_t) (max_value ^ UINT8_C(0x80));
+      for (size_t i = max_chunk_start; i < n; i++) {
+        if (x[i] == max_element) {
+          max_index = i;
+          break;
+        }
+      }
+      *value = (float) x[max_index];
+      break;
+    }
+    default:
+      XNN_UNREACHABLE;
+  }
+  *index = (int32_t) max_index;
+}
+
+// Finds the k largest of n FP32 elements. Once the list is full, chunks of elements whose maximum does not exceed
+// the smallest value in the list, and which have no NaN, are skipped without inspecting individual elements. Returns
+// the number of values in the list, min(k, n).
+static size_t topk_block_f32(
+    const struct topk_context context[restrict XNN_MIN_ELEMENTS(1)],
+    const float* input,
+    size_t n,
+    size_t index_offset,
+    float* values,
+    int32_t* indices)
+{
+  const size_t k = context->k;
+  size_t count = 0;
+  for (size_t chunk_start = 0; chunk_start < n; chunk_start += 64) {
+    const size_t chunk_size = min(n - chunk_start, 64);
+    const float* x = input + chunk_start;
+    if (count == k) {
+      // Once the list is full of NaN, no other element can enter it.
+      if (isnan(values[k - 1])) {
+        break;
+      }
+      float chunk_max;
+      context->rmax_ukernel(chunk_size * sizeof(float), x, &chunk_max);
+      if (!(chunk_max > values[k - 1])) {
+        float chunk_sum;
+        context->f32_rsum_ukernel(chunk_size * sizeof(float), x, &chunk_sum);
+        if XNN_LIKELY(!isnan(chunk_sum)) {
+          continue;
+        }
+      }
+    }
+    for (size_t i = 0; i < chunk_size; i++) {
+      count = topk_insert(values, indices, count, k, x[i], (int32_t) (index_offset + chunk_start + i));
+    }
+  }
+  return count;
+}
+
+void xnn_compute_topk(
+    const struct topk_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index,
+    size_t block_index)
+{
+  const size_t k = context->k;
+  const size_t block_start = block_index * context->block_size;
+  const size_t block_size = min(context->channels - block_start, context->block_size);
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_stride +
+    (block_start << context->log2_element_size));
+
+  float* values;
+  int32_t* indices;
+  float argmax_value;
+  if (context->num_blocks == 1) {
+    values = context->output_values != NULL ? context->output_values + batch_index * k : &argmax_value;
+    indices = context->output_indices + batch_index * k;
+  } else {
+    const size_t partial_offset = (batch_index * context->num_blocks + block_index) * k;
+    values = context->partial_values + partial_offset;
+    indices = context->partial_indices + partial_offset;
+  }
+
+  if (k == 1) {
+    argmax_block(context, input, block_size, values, indices);
+    indices[0] += (int32_t) block_start;
+  } else {
+    assert(context->datatype == xnn_datatype_fp32);
+    topk_block_f32(context, (const float*) input, block_size, block_start, values, indices);
+  }
+}
+
+void xnn_compute_topk_merge(
+    const struct topk_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const size_t k = context->k;
+  const size_t num_blocks = context->num_blocks;
+  float* values = context->partial_values + batch_index * num_blocks * k;
+  int32_t* indices = context->partial_indices + batch_index * num_blocks * k;
+
+  // The first block holds at least k elements, so its list is full and the other blocks are merged into it.
+  for (size_t block_index = 1; block_index < num_blocks; block_index++) {
+    const size_t block_start = block_index * context->block_size;
+    const size_t block_size = min(context->channels - block_start, context->block_size);
+    const size_t count = min(block_size, k);
+    const float* block_values = values + block_index * k;
+    const int32_t* block_indices = indices + block_index * k;
+    for (size_t i = 0; i < count; i++) {
+      if (!topk_greater(block_values[i], values[k - 1])) {
+        break;
+      }
+      topk_insert(values, indices, k, k, block_values[i], block_indices[i]);
+    }
+  }
+
+  memcpy(context->output_indices + batch_index * k, indices, k * sizeof(int32_t));
+  if (context->output_values != NULL) {
+    memcpy(context->output_values + batch_index * k, values, k * sizeof(float));
+  }
+}
+
+void xnn_compute_embedding_lookup(
+    const struct embedding_lookup_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_start,
+    size_t batch_range)
+{
+  const size_t row_size = context->row_size;
+  const int32_t* indices = context->indices + batch_start;
+  void* output = (void*) ((uintptr_t) context->output + batch_start * row_size);
+  for (size_t i = 0; i < batch_range; i++) {
+    // Negative indices wrap around to large unsigned values and fail the same check.
+    const size_t index = (size_t) (uint32_t) indices[i];
+    if XNN_LIKELY(index < context->num_embeddings) {
+      context->copy_ukernel(row_size, (const void*) ((uintptr_t) context->table + index * row_size), output, NULL);
+    } else {
+      memset(output, 0, row_size);
+      *context->invalid_indices = true;
+    }
+    output = (void*) ((uintptr_t) output + row_size);
+  }
+}
+
+void xnn_compute_embedding_bag(
+    const struct embedding_lookup_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_start,
+    size_t batch_range)
+{
+  const size_t row_size = context->row_size;
+  const size_t bag_size = context->bag_size;
+  const int32_t* indices = context->indices + batch_start * bag_size;
+  void* output = (void*) ((uintptr_t) context->output + batch_start * row_size);
+  for (size_t i = 0; i < batch_range; i++) {
+    // The first row of the bag initializes the output, and the other rows are accumulated in the output. Rows of
+    // out-of-range indices count as zeros.
+    const size_t first_index = (size_t) (uint32_t) indices[0];
+    if XNN_LIKELY(first_index < context->num_embeddings) {
+      context->copy_ukernel(row_size, (const void*) ((uintptr_t) context->table + first_index * row_size), output, NULL);
+    } else {
+      memset(output, 0, row_size);
+      *context->invalid_indices = true;
+    }
+    for (size_t j = 1; j < bag_size; j++) {
+      const size_t index = (size_t) (uint32_t) indices[j];
+      if XNN_LIKELY(index < context->num_embeddings) {
+        context->vadd_ukernel(
+          row_size, output, (const void*) ((uintptr_t) context->table + index * row_size), output,
+          &context->minmax_params);
+      } else {
+        *context->invalid_indices = true;
+      }
+    }
+    if (context->vmulc_ukernel != NULL) {
+      context->vmulc_ukernel(row_size, output, &context->scale, output, &context->minmax_params);
+    }
+    indices += bag_size;
+    output = (void*) ((uintptr_t) output + row_size);
+  }
+}
+
 void xnn_compute_vmulcaddc(
     const struct vmulcaddc_context context[restrict XNN_MIN_ELEMENTS(1)],
     size_t batch_start,
@@ -1174,6 +2229,53 @@ void xnn_compute_vmulcaddc(
     &context->params);
 }
 
+void xnn_compute_streaming_convolution_window(
+    const struct streaming_convolution_context context[restrict XNN_MIN_ELEMENTS(1)],
+    size_t batch_index)
+{
+  const size_t frame_size = context->frame_size;
+  const size_t window_frame_stride = context->window_frame_stride;
+  const size_t history_frames = context->history_frames;
+  const size_t input_frames = context->input_frames;
+
+  const void* input = (const void*) ((uintptr_t) context->input + batch_index * context->input_batch_stride);
+  void* state = (void*) ((uintptr_t) context->state + batch_index * context->state_batch_stride);
+  void* window = (void*) ((uintptr_t) context->window + batch_index * context->window_batch_stride);
+  const size_t head = context->state_heads[batch_index];
+
+  // Window = [history frames, oldest first | new frames].
+  size_t state_index = head;
+  for (size_t i = 0; i < history_frames; i++) {
+    memcpy(
+      (void*) ((uintptr_t) window + i * window_frame_stride),
+      (const void*) ((uintptr_t) state + state_index * frame_size),
+      frame_size);
+    if (++state_index == history_frames) {
+      state_index = 0;
+    }
+  }
+  for (size_t i = 0; i < input_frames; i++) {
+    memcpy(
+      (void*) ((uintptr_t) window + (history_frames + i) * window_frame_stride),
+      (const void*) ((uintptr_t) input + i * context->input_frame_stride),
+      frame_size);
+  }
+  // The last new frames replace the oldest frames of the history in place, and the head moves past them, so the
+  // history is never shifted. The convolution reads only the window, so the state can be updated before it runs.
+  const size_t updated_frames = min(input_frames, history_frames);
+  state_index = (head + input_frames - updated_frames) % history_frames;
+  for (size_t i = input_frames - updated_frames; i < input_frames; i++) {
+    memcpy(
+      (void*) ((uintptr_t) state + state_index * frame_size),
+      (const void*) ((uintptr_t) input + i * context->input_frame_stride),
+      frame_size);
+    if (++state_index == history_frames) {
+      state_index = 0;
+    }
+  }
+  context->state_heads[batch_index] = state_index;
+}
+
 #if XNN_MAX_UARCH_TYPES > 1
   void xnn_compute_hmp_grouped_gemm(
       const struct gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
@@ -1334,231 +2436,247 @@ void xnn_compute_vmulcaddc(
   }
 #endif  // XNN_MAX_UARCH_TYPES > 1
 
-enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+static void run_compute(
+    const struct compute_parameters* compute,
+    void* context,
+    pthreadpool_t threadpool,
+    uint32_t flags)
 {
-  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
-    xnn_log_error("failed to run operator: XNNPACK is not initialized");
-    return xnn_status_uninitialized;
-  }
-  switch (op->state) {
-    case xnn_run_state_invalid:
-      xnn_log_error("failed to run operator: operator was not successfully setup");
-      return xnn_status_invalid_state;
-    case xnn_run_state_ready:
-      break;
-    case xnn_run_state_skip:
-      return xnn_status_success;
-  }
-
-  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
-  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
-    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
-  }
-  switch (op->compute.type) {
+  switch (compute->type) {
     case xnn_parallelization_type_invalid:
       break;
     case xnn_parallelization_type_1d:
-      assert(op->compute.range[0] != 0);
+      assert(compute->range[0] != 0);
       pthreadpool_parallelize_1d(
           threadpool,
-          op->compute.task_1d,
-          &op->context,
-          op->compute.range[0],
+          compute->task_1d,
+          context,
+          compute->range[0],
           flags);
       break;
     case xnn_parallelization_type_1d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_1d_tile_1d(
           threadpool,
-          op->compute.task_1d_tile_1d,
-          &op->context,
-          op->compute.range[0],
-          op->compute.tile[0],
+          compute->task_1d_tile_1d,
+          context,
+          compute->range[0],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
       pthreadpool_parallelize_2d(
           threadpool,
-          op->compute.task_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
+          compute->task_2d,
+          context,
+          compute->range[0], compute->range[1],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_1d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
       pthreadpool_parallelize_2d_tile_1d(
           threadpool,
-          op->compute.task_2d_tile_1d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0],
+          compute->task_2d_tile_1d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0],
           flags);
       break;
     case xnn_parallelization_type_2d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d(
           threadpool,
-          op->compute.task_2d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_2d_tile_2d,
+          context,
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
       pthreadpool_parallelize_3d(
           threadpool,
-          op->compute.task_3d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
+          compute->task_3d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d(
           threadpool,
-          op->compute.task_3d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_3d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
       pthreadpool_parallelize_4d(
           threadpool,
-          op->compute.task_4d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
+          compute->task_4d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d(
           threadpool,
-          op->compute.task_4d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_4d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_5d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
       pthreadpool_parallelize_5d(
           threadpool,
-          op->compute.task_5d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
+          compute->task_5d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
           flags);
       break;
     case xnn_parallelization_type_5d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_5d_tile_2d(
           threadpool,
-          op->compute.task_5d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_5d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_6d_tile_2d:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.range[4] != 0);
-      assert(op->compute.range[5] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->range[4] != 0);
+      assert(compute->range[5] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_6d_tile_2d(
           threadpool,
-          op->compute.task_6d_tile_2d,
-          &op->context,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3], op->compute.range[4], op->compute.range[5],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->task_6d_tile_2d,
+          context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3], compute->range[4], compute->range[5],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #if XNN_MAX_UARCH_TYPES > 1
     case xnn_parallelization_type_2d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_2d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_2d_tile_2d_with_id,
-          &op->context,
+          compute->task_2d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_3d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_3d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_3d_tile_2d_with_id,
-          &op->context,
+          compute->task_3d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
     case xnn_parallelization_type_4d_tile_2d_with_uarch:
-      assert(op->compute.range[0] != 0);
-      assert(op->compute.range[1] != 0);
-      assert(op->compute.range[2] != 0);
-      assert(op->compute.range[3] != 0);
-      assert(op->compute.tile[0] != 0);
-      assert(op->compute.tile[1] != 0);
+      assert(compute->range[0] != 0);
+      assert(compute->range[1] != 0);
+      assert(compute->range[2] != 0);
+      assert(compute->range[3] != 0);
+      assert(compute->tile[0] != 0);
+      assert(compute->tile[1] != 0);
       pthreadpool_parallelize_4d_tile_2d_with_uarch(
           threadpool,
-          op->compute.task_4d_tile_2d_with_id,
-          &op->context,
+          compute->task_4d_tile_2d_with_id,
+          context,
           0 /* default uarch index */, XNN_MAX_UARCH_TYPES - 1,
-          op->compute.range[0], op->compute.range[1], op->compute.range[2], op->compute.range[3],
-          op->compute.tile[0], op->compute.tile[1],
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1],
           flags);
       break;
 #endif  // XNN_MAX_UARCH_TYPES > 1
     default:
       XNN_UNREACHABLE;
   }
+}
+
+enum xnn_status xnn_run_operator(xnn_operator_t op, pthreadpool_t threadpool)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to run operator: XNNPACK is not initialized");
+    return xnn_status_uninitialized;
+  }
+  switch (op->state) {
+    case xnn_run_state_invalid:
+      xnn_log_error("failed to run operator: operator was not successfully setup");
+      return xnn_status_invalid_state;
+    case xnn_run_state_ready:
+      break;
+    case xnn_run_state_skip:
+      return xnn_status_success;
+  }
+
+  uint32_t flags = PTHREADPOOL_FLAG_DISABLE_DENORMALS;
+  if (op->flags & XNN_FLAG_YIELD_WORKERS) {
+    flags |= PTHREADPOOL_FLAG_YIELD_WORKERS;
+  }
+  run_compute(&op->compute, &op->context, threadpool, flags);
+  // Operators with a second phase (e.g. split-K Fully Connected) run it after the first one completes.
+  run_compute(&op->compute2, &op->context, threadpool, flags);
+  if XNN_UNLIKELY(op->invalid_indices) {
+    op->invalid_indices = false;
+    xnn_log_error("failed to run %s operator: indices out of range", xnn_operator_type_to_string(op->type));
+    return xnn_status_invalid_parameter;
+  }
   return xnn_status_success;
 }
@@ -13,7 +13,7 @@
 
 #include <xnnpack/operator-type.h>
 
-static const uint16_t offset[] = {0,8,22,36,50,64,78,105,133,161,188,206,231,257,273,289,304,319,341,364,387,410,433,456,479,502,525,549,573,597,621,645,669,683,698,713,739,765,791,817,849,875,902,929,946,960,974,990,1016,1042,1068,1094,1128,1162,1196,1230,1264,1284,1304,1325,1346,1367,1391,1415,1438,1461,1479,1497,1516,1535,1554,1573,1590,1606,1622,1650,1678,1705,1732,1760,1778,1796,1814,1832,1850,1868,1886,1903,1925,1954,1973,1992,2011,2026,2041,2062,2081,2101,2121};
+static const uint16_t offset[] = {0,8,22,36,50,64,78,95,112,129,156,184,212,240,269,296,314,339,365,381,397,412,427,449,472,495,519,542,565,589,612,635,653,676,694,717,741,765,789,813,837,861,886,911,936,950,965,980,1006,1032,1058,1084,1116,1142,1169,1196,1213,1230,1244,1258,1282,1306,1332,1359,1386,1400,1414,1430,1457,1483,1509,1541,1567,1604,1641,1667,1704,1730,1745,1760,1794,1828,1862,1896,1930,1950,1970,1990,2020,2050,2071,2092,2113,2134,2148,2162,2186,2210,2233,2256,2281,2306,2330,2354,2372,2390,2408,2426,2445,2464,2483,2502,2519,2535,2551,2568,2585,2602,2630,2658,2685,2712,2740,2776,2812,2847,2882,2918,2954,2989,3024,3065,3106,3124,3142,3160,3178,3193,3208,3223,3239,3255,3273,3291,3309,3327,3344,3366,3395,3424,3457,3490,3523,3542,3561,3580,3595,3610,3625,3640,3655,3676,3695,3715,3735};
 
 static const char *data =
     "Invalid\0"
@@ -22,9 +22,14 @@ static const char *data =
     "Add (ND, F32)\0"
     "Add (ND, QS8)\0"
     "Add (ND, QU8)\0"
+    "ArgMax (NC, F16)\0"
+    "ArgMax (NC, F32)\0"
+    "ArgMax (NC, QS8)\0"
     "ArgMax Pooling (NHWC, F32)\0"
     "Average Pooling (NHWC, F32)\0"
+    "Average Pooling (NHWC, QS8)\0"
     "Average Pooling (NHWC, QU8)\0"
+    "Average Pooling (NDHWC, F32)\0"
     "Bankers Rounding (NC, F32)\0"
     "Ceiling (NC, F32)\0"
     "Channel Shuffle (NC, X8)\0"
@@ -36,11 +41,15 @@ static const char *data =
     "Constant Pad (ND, X8)\0"
     "Constant Pad (ND, X16)\0"
     "Constant Pad (ND, X32)\0"
+    "Convert (NC, BF16, F32)\0"
     "Convert (NC, F16, F32)\0"
     "Convert (NC, F32, F16)\0"
+    "Convert (NC, F32, BF16)\0"
     "Convert (NC, F32, QS8)\0"
     "Convert (NC, F32, QU8)\0"
+    "Convert (NC, QS8)\0"
     "Convert (NC, QS8, F32)\0"
+    "Convert (NC, QU8)\0"
     "Convert (NC, QU8, F32)\0"
     "Convolution (NHWC, F16)\0"
     "Convolution (NHWC, F32)\0"
@@ -48,6 +57,9 @@ static const char *data =
     "Convolution (NHWC, QS8)\0"
     "Convolution (NHWC, QU8)\0"
     "Convolution (NCHW, F32)\0"
+    "Convolution (NDHWC, F16)\0"
+    "Convolution (NDHWC, F32)\0"
+    "Convolution (NDHWC, QS8)\0"
     "Copy (NC, X8)\0"
     "Copy (NC, X16)\0"
     "Copy (NC, X32)\0"
@@ -60,13 +72,29 @@ static const char *data =
     "Depth To Space (NHWC, X16)\0"
     "Depth To Space (NHWC, X32)\0"
     "Divide (ND, F32)\0"
+    "Divide (ND, QS8)\0"
     "ELU (NC, F32)\0"
     "ELU (NC, QS8)\0"
+    "Embedding Bag (NC, F16)\0"
+    "Embedding Bag (NC, F32)\0"
+    "Embedding Lookup (NC, X8)\0"
+    "Embedding Lookup (NC, X16)\0"
+    "Embedding Lookup (NC, X32)\0"
+    "Exp (NC, F16)\0"
+    "Exp (NC, F32)\0"
     "Floor (NC, F32)\0"
+    "Fully Connected (NC, BF16)\0"
     "Fully Connected (NC, F16)\0"
     "Fully Connected (NC, F32)\0"
+    "Fully Connected (NC, F32, QC4W)\0"
+    "Fully Connected (NC, QC8)\0"
+    "Fully Connected (NC, QD8, F32, QC4W)\0"
+    "Fully Connected (NC, QD8, F32, QC8W)\0"
     "Fully Connected (NC, QS8)\0"
+    "Fully Connected (NC, QS8, F32, QC8W)\0"
     "Fully Connected (NC, QU8)\0"
+    "GELU (NC, F16)\0"
+    "GELU (NC, F32)\0"
     "Global Average Pooling (NWC, F16)\0"
     "Global Average Pooling (NWC, F32)\0"
     "Global Average Pooling (NWC, QS8)\0"
@@ -74,15 +102,27 @@ static const char *data =
     "Global Average Pooling (NCW, F32)\0"
     "HardSwish (NC, F16)\0"
     "HardSwish (NC, F32)\0"
+    "HardSwish (NC, QS8)\0"
+    "Layer Normalization (NC, F16)\0"
+    "Layer Normalization (NC, F32)\0"
     "Leaky ReLU (NC, F16)\0"
     "Leaky ReLU (NC, F32)\0"
+    "Leaky ReLU (NC, QS8)\0"
     "Leaky ReLU (NC, QU8)\0"
+    "Log (NC, F16)\0"
+    "Log (NC, F32)\0"
     "Max Pooling (NHWC, F16)\0"
     "Max Pooling (NHWC, F32)\0"
     "Max Pooling (NHWC, S8)\0"
     "Max Pooling (NHWC, U8)\0"
+    "Max Pooling (NDHWC, F16)\0"
+    "Max Pooling (NDHWC, F32)\0"
+    "Max Pooling (NDHWC, S8)\0"
+    "Max Pooling (NDHWC, U8)\0"
     "Maximum (ND, F32)\0"
+    "Maximum (ND, QS8)\0"
     "Minimum (ND, F32)\0"
+    "Minimum (ND, QS8)\0"
     "Multiply (ND, F16)\0"
     "Multiply (ND, F32)\0"
     "Multiply (ND, QS8)\0"
@@ -90,26 +130,52 @@ static const char *data =
     "Negate (NC, F32)\0"
     "PReLU (NC, F16)\0"
     "PReLU (NC, F32)\0"
+    "Reduce (ND, F16)\0"
+    "Reduce (ND, F32)\0"
+    "Reduce (ND, QS8)\0"
     "Resize Bilinear (NHWC, F16)\0"
     "Resize Bilinear (NHWC, F32)\0"
     "Resize Bilinear (NHWC, S8)\0"
     "Resize Bilinear (NHWC, U8)\0"
     "Resize Bilinear (NCHW, F32)\0"
+    "Resize Nearest Neighbor (NHWC, F16)\0"
+    "Resize Nearest Neighbor (NHWC, F32)\0"
+    "Resize Nearest Neighbor (NHWC, S8)\0"
+    "Resize Nearest Neighbor (NHWC, U8)\0"
+    "Resize Nearest Neighbor (NCHW, F16)\0"
+    "Resize Nearest Neighbor (NCHW, F32)\0"
+    "Resize Nearest Neighbor (NCHW, S8)\0"
+    "Resize Nearest Neighbor (NCHW, U8)\0"
+    "Scaled Dot-Product Attention (NHTC, F16)\0"
+    "Scaled Dot-Product Attention (NHTC, F32)\0"
     "Sigmoid (NC, F16)\0"
     "Sigmoid (NC, F32)\0"
     "Sigmoid (NC, QS8)\0"
     "Sigmoid (NC, QU8)\0"
+    "SiLU (NC, F16)\0"
+    "SiLU (NC, F32)\0"
+    "Slice (ND, X8)\0"
+    "Slice (ND, X16)\0"
+    "Slice (ND, X32)\0"
     "Softmax (NC, F16)\0"
     "Softmax (NC, F32)\0"
+    "Softmax (NC, QS8)\0"
     "Softmax (NC, QU8)\0"
     "Square (NC, F32)\0"
     "Square Root (NC, F32)\0"
     "Squared Difference (NC, F32)\0"
+    "Squared Difference (NC, QS8)\0"
+    "Streaming Convolution (NWC, F16)\0"
+    "Streaming Convolution (NWC, F32)\0"
+    "Streaming Convolution (NWC, QS8)\0"
     "Subtract (ND, F32)\0"
     "Subtract (ND, QS8)\0"
     "Subtract (ND, QU8)\0"
+    "Tanh (NC, F16)\0"
+    "Tanh (NC, F32)\0"
     "Tanh (NC, QS8)\0"
     "Tanh (NC, QU8)\0"
+    "TopK (NC, F32)\0"
     "Truncation (NC, F32)\0"
     "Transpose (ND, X8)\0"
     "Transpose (ND, X16)\0"
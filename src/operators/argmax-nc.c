@@ -0,0 +1,326 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_topk_nc(
+    size_t channels,
+    size_t input_stride,
+    size_t k,
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* topk_op_out)
+{
+  xnn_operator_t topk_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), channels);
+    goto error;
+  }
+
+  if (channels > (size_t) INT32_MAX + 1) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must not exceed 2**31",
+      xnn_operator_type_to_string(operator_type), channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(operator_type), input_stride, channels);
+    goto error;
+  }
+
+  if (k == 0 || k > channels) {
+    xnn_log_error(
+      "failed to create %s operator with k of %zu: k must be in [1, %zu] range",
+      xnn_operator_type_to_string(operator_type), k, channels);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  topk_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (topk_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  topk_op->channels = channels;
+  topk_op->input_pixel_stride = input_stride;
+  topk_op->params.topk_k = k;
+
+  topk_op->type = operator_type;
+  topk_op->flags = flags;
+
+  topk_op->state = xnn_run_state_invalid;
+
+  *topk_op_out = topk_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(topk_op);
+  return status;
+}
+
+enum xnn_status xnn_create_argmax_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    uint32_t flags,
+    xnn_operator_t* argmax_op_out)
+{
+  return create_topk_nc(
+    channels, input_stride, 1 /* k */, flags,
+    XNN_INIT_FLAG_F16, xnn_operator_type_argmax_nc_f16,
+    argmax_op_out);
+}
+
+enum xnn_status xnn_create_argmax_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    uint32_t flags,
+    xnn_operator_t* argmax_op_out)
+{
+  return create_topk_nc(
+    channels, input_stride, 1 /* k */, flags,
+    XNN_INIT_FLAG_F32, xnn_operator_type_argmax_nc_f32,
+    argmax_op_out);
+}
+
+enum xnn_status xnn_create_argmax_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    uint32_t flags,
+    xnn_operator_t* argmax_op_out)
+{
+  // Signed elements are mapped onto unsigned elements, and the maximum is found with the U8 RMAX micro-kernel.
+  return create_topk_nc(
+    channels, input_stride, 1 /* k */, flags,
+    XNN_INIT_FLAG_U8, xnn_operator_type_argmax_nc_qs8,
+    argmax_op_out);
+}
+
+enum xnn_status xnn_create_topk_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t k,
+    uint32_t flags,
+    xnn_operator_t* topk_op_out)
+{
+  return create_topk_nc(
+    channels, input_stride, k, flags,
+    XNN_INIT_FLAG_F32, xnn_operator_type_topk_nc_f32,
+    topk_op_out);
+}
+
+static enum xnn_status setup_topk_nc(
+    xnn_operator_t topk_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    const void* input,
+    float* output_values,
+    int32_t* output_indices,
+    uint32_t log2_element_size,
+    enum xnn_datatype datatype,
+    size_t num_threads)
+{
+  if (topk_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(topk_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  topk_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(topk_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    topk_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  const size_t channels = topk_op->channels;
+  const size_t k = topk_op->params.topk_k;
+
+  // Split long rows into blocks which are searched independently, and split further when there are fewer rows than
+  // threads, as long as blocks stay long enough to amortize the merge of their candidates.
+  const size_t max_block_size = 4096;
+  size_t num_blocks = divide_round_up(channels, max_block_size);
+  if (num_threads > 1 && batch_size < num_threads) {
+    const size_t min_block_size = 1024;
+    const size_t target_blocks = divide_round_up(num_threads, batch_size);
+    num_blocks = max(num_blocks, min(target_blocks, channels / min_block_size));
+  }
+  // Every block holds at least k elements, so the candidates of the first block fill the list of the k largest.
+  const size_t block_size = max(divide_round_up(channels, num_blocks), k);
+  num_blocks = divide_round_up(channels, block_size);
+
+  float* partial_values = NULL;
+  int32_t* partial_indices = NULL;
+  if (num_blocks > 1) {
+    const size_t num_candidates = batch_size * num_blocks * k;
+    const size_t partial_values_size = round_up_po2(num_candidates * sizeof(float), XNN_ALLOCATION_ALIGNMENT);
+    const size_t workspace_size = partial_values_size + num_candidates * sizeof(int32_t);
+    if (workspace_size > topk_op->workspace_size) {
+      xnn_release_simd_memory(topk_op->workspace);
+      topk_op->workspace_size = 0;
+      topk_op->workspace = xnn_allocate_simd_memory(workspace_size);
+      if (topk_op->workspace == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator workspace",
+          workspace_size, xnn_operator_type_to_string(topk_op->type));
+        return xnn_status_out_of_memory;
+      }
+      topk_op->workspace_size = workspace_size;
+    }
+    partial_values = (float*) topk_op->workspace;
+    partial_indices = (int32_t*) ((uintptr_t) topk_op->workspace + partial_values_size);
+  }
+
+  topk_op->batch_size = batch_size;
+  topk_op->input = input;
+  topk_op->output = output_indices;
+
+  topk_op->context.topk = (struct topk_context) {
+    .input = input,
+    .input_stride = topk_op->input_pixel_stride << log2_element_size,
+    .channels = channels,
+    .block_size = block_size,
+    .num_blocks = num_blocks,
+    .k = k,
+    .log2_element_size = log2_element_size,
+    .datatype = datatype,
+    .partial_values = partial_values,
+    .partial_indices = partial_indices,
+    .output_values = output_values,
+    .output_indices = output_indices,
+  };
+  switch (datatype) {
+    case xnn_datatype_fp16:
+      topk_op->context.topk.rmax_ukernel = xnn_params.f16.rmax;
+      topk_op->context.topk.f16_rsum_ukernel = xnn_params.f16.rsum;
+      break;
+    case xnn_datatype_fp32:
+      topk_op->context.topk.rmax_ukernel = xnn_params.f32.rmax;
+      topk_op->context.topk.f32_rsum_ukernel = xnn_params.f32.rsum;
+      break;
+    case xnn_datatype_qint8:
+      topk_op->context.topk.u8_rmax_ukernel = xnn_params.u8.rmax;
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+
+  topk_op->compute.type = xnn_parallelization_type_2d;
+  topk_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_topk;
+  topk_op->compute.range[0] = batch_size;
+  topk_op->compute.range[1] = num_blocks;
+  if (num_blocks > 1) {
+    topk_op->compute2.type = xnn_parallelization_type_1d;
+    topk_op->compute2.task_1d = (pthreadpool_task_1d_t) xnn_compute_topk_merge;
+    topk_op->compute2.range[0] = batch_size;
+  } else {
+    topk_op->compute2.type = xnn_parallelization_type_invalid;
+  }
+  topk_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_argmax_nc_f16(
+    xnn_operator_t argmax_op,
+    size_t batch_size,
+    const void* input,
+    int32_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_topk_nc(
+    argmax_op, xnn_operator_type_argmax_nc_f16,
+    batch_size, input, NULL /* output values */, output,
+    1 /* log2(sizeof(uint16_t)) */, xnn_datatype_fp16,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_argmax_nc_f32(
+    xnn_operator_t argmax_op,
+    size_t batch_size,
+    const float* input,
+    int32_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_topk_nc(
+    argmax_op, xnn_operator_type_argmax_nc_f32,
+    batch_size, input, NULL /* output values */, output,
+    2 /* log2(sizeof(float)) */, xnn_datatype_fp32,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_argmax_nc_qs8(
+    xnn_operator_t argmax_op,
+    size_t batch_size,
+    const int8_t* input,
+    int32_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_topk_nc(
+    argmax_op, xnn_operator_type_argmax_nc_qs8,
+    batch_size, input, NULL /* output values */, output,
+    0 /* log2(sizeof(int8_t)) */, xnn_datatype_qint8,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_topk_nc_f32(
+    xnn_operator_t topk_op,
+    size_t batch_size,
+    const float* input,
+    float* output_values,
+    int32_t* output_indices,
+    pthreadpool_t threadpool)
+{
+  return setup_topk_nc(
+    topk_op, xnn_operator_type_topk_nc_f32,
+    batch_size, input, output_values, output_indices,
+    2 /* log2(sizeof(float)) */, xnn_datatype_fp32,
+    pthreadpool_get_threads_count(threadpool));
+}
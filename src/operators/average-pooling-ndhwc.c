@@ -0,0 +1,452 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/indirection.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+static inline size_t compute_output_dimension(
+    size_t padded_input_dimension,
+    size_t pooling_dimension,
+    size_t stride_dimension)
+{
+  return doz(padded_input_dimension, pooling_dimension) / stride_dimension + 1;
+}
+
+static inline size_t compute_output_dimension_with_tf_same_padding(
+    size_t input_dimension,
+    size_t stride_dimension)
+{
+  return divide_round_up(input_dimension, stride_dimension);
+}
+
+enum xnn_status xnn_create_average_pooling3d_ndhwc_f32(
+    uint32_t input_padding_front,
+    uint32_t input_padding_back,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_depth,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_depth,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_operator_t* average_pooling_op_out)
+{
+  xnn_operator_t average_pooling_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  const uint32_t pooling_size = pooling_depth * pooling_height * pooling_width;
+  if (pooling_size == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 "x%" PRIu32 " pooling size: "
+      "pooling size dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32),
+      pooling_width, pooling_height, pooling_depth);
+    goto error;
+  }
+
+  if (pooling_size == 1) {
+    xnn_log_error(
+      "failed to create %s operator with 1 pooling element: 1x1x1 pooling is meaningless",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32));
+    goto error;
+  }
+
+  if (stride_depth == 0 || stride_height == 0 || stride_width == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 "x%" PRIu32 " stride: "
+      "stride dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32),
+      stride_width, stride_height, stride_depth);
+    goto error;
+  }
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32), channels);
+    goto error;
+  }
+
+  if (input_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32), input_pixel_stride, channels);
+    goto error;
+  }
+
+  if (output_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32), output_pixel_stride, channels);
+    goto error;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32));
+    goto error;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32));
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32), output_min, output_max);
+    goto error;
+  }
+
+  const bool any_padding = (input_padding_front | input_padding_back | input_padding_left | input_padding_top |
+    input_padding_right | input_padding_bottom) != 0;
+  if ((flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0) {
+    if (any_padding) {
+      xnn_log_error(
+        "failed to create %s operator with %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" "
+        "padding: TensorFlow SAME padding can't be combined with explicit padding specification",
+        xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32),
+        input_padding_front, input_padding_top, input_padding_left,
+        input_padding_back, input_padding_bottom, input_padding_right);
+      goto error;
+    }
+  }
+
+  status = xnn_status_out_of_memory;
+
+  average_pooling_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (average_pooling_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32));
+    goto error;
+  }
+
+  const size_t zero_bytes = channels * sizeof(float) + XNN_EXTRA_BYTES;
+  void* zero_buffer = xnn_allocate_zero_simd_memory(zero_bytes);
+  if (zero_buffer == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator zero padding",
+      zero_bytes, xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32));
+    goto error;
+  }
+  average_pooling_op->zero_buffer = zero_buffer;
+
+  average_pooling_op->padding_front = input_padding_front;
+  average_pooling_op->padding_back = input_padding_back;
+  average_pooling_op->padding_top = input_padding_top;
+  average_pooling_op->padding_right = input_padding_right;
+  average_pooling_op->padding_bottom = input_padding_bottom;
+  average_pooling_op->padding_left = input_padding_left;
+
+  average_pooling_op->kernel_depth = pooling_depth;
+  average_pooling_op->kernel_height = pooling_height;
+  average_pooling_op->kernel_width = pooling_width;
+  average_pooling_op->stride_depth = stride_depth;
+  average_pooling_op->stride_height = stride_height;
+  average_pooling_op->stride_width = stride_width;
+  average_pooling_op->channels = channels;
+  average_pooling_op->input_pixel_stride = input_pixel_stride;
+  average_pooling_op->output_pixel_stride = output_pixel_stride;
+
+  average_pooling_op->type = xnn_operator_type_average_pooling_ndhwc_f32;
+  // Padding pixels are excluded from the average: padded pooling windows use the PAVGPOOL micro-kernel with a
+  // per-pixel multiplier of 1 / (number of valid input pixels in the window).
+  const bool tf_same_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0;
+  if (any_padding || tf_same_padding) {
+    xnn_params.f32.pavgpool.init.f32(&average_pooling_op->params.f32_minmax, output_min, output_max);
+    average_pooling_op->ukernel.type = xnn_ukernel_type_pixelwise_average_pooling;
+  } else {
+    xnn_params.f32.avgpool.init.f32(&average_pooling_op->params.f32_scaleminmax,
+      1.0f / (float) pooling_size, output_min, output_max);
+    average_pooling_op->ukernel.type = xnn_ukernel_type_average_pooling;
+  }
+  average_pooling_op->flags = flags;
+
+  average_pooling_op->state = xnn_run_state_invalid;
+
+  *average_pooling_op_out = average_pooling_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(average_pooling_op);
+  return status;
+}
+
+static void compute_tf_same_padding(
+    size_t input_dimension,
+    uint32_t pooling_dimension,
+    uint32_t stride_dimension,
+    size_t* output_dimension,
+    uint32_t* padding_before,
+    uint32_t* padding_after)
+{
+  *output_dimension = compute_output_dimension_with_tf_same_padding(input_dimension, stride_dimension);
+  const size_t total_padding = doz((*output_dimension - 1) * stride_dimension + pooling_dimension, input_dimension);
+  *padding_before = total_padding / 2;
+  *padding_after = total_padding - *padding_before;
+}
+
+static inline size_t compute_valid_range(
+    size_t output_index,
+    uint32_t stride,
+    uint32_t pooling_dimension,
+    uint32_t padding_before,
+    size_t input_dimension)
+{
+  const size_t input_start = doz(output_index * stride, padding_before);
+  const size_t input_end = min(doz(output_index * stride + pooling_dimension, padding_before), input_dimension);
+  return input_end - input_start;
+}
+
+enum xnn_status xnn_setup_average_pooling3d_ndhwc_f32(
+    xnn_operator_t average_pooling_op,
+    size_t batch_size,
+    size_t input_depth,
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (average_pooling_op->type != xnn_operator_type_average_pooling_ndhwc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_ndhwc_f32),
+      xnn_operator_type_to_string(average_pooling_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  average_pooling_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(average_pooling_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_depth == 0 || input_height == 0 || input_width == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zux%zu input: input dimensions must be non-zero",
+      xnn_operator_type_to_string(average_pooling_op->type), input_width, input_height, input_depth);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    average_pooling_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  average_pooling_op->input_depth = input_depth;
+  average_pooling_op->input_height = input_height;
+  average_pooling_op->input_width = input_width;
+  average_pooling_op->input = input;
+
+  if (average_pooling_op->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+    compute_tf_same_padding(
+      input_depth, average_pooling_op->kernel_depth, average_pooling_op->stride_depth,
+      &average_pooling_op->output_depth, &average_pooling_op->padding_front, &average_pooling_op->padding_back);
+    compute_tf_same_padding(
+      input_height, average_pooling_op->kernel_height, average_pooling_op->stride_height,
+      &average_pooling_op->output_height, &average_pooling_op->padding_top, &average_pooling_op->padding_bottom);
+    compute_tf_same_padding(
+      input_width, average_pooling_op->kernel_width, average_pooling_op->stride_width,
+      &average_pooling_op->output_width, &average_pooling_op->padding_left, &average_pooling_op->padding_right);
+  } else {
+    average_pooling_op->output_depth = compute_output_dimension(
+        average_pooling_op->padding_front + input_depth + average_pooling_op->padding_back,
+        average_pooling_op->kernel_depth,
+        average_pooling_op->stride_depth);
+    average_pooling_op->output_height = compute_output_dimension(
+        average_pooling_op->padding_top + input_height + average_pooling_op->padding_bottom,
+        average_pooling_op->kernel_height,
+        average_pooling_op->stride_height);
+    average_pooling_op->output_width = compute_output_dimension(
+        average_pooling_op->padding_left + input_width + average_pooling_op->padding_right,
+        average_pooling_op->kernel_width,
+        average_pooling_op->stride_width);
+  }
+  average_pooling_op->output = output;
+
+  const bool is_pixelwise = average_pooling_op->ukernel.type == xnn_ukernel_type_pixelwise_average_pooling;
+  const size_t output_depth = average_pooling_op->output_depth;
+  const size_t output_height = average_pooling_op->output_height;
+  const size_t output_width = average_pooling_op->output_width;
+  // Output rows of all output depth slices are processed as a single [output_depth * output_height] dimension.
+  const size_t output_rows = output_depth * output_height;
+  const size_t pooling_width = average_pooling_op->kernel_width;
+  const size_t column_size = average_pooling_op->kernel_depth * average_pooling_op->kernel_height;
+  const size_t pooling_size = column_size * pooling_width;
+
+  const uint32_t primary_tile = is_pixelwise ? xnn_params.f32.pavgpool.primary_tile : xnn_params.f32.avgpool.primary_tile;
+  const uint32_t incremental_tile =
+    is_pixelwise ? xnn_params.f32.pavgpool.incremental_tile : xnn_params.f32.avgpool.incremental_tile;
+
+  const size_t step_width = min(average_pooling_op->stride_width, pooling_width);
+  const size_t step_height = pooling_size + (output_width - 1) * step_width * column_size;
+
+  const bool input_size_changed =
+    input_depth != average_pooling_op->last_input_depth ||
+    input_height != average_pooling_op->last_input_height ||
+    input_width != average_pooling_op->last_input_width;
+  if (input_size_changed) {
+    // Micro-kernel may read up to (primary_tile - 1) elements after the end of indirection buffer.
+    const size_t indirection_buffer_size = sizeof(void*) * ((primary_tile - 1) + output_rows * step_height);
+
+    const void** indirection_buffer =
+      (const void**) xnn_reallocate_memory(average_pooling_op->indirection_buffer, indirection_buffer_size);
+    if (indirection_buffer == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for %s operator indirection buffer",
+        indirection_buffer_size, xnn_operator_type_to_string(average_pooling_op->type));
+      return xnn_status_out_of_memory;
+    }
+    average_pooling_op->indirection_buffer = indirection_buffer;
+
+    xnn_indirection_init_avgpool3d(average_pooling_op, step_height, step_width, 2 /* log2(sizeof(float)) */);
+
+    average_pooling_op->last_input = input;
+    average_pooling_op->last_input_depth = input_depth;
+    average_pooling_op->last_input_height = input_height;
+    average_pooling_op->last_input_width = input_width;
+  }
+
+  const size_t channels = average_pooling_op->channels;
+
+  const size_t indirect_input_height_stride = step_height * sizeof(void*);
+  const size_t output_width_stride = average_pooling_op->output_pixel_stride * sizeof(float);
+  const size_t output_height_stride = output_width * output_width_stride;
+  const size_t input_batch_stride =
+    input_depth * input_height * input_width * average_pooling_op->input_pixel_stride * sizeof(float);
+  const size_t multipass_adjustment =
+    pooling_size > primary_tile ? round_up(pooling_size - primary_tile, incremental_tile) + primary_tile - incremental_tile : 0;
+
+  if (is_pixelwise) {
+    if (input_size_changed) {
+      const size_t pixelwise_buffer_size = output_rows * output_width * sizeof(float);
+      float* pixelwise_buffer =
+        (float*) xnn_reallocate_memory(average_pooling_op->pixelwise_buffer, pixelwise_buffer_size);
+      if (pixelwise_buffer == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for %s operator pixelwise buffer",
+          pixelwise_buffer_size, xnn_operator_type_to_string(average_pooling_op->type));
+        return xnn_status_out_of_memory;
+      }
+      average_pooling_op->pixelwise_buffer = pixelwise_buffer;
+
+      float* pixelwise_pointer = pixelwise_buffer;
+      for (size_t output_z = 0; output_z < output_depth; output_z++) {
+        const size_t input_z_range = compute_valid_range(
+          output_z, average_pooling_op->stride_depth, average_pooling_op->kernel_depth,
+          average_pooling_op->padding_front, input_depth);
+        for (size_t output_y = 0; output_y < output_height; output_y++) {
+          const size_t input_y_range = compute_valid_range(
+            output_y, average_pooling_op->stride_height, average_pooling_op->kernel_height,
+            average_pooling_op->padding_top, input_height);
+          for (size_t output_x = 0; output_x < output_width; output_x++) {
+            const size_t input_x_range = compute_valid_range(
+              output_x, average_pooling_op->stride_width, average_pooling_op->kernel_width,
+              average_pooling_op->padding_left, input_width);
+            *pixelwise_pointer++ = 1.0f / ((float) (int32_t) (input_z_range * input_y_range * input_x_range));
+          }
+        }
+      }
+    }
+
+    average_pooling_op->context.pixelwise_average_pooling = (struct pixelwise_average_pooling_context) {
+      .indirect_input = average_pooling_op->indirection_buffer,
+      .indirect_input_height_stride = indirect_input_height_stride,
+      .input_batch_stride = input_batch_stride,
+      .input_offset = (size_t) ((uintptr_t) input - (uintptr_t) average_pooling_op->last_input),
+      .pixelwise_buffer = average_pooling_op->pixelwise_buffer,
+      .pixelwise_buffer_height_stride = output_width * sizeof(float),
+      .output = output,
+      .output_batch_stride = output_rows * output_height_stride,
+      .output_height_stride = output_height_stride,
+      .output_width = output_width,
+      .pooling_size = pooling_size,
+      .channels = channels,
+      .zero = average_pooling_op->zero_buffer,
+      .input_increment = (column_size * step_width - multipass_adjustment) * sizeof(void*),
+      .output_increment = output_width_stride - channels * sizeof(float),
+    };
+    memcpy(&average_pooling_op->context.pixelwise_average_pooling.params, &average_pooling_op->params.f32_minmax,
+      sizeof(average_pooling_op->params.f32_minmax));
+    if (pooling_size <= primary_tile) {
+      average_pooling_op->context.pixelwise_average_pooling.unipass_ukernel = xnn_params.f32.pavgpool.unipass;
+      average_pooling_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_pixelwise_average_pooling_unipass;
+    } else {
+      average_pooling_op->context.pixelwise_average_pooling.multipass_ukernel = xnn_params.f32.pavgpool.multipass;
+      average_pooling_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_pixelwise_average_pooling_multipass;
+    }
+  } else {
+    average_pooling_op->context.average_pooling = (struct average_pooling_context) {
+      .indirect_input = average_pooling_op->indirection_buffer,
+      .indirect_input_height_stride = indirect_input_height_stride,
+      .input_offset = (size_t) ((uintptr_t) input - (uintptr_t) average_pooling_op->last_input),
+      .input_batch_stride = input_batch_stride,
+      .output = output,
+      .output_batch_stride = output_rows * output_height_stride,
+      .output_height_stride = output_height_stride,
+      .output_width = output_width,
+      .pooling_size = pooling_size,
+      .channels = channels,
+      .zero = average_pooling_op->zero_buffer,
+      .input_increment = (column_size * step_width - multipass_adjustment) * sizeof(void*),
+      .output_increment = output_width_stride - channels * sizeof(float),
+    };
+    memcpy(&average_pooling_op->context.average_pooling.params, &average_pooling_op->params.f32_scaleminmax,
+      sizeof(average_pooling_op->params.f32_scaleminmax));
+    if (pooling_size <= primary_tile) {
+      average_pooling_op->context.average_pooling.unipass_ukernel = xnn_params.f32.avgpool.unipass;
+      average_pooling_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_average_pooling_unipass;
+    } else {
+      average_pooling_op->context.average_pooling.multipass_ukernel = xnn_params.f32.avgpool.multipass;
+      average_pooling_op->compute.task_2d = (pthreadpool_task_2d_t) xnn_compute_average_pooling_multipass;
+    }
+  }
+  average_pooling_op->compute.type = xnn_parallelization_type_2d;
+  average_pooling_op->compute.range[0] = batch_size;
+  average_pooling_op->compute.range[1] = output_rows;
+  average_pooling_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
@@ -40,6 +40,203 @@ static inline size_t compute_output_dimension_with_tf_same_padding(
   return divide_round_up(input_dimension, stride_dimension);
 }
 
+enum xnn_status xnn_create_average_pooling2d_nhwc_qs8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t pooling_height,
+    uint32_t pooling_width,
+    uint32_t stride_height,
+    uint32_t stride_width,
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* average_pooling_op_out)
+{
+  xnn_operator_t average_pooling_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  const uint32_t pooling_size = pooling_height * pooling_width;
+  if (pooling_size == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 " pooling size: "
+      "pooling size dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), pooling_width, pooling_height);
+    goto error;
+  }
+
+  if (pooling_size == 1) {
+    xnn_log_error(
+      "failed to create %s operator with 1 pooling element: 1x1 pooling is meaningless",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+
+  if (stride_height == 0 || stride_width == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 " stride: stride dimensions must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), stride_width, stride_height);
+    goto error;
+  }
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), channels);
+    goto error;
+  }
+
+  if (input_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), input_pixel_stride, channels);
+    goto error;
+  }
+
+  if (output_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), output_pixel_stride, channels);
+    goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), input_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8), output_min, output_max);
+    goto error;
+  }
+
+  const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
+  if ((flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0) {
+    if (any_padding) {
+      xnn_log_error(
+        "failed to create %s operator with %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" padding: "
+        "TensorFlow SAME padding can't be combined with explicit padding specification",
+        xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+        input_padding_top, input_padding_left, input_padding_bottom, input_padding_right);
+      goto error;
+    }
+  }
+
+  status = xnn_status_unsupported_parameter;
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-8f || input_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale and %.7g output scale: "
+      "input-to-output scale ratio (%.7f) must be in [2**-8, 2**8) range",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+      input_scale, output_scale, input_output_scale);
+    goto error;
+  }
+
+  if (pooling_size >= 16777216) {
+    xnn_log_error(
+      "failed to create %s operator with %"PRIu32" (%" PRIu32 "x%" PRIu32 ") pooling elements: "
+      "the number of elements in the pooling area must be below 2**24",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+      pooling_size, pooling_width, pooling_height);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  average_pooling_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (average_pooling_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+
+  const size_t zero_bytes = channels * sizeof(int8_t) + XNN_EXTRA_BYTES;
+  void* zero_buffer = xnn_allocate_simd_memory(zero_bytes);
+  if (zero_buffer == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator zero padding",
+      zero_bytes, xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8));
+    goto error;
+  }
+  memset(zero_buffer, input_zero_point, channels * sizeof(int8_t));
+  average_pooling_op->zero_buffer = zero_buffer;
+
+  average_pooling_op->padding_top = input_padding_top;
+  average_pooling_op->padding_right = input_padding_right;
+  average_pooling_op->padding_bottom = input_padding_bottom;
+  average_pooling_op->padding_left = input_padding_left;
+
+  average_pooling_op->kernel_height = pooling_height;
+  average_pooling_op->kernel_width = pooling_width;
+  average_pooling_op->stride_height = stride_height;
+  average_pooling_op->stride_width = stride_width;
+  average_pooling_op->dilation_height = 1;
+  average_pooling_op->dilation_width = 1;
+  average_pooling_op->channels = channels;
+  average_pooling_op->input_pixel_stride = input_pixel_stride;
+  average_pooling_op->output_pixel_stride = output_pixel_stride;
+
+  average_pooling_op->input_zero_point = (int32_t) input_zero_point;
+  average_pooling_op->output_zero_point = output_zero_point;
+  average_pooling_op->input_scale = input_scale;
+  average_pooling_op->output_scale = output_scale;
+  average_pooling_op->output_min = output_min;
+  average_pooling_op->output_max = output_max;
+
+  // Number of rows read in the AVGPOOL micro-kernel.
+  const size_t avgpool_nrows =
+    round_up(doz(pooling_size, xnn_params.qs8.avgpool.primary_tile), xnn_params.qs8.avgpool.incremental_tile) + xnn_params.qs8.avgpool.primary_tile;
+  const float requantization_scale = input_scale / (output_scale * (float) pooling_size);
+  xnn_params.qs8.avgpool.init.qs8(&average_pooling_op->params.qs8_avgpool,
+    -((int32_t) input_zero_point * (int32_t) avgpool_nrows),
+    requantization_scale, output_zero_point, output_min, output_max);
+  xnn_params.qs8.gavgpool.init.qs8(&average_pooling_op->params.qs8_gavgpool,
+    0 /* bias */, requantization_scale, output_zero_point, output_min, output_max);
+
+  average_pooling_op->type = xnn_operator_type_average_pooling_nhwc_qs8;
+  average_pooling_op->ukernel.type = xnn_ukernel_type_average_pooling;
+  average_pooling_op->flags = flags;
+
+  *average_pooling_op_out = average_pooling_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(average_pooling_op);
+  return status;
+}
+
 enum xnn_status xnn_create_average_pooling2d_nhwc_qu8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -637,6 +834,50 @@ static enum xnn_status setup_average_pooling2d(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_setup_average_pooling2d_nhwc_qs8(
+    xnn_operator_t average_pooling_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (average_pooling_op->type != xnn_operator_type_average_pooling_nhwc_qs8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_average_pooling_nhwc_qs8),
+      xnn_operator_type_to_string(average_pooling_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  assert(average_pooling_op->ukernel.type == xnn_ukernel_type_average_pooling);
+
+  // Number of rows read in the GAVGPOOL micro-kernel.
+  const size_t input_size = input_height * input_width;
+  const size_t pooling_size = average_pooling_op->kernel_height * average_pooling_op->kernel_width;
+  const size_t gavgpool_nrows = round_up(input_size, xnn_params.qs8.gavgpool.row_tile);
+  xnn_params.qs8.gavgpool.update.qs8(
+    &average_pooling_op->params.qs8_gavgpool,
+    -(average_pooling_op->input_zero_point * (int32_t) gavgpool_nrows),
+    average_pooling_op->input_scale / (average_pooling_op->output_scale * (float) pooling_size));
+
+  return setup_average_pooling2d(
+    average_pooling_op,
+    batch_size, input_height, input_width,
+    input, output,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    &xnn_params.qs8.avgpool,
+    NULL /* no PAVGPOOL micro-kernel */,
+    &xnn_params.qs8.gavgpool,
+    &average_pooling_op->params.qs8_avgpool,
+    sizeof(average_pooling_op->params.qs8_avgpool),
+    &average_pooling_op->params.qs8_gavgpool,
+    sizeof(average_pooling_op->params.qs8_gavgpool),
+    pthreadpool_get_threads_count(threadpool),
+    false /* pixelwise not supported */);
+}
+
 enum xnn_status xnn_setup_average_pooling2d_nhwc_qu8(
     xnn_operator_t average_pooling_op,
     size_t batch_size,
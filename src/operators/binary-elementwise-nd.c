@@ -166,6 +166,72 @@ static enum xnn_status create_binary_elementwise_nd_f32(
     binary_elementwise_op_out);
 }
 
+static enum xnn_status create_binary_elementwise_nd_qs8(
+    int8_t input1_zero_point,
+    float input1_scale,
+    int8_t input2_zero_point,
+    float input2_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    const struct vbinary_parameters vbinary[restrict XNN_MIN_ELEMENTS(1)],
+    xnn_operator_t* binary_elementwise_op_out)
+{
+  if (input1_scale <= 0.0f || !isnormal(input1_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input 1 scale: scale must be finite and positive",
+      xnn_operator_type_to_string(operator_type), input1_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input2_scale <= 0.0f || !isnormal(input2_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input 2 scale: scale must be finite and positive",
+      xnn_operator_type_to_string(operator_type), input2_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite and positive",
+      xnn_operator_type_to_string(operator_type), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(operator_type), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  // The microkernels compute in FP32 on dequantized inputs, so the scales need no range checks beyond validity.
+  // Parameters are sensitive to the order of inputs, so we initialize an extra copy with the reversed order.
+  struct {
+    union xnn_qs8_binary_minmax_params qs8_binary;
+    union xnn_qs8_binary_minmax_params qs8_rbinary;
+  } params;
+  if (vbinary->init.qs8_binary != NULL) {
+    vbinary->init.qs8_binary(
+      &params.qs8_binary, input1_zero_point, input2_zero_point, output_zero_point,
+      input1_scale, input2_scale, output_scale, output_min, output_max);
+    vbinary->init.qs8_binary(
+      &params.qs8_rbinary, input2_zero_point, input1_zero_point, output_zero_point,
+      input2_scale, input1_scale, output_scale, output_min, output_max);
+  }
+  return create_binary_elementwise_nd(
+    flags,
+    &params,
+    sizeof(params),
+    XNN_INIT_FLAG_QS8,
+    operator_type,
+    &vbinary->minmax,
+    binary_elementwise_op_out);
+}
+
 enum xnn_status xnn_create_add_nd_qs8(
     int8_t input1_zero_point,
     float input1_scale,
@@ -367,6 +433,29 @@ enum xnn_status xnn_create_divide_nd_f32(
     divide_op_out);
 }
 
+enum xnn_status xnn_create_divide_nd_qs8(
+    int8_t input1_zero_point,
+    float input1_scale,
+    int8_t input2_zero_point,
+    float input2_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* divide_op_out)
+{
+  return create_binary_elementwise_nd_qs8(
+    input1_zero_point, input1_scale,
+    input2_zero_point, input2_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    flags,
+    xnn_operator_type_divide_nd_qs8,
+    &xnn_params.qs8.vdiv,
+    divide_op_out);
+}
+
 enum xnn_status xnn_create_maximum_nd_f32(
     uint32_t flags,
     xnn_operator_t* maximum_op_out)
@@ -385,6 +474,29 @@ enum xnn_status xnn_create_maximum_nd_f32(
     maximum_op_out);
 }
 
+enum xnn_status xnn_create_maximum_nd_qs8(
+    int8_t input1_zero_point,
+    float input1_scale,
+    int8_t input2_zero_point,
+    float input2_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* maximum_op_out)
+{
+  return create_binary_elementwise_nd_qs8(
+    input1_zero_point, input1_scale,
+    input2_zero_point, input2_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    flags,
+    xnn_operator_type_maximum_nd_qs8,
+    &xnn_params.qs8.vmax,
+    maximum_op_out);
+}
+
 enum xnn_status xnn_create_minimum_nd_f32(
     uint32_t flags,
     xnn_operator_t* minimum_op_out)
@@ -403,6 +515,29 @@ enum xnn_status xnn_create_minimum_nd_f32(
     minimum_op_out);
 }
 
+enum xnn_status xnn_create_minimum_nd_qs8(
+    int8_t input1_zero_point,
+    float input1_scale,
+    int8_t input2_zero_point,
+    float input2_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* minimum_op_out)
+{
+  return create_binary_elementwise_nd_qs8(
+    input1_zero_point, input1_scale,
+    input2_zero_point, input2_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    flags,
+    xnn_operator_type_minimum_nd_qs8,
+    &xnn_params.qs8.vmin,
+    minimum_op_out);
+}
+
 enum xnn_status xnn_create_multiply_nd_qs8(
     int8_t input1_zero_point,
     float input1_scale,
@@ -593,6 +728,29 @@ enum xnn_status xnn_create_squared_difference_nd_f32(
     squared_difference_op_out);
 }
 
+enum xnn_status xnn_create_squared_difference_nd_qs8(
+    int8_t input1_zero_point,
+    float input1_scale,
+    int8_t input2_zero_point,
+    float input2_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* squared_difference_op_out)
+{
+  return create_binary_elementwise_nd_qs8(
+    input1_zero_point, input1_scale,
+    input2_zero_point, input2_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    flags,
+    xnn_operator_type_squared_difference_nd_qs8,
+    &xnn_params.qs8.vsqrdiff,
+    squared_difference_op_out);
+}
+
 enum xnn_status xnn_create_subtract_nd_qs8(
     int8_t input1_zero_point,
     float input1_scale,
@@ -1119,6 +1277,30 @@ enum xnn_status xnn_setup_divide_nd_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_divide_nd_qs8(
+    xnn_operator_t divide_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const int8_t* input1,
+    const int8_t* input2,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd(
+    divide_op, xnn_operator_type_divide_nd_qs8,
+    num_input1_dims, input1_shape,
+    num_input2_dims, input2_shape,
+    input1, input2, output,
+    XNN_INIT_FLAG_QS8,
+    0 /* log2(sizeof(int8_t))) */,
+    &divide_op->params.qs8_binary, sizeof(divide_op->params.qs8_binary),
+    &divide_op->params.qs8_rbinary, sizeof(divide_op->params.qs8_rbinary),
+    &xnn_params.qs8.vdiv,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_maximum_nd_f32(
     xnn_operator_t maximum_op,
     size_t num_input1_dims,
@@ -1139,6 +1321,30 @@ enum xnn_status xnn_setup_maximum_nd_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_maximum_nd_qs8(
+    xnn_operator_t maximum_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const int8_t* input1,
+    const int8_t* input2,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd(
+    maximum_op, xnn_operator_type_maximum_nd_qs8,
+    num_input1_dims, input1_shape,
+    num_input2_dims, input2_shape,
+    input1, input2, output,
+    XNN_INIT_FLAG_QS8,
+    0 /* log2(sizeof(int8_t))) */,
+    &maximum_op->params.qs8_binary, sizeof(maximum_op->params.qs8_binary),
+    &maximum_op->params.qs8_rbinary, sizeof(maximum_op->params.qs8_rbinary),
+    &xnn_params.qs8.vmax,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_minimum_nd_f32(
     xnn_operator_t minimum_op,
     size_t num_input1_dims,
@@ -1159,6 +1365,30 @@ enum xnn_status xnn_setup_minimum_nd_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_minimum_nd_qs8(
+    xnn_operator_t minimum_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const int8_t* input1,
+    const int8_t* input2,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd(
+    minimum_op, xnn_operator_type_minimum_nd_qs8,
+    num_input1_dims, input1_shape,
+    num_input2_dims, input2_shape,
+    input1, input2, output,
+    XNN_INIT_FLAG_QS8,
+    0 /* log2(sizeof(int8_t))) */,
+    &minimum_op->params.qs8_binary, sizeof(minimum_op->params.qs8_binary),
+    &minimum_op->params.qs8_rbinary, sizeof(minimum_op->params.qs8_rbinary),
+    &xnn_params.qs8.vmin,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_multiply_nd_qs8(
     xnn_operator_t multiply_op,
     size_t num_input1_dims,
@@ -1267,6 +1497,30 @@ enum xnn_status xnn_setup_squared_difference_nd_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_squared_difference_nd_qs8(
+    xnn_operator_t squared_difference_op,
+    size_t num_input1_dims,
+    const size_t* input1_shape,
+    size_t num_input2_dims,
+    const size_t* input2_shape,
+    const int8_t* input1,
+    const int8_t* input2,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_binary_elementwise_nd(
+    squared_difference_op, xnn_operator_type_squared_difference_nd_qs8,
+    num_input1_dims, input1_shape,
+    num_input2_dims, input2_shape,
+    input1, input2, output,
+    XNN_INIT_FLAG_QS8,
+    0 /* log2(sizeof(int8_t))) */,
+    &squared_difference_op->params.qs8_binary, sizeof(squared_difference_op->params.qs8_binary),
+    &squared_difference_op->params.qs8_rbinary, sizeof(squared_difference_op->params.qs8_rbinary),
+    &xnn_params.qs8.vsqrdiff,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_subtract_nd_qs8(
     xnn_operator_t subtract_op,
     size_t num_input1_dims,
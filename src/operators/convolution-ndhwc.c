@@ -0,0 +1,1022 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/cache.h>
+#include <xnnpack/common.h>
+#include <xnnpack/compute.h>
+#include <xnnpack/indirection.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/pack.h>
+#include <xnnpack/params.h>
+#include <xnnpack/params-init.h>
+
+
+static inline size_t compute_output_dimension(
+    size_t padded_input_dimension,
+    size_t kernel_dimension,
+    size_t dilation_dimension,
+    size_t subsampling_dimension)
+{
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  return doz(padded_input_dimension, effective_kernel_dimension) / subsampling_dimension + 1;
+}
+
+static inline size_t compute_output_dimension_with_tf_same_padding(
+    size_t input_dimension,
+    size_t subsampling_dimension)
+{
+  return divide_round_up(input_dimension, subsampling_dimension);
+}
+
+// 3D Convolution reuses the GEMM and IGEMM micro-kernels of the 2D Convolution: pointwise convolutions without padding
+// and subsampling map directly to GEMM, and all other convolutions use IGEMM over a 3D indirection buffer with
+// kernel_depth * kernel_height * kernel_width pointers per output pixel.
+static enum xnn_status create_convolution3d_ndhwc(
+    uint32_t input_padding_front,
+    uint32_t input_padding_back,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_depth,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_depth,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_depth,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const void* kernel,
+    const void* bias,
+    uint32_t flags,
+    uint32_t log2_input_element_size,
+    uint32_t log2_filter_element_size,
+    uint32_t bias_element_size,
+    xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
+    xnn_pack_conv_goki_w_function pack_conv_goki_w,
+    const void* packing_params,
+    int input_padding_byte,
+    int packed_weights_padding_byte,
+    const void* gemm_params,
+    size_t gemm_params_size,
+    const struct gemm_parameters* gemm_parameters,
+    bool linear_activation,
+    bool relu_activation,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_caches_t caches,
+    xnn_operator_t* convolution_op_out)
+{
+  xnn_operator_t convolution_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error(
+      "failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error(
+      "failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (kernel_depth == 0 || kernel_height == 0 || kernel_width == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 "x%" PRIu32 " kernel: kernel dimensions must be non-zero",
+      xnn_operator_type_to_string(operator_type), kernel_width, kernel_height, kernel_depth);
+    goto error;
+  }
+
+  if (subsampling_depth == 0 || subsampling_height == 0 || subsampling_width == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 "x%" PRIu32 " subsampling: "
+      "subsampling dimensions must be non-zero",
+      xnn_operator_type_to_string(operator_type), subsampling_width, subsampling_height, subsampling_depth);
+    goto error;
+  }
+
+  if (dilation_depth == 0 || dilation_height == 0 || dilation_width == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 "x%" PRIu32 "x%" PRIu32 " dilation: "
+      "dilation dimensions must be non-zero",
+      xnn_operator_type_to_string(operator_type), dilation_width, dilation_height, dilation_depth);
+    goto error;
+  }
+
+  if (groups == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu32 " groups: number of groups must be non-zero",
+      xnn_operator_type_to_string(operator_type), groups);
+    goto error;
+  }
+
+  if (group_input_channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu input channels per group: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), group_input_channels);
+    goto error;
+  }
+
+  if (group_output_channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu output channels per group: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), group_output_channels);
+    goto error;
+  }
+
+  const size_t input_channels = groups * group_input_channels;
+  if (input_channel_stride < input_channels) {
+    xnn_log_error(
+      "failed to create %s operator with input channel stride of %zu: "
+      "stride must be at least as large as the number of input channels (%" PRIu32 "x%zu)",
+      xnn_operator_type_to_string(operator_type),
+      input_channel_stride, groups, group_input_channels);
+    goto error;
+  }
+
+  const size_t output_channels = groups * group_output_channels;
+  if (output_channel_stride < output_channels) {
+    xnn_log_error(
+      "failed to create %s operator with output channel stride of %zu: "
+      "stride must be at least as large as the number of output channels (%" PRIu32 "x%zu)",
+      xnn_operator_type_to_string(operator_type),
+      output_channel_stride, groups, group_output_channels);
+    goto error;
+  }
+
+  const bool any_padding = (input_padding_front | input_padding_back | input_padding_left | input_padding_top |
+    input_padding_right | input_padding_bottom) != 0;
+  if ((flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0) {
+    if (any_padding) {
+      xnn_log_error(
+        "failed to create %s operator with %" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32 "x%" PRIu32 "+%" PRIu32" "
+        "padding: TensorFlow SAME padding can't be combined with explicit padding specification",
+        xnn_operator_type_to_string(operator_type),
+        input_padding_front, input_padding_top, input_padding_left,
+        input_padding_back, input_padding_bottom, input_padding_right);
+      goto error;
+    }
+  }
+
+  status = xnn_status_out_of_memory;
+
+  convolution_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (convolution_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  if (caches != NULL) {
+    convolution_op->weights_cache = caches->weights_cache;
+  }
+
+  const size_t kernel_size = kernel_depth * kernel_height * kernel_width;
+
+  const bool unit_subsampling = (subsampling_depth | subsampling_height | subsampling_width) == 1;
+  const enum xnn_ukernel_type ukernel_type = kernel_size == 1 && unit_subsampling && !any_padding ?
+    xnn_ukernel_type_gemm : xnn_ukernel_type_igemm;
+
+  const uint32_t nr = gemm_parameters->nr;
+  const uint32_t kr = UINT32_C(1) << gemm_parameters->log2_kr;
+  const uint32_t sr = UINT32_C(1) << gemm_parameters->log2_sr;
+  const size_t n_stride = round_up(group_output_channels, nr);
+  const size_t k_stride = round_up_po2(group_input_channels, kr * sr);
+
+  const size_t packed_group_weights_size = ((kernel_size * k_stride << log2_filter_element_size) + bias_element_size) * n_stride;
+  const size_t aligned_total_weights_size = round_up_po2(packed_group_weights_size * groups, XNN_ALLOCATION_ALIGNMENT);
+  void* weights_ptr = xnn_get_pointer_to_write_weights(
+    convolution_op, caches, aligned_total_weights_size, packed_weights_padding_byte);
+  if (weights_ptr == NULL) {
+    xnn_log_error("failed to reserve or allocated %zu bytes for %s operator gemm packed weights",
+                  aligned_total_weights_size, xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+  memcpy(&convolution_op->params, gemm_params, gemm_params_size);
+
+  const struct gemm_fused_ukernels* gemm_ukernels = &gemm_parameters->minmax;
+  if (linear_activation && gemm_parameters->linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernels = &gemm_parameters->linear;
+  } else if (relu_activation && gemm_parameters->relu.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernels = &gemm_parameters->relu;
+  }
+  switch (ukernel_type) {
+    case xnn_ukernel_type_gemm:
+      pack_gemm_goi_w(
+        groups, group_output_channels, group_input_channels,
+        nr, kr, sr,
+        kernel, bias, weights_ptr, 0 /* extra bytes */, packing_params);
+      convolution_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
+        .mr = gemm_parameters->mr,
+        .nr = nr,
+        .kr = kr,
+        .sr = sr,
+        .general_case = gemm_ukernels->gemm,
+        .mr1_case = gemm_ukernels->gemm1,
+      };
+      break;
+    case xnn_ukernel_type_igemm:
+      // The [kernel_depth, kernel_height, kernel_width] dimensions of the filter are packed as a single kernel
+      // dimension, same as the [kernel_height, kernel_width] dimensions of a 2D Convolution filter.
+      pack_conv_goki_w(
+        groups, group_output_channels, kernel_size, group_input_channels,
+        nr, kr, sr,
+        kernel, bias, weights_ptr, 0 /* extra bytes */, packing_params);
+      convolution_op->ukernel.igemm = (struct xnn_ukernel_igemm) {
+        .mr = gemm_parameters->mr,
+        .nr = nr,
+        .kr = kr,
+        .sr = sr,
+        .general_case = gemm_ukernels->igemm,
+        .mr1_case = gemm_ukernels->igemm1,
+      };
+      break;
+    default:
+      XNN_UNREACHABLE;
+  }
+
+  if (use_weights_cache(caches)) {
+    convolution_op->packed_weights.offset = xnn_get_or_insert_weights_cache(
+        caches->weights_cache, weights_ptr, aligned_total_weights_size);
+  }
+
+  const bool tf_same_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0 && kernel_size != 1;
+  if (any_padding || tf_same_padding) {
+    const size_t zero_size = XNN_EXTRA_BYTES + (k_stride << log2_input_element_size);
+    convolution_op->zero_buffer = xnn_allocate_simd_memory(zero_size);
+    if (convolution_op->zero_buffer == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator zero padding",
+        zero_size, xnn_operator_type_to_string(operator_type));
+      goto error;
+    }
+    memset(convolution_op->zero_buffer, input_padding_byte, zero_size);
+  }
+
+  convolution_op->padding_front = input_padding_front;
+  convolution_op->padding_back = input_padding_back;
+  convolution_op->padding_top = input_padding_top;
+  convolution_op->padding_right = input_padding_right;
+  convolution_op->padding_bottom = input_padding_bottom;
+  convolution_op->padding_left = input_padding_left;
+
+  convolution_op->kernel_depth = kernel_depth;
+  convolution_op->kernel_height = kernel_height;
+  convolution_op->kernel_width = kernel_width;
+  convolution_op->stride_depth = subsampling_depth;
+  convolution_op->stride_height = subsampling_height;
+  convolution_op->stride_width = subsampling_width;
+  convolution_op->dilation_depth = dilation_depth;
+  convolution_op->dilation_height = dilation_height;
+  convolution_op->dilation_width = dilation_width;
+  convolution_op->groups = groups;
+  convolution_op->group_input_channels = group_input_channels;
+  convolution_op->group_output_channels = group_output_channels;
+  convolution_op->input_pixel_stride = input_channel_stride;
+  convolution_op->output_pixel_stride = output_channel_stride;
+
+  convolution_op->type = operator_type;
+  convolution_op->ukernel.type = ukernel_type;
+  convolution_op->flags = flags & ~XNN_FLAG_TENSORFLOW_SAME_PADDING;
+  if (tf_same_padding) {
+    convolution_op->flags |= XNN_FLAG_TENSORFLOW_SAME_PADDING;
+  }
+
+  convolution_op->state = xnn_run_state_invalid;
+
+  *convolution_op_out = convolution_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(convolution_op);
+  return status;
+}
+
+enum xnn_status xnn_create_convolution3d_ndhwc_qs8(
+    uint32_t input_padding_front,
+    uint32_t input_padding_back,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_depth,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_depth,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_depth,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* convolution_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_qs8), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (kernel_scale <= 0.0f || !isnormal(kernel_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g kernel scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_qs8), kernel_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_qs8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_qs8), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const float requantization_scale = input_scale * kernel_scale / output_scale;
+  if (requantization_scale >= 256.0f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale, %.7g kernel scale, and %.7g output scale: "
+      "requantization scale %.7g is greater or equal to 256.0",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_qs8),
+      input_scale, kernel_scale, output_scale, requantization_scale);
+    return xnn_status_unsupported_parameter;
+  }
+
+  const struct xnn_qs8_packing_params packing_params = { .input_zero_point = input_zero_point, };
+
+  union xnn_qs8_conv_minmax_params gemm_params;
+  if XNN_LIKELY(xnn_params.qs8.gemm.init.qs8 != NULL) {
+    xnn_params.qs8.gemm.init.qs8(&gemm_params,
+      requantization_scale, output_zero_point, output_min, output_max);
+  }
+
+  return create_convolution3d_ndhwc(
+    input_padding_front, input_padding_back,
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_depth, kernel_height, kernel_width,
+    subsampling_depth, subsampling_height, subsampling_width,
+    dilation_depth, dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias, flags,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(bias element) */,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
+    (xnn_pack_conv_goki_w_function) xnn_pack_qs8_conv_goki_w,
+    &packing_params, input_zero_point /* input padding byte */, 0 /* packed weights padding byte */,
+    &gemm_params, sizeof(gemm_params),
+    &xnn_params.qs8.gemm,
+    false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QS8,
+    xnn_operator_type_convolution_ndhwc_qs8,
+    caches,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution3d_ndhwc_f16(
+    uint32_t input_padding_front,
+    uint32_t input_padding_back,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_depth,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_depth,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_depth,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* convolution_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f16));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f16));
+    return xnn_status_invalid_parameter;
+  }
+
+  const uint16_t fp16_output_min = fp16_ieee_from_fp32_value(output_min);
+  const uint16_t fp16_output_max = fp16_ieee_from_fp32_value(output_max);
+  const float rounded_output_min = fp16_ieee_to_fp32_value(fp16_output_min);
+  const float rounded_output_max = fp16_ieee_to_fp32_value(fp16_output_max);
+  if (rounded_output_min >= rounded_output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f16), rounded_output_min, rounded_output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_f16_minmax_params gemm_params;
+  if XNN_LIKELY(xnn_params.f16.gemm.init.f16 != NULL) {
+    xnn_params.f16.gemm.init.f16(&gemm_params,
+      fp16_output_min, fp16_output_max);
+  }
+
+  xnn_pack_gemm_goi_w_function pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_f16_gemm_goi_w;
+  xnn_pack_conv_goki_w_function pack_conv_goki_w = (xnn_pack_conv_goki_w_function) xnn_pack_f16_conv_goki_w;
+  if (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) {
+    pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_f32_to_f16_gemm_goi_w;
+    pack_conv_goki_w = (xnn_pack_conv_goki_w_function) xnn_pack_f32_to_f16_conv_goki_w;
+  }
+
+  return create_convolution3d_ndhwc(
+    input_padding_front, input_padding_back,
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_depth, kernel_height, kernel_width,
+    subsampling_depth, subsampling_height, subsampling_width,
+    dilation_depth, dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias, flags,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
+    sizeof(uint16_t) /* sizeof(bias element) */,
+    pack_gemm_goi_w,
+    pack_conv_goki_w,
+    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    &gemm_params, sizeof(gemm_params),
+    &xnn_params.f16.gemm,
+    false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_F16,
+    xnn_operator_type_convolution_ndhwc_f16,
+    caches,
+    convolution_op_out);
+}
+
+enum xnn_status xnn_create_convolution3d_ndhwc_f32(
+    uint32_t input_padding_front,
+    uint32_t input_padding_back,
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_depth,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_depth,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_depth,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* convolution_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f32));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f32));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f32), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const bool linear_activation = (output_max == INFINITY) && (output_min == -output_max);
+  const bool relu_activation = (output_max == INFINITY) && (output_min == 0.0f);
+
+  union xnn_f32_minmax_params gemm_params;
+  if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
+    xnn_params.f32.gemm.init.f32(&gemm_params, output_min, output_max);
+  }
+
+  return create_convolution3d_ndhwc(
+    input_padding_front, input_padding_back,
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_depth, kernel_height, kernel_width,
+    subsampling_depth, subsampling_height, subsampling_width,
+    dilation_depth, dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias, flags,
+    2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+    2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
+    sizeof(float) /* sizeof(bias element) */,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
+    (xnn_pack_conv_goki_w_function) xnn_pack_f32_conv_goki_w,
+    NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+    &gemm_params, sizeof(gemm_params),
+    &xnn_params.f32.gemm,
+    linear_activation, relu_activation, XNN_INIT_FLAG_F32,
+    xnn_operator_type_convolution_ndhwc_f32,
+    caches,
+    convolution_op_out);
+}
+
+static void compute_tf_same_padding(
+    size_t input_dimension,
+    uint32_t kernel_dimension,
+    uint32_t dilation_dimension,
+    uint32_t subsampling_dimension,
+    size_t* output_dimension,
+    uint32_t* padding_before,
+    uint32_t* padding_after)
+{
+  *output_dimension = compute_output_dimension_with_tf_same_padding(input_dimension, subsampling_dimension);
+  const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+  const size_t total_padding =
+    doz((*output_dimension - 1) * subsampling_dimension + effective_kernel_dimension, input_dimension);
+  *padding_before = total_padding / 2;
+  *padding_after = total_padding - *padding_before;
+}
+
+static enum xnn_status setup_convolution3d_ndhwc(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_depth,
+  size_t input_height,
+  size_t input_width,
+  const void* input,
+  void* output,
+  uint32_t datatype_init_flags,
+  uint32_t log2_input_element_size,
+  uint32_t log2_filter_element_size,
+  uint32_t extra_weights_elements_size,
+  uint32_t log2_output_element_size,
+  size_t num_threads)
+{
+  convolution_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error(
+      "failed to setup %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_unsupported_hardware;
+  }
+
+  if (input_depth == 0 || input_height == 0 || input_width == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zux%zu input: input dimensions must be non-zero",
+      xnn_operator_type_to_string(convolution_op->type), input_width, input_height, input_depth);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    convolution_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  convolution_op->batch_size = batch_size;
+  convolution_op->input_depth = input_depth;
+  convolution_op->input_height = input_height;
+  convolution_op->input_width = input_width;
+  convolution_op->input = input;
+
+  if (convolution_op->flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) {
+    compute_tf_same_padding(
+      input_depth, convolution_op->kernel_depth, convolution_op->dilation_depth, convolution_op->stride_depth,
+      &convolution_op->output_depth, &convolution_op->padding_front, &convolution_op->padding_back);
+    compute_tf_same_padding(
+      input_height, convolution_op->kernel_height, convolution_op->dilation_height, convolution_op->stride_height,
+      &convolution_op->output_height, &convolution_op->padding_top, &convolution_op->padding_bottom);
+    compute_tf_same_padding(
+      input_width, convolution_op->kernel_width, convolution_op->dilation_width, convolution_op->stride_width,
+      &convolution_op->output_width, &convolution_op->padding_left, &convolution_op->padding_right);
+  } else {
+    convolution_op->output_depth = compute_output_dimension(
+        convolution_op->padding_front + input_depth + convolution_op->padding_back,
+        convolution_op->kernel_depth,
+        convolution_op->dilation_depth,
+        convolution_op->stride_depth);
+    convolution_op->output_height = compute_output_dimension(
+        convolution_op->padding_top + input_height + convolution_op->padding_bottom,
+        convolution_op->kernel_height,
+        convolution_op->dilation_height,
+        convolution_op->stride_height);
+    convolution_op->output_width = compute_output_dimension(
+        convolution_op->padding_left + input_width + convolution_op->padding_right,
+        convolution_op->kernel_width,
+        convolution_op->dilation_width,
+        convolution_op->stride_width);
+  }
+  convolution_op->output = output;
+
+  const size_t output_size = convolution_op->output_depth * convolution_op->output_height * convolution_op->output_width;
+  const size_t groups = convolution_op->groups;
+  const size_t group_input_channels = convolution_op->group_input_channels;
+  const size_t group_output_channels = convolution_op->group_output_channels;
+
+  switch (convolution_op->ukernel.type) {
+    case xnn_ukernel_type_gemm:
+    {
+      // Convolution maps directly to GEMM and doesn't use indirection buffer.
+      const size_t batch_output_size = batch_size * output_size;
+
+      const size_t w_stride = extra_weights_elements_size +
+        (round_up_po2(group_input_channels, convolution_op->ukernel.gemm.kr * convolution_op->ukernel.gemm.sr) << log2_filter_element_size);
+
+      uint32_t mr = convolution_op->ukernel.gemm.mr;
+      const uint32_t nr = convolution_op->ukernel.gemm.nr;
+      struct xnn_hmp_gemm_ukernel gemm_ukernel = convolution_op->ukernel.gemm.general_case;
+      if (batch_output_size == 1 && convolution_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
+        mr = 1;
+        gemm_ukernel = convolution_op->ukernel.gemm.mr1_case;
+      }
+
+      convolution_op->context.gemm = (struct gemm_context) {
+          .k_scaled = group_input_channels << log2_input_element_size,
+          .a = input,
+          .a_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+          .packed_w = packed_weights(convolution_op),
+          .w_stride = w_stride,
+          .wg_stride = w_stride * round_up(group_output_channels, nr),
+          .c = output,
+          .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+          .cn_stride = nr << log2_output_element_size,
+          .cg_stride = group_output_channels << log2_output_element_size,
+          .log2_csize = log2_output_element_size,
+          .ukernel = gemm_ukernel,
+      };
+      memcpy(&convolution_op->context.gemm.params, &convolution_op->params, sizeof(convolution_op->context.gemm.params));
+
+      size_t nc = group_output_channels;
+      if (num_threads > 1) {
+        const size_t num_other_tiles = groups * divide_round_up(batch_output_size, mr);
+        const size_t target_tiles_per_thread = 5;
+        const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+        if (max_nc < nc) {
+          nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+        }
+      }
+      if (groups == 1) {
+        #if XNN_MAX_UARCH_TYPES > 1
+          if (xnn_is_hmp_gemm_ukernel(gemm_ukernel)) {
+            convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d_with_uarch;
+            convolution_op->compute.task_2d_tile_2d_with_id = (pthreadpool_task_2d_tile_2d_with_id_t) xnn_compute_hmp_gemm;
+          } else {
+            convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+            convolution_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
+          }
+        #else
+          convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+          convolution_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_gemm;
+        #endif
+        convolution_op->compute.range[0] = batch_output_size;
+        convolution_op->compute.range[1] = group_output_channels;
+        convolution_op->compute.tile[0] = mr;
+        convolution_op->compute.tile[1] = nc;
+      } else {
+        #if XNN_MAX_UARCH_TYPES > 1
+          if (xnn_is_hmp_gemm_ukernel(gemm_ukernel)) {
+            convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d_with_uarch;
+            convolution_op->compute.task_3d_tile_2d_with_id = (pthreadpool_task_3d_tile_2d_with_id_t) xnn_compute_hmp_grouped_gemm;
+          } else {
+            convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+            convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_grouped_gemm;
+          }
+        #else
+          convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+          convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_grouped_gemm;
+        #endif
+        convolution_op->compute.range[0] = groups;
+        convolution_op->compute.range[1] = batch_output_size;
+        convolution_op->compute.range[2] = group_output_channels;
+        convolution_op->compute.tile[0] = mr;
+        convolution_op->compute.tile[1] = nc;
+      }
+      convolution_op->state = xnn_run_state_ready;
+
+      return xnn_status_success;
+    }
+    case xnn_ukernel_type_igemm:
+    {
+      const size_t kernel_size = convolution_op->kernel_depth * convolution_op->kernel_height * convolution_op->kernel_width;
+
+      uint32_t mr = convolution_op->ukernel.igemm.mr;
+      const uint32_t nr = convolution_op->ukernel.igemm.nr;
+      struct xnn_hmp_igemm_ukernel igemm_ukernel = convolution_op->ukernel.igemm.general_case;
+      if (output_size == 1 && convolution_op->ukernel.igemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
+        mr = 1;
+        igemm_ukernel = convolution_op->ukernel.igemm.mr1_case;
+      }
+
+      const size_t tiled_output_size = round_up(output_size, mr);
+      const size_t indirection_buffer_size = sizeof(void*) * kernel_size * tiled_output_size;
+
+      if (input_depth != convolution_op->last_input_depth ||
+          input_height != convolution_op->last_input_height ||
+          input_width != convolution_op->last_input_width)
+      {
+        const void** indirection_buffer = (const void**) xnn_reallocate_memory((void*) convolution_op->indirection_buffer, indirection_buffer_size);
+        if (indirection_buffer == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator indirection buffer",
+            indirection_buffer_size, xnn_operator_type_to_string(convolution_op->type));
+          return xnn_status_out_of_memory;
+        }
+        convolution_op->indirection_buffer = indirection_buffer;
+        convolution_op->last_input = input;
+        convolution_op->last_input_depth = input_depth;
+        convolution_op->last_input_height = input_height;
+        convolution_op->last_input_width = input_width;
+
+        xnn_indirection_init_conv3d(convolution_op, mr, log2_input_element_size);
+      }
+
+      const size_t w_stride = extra_weights_elements_size +
+        (round_up_po2(group_input_channels, convolution_op->ukernel.igemm.kr * convolution_op->ukernel.igemm.sr) * kernel_size << log2_filter_element_size);
+      convolution_op->context.igemm = (struct igemm_context) {
+          .ks = kernel_size,
+          .ks_scaled = kernel_size * mr * sizeof(void*),
+          .kc = group_input_channels << log2_input_element_size,
+          .w_stride = w_stride,
+          .indirect_a = convolution_op->indirection_buffer,
+          .a_offset = (size_t) ((uintptr_t) input - (uintptr_t) convolution_op->last_input),
+          .zero = convolution_op->zero_buffer,
+          .packed_w = packed_weights(convolution_op),
+          .c = convolution_op->output,
+          .cm_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+          .cn_stride = nr << log2_output_element_size,
+          .ga_stride = group_input_channels << log2_input_element_size,
+          .gw_stride = w_stride * round_up(group_output_channels, nr),
+          .gc_stride = group_output_channels << log2_output_element_size,
+          .ba_stride = input_depth * input_height * input_width * convolution_op->input_pixel_stride << log2_input_element_size,
+          .bc_stride = output_size * convolution_op->output_pixel_stride << log2_output_element_size,
+          .log2_csize = log2_output_element_size,
+          .ukernel = igemm_ukernel,
+      };
+      memcpy(&convolution_op->context.igemm.params, &convolution_op->params, sizeof(convolution_op->context.igemm.params));
+
+      size_t nc = group_output_channels;
+      if (num_threads > 1) {
+        const size_t num_other_tiles = groups * batch_size * divide_round_up(output_size, mr);
+        const size_t target_tiles_per_thread = 5;
+        const size_t max_nc = divide_round_up(group_output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+        if (max_nc < nc) {
+          nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+        }
+      }
+      if (groups == 1) {
+        #if XNN_MAX_UARCH_TYPES > 1
+          if (xnn_is_hmp_igemm_ukernel(igemm_ukernel)) {
+            if (batch_size > 1) {
+              convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d_with_uarch;
+              convolution_op->compute.task_3d_tile_2d_with_id = (pthreadpool_task_3d_tile_2d_with_id_t) xnn_compute_batch_hmp_igemm;
+            } else {
+              convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d_with_uarch;
+              convolution_op->compute.task_2d_tile_2d_with_id = (pthreadpool_task_2d_tile_2d_with_id_t) xnn_compute_hmp_igemm;
+            }
+          } else {
+            if (batch_size > 1) {
+              convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+              convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_batch_igemm;
+            } else {
+              convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+              convolution_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_igemm;
+            }
+          }
+        #else
+          if (batch_size > 1) {
+            convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+            convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_batch_igemm;
+          } else {
+            convolution_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+            convolution_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_igemm;
+          }
+        #endif
+        if (batch_size > 1) {
+          convolution_op->compute.range[0] = batch_size;
+          convolution_op->compute.range[1] = output_size;
+          convolution_op->compute.range[2] = group_output_channels;
+        } else {
+          convolution_op->compute.range[0] = output_size;
+          convolution_op->compute.range[1] = group_output_channels;
+        }
+        convolution_op->compute.tile[0] = mr;
+        convolution_op->compute.tile[1] = nc;
+      } else {
+        #if XNN_MAX_UARCH_TYPES > 1
+          if (xnn_is_hmp_igemm_ukernel(igemm_ukernel)) {
+            if (batch_size > 1) {
+              convolution_op->compute.type = xnn_parallelization_type_4d_tile_2d_with_uarch;
+              convolution_op->compute.task_4d_tile_2d_with_id = (pthreadpool_task_4d_tile_2d_with_id_t) xnn_compute_hmp_grouped_batch_igemm;
+            } else {
+              convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d_with_uarch;
+              convolution_op->compute.task_3d_tile_2d_with_id = (pthreadpool_task_3d_tile_2d_with_id_t) xnn_compute_hmp_grouped_igemm;
+            }
+          } else {
+            if (batch_size > 1) {
+              convolution_op->compute.type = xnn_parallelization_type_4d_tile_2d;
+              convolution_op->compute.task_4d_tile_2d = (pthreadpool_task_4d_tile_2d_t) xnn_compute_grouped_batch_igemm;
+            } else {
+              convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+              convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_grouped_igemm;
+            }
+          }
+        #else
+          if (batch_size > 1) {
+            convolution_op->compute.type = xnn_parallelization_type_4d_tile_2d;
+            convolution_op->compute.task_4d_tile_2d = (pthreadpool_task_4d_tile_2d_t) xnn_compute_grouped_batch_igemm;
+          } else {
+            convolution_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+            convolution_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_grouped_igemm;
+          }
+        #endif
+        if (batch_size > 1) {
+          convolution_op->compute.range[0] = batch_size;
+          convolution_op->compute.range[1] = groups;
+          convolution_op->compute.range[2] = output_size;
+          convolution_op->compute.range[3] = group_output_channels;
+        } else {
+          convolution_op->compute.range[0] = groups;
+          convolution_op->compute.range[1] = output_size;
+          convolution_op->compute.range[2] = group_output_channels;
+        }
+        convolution_op->compute.tile[0] = mr;
+        convolution_op->compute.tile[1] = nc;
+      }
+      convolution_op->state = xnn_run_state_ready;
+
+      return xnn_status_success;
+    }
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+enum xnn_status xnn_setup_convolution3d_ndhwc_qs8(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_depth,
+    size_t input_height,
+    size_t input_width,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_ndhwc_qs8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_qs8),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_convolution3d_ndhwc(
+    convolution_op,
+    batch_size, input_depth, input_height, input_width,
+    input, output,
+    XNN_INIT_FLAG_QS8,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(extra weights elements) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_convolution3d_ndhwc_f16(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_depth,
+    size_t input_height,
+    size_t input_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_ndhwc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f16),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_convolution3d_ndhwc(
+    convolution_op,
+    batch_size, input_depth, input_height, input_width,
+    input, output,
+    XNN_INIT_FLAG_F16,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
+    sizeof(uint16_t) /* sizeof(extra weights elements) */,
+    1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_convolution3d_ndhwc_f32(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_depth,
+    size_t input_height,
+    size_t input_width,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_convolution_ndhwc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convolution_ndhwc_f32),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_convolution3d_ndhwc(
+    convolution_op,
+    batch_size, input_depth, input_height, input_width,
+    input, output,
+    XNN_INIT_FLAG_F32,
+    2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+    2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
+    sizeof(float) /* sizeof(extra weights elements) */,
+    2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
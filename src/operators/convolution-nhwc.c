@@ -145,6 +145,37 @@ error:
 }
 #endif  // XNN_PLATFORM_JIT
 
+static bool is_winograd_2x2_3x3_applicable(
+    const struct winograd_parameters* winograd_parameters,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint32_t flags)
+{
+  if (winograd_parameters == NULL || winograd_parameters->input == NULL) {
+    return false;
+  }
+  if ((flags & (XNN_FLAG_DISABLE_WINOGRAD | XNN_FLAG_DEPTHWISE_CONVOLUTION)) != 0) {
+    return false;
+  }
+  if (kernel_height != 3 || kernel_width != 3 || groups != 1) {
+    return false;
+  }
+  if ((subsampling_height | subsampling_width | dilation_height | dilation_width) != 1) {
+    return false;
+  }
+  // F(2x2, 3x3) saves 20 of 36 multiply-adds per input-output channel pair and 2x2 output tile, but costs roughly
+  // 160 additions and memory accesses per channel for the input and output transforms. With few channels the
+  // transforms dominate and IGEMM is faster.
+  return group_input_channels * group_output_channels * 20 > (group_input_channels + group_output_channels) * 160;
+}
+
 static enum xnn_status create_convolution2d_nhwc(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -188,6 +219,9 @@ static enum xnn_status create_convolution2d_nhwc(
     const struct gemm_parameters* gemm_parameters,
     const struct dwconv_parameters* dwconv_ukernel,
     const struct vmulcaddc_parameters* vmulcaddc_parameters,
+    const struct winograd_parameters* winograd_parameters,
+    const void* winograd_params,
+    size_t winograd_params_size,
     struct jit_gemm_params* jit_gemm_params,
     bool linear_activation,
     bool relu_activation,
@@ -324,6 +358,11 @@ static enum xnn_status create_convolution2d_nhwc(
     ukernel_type = xnn_ukernel_type_dwconv;
   } else if (kernel_size == 1 && unit_subsampling && !any_padding) {
     ukernel_type = xnn_ukernel_type_gemm;
+  } else if (is_winograd_2x2_3x3_applicable(
+               winograd_parameters, kernel_height, kernel_width, subsampling_height, subsampling_width,
+               dilation_height, dilation_width, groups, group_input_channels, group_output_channels, flags))
+  {
+    ukernel_type = xnn_ukernel_type_winograd;
   } else {
     ukernel_type = xnn_ukernel_type_igemm;
   }
@@ -544,12 +583,82 @@ static enum xnn_status create_convolution2d_nhwc(
       zero_size = XNN_EXTRA_BYTES + (k_stride << log2_input_element_size);
       break;
     }
+    case xnn_ukernel_type_winograd:
+    {
+      assert(winograd_parameters != NULL);
+      assert(winograd_params != NULL);
+
+      const uint32_t nr = gemm_parameters->nr;
+      const uint32_t kr = UINT32_C(1) << gemm_parameters->log2_kr;
+      const uint32_t sr = UINT32_C(1) << gemm_parameters->log2_sr;
+      const size_t n_stride = round_up(group_output_channels, nr);
+      const size_t k_stride = round_up_po2(group_input_channels, kr * sr);
+
+      // 16 GEMM weight matrices (one per transformed position) with zero GEMM bias, followed by the convolution bias,
+      // which is added after the output transform.
+      const size_t packed_position_weights_size = ((k_stride << log2_filter_element_size) + bias_element_size) * n_stride;
+      const size_t packed_weights_size =
+        16 * packed_position_weights_size + n_stride * bias_element_size + XNN_EXTRA_BYTES;
+      const size_t aligned_total_weights_size = round_up_po2(packed_weights_size, XNN_ALLOCATION_ALIGNMENT);
+      void* weights_ptr = xnn_get_pointer_to_write_weights(
+        convolution_op, caches, aligned_total_weights_size, packed_weights_padding_byte);
+      if (weights_ptr == NULL) {
+        xnn_log_error("failed to reserve or allocated %zu bytes for %s operator winograd packed weights",
+                      aligned_total_weights_size, xnn_operator_type_to_string(operator_type));
+        goto error;
+      }
+
+      const size_t transformed_kernel_size = 16 * group_output_channels * group_input_channels * sizeof(float);
+      float* transformed_kernel = xnn_allocate_memory(transformed_kernel_size);
+      if (transformed_kernel == NULL) {
+        xnn_log_error("failed to allocate %zu bytes for %s operator winograd filter transform",
+                      transformed_kernel_size, xnn_operator_type_to_string(operator_type));
+        goto error;
+      }
+      xnn_pack_f32_winograd_2x2_3x3_filter(group_output_channels, group_input_channels, kernel, transformed_kernel);
+      pack_gemm_goi_w(
+        16, group_output_channels, group_input_channels,
+        nr, kr, sr,
+        transformed_kernel, NULL /* bias */, weights_ptr, 0 /* extra bytes */, packing_params);
+      xnn_release_memory(transformed_kernel);
+
+      if (bias != NULL) {
+        memcpy((void*) ((uintptr_t) weights_ptr + 16 * packed_position_weights_size), bias,
+               group_output_channels * bias_element_size);
+      }
+
+      if (use_weights_cache(caches)) {
+        convolution_op->packed_weights.offset = xnn_get_or_insert_weights_cache(
+            caches->weights_cache, weights_ptr, aligned_total_weights_size);
+      }
+
+      memcpy(&convolution_op->params.f32_winograd_output, winograd_params, winograd_params_size);
+      struct xnn_hmp_gemm_ukernel gemm_ukernel = gemm_parameters->minmax.gemm;
+      if (gemm_parameters->linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+        gemm_ukernel = gemm_parameters->linear.gemm;
+      }
+      gemm_parameters->init.f32(&convolution_op->params.f32_winograd_gemm, -INFINITY, INFINITY);
+
+      convolution_op->ukernel.winograd = (struct xnn_ukernel_winograd) {
+        .gemm = gemm_ukernel,
+        .input_function = winograd_parameters->input,
+        .output_function = winograd_parameters->output,
+        .mr = gemm_parameters->mr,
+        .nr = nr,
+        .kr = kr,
+        .sr = sr,
+      };
+
+      // The input transform reads padding pixels from the zero buffer.
+      zero_size = XNN_EXTRA_BYTES + (group_input_channels << log2_input_element_size);
+      break;
+    }
     default:
       XNN_UNREACHABLE;
   }
 
   const bool tf_same_padding = (flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0 && kernel_size != 1;
-  if (any_padding || tf_same_padding) {
+  if (any_padding || tf_same_padding || ukernel_type == xnn_ukernel_type_winograd) {
     convolution_op->zero_buffer = xnn_allocate_simd_memory(zero_size);
     if (convolution_op->zero_buffer == NULL) {
       xnn_log_error(
@@ -705,6 +814,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_qu8(
     &dwconv_params, sizeof(dwconv_params),
     NULL /* vmulcaddc params */, 0,
     &xnn_params.qu8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    NULL /* winograd parameters */, NULL /* winograd params */, 0,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QU8,
     xnn_operator_type_convolution_nhwc_qu8,
@@ -818,6 +928,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_qs8(
     &dwconv_params, sizeof(dwconv_params),
     NULL /* vmulcaddc params */, 0,
     &xnn_params.qs8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    NULL /* winograd parameters */, NULL /* winograd params */, 0,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QS8,
     xnn_operator_type_convolution_nhwc_qs8,
@@ -939,6 +1050,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_qc8(
     &dwconv_params, sizeof(dwconv_params),
     NULL /* vmulcaddc params */, 0,
     &xnn_params.qc8.gemm, dwconv_ukernel, NULL /* vmulcaddc parameters */,
+    NULL /* winograd parameters */, NULL /* winograd params */, 0,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_QC8,
     xnn_operator_type_convolution_nhwc_qc8,
@@ -1051,6 +1163,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_f16(
     &dwconv_params, sizeof(dwconv_params),
     &vmulcaddc_params, sizeof(vmulcaddc_params),
     &xnn_params.f16.gemm, dwconv_ukernel, &xnn_params.f16.vmulcaddc,
+    NULL /* winograd parameters */, NULL /* winograd params */, 0,
     NULL /* jit_gemm_params */,
     false /* linear activation */, false /* relu activation */, XNN_INIT_FLAG_F16,
     xnn_operator_type_convolution_nhwc_f16,
@@ -1106,6 +1219,52 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
   const bool linear_activation = (output_max == INFINITY) && (output_min == -output_max);
   const bool relu_activation = (output_max == INFINITY) && (output_min == 0.0f);
 
+  // FP16 weights are supported only in GEMM and IGEMM micro-kernels, depthwise convolutions keep FP32 weights.
+  const bool depthwise = group_input_channels == 1 && group_output_channels == 1;
+  if ((flags & XNN_FLAG_FP16_STATIC_WEIGHTS) && !depthwise &&
+      xnn_params.f32.gemm_f16w.minmax.gemm.function[XNN_UARCH_DEFAULT] != NULL &&
+      xnn_params.f32.gemm_f16w.minmax.igemm.function[XNN_UARCH_DEFAULT] != NULL)
+  {
+    union xnn_f32_minmax_params gemm_params;
+    xnn_params.f32.gemm_f16w.init.f32(&gemm_params, output_min, output_max);
+
+    struct jit_gemm_params jit_gemm_params = {
+      .f32_minmax = {
+        .min = output_min,
+        .max = output_max
+      }
+    };
+
+    return create_convolution2d_nhwc(
+      input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+      kernel_height, kernel_width,
+      subsampling_height, subsampling_width,
+      dilation_height, dilation_width,
+      groups, group_input_channels, group_output_channels,
+      input_channel_stride, output_channel_stride,
+      kernel, bias, flags,
+      2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+      1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
+      sizeof(uint16_t) /* sizeof(bias element) */,
+      NULL /* pack vmulcaddc */, NULL /* pack dwconv hwg */, NULL /* pack dwconv ghw */,
+      (xnn_pack_gemm_goi_w_function) xnn_pack_f32_to_f16_gemm_goi_w,
+      (xnn_pack_conv_kgo_w_function) xnn_pack_f32_to_f16_conv_kgo_w,
+      (xnn_pack_conv_goki_w_function) xnn_pack_f32_to_f16_conv_goki_w,
+      NULL /* packing params */, 0 /* input padding byte */, 0 /* packed weights padding byte */,
+      0 /* extra weights bytes */, NULL /* init scale params fn */, NULL /* scale params */,
+      &gemm_params, sizeof(gemm_params),
+      NULL /* dwconv params */, 0 /* dwconv params size */,
+      NULL /* vmulcaddc params */, 0 /* vmulcaddc params size */,
+      &xnn_params.f32.gemm_f16w, NULL /* dwconv ukernel */, NULL /* vmulcaddc parameters */,
+      NULL /* winograd parameters */, NULL /* winograd params */, 0 /* winograd params size */,
+      &jit_gemm_params,
+      linear_activation, relu_activation, XNN_INIT_FLAG_F32,
+      xnn_operator_type_convolution_nhwc_f32,
+      caches,
+      convolution_op_out);
+  }
+  flags &= ~XNN_FLAG_FP16_STATIC_WEIGHTS;
+
   union xnn_f32_minmax_params gemm_params;
   if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
     xnn_params.f32.gemm.init.f32(&gemm_params, output_min, output_max);
@@ -1130,6 +1289,11 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     xnn_params.f32.vmulcaddc.init.f32(&vmulcaddc_params, output_min, output_max);
   }
 
+  union xnn_f32_minmax_params winograd_params;
+  if XNN_LIKELY(xnn_params.f32.winograd.init.f32 != NULL) {
+    xnn_params.f32.winograd.init.f32(&winograd_params, output_min, output_max);
+  }
+
   return create_convolution2d_nhwc(
     input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
     kernel_height, kernel_width,
@@ -1153,6 +1317,7 @@ enum xnn_status xnn_create_convolution2d_nhwc_f32(
     &dwconv_params, sizeof(dwconv_params),
     &vmulcaddc_params, sizeof(vmulcaddc_params),
     &xnn_params.f32.gemm, dwconv_ukernel, &xnn_params.f32.vmulcaddc,
+    &xnn_params.f32.winograd, &winograd_params, sizeof(winograd_params),
     &jit_gemm_params,
     linear_activation, relu_activation, XNN_INIT_FLAG_F32,
     xnn_operator_type_convolution_nhwc_f32,
@@ -1598,6 +1763,110 @@ static enum xnn_status setup_convolution2d_nhwc(
 
       return xnn_status_success;
     }
+    case xnn_ukernel_type_winograd:
+    {
+      const size_t output_height = convolution_op->output_height;
+      const size_t output_width = convolution_op->output_width;
+      const size_t input_channels = convolution_op->group_input_channels;
+      const size_t output_channels = convolution_op->group_output_channels;
+      const size_t tiles_height = divide_round_up(output_height, 2);
+      const size_t tiles_width = divide_round_up(output_width, 2);
+      const size_t tiles = batch_size * tiles_height * tiles_width;
+
+      const size_t transformed_input_tile_stride = 16 * (input_channels << log2_input_element_size);
+      const size_t transformed_output_tile_stride = 16 * (output_channels << log2_output_element_size);
+
+      // Tiles are processed in blocks of up to 16 * MR tiles. Blocks are further limited to keep the transformed
+      // input and output of a block within the L2 cache, and to leave several blocks per thread for load balancing.
+      const uint32_t mr = convolution_op->ukernel.winograd.mr;
+      const size_t block_cache_size = 256 * 1024;
+      const size_t transformed_tile_size = transformed_input_tile_stride + transformed_output_tile_stride;
+      size_t tile_block = min(tiles, 16 * mr);
+      tile_block = min(tile_block, max(block_cache_size / transformed_tile_size, 1));
+      if (num_threads > 1) {
+        const size_t target_tiles_per_thread = 5;
+        tile_block = min(tile_block, divide_round_up(tiles, num_threads * target_tiles_per_thread));
+      }
+      tile_block = round_up(tile_block, mr);
+      const size_t num_blocks = divide_round_up(tiles, tile_block);
+      const size_t num_slots = min(num_blocks, max(num_threads, 1));
+
+      // One block buffer per slot: the workspace size depends on the number of threads, but not on the image size.
+      const size_t transformed_output_offset =
+        round_up_po2(tile_block * transformed_input_tile_stride, XNN_ALLOCATION_ALIGNMENT);
+      const size_t slot_stride = round_up_po2(
+        transformed_output_offset + tile_block * transformed_output_tile_stride + XNN_EXTRA_BYTES,
+        XNN_ALLOCATION_ALIGNMENT);
+      const size_t workspace_size = num_slots * slot_stride;
+      if (workspace_size > convolution_op->workspace_size) {
+        xnn_release_simd_memory(convolution_op->workspace);
+        convolution_op->workspace_size = 0;
+        convolution_op->workspace = xnn_allocate_simd_memory(workspace_size);
+        if (convolution_op->workspace == NULL) {
+          xnn_log_error(
+            "failed to allocate %zu bytes for %s operator workspace",
+            workspace_size, xnn_operator_type_to_string(convolution_op->type));
+          return xnn_status_out_of_memory;
+        }
+        convolution_op->workspace_size = workspace_size;
+      }
+
+      const uint32_t nr = convolution_op->ukernel.winograd.nr;
+      const uint32_t kr = convolution_op->ukernel.winograd.kr;
+      const uint32_t sr = convolution_op->ukernel.winograd.sr;
+      const size_t n_stride = round_up(output_channels, nr);
+      const size_t k_stride = round_up_po2(input_channels, kr * sr);
+      const size_t packed_w_position_stride = ((k_stride << log2_filter_element_size) + sizeof(float)) * n_stride;
+      const void* packed_w = packed_weights(convolution_op);
+
+      convolution_op->context.winograd = (struct winograd_context) {
+        .tiles = tiles,
+        .tile_block = tile_block,
+        .num_slots = num_slots,
+        .slot_stride = slot_stride,
+        .input_height = input_height,
+        .input_width = input_width,
+        .input = input,
+        .input_pixel_stride = convolution_op->input_pixel_stride << log2_input_element_size,
+        .input_batch_stride = (input_height * input_width * convolution_op->input_pixel_stride) << log2_input_element_size,
+        .input_channels = input_channels,
+        .input_padding_top = convolution_op->padding_top,
+        .input_padding_left = convolution_op->padding_left,
+        .zero = convolution_op->zero_buffer,
+        .tiles_height = tiles_height,
+        .tiles_width = tiles_width,
+        .workspace = convolution_op->workspace,
+        .transformed_input_tile_stride = transformed_input_tile_stride,
+        .transformed_input_position_stride = input_channels << log2_input_element_size,
+        .input_ukernel = convolution_op->ukernel.winograd.input_function,
+        .mr = convolution_op->ukernel.winograd.mr,
+        .output_channels = output_channels,
+        .packed_w = packed_w,
+        .packed_w_position_stride = packed_w_position_stride,
+        .transformed_output_offset = transformed_output_offset,
+        .transformed_output_tile_stride = transformed_output_tile_stride,
+        .transformed_output_position_stride = output_channels << log2_output_element_size,
+        .cn_stride = nr << log2_output_element_size,
+        .gemm_ukernel = convolution_op->ukernel.winograd.gemm,
+        .gemm_params = convolution_op->params.f32_winograd_gemm,
+        .bias = (const void*) ((uintptr_t) packed_w + 16 * packed_w_position_stride),
+        .output_height = output_height,
+        .output_width = output_width,
+        .output = output,
+        .output_pixel_stride = convolution_op->output_pixel_stride << log2_output_element_size,
+        .output_batch_stride = (output_height * output_width * convolution_op->output_pixel_stride) << log2_output_element_size,
+        .output_ukernel = convolution_op->ukernel.winograd.output_function,
+        .output_params = convolution_op->params.f32_winograd_output,
+      };
+
+      convolution_op->compute.type = xnn_parallelization_type_1d;
+      convolution_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_winograd;
+      convolution_op->compute.range[0] = num_slots;
+      convolution_op->compute2.type = xnn_parallelization_type_invalid;
+      convolution_op->state = xnn_run_state_ready;
+
+      return xnn_status_success;
+    }
     default:
       XNN_UNREACHABLE;
   }
@@ -1731,14 +2000,386 @@ enum xnn_status xnn_setup_convolution2d_nhwc_f32(
     return xnn_status_invalid_parameter;
   }
 
+  const bool fp16_weights = (convolution_op->flags & XNN_FLAG_FP16_STATIC_WEIGHTS) != 0;
   return setup_convolution2d_nhwc(
     convolution_op,
     batch_size, input_height, input_width,
     input, output,
     XNN_INIT_FLAG_F32,
     2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+    fp16_weights ? 1 /* log2(sizeof(uint16_t)) */ : 2 /* log2(sizeof(float)) */,
+    fp16_weights ? sizeof(uint16_t) : sizeof(float) /* sizeof(extra weights elements) */,
+    2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+// Streaming Convolution is a causal 1D convolution over a stream of frames. It is implemented as a 1xK convolution over
+// a window that prepends the last (kernel_size - 1) * dilation frames of the previous runs to the new frames, so every
+// run computes outputs only for the new frames.
+static enum xnn_status init_streaming_convolution1d_nwc(
+    enum xnn_status status,
+    xnn_operator_t convolution_op,
+    int32_t history_fill_value,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* convolution_op_out)
+{
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  assert(convolution_op->ukernel.type != xnn_ukernel_type_winograd);
+  convolution_op->type = operator_type;
+  // Initial history: zero frames for floating-point operators, zero-point frames for quantized operators.
+  convolution_op->input_zero_point = history_fill_value;
+  *convolution_op_out = convolution_op;
+  return xnn_status_success;
+}
+
+static enum xnn_status check_streaming_convolution1d_nwc_flags(
+    uint32_t flags,
+    enum xnn_operator_type operator_type)
+{
+  if ((flags & XNN_FLAG_TENSORFLOW_SAME_PADDING) != 0) {
+    xnn_log_error(
+      "failed to create %s operator: causal convolution can't be combined with TensorFlow SAME padding",
+      xnn_operator_type_to_string(operator_type));
+    return xnn_status_invalid_parameter;
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_create_streaming_convolution1d_nwc_qs8(
+    uint32_t kernel_size,
+    uint32_t dilation,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    float kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* convolution_op_out)
+{
+  enum xnn_status status = check_streaming_convolution1d_nwc_flags(flags, xnn_operator_type_streaming_convolution_nwc_qs8);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  xnn_operator_t convolution_op = NULL;
+  status = xnn_create_convolution2d_nhwc_qs8(
+    0, 0, 0, 0,
+    1, kernel_size,
+    1, 1,
+    1, dilation,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    input_zero_point, input_scale, kernel_scale,
+    kernel, bias,
+    output_zero_point, output_scale, output_min, output_max,
+    flags, caches, &convolution_op);
+  return init_streaming_convolution1d_nwc(
+    status, convolution_op, input_zero_point, xnn_operator_type_streaming_convolution_nwc_qs8, convolution_op_out);
+}
+
+enum xnn_status xnn_create_streaming_convolution1d_nwc_f16(
+    uint32_t kernel_size,
+    uint32_t dilation,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* convolution_op_out)
+{
+  enum xnn_status status = check_streaming_convolution1d_nwc_flags(flags, xnn_operator_type_streaming_convolution_nwc_f16);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  xnn_operator_t convolution_op = NULL;
+  status = xnn_create_convolution2d_nhwc_f16(
+    0, 0, 0, 0,
+    1, kernel_size,
+    1, 1,
+    1, dilation,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias,
+    output_min, output_max,
+    flags, caches, &convolution_op);
+  return init_streaming_convolution1d_nwc(
+    status, convolution_op, 0, xnn_operator_type_streaming_convolution_nwc_f16, convolution_op_out);
+}
+
+enum xnn_status xnn_create_streaming_convolution1d_nwc_f32(
+    uint32_t kernel_size,
+    uint32_t dilation,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    size_t input_channel_stride,
+    size_t output_channel_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* convolution_op_out)
+{
+  enum xnn_status status = check_streaming_convolution1d_nwc_flags(flags, xnn_operator_type_streaming_convolution_nwc_f32);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  xnn_operator_t convolution_op = NULL;
+  status = xnn_create_convolution2d_nhwc_f32(
+    0, 0, 0, 0,
+    1, kernel_size,
+    1, 1,
+    1, dilation,
+    groups, group_input_channels, group_output_channels,
+    input_channel_stride, output_channel_stride,
+    kernel, bias,
+    output_min, output_max,
+    flags, caches, &convolution_op);
+  return init_streaming_convolution1d_nwc(
+    status, convolution_op, 0, xnn_operator_type_streaming_convolution_nwc_f32, convolution_op_out);
+}
+
+// Clears the history of every batch element: the ring buffers start at frame 0 and hold only initial frames.
+static void reset_streaming_convolution1d_nwc_state(
+  xnn_operator_t convolution_op)
+{
+  const size_t heads_size = convolution_op->state_batch_size * sizeof(size_t);
+  assert(heads_size <= convolution_op->state_buffer_size);
+  memset(convolution_op->state_buffer, 0, heads_size);
+  memset(
+    (void*) ((uintptr_t) convolution_op->state_buffer + heads_size),
+    convolution_op->input_zero_point, convolution_op->state_buffer_size - heads_size);
+}
+
+static enum xnn_status setup_streaming_convolution1d_nwc(
+  xnn_operator_t convolution_op,
+  size_t batch_size,
+  size_t input_frames,
+  const void* input,
+  void* output,
+  uint32_t datatype_init_flags,
+  uint32_t log2_input_element_size,
+  uint32_t log2_filter_element_size,
+  uint32_t extra_weights_elements_size,
+  uint32_t log2_output_element_size,
+  size_t num_threads)
+{
+  convolution_op->state = xnn_run_state_invalid;
+
+  if (input_frames == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu input frames: number of frames must be non-zero",
+      xnn_operator_type_to_string(convolution_op->type), input_frames);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t history_frames = (size_t) (convolution_op->kernel_width - 1) * (size_t) convolution_op->dilation_width;
+  if (history_frames == 0 || batch_size == 0) {
+    // Without history the convolution reads the new frames in place.
+    convolution_op->compute2.type = xnn_parallelization_type_invalid;
+    return setup_convolution2d_nhwc(
+      convolution_op,
+      batch_size, 1 /* input height */, input_frames,
+      input, output,
+      datatype_init_flags,
+      log2_input_element_size, log2_filter_element_size, extra_weights_elements_size, log2_output_element_size,
+      num_threads);
+  }
+
+  const size_t frame_size = (convolution_op->groups * convolution_op->group_input_channels) << log2_input_element_size;
+  const size_t state_batch_stride = history_frames * frame_size;
+  const size_t state_heads_size = batch_size * sizeof(size_t);
+  const size_t state_buffer_size = state_heads_size + batch_size * state_batch_stride;
+  if (state_buffer_size != convolution_op->state_buffer_size) {
+    // A different number of streams invalidates the history.
+    xnn_release_simd_memory(convolution_op->state_buffer);
+    convolution_op->state_buffer_size = 0;
+    convolution_op->state_buffer = xnn_allocate_simd_memory(state_buffer_size);
+    if (convolution_op->state_buffer == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator state",
+        state_buffer_size, xnn_operator_type_to_string(convolution_op->type));
+      return xnn_status_out_of_memory;
+    }
+    convolution_op->state_buffer_size = state_buffer_size;
+    convolution_op->state_batch_size = batch_size;
+    reset_streaming_convolution1d_nwc_state(convolution_op);
+  }
+
+  const size_t window_frames = history_frames + input_frames;
+  const size_t window_frame_stride = convolution_op->input_pixel_stride << log2_input_element_size;
+  const size_t window_batch_stride = window_frames * window_frame_stride;
+  const size_t workspace_size = batch_size * window_batch_stride + XNN_EXTRA_BYTES;
+  if (workspace_size > convolution_op->workspace_size) {
+    xnn_release_simd_memory(convolution_op->workspace);
+    convolution_op->workspace_size = 0;
+    convolution_op->workspace = xnn_allocate_simd_memory(workspace_size);
+    if (convolution_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(convolution_op->type));
+      return xnn_status_out_of_memory;
+    }
+    convolution_op->workspace_size = workspace_size;
+  }
+
+  const enum xnn_status status = setup_convolution2d_nhwc(
+    convolution_op,
+    batch_size, 1 /* input height */, window_frames,
+    convolution_op->workspace, output,
+    datatype_init_flags,
+    log2_input_element_size, log2_filter_element_size, extra_weights_elements_size, log2_output_element_size,
+    num_threads);
+  if (status != xnn_status_success) {
+    return status;
+  }
+  assert(convolution_op->output_height == 1);
+  assert(convolution_op->output_width == input_frames);
+
+  // The convolution over the window runs second, after the window is assembled. Its context stays in place: it is the
+  // first member of the streaming convolution context.
+  convolution_op->compute2 = convolution_op->compute;
+
+  struct streaming_convolution_context* context = &convolution_op->context.streaming_convolution;
+  context->input = input;
+  context->input_frame_stride = window_frame_stride;
+  context->input_batch_stride = input_frames * window_frame_stride;
+  context->state = (void*) ((uintptr_t) convolution_op->state_buffer + state_heads_size);
+  context->state_batch_stride = state_batch_stride;
+  context->state_heads = (size_t*) convolution_op->state_buffer;
+  context->window = convolution_op->workspace;
+  context->window_frame_stride = window_frame_stride;
+  context->window_batch_stride = window_batch_stride;
+  context->frame_size = frame_size;
+  context->history_frames = history_frames;
+  context->input_frames = input_frames;
+
+  convolution_op->compute.type = xnn_parallelization_type_1d;
+  convolution_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_streaming_convolution_window;
+  convolution_op->compute.range[0] = batch_size;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_streaming_convolution1d_nwc_qs8(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_frames,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_streaming_convolution_nwc_qs8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_streaming_convolution_nwc_qs8),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_streaming_convolution1d_nwc(
+    convolution_op,
+    batch_size, input_frames,
+    input, output,
+    XNN_INIT_FLAG_QS8,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(extra weights elements) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_streaming_convolution1d_nwc_f16(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_frames,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_streaming_convolution_nwc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_streaming_convolution_nwc_f16),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_streaming_convolution1d_nwc(
+    convolution_op,
+    batch_size, input_frames,
+    input, output,
+    XNN_INIT_FLAG_F16,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
+    sizeof(uint16_t) /* sizeof(extra weights elements) */,
+    1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_streaming_convolution1d_nwc_f32(
+    xnn_operator_t convolution_op,
+    size_t batch_size,
+    size_t input_frames,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (convolution_op->type != xnn_operator_type_streaming_convolution_nwc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_streaming_convolution_nwc_f32),
+      xnn_operator_type_to_string(convolution_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_streaming_convolution1d_nwc(
+    convolution_op,
+    batch_size, input_frames,
+    input, output,
+    XNN_INIT_FLAG_F32,
+    2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
     2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
     sizeof(float) /* sizeof(extra weights elements) */,
     2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
     pthreadpool_get_threads_count(threadpool));
 }
+
+enum xnn_status xnn_reset_streaming_convolution1d_nwc(
+    xnn_operator_t convolution_op)
+{
+  switch (convolution_op->type) {
+    case xnn_operator_type_streaming_convolution_nwc_f16:
+    case xnn_operator_type_streaming_convolution_nwc_f32:
+    case xnn_operator_type_streaming_convolution_nwc_qs8:
+      break;
+    default:
+      xnn_log_error("failed to reset operator: %s operator has no state",
+        xnn_operator_type_to_string(convolution_op->type));
+      return xnn_status_invalid_parameter;
+  }
+
+  if (convolution_op->state_buffer != NULL) {
+    reset_streaming_convolution1d_nwc_state(convolution_op);
+  }
+  return xnn_status_success;
+}
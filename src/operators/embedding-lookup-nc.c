@@ -0,0 +1,375 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_embedding_lookup_nc(
+    enum xnn_reduce_operator bag_operator,
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* embedding_lookup_op_out)
+{
+  xnn_operator_t embedding_lookup_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (num_embeddings == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu embeddings: number of embeddings must be non-zero",
+      xnn_operator_type_to_string(operator_type), num_embeddings);
+    goto error;
+  }
+
+  if (num_embeddings > (size_t) INT32_MAX + 1) {
+    xnn_log_error(
+      "failed to create %s operator with %zu embeddings: number of embeddings must not exceed 2**31",
+      xnn_operator_type_to_string(operator_type), num_embeddings);
+    goto error;
+  }
+
+  if (embedding_dim == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu embedding dimension: embedding dimension must be non-zero",
+      xnn_operator_type_to_string(operator_type), embedding_dim);
+    goto error;
+  }
+
+  if (table == NULL) {
+    xnn_log_error(
+      "failed to create %s operator: embedding table must be non-NULL",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  switch (bag_operator) {
+    case xnn_reduce_invalid:
+    case xnn_reduce_sum:
+    case xnn_reduce_mean:
+      break;
+    default:
+      xnn_log_error("failed to create %s operator with %d bag operator: bag operator must be sum or mean",
+        xnn_operator_type_to_string(operator_type), bag_operator);
+      goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  embedding_lookup_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (embedding_lookup_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  embedding_lookup_op->channels = embedding_dim;
+  embedding_lookup_op->params.embedding.table = table;
+  embedding_lookup_op->params.embedding.num_embeddings = num_embeddings;
+  embedding_lookup_op->params.embedding.bag_operator = bag_operator;
+
+  embedding_lookup_op->type = operator_type;
+  embedding_lookup_op->flags = flags;
+
+  embedding_lookup_op->state = xnn_run_state_invalid;
+
+  *embedding_lookup_op_out = embedding_lookup_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(embedding_lookup_op);
+  return status;
+}
+
+enum xnn_status xnn_create_embedding_lookup_nc_x8(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    uint32_t flags,
+    xnn_operator_t* embedding_lookup_op_out)
+{
+  return create_embedding_lookup_nc(
+    xnn_reduce_invalid, num_embeddings, embedding_dim, table, flags,
+    XNN_INIT_FLAG_XX, xnn_operator_type_embedding_lookup_nc_x8,
+    embedding_lookup_op_out);
+}
+
+enum xnn_status xnn_create_embedding_lookup_nc_x16(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    uint32_t flags,
+    xnn_operator_t* embedding_lookup_op_out)
+{
+  return create_embedding_lookup_nc(
+    xnn_reduce_invalid, num_embeddings, embedding_dim, table, flags,
+    XNN_INIT_FLAG_XX, xnn_operator_type_embedding_lookup_nc_x16,
+    embedding_lookup_op_out);
+}
+
+enum xnn_status xnn_create_embedding_lookup_nc_x32(
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    uint32_t flags,
+    xnn_operator_t* embedding_lookup_op_out)
+{
+  return create_embedding_lookup_nc(
+    xnn_reduce_invalid, num_embeddings, embedding_dim, table, flags,
+    XNN_INIT_FLAG_XX, xnn_operator_type_embedding_lookup_nc_x32,
+    embedding_lookup_op_out);
+}
+
+static enum xnn_status create_embedding_bag_nc(
+    enum xnn_reduce_operator bag_operator,
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* embedding_bag_op_out)
+{
+  if (bag_operator != xnn_reduce_sum && bag_operator != xnn_reduce_mean) {
+    xnn_log_error("failed to create %s operator with %d bag operator: bag operator must be sum or mean",
+      xnn_operator_type_to_string(operator_type), bag_operator);
+    return xnn_status_invalid_parameter;
+  }
+
+  return create_embedding_lookup_nc(
+    bag_operator, num_embeddings, embedding_dim, table, flags,
+    datatype_init_flags, operator_type,
+    embedding_bag_op_out);
+}
+
+enum xnn_status xnn_create_embedding_bag_nc_f16(
+    enum xnn_reduce_operator bag_operator,
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const void* table,
+    uint32_t flags,
+    xnn_operator_t* embedding_bag_op_out)
+{
+  return create_embedding_bag_nc(
+    bag_operator, num_embeddings, embedding_dim, table, flags,
+    XNN_INIT_FLAG_F16 | XNN_INIT_FLAG_XX, xnn_operator_type_embedding_bag_nc_f16,
+    embedding_bag_op_out);
+}
+
+enum xnn_status xnn_create_embedding_bag_nc_f32(
+    enum xnn_reduce_operator bag_operator,
+    size_t num_embeddings,
+    size_t embedding_dim,
+    const float* table,
+    uint32_t flags,
+    xnn_operator_t* embedding_bag_op_out)
+{
+  return create_embedding_bag_nc(
+    bag_operator, num_embeddings, embedding_dim, table, flags,
+    XNN_INIT_FLAG_F32 | XNN_INIT_FLAG_XX, xnn_operator_type_embedding_bag_nc_f32,
+    embedding_bag_op_out);
+}
+
+static enum xnn_status setup_embedding_lookup_nc(
+    xnn_operator_t embedding_lookup_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    void* output,
+    uint32_t log2_element_size,
+    const struct vbinary_parameters* vadd,
+    const struct vbinary_parameters* vmul,
+    size_t num_threads)
+{
+  if (embedding_lookup_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(embedding_lookup_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  embedding_lookup_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(embedding_lookup_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (bag_size == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu bag size: bag size must be non-zero",
+      xnn_operator_type_to_string(embedding_lookup_op->type), bag_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    embedding_lookup_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  // Indices are not read during setup: in a runtime they may be produced by other operators. They are checked when
+  // rows are gathered, and xnn_run_operator reports out-of-range indices.
+  const size_t num_embeddings = embedding_lookup_op->params.embedding.num_embeddings;
+  embedding_lookup_op->invalid_indices = false;
+
+  embedding_lookup_op->batch_size = batch_size;
+  embedding_lookup_op->output = output;
+
+  const size_t row_size = embedding_lookup_op->channels << log2_element_size;
+  embedding_lookup_op->context.embedding_lookup = (struct embedding_lookup_context) {
+    .table = embedding_lookup_op->params.embedding.table,
+    .num_embeddings = num_embeddings,
+    .invalid_indices = &embedding_lookup_op->invalid_indices,
+    .row_size = row_size,
+    .indices = indices,
+    .output = output,
+    .bag_size = bag_size,
+    .copy_ukernel = xnn_params.xx.copy,
+  };
+
+  const enum xnn_reduce_operator bag_operator = embedding_lookup_op->params.embedding.bag_operator;
+  if (bag_operator != xnn_reduce_invalid) {
+    struct embedding_lookup_context* context = &embedding_lookup_op->context.embedding_lookup;
+    context->vadd_ukernel = vadd->linear.op_ukernel != NULL ? vadd->linear.op_ukernel : vadd->minmax.op_ukernel;
+    if (bag_operator == xnn_reduce_mean && bag_size != 1) {
+      context->vmulc_ukernel = vmul->linear.opc_ukernel != NULL ? vmul->linear.opc_ukernel : vmul->minmax.opc_ukernel;
+    }
+    const float scale = 1.0f / (float) bag_size;
+    if (embedding_lookup_op->type == xnn_operator_type_embedding_bag_nc_f16) {
+      context->scale.f16 = fp16_ieee_from_fp32_value(scale);
+      vadd->init.f16_minmax(&context->minmax_params.f16, UINT16_C(0xFC00), UINT16_C(0x7C00));
+    } else {
+      context->scale.f32 = scale;
+      vadd->init.f32_minmax(&context->minmax_params.f32, -INFINITY, INFINITY);
+    }
+  }
+
+  // Split the batch into tiles of rows, with several tiles per thread for load balancing.
+  size_t batch_tile = batch_size;
+  if (num_threads > 1) {
+    const size_t target_tiles_per_thread = 5;
+    batch_tile = max(divide_round_up(batch_size, num_threads * target_tiles_per_thread), 1);
+  }
+
+  embedding_lookup_op->compute.type = xnn_parallelization_type_1d_tile_1d;
+  embedding_lookup_op->compute.task_1d_tile_1d = bag_operator == xnn_reduce_invalid ?
+    (pthreadpool_task_1d_tile_1d_t) xnn_compute_embedding_lookup :
+    (pthreadpool_task_1d_tile_1d_t) xnn_compute_embedding_bag;
+  embedding_lookup_op->compute.range[0] = batch_size;
+  embedding_lookup_op->compute.tile[0] = batch_tile;
+  embedding_lookup_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_embedding_lookup_nc_x8(
+    xnn_operator_t embedding_lookup_op,
+    size_t batch_size,
+    const int32_t* indices,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_lookup_op, xnn_operator_type_embedding_lookup_nc_x8,
+    batch_size, 1 /* bag size */, indices, output,
+    0 /* log2(sizeof(uint8_t)) */,
+    NULL /* vadd */, NULL /* vmul */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_embedding_lookup_nc_x16(
+    xnn_operator_t embedding_lookup_op,
+    size_t batch_size,
+    const int32_t* indices,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_lookup_op, xnn_operator_type_embedding_lookup_nc_x16,
+    batch_size, 1 /* bag size */, indices, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    NULL /* vadd */, NULL /* vmul */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_embedding_lookup_nc_x32(
+    xnn_operator_t embedding_lookup_op,
+    size_t batch_size,
+    const int32_t* indices,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_lookup_op, xnn_operator_type_embedding_lookup_nc_x32,
+    batch_size, 1 /* bag size */, indices, output,
+    2 /* log2(sizeof(uint32_t)) */,
+    NULL /* vadd */, NULL /* vmul */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_embedding_bag_nc_f16(
+    xnn_operator_t embedding_bag_op,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_bag_op, xnn_operator_type_embedding_bag_nc_f16,
+    batch_size, bag_size, indices, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    &xnn_params.f16.vadd, &xnn_params.f16.vmul,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_embedding_bag_nc_f32(
+    xnn_operator_t embedding_bag_op,
+    size_t batch_size,
+    size_t bag_size,
+    const int32_t* indices,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_embedding_lookup_nc(
+    embedding_bag_op, xnn_operator_type_embedding_bag_nc_f32,
+    batch_size, bag_size, indices, output,
+    2 /* log2(sizeof(float)) */,
+    &xnn_params.f32.vadd, &xnn_params.f32.vmul,
+    pthreadpool_get_threads_count(threadpool));
+}
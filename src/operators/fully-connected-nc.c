@@ -21,6 +21,7 @@
 #include <xnnpack/math.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/pack.h>
+#include <xnnpack/params-init.h>
 #include <xnnpack/params.h>
 
 
@@ -32,16 +33,21 @@ static enum xnn_status create_fully_connected_nc(
     const void* kernel,
     const void* bias,
     uint32_t flags,
-    uint32_t log2_filter_element_size,
+    uint32_t log2_filter_element_bits,
     uint32_t bias_element_size,
     xnn_pack_gemm_io_w_function pack_gemm_io_w,
     xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
     const void* packing_params,
     int packed_weights_padding_byte,
+    size_t extra_weights_bytes,
+    xnn_init_qc8_scale_params_fn init_scale_params,
+    const float* scale_params,
+    const float* float_bias,
     const void* params,
     size_t params_size,
     const struct gemm_parameters* gemm_parameters,
     const struct gemm_fused_ukernels* gemm_ukernels,
+    xnn_f32_gemminc_minmax_ukernel_function gemminc_ukernel,
     uint32_t datatype_init_flags,
     enum xnn_operator_type operator_type,
     xnn_caches_t caches,
@@ -65,6 +71,13 @@ static enum xnn_status create_fully_connected_nc(
     goto error;
   }
 
+  if (gemm_ukernels->gemm.function[XNN_UARCH_DEFAULT] == NULL) {
+    xnn_log_error(
+      "failed to create %s operator: no micro-kernels are available for the host processor",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
   status = xnn_status_invalid_parameter;
 
   if (input_channels == 0) {
@@ -118,7 +131,10 @@ static enum xnn_status create_fully_connected_nc(
   const size_t n_stride = round_up(output_channels, nr);
   const size_t k_stride = round_up_po2(input_channels, kr * sr);
 
-  const size_t packed_weights_size = n_stride * (bias_element_size + (k_stride << log2_filter_element_size));
+  // Filter elements narrower than a byte are packed several per byte.
+  const size_t packed_k_bytes = divide_round_up(k_stride << log2_filter_element_bits, 8);
+  const size_t weights_stride = bias_element_size + packed_k_bytes + extra_weights_bytes;
+  const size_t packed_weights_size = n_stride * weights_stride;
   size_t aligned_total_weights_size = round_up_po2(packed_weights_size, XNN_ALLOCATION_ALIGNMENT);
   void* weights_ptr = xnn_get_pointer_to_write_weights(
       fully_connected_op, caches, aligned_total_weights_size, packed_weights_padding_byte);
@@ -135,6 +151,7 @@ static enum xnn_status create_fully_connected_nc(
       nr, kr, sr,
       kernel, bias,
       weights_ptr,
+      nr * extra_weights_bytes,
       packing_params);
   } else {
     pack_gemm_goi_w(
@@ -142,10 +159,22 @@ static enum xnn_status create_fully_connected_nc(
       nr, kr, sr,
       kernel, bias,
       weights_ptr,
-      0 /* extra bytes */,
+      nr * extra_weights_bytes,
       packing_params);
   }
 
+  if (scale_params != NULL) {
+    assert(init_scale_params != NULL);
+
+    // Per-channel scales, and optionally the floating-point bias, follow the packed weights of every NR block.
+    void* extra_weights = (void*) ((uintptr_t) weights_ptr + nr * (bias_element_size + packed_k_bytes));
+    init_scale_params(output_channels, nr, nr * weights_stride, scale_params, extra_weights);
+    if (float_bias != NULL) {
+      init_scale_params(
+        output_channels, nr, nr * weights_stride, float_bias, (void*) ((uintptr_t) extra_weights + nr * sizeof(float)));
+    }
+  }
+
   if (use_weights_cache(caches)) {
     fully_connected_op->packed_weights.offset = xnn_get_or_insert_weights_cache(
         caches->weights_cache, weights_ptr, aligned_total_weights_size);
@@ -153,6 +182,7 @@ static enum xnn_status create_fully_connected_nc(
 
   fully_connected_op->group_input_channels = input_channels;
   fully_connected_op->group_output_channels = output_channels;
+  fully_connected_op->weights_stride = weights_stride;
   fully_connected_op->input_pixel_stride = input_stride;
   fully_connected_op->output_pixel_stride = output_stride;
 
@@ -164,9 +194,11 @@ static enum xnn_status create_fully_connected_nc(
   fully_connected_op->ukernel.gemm = (struct xnn_ukernel_gemm) {
     .general_case = gemm_ukernels->gemm,
     .mr1_case = gemm_ukernels->gemm1,
+    .inc_case = gemminc_ukernel,
     .mr = gemm_parameters->mr,
     .nr = nr,
     .kr = kr,
+    .sr = sr,
   };
 
   fully_connected_op->state = xnn_run_state_invalid;
@@ -179,6 +211,241 @@ error:
   return status;
 }
 
+static enum xnn_status setup_blocked_fully_connected_nc_f32(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  size_t kc,
+  size_t num_threads)
+{
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const uint32_t mr = fully_connected_op->ukernel.gemm.mr;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+  const uint32_t kr = fully_connected_op->ukernel.gemm.kr;
+  const uint32_t sr = fully_connected_op->ukernel.gemm.sr;
+  const size_t k_stride = round_up_po2(input_channels, kr * sr);
+  const size_t n_stride = round_up(output_channels, nr);
+  const size_t l2_cache_size = xnn_params.l2_cache_size;
+
+  const size_t acc_n_stride = mr * nr * sizeof(float);
+  const size_t acc_m_stride = n_stride * mr * sizeof(float);
+  const size_t workspace_size = divide_round_up(batch_size, mr) * acc_m_stride;
+  if (workspace_size > fully_connected_op->workspace_size) {
+    xnn_release_simd_memory(fully_connected_op->workspace);
+    fully_connected_op->workspace_size = 0;
+    // Rows of accumulator tiles past the batch size are read by the micro-kernels, but never stored to the output.
+    fully_connected_op->workspace = xnn_allocate_zero_simd_memory(workspace_size);
+    if (fully_connected_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->workspace_size = workspace_size;
+  }
+
+  fully_connected_op->context.blocked_gemm = (struct blocked_gemm_context) {
+    .k_scaled = input_channels * sizeof(float),
+    .kc_scaled = kc * sizeof(float),
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .packed_w = packed_weights(fully_connected_op),
+    .w_stride = (k_stride + 1) * sizeof(float),
+    .w_bias_size = nr * sizeof(float),
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .acc = fully_connected_op->workspace,
+    .acc_m_stride = acc_m_stride,
+    .acc_n_stride = acc_n_stride,
+    .mr = mr,
+    .nr = nr,
+    .ukernel = fully_connected_op->ukernel.gemm.general_case.function[XNN_UARCH_DEFAULT],
+    .inc_ukernel = fully_connected_op->ukernel.gemm.inc_case,
+    .params = fully_connected_op->params.f32_minmax,
+  };
+  xnn_params.f32.gemm.init.f32(&fully_connected_op->context.blocked_gemm.acc_params, -INFINITY, INFINITY);
+
+  // Batch tile: a KC-wide slice of the input rows fills a quarter of L2.
+  const size_t mc = min(round_up(batch_size, mr), max(mr, l2_cache_size / 4 / (kc * sizeof(float)) / mr * mr));
+  // Output channel tile: accumulators of the tile fill a half of L2.
+  size_t nc = min(output_channels, max(nr, l2_cache_size / 2 / (mc * sizeof(float)) / nr * nr));
+  if (num_threads > 1) {
+    const size_t num_other_tiles = divide_round_up(batch_size, mc);
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+    if (max_nc < nc) {
+      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+    }
+  }
+  fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_2d;
+  fully_connected_op->compute.task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_blocked_gemm;
+  fully_connected_op->compute.range[0] = output_channels;
+  fully_connected_op->compute.range[1] = batch_size;
+  fully_connected_op->compute.tile[0] = nc;
+  fully_connected_op->compute.tile[1] = mc;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+static enum xnn_status setup_splitk_fully_connected_nc_f32(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const float* input,
+  float* output,
+  size_t kc,
+  size_t num_slices,
+  size_t num_threads)
+{
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const uint32_t mr = fully_connected_op->ukernel.gemm.mr;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+  const uint32_t kr = fully_connected_op->ukernel.gemm.kr;
+  const uint32_t sr = fully_connected_op->ukernel.gemm.sr;
+  const size_t k_stride = round_up_po2(input_channels, kr * sr);
+  const size_t n_stride = round_up(output_channels, nr);
+
+  const size_t zero_size = round_up_po2(mr * nr * sizeof(float), XNN_ALLOCATION_ALIGNMENT);
+  const size_t partial_m_stride = n_stride * sizeof(float);
+  const size_t partial_slice_stride = batch_size * partial_m_stride;
+  const size_t workspace_size = zero_size + num_slices * partial_slice_stride + XNN_EXTRA_BYTES;
+  if (workspace_size > fully_connected_op->workspace_size) {
+    xnn_release_simd_memory(fully_connected_op->workspace);
+    fully_connected_op->workspace_size = 0;
+    fully_connected_op->workspace = xnn_allocate_simd_memory(workspace_size);
+    if (fully_connected_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->workspace_size = workspace_size;
+  }
+  memset(fully_connected_op->workspace, 0, zero_size);
+
+  fully_connected_op->context.splitk_gemm = (struct splitk_gemm_context) {
+    .k_scaled = input_channels * sizeof(float),
+    .kc_scaled = kc * sizeof(float),
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .packed_w = packed_weights(fully_connected_op),
+    .w_stride = (k_stride + 1) * sizeof(float),
+    .w_bias_size = nr * sizeof(float),
+    .n = output_channels,
+    .num_slices = num_slices,
+    .partial = (void*) ((uintptr_t) fully_connected_op->workspace + zero_size),
+    .partial_slice_stride = partial_slice_stride,
+    .partial_m_stride = partial_m_stride,
+    .zero = fully_connected_op->workspace,
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .mr = mr,
+    .nr = nr,
+    .ukernel = fully_connected_op->ukernel.gemm.general_case.function[XNN_UARCH_DEFAULT],
+    .inc_ukernel = fully_connected_op->ukernel.gemm.inc_case,
+    .vadd_ukernel = xnn_params.f32.vadd.minmax.op_ukernel,
+    .params = fully_connected_op->params.f32_vadd_minmax,
+  };
+  xnn_params.f32.gemm.init.f32(&fully_connected_op->context.splitk_gemm.gemm_params, -INFINITY, INFINITY);
+  xnn_params.f32.vadd.init.f32_minmax(&fully_connected_op->context.splitk_gemm.acc_params, -INFINITY, INFINITY);
+
+  fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+  fully_connected_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_splitk_gemm;
+  fully_connected_op->compute.range[0] = num_slices;
+  fully_connected_op->compute.range[1] = batch_size;
+  fully_connected_op->compute.tile[0] = mr;
+
+  const size_t channel_tiles_per_batch = divide_round_up(num_threads, batch_size);
+  const size_t channel_tile = min(output_channels, round_up(divide_round_up(output_channels, channel_tiles_per_batch), nr));
+  fully_connected_op->compute2.type = xnn_parallelization_type_2d_tile_1d;
+  fully_connected_op->compute2.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_splitk_reduce;
+  fully_connected_op->compute2.range[0] = batch_size;
+  fully_connected_op->compute2.range[1] = output_channels;
+  fully_connected_op->compute2.tile[0] = channel_tile;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+static enum xnn_status setup_splitk_fully_connected_nc_qs8(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const int8_t* input,
+  int8_t* output,
+  size_t kc,
+  size_t num_slices,
+  size_t num_threads)
+{
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+  const uint32_t mr = fully_connected_op->ukernel.gemm.mr;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+  const uint32_t kr = fully_connected_op->ukernel.gemm.kr;
+  const uint32_t sr = fully_connected_op->ukernel.gemm.sr;
+  const size_t k_stride = round_up_po2(input_channels, kr * sr);
+  const size_t n_stride = round_up(output_channels, nr);
+
+  const size_t partial_m_stride = n_stride * sizeof(int32_t);
+  const size_t partial_slice_stride = batch_size * partial_m_stride;
+  const size_t workspace_size = num_slices * partial_slice_stride + XNN_EXTRA_BYTES;
+  if (workspace_size > fully_connected_op->workspace_size) {
+    xnn_release_simd_memory(fully_connected_op->workspace);
+    fully_connected_op->workspace_size = 0;
+    fully_connected_op->workspace = xnn_allocate_simd_memory(workspace_size);
+    if (fully_connected_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->workspace_size = workspace_size;
+  }
+
+  // QC8 weights keep per-channel requantization scales after the bias and the weights of every NR-block.
+  const bool per_channel = fully_connected_op->type == xnn_operator_type_fully_connected_nc_qc8;
+  fully_connected_op->context.qs8_splitk_gemm = (struct qs8_splitk_gemm_context) {
+    .k = input_channels,
+    .kc = kc,
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(int8_t),
+    .packed_w = packed_weights(fully_connected_op),
+    .w_stride = fully_connected_op->weights_stride,
+    .w_scale_offset = per_channel ? nr * (sizeof(int32_t) + k_stride * sizeof(int8_t)) : 0,
+    .n = output_channels,
+    .num_slices = num_slices,
+    .partial = fully_connected_op->workspace,
+    .partial_slice_stride = partial_slice_stride,
+    .partial_m_stride = partial_m_stride,
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(int8_t),
+    .nr = nr,
+    .ukernel = fully_connected_op->ukernel.gemm.acc32_case,
+    .params = per_channel ?
+      fully_connected_op->params.qc8_splitk_minmax : fully_connected_op->params.qs8_splitk_minmax,
+  };
+
+  fully_connected_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+  fully_connected_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_qs8_splitk_gemm;
+  fully_connected_op->compute.range[0] = num_slices;
+  fully_connected_op->compute.range[1] = batch_size;
+  fully_connected_op->compute.tile[0] = mr;
+
+  const size_t channel_tiles_per_batch = divide_round_up(num_threads, batch_size);
+  const size_t channel_tile = min(output_channels, round_up(divide_round_up(output_channels, channel_tiles_per_batch), nr));
+  fully_connected_op->compute2.type = xnn_parallelization_type_2d_tile_1d;
+  fully_connected_op->compute2.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_qs8_splitk_reduce;
+  fully_connected_op->compute2.range[0] = batch_size;
+  fully_connected_op->compute2.range[1] = output_channels;
+  fully_connected_op->compute2.tile[0] = channel_tile;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
 static enum xnn_status setup_fully_connected_nc(
   xnn_operator_t fully_connected_op,
   size_t batch_size,
@@ -186,8 +453,6 @@ static enum xnn_status setup_fully_connected_nc(
   void* output,
   uint32_t datatype_init_flags,
   uint32_t log2_input_element_size,
-  uint32_t log2_filter_element_size,
-  uint32_t bias_element_size,
   uint32_t log2_output_element_size,
   const void* params,
   size_t params_size,
@@ -201,6 +466,8 @@ static enum xnn_status setup_fully_connected_nc(
     return xnn_status_uninitialized;
   }
 
+  fully_connected_op->compute2.type = xnn_parallelization_type_invalid;
+
   if (batch_size == 0) {
     fully_connected_op->state = xnn_run_state_skip;
     return xnn_status_success;
@@ -221,6 +488,49 @@ static enum xnn_status setup_fully_connected_nc(
   uint32_t mr = fully_connected_op->ukernel.gemm.mr;
   const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
 
+  // Use the split-K path when the output is too small to be split into a tile per thread: every thread computes a
+  // partial product over a slice of the reduction dimension, and partial products are added up in a second pass.
+  // Floating-point GEMM accumulates partial products with the inc_case micro-kernel, quantized GEMM computes 32-bit
+  // partial products with the acc32_case micro-kernel and requantizes their sum in the second pass.
+  if ((fully_connected_op->ukernel.gemm.inc_case != NULL || fully_connected_op->ukernel.gemm.acc32_case != NULL) &&
+      num_threads > 1)
+  {
+    const size_t num_tiles = divide_round_up(batch_size, mr) * divide_round_up(output_channels, nr);
+    if (num_tiles < num_threads) {
+      const uint32_t kr = fully_connected_op->ukernel.gemm.kr;
+      const uint32_t sr = fully_connected_op->ukernel.gemm.sr;
+      const size_t min_kc = 256;
+      const size_t target_slices = divide_round_up(num_threads, num_tiles);
+      const size_t kc = round_up_po2(max(divide_round_up(input_channels, target_slices), min_kc), kr * sr);
+      const size_t num_slices = divide_round_up(input_channels, kc);
+      if (num_slices > 1) {
+        if (fully_connected_op->ukernel.gemm.acc32_case != NULL) {
+          return setup_splitk_fully_connected_nc_qs8(
+            fully_connected_op, batch_size, input, output, kc, num_slices, num_threads);
+        }
+        return setup_splitk_fully_connected_nc_f32(
+          fully_connected_op, batch_size, input, output, kc, num_slices, num_threads);
+      }
+    }
+  }
+
+  // Use the cache-blocked GEMM path when packed weights do not fit into L2 cache and the batch is large enough to reuse
+  // them: the reduction dimension is split into KC-blocks so that weight panels stay in L1 across MR-blocks of the batch.
+  if (fully_connected_op->ukernel.gemm.inc_case != NULL && batch_size >= 2 * mr &&
+      xnn_params.l1d_cache_size != 0 && xnn_params.l2_cache_size != 0)
+  {
+    const uint32_t kr = fully_connected_op->ukernel.gemm.kr;
+    const uint32_t sr = fully_connected_op->ukernel.gemm.sr;
+    const size_t packed_weights_size = round_up(output_channels, nr) * fully_connected_op->weights_stride;
+    // KC-block: an MR x KC block of the input and a KC x NR panel of weights fill a half of L1 cache.
+    const size_t kc = round_down_po2(
+      xnn_params.l1d_cache_size / 2 / ((mr + nr) << log2_input_element_size), kr * sr);
+    if (packed_weights_size > xnn_params.l2_cache_size && kc != 0 && kc < input_channels) {
+      return setup_blocked_fully_connected_nc_f32(
+        fully_connected_op, batch_size, input, output, kc, num_threads);
+    }
+  }
+
   struct xnn_hmp_gemm_ukernel gemm_ukernel = fully_connected_op->ukernel.gemm.general_case;
   if (batch_size == 1 && fully_connected_op->ukernel.gemm.mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
     gemm_ukernel = fully_connected_op->ukernel.gemm.mr1_case;
@@ -229,7 +539,7 @@ static enum xnn_status setup_fully_connected_nc(
 
   fully_connected_op->context.gemm = (struct gemm_context) {
     .k_scaled = input_channels << log2_input_element_size,
-    .w_stride = (round_up_po2(input_channels, fully_connected_op->ukernel.gemm.kr) << log2_input_element_size) + bias_element_size,
+    .w_stride = fully_connected_op->weights_stride,
     .a = input,
     .a_stride = fully_connected_op->input_pixel_stride << log2_input_element_size,
     .packed_w = packed_weights(fully_connected_op),
@@ -271,6 +581,133 @@ static enum xnn_status setup_fully_connected_nc(
   return xnn_status_success;
 }
 
+static enum xnn_status setup_dq_fully_connected_nc(
+  xnn_operator_t fully_connected_op,
+  size_t batch_size,
+  const void* input,
+  float* output,
+  const void* params,
+  size_t params_size,
+  size_t num_threads)
+{
+  fully_connected_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  fully_connected_op->compute2.type = xnn_parallelization_type_invalid;
+
+  if (batch_size == 0) {
+    fully_connected_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  fully_connected_op->batch_size = 1;
+  fully_connected_op->input_height = batch_size;
+  fully_connected_op->input_width = 1;
+  fully_connected_op->input = input;
+
+  fully_connected_op->output_height = batch_size;
+  fully_connected_op->output_width = 1;
+  fully_connected_op->output = output;
+
+  const size_t input_channels = fully_connected_op->group_input_channels;
+  const size_t output_channels = fully_connected_op->group_output_channels;
+
+  uint32_t mr = fully_connected_op->ukernel.gemm.mr;
+  const uint32_t nr = fully_connected_op->ukernel.gemm.nr;
+
+  struct xnn_hmp_dqgemm_ukernel dqgemm_ukernel = fully_connected_op->ukernel.gemm.dq_general_case;
+  if (batch_size == 1 && fully_connected_op->ukernel.gemm.dq_mr1_case.function[XNN_UARCH_DEFAULT] != NULL) {
+    dqgemm_ukernel = fully_connected_op->ukernel.gemm.dq_mr1_case;
+    mr = 1;
+  }
+
+  // Workspace holds the quantization parameters of the input rows, followed by the quantized input rows. Quantization
+  // parameters are padded to a multiple of MR, as micro-kernels load them for all MR rows of a tile.
+  // Inputs of the QS8-F32-QC8W operator are already quantized with static parameters, and are read in-place.
+  const bool quantized_input = fully_connected_op->type == xnn_operator_type_fully_connected_nc_qs8_f32_qc8w;
+  const size_t quantization_params_size =
+    round_up_po2(round_up(batch_size, mr) * sizeof(struct xnn_qd8_quantization_params), XNN_ALLOCATION_ALIGNMENT);
+  const size_t qa_stride = quantized_input ?
+    fully_connected_op->input_pixel_stride * sizeof(int8_t) : input_channels * sizeof(int8_t);
+  const size_t workspace_size =
+    quantization_params_size + (quantized_input ? 0 : batch_size * qa_stride) + XNN_EXTRA_BYTES;
+  if (workspace_size > fully_connected_op->workspace_size) {
+    xnn_release_simd_memory(fully_connected_op->workspace);
+    fully_connected_op->workspace_size = 0;
+    fully_connected_op->workspace = xnn_allocate_zero_simd_memory(workspace_size);
+    if (fully_connected_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(fully_connected_op->type));
+      return xnn_status_out_of_memory;
+    }
+    fully_connected_op->workspace_size = workspace_size;
+  }
+
+  fully_connected_op->context.dqgemm = (struct dqgemm_context) {
+    .k_scaled = input_channels * sizeof(int8_t),
+    .a = input,
+    .a_stride = fully_connected_op->input_pixel_stride * sizeof(float),
+    .qa = quantized_input ?
+      (void*) input : (void*) ((uintptr_t) fully_connected_op->workspace + quantization_params_size),
+    .qa_stride = qa_stride,
+    .quantization_params = (struct xnn_qd8_quantization_params*) fully_connected_op->workspace,
+    .packed_w = packed_weights(fully_connected_op),
+    .w_stride = fully_connected_op->weights_stride,
+    .c = output,
+    .cm_stride = fully_connected_op->output_pixel_stride * sizeof(float),
+    .cn_stride = nr * sizeof(float),
+    .ukernel = dqgemm_ukernel.function[XNN_UARCH_DEFAULT],
+    .rminmax_ukernel = xnn_params.f32.rminmax,
+    .convert_ukernel = xnn_params.vcvt.f32_to_qs8.ukernel,
+    .init_convert_params = xnn_params.vcvt.f32_to_qs8.init.f32_qs8_cvt,
+  };
+  memcpy(&fully_connected_op->context.dqgemm.params, params, params_size);
+
+  struct compute_parameters* gemm_compute = &fully_connected_op->compute2;
+  if (quantized_input) {
+    // All rows share the static quantization parameters of the input, and the weights are multiplied in a single pass.
+    struct xnn_qd8_quantization_params* quantization_params = fully_connected_op->context.dqgemm.quantization_params;
+    for (size_t i = 0; i < round_up(batch_size, mr); i++) {
+      quantization_params[i] = (struct xnn_qd8_quantization_params) {
+        .zero_point = fully_connected_op->input_zero_point,
+        .scale = fully_connected_op->input_scale,
+      };
+    }
+    gemm_compute = &fully_connected_op->compute;
+  } else {
+    // The first pass computes quantization parameters of every input row and quantizes it, the second pass multiplies
+    // quantized rows by the weights.
+    fully_connected_op->compute.type = xnn_parallelization_type_1d;
+    fully_connected_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_f32_qd8_convert;
+    fully_connected_op->compute.range[0] = batch_size;
+  }
+
+  size_t nc = output_channels;
+  if (num_threads > 1) {
+    const size_t num_other_tiles = divide_round_up(batch_size, mr);
+    const size_t target_tiles_per_thread = 5;
+    const size_t max_nc = divide_round_up(output_channels * num_other_tiles, num_threads * target_tiles_per_thread);
+    if (max_nc < nc) {
+      nc = min(nc, divide_round_up(nc, max_nc * nr) * nr);
+    }
+  }
+  gemm_compute->type = xnn_parallelization_type_2d_tile_2d;
+  gemm_compute->task_2d_tile_2d = (pthreadpool_task_2d_tile_2d_t) xnn_compute_dqgemm;
+  gemm_compute->range[0] = batch_size;
+  gemm_compute->range[1] = output_channels;
+  gemm_compute->tile[0] = mr;
+  gemm_compute->tile[1] = nc;
+  fully_connected_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
 enum xnn_status xnn_create_fully_connected_nc_qu8(
     size_t input_channels,
     size_t output_channels,
@@ -341,13 +778,15 @@ enum xnn_status xnn_create_fully_connected_nc_qu8(
     input_channels, output_channels,
     input_stride, output_stride,
     kernel, bias, flags,
-    0 /* log2(sizeof(filter element)) = log2(sizeof(uint8_t)) */,
+    3 /* log2(filter element bits) = log2(8 * sizeof(uint8_t)) */,
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qu8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qu8_gemm_goi_w,
     &packing_params, kernel_zero_point /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */, NULL /* float bias */,
     &params, sizeof(params),
     &xnn_params.qu8.gemm, &xnn_params.qu8.gemm.minmax,
+    NULL /* gemminc ukernel */,
     XNN_INIT_FLAG_QU8,
     xnn_operator_type_fully_connected_nc_qu8,
     caches,
@@ -417,143 +856,661 @@ enum xnn_status xnn_create_fully_connected_nc_qs8(
   const struct xnn_qs8_packing_params packing_params = {
     .input_zero_point = input_zero_point,
   };
-  return create_fully_connected_nc(
+  const enum xnn_status status = create_fully_connected_nc(
     input_channels, output_channels,
     input_stride, output_stride,
     kernel, bias, flags,
-    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
+    3 /* log2(filter element bits) = log2(8 * sizeof(int8_t)) */,
     sizeof(int32_t) /* sizeof(bias element) */,
     (xnn_pack_gemm_io_w_function) xnn_pack_qs8_gemm_io_w,
     (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
     &packing_params, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */, NULL /* float bias */,
     &params, sizeof(params),
     &xnn_params.qs8.gemm, &xnn_params.qs8.gemm.minmax,
+    NULL /* gemminc ukernel */,
     XNN_INIT_FLAG_QS8,
     xnn_operator_type_fully_connected_nc_qs8,
     caches,
     fully_connected_op_out);
+  if (status == xnn_status_success && xnn_params.qs8.gemm_acc32 != NULL) {
+    (*fully_connected_op_out)->ukernel.gemm.acc32_case = xnn_params.qs8.gemm_acc32;
+    xnn_init_qs8_conv_minmax_fp32_scalar_lrintf_params(
+      &(*fully_connected_op_out)->params.qs8_splitk_minmax, requantization_scale,
+      output_zero_point, output_min, output_max);
+  }
+  return status;
 }
 
-enum xnn_status xnn_create_fully_connected_nc_f32(
+enum xnn_status xnn_create_fully_connected_nc_qc8(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
     size_t output_stride,
-    const float* kernel,
-    const float* bias,
-    float output_min,
-    float output_max,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const int32_t* bias,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
     uint32_t flags,
     xnn_caches_t caches,
     xnn_operator_t* fully_connected_op_out)
 {
-  if (isnan(output_min)) {
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
     xnn_log_error(
-      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
-      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32));
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), input_scale);
     return xnn_status_invalid_parameter;
   }
 
-  if (isnan(output_max)) {
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), kernel_scale[output_channel],
+        output_channel);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
     xnn_log_error(
-      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
-      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32));
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), output_scale);
     return xnn_status_invalid_parameter;
   }
 
   if (output_min >= output_max) {
     xnn_log_error(
-      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
-      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32), output_min, output_max);
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8), output_min, output_max);
     return xnn_status_invalid_parameter;
   }
 
-  const struct gemm_fused_ukernels* gemm_ukernels = &xnn_params.f32.gemm.minmax;
-  const bool linear_activation = (output_max == INFINITY) && (output_min == -output_max);
-  if (linear_activation && xnn_params.f32.gemm.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
-    gemm_ukernels = &xnn_params.f32.gemm.linear;
+  float* requantization_scale = XNN_SIMD_ALLOCA(output_channels * sizeof(float));
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    requantization_scale[output_channel] = input_scale * kernel_scale[output_channel] / output_scale;
+    if (requantization_scale[output_channel] >= 256.0f) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g input scale, %.7g kernel scale, and %.7g output scale in output channel #%zu: "
+        "requantization scale %.7g is greater or equal to 256.0",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8),
+        input_scale, kernel_scale[output_channel], output_scale,
+        output_channel, requantization_scale[output_channel]);
+      return xnn_status_unsupported_parameter;
+    }
   }
 
-  union xnn_f32_minmax_params params;
-  if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
-    xnn_params.f32.gemm.init.f32(&params, output_min, output_max);
+  union xnn_qs8_minmax_params params;
+  if XNN_LIKELY(xnn_params.qc8.gemm.init.qc8 != NULL) {
+    xnn_params.qc8.gemm.init.qc8(&params, output_zero_point, output_min, output_max);
   }
-  return create_fully_connected_nc(
+  const struct xnn_qs8_packing_params packing_params = {
+    .input_zero_point = input_zero_point,
+  };
+  const enum xnn_status status = create_fully_connected_nc(
     input_channels, output_channels,
     input_stride, output_stride,
     kernel, bias, flags,
-    2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
-    sizeof(float) /* sizeof(bias element) */,
-    (xnn_pack_gemm_io_w_function) xnn_pack_f32_gemm_io_w,
-    (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
-    NULL /* packing params */, 0 /* packed weights padding byte */,
+    3 /* log2(filter element bits) = log2(8 * sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(bias element) */,
+    (xnn_pack_gemm_io_w_function) xnn_pack_qs8_gemm_io_w,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
+    &packing_params, 0 /* packed weights padding byte */,
+    sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, requantization_scale,
+    NULL /* float bias */,
     &params, sizeof(params),
-    &xnn_params.f32.gemm, gemm_ukernels,
-    XNN_INIT_FLAG_F32,
-    xnn_operator_type_fully_connected_nc_f32,
+    &xnn_params.qc8.gemm, &xnn_params.qc8.gemm.minmax,
+    NULL /* gemminc ukernel */,
+    XNN_INIT_FLAG_QC8,
+    xnn_operator_type_fully_connected_nc_qc8,
     caches,
     fully_connected_op_out);
+  if (status == xnn_status_success && xnn_params.qc8.gemm_acc32 != NULL) {
+    (*fully_connected_op_out)->ukernel.gemm.acc32_case = xnn_params.qc8.gemm_acc32;
+    // Per-channel requantization scales are read from the packed weights.
+    xnn_init_qs8_conv_minmax_fp32_scalar_lrintf_params(
+      &(*fully_connected_op_out)->params.qc8_splitk_minmax, 1.0f, output_zero_point, output_min, output_max);
+  }
+  return status;
 }
 
-enum xnn_status xnn_create_fully_connected_nc_f16(
+static enum xnn_status create_fully_connected_nc_f32_qc8w(
     size_t input_channels,
     size_t output_channels,
     size_t input_stride,
     size_t output_stride,
-    const void* kernel,
-    const void* bias,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const float* bias,
     float output_min,
     float output_max,
     uint32_t flags,
+    enum xnn_operator_type operator_type,
     xnn_caches_t caches,
     xnn_operator_t* fully_connected_op_out)
 {
   if (isnan(output_min)) {
     xnn_log_error(
       "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
-      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f16));
+      xnn_operator_type_to_string(operator_type));
     return xnn_status_invalid_parameter;
   }
 
   if (isnan(output_max)) {
     xnn_log_error(
       "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
-      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f16));
+      xnn_operator_type_to_string(operator_type));
     return xnn_status_invalid_parameter;
   }
 
-  const uint16_t fp16_output_min = fp16_ieee_from_fp32_value(output_min);
-  const uint16_t fp16_output_max = fp16_ieee_from_fp32_value(output_max);
-  const float rounded_output_min = fp16_ieee_to_fp32_value(fp16_output_min);
-  const float rounded_output_max = fp16_ieee_to_fp32_value(fp16_output_max);
-  if (rounded_output_min >= rounded_output_max) {
+  if (output_min >= output_max) {
     xnn_log_error(
       "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
-      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f16), rounded_output_min, rounded_output_max);
+      xnn_operator_type_to_string(operator_type), output_min, output_max);
     return xnn_status_invalid_parameter;
   }
 
-  union xnn_f16_minmax_params params;
-  if XNN_LIKELY(xnn_params.f16.gemm.init.f16 != NULL) {
-    xnn_params.f16.gemm.init.f16(&params, fp16_output_min, fp16_output_max);
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(operator_type), kernel_scale[output_channel],
+        output_channel);
+      return xnn_status_invalid_parameter;
+    }
   }
-  xnn_pack_gemm_io_w_function pack_gemm_io_w = (xnn_pack_gemm_io_w_function) xnn_pack_f16_gemm_io_w;
-  xnn_pack_gemm_goi_w_function pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_f16_gemm_goi_w;
-  if (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) {
-    pack_gemm_io_w = (xnn_pack_gemm_io_w_function) xnn_pack_f32_to_f16_gemm_io_w;
-    pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_f32_to_f16_gemm_goi_w;
+
+  union xnn_f32_minmax_params params;
+  if XNN_LIKELY(xnn_params.qd8_f32_qc8w.gemm.init.f32 != NULL) {
+    xnn_params.qd8_f32_qc8w.gemm.init.f32(&params, output_min, output_max);
   }
+  // Inputs are quantized with a unit zero point when packing: the packed "bias" becomes the negated sum of the weights
+  // in every output channel, and micro-kernels scale it by the actual zero point of each row.
+  const struct xnn_qs8_packing_params packing_params = {
+    .input_zero_point = 1,
+  };
   return create_fully_connected_nc(
     input_channels, output_channels,
     input_stride, output_stride,
-    kernel, bias, flags,
-    1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
-    sizeof(uint16_t) /* sizeof(bias element) */,
-    pack_gemm_io_w,
-    pack_gemm_goi_w,
-    NULL /* packing params */, 0 /* packed weights padding byte */,
-    &params, sizeof(params),
-    &xnn_params.f16.gemm, &xnn_params.f16.gemm.minmax,
+    kernel, NULL /* bias */, flags,
+    3 /* log2(filter element bits) = log2(8 * sizeof(int8_t)) */,
+    sizeof(int32_t) /* sizeof(bias element) */,
+    (xnn_pack_gemm_io_w_function) xnn_pack_qs8_gemm_io_w,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_gemm_goi_w,
+    &packing_params, 0 /* packed weights padding byte */,
+    2 * sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, kernel_scale, bias,
+    &params, sizeof(params),
+    &xnn_params.qd8_f32_qc8w.gemm, &xnn_params.qd8_f32_qc8w.gemm.minmax,
+    NULL /* gemminc ukernel */,
+    XNN_INIT_FLAG_F32 | XNN_INIT_FLAG_QC8 | XNN_INIT_FLAG_VCVT,
+    operator_type,
+    caches,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc8w(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  return create_fully_connected_nc_f32_qc8w(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel_scale, kernel, bias,
+    output_min, output_max,
+    flags,
+    xnn_operator_type_fully_connected_nc_qd8_f32_qc8w,
+    caches,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qs8_f32_qc8w(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    const float* kernel_scale,
+    const int8_t* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qs8_f32_qc8w), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  const enum xnn_status status = create_fully_connected_nc_f32_qc8w(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel_scale, kernel, bias,
+    output_min, output_max,
+    flags,
+    xnn_operator_type_fully_connected_nc_qs8_f32_qc8w,
+    caches,
+    fully_connected_op_out);
+  if (status == xnn_status_success) {
+    (*fully_connected_op_out)->input_zero_point = (int32_t) input_zero_point;
+    (*fully_connected_op_out)->input_scale = input_scale;
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_qd8_f32_qc4w(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint8_t kernel_zero_point,
+    const float* kernel_scale,
+    const void* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc4w));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc4w));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc4w), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (kernel_zero_point > 15) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu8 " kernel zero point: kernel zero point must be in [0, 15] range",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc4w), kernel_zero_point);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc4w), kernel_scale[output_channel],
+        output_channel);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    xnn_log_error(
+      "failed to create %s operator with XNN_FLAG_TRANSPOSE_WEIGHTS: 4-bit weights must be in OI layout",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc4w));
+    return xnn_status_unsupported_parameter;
+  }
+
+  union xnn_f32_qc4w_minmax_params params;
+  if XNN_LIKELY(xnn_params.qd8_f32_qc4w.gemm.init.f32_qc4w != NULL) {
+    xnn_params.qd8_f32_qc4w.gemm.init.f32_qc4w(&params, output_min, output_max, kernel_zero_point);
+  }
+  // As with 8-bit weights, inputs are quantized with a unit zero point when packing.
+  const struct xnn_qs8_qc4w_packing_params packing_params = {
+    .input_zero_point = 1,
+    .kernel_zero_point = kernel_zero_point,
+  };
+  return create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, NULL /* bias */, flags,
+    2 /* log2(filter element bits) = log2(4) */,
+    sizeof(int32_t) /* sizeof(bias element) */,
+    NULL /* pack_gemm_io_w */,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_qs8_qc4w_gemm_goi_w,
+    &packing_params, kernel_zero_point * 0x11 /* packed weights padding byte */,
+    2 * sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, kernel_scale, bias,
+    &params, sizeof(params),
+    &xnn_params.qd8_f32_qc4w.gemm, &xnn_params.qd8_f32_qc4w.gemm.minmax,
+    NULL /* gemminc ukernel */,
+    XNN_INIT_FLAG_F32 | XNN_INIT_FLAG_QC8 | XNN_INIT_FLAG_VCVT,
+    xnn_operator_type_fully_connected_nc_qd8_f32_qc4w,
+    caches,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const float* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct gemm_fused_ukernels* gemm_ukernels = &xnn_params.f32.gemm.minmax;
+  const bool linear_activation = (output_max == INFINITY) && (output_min == -output_max);
+  if (linear_activation && xnn_params.f32.gemm.linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    gemm_ukernels = &xnn_params.f32.gemm.linear;
+  }
+
+  if ((flags & XNN_FLAG_FP16_STATIC_WEIGHTS) && xnn_params.f32.gemm_f16w.minmax.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    union xnn_f32_minmax_params params;
+    xnn_params.f32.gemm_f16w.init.f32(&params, output_min, output_max);
+    return create_fully_connected_nc(
+      input_channels, output_channels,
+      input_stride, output_stride,
+      kernel, bias, flags,
+      4 /* log2(filter element bits) = log2(8 * sizeof(uint16_t)) */,
+      sizeof(uint16_t) /* sizeof(bias element) */,
+      (xnn_pack_gemm_io_w_function) xnn_pack_f32_to_f16_gemm_io_w,
+      (xnn_pack_gemm_goi_w_function) xnn_pack_f32_to_f16_gemm_goi_w,
+      NULL /* packing params */, 0 /* packed weights padding byte */,
+      0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */, NULL /* float bias */,
+      &params, sizeof(params),
+      &xnn_params.f32.gemm_f16w, &xnn_params.f32.gemm_f16w.minmax,
+      NULL /* gemminc ukernel */,
+      XNN_INIT_FLAG_F32,
+      xnn_operator_type_fully_connected_nc_f32,
+      caches,
+      fully_connected_op_out);
+  }
+
+  union xnn_f32_minmax_params params;
+  if XNN_LIKELY(xnn_params.f32.gemm.init.f32 != NULL) {
+    xnn_params.f32.gemm.init.f32(&params, output_min, output_max);
+  }
+  const enum xnn_status status = create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, bias, flags & ~XNN_FLAG_FP16_STATIC_WEIGHTS,
+    5 /* log2(filter element bits) = log2(8 * sizeof(float)) */,
+    sizeof(float) /* sizeof(bias element) */,
+    (xnn_pack_gemm_io_w_function) xnn_pack_f32_gemm_io_w,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
+    NULL /* packing params */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */, NULL /* float bias */,
+    &params, sizeof(params),
+    &xnn_params.f32.gemm, gemm_ukernels,
+    xnn_params.f32.gemminc,
+    XNN_INIT_FLAG_F32,
+    xnn_operator_type_fully_connected_nc_f32,
+    caches,
+    fully_connected_op_out);
+  if (status == xnn_status_success && xnn_params.f32.vadd.init.f32_minmax != NULL) {
+    xnn_params.f32.vadd.init.f32_minmax(&(*fully_connected_op_out)->params.f32_vadd_minmax, output_min, output_max);
+  }
+  return status;
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f32_qc4w(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint8_t kernel_zero_point,
+    const float* kernel_scale,
+    const void* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32_qc4w));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32_qc4w));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32_qc4w), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (kernel_zero_point > 15) {
+    xnn_log_error(
+      "failed to create %s operator with %" PRIu8 " kernel zero point: kernel zero point must be in [0, 15] range",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32_qc4w), kernel_zero_point);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t output_channel = 0; output_channel < output_channels; output_channel++) {
+    if (kernel_scale[output_channel] <= 0.0f || !isnormal(kernel_scale[output_channel])) {
+      xnn_log_error(
+        "failed to create %s operator with %.7g kernel scale in output channel #%zu: "
+        "scale must be finite, normalized, and positive",
+        xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32_qc4w), kernel_scale[output_channel],
+        output_channel);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+    xnn_log_error(
+      "failed to create %s operator with XNN_FLAG_TRANSPOSE_WEIGHTS: 4-bit weights must be in OI layout",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32_qc4w));
+    return xnn_status_unsupported_parameter;
+  }
+
+  union xnn_f32_qc4w_minmax_params params;
+  if XNN_LIKELY(xnn_params.f32.gemm_qc4w.init.f32_qc4w != NULL) {
+    xnn_params.f32.gemm_qc4w.init.f32_qc4w(&params, output_min, output_max, kernel_zero_point);
+  }
+  const struct xnn_qs8_qc4w_packing_params packing_params = {
+    .input_zero_point = 0,
+    .kernel_zero_point = kernel_zero_point,
+  };
+  return create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, NULL /* bias */, flags,
+    2 /* log2(filter element bits) = log2(4) */,
+    0 /* sizeof(bias element) */,
+    NULL /* pack_gemm_io_w */,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_f32_qc4w_gemm_goi_w,
+    &packing_params, kernel_zero_point * 0x11 /* packed weights padding byte */,
+    2 * sizeof(float) /* extra weights bytes */, xnn_init_qc8_scale_fp32_params, kernel_scale, bias,
+    &params, sizeof(params),
+    &xnn_params.f32.gemm_qc4w, &xnn_params.f32.gemm_qc4w.minmax,
+    NULL /* gemminc ukernel */,
+    XNN_INIT_FLAG_F32,
+    xnn_operator_type_fully_connected_nc_f32_qc4w,
+    caches,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_bf16(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const void* kernel,
+    const float* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16));
+    return xnn_status_invalid_parameter;
+  }
+
+  const float rounded_output_min = math_cvt_fp32_bf16(math_cvt_bf16_fp32(output_min));
+  const float rounded_output_max = math_cvt_fp32_bf16(math_cvt_bf16_fp32(output_max));
+  if (rounded_output_min >= rounded_output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16), rounded_output_min, rounded_output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_f32_minmax_params params;
+  if XNN_LIKELY(xnn_params.bf16.gemm.init.f32 != NULL) {
+    xnn_params.bf16.gemm.init.f32(&params, rounded_output_min, rounded_output_max);
+  }
+  xnn_pack_gemm_io_w_function pack_gemm_io_w = (xnn_pack_gemm_io_w_function) xnn_pack_bf16_gemm_io_w;
+  xnn_pack_gemm_goi_w_function pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_bf16_gemm_goi_w;
+  if (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) {
+    pack_gemm_io_w = (xnn_pack_gemm_io_w_function) xnn_pack_f32_to_bf16_gemm_io_w;
+    pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_f32_to_bf16_gemm_goi_w;
+  }
+  return create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, bias, flags,
+    4 /* log2(filter element bits) = log2(8 * sizeof(uint16_t)) */,
+    sizeof(float) /* sizeof(bias element) */,
+    pack_gemm_io_w,
+    pack_gemm_goi_w,
+    NULL /* packing params */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */, NULL /* float bias */,
+    &params, sizeof(params),
+    &xnn_params.bf16.gemm, &xnn_params.bf16.gemm.minmax,
+    NULL /* gemminc ukernel */,
+    XNN_INIT_FLAG_BF16,
+    xnn_operator_type_fully_connected_nc_bf16,
+    caches,
+    fully_connected_op_out);
+}
+
+enum xnn_status xnn_create_fully_connected_nc_f16(
+    size_t input_channels,
+    size_t output_channels,
+    size_t input_stride,
+    size_t output_stride,
+    const void* kernel,
+    const void* bias,
+    float output_min,
+    float output_max,
+    uint32_t flags,
+    xnn_caches_t caches,
+    xnn_operator_t* fully_connected_op_out)
+{
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f16));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to create %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f16));
+    return xnn_status_invalid_parameter;
+  }
+
+  const uint16_t fp16_output_min = fp16_ieee_from_fp32_value(output_min);
+  const uint16_t fp16_output_max = fp16_ieee_from_fp32_value(output_max);
+  const float rounded_output_min = fp16_ieee_to_fp32_value(fp16_output_min);
+  const float rounded_output_max = fp16_ieee_to_fp32_value(fp16_output_max);
+  if (rounded_output_min >= rounded_output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f16), rounded_output_min, rounded_output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_f16_minmax_params params;
+  if XNN_LIKELY(xnn_params.f16.gemm.init.f16 != NULL) {
+    xnn_params.f16.gemm.init.f16(&params, fp16_output_min, fp16_output_max);
+  }
+  xnn_pack_gemm_io_w_function pack_gemm_io_w = (xnn_pack_gemm_io_w_function) xnn_pack_f16_gemm_io_w;
+  xnn_pack_gemm_goi_w_function pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_f16_gemm_goi_w;
+  if (flags & XNN_FLAG_FP32_STATIC_WEIGHTS) {
+    pack_gemm_io_w = (xnn_pack_gemm_io_w_function) xnn_pack_f32_to_f16_gemm_io_w;
+    pack_gemm_goi_w = (xnn_pack_gemm_goi_w_function) xnn_pack_f32_to_f16_gemm_goi_w;
+  }
+  return create_fully_connected_nc(
+    input_channels, output_channels,
+    input_stride, output_stride,
+    kernel, bias, flags,
+    4 /* log2(filter element bits) = log2(8 * sizeof(uint16_t)) */,
+    sizeof(uint16_t) /* sizeof(bias element) */,
+    pack_gemm_io_w,
+    pack_gemm_goi_w,
+    NULL /* packing params */, 0 /* packed weights padding byte */,
+    0 /* extra weights bytes */, NULL /* init scale params */, NULL /* scale params */, NULL /* float bias */,
+    &params, sizeof(params),
+    &xnn_params.f16.gemm, &xnn_params.f16.gemm.minmax,
+    NULL /* gemminc ukernel */,
     XNN_INIT_FLAG_F16,
     xnn_operator_type_fully_connected_nc_f16,
     caches,
@@ -580,8 +1537,6 @@ enum xnn_status xnn_setup_fully_connected_nc_qu8(
     input, output,
     XNN_INIT_FLAG_QU8,
     0 /* log2(sizeof(input element)) = log2(sizeof(uint8_t)) */,
-    0 /* log2(sizeof(filter element)) = log2(sizeof(uint8_t)) */,
-    sizeof(int32_t) /* sizeof(bias element) */,
     0 /* log2(sizeof(output element)) = log2(sizeof(uint8_t)) */,
     &fully_connected_op->params.qu8_conv_minmax,
     sizeof(fully_connected_op->params.qu8_conv_minmax),
@@ -608,14 +1563,107 @@ enum xnn_status xnn_setup_fully_connected_nc_qs8(
     input, output,
     XNN_INIT_FLAG_QS8,
     0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
-    0 /* log2(sizeof(filter element)) = log2(sizeof(int8_t)) */,
-    sizeof(int32_t) /* sizeof(bias element) */,
     0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
     &fully_connected_op->params.qs8_conv_minmax,
     sizeof(fully_connected_op->params.qs8_conv_minmax),
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_fully_connected_nc_qc8(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_qc8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qc8),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    XNN_INIT_FLAG_QC8,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    &fully_connected_op->params.qc8_minmax,
+    sizeof(fully_connected_op->params.qc8_minmax),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_qd8_f32_qc8w) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc8w),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_dq_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    &fully_connected_op->params.f32_minmax,
+    sizeof(fully_connected_op->params.f32_minmax),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_fully_connected_nc_qs8_f32_qc8w(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const int8_t* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_qs8_f32_qc8w) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qs8_f32_qc8w),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_dq_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    &fully_connected_op->params.f32_minmax,
+    sizeof(fully_connected_op->params.f32_minmax),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_fully_connected_nc_qd8_f32_qc4w(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_qd8_f32_qc4w) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_qd8_f32_qc4w),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_dq_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    &fully_connected_op->params.f32_qc4w_minmax,
+    sizeof(fully_connected_op->params.f32_qc4w_minmax),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_fully_connected_nc_f32(
     xnn_operator_t fully_connected_op,
     size_t batch_size,
@@ -636,14 +1684,64 @@ enum xnn_status xnn_setup_fully_connected_nc_f32(
     input, output,
     XNN_INIT_FLAG_F32,
     2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
-    2 /* log2(sizeof(filter element)) = log2(sizeof(float)) */,
-    sizeof(float) /* sizeof(bias element) */,
     2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
     &fully_connected_op->params.f32_minmax,
     sizeof(fully_connected_op->params.f32_minmax),
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_fully_connected_nc_f32_qc4w(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_f32_qc4w) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_f32_qc4w),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    XNN_INIT_FLAG_F32,
+    2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+    2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
+    &fully_connected_op->params.f32_qc4w_minmax,
+    sizeof(fully_connected_op->params.f32_qc4w_minmax),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_fully_connected_nc_bf16(
+    xnn_operator_t fully_connected_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (fully_connected_op->type != xnn_operator_type_fully_connected_nc_bf16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_fully_connected_nc_bf16),
+      xnn_operator_type_to_string(fully_connected_op->type));
+    return xnn_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(
+    fully_connected_op,
+    batch_size,
+    input, output,
+    XNN_INIT_FLAG_BF16,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
+    &fully_connected_op->params.f32_minmax,
+    sizeof(fully_connected_op->params.f32_minmax),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_fully_connected_nc_f16(
     xnn_operator_t fully_connected_op,
     size_t batch_size,
@@ -664,8 +1762,6 @@ enum xnn_status xnn_setup_fully_connected_nc_f16(
     input, output,
     XNN_INIT_FLAG_F32,
     1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
-    1 /* log2(sizeof(filter element)) = log2(sizeof(uint16_t)) */,
-    sizeof(uint16_t) /* sizeof(bias element) */,
     1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
     &fully_connected_op->params.f16_minmax,
     sizeof(fully_connected_op->params.f16_minmax),
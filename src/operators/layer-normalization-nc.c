@@ -0,0 +1,257 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_layer_normalization_nc(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const void* gamma,
+    const void* beta,
+    uint32_t flags,
+    uint32_t log2_element_size,
+    uint32_t datatype_init_flags,
+    const struct layernorm_parameters layernorm[restrict XNN_MIN_ELEMENTS(1)],
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* layer_normalization_op_out)
+{
+  xnn_operator_t layer_normalization_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags || layernorm->rmoments == NULL) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), channels);
+    goto error;
+  }
+
+  if (input_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(operator_type), input_stride, channels);
+    goto error;
+  }
+
+  if (output_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output element stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(operator_type), output_stride, channels);
+    goto error;
+  }
+
+  if (!(epsilon > 0.0f) || !isfinite(epsilon)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g epsilon: epsilon must be finite and positive",
+      xnn_operator_type_to_string(operator_type), epsilon);
+    goto error;
+  }
+
+  if (gamma == NULL || beta == NULL) {
+    xnn_log_error(
+      "failed to create %s operator: scale and offset tensors must be non-NULL",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  layer_normalization_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (layer_normalization_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  // Scale (gamma) and offset (beta) are stored back-to-back, followed by padding for the out-of-bounds reads of the
+  // micro-kernels.
+  const size_t packed_weights_size = (channels << (log2_element_size + 1)) + XNN_EXTRA_BYTES;
+  layer_normalization_op->packed_weights.pointer = xnn_allocate_simd_memory(packed_weights_size);
+  if (layer_normalization_op->packed_weights.pointer == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator packed weights",
+      packed_weights_size, xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  void* packed_gamma = layer_normalization_op->packed_weights.pointer;
+  void* packed_beta = (void*) ((uintptr_t) packed_gamma + (channels << log2_element_size));
+  if (log2_element_size == 1 && (flags & XNN_FLAG_FP32_STATIC_WEIGHTS)) {
+    for (size_t c = 0; c < channels; c++) {
+      ((uint16_t*) packed_gamma)[c] = fp16_ieee_from_fp32_value(((const float*) gamma)[c]);
+      ((uint16_t*) packed_beta)[c] = fp16_ieee_from_fp32_value(((const float*) beta)[c]);
+    }
+  } else {
+    memcpy(packed_gamma, gamma, channels << log2_element_size);
+    memcpy(packed_beta, beta, channels << log2_element_size);
+  }
+  memset((void*) ((uintptr_t) packed_beta + (channels << log2_element_size)), 0, XNN_EXTRA_BYTES);
+
+  layer_normalization_op->channels = channels;
+  layer_normalization_op->input_pixel_stride = input_stride;
+  layer_normalization_op->output_pixel_stride = output_stride;
+  layer_normalization_op->params.layernorm_epsilon = epsilon;
+
+  layer_normalization_op->type = operator_type;
+  layer_normalization_op->flags = flags;
+
+  layer_normalization_op->state = xnn_run_state_invalid;
+
+  *layer_normalization_op_out = layer_normalization_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(layer_normalization_op);
+  return status;
+}
+
+enum xnn_status xnn_create_layer_normalization_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const void* gamma,
+    const void* beta,
+    uint32_t flags,
+    xnn_operator_t* layer_normalization_op_out)
+{
+  return create_layer_normalization_nc(
+    channels, input_stride, output_stride, epsilon, gamma, beta, flags,
+    1 /* log2(sizeof(uint16_t)) */,
+    XNN_INIT_FLAG_F16, &xnn_params.f16.layernorm, xnn_operator_type_layer_normalization_nc_f16,
+    layer_normalization_op_out);
+}
+
+enum xnn_status xnn_create_layer_normalization_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float epsilon,
+    const float* gamma,
+    const float* beta,
+    uint32_t flags,
+    xnn_operator_t* layer_normalization_op_out)
+{
+  return create_layer_normalization_nc(
+    channels, input_stride, output_stride, epsilon, gamma, beta, flags,
+    2 /* log2(sizeof(float)) */,
+    XNN_INIT_FLAG_F32, &xnn_params.f32.layernorm, xnn_operator_type_layer_normalization_nc_f32,
+    layer_normalization_op_out);
+}
+
+static enum xnn_status setup_layer_normalization_nc(
+    xnn_operator_t layer_normalization_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    const struct layernorm_parameters layernorm[restrict XNN_MIN_ELEMENTS(1)])
+{
+  if (layer_normalization_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(layer_normalization_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  layer_normalization_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    layer_normalization_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  layer_normalization_op->batch_size = batch_size;
+  layer_normalization_op->input = input;
+  layer_normalization_op->output = output;
+
+  const size_t channels = layer_normalization_op->channels;
+  layer_normalization_op->context.layer_normalization = (struct layer_normalization_context) {
+    .n = channels << log2_element_size,
+    .x = input,
+    .x_stride = layer_normalization_op->input_pixel_stride << log2_element_size,
+    .gamma = layer_normalization_op->packed_weights.pointer,
+    .beta = (const void*) ((uintptr_t) layer_normalization_op->packed_weights.pointer + (channels << log2_element_size)),
+    .y = output,
+    .y_stride = layer_normalization_op->output_pixel_stride << log2_element_size,
+    .epsilon = layer_normalization_op->params.layernorm_epsilon,
+    .rmoments_ukernel = layernorm->rmoments,
+    .vlayernorm_ukernel = layernorm->vlayernorm,
+  };
+  layer_normalization_op->compute.type = xnn_parallelization_type_1d;
+  layer_normalization_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_layer_normalization;
+  layer_normalization_op->compute.range[0] = batch_size;
+  layer_normalization_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_layer_normalization_nc_f16(
+    xnn_operator_t layer_normalization_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_layer_normalization_nc(
+    layer_normalization_op, xnn_operator_type_layer_normalization_nc_f16,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    &xnn_params.f16.layernorm);
+}
+
+enum xnn_status xnn_setup_layer_normalization_nc_f32(
+    xnn_operator_t layer_normalization_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_layer_normalization_nc(
+    layer_normalization_op, xnn_operator_type_layer_normalization_nc_f32,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    &xnn_params.f32.layernorm);
+}
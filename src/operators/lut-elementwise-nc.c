@@ -13,6 +13,7 @@
 #include <xnnpack/allocator.h>
 #include <xnnpack/operator.h>
 #include <xnnpack/log.h>
+#include <xnnpack/math.h>
 
 
 typedef float (*xnn_lut_init_fn)(float, const void*);
@@ -135,6 +136,52 @@ error:
   return status;
 }
 
+static float calculate_identity(float x, const void* params) {
+  return x;
+}
+
+enum xnn_status xnn_create_convert_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float input_scale,
+    int8_t input_zero_point,
+    float output_scale,
+    int8_t output_zero_point,
+    uint32_t flags,
+    xnn_operator_t* convert_op_out)
+{
+  return create_lut_elementwise_nc(
+    channels, input_stride, output_stride,
+    (int32_t) input_zero_point, input_scale, INT8_MIN,
+    (long) output_zero_point, output_scale,
+    (long) INT8_MIN, (long) INT8_MAX,
+    flags,
+    (xnn_lut_init_fn) &calculate_identity, NULL,
+    xnn_operator_type_convert_nc_qs8, convert_op_out);
+}
+
+enum xnn_status xnn_create_convert_nc_qu8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float input_scale,
+    uint8_t input_zero_point,
+    float output_scale,
+    uint8_t output_zero_point,
+    uint32_t flags,
+    xnn_operator_t* convert_op_out)
+{
+  return create_lut_elementwise_nc(
+    channels, input_stride, output_stride,
+    (int32_t) (uint32_t) input_zero_point, input_scale, 0 /* input min */,
+    (long) (unsigned long) output_zero_point, output_scale,
+    0 /* output min */, (long) UINT8_MAX,
+    flags,
+    (xnn_lut_init_fn) &calculate_identity, NULL,
+    xnn_operator_type_convert_nc_qu8, convert_op_out);
+}
+
 static float calculate_elu(float x, const float* alpha_ptr) {
   const float alpha = *alpha_ptr;
   return signbit(x) ? alpha * expm1f(x) : x;
@@ -443,6 +490,30 @@ static enum xnn_status setup_lut_elementwise_nc(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_setup_convert_nc_qs8(
+    xnn_operator_t convert_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_lut_elementwise_nc(
+    convert_op, xnn_operator_type_convert_nc_qs8,
+    batch_size, input, output);
+}
+
+enum xnn_status xnn_setup_convert_nc_qu8(
+    xnn_operator_t convert_op,
+    size_t batch_size,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_lut_elementwise_nc(
+    convert_op, xnn_operator_type_convert_nc_qu8,
+    batch_size, input, output);
+}
+
 enum xnn_status xnn_setup_elu_nc_qs8(
     xnn_operator_t sigmoid_op,
     size_t batch_size,
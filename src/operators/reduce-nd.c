@@ -0,0 +1,474 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/normalization.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/params-init.h>
+
+
+static enum xnn_status create_reduce_nd(
+    enum xnn_reduce_operator reduce_operator,
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* reduce_op_out)
+{
+  xnn_operator_t reduce_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  switch (reduce_operator) {
+    case xnn_reduce_sum:
+    case xnn_reduce_mean:
+      break;
+    case xnn_reduce_max:
+      break;
+    default:
+      xnn_log_error("failed to create %s operator with %d reduce operator: unknown reduce operator",
+        xnn_operator_type_to_string(operator_type), reduce_operator);
+      goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  reduce_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (reduce_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  reduce_op->params.reduce_operator = reduce_operator;
+
+  reduce_op->type = operator_type;
+  reduce_op->flags = flags;
+
+  reduce_op->state = xnn_run_state_invalid;
+
+  *reduce_op_out = reduce_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(reduce_op);
+  return status;
+}
+
+enum xnn_status xnn_create_reduce_nd_f16(
+    enum xnn_reduce_operator reduce_operator,
+    uint32_t flags,
+    xnn_operator_t* reduce_op_out)
+{
+  return create_reduce_nd(
+    reduce_operator, flags,
+    XNN_INIT_FLAG_F16 | XNN_INIT_FLAG_F32 | XNN_INIT_FLAG_VCVT,
+    xnn_operator_type_reduce_nd_f16,
+    reduce_op_out);
+}
+
+enum xnn_status xnn_create_reduce_nd_f32(
+    enum xnn_reduce_operator reduce_operator,
+    uint32_t flags,
+    xnn_operator_t* reduce_op_out)
+{
+  return create_reduce_nd(
+    reduce_operator, flags,
+    XNN_INIT_FLAG_F32,
+    xnn_operator_type_reduce_nd_f32,
+    reduce_op_out);
+}
+
+enum xnn_status xnn_create_reduce_nd_qs8(
+    enum xnn_reduce_operator reduce_operator,
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    uint32_t flags,
+    xnn_operator_t* reduce_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_reduce_nd_qs8), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_reduce_nd_qs8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-8f || input_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input-to-output scale ratio: scale ratio must be in [2**-8, 2**8) range",
+      xnn_operator_type_to_string(xnn_operator_type_reduce_nd_qs8), input_output_scale);
+    return xnn_status_unsupported_parameter;
+  }
+
+  // The contiguous maximum maps signed elements onto unsigned elements, and uses the U8 RMAX micro-kernel.
+  const enum xnn_status status = create_reduce_nd(
+    reduce_operator, flags,
+    XNN_INIT_FLAG_QS8 | XNN_INIT_FLAG_F32 | XNN_INIT_FLAG_VCVT |
+      (reduce_operator == xnn_reduce_max ? XNN_INIT_FLAG_U8 : 0),
+    xnn_operator_type_reduce_nd_qs8,
+    reduce_op_out);
+  if (status == xnn_status_success) {
+    xnn_operator_t reduce_op = *reduce_op_out;
+    reduce_op->input_scale = input_scale;
+    reduce_op->output_scale = output_scale;
+    reduce_op->input_zero_point = (int32_t) input_zero_point;
+    reduce_op->output_zero_point = (uint8_t) output_zero_point;
+  }
+  return status;
+}
+
+static float to_fp32_f16(const void* input)
+{
+  return fp16_ieee_to_fp32_value(*((const uint16_t*) input));
+}
+
+static float to_fp32_f32(const void* input)
+{
+  return *((const float*) input);
+}
+
+static enum xnn_status setup_reduce_nd(
+    xnn_operator_t reduce_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const void* input,
+    void* output,
+    uint32_t log2_input_element_size,
+    uint32_t log2_output_element_size,
+    const struct vunary_parameters* cvt_input,
+    const struct vunary_parameters* cvt_output,
+    size_t num_threads)
+{
+  if (reduce_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  reduce_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(reduce_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_input_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu input dimensions: the number of input dimensions must not exceed %d",
+      xnn_operator_type_to_string(reduce_op->type), num_input_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu reduction axes: the number of reduction axes must not exceed the number "
+      "of input dimensions (%zu)",
+      xnn_operator_type_to_string(reduce_op->type), num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    if (reduction_axes[i] >= num_input_dims) {
+      xnn_log_error(
+        "failed to setup %s operator with #%zu reduction axis of %zu: the index is out of bounds for a %zuD input shape",
+        xnn_operator_type_to_string(reduce_op->type), i, reduction_axes[i], num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (i != 0 && reduction_axes[i] <= reduction_axes[i - 1]) {
+      xnn_log_error(
+        "failed to setup %s operator with #%zu reduction axis of %zu: the reduction axes must be in increasing order",
+        xnn_operator_type_to_string(reduce_op->type), i, reduction_axes[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  size_t num_elements = 1;
+  size_t num_reduced_elements = 1;
+  size_t normalized_reduction_axes[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_input_shape[XNN_MAX_TENSOR_DIMS];
+  memcpy(normalized_reduction_axes, reduction_axes, num_reduction_axes * sizeof(size_t));
+  memcpy(normalized_input_shape, input_shape, num_input_dims * sizeof(size_t));
+  for (size_t i = 0; i < num_input_dims; i++) {
+    num_elements *= input_shape[i];
+  }
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    num_reduced_elements *= input_shape[reduction_axes[i]];
+  }
+
+  if (num_elements == 0) {
+    reduce_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  xnn_normalize_reduction(&num_reduction_axes, normalized_reduction_axes, &num_input_dims, normalized_input_shape);
+  if (num_reduction_axes == 0) {
+    // Nothing is reduced: treat the innermost dimension as reduced with a single element.
+    normalized_reduction_axes[0] = num_input_dims;
+    normalized_input_shape[num_input_dims] = 1;
+    num_reduction_axes = 1;
+    num_input_dims += 1;
+  }
+
+  // Pad the normalized shape with leading dimensions of size 1 to 6 dimensions. Reduced and kept dimensions alternate
+  // in the normalized shape, so the padded dimensions keep the alternation.
+  const bool contiguous_reduction = normalized_reduction_axes[num_reduction_axes - 1] == num_input_dims - 1;
+  size_t shape[XNN_MAX_TENSOR_DIMS];
+  const size_t num_padding_dims = XNN_MAX_TENSOR_DIMS - num_input_dims;
+  for (size_t i = 0; i < num_padding_dims; i++) {
+    shape[i] = 1;
+  }
+  memcpy(shape + num_padding_dims, normalized_input_shape, num_input_dims * sizeof(size_t));
+
+  struct reduce_context* context = &reduce_op->context.reduce;
+  memset(context, 0, sizeof(struct reduce_context));
+  memcpy(context->input_shape, shape, sizeof(shape));
+  context->input_stride[XNN_MAX_TENSOR_DIMS - 1] = UINT32_C(1) << log2_input_element_size;
+  for (size_t i = XNN_MAX_TENSOR_DIMS - 1; i != 0; i--) {
+    context->input_stride[i - 1] = context->input_stride[i] * shape[i];
+  }
+  context->input = input;
+  context->output = output;
+  context->log2_input_element_size = log2_input_element_size;
+  context->log2_output_element_size = log2_output_element_size;
+
+  const enum xnn_reduce_operator reduce_operator = reduce_op->params.reduce_operator;
+  context->compute_max = reduce_operator == xnn_reduce_max;
+  context->scale = reduce_operator == xnn_reduce_mean ? 1.0f / (float) num_reduced_elements : 1.0f;
+  if (reduce_op->type == xnn_operator_type_reduce_nd_qs8) {
+    // Accumulators hold the sum or the maximum of (input - input_zero_point), and the input scale is folded into the
+    // output conversion.
+    context->zero_point_correction = context->compute_max ?
+      reduce_op->input_zero_point : reduce_op->input_zero_point * (int32_t) shape[XNN_MAX_TENSOR_DIMS - 1];
+  }
+
+  // Kept dimensions are at indices 0, 2, 4 for the contiguous reduction, and 1, 3, 5 for the discontiguous reduction.
+  const size_t first_kept_dim = contiguous_reduction ? 0 : 1;
+  const size_t output_dims[3] = {
+    shape[first_kept_dim], shape[first_kept_dim + 2], shape[first_kept_dim + 4],
+  };
+  context->output_stride[0] = output_dims[1] * output_dims[2];
+  context->output_stride[1] = output_dims[2];
+  const size_t num_outputs = output_dims[0] * output_dims[1] * output_dims[2];
+
+  if (cvt_output != NULL) {
+    // FP32 accumulators for the output elements, and scratch space for the input rows converted to FP32.
+    const size_t workspace_size = 2 * num_outputs * sizeof(float) + XNN_EXTRA_BYTES;
+    if (workspace_size > reduce_op->workspace_size) {
+      xnn_release_simd_memory(reduce_op->workspace);
+      reduce_op->workspace_size = 0;
+
+      reduce_op->workspace = xnn_allocate_simd_memory(workspace_size);
+      if (reduce_op->workspace == NULL) {
+        xnn_log_error(
+          "failed to allocate %zu bytes for %s operator workspace",
+          workspace_size, xnn_operator_type_to_string(reduce_op->type));
+        return xnn_status_out_of_memory;
+      }
+      reduce_op->workspace_size = workspace_size;
+    }
+    context->accumulators = reduce_op->workspace;
+    context->scratch = context->accumulators + num_outputs;
+    context->cvt_output_ukernel = cvt_output->ukernel;
+    if (reduce_op->type == xnn_operator_type_reduce_nd_qs8) {
+      cvt_output->init.f32_qs8_cvt(
+        &context->cvt_output_params.f32_qs8_cvt,
+        reduce_op->input_scale / reduce_op->output_scale, (int8_t) reduce_op->output_zero_point, INT8_MIN, INT8_MAX);
+    } else if (cvt_output->init.f32_f16_cvt != NULL) {
+      cvt_output->init.f32_f16_cvt(&context->cvt_output_params.f32_f16_cvt);
+    }
+  }
+
+  if (contiguous_reduction) {
+    switch (reduce_op->type) {
+      case xnn_operator_type_reduce_nd_f16:
+        if (context->compute_max) {
+          context->rmax_ukernel = xnn_params.f16.rmax;
+          context->to_fp32 = to_fp32_f16;
+        } else {
+          context->rsum_ukernel = (xnn_rsum_ukernel_function) xnn_params.f16.rsum;
+        }
+        break;
+      case xnn_operator_type_reduce_nd_f32:
+        if (context->compute_max) {
+          context->rmax_ukernel = xnn_params.f32.rmax;
+          context->to_fp32 = to_fp32_f32;
+        } else {
+          context->rsum_ukernel = (xnn_rsum_ukernel_function) xnn_params.f32.rsum;
+        }
+        break;
+      case xnn_operator_type_reduce_nd_qs8:
+        if (context->compute_max) {
+          context->u8_rmax_ukernel = xnn_params.u8.rmax;
+        } else {
+          context->qs8_rsum_ukernel = xnn_params.qs8.rsum;
+        }
+        break;
+      default:
+        XNN_UNREACHABLE;
+    }
+
+    reduce_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+    reduce_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_contiguous_reduce;
+    reduce_op->compute.range[0] = output_dims[0];
+    reduce_op->compute.range[1] = output_dims[1];
+    reduce_op->compute.range[2] = output_dims[2];
+    reduce_op->compute.tile[0] = 1;
+    reduce_op->compute.tile[1] = output_dims[2];
+    if (num_threads > 1) {
+      const size_t target_tiles_per_thread = 5;
+      const size_t max_tile = divide_round_up(num_outputs, num_threads * target_tiles_per_thread);
+      reduce_op->compute.tile[1] = min(output_dims[2], max(max_tile, 1));
+    }
+  } else {
+    if (cvt_input != NULL) {
+      context->cvt_input_ukernel = cvt_input->ukernel;
+      if (reduce_op->type == xnn_operator_type_reduce_nd_qs8) {
+        cvt_input->init.qs8_f32_cvt(&context->cvt_input_params.qs8_f32_cvt, 1.0f, (int8_t) reduce_op->input_zero_point);
+      } else if (cvt_input->init.f16_f32_cvt != NULL) {
+        cvt_input->init.f16_f32_cvt(&context->cvt_input_params.f16_f32_cvt);
+      }
+    }
+
+    size_t element_tile;
+    if (context->compute_max) {
+      context->vbinary_ukernel = xnn_params.f32.vmax.minmax.op_ukernel;
+      if (xnn_params.f32.vmax.init.f32_default != NULL) {
+        xnn_params.f32.vmax.init.f32_default(&context->vbinary_params.f32_default);
+      }
+      element_tile = xnn_params.f32.vmax.element_tile;
+    } else {
+      context->vbinary_ukernel = xnn_params.f32.vadd.minmax.op_ukernel;
+      if (xnn_params.f32.vadd.linear.op_ukernel != NULL) {
+        context->vbinary_ukernel = xnn_params.f32.vadd.linear.op_ukernel;
+      }
+      context->vmulc_ukernel = xnn_params.f32.vmul.minmax.opc_ukernel;
+      if (xnn_params.f32.vmul.linear.opc_ukernel != NULL) {
+        context->vmulc_ukernel = xnn_params.f32.vmul.linear.opc_ukernel;
+      }
+      xnn_params.f32.vadd.init.f32_minmax(&context->vbinary_params.f32_minmax, -INFINITY, INFINITY);
+      element_tile = xnn_params.f32.vadd.element_tile;
+    }
+
+    reduce_op->compute.type = xnn_parallelization_type_3d_tile_2d;
+    reduce_op->compute.task_3d_tile_2d = (pthreadpool_task_3d_tile_2d_t) xnn_compute_discontiguous_reduce;
+    reduce_op->compute.range[0] = output_dims[0];
+    reduce_op->compute.range[1] = output_dims[1];
+    reduce_op->compute.range[2] = output_dims[2];
+    reduce_op->compute.tile[0] = 1;
+    reduce_op->compute.tile[1] = output_dims[2];
+    if (num_threads > 1) {
+      const size_t target_tiles_per_thread = 5;
+      const size_t max_tile = divide_round_up(num_outputs, num_threads * target_tiles_per_thread);
+      if (max_tile < output_dims[2]) {
+        reduce_op->compute.tile[1] = min(output_dims[2], round_up(max_tile, max(element_tile, 1)));
+      }
+    }
+  }
+  reduce_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_reduce_nd_f16(
+    xnn_operator_t reduce_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce_nd(
+    reduce_op, xnn_operator_type_reduce_nd_f16,
+    num_reduction_axes, reduction_axes, num_input_dims, input_shape,
+    input, output,
+    1 /* log2(sizeof(input element)) = log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(output element)) = log2(sizeof(uint16_t)) */,
+    &xnn_params.vcvt.f16_to_f32, &xnn_params.vcvt.f32_to_f16,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_reduce_nd_f32(
+    xnn_operator_t reduce_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce_nd(
+    reduce_op, xnn_operator_type_reduce_nd_f32,
+    num_reduction_axes, reduction_axes, num_input_dims, input_shape,
+    input, output,
+    2 /* log2(sizeof(input element)) = log2(sizeof(float)) */,
+    2 /* log2(sizeof(output element)) = log2(sizeof(float)) */,
+    NULL /* cvt_input */, NULL /* cvt_output */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_reduce_nd_qs8(
+    xnn_operator_t reduce_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce_nd(
+    reduce_op, xnn_operator_type_reduce_nd_qs8,
+    num_reduction_axes, reduction_axes, num_input_dims, input_shape,
+    input, output,
+    0 /* log2(sizeof(input element)) = log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(output element)) = log2(sizeof(int8_t)) */,
+    &xnn_params.vcvt.qs8_to_f32, &xnn_params.vcvt.f32_to_qs8,
+    pthreadpool_get_threads_count(threadpool));
+}
@@ -0,0 +1,420 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/common.h>
+#include <xnnpack/math.h>
+#include <xnnpack/params.h>
+#include <xnnpack/indirection.h>
+
+
+static enum xnn_status create_resize_nearest_neighbor2d_nchw(
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* resize_op_out)
+{
+  xnn_operator_t resize_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XX) == 0) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (channels == 0) {
+    xnn_log_error(
+      "failed to create %s operator with %zu channels: number of channels must be non-zero",
+      xnn_operator_type_to_string(operator_type), channels);
+    goto error;
+  }
+
+  if (input_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with input pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(operator_type), input_pixel_stride, channels);
+    goto error;
+  }
+
+  if (output_pixel_stride < channels) {
+    xnn_log_error(
+      "failed to create %s operator with output pixel stride of %zu: "
+      "stride must be at least as large as the number of channels (%zu)",
+      xnn_operator_type_to_string(operator_type), output_pixel_stride, channels);
+    goto error;
+  }
+
+  if ((flags & XNN_FLAG_ALIGN_CORNERS) != 0 && (flags & XNN_FLAG_TENSORFLOW_LEGACY_MODE) != 0) {
+    xnn_log_error(
+      "failed to create %s operator with both XNN_FLAG_ALIGN_CORNERS and XNN_FLAG_TENSORFLOW_LEGACY_MODE flags: "
+      "the two flags are mutually exclusive",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  resize_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (resize_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  resize_op->channels = channels;
+  resize_op->input_pixel_stride = input_pixel_stride;
+  resize_op->output_pixel_stride = output_pixel_stride;
+
+  resize_op->type = operator_type;
+  resize_op->flags = flags;
+
+  resize_op->state = xnn_run_state_invalid;
+
+  *resize_op_out = resize_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(resize_op);
+  return status;
+}
+
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_f16(
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    uint32_t flags,
+    xnn_operator_t* resize_op_out)
+{
+  return create_resize_nearest_neighbor2d_nchw(
+    channels,
+    input_pixel_stride,
+    output_pixel_stride,
+    flags,
+    xnn_operator_type_resize_nearest_neighbor_nchw_f16,
+    resize_op_out);
+}
+
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_f32(
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    uint32_t flags,
+    xnn_operator_t* resize_op_out)
+{
+  return create_resize_nearest_neighbor2d_nchw(
+    channels,
+    input_pixel_stride,
+    output_pixel_stride,
+    flags,
+    xnn_operator_type_resize_nearest_neighbor_nchw_f32,
+    resize_op_out);
+}
+
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_s8(
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    uint32_t flags,
+    xnn_operator_t* resize_op_out)
+{
+  return create_resize_nearest_neighbor2d_nchw(
+    channels,
+    input_pixel_stride,
+    output_pixel_stride,
+    flags,
+    xnn_operator_type_resize_nearest_neighbor_nchw_s8,
+    resize_op_out);
+}
+
+enum xnn_status xnn_create_resize_nearest_neighbor2d_nchw_u8(
+    size_t channels,
+    size_t input_pixel_stride,
+    size_t output_pixel_stride,
+    uint32_t flags,
+    xnn_operator_t* resize_op_out)
+{
+  return create_resize_nearest_neighbor2d_nchw(
+    channels,
+    input_pixel_stride,
+    output_pixel_stride,
+    flags,
+    xnn_operator_type_resize_nearest_neighbor_nchw_u8,
+    resize_op_out);
+}
+
+// Returns the integer upscaling factor if every output coordinate maps onto input coordinate (output / factor),
+// or 0 otherwise.
+static size_t integer_scale(
+    const size_t* input_offsets,
+    size_t input_size,
+    size_t output_size,
+    size_t input_stride)
+{
+  if (output_size % input_size != 0) {
+    return 0;
+  }
+  const size_t scale = output_size / input_size;
+  for (size_t i = 0; i < output_size; i++) {
+    if (input_offsets[i] != (i / scale) * input_stride) {
+      return 0;
+    }
+  }
+  return scale;
+}
+
+static enum xnn_status setup_resize_nearest_neighbor2d_nchw(
+    xnn_operator_t resize_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size,
+    size_t num_threads)
+{
+  if (resize_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(resize_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  resize_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(resize_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zu input: input dimensions must be non-zero",
+      xnn_operator_type_to_string(resize_op->type), input_width, input_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (max(input_width, input_height) >= 16777216) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zu input: input dimensions must be below 2**24",
+      xnn_operator_type_to_string(resize_op->type), input_width, input_height);
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (output_width == 0 || output_height == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zu output: output dimensions must be non-zero",
+      xnn_operator_type_to_string(resize_op->type), output_width, output_height);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (max(output_width, output_height) >= 16777216) {
+    xnn_log_error(
+      "failed to setup %s operator with %zux%zu output: output dimensions must be below 2**24",
+      xnn_operator_type_to_string(resize_op->type), output_width, output_height);
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (batch_size == 0) {
+    resize_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  // In CHW layout, consecutive pixels of a channel plane are adjacent elements.
+  const size_t input_pixel_stride_in_bytes = (size_t) 1 << log2_element_size;
+  if (input_height != resize_op->last_input_height ||
+      input_width != resize_op->last_input_width ||
+      output_height != resize_op->last_output_height ||
+      output_width != resize_op->last_output_width)
+  {
+    const size_t offsets_size = sizeof(size_t) * (output_height + output_width);
+    size_t* offsets = (size_t*) xnn_reallocate_memory(resize_op->pixelwise_buffer, offsets_size);
+    if (offsets == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator input offsets",
+        offsets_size, xnn_operator_type_to_string(resize_op->type));
+      return xnn_status_out_of_memory;
+    }
+    resize_op->pixelwise_buffer = offsets;
+
+    const uint32_t flags = resize_op->flags;
+    xnn_indirection_init_resize_nearest_neighbor2d(
+      input_pixel_stride_in_bytes,
+      input_height, input_width,
+      output_height, output_width,
+      offsets, offsets + output_height,
+      !!(flags & XNN_FLAG_ALIGN_CORNERS),
+      !!(flags & XNN_FLAG_TENSORFLOW_LEGACY_MODE));
+
+    resize_op->last_input_height = input_height;
+    resize_op->last_input_width = input_width;
+    resize_op->last_output_height = output_height;
+    resize_op->last_output_width = output_width;
+  }
+  const size_t* input_row_offsets = (const size_t*) resize_op->pixelwise_buffer;
+  const size_t* input_pixel_offsets = input_row_offsets + output_height;
+
+  const size_t input_channel_stride = (input_height * input_width) << log2_element_size;
+  const size_t output_channel_stride = (output_height * output_width) << log2_element_size;
+  resize_op->context.resize_nearest_neighbor_chw = (struct resize_nearest_neighbor_chw_context) {
+    .input = input,
+    .input_channel_stride = input_channel_stride,
+    .input_batch_stride = resize_op->input_pixel_stride * input_channel_stride,
+    .input_row_offsets = input_row_offsets,
+    .input_pixel_offsets = input_pixel_offsets,
+    .output = output,
+    .output_height = output_height,
+    .output_width = output_width,
+    .output_channel_stride = output_channel_stride,
+    .output_batch_stride = resize_op->output_pixel_stride * output_channel_stride,
+    .width_scale = integer_scale(input_pixel_offsets, input_width, output_width, input_pixel_stride_in_bytes),
+    .log2_element_size = log2_element_size,
+    .copy_ukernel = xnn_params.xx.copy,
+  };
+
+  size_t channel_tile = resize_op->channels;
+  if (num_threads > 1) {
+    const size_t target_tiles_per_thread = 4;
+    const size_t max_channel_tile = divide_round_up(channel_tile, num_threads * target_tiles_per_thread);
+    if (max_channel_tile < channel_tile) {
+      channel_tile = max_channel_tile;
+    }
+  }
+  resize_op->compute.type = xnn_parallelization_type_2d_tile_1d;
+  resize_op->compute.task_2d_tile_1d = (pthreadpool_task_2d_tile_1d_t) xnn_compute_resize_nearest_neighbor_chw;
+  resize_op->compute.range[0] = batch_size;
+  resize_op->compute.range[1] = resize_op->channels;
+  resize_op->compute.tile[0] = channel_tile;
+  resize_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_f16(
+    xnn_operator_t resize_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_resize_nearest_neighbor2d_nchw(
+    resize_op,
+    xnn_operator_type_resize_nearest_neighbor_nchw_f16,
+    batch_size,
+    input_height,
+    input_width,
+    output_height,
+    output_width,
+    input,
+    output,
+    1 /* log2(element size) == log2(sizeof(uint16_t)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_f32(
+    xnn_operator_t resize_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  return setup_resize_nearest_neighbor2d_nchw(
+    resize_op,
+    xnn_operator_type_resize_nearest_neighbor_nchw_f32,
+    batch_size,
+    input_height,
+    input_width,
+    output_height,
+    output_width,
+    input,
+    output,
+    2 /* log2(element size) == log2(sizeof(float)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_s8(
+    xnn_operator_t resize_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_resize_nearest_neighbor2d_nchw(
+    resize_op,
+    xnn_operator_type_resize_nearest_neighbor_nchw_s8,
+    batch_size,
+    input_height,
+    input_width,
+    output_height,
+    output_width,
+    input,
+    output,
+    0 /* log2(element size) == log2(sizeof(int8_t)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_resize_nearest_neighbor2d_nchw_u8(
+    xnn_operator_t resize_op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_resize_nearest_neighbor2d_nchw(
+    resize_op,
+    xnn_operator_type_resize_nearest_neighbor_nchw_u8,
+    batch_size,
+    input_height,
+    input_width,
+    output_height,
+    output_width,
+    input,
+    output,
+    0 /* log2(element size) == log2(sizeof(uint8_t)) */,
+    pthreadpool_get_threads_count(threadpool));
+}
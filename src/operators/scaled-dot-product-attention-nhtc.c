@@ -0,0 +1,396 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/math.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/pack.h>
+#include <xnnpack/params.h>
+
+
+// Maximum number of keys processed in one step of the online softmax. Scores for a tile of queries and a tile of keys
+// are the only score elements materialized at any time.
+#define XNN_ATTENTION_KEY_TILE 128
+
+static enum xnn_status create_scaled_dot_product_attention_nhtc(
+    float scale,
+    uint32_t flags,
+    uint32_t datatype_init_flags,
+    const struct gemm_parameters gemm_parameters[restrict XNN_MIN_ELEMENTS(1)],
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* attention_op_out)
+{
+  xnn_operator_t attention_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags ||
+      gemm_parameters->minmax.gemm.function[XNN_UARCH_DEFAULT] == NULL)
+  {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_invalid_parameter;
+
+  if (scale <= 0.0f || !isnormal(scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(operator_type), scale);
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  attention_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (attention_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  attention_op->params.attention_scale = scale;
+
+  attention_op->type = operator_type;
+  attention_op->flags = flags;
+
+  attention_op->state = xnn_run_state_invalid;
+
+  *attention_op_out = attention_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(attention_op);
+  return status;
+}
+
+enum xnn_status xnn_create_scaled_dot_product_attention_nhtc_f16(
+    float scale,
+    uint32_t flags,
+    xnn_operator_t* attention_op_out)
+{
+  return create_scaled_dot_product_attention_nhtc(
+    scale, flags,
+    XNN_INIT_FLAG_F16, &xnn_params.f16.gemm,
+    xnn_operator_type_scaled_dot_product_attention_nhtc_f16,
+    attention_op_out);
+}
+
+enum xnn_status xnn_create_scaled_dot_product_attention_nhtc_f32(
+    float scale,
+    uint32_t flags,
+    xnn_operator_t* attention_op_out)
+{
+  return create_scaled_dot_product_attention_nhtc(
+    scale, flags,
+    XNN_INIT_FLAG_F32, &xnn_params.f32.gemm,
+    xnn_operator_type_scaled_dot_product_attention_nhtc_f32,
+    attention_op_out);
+}
+
+static enum xnn_status setup_scaled_dot_product_attention_nhtc(
+    xnn_operator_t attention_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t batch_size,
+    size_t heads,
+    size_t query_tokens,
+    size_t key_tokens,
+    size_t channels,
+    size_t value_channels,
+    const void* query,
+    const void* key,
+    const void* value,
+    const void* mask,
+    void* output,
+    uint32_t log2_element_size,
+    const struct gemm_parameters gemm_parameters[restrict XNN_MIN_ELEMENTS(1)],
+    xnn_pack_gemm_goi_w_function pack_gemm_goi_w,
+    xnn_pack_gemm_io_w_function pack_gemm_io_w,
+    xnn_rmax_ukernel_function rmax,
+    const struct raddstoreexpminusmax_parameters raddstoreexpminusmax[restrict XNN_MIN_ELEMENTS(1)],
+    const struct vbinary_parameters vadd[restrict XNN_MIN_ELEMENTS(1)],
+    const struct vbinary_parameters vmul[restrict XNN_MIN_ELEMENTS(1)],
+    xnn_compute_to_fp32_function to_fp32,
+    xnn_compute_from_fp32_function from_fp32,
+    const void* gemm_params,
+    size_t gemm_params_size,
+    const void* expminus_params,
+    size_t expminus_params_size,
+    const void* minmax_params,
+    size_t minmax_params_size)
+{
+  if (attention_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(attention_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  attention_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(expected_operator_type));
+    return xnn_status_uninitialized;
+  }
+
+  if (query_tokens == 0 || key_tokens == 0 || channels == 0 || value_channels == 0) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu query tokens, %zu key tokens, %zu channels, and %zu value channels: "
+      "number of tokens and channels must be non-zero",
+      xnn_operator_type_to_string(expected_operator_type), query_tokens, key_tokens, channels, value_channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((attention_op->flags & XNN_FLAG_CAUSAL_ATTENTION) && key_tokens < query_tokens) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu query tokens and %zu key tokens: "
+      "causal attention requires at least as many key tokens as query tokens",
+      xnn_operator_type_to_string(expected_operator_type), query_tokens, key_tokens);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_heads = batch_size * heads;
+  if (num_heads == 0) {
+    attention_op->state = xnn_run_state_skip;
+    return xnn_status_success;
+  }
+
+  const uint32_t mr = gemm_parameters->mr;
+  const uint32_t nr = gemm_parameters->nr;
+  const uint32_t kr = UINT32_C(1) << gemm_parameters->log2_kr;
+  const uint32_t sr = UINT32_C(1) << gemm_parameters->log2_sr;
+  const size_t skr = (size_t) (kr * sr);
+
+  // Keys are packed once per head as the weights of the Q x K^T GEMM (key tokens are output channels), and values are
+  // packed per key tile as the weights of the P x V GEMM (key tokens are the reduction dimension).
+  const size_t key_tile = round_up(min(key_tokens, XNN_ATTENTION_KEY_TILE), nr);
+  const size_t num_key_tiles = divide_round_up(key_tokens, key_tile);
+  const size_t num_query_tiles = divide_round_up(query_tokens, mr);
+  const size_t packed_k_tile_stride = ((key_tile * (round_up_po2(channels, skr) + 1)) << log2_element_size);
+  const size_t packed_k_head_stride = round_up_po2(num_key_tiles * packed_k_tile_stride, XNN_ALLOCATION_ALIGNMENT);
+  const size_t packed_v_tile_stride =
+    ((round_up(value_channels, nr) * (round_up_po2(key_tile, skr) + 1)) << log2_element_size);
+  const size_t packed_v_head_stride = round_up_po2(num_key_tiles * packed_v_tile_stride, XNN_ALLOCATION_ALIGNMENT);
+  // Per query tile scratch: scores/probabilities, output accumulators, and partial outputs of the current key tile,
+  // followed by the running maximum, running sum, and rescaling factor of each query in FP32.
+  const size_t scores_size = (mr * key_tile) << log2_element_size;
+  const size_t accumulators_size = (mr * value_channels) << log2_element_size;
+  const size_t scratch_tile_stride = round_up_po2(
+    round_up_po2(scores_size + 2 * accumulators_size, sizeof(float)) + 3 * mr * sizeof(float) + XNN_EXTRA_BYTES,
+    XNN_ALLOCATION_ALIGNMENT);
+
+  const size_t packed_size = num_heads * (packed_k_head_stride + packed_v_head_stride);
+  const size_t workspace_size = packed_size + num_heads * num_query_tiles * scratch_tile_stride;
+  // The workspace is zero-initialized: GEMM micro-kernels with KR > 1 read score rows past the last key of a tile, and
+  // these elements must never be NaN.
+  if (workspace_size > attention_op->workspace_size) {
+    xnn_release_simd_memory(attention_op->workspace);
+    attention_op->workspace_size = 0;
+
+    attention_op->workspace = xnn_allocate_zero_simd_memory(workspace_size);
+    if (attention_op->workspace == NULL) {
+      xnn_log_error(
+        "failed to allocate %zu bytes for %s operator workspace",
+        workspace_size, xnn_operator_type_to_string(attention_op->type));
+      return xnn_status_out_of_memory;
+    }
+    attention_op->workspace_size = workspace_size;
+  }
+
+  attention_op->batch_size = batch_size;
+  attention_op->input = query;
+  attention_op->output = output;
+
+  attention_op->context.scaled_dot_product_attention = (struct scaled_dot_product_attention_context) {
+    .query_tokens = query_tokens,
+    .key_tokens = key_tokens,
+    .channels = channels,
+    .value_channels = value_channels,
+    .log2_element_size = log2_element_size,
+    .causal = (attention_op->flags & XNN_FLAG_CAUSAL_ATTENTION) != 0,
+    .q = query,
+    .q_head_stride = (query_tokens * channels) << log2_element_size,
+    .k = key,
+    .k_head_stride = (key_tokens * channels) << log2_element_size,
+    .v = value,
+    .v_head_stride = (key_tokens * value_channels) << log2_element_size,
+    .mask = mask,
+    .mask_stride = key_tokens << log2_element_size,
+    .o = output,
+    .o_head_stride = (query_tokens * value_channels) << log2_element_size,
+    .mr = mr,
+    .nr = nr,
+    .kr = kr,
+    .sr = sr,
+    .key_tile = key_tile,
+    .packed_k = attention_op->workspace,
+    .packed_k_head_stride = packed_k_head_stride,
+    .packed_k_tile_stride = packed_k_tile_stride,
+    .packed_v = (void*) ((uintptr_t) attention_op->workspace + num_heads * packed_k_head_stride),
+    .packed_v_head_stride = packed_v_head_stride,
+    .packed_v_tile_stride = packed_v_tile_stride,
+    .scratch = (void*) ((uintptr_t) attention_op->workspace + packed_size),
+    .scratch_head_stride = num_query_tiles * scratch_tile_stride,
+    .scratch_tile_stride = scratch_tile_stride,
+    .pack_gemm_goi_w = pack_gemm_goi_w,
+    .pack_gemm_io_w = pack_gemm_io_w,
+    .gemm_ukernel = gemm_parameters->minmax.gemm.function[XNN_UARCH_DEFAULT],
+    .rmax_ukernel = rmax,
+    .raddstoreexpminusmax_ukernel = raddstoreexpminusmax->ukernel,
+    .vadd_ukernel = vadd->minmax.op_ukernel,
+    .vmulc_ukernel = vmul->minmax.opc_ukernel,
+    .to_fp32 = to_fp32,
+    .from_fp32 = from_fp32,
+  };
+  if (gemm_parameters->linear.gemm.function[XNN_UARCH_DEFAULT] != NULL) {
+    attention_op->context.scaled_dot_product_attention.gemm_ukernel =
+      gemm_parameters->linear.gemm.function[XNN_UARCH_DEFAULT];
+  }
+  if (vadd->linear.op_ukernel != NULL) {
+    attention_op->context.scaled_dot_product_attention.vadd_ukernel = vadd->linear.op_ukernel;
+  }
+  if (vmul->linear.opc_ukernel != NULL) {
+    attention_op->context.scaled_dot_product_attention.vmulc_ukernel = vmul->linear.opc_ukernel;
+  }
+  from_fp32(attention_op->params.attention_scale, &attention_op->context.scaled_dot_product_attention.scale);
+  memcpy(&attention_op->context.scaled_dot_product_attention.gemm_params, gemm_params, gemm_params_size);
+  memcpy(&attention_op->context.scaled_dot_product_attention.expminus_params, expminus_params, expminus_params_size);
+  memcpy(&attention_op->context.scaled_dot_product_attention.minmax_params, minmax_params, minmax_params_size);
+
+  // First phase: pack keys and values of every head. Second phase: online softmax over tiles of queries.
+  attention_op->compute.type = xnn_parallelization_type_1d;
+  attention_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_scaled_dot_product_attention_pack;
+  attention_op->compute.range[0] = num_heads;
+  attention_op->compute2.type = xnn_parallelization_type_2d;
+  attention_op->compute2.task_2d = (pthreadpool_task_2d_t) xnn_compute_scaled_dot_product_attention;
+  attention_op->compute2.range[0] = num_heads;
+  attention_op->compute2.range[1] = num_query_tiles;
+  attention_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+static float to_fp32_f16(const void* input)
+{
+  return fp16_ieee_to_fp32_value(*((const uint16_t*) input));
+}
+
+static void from_fp32_f16(float input, void* output)
+{
+  *((uint16_t*) output) = fp16_ieee_from_fp32_value(input);
+}
+
+enum xnn_status xnn_setup_scaled_dot_product_attention_nhtc_f16(
+    xnn_operator_t attention_op,
+    size_t batch_size,
+    size_t heads,
+    size_t query_tokens,
+    size_t key_tokens,
+    size_t channels,
+    size_t value_channels,
+    const void* query,
+    const void* key,
+    const void* value,
+    const void* mask,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  union xnn_f16_minmax_params gemm_params;
+  if (xnn_params.f16.gemm.init.f16 != NULL) {
+    xnn_params.f16.gemm.init.f16(&gemm_params, UINT16_C(0xFC00), UINT16_C(0x7C00));
+  }
+  union xnn_f16_expminus_params expminus_params;
+  if (xnn_params.f16.raddstoreexpminusmax.init.f16 != NULL) {
+    xnn_params.f16.raddstoreexpminusmax.init.f16(&expminus_params);
+  }
+  union xnn_f16_minmax_params minmax_params;
+  if (xnn_params.f16.vmul.init.f16_minmax != NULL) {
+    xnn_params.f16.vmul.init.f16_minmax(&minmax_params, UINT16_C(0xFC00), UINT16_C(0x7C00));
+  }
+  return setup_scaled_dot_product_attention_nhtc(
+    attention_op, xnn_operator_type_scaled_dot_product_attention_nhtc_f16,
+    batch_size, heads, query_tokens, key_tokens, channels, value_channels,
+    query, key, value, mask, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    &xnn_params.f16.gemm,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_f16_gemm_goi_w,
+    (xnn_pack_gemm_io_w_function) xnn_pack_f16_gemm_io_w,
+    xnn_params.f16.rmax, &xnn_params.f16.raddstoreexpminusmax, &xnn_params.f16.vadd, &xnn_params.f16.vmul,
+    to_fp32_f16, from_fp32_f16,
+    &gemm_params, sizeof(gemm_params),
+    &expminus_params, sizeof(expminus_params),
+    &minmax_params, sizeof(minmax_params));
+}
+
+static float to_fp32_f32(const void* input)
+{
+  return *((const float*) input);
+}
+
+static void from_fp32_f32(float input, void* output)
+{
+  *((float*) output) = input;
+}
+
+enum xnn_status xnn_setup_scaled_dot_product_attention_nhtc_f32(
+    xnn_operator_t attention_op,
+    size_t batch_size,
+    size_t heads,
+    size_t query_tokens,
+    size_t key_tokens,
+    size_t channels,
+    size_t value_channels,
+    const float* query,
+    const float* key,
+    const float* value,
+    const float* mask,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  union xnn_f32_minmax_params gemm_params;
+  if (xnn_params.f32.gemm.init.f32 != NULL) {
+    xnn_params.f32.gemm.init.f32(&gemm_params, -INFINITY, INFINITY);
+  }
+  union xnn_f32_expminus_params expminus_params;
+  if (xnn_params.f32.raddstoreexpminusmax.init.f32 != NULL) {
+    xnn_params.f32.raddstoreexpminusmax.init.f32(&expminus_params);
+  }
+  union xnn_f32_minmax_params minmax_params;
+  if (xnn_params.f32.vmul.init.f32_minmax != NULL) {
+    xnn_params.f32.vmul.init.f32_minmax(&minmax_params, -INFINITY, INFINITY);
+  }
+  return setup_scaled_dot_product_attention_nhtc(
+    attention_op, xnn_operator_type_scaled_dot_product_attention_nhtc_f32,
+    batch_size, heads, query_tokens, key_tokens, channels, value_channels,
+    query, key, value, mask, output,
+    2 /* log2(sizeof(float)) */,
+    &xnn_params.f32.gemm,
+    (xnn_pack_gemm_goi_w_function) xnn_pack_f32_gemm_goi_w,
+    (xnn_pack_gemm_io_w_function) xnn_pack_f32_gemm_io_w,
+    xnn_params.f32.rmax, &xnn_params.f32.raddstoreexpminusmax, &xnn_params.f32.vadd, &xnn_params.f32.vmul,
+    to_fp32_f32, from_fp32_f32,
+    &gemm_params, sizeof(gemm_params),
+    &expminus_params, sizeof(expminus_params),
+    &minmax_params, sizeof(minmax_params));
+}
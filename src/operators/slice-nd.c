@@ -0,0 +1,230 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <xnnpack.h>
+#include <xnnpack/allocator.h>
+#include <xnnpack/log.h>
+#include <xnnpack/normalization.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+
+
+static enum xnn_status create_slice_nd(
+    uint32_t flags,
+    enum xnn_operator_type operator_type,
+    xnn_operator_t* slice_op_out)
+{
+  xnn_operator_t slice_op = NULL;
+  enum xnn_status status = xnn_status_uninitialized;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error(
+      "failed to create %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_out_of_memory;
+
+  slice_op = xnn_allocate_zero_simd_memory(sizeof(struct xnn_operator));
+  if (slice_op == NULL) {
+    xnn_log_error(
+      "failed to allocate %zu bytes for %s operator descriptor",
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  slice_op->type = operator_type;
+  slice_op->flags = flags;
+
+  slice_op->state = xnn_run_state_invalid;
+
+  *slice_op_out = slice_op;
+  return xnn_status_success;
+
+error:
+  xnn_delete_operator(slice_op);
+  return status;
+}
+
+enum xnn_status xnn_create_slice_nd_x8(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out)
+{
+  return create_slice_nd(flags, xnn_operator_type_slice_nd_x8, slice_op_out);
+}
+
+enum xnn_status xnn_create_slice_nd_x16(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out)
+{
+  return create_slice_nd(flags, xnn_operator_type_slice_nd_x16, slice_op_out);
+}
+
+enum xnn_status xnn_create_slice_nd_x32(
+  uint32_t flags,
+  xnn_operator_t* slice_op_out)
+{
+  return create_slice_nd(flags, xnn_operator_type_slice_nd_x32, slice_op_out);
+}
+
+static enum xnn_status setup_slice_nd(
+    xnn_operator_t slice_op,
+    enum xnn_operator_type expected_operator_type,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* offsets,
+    const size_t* sizes,
+    const void* input,
+    void* output,
+    uint32_t log2_element_size)
+{
+  if (slice_op->type != expected_operator_type) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(expected_operator_type),
+      xnn_operator_type_to_string(slice_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  slice_op->state = xnn_run_state_invalid;
+
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
+    xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
+      xnn_operator_type_to_string(slice_op->type));
+    return xnn_status_uninitialized;
+  }
+
+  if (num_dims > XNN_MAX_TENSOR_DIMS) {
+    xnn_log_error(
+      "failed to setup %s operator with %zu dimensions in input shape: "
+      "the number of input dimensions must not exceed %d",
+      xnn_operator_type_to_string(slice_op->type), num_dims, XNN_MAX_TENSOR_DIMS);
+    return xnn_status_unsupported_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: input shape dimension #%zu is zero",
+        xnn_operator_type_to_string(slice_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+    if (sizes[i] == 0) {
+      xnn_log_error(
+        "failed to setup %s operator: slice size in dimension #%zu is zero",
+        xnn_operator_type_to_string(slice_op->type), i);
+      return xnn_status_invalid_parameter;
+    }
+    if (offsets[i] >= input_shape[i] || sizes[i] > input_shape[i] - offsets[i]) {
+      xnn_log_error(
+        "failed to setup %s operator: slice [%zu, %zu) in dimension #%zu exceeds input dimension of %zu",
+        xnn_operator_type_to_string(slice_op->type), offsets[i], offsets[i] + sizes[i], i, input_shape[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  size_t num_normalized_dims = num_dims;
+  size_t normalized_offsets[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_sizes[XNN_MAX_TENSOR_DIMS];
+  size_t normalized_input_shape[XNN_MAX_TENSOR_DIMS];
+  for (size_t i = 0; i < num_dims; i++) {
+    normalized_offsets[i] = offsets[i];
+    normalized_sizes[i] = sizes[i];
+    normalized_input_shape[i] = input_shape[i];
+  }
+  xnn_normalize_slice(&num_normalized_dims, normalized_offsets, normalized_sizes, normalized_input_shape);
+
+  // Right-align the normalized dimensions in a 6-D slice, with leading dimensions of size 1.
+  size_t slice_offsets[XNN_MAX_TENSOR_DIMS];
+  size_t slice_sizes[XNN_MAX_TENSOR_DIMS];
+  size_t slice_input_shape[XNN_MAX_TENSOR_DIMS];
+  const size_t num_padding_dims = XNN_MAX_TENSOR_DIMS - num_normalized_dims;
+  for (size_t i = 0; i < XNN_MAX_TENSOR_DIMS; i++) {
+    slice_offsets[i] = i < num_padding_dims ? 0 : normalized_offsets[i - num_padding_dims];
+    slice_sizes[i] = i < num_padding_dims ? 1 : normalized_sizes[i - num_padding_dims];
+    slice_input_shape[i] = i < num_padding_dims ? 1 : normalized_input_shape[i - num_padding_dims];
+  }
+
+  slice_op->context.slice = (struct slice_context) {
+    .ukernel = xnn_params.xx.copy,
+    .output = output,
+    .contiguous_size = slice_sizes[XNN_MAX_TENSOR_DIMS - 1] << log2_element_size,
+  };
+
+  size_t input_stride = 1;
+  size_t output_stride = 1;
+  size_t input_offset = slice_offsets[XNN_MAX_TENSOR_DIMS - 1];
+  for (size_t i = XNN_MAX_TENSOR_DIMS - 1; i != 0; i--) {
+    input_stride *= slice_input_shape[i];
+    output_stride *= slice_sizes[i];
+    input_offset += slice_offsets[i - 1] * input_stride;
+    slice_op->context.slice.input_stride[i - 1] = input_stride << log2_element_size;
+    slice_op->context.slice.output_stride[i - 1] = output_stride << log2_element_size;
+  }
+  slice_op->context.slice.input = (const void*) ((uintptr_t) input + (input_offset << log2_element_size));
+
+  slice_op->compute.type = xnn_parallelization_type_5d;
+  slice_op->compute.task_5d = (pthreadpool_task_5d_t) xnn_compute_slice_5d;
+  slice_op->compute.range[0] = slice_sizes[0];
+  slice_op->compute.range[1] = slice_sizes[1];
+  slice_op->compute.range[2] = slice_sizes[2];
+  slice_op->compute.range[3] = slice_sizes[3];
+  slice_op->compute.range[4] = slice_sizes[4];
+  slice_op->state = xnn_run_state_ready;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_setup_slice_nd_x8(
+    xnn_operator_t slice_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* offsets,
+    const size_t* sizes,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_slice_nd(
+    slice_op, xnn_operator_type_slice_nd_x8,
+    num_dims, input_shape, offsets, sizes,
+    input, output, 0 /* log2(element size) */);
+}
+
+enum xnn_status xnn_setup_slice_nd_x16(
+    xnn_operator_t slice_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* offsets,
+    const size_t* sizes,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_slice_nd(
+    slice_op, xnn_operator_type_slice_nd_x16,
+    num_dims, input_shape, offsets, sizes,
+    input, output, 1 /* log2(element size) */);
+}
+
+enum xnn_status xnn_setup_slice_nd_x32(
+    xnn_operator_t slice_op,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* offsets,
+    const size_t* sizes,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  return setup_slice_nd(
+    slice_op, xnn_operator_type_slice_nd_x32,
+    num_dims, input_shape, offsets, sizes,
+    input, output, 2 /* log2(element size) */);
+}
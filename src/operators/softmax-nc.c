@@ -21,14 +21,17 @@
 #include <xnnpack/params-init.h>
 
 
-enum xnn_status xnn_create_softmax_nc_qu8(
+static enum xnn_status create_softmax_nc_quantized(
     size_t channels,
     size_t input_stride,
     size_t output_stride,
     float input_scale,
-    uint8_t output_zero_point,
+    int32_t output_zero_point,
+    int32_t expected_output_zero_point,
     float output_scale,
     uint32_t flags,
+    uint32_t datatype_init_flags,
+    enum xnn_operator_type operator_type,
     xnn_operator_t* softmax_op_out)
 {
   xnn_operator_t softmax_op = NULL;
@@ -36,7 +39,15 @@ enum xnn_status xnn_create_softmax_nc_qu8(
 
   if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
     xnn_log_error("failed to create %s operator: XNNPACK is not initialized",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8));
+      xnn_operator_type_to_string(operator_type));
+    goto error;
+  }
+
+  status = xnn_status_unsupported_hardware;
+
+  if ((xnn_params.init_flags & datatype_init_flags) != datatype_init_flags) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(operator_type));
     goto error;
   }
 
@@ -45,7 +56,7 @@ enum xnn_status xnn_create_softmax_nc_qu8(
   if (channels == 0) {
     xnn_log_error(
       "failed to create %s operator with %zu channels: number of channels must be non-zero",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8), channels);
+      xnn_operator_type_to_string(operator_type), channels);
     goto error;
   }
 
@@ -53,7 +64,7 @@ enum xnn_status xnn_create_softmax_nc_qu8(
     xnn_log_error(
       "failed to create %s operator with input element stride of %zu: "
       "stride must be at least as large as the number of channels (%zu)",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8), input_stride, channels);
+      xnn_operator_type_to_string(operator_type), input_stride, channels);
     goto error;
   }
 
@@ -61,21 +72,21 @@ enum xnn_status xnn_create_softmax_nc_qu8(
     xnn_log_error(
       "failed to create %s operator with output element stride of %zu: "
       "stride must be at least as large as the number of channels (%zu)",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8), output_stride, channels);
+      xnn_operator_type_to_string(operator_type), output_stride, channels);
     goto error;
   }
 
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
     xnn_log_error(
       "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8), input_scale);
+      xnn_operator_type_to_string(operator_type), input_scale);
     goto error;
   }
 
   if (output_scale <= 0.0f || !isnormal(output_scale)) {
     xnn_log_error(
       "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8), output_scale);
+      xnn_operator_type_to_string(operator_type), output_scale);
     goto error;
   }
 
@@ -84,14 +95,15 @@ enum xnn_status xnn_create_softmax_nc_qu8(
   if (output_scale != 0x1.0p-8f) {
     xnn_log_error(
       "failed to create %s operator with %.7g output scale: only output scale of 1/256 is supported",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8), output_scale);
+      xnn_operator_type_to_string(operator_type), output_scale);
     goto error;
   }
 
-  if (output_zero_point != 0) {
+  if (output_zero_point != expected_output_zero_point) {
     xnn_log_error(
-      "failed to create %s operator with %" PRIu8 " output zero point: only output zero point of 0 is supported",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8), output_zero_point);
+      "failed to create %s operator with %" PRId32 " output zero point: "
+      "only output zero point of %" PRId32 " is supported",
+      xnn_operator_type_to_string(operator_type), output_zero_point, expected_output_zero_point);
     goto error;
   }
 
@@ -101,7 +113,7 @@ enum xnn_status xnn_create_softmax_nc_qu8(
   if (softmax_op == NULL) {
     xnn_log_error(
       "failed to allocate %zu bytes for %s operator descriptor",
-      sizeof(struct xnn_operator), xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8));
+      sizeof(struct xnn_operator), xnn_operator_type_to_string(operator_type));
     goto error;
   }
 
@@ -109,10 +121,12 @@ enum xnn_status xnn_create_softmax_nc_qu8(
   if (softmax_op->lookup_table == NULL) {
     xnn_log_error(
       "failed to allocate 256 bytes for %s operator lookup table",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8));
+      xnn_operator_type_to_string(operator_type));
     goto error;
   }
 
+  // Entry i holds the scaled exp((i - 255) * input_scale): the micro-kernels look up the maximum element of a row in
+  // the last entry, and smaller elements below it.
   uint32_t* lookup_table = softmax_op->lookup_table;
   const double qscale = fmin(((double) UINT32_MAX) / (double) channels, 8388607.0);
   for (int32_t i = 0; i < 256; i++) {
@@ -124,7 +138,7 @@ enum xnn_status xnn_create_softmax_nc_qu8(
   softmax_op->input_pixel_stride = input_stride;
   softmax_op->output_pixel_stride = output_stride;
 
-  softmax_op->type = xnn_operator_type_softmax_nc_qu8;
+  softmax_op->type = operator_type;
   softmax_op->flags = flags;
 
   softmax_op->state = xnn_run_state_invalid;
@@ -137,16 +151,49 @@ error:
   return status;
 }
 
-enum xnn_status xnn_setup_softmax_nc_qu8(
+enum xnn_status xnn_create_softmax_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    uint32_t flags,
+    xnn_operator_t* softmax_op_out)
+{
+  return create_softmax_nc_quantized(
+    channels, input_stride, output_stride,
+    input_scale, (int32_t) output_zero_point, -128, output_scale,
+    flags, XNN_INIT_FLAG_QS8, xnn_operator_type_softmax_nc_qs8, softmax_op_out);
+}
+
+enum xnn_status xnn_create_softmax_nc_qu8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint32_t flags,
+    xnn_operator_t* softmax_op_out)
+{
+  return create_softmax_nc_quantized(
+    channels, input_stride, output_stride,
+    input_scale, (int32_t) output_zero_point, 0, output_scale,
+    flags, XNN_INIT_FLAG_QU8, xnn_operator_type_softmax_nc_qu8, softmax_op_out);
+}
+
+static enum xnn_status setup_softmax_nc_quantized(
     xnn_operator_t softmax_op,
+    enum xnn_operator_type expected_operator_type,
     size_t batch_size,
-    const uint8_t* input,
-    uint8_t* output,
-    pthreadpool_t threadpool)
+    const void* input,
+    void* output,
+    xnn_softmax_ukernel_function ukernel)
 {
-  if (softmax_op->type != xnn_operator_type_softmax_nc_qu8) {
+  if (softmax_op->type != expected_operator_type) {
     xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
-      xnn_operator_type_to_string(xnn_operator_type_softmax_nc_qu8),
+      xnn_operator_type_to_string(expected_operator_type),
       xnn_operator_type_to_string(softmax_op->type));
     return xnn_status_invalid_parameter;
   }
@@ -154,7 +201,7 @@ enum xnn_status xnn_setup_softmax_nc_qu8(
 
   if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
     xnn_log_error("failed to setup %s operator: XNNPACK is not initialized",
-      xnn_operator_type_to_string(xnn_operator_type_sigmoid_nc_qu8));
+      xnn_operator_type_to_string(expected_operator_type));
     return xnn_status_uninitialized;
   }
 
@@ -167,24 +214,49 @@ enum xnn_status xnn_setup_softmax_nc_qu8(
   softmax_op->input = input;
   softmax_op->output = output;
 
-  softmax_op->context.u8_softmax = (struct u8_softmax_context) {
+  softmax_op->context.quantized_softmax = (struct quantized_softmax_context) {
     .n = softmax_op->channels,
     .x = input,
     .x_stride = softmax_op->input_pixel_stride * sizeof(uint8_t),
     .t = softmax_op->lookup_table,
     .y = output,
     .y_stride = softmax_op->output_pixel_stride * sizeof(uint8_t),
-    .rmax_ukernel = xnn_params.u8.rmax,
-    .lut_norm_ukernel = xnn_params.u8.lut32norm,
+    .ukernel = ukernel,
   };
   softmax_op->compute.type = xnn_parallelization_type_1d;
-  softmax_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_u8_softmax;
+  softmax_op->compute.task_1d = (pthreadpool_task_1d_t) xnn_compute_quantized_softmax;
   softmax_op->compute.range[0] = batch_size;
   softmax_op->state = xnn_run_state_ready;
 
   return xnn_status_success;
 }
 
+enum xnn_status xnn_setup_softmax_nc_qs8(
+    xnn_operator_t softmax_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_softmax_nc_quantized(
+    softmax_op, xnn_operator_type_softmax_nc_qs8,
+    batch_size, input, output,
+    (xnn_softmax_ukernel_function) xnn_params.qs8.softmax);
+}
+
+enum xnn_status xnn_setup_softmax_nc_qu8(
+    xnn_operator_t softmax_op,
+    size_t batch_size,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_softmax_nc_quantized(
+    softmax_op, xnn_operator_type_softmax_nc_qu8,
+    batch_size, input, output,
+    (xnn_softmax_ukernel_function) xnn_params.qu8.softmax);
+}
+
 static enum xnn_status create_softmax_nc_floating_point(
     size_t channels,
     size_t input_stride,
@@ -373,6 +373,21 @@ enum xnn_status xnn_create_ceiling_nc_f32(
     ceiling_op_out);
 }
 
+enum xnn_status xnn_create_convert_nc_bf16_f32(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out)
+{
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    NULL, 0,
+    xnn_operator_type_convert_nc_bf16_f32,
+    xnn_params.vcvt.bf16_to_f32.ukernel,
+    convert_op_out);
+}
+
 enum xnn_status xnn_create_convert_nc_f16_f32(
   size_t channels,
   size_t input_stride,
@@ -411,6 +426,21 @@ enum xnn_status xnn_create_convert_nc_f32_f16(
     convert_op_out);
 }
 
+enum xnn_status xnn_create_convert_nc_f32_bf16(
+  size_t channels,
+  size_t input_stride,
+  size_t output_stride,
+  uint32_t flags,
+  xnn_operator_t* convert_op_out)
+{
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    NULL, 0,
+    xnn_operator_type_convert_nc_f32_bf16,
+    xnn_params.vcvt.f32_to_bf16.ukernel,
+    convert_op_out);
+}
+
 enum xnn_status xnn_create_convert_nc_f32_qs8(
   size_t channels,
   size_t input_stride,
@@ -613,6 +643,50 @@ enum xnn_status xnn_create_elu_nc_f32(
     elu_op_out);
 }
 
+enum xnn_status xnn_create_exp_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* exp_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16 || xnn_params.f16.exp.ukernel == NULL) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_exp_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  union xnn_f16_exp_params params;
+  if (xnn_params.f16.exp.init.f16_exp != NULL) {
+    xnn_params.f16.exp.init.f16_exp(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_exp_nc_f16,
+    xnn_params.f16.exp.ukernel,
+    exp_op_out);
+}
+
+enum xnn_status xnn_create_exp_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* exp_op_out)
+{
+  union xnn_f32_exp_params params;
+  if (xnn_params.f32.exp.init.f32_exp != NULL) {
+    xnn_params.f32.exp.init.f32_exp(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_exp_nc_f32,
+    xnn_params.f32.exp.ukernel,
+    exp_op_out);
+}
+
 enum xnn_status xnn_create_floor_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -632,6 +706,50 @@ enum xnn_status xnn_create_floor_nc_f32(
     floor_op_out);
 }
 
+enum xnn_status xnn_create_gelu_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* gelu_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16 || xnn_params.f16.gelu.ukernel == NULL) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  union xnn_f16_gelu_params params;
+  if (xnn_params.f16.gelu.init.f16_gelu != NULL) {
+    xnn_params.f16.gelu.init.f16_gelu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_gelu_nc_f16,
+    xnn_params.f16.gelu.ukernel,
+    gelu_op_out);
+}
+
+enum xnn_status xnn_create_gelu_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* gelu_op_out)
+{
+  union xnn_f32_gelu_params params;
+  if (xnn_params.f32.gelu.init.f32_gelu != NULL) {
+    xnn_params.f32.gelu.init.f32_gelu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_gelu_nc_f32,
+    xnn_params.f32.gelu.ukernel,
+    gelu_op_out);
+}
+
 enum xnn_status xnn_create_hardswish_nc_f16(
     size_t channels,
     size_t input_stride,
@@ -682,6 +800,53 @@ enum xnn_status xnn_create_hardswish_nc_f32(
     hardswish_op_out);
 }
 
+enum xnn_status xnn_create_hardswish_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* hardswish_op_out)
+{
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_hardswish_nc_qs8), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_hardswish_nc_qs8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_hardswish_nc_qs8), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  union xnn_qs8_hswish_params params;
+  if (xnn_params.qs8.hswish.init.qs8_hswish != NULL) {
+    xnn_params.qs8.hswish.init.qs8_hswish(
+      &params, input_scale, output_scale, input_zero_point, output_zero_point, output_min, output_max);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_hardswish_nc_qs8,
+    xnn_params.qs8.hswish.ukernel,
+    hardswish_op_out);
+}
+
 enum xnn_status xnn_create_leaky_relu_nc_f16(
   size_t channels,
   size_t input_stride,
@@ -746,6 +911,122 @@ enum xnn_status xnn_create_leaky_relu_nc_f32(
     leaky_relu_op_out);
 }
 
+enum xnn_status xnn_create_leaky_relu_nc_qs8(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    float negative_slope,
+    int8_t input_zero_point,
+    float input_scale,
+    int8_t output_zero_point,
+    float output_scale,
+    int8_t output_min,
+    int8_t output_max,
+    uint32_t flags,
+    xnn_operator_t* leaky_relu_op_out)
+{
+  if (negative_slope <= 0.0f || !isnormal(negative_slope)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g negative slope: slope must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_leaky_relu_nc_qs8), negative_slope);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (negative_slope > 1.0f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g negative slope: slope must not exceed 1.0",
+      xnn_operator_type_to_string(xnn_operator_type_leaky_relu_nc_qs8), negative_slope);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_leaky_relu_nc_qs8), input_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g output scale: scale must be finite, normalized, and positive",
+      xnn_operator_type_to_string(xnn_operator_type_leaky_relu_nc_qs8), output_scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to create %s operator with [%" PRId8 ", %" PRId8 "] output range: range min must be below range max",
+      xnn_operator_type_to_string(xnn_operator_type_leaky_relu_nc_qs8), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-8f || input_output_scale >= 0x1.0p+8f) {
+    xnn_log_error(
+      "failed to create %s operator with %.7g input-to-output scale ratio: "
+      "scale ratio must be in [2**-8, 2**8) range",
+      xnn_operator_type_to_string(xnn_operator_type_leaky_relu_nc_qs8), input_output_scale);
+    return xnn_status_unsupported_parameter;
+  }
+
+  union xnn_qs8_lrelu_params params;
+  if (xnn_params.qs8.lrelu.init.qs8_lrelu != NULL) {
+    xnn_params.qs8.lrelu.init.qs8_lrelu(
+      &params, input_output_scale, input_output_scale * negative_slope,
+      input_zero_point, output_zero_point, output_min, output_max);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_leaky_relu_nc_qs8,
+    xnn_params.qs8.lrelu.ukernel,
+    leaky_relu_op_out);
+}
+
+enum xnn_status xnn_create_log_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* log_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16 || xnn_params.f16.log.ukernel == NULL) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_log_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  union xnn_f16_log_params params;
+  if (xnn_params.f16.log.init.f16_log != NULL) {
+    xnn_params.f16.log.init.f16_log(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_log_nc_f16,
+    xnn_params.f16.log.ukernel,
+    log_op_out);
+}
+
+enum xnn_status xnn_create_log_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* log_op_out)
+{
+  union xnn_f32_log_params params;
+  if (xnn_params.f32.log.init.f32_log != NULL) {
+    xnn_params.f32.log.init.f32_log(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_log_nc_f32,
+    xnn_params.f32.log.ukernel,
+    log_op_out);
+}
+
 enum xnn_status xnn_create_negate_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -809,6 +1090,50 @@ enum xnn_status xnn_create_sigmoid_nc_f32(
     sigmoid_op_out);
 }
 
+enum xnn_status xnn_create_silu_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* silu_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16 || xnn_params.f16.silu.ukernel == NULL) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_silu_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  union xnn_f16_silu_params params;
+  if (xnn_params.f16.silu.init.f16_silu != NULL) {
+    xnn_params.f16.silu.init.f16_silu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_silu_nc_f16,
+    xnn_params.f16.silu.ukernel,
+    silu_op_out);
+}
+
+enum xnn_status xnn_create_silu_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* silu_op_out)
+{
+  union xnn_f32_silu_params params;
+  if (xnn_params.f32.silu.init.f32_silu != NULL) {
+    xnn_params.f32.silu.init.f32_silu(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_silu_nc_f32,
+    xnn_params.f32.silu.ukernel,
+    silu_op_out);
+}
+
 enum xnn_status xnn_create_square_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -847,6 +1172,50 @@ enum xnn_status xnn_create_square_root_nc_f32(
     sqrt_op_out);
 }
 
+enum xnn_status xnn_create_tanh_nc_f16(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* tanh_op_out)
+{
+  if ((xnn_params.init_flags & XNN_INIT_FLAG_F16) != XNN_INIT_FLAG_F16 || xnn_params.f16.tanh.ukernel == NULL) {
+    xnn_log_error("failed to create %s operator: operations on data type are not supported",
+      xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f16));
+    return xnn_status_unsupported_hardware;
+  }
+
+  union xnn_f16_tanh_params params;
+  if (xnn_params.f16.tanh.init.f16_tanh != NULL) {
+    xnn_params.f16.tanh.init.f16_tanh(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_tanh_nc_f16,
+    xnn_params.f16.tanh.ukernel,
+    tanh_op_out);
+}
+
+enum xnn_status xnn_create_tanh_nc_f32(
+    size_t channels,
+    size_t input_stride,
+    size_t output_stride,
+    uint32_t flags,
+    xnn_operator_t* tanh_op_out)
+{
+  union xnn_f32_tanh_params params;
+  if (xnn_params.f32.tanh.init.f32_tanh != NULL) {
+    xnn_params.f32.tanh.init.f32_tanh(&params);
+  }
+  return create_unary_elementwise_nc(
+    channels, input_stride, output_stride, flags,
+    &params, sizeof(params),
+    xnn_operator_type_tanh_nc_f32,
+    xnn_params.f32.tanh.ukernel,
+    tanh_op_out);
+}
+
 enum xnn_status xnn_create_truncation_nc_f32(
     size_t channels,
     size_t input_stride,
@@ -1034,6 +1403,30 @@ enum xnn_status xnn_setup_clamp_nc_u8(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_convert_nc_bf16_f32(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const void* input,
+  float* output,
+  pthreadpool_t threadpool)
+{
+  if (convert_op->type != xnn_operator_type_convert_nc_bf16_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_bf16_f32),
+      xnn_operator_type_to_string(convert_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  convert_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    convert_op,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    2 /* log2(sizeof(float)) */,
+    NULL, 0,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_convert_nc_f16_f32(
   xnn_operator_t convert_op,
   size_t batch_size,
@@ -1082,6 +1475,30 @@ enum xnn_status xnn_setup_convert_nc_f32_f16(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_convert_nc_f32_bf16(
+  xnn_operator_t convert_op,
+  size_t batch_size,
+  const float* input,
+  void* output,
+  pthreadpool_t threadpool)
+{
+  if (convert_op->type != xnn_operator_type_convert_nc_f32_bf16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_convert_nc_f32_bf16),
+      xnn_operator_type_to_string(convert_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  convert_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    convert_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    NULL, 0,
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_convert_nc_f32_qs8(
   xnn_operator_t convert_op,
   size_t batch_size,
@@ -1274,6 +1691,54 @@ enum xnn_status xnn_setup_elu_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_exp_nc_f16(
+    xnn_operator_t exp_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (exp_op->type != xnn_operator_type_exp_nc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_exp_nc_f16),
+      xnn_operator_type_to_string(exp_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  exp_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    exp_op,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &exp_op->params.f16_exp, sizeof(exp_op->params.f16_exp),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_exp_nc_f32(
+    xnn_operator_t exp_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (exp_op->type != xnn_operator_type_exp_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_exp_nc_f32),
+      xnn_operator_type_to_string(exp_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  exp_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    exp_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &exp_op->params.f32_exp, sizeof(exp_op->params.f32_exp),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_floor_nc_f32(
     xnn_operator_t floor_op,
     size_t batch_size,
@@ -1298,6 +1763,54 @@ enum xnn_status xnn_setup_floor_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_gelu_nc_f16(
+    xnn_operator_t gelu_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (gelu_op->type != xnn_operator_type_gelu_nc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f16),
+      xnn_operator_type_to_string(gelu_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  gelu_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    gelu_op,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &gelu_op->params.f16_gelu, sizeof(gelu_op->params.f16_gelu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_gelu_nc_f32(
+    xnn_operator_t gelu_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (gelu_op->type != xnn_operator_type_gelu_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_gelu_nc_f32),
+      xnn_operator_type_to_string(gelu_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  gelu_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    gelu_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &gelu_op->params.f32_gelu, sizeof(gelu_op->params.f32_gelu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_hardswish_nc_f16(
     xnn_operator_t hardswish_op,
     size_t batch_size,
@@ -1346,6 +1859,30 @@ enum xnn_status xnn_setup_hardswish_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_hardswish_nc_qs8(
+    xnn_operator_t hardswish_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (hardswish_op->type != xnn_operator_type_hardswish_nc_qs8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_hardswish_nc_qs8),
+      xnn_operator_type_to_string(hardswish_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  hardswish_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    hardswish_op,
+    batch_size, input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(int8_t)) */,
+    &hardswish_op->params.qs8_hswish, sizeof(hardswish_op->params.qs8_hswish),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_leaky_relu_nc_f16(
   xnn_operator_t leaky_relu_op,
   size_t batch_size,
@@ -1394,6 +1931,78 @@ enum xnn_status xnn_setup_leaky_relu_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_leaky_relu_nc_qs8(
+    xnn_operator_t leaky_relu_op,
+    size_t batch_size,
+    const int8_t* input,
+    int8_t* output,
+    pthreadpool_t threadpool)
+{
+  if (leaky_relu_op->type != xnn_operator_type_leaky_relu_nc_qs8) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_leaky_relu_nc_qs8),
+      xnn_operator_type_to_string(leaky_relu_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  leaky_relu_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    leaky_relu_op,
+    batch_size, input, output,
+    0 /* log2(sizeof(int8_t)) */,
+    0 /* log2(sizeof(int8_t)) */,
+    &leaky_relu_op->params.qs8_lrelu, sizeof(leaky_relu_op->params.qs8_lrelu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_log_nc_f16(
+    xnn_operator_t log_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (log_op->type != xnn_operator_type_log_nc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_log_nc_f16),
+      xnn_operator_type_to_string(log_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  log_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    log_op,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &log_op->params.f16_log, sizeof(log_op->params.f16_log),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_log_nc_f32(
+    xnn_operator_t log_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (log_op->type != xnn_operator_type_log_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_log_nc_f32),
+      xnn_operator_type_to_string(log_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  log_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    log_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &log_op->params.f32_log, sizeof(log_op->params.f32_log),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_negate_nc_f32(
     xnn_operator_t negate_op,
     size_t batch_size,
@@ -1466,6 +2075,54 @@ enum xnn_status xnn_setup_sigmoid_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_silu_nc_f16(
+    xnn_operator_t silu_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (silu_op->type != xnn_operator_type_silu_nc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_silu_nc_f16),
+      xnn_operator_type_to_string(silu_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  silu_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    silu_op,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &silu_op->params.f16_silu, sizeof(silu_op->params.f16_silu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_silu_nc_f32(
+    xnn_operator_t silu_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (silu_op->type != xnn_operator_type_silu_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_silu_nc_f32),
+      xnn_operator_type_to_string(silu_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  silu_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    silu_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &silu_op->params.f32_silu, sizeof(silu_op->params.f32_silu),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_square_nc_f32(
     xnn_operator_t square_op,
     size_t batch_size,
@@ -1514,6 +2171,54 @@ enum xnn_status xnn_setup_square_root_nc_f32(
     pthreadpool_get_threads_count(threadpool));
 }
 
+enum xnn_status xnn_setup_tanh_nc_f16(
+    xnn_operator_t tanh_op,
+    size_t batch_size,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (tanh_op->type != xnn_operator_type_tanh_nc_f16) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f16),
+      xnn_operator_type_to_string(tanh_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  tanh_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    tanh_op,
+    batch_size, input, output,
+    1 /* log2(sizeof(uint16_t)) */,
+    1 /* log2(sizeof(uint16_t)) */,
+    &tanh_op->params.f16_tanh, sizeof(tanh_op->params.f16_tanh),
+    pthreadpool_get_threads_count(threadpool));
+}
+
+enum xnn_status xnn_setup_tanh_nc_f32(
+    xnn_operator_t tanh_op,
+    size_t batch_size,
+    const float* input,
+    float* output,
+    pthreadpool_t threadpool)
+{
+  if (tanh_op->type != xnn_operator_type_tanh_nc_f32) {
+    xnn_log_error("failed to setup operator: operator type mismatch (expected %s, got %s)",
+      xnn_operator_type_to_string(xnn_operator_type_tanh_nc_f32),
+      xnn_operator_type_to_string(tanh_op->type));
+    return xnn_status_invalid_parameter;
+  }
+  tanh_op->state = xnn_run_state_invalid;
+
+  return setup_unary_elementwise_nc(
+    tanh_op,
+    batch_size, input, output,
+    2 /* log2(sizeof(float)) */,
+    2 /* log2(sizeof(float)) */,
+    &tanh_op->params.f32_tanh, sizeof(tanh_op->params.f32_tanh),
+    pthreadpool_get_threads_count(threadpool));
+}
+
 enum xnn_status xnn_setup_truncation_nc_f32(
     xnn_operator_t truncation_op,
     size_t batch_size,
@@ -158,6 +158,102 @@ void xnn_pack_f32_to_f16_gemm_goi_w(
   } while (--g != 0);
 }
 
+void xnn_pack_bf16_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint16_t* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params)
+{
+  assert(nr >= sr);
+
+  const size_t skr = sr * kr;
+  do {
+    for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+      const size_t nr_block_size = min(nc - nr_block_start, nr);
+      float* packed_b = (float*) packed_w;
+      if XNN_LIKELY(b != NULL) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          packed_b[nr_block_offset] = b[nr_block_start + nr_block_offset];
+        }
+      }
+      uint16_t* packed_k = (uint16_t*) (packed_b + nr);
+
+      for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+            const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
+            if (kc_idx < kc) {
+              packed_k[kr_block_offset] = k[(nr_block_start + nr_block_offset) * kc + kc_idx];
+            }
+          }
+          packed_k += kr;
+        }
+        packed_k += (nr - nr_block_size) * kr;
+      }
+      packed_w = (void*) ((uintptr_t) packed_k + extra_bytes);
+    }
+    k += nc * kc;
+    if XNN_UNPREDICTABLE(b != NULL) {
+      b += nc;
+    }
+  } while (--g != 0);
+}
+
+void xnn_pack_f32_to_bf16_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const float* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params)
+{
+  assert(nr >= sr);
+
+  const size_t skr = sr * kr;
+  do {
+    for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+      const size_t nr_block_size = min(nc - nr_block_start, nr);
+      float* packed_b = (float*) packed_w;
+      if XNN_LIKELY(b != NULL) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          packed_b[nr_block_offset] = b[nr_block_start + nr_block_offset];
+        }
+      }
+      uint16_t* packed_k = (uint16_t*) (packed_b + nr);
+
+      for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+            const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
+            if (kc_idx < kc) {
+              packed_k[kr_block_offset] = math_cvt_bf16_fp32(k[(nr_block_start + nr_block_offset) * kc + kc_idx]);
+            }
+          }
+          packed_k += kr;
+        }
+        packed_k += (nr - nr_block_size) * kr;
+      }
+      packed_w = (void*) ((uintptr_t) packed_k + extra_bytes);
+    }
+    k += nc * kc;
+    if XNN_UNPREDICTABLE(b != NULL) {
+      b += nc;
+    }
+  } while (--g != 0);
+}
+
 void xnn_pack_qu8_gemm_goi_w(
   size_t g,
   size_t nc,
@@ -279,6 +375,106 @@ void xnn_pack_qs8_gemm_goi_w(
   } while (--g != 0);
 }
 
+// Packs 4-bit weights, stored with two elements per byte (the even element along K in the low nibble), into blocks of
+// NR output channels. Every byte of packed weights holds a pair of consecutive elements along K of an output channel,
+// and KR elements of a channel (or a single pair for KR = 1) are stored contiguously. Elements past KC are padded with
+// the kernel zero point, so they decode to zero.
+static void pack_qc4w_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint8_t* k,
+  const int32_t* b,
+  void* packed_w,
+  size_t extra_bytes,
+  size_t bias_element_size,
+  int32_t izp,
+  uint32_t kzp)
+{
+  assert(sr == 1);
+  assert(kzp <= 15);
+
+  const size_t skr = max(kr, 2);
+  const size_t k_stride = (kc + 1) >> 1;
+  do {
+    for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+      const size_t nr_block_size = min(nc - nr_block_start, nr);
+      int32_t* packed_b = (int32_t*) packed_w;
+      if (bias_element_size != 0) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          packed_b[nr_block_offset] = b != NULL ? b[nr_block_start + nr_block_offset] : 0;
+        }
+        packed_w = (void*) ((uintptr_t) packed_w + nr * bias_element_size);
+      }
+
+      for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += skr) {
+        for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+          const uint8_t* k_row = k + (nr_block_start + nr_block_offset) * k_stride;
+          int32_t ksum = 0;
+          for (size_t kr_block_offset = 0; kr_block_offset < skr; kr_block_offset += 2) {
+            const size_t kc_idx = kr_block_start + kr_block_offset;
+            const uint32_t kv_lo = kc_idx < kc ? (uint32_t) (k_row[kc_idx >> 1] & 0xF) : kzp;
+            const uint32_t kv_hi = kc_idx + 1 < kc ? (uint32_t) (k_row[kc_idx >> 1] >> 4) : kzp;
+            ksum += (int32_t) kv_lo + (int32_t) kv_hi - 2 * (int32_t) kzp;
+            ((uint8_t*) packed_w)[kr_block_offset >> 1] = (uint8_t) (kv_lo | (kv_hi << 4));
+          }
+          if (bias_element_size != 0) {
+            packed_b[nr_block_offset] -= ksum * izp;
+          }
+          packed_w = (uint8_t*) packed_w + (skr >> 1);
+        }
+        packed_w = (uint8_t*) packed_w + (nr - nr_block_size) * (skr >> 1);
+      }
+      packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
+    }
+    k += nc * k_stride;
+    if XNN_UNPREDICTABLE(b != NULL) {
+      b += nc;
+    }
+  } while (--g != 0);
+}
+
+void xnn_pack_f32_qc4w_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint8_t* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const struct xnn_qs8_qc4w_packing_params* params)
+{
+  // Floating-point bias is stored after the per-channel scales, in the extra bytes of every block.
+  assert(b == NULL);
+  pack_qc4w_gemm_goi_w(
+    g, nc, kc, nr, kr, sr, k, NULL, packed_w, extra_bytes, 0 /* bias element size */,
+    0 /* input zero point */, (uint32_t) params->kernel_zero_point);
+}
+
+void xnn_pack_qs8_qc4w_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint8_t* k,
+  const int32_t* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const struct xnn_qs8_qc4w_packing_params* params)
+{
+  pack_qc4w_gemm_goi_w(
+    g, nc, kc, nr, kr, sr, k, b, packed_w, extra_bytes, sizeof(int32_t),
+    (int32_t) params->input_zero_point, (uint32_t) params->kernel_zero_point);
+}
+
 void xnn_pack_qs8_gemm_xw_goi_w(
   size_t g,
   size_t nc,
@@ -348,6 +544,7 @@ void xnn_pack_f32_gemm_io_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   assert(nr >= sr);
@@ -374,6 +571,7 @@ void xnn_pack_f32_gemm_io_w(
       }
       packed_w += (nr - nr_block_size) * kr;
     }
+    packed_w = (float*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
@@ -386,6 +584,7 @@ void xnn_pack_f16_gemm_io_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   assert(nr >= sr);
@@ -412,6 +611,7 @@ void xnn_pack_f16_gemm_io_w(
       }
       packed_w += (nr - nr_block_size) * kr;
     }
+    packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
@@ -424,6 +624,7 @@ void xnn_pack_f32_to_f16_gemm_io_w(
   const float* k,
   const float* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params)
 {
   assert(nr >= sr);
@@ -450,6 +651,89 @@ void xnn_pack_f32_to_f16_gemm_io_w(
       }
       packed_w += (nr - nr_block_size) * kr;
     }
+    packed_w = (uint16_t*) ((uintptr_t) packed_w + extra_bytes);
+  }
+}
+
+void xnn_pack_bf16_gemm_io_w(
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint16_t* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params)
+{
+  assert(nr >= sr);
+
+  const size_t skr = sr * kr;
+  for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+    const size_t nr_block_size = min(nc - nr_block_start, nr);
+    float* packed_b = (float*) packed_w;
+    if XNN_LIKELY(b != NULL) {
+      for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+        packed_b[nr_block_offset] = b[nr_block_start + nr_block_offset];
+      }
+    }
+    uint16_t* packed_k = (uint16_t*) (packed_b + nr);
+
+    for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+      for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+        for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+          const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
+          if (kc_idx < kc) {
+            packed_k[kr_block_offset] = k[kc_idx * nc + nr_block_start + nr_block_offset];
+          }
+        }
+        packed_k += kr;
+      }
+      packed_k += (nr - nr_block_size) * kr;
+    }
+    packed_w = (void*) ((uintptr_t) packed_k + extra_bytes);
+  }
+}
+
+void xnn_pack_f32_to_bf16_gemm_io_w(
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const float* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params)
+{
+  assert(nr >= sr);
+
+  const size_t skr = sr * kr;
+  for (size_t nr_block_start = 0; nr_block_start < nc; nr_block_start += nr) {
+    const size_t nr_block_size = min(nc - nr_block_start, nr);
+    float* packed_b = (float*) packed_w;
+    if XNN_LIKELY(b != NULL) {
+      for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+        packed_b[nr_block_offset] = b[nr_block_start + nr_block_offset];
+      }
+    }
+    uint16_t* packed_k = (uint16_t*) (packed_b + nr);
+
+    for (size_t kr_block_start = 0; kr_block_start < round_up_po2(kc, skr); kr_block_start += kr) {
+      for (size_t nr_block_offset = 0; nr_block_offset < nr_block_size; nr_block_offset++) {
+        for (size_t kr_block_offset = 0; kr_block_offset < kr; kr_block_offset++) {
+          const size_t kc_idx = round_down_po2(kr_block_start, skr) + ((kr_block_start + kr_block_offset + nr_block_offset * kr) & (skr - 1));
+          if (kc_idx < kc) {
+            packed_k[kr_block_offset] = math_cvt_bf16_fp32(k[kc_idx * nc + nr_block_start + nr_block_offset]);
+          }
+        }
+        packed_k += kr;
+      }
+      packed_k += (nr - nr_block_size) * kr;
+    }
+    packed_w = (void*) ((uintptr_t) packed_k + extra_bytes);
   }
 }
 
@@ -462,6 +746,7 @@ void xnn_pack_qu8_gemm_io_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params)
 {
   assert(nr >= sr);
@@ -502,6 +787,7 @@ void xnn_pack_qu8_gemm_io_w(
       }
       packed_w = (uint8_t*) packed_w + (nr - nr_block_size) * kr;
     }
+    packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
@@ -514,6 +800,7 @@ void xnn_pack_qs8_gemm_io_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params)
 {
   assert(nr >= sr);
@@ -553,6 +840,7 @@ void xnn_pack_qs8_gemm_io_w(
       }
       packed_w = (int8_t*) packed_w + (nr - nr_block_size) * kr;
     }
+    packed_w = (void*) ((uintptr_t) packed_w + extra_bytes);
   }
 }
 
@@ -1997,6 +2285,43 @@ void xnn_pack_f32_chw_dwconv_hwg_w(
   }
 }
 
+void xnn_pack_f32_winograd_2x2_3x3_filter(
+  size_t nc,
+  size_t kc,
+  const float* k,
+  float* transformed_k)
+{
+  const size_t position_stride = nc * kc;
+  for (size_t oc = 0; oc < nc; oc++) {
+    for (size_t ic = 0; ic < kc; ic++) {
+      float g[3][3];
+      for (size_t ky = 0; ky < 3; ky++) {
+        for (size_t kx = 0; kx < 3; kx++) {
+          g[ky][kx] = k[(oc * 9 + ky * 3 + kx) * kc + ic];
+        }
+      }
+
+      // Rows: T = G * g, with G = [[1, 0, 0], [1/2, 1/2, 1/2], [1/2, -1/2, 1/2], [0, 0, 1]].
+      float t[4][3];
+      for (size_t kx = 0; kx < 3; kx++) {
+        t[0][kx] = g[0][kx];
+        t[1][kx] = 0.5f * (g[0][kx] + g[1][kx] + g[2][kx]);
+        t[2][kx] = 0.5f * (g[0][kx] - g[1][kx] + g[2][kx]);
+        t[3][kx] = g[2][kx];
+      }
+
+      // Columns: U = T * G^T.
+      float* u = transformed_k + oc * kc + ic;
+      for (size_t r = 0; r < 4; r++) {
+        u[(r * 4 + 0) * position_stride] = t[r][0];
+        u[(r * 4 + 1) * position_stride] = 0.5f * (t[r][0] + t[r][1] + t[r][2]);
+        u[(r * 4 + 2) * position_stride] = 0.5f * (t[r][0] - t[r][1] + t[r][2]);
+        u[(r * 4 + 3) * position_stride] = t[r][2];
+      }
+    }
+  }
+}
+
 void xnn_pack_f32_vmulcaddc_w(
   size_t c,
   size_t cr,
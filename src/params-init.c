@@ -1877,6 +1877,36 @@ void xnn_init_f32_minmax_scalar_params(
   params->scalar.max = output_max;
 }
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_qc4w_minmax_avx_params(
+  union xnn_f32_qc4w_minmax_params params[XNN_MIN_ELEMENTS(1)],
+  float output_min,
+  float output_max,
+  uint8_t kernel_zero_point)
+{
+  assert(kernel_zero_point <= 15);
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx.min[i] = output_min;
+    params->avx.max[i] = output_max;
+  }
+  for (uint32_t i = 0; i < 32; i++) {
+    params->avx.kernel_lut[i] = (int8_t) ((int32_t) (i & 15) - (int32_t) kernel_zero_point);
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_f32_qc4w_minmax_scalar_params(
+  union xnn_f32_qc4w_minmax_params params[XNN_MIN_ELEMENTS(1)],
+  float output_min,
+  float output_max,
+  uint8_t kernel_zero_point)
+{
+  assert(kernel_zero_point <= 15);
+  params->scalar.min = output_min;
+  params->scalar.max = output_max;
+  params->scalar.minus_kernel_zero_point = -(int32_t) kernel_zero_point;
+}
+
 #if XNN_ARCH_ARM || XNN_ARCH_ARM64
 void xnn_init_f16_hswish_neon_params(
   union xnn_f16_hswish_params params[XNN_MIN_ELEMENTS(1)])
@@ -2310,6 +2340,588 @@ void xnn_init_f32_sigmoid_wasmsimd_rr2_p5_params(
 }
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f16_exp_avx2_rr2_p5_params(
+  union xnn_f16_exp_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_rr2_p5.log2e[i] = 0x1.715476p+0f;
+    params->avx2_rr2_p5.magic_bias[i] = 0x1.800000p+23f;
+    params->avx2_rr2_p5.minus_ln2_hi[i] = -0x1.62E400p-1f;
+    params->avx2_rr2_p5.minus_ln2_lo[i] = -0x1.7F7D1Cp-20f;
+    params->avx2_rr2_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->avx2_rr2_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->avx2_rr2_p5.c3[i] = 0x1.555A80p-3f;
+    params->avx2_rr2_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->avx2_rr2_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->avx2_rr2_p5.min_exponent[i] = (int32_t) UINT32_C(0xC1000000);
+    params->avx2_rr2_p5.max_exponent[i] = INT32_C(0x3F800000);
+    params->avx2_rr2_p5.zero_cutoff[i] = -0x1.9FE368p+6f;
+    params->avx2_rr2_p5.inf_cutoff[i] = 0x1.62E42Ep+6f;
+    params->avx2_rr2_p5.plus_inf[i] = INFINITY;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_f32_exp_scalar_rr2_p5_params(
+  union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->scalar_rr2_p5.log2e = 0x1.715476p+0f;
+  params->scalar_rr2_p5.magic_bias = 0x1.800000p+23f;
+  params->scalar_rr2_p5.minus_ln2_hi = -0x1.62E400p-1f;
+  params->scalar_rr2_p5.minus_ln2_lo = -0x1.7F7D1Cp-20f;
+  params->scalar_rr2_p5.c5 = 0x1.0F9F9Cp-7f;
+  params->scalar_rr2_p5.c4 = 0x1.573A1Ap-5f;
+  params->scalar_rr2_p5.c3 = 0x1.555A80p-3f;
+  params->scalar_rr2_p5.c2 = 0x1.FFFDC6p-2f;
+  params->scalar_rr2_p5.c1 = 0x1.FFFFF6p-1f;
+  params->scalar_rr2_p5.min_exponent = (int32_t) UINT32_C(0xC1000000);
+  params->scalar_rr2_p5.max_exponent = INT32_C(0x3F800000);
+  params->scalar_rr2_p5.zero_cutoff = -0x1.9FE368p+6f;
+  params->scalar_rr2_p5.inf_cutoff = 0x1.62E42Ep+6f;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_f32_exp_neon_rr2_p5_params(
+  union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neon_rr2_p5.log2e = 0x1.715476p+0f;
+  params->neon_rr2_p5.magic_bias = 0x1.800000p+23f;
+  params->neon_rr2_p5.minus_ln2_hi = -0x1.62E400p-1f;
+  params->neon_rr2_p5.minus_ln2_lo = -0x1.7F7D1Cp-20f;
+  params->neon_rr2_p5.c5 = 0x1.0F9F9Cp-7f;
+  params->neon_rr2_p5.c4 = 0x1.573A1Ap-5f;
+  params->neon_rr2_p5.c3 = 0x1.555A80p-3f;
+  params->neon_rr2_p5.c2 = 0x1.FFFDC6p-2f;
+  params->neon_rr2_p5.c1 = 0x1.FFFFF6p-1f;
+  params->neon_rr2_p5.min_exponent = (int32_t) UINT32_C(0xC1000000);
+  params->neon_rr2_p5.max_exponent = INT32_C(0x3F800000);
+  params->neon_rr2_p5.zero_cutoff = -0x1.9FE368p+6f;
+  params->neon_rr2_p5.inf_cutoff = 0x1.62E42Ep+6f;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_exp_sse2_rr2_p5_params(
+  union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse2_rr2_p5.log2e[i] = 0x1.715476p+0f;
+    params->sse2_rr2_p5.magic_bias[i] = 0x1.800000p+23f;
+    params->sse2_rr2_p5.minus_ln2_hi[i] = -0x1.62E400p-1f;
+    params->sse2_rr2_p5.minus_ln2_lo[i] = -0x1.7F7D1Cp-20f;
+    params->sse2_rr2_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->sse2_rr2_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->sse2_rr2_p5.c3[i] = 0x1.555A80p-3f;
+    params->sse2_rr2_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->sse2_rr2_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->sse2_rr2_p5.min_exponent[i] = (int32_t) UINT32_C(0xC1000000);
+    params->sse2_rr2_p5.max_exponent[i] = INT32_C(0x3F800000);
+    params->sse2_rr2_p5.zero_cutoff[i] = -0x1.9FE368p+6f;
+    params->sse2_rr2_p5.inf_cutoff[i] = 0x1.62E42Ep+6f;
+    params->sse2_rr2_p5.plus_inf[i] = INFINITY;
+  }
+}
+
+void xnn_init_f32_exp_avx2_rr2_p5_params(
+  union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_rr2_p5.log2e[i] = 0x1.715476p+0f;
+    params->avx2_rr2_p5.magic_bias[i] = 0x1.800000p+23f;
+    params->avx2_rr2_p5.minus_ln2_hi[i] = -0x1.62E400p-1f;
+    params->avx2_rr2_p5.minus_ln2_lo[i] = -0x1.7F7D1Cp-20f;
+    params->avx2_rr2_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->avx2_rr2_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->avx2_rr2_p5.c3[i] = 0x1.555A80p-3f;
+    params->avx2_rr2_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->avx2_rr2_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->avx2_rr2_p5.min_exponent[i] = (int32_t) UINT32_C(0xC1000000);
+    params->avx2_rr2_p5.max_exponent[i] = INT32_C(0x3F800000);
+    params->avx2_rr2_p5.zero_cutoff[i] = -0x1.9FE368p+6f;
+    params->avx2_rr2_p5.inf_cutoff[i] = 0x1.62E42Ep+6f;
+    params->avx2_rr2_p5.plus_inf[i] = INFINITY;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx2_rr2_p5.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx2_rr2_p5.mask_table[i] = 0;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f16_gelu_avx2_rr1_p5_params(
+  union xnn_f16_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_rr1_p5.alpha[i] = 0x1.988454p+0f;
+    params->avx2_rr1_p5.beta[i] = 0x1.2444F2p-4f;
+    params->avx2_rr1_p5.sign_mask[i] = -0.0f;
+    params->avx2_rr1_p5.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx2_rr1_p5.log2e[i] = 0x1.715476p0f;
+    params->avx2_rr1_p5.minus_ln2[i] = -0x1.62E430p-1f;
+    params->avx2_rr1_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->avx2_rr1_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->avx2_rr1_p5.c3[i] = 0x1.555A80p-3f;
+    params->avx2_rr1_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->avx2_rr1_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->avx2_rr1_p5.one[i] = 1.0f;
+    params->avx2_rr1_p5.denorm_cutoff[i] = -0x1.5D589Ep+6f;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_f32_gelu_scalar_rr2_p5_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->scalar_rr2_p5.alpha = 0x1.988454p+0f;
+  params->scalar_rr2_p5.beta = 0x1.2444F2p-4f;
+  params->scalar_rr2_p5.magic_bias = 0x1.8000FEp23f;
+  params->scalar_rr2_p5.minus_log2e = -0x1.715476p0f;
+  params->scalar_rr2_p5.ln2_hi = 0x1.62E400p-1f;
+  params->scalar_rr2_p5.ln2_lo = 0x1.7F7D1Cp-20f;
+  params->scalar_rr2_p5.c5 = -0x1.0F9F9Cp-7f;
+  params->scalar_rr2_p5.c4 = 0x1.573A1Ap-5f;
+  params->scalar_rr2_p5.c3 = -0x1.555A80p-3f;
+  params->scalar_rr2_p5.c2 = 0x1.FFFDC6p-2f;
+  params->scalar_rr2_p5.c1 = -0x1.FFFFF6p-1f;
+  params->scalar_rr2_p5.one = 1.0f;
+  params->scalar_rr2_p5.denorm_cutoff = 0x1.5D589Ep+6f;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_f32_gelu_neon_rr2_p5_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neon_rr2_p5.alpha = 0x1.988454p+0f;
+  params->neon_rr2_p5.beta = 0x1.2444F2p-4f;
+  params->neon_rr2_p5.magic_bias = 0x1.8000FEp23f;
+  params->neon_rr2_p5.minus_log2e = -0x1.715476p0f;
+  params->neon_rr2_p5.ln2_hi = 0x1.62E400p-1f;
+  params->neon_rr2_p5.ln2_lo = 0x1.7F7D1Cp-20f;
+  params->neon_rr2_p5.c5 = -0x1.0F9F9Cp-7f;
+  params->neon_rr2_p5.c4 = 0x1.573A1Ap-5f;
+  params->neon_rr2_p5.c3 = -0x1.555A80p-3f;
+  params->neon_rr2_p5.c2 = 0x1.FFFDC6p-2f;
+  params->neon_rr2_p5.c1 = -0x1.FFFFF6p-1f;
+  params->neon_rr2_p5.denorm_cutoff = 0x1.5D589Ep+6f;
+}
+
+void xnn_init_f32_gelu_neonfma_rr1_p5_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neonfma_rr1_p5.alpha = 0x1.988454p+0f;
+  params->neonfma_rr1_p5.beta = 0x1.2444F2p-4f;
+  params->neonfma_rr1_p5.magic_bias = 0x1.8000FEp23f;
+  params->neonfma_rr1_p5.minus_log2e = -0x1.715476p0f;
+  params->neonfma_rr1_p5.ln2 = 0x1.62E430p-1f;
+  params->neonfma_rr1_p5.c5 = -0x1.0F9F9Cp-7f;
+  params->neonfma_rr1_p5.c4 = 0x1.573A1Ap-5f;
+  params->neonfma_rr1_p5.c3 = -0x1.555A80p-3f;
+  params->neonfma_rr1_p5.c2 = 0x1.FFFDC6p-2f;
+  params->neonfma_rr1_p5.c1 = -0x1.FFFFF6p-1f;
+  params->neonfma_rr1_p5.denorm_cutoff = 0x1.5D589Ep+6f;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_gelu_sse2_rr2_p5_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse2_rr2_p5.alpha[i] = 0x1.988454p+0f;
+    params->sse2_rr2_p5.beta[i] = 0x1.2444F2p-4f;
+    params->sse2_rr2_p5.sign_mask[i] = -0.0f;
+    params->sse2_rr2_p5.magic_bias[i] = 0x1.8000FEp23f;
+    params->sse2_rr2_p5.log2e[i] = 0x1.715476p0f;
+    params->sse2_rr2_p5.minus_ln2_hi[i] = -0x1.62E400p-1f;
+    params->sse2_rr2_p5.minus_ln2_lo[i] = -0x1.7F7D1Cp-20f;
+    params->sse2_rr2_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->sse2_rr2_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->sse2_rr2_p5.c3[i] = 0x1.555A80p-3f;
+    params->sse2_rr2_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->sse2_rr2_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->sse2_rr2_p5.one[i] = 1.0f;
+    params->sse2_rr2_p5.denorm_cutoff[i] = -0x1.5D589Ep+6f;
+  }
+}
+
+void xnn_init_f32_gelu_avx2_rr1_p5_params(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_rr1_p5.alpha[i] = 0x1.988454p+0f;
+    params->avx2_rr1_p5.beta[i] = 0x1.2444F2p-4f;
+    params->avx2_rr1_p5.sign_mask[i] = -0.0f;
+    params->avx2_rr1_p5.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx2_rr1_p5.log2e[i] = 0x1.715476p0f;
+    params->avx2_rr1_p5.minus_ln2[i] = -0x1.62E430p-1f;
+    params->avx2_rr1_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->avx2_rr1_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->avx2_rr1_p5.c3[i] = 0x1.555A80p-3f;
+    params->avx2_rr1_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->avx2_rr1_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->avx2_rr1_p5.one[i] = 1.0f;
+    params->avx2_rr1_p5.denorm_cutoff[i] = -0x1.5D589Ep+6f;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx2_rr1_p5.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx2_rr1_p5.mask_table[i] = 0;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f16_log_avx2_p4_params(
+  union xnn_f16_log_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_p4.sqrt_half[i] = INT32_C(0x3F3504F3);
+    params->avx2_p4.mantissa_mask[i] = INT32_C(0x007FFFFF);
+    params->avx2_p4.one[i] = 1.0f;
+    params->avx2_p4.two[i] = 2.0f;
+    params->avx2_p4.half[i] = 0.5f;
+    params->avx2_p4.c4[i] = 0x1.F13C4Cp-3f;
+    params->avx2_p4.c3[i] = 0x1.23D3DCp-2f;
+    params->avx2_p4.c2[i] = 0x1.999C26p-2f;
+    params->avx2_p4.c1[i] = 0x1.555554p-1f;
+    params->avx2_p4.ln2_hi[i] = 0x1.62E300p-1f;
+    params->avx2_p4.ln2_lo[i] = 0x1.2FEFA2p-17f;
+    params->avx2_p4.minus_inf[i] = -INFINITY;
+    params->avx2_p4.plus_inf[i] = INFINITY;
+    params->avx2_p4.nan[i] = NAN;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_f32_log_scalar_p4_params(
+  union xnn_f32_log_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->scalar_p4.min_normal = 0x1.0p-126f;
+  params->scalar_p4.denorm_scale = 0x1.0p+23f;
+  params->scalar_p4.denorm_exponent = 23.0f;
+  params->scalar_p4.sqrt_half = INT32_C(0x3F3504F3);
+  params->scalar_p4.mantissa_mask = INT32_C(0x007FFFFF);
+  params->scalar_p4.one = 1.0f;
+  params->scalar_p4.two = 2.0f;
+  params->scalar_p4.half = 0.5f;
+  params->scalar_p4.c4 = 0x1.F13C4Cp-3f;
+  params->scalar_p4.c3 = 0x1.23D3DCp-2f;
+  params->scalar_p4.c2 = 0x1.999C26p-2f;
+  params->scalar_p4.c1 = 0x1.555554p-1f;
+  params->scalar_p4.ln2_hi = 0x1.62E300p-1f;
+  params->scalar_p4.ln2_lo = 0x1.2FEFA2p-17f;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_f32_log_neon_p4_params(
+  union xnn_f32_log_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neon_p4.min_normal = 0x1.0p-126f;
+  params->neon_p4.denorm_scale = 0x1.0p+23f;
+  params->neon_p4.denorm_exponent = 23.0f;
+  params->neon_p4.sqrt_half = INT32_C(0x3F3504F3);
+  params->neon_p4.mantissa_mask = INT32_C(0x007FFFFF);
+  params->neon_p4.half = 0.5f;
+  params->neon_p4.c4 = 0x1.F13C4Cp-3f;
+  params->neon_p4.c3 = 0x1.23D3DCp-2f;
+  params->neon_p4.c2 = 0x1.999C26p-2f;
+  params->neon_p4.c1 = 0x1.555554p-1f;
+  params->neon_p4.ln2_hi = 0x1.62E300p-1f;
+  params->neon_p4.ln2_lo = 0x1.2FEFA2p-17f;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_log_sse2_p4_params(
+  union xnn_f32_log_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse2_p4.min_normal[i] = 0x1.0p-126f;
+    params->sse2_p4.denorm_scale[i] = 0x1.0p+23f;
+    params->sse2_p4.denorm_exponent[i] = 23.0f;
+    params->sse2_p4.sqrt_half[i] = INT32_C(0x3F3504F3);
+    params->sse2_p4.mantissa_mask[i] = INT32_C(0x007FFFFF);
+    params->sse2_p4.one[i] = 1.0f;
+    params->sse2_p4.two[i] = 2.0f;
+    params->sse2_p4.half[i] = 0.5f;
+    params->sse2_p4.c4[i] = 0x1.F13C4Cp-3f;
+    params->sse2_p4.c3[i] = 0x1.23D3DCp-2f;
+    params->sse2_p4.c2[i] = 0x1.999C26p-2f;
+    params->sse2_p4.c1[i] = 0x1.555554p-1f;
+    params->sse2_p4.ln2_hi[i] = 0x1.62E300p-1f;
+    params->sse2_p4.ln2_lo[i] = 0x1.2FEFA2p-17f;
+    params->sse2_p4.minus_inf[i] = -INFINITY;
+    params->sse2_p4.plus_inf[i] = INFINITY;
+    params->sse2_p4.nan[i] = NAN;
+  }
+}
+
+void xnn_init_f32_log_avx2_p4_params(
+  union xnn_f32_log_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_p4.min_normal[i] = 0x1.0p-126f;
+    params->avx2_p4.denorm_scale[i] = 0x1.0p+23f;
+    params->avx2_p4.denorm_exponent[i] = 23.0f;
+    params->avx2_p4.sqrt_half[i] = INT32_C(0x3F3504F3);
+    params->avx2_p4.mantissa_mask[i] = INT32_C(0x007FFFFF);
+    params->avx2_p4.one[i] = 1.0f;
+    params->avx2_p4.two[i] = 2.0f;
+    params->avx2_p4.half[i] = 0.5f;
+    params->avx2_p4.c4[i] = 0x1.F13C4Cp-3f;
+    params->avx2_p4.c3[i] = 0x1.23D3DCp-2f;
+    params->avx2_p4.c2[i] = 0x1.999C26p-2f;
+    params->avx2_p4.c1[i] = 0x1.555554p-1f;
+    params->avx2_p4.ln2_hi[i] = 0x1.62E300p-1f;
+    params->avx2_p4.ln2_lo[i] = 0x1.2FEFA2p-17f;
+    params->avx2_p4.minus_inf[i] = -INFINITY;
+    params->avx2_p4.plus_inf[i] = INFINITY;
+    params->avx2_p4.nan[i] = NAN;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx2_p4.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx2_p4.mask_table[i] = 0;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f16_silu_avx2_rr1_p5_params(
+  union xnn_f16_silu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_rr1_p5.sign_mask[i] = -0.0f;
+    params->avx2_rr1_p5.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx2_rr1_p5.log2e[i] = 0x1.715476p0f;
+    params->avx2_rr1_p5.minus_ln2[i] = -0x1.62E430p-1f;
+    params->avx2_rr1_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->avx2_rr1_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->avx2_rr1_p5.c3[i] = 0x1.555A80p-3f;
+    params->avx2_rr1_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->avx2_rr1_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->avx2_rr1_p5.one[i] = 1.0f;
+    params->avx2_rr1_p5.denorm_cutoff[i] = -0x1.5D589Ep+6f;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_f32_silu_scalar_rr2_p5_params(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->scalar_rr2_p5.magic_bias = 0x1.8000FEp23f;
+  params->scalar_rr2_p5.minus_log2e = -0x1.715476p0f;
+  params->scalar_rr2_p5.ln2_hi = 0x1.62E400p-1f;
+  params->scalar_rr2_p5.ln2_lo = 0x1.7F7D1Cp-20f;
+  params->scalar_rr2_p5.c5 = -0x1.0F9F9Cp-7f;
+  params->scalar_rr2_p5.c4 = 0x1.573A1Ap-5f;
+  params->scalar_rr2_p5.c3 = -0x1.555A80p-3f;
+  params->scalar_rr2_p5.c2 = 0x1.FFFDC6p-2f;
+  params->scalar_rr2_p5.c1 = -0x1.FFFFF6p-1f;
+  params->scalar_rr2_p5.one = 1.0f;
+  params->scalar_rr2_p5.denorm_cutoff = 0x1.5D589Ep+6f;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_f32_silu_neon_rr2_p5_params(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neon_rr2_p5.magic_bias = 0x1.8000FEp23f;
+  params->neon_rr2_p5.minus_log2e = -0x1.715476p0f;
+  params->neon_rr2_p5.ln2_hi = 0x1.62E400p-1f;
+  params->neon_rr2_p5.ln2_lo = 0x1.7F7D1Cp-20f;
+  params->neon_rr2_p5.c5 = -0x1.0F9F9Cp-7f;
+  params->neon_rr2_p5.c4 = 0x1.573A1Ap-5f;
+  params->neon_rr2_p5.c3 = -0x1.555A80p-3f;
+  params->neon_rr2_p5.c2 = 0x1.FFFDC6p-2f;
+  params->neon_rr2_p5.c1 = -0x1.FFFFF6p-1f;
+  params->neon_rr2_p5.denorm_cutoff = 0x1.5D589Ep+6f;
+}
+
+void xnn_init_f32_silu_neonfma_rr1_p5_params(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neonfma_rr1_p5.magic_bias = 0x1.8000FEp23f;
+  params->neonfma_rr1_p5.minus_log2e = -0x1.715476p0f;
+  params->neonfma_rr1_p5.ln2 = 0x1.62E430p-1f;
+  params->neonfma_rr1_p5.c5 = -0x1.0F9F9Cp-7f;
+  params->neonfma_rr1_p5.c4 = 0x1.573A1Ap-5f;
+  params->neonfma_rr1_p5.c3 = -0x1.555A80p-3f;
+  params->neonfma_rr1_p5.c2 = 0x1.FFFDC6p-2f;
+  params->neonfma_rr1_p5.c1 = -0x1.FFFFF6p-1f;
+  params->neonfma_rr1_p5.denorm_cutoff = 0x1.5D589Ep+6f;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_silu_sse2_rr2_p5_params(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse2_rr2_p5.sign_mask[i] = -0.0f;
+    params->sse2_rr2_p5.magic_bias[i] = 0x1.8000FEp23f;
+    params->sse2_rr2_p5.log2e[i] = 0x1.715476p0f;
+    params->sse2_rr2_p5.minus_ln2_hi[i] = -0x1.62E400p-1f;
+    params->sse2_rr2_p5.minus_ln2_lo[i] = -0x1.7F7D1Cp-20f;
+    params->sse2_rr2_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->sse2_rr2_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->sse2_rr2_p5.c3[i] = 0x1.555A80p-3f;
+    params->sse2_rr2_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->sse2_rr2_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->sse2_rr2_p5.one[i] = 1.0f;
+    params->sse2_rr2_p5.denorm_cutoff[i] = -0x1.5D589Ep+6f;
+  }
+}
+
+void xnn_init_f32_silu_avx2_rr1_p5_params(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_rr1_p5.sign_mask[i] = -0.0f;
+    params->avx2_rr1_p5.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx2_rr1_p5.log2e[i] = 0x1.715476p0f;
+    params->avx2_rr1_p5.minus_ln2[i] = -0x1.62E430p-1f;
+    params->avx2_rr1_p5.c5[i] = 0x1.0F9F9Cp-7f;
+    params->avx2_rr1_p5.c4[i] = 0x1.573A1Ap-5f;
+    params->avx2_rr1_p5.c3[i] = 0x1.555A80p-3f;
+    params->avx2_rr1_p5.c2[i] = 0x1.FFFDC6p-2f;
+    params->avx2_rr1_p5.c1[i] = 0x1.FFFFF6p-1f;
+    params->avx2_rr1_p5.one[i] = 1.0f;
+    params->avx2_rr1_p5.denorm_cutoff[i] = -0x1.5D589Ep+6f;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx2_rr1_p5.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx2_rr1_p5.mask_table[i] = 0;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f16_tanh_avx2_expm1minus_rr1_p6_params(
+  union xnn_f16_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_expm1minus_rr1_p6.sign_mask[i] = -0.0f;
+    params->avx2_expm1minus_rr1_p6.sat_cutoff[i] = -0x1.154246p+4f;
+    params->avx2_expm1minus_rr1_p6.log2e[i] = 0x1.715476p+0f;
+    params->avx2_expm1minus_rr1_p6.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx2_expm1minus_rr1_p6.minus_ln2[i] = -0x1.62E430p-1f;
+    params->avx2_expm1minus_rr1_p6.c6[i] = 0x1.6B7338p-10f;
+    params->avx2_expm1minus_rr1_p6.c5[i] = 0x1.12278Ep-7f;
+    params->avx2_expm1minus_rr1_p6.c4[i] = 0x1.555716p-5f;
+    params->avx2_expm1minus_rr1_p6.c3[i] = 0x1.5554B0p-3f;
+    params->avx2_expm1minus_rr1_p6.c2[i] = 0x1.FFFFFEp-2f;
+    params->avx2_expm1minus_rr1_p6.minus_two[i] = -2.0f;
+    params->avx2_expm1minus_rr1_p6.one[i] = 1.0f;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->scalar_expm1minus_rr2_p6.sat_cutoff = -0x1.154246p+4f;
+  params->scalar_expm1minus_rr2_p6.log2e = 0x1.715476p+0f;
+  params->scalar_expm1minus_rr2_p6.magic_bias = 0x1.8000FEp23f;
+  params->scalar_expm1minus_rr2_p6.minus_ln2_hi = -0x1.62E440p-1f;
+  params->scalar_expm1minus_rr2_p6.minus_ln2_lo = 0x1.0105C6p-21f;
+  params->scalar_expm1minus_rr2_p6.c6 = 0x1.6B7338p-10f;
+  params->scalar_expm1minus_rr2_p6.c5 = 0x1.12278Ep-7f;
+  params->scalar_expm1minus_rr2_p6.c4 = 0x1.555716p-5f;
+  params->scalar_expm1minus_rr2_p6.c3 = 0x1.5554B0p-3f;
+  params->scalar_expm1minus_rr2_p6.c2 = 0x1.FFFFFEp-2f;
+  params->scalar_expm1minus_rr2_p6.minus_two = -2.0f;
+  params->scalar_expm1minus_rr2_p6.one = 1.0f;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_f32_tanh_neon_expm1minus_rr2_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neon_expm1minus_rr2_p6.sat_cutoff = -0x1.154246p+4f;
+  params->neon_expm1minus_rr2_p6.log2e = 0x1.715476p+0f;
+  params->neon_expm1minus_rr2_p6.magic_bias = 0x1.8000FEp23f;
+  params->neon_expm1minus_rr2_p6.minus_ln2_hi = -0x1.62E440p-1f;
+  params->neon_expm1minus_rr2_p6.minus_ln2_lo = 0x1.0105C6p-21f;
+  params->neon_expm1minus_rr2_p6.c6 = 0x1.6B7338p-10f;
+  params->neon_expm1minus_rr2_p6.c5 = 0x1.12278Ep-7f;
+  params->neon_expm1minus_rr2_p6.c4 = 0x1.555716p-5f;
+  params->neon_expm1minus_rr2_p6.c3 = 0x1.5554B0p-3f;
+  params->neon_expm1minus_rr2_p6.c2 = 0x1.FFFFFEp-2f;
+  params->neon_expm1minus_rr2_p6.minus_two = -2.0f;
+}
+
+void xnn_init_f32_tanh_neonfma_expm1minus_rr1_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  params->neonfma_expm1minus_rr1_p6.sat_cutoff = -0x1.154246p+4f;
+  params->neonfma_expm1minus_rr1_p6.log2e = 0x1.715476p+0f;
+  params->neonfma_expm1minus_rr1_p6.magic_bias = 0x1.8000FEp23f;
+  params->neonfma_expm1minus_rr1_p6.minus_ln2 = -0x1.62E430p-1f;
+  params->neonfma_expm1minus_rr1_p6.c6 = 0x1.6B7338p-10f;
+  params->neonfma_expm1minus_rr1_p6.c5 = 0x1.12278Ep-7f;
+  params->neonfma_expm1minus_rr1_p6.c4 = 0x1.555716p-5f;
+  params->neonfma_expm1minus_rr1_p6.c3 = 0x1.5554B0p-3f;
+  params->neonfma_expm1minus_rr1_p6.c2 = 0x1.FFFFFEp-2f;
+  params->neonfma_expm1minus_rr1_p6.minus_two = -2.0f;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_f32_tanh_sse2_expm1minus_rr2_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse2_expm1minus_rr2_p6.sign_mask[i] = -0.0f;
+    params->sse2_expm1minus_rr2_p6.sat_cutoff[i] = -0x1.154246p+4f;
+    params->sse2_expm1minus_rr2_p6.log2e[i] = 0x1.715476p+0f;
+    params->sse2_expm1minus_rr2_p6.magic_bias[i] = 0x1.8000FEp23f;
+    params->sse2_expm1minus_rr2_p6.minus_ln2_hi[i] = -0x1.62E440p-1f;
+    params->sse2_expm1minus_rr2_p6.minus_ln2_lo[i] = 0x1.0105C6p-21f;
+    params->sse2_expm1minus_rr2_p6.c6[i] = 0x1.6B7338p-10f;
+    params->sse2_expm1minus_rr2_p6.c5[i] = 0x1.12278Ep-7f;
+    params->sse2_expm1minus_rr2_p6.c4[i] = 0x1.555716p-5f;
+    params->sse2_expm1minus_rr2_p6.c3[i] = 0x1.5554B0p-3f;
+    params->sse2_expm1minus_rr2_p6.c2[i] = 0x1.FFFFFEp-2f;
+    params->sse2_expm1minus_rr2_p6.minus_two[i] = -2.0f;
+    params->sse2_expm1minus_rr2_p6.one[i] = 1.0f;
+  }
+}
+
+void xnn_init_f32_tanh_avx2_expm1minus_rr1_p6_params(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)])
+{
+  for (uint32_t i = 0; i < 8; i++) {
+    params->avx2_expm1minus_rr1_p6.sign_mask[i] = -0.0f;
+    params->avx2_expm1minus_rr1_p6.sat_cutoff[i] = -0x1.154246p+4f;
+    params->avx2_expm1minus_rr1_p6.log2e[i] = 0x1.715476p+0f;
+    params->avx2_expm1minus_rr1_p6.magic_bias[i] = 0x1.8000FEp23f;
+    params->avx2_expm1minus_rr1_p6.minus_ln2[i] = -0x1.62E430p-1f;
+    params->avx2_expm1minus_rr1_p6.c6[i] = 0x1.6B7338p-10f;
+    params->avx2_expm1minus_rr1_p6.c5[i] = 0x1.12278Ep-7f;
+    params->avx2_expm1minus_rr1_p6.c4[i] = 0x1.555716p-5f;
+    params->avx2_expm1minus_rr1_p6.c3[i] = 0x1.5554B0p-3f;
+    params->avx2_expm1minus_rr1_p6.c2[i] = 0x1.FFFFFEp-2f;
+    params->avx2_expm1minus_rr1_p6.minus_two[i] = -2.0f;
+    params->avx2_expm1minus_rr1_p6.one[i] = 1.0f;
+  }
+  for (uint32_t i = 0; i < 7; i++) {
+    params->avx2_expm1minus_rr1_p6.mask_table[i] = -1;
+  }
+  for (uint32_t i = 7; i < 14; i++) {
+    params->avx2_expm1minus_rr1_p6.mask_table[i] = 0;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
 void xnn_init_f32_abs_sse_params(
   union xnn_f32_abs_params params[XNN_MIN_ELEMENTS(1)])
@@ -3144,6 +3756,150 @@ void xnn_init_f32_lrelu_wasmsimd_params(
 }
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
+void xnn_init_qs8_lrelu_scalar_params(
+  union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)],
+  float positive_scale,
+  float negative_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(positive_scale >= 0x1.0p-8f);
+  assert(positive_scale < 0x1.0p+8f);
+  assert(fabsf(negative_scale) < 0x1.0p+8f);
+
+  params->scalar.input_zero_point = (int32_t) input_zero_point;
+  params->scalar.positive_multiplier = (int32_t) lrintf(positive_scale * 0x1.0p+12f);
+  params->scalar.negative_multiplier = (int32_t) lrintf(negative_scale * 0x1.0p+12f);
+  params->scalar.bias = ((int32_t) output_zero_point << 12) + INT32_C(0x800);
+  params->scalar.output_min = (int32_t) output_min;
+  params->scalar.output_max = (int32_t) output_max;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_qs8_lrelu_neon_params(
+  union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)],
+  float positive_scale,
+  float negative_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(positive_scale >= 0x1.0p-8f);
+  assert(positive_scale < 0x1.0p+8f);
+  assert(fabsf(negative_scale) < 0x1.0p+8f);
+
+  params->neon.input_zero_point = (int16_t) input_zero_point;
+  params->neon.positive_multiplier = (int32_t) lrintf(positive_scale * 0x1.0p+12f);
+  params->neon.negative_multiplier = (int32_t) lrintf(negative_scale * 0x1.0p+12f);
+  params->neon.bias = ((int32_t) output_zero_point << 12) + INT32_C(0x800);
+  params->neon.output_min = output_min;
+  params->neon.output_max = output_max;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_qs8_lrelu_sse4_params(
+  union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)],
+  float positive_scale,
+  float negative_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(positive_scale >= 0x1.0p-8f);
+  assert(positive_scale < 0x1.0p+8f);
+  assert(fabsf(negative_scale) < 0x1.0p+8f);
+
+  const int32_t positive_multiplier = (int32_t) lrintf(positive_scale * 0x1.0p+12f);
+  const int32_t negative_multiplier = (int32_t) lrintf(negative_scale * 0x1.0p+12f);
+  const int32_t bias = ((int32_t) output_zero_point << 12) + INT32_C(0x800);
+  for (uint32_t i = 0; i < 8; i++) {
+    params->sse4.input_zero_point[i] = (int16_t) input_zero_point;
+  }
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse4.positive_multiplier[i] = positive_multiplier;
+    params->sse4.negative_multiplier[i] = negative_multiplier;
+    params->sse4.bias[i] = bias;
+  }
+  for (uint32_t i = 0; i < 16; i++) {
+    params->sse4.output_min[i] = output_min;
+    params->sse4.output_max[i] = output_max;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+void xnn_init_qs8_hswish_scalar_params(
+  union xnn_qs8_hswish_params params[XNN_MIN_ELEMENTS(1)],
+  float input_scale,
+  float output_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  params->scalar.input_zero_point = (int32_t) input_zero_point;
+  params->scalar.gate_scale = input_scale / 6.0f;
+  params->scalar.scale = input_scale / output_scale;
+  params->scalar.output_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  params->scalar.output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  params->scalar.magic_bias = 12582912.0f;
+  params->scalar.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+}
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+void xnn_init_qs8_hswish_neon_params(
+  union xnn_qs8_hswish_params params[XNN_MIN_ELEMENTS(1)],
+  float input_scale,
+  float output_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  params->neon.input_zero_point = (int16_t) input_zero_point;
+  params->neon.gate_scale = input_scale / 6.0f;
+  params->neon.scale = input_scale / output_scale;
+  params->neon.magic_bias = 12582912.0f;
+  params->neon.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+  params->neon.output_min = output_min;
+  params->neon.output_max = output_max;
+}
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_qs8_hswish_sse4_params(
+  union xnn_qs8_hswish_params params[XNN_MIN_ELEMENTS(1)],
+  float input_scale,
+  float output_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max)
+{
+  const float gate_scale = input_scale / 6.0f;
+  const float scale = input_scale / output_scale;
+  const float output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  for (uint32_t i = 0; i < 8; i++) {
+    params->sse4.input_zero_point[i] = (int16_t) input_zero_point;
+    params->sse4.output_zero_point[i] = (int16_t) output_zero_point;
+  }
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse4.gate_scale[i] = gate_scale;
+    params->sse4.half[i] = 0.5f;
+    params->sse4.one[i] = 1.0f;
+    params->sse4.scale[i] = scale;
+    params->sse4.output_max_less_zero_point[i] = output_max_less_zero_point;
+  }
+  for (uint32_t i = 0; i < 16; i++) {
+    params->sse4.output_min[i] = output_min;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
 void xnn_init_f32_sqrt_avx_params(
   union xnn_f32_sqrt_params params[XNN_MIN_ELEMENTS(1)])
@@ -4682,6 +5438,64 @@ void xnn_init_qs8_mul_minmax_fp32_wasmsimd_params(
 }
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
+void xnn_init_qs8_binary_minmax_scalar_params(
+  union xnn_qs8_binary_minmax_params params[XNN_MIN_ELEMENTS(1)],
+  int8_t a_zero_point,
+  int8_t b_zero_point,
+  int8_t output_zero_point,
+  float a_scale,
+  float b_scale,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(output_min < output_max);
+
+  params->scalar.a_zero_point = (int32_t) a_zero_point;
+  params->scalar.b_zero_point = (int32_t) b_zero_point;
+  params->scalar.a_scale = a_scale;
+  params->scalar.b_scale = b_scale;
+  params->scalar.scale = 1.0f / output_scale;
+  params->scalar.output_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  params->scalar.output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  params->scalar.magic_bias = 12582912.0f;
+  params->scalar.magic_bias_less_output_zero_point = INT32_C(0x4B400000) - (int32_t) output_zero_point;
+}
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+void xnn_init_qs8_binary_minmax_sse4_params(
+  union xnn_qs8_binary_minmax_params params[XNN_MIN_ELEMENTS(1)],
+  int8_t a_zero_point,
+  int8_t b_zero_point,
+  int8_t output_zero_point,
+  float a_scale,
+  float b_scale,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max)
+{
+  assert(output_min < output_max);
+
+  const float output_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  for (uint32_t i = 0; i < 8; i++) {
+    params->sse4.a_zero_point[i] = (int16_t) a_zero_point;
+    params->sse4.b_zero_point[i] = (int16_t) b_zero_point;
+  }
+  for (uint32_t i = 0; i < 4; i++) {
+    params->sse4.a_scale[i] = a_scale;
+    params->sse4.b_scale[i] = b_scale;
+    params->sse4.scale[i] = 1.0f / output_scale;
+    params->sse4.output_max_less_zero_point[i] = output_max_less_zero_point;
+  }
+  for (uint32_t i = 0; i < 8; i++) {
+    params->sse4.output_zero_point[i] = (int16_t) output_zero_point;
+  }
+  for (uint32_t i = 0; i < 16; i++) {
+    params->sse4.output_min[i] = output_min;
+  }
+}
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
 XNN_INTERNAL void xnn_init_f16_f32_cvt_scalar_params(
   union xnn_f16_f32_cvt_params params[XNN_MIN_ELEMENTS(1)])
 {
@@ -0,0 +1,161 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qd8-f32-qc4w-gemm/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/gemm.h>
+
+
+void xnn_qd8_f32_qc4w_gemm_minmax_ukernel_1x4__scalar(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_qc4w_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(kc != 0);
+
+  const int8_t* a0 = a;
+  float* c0 = c;
+
+  const int32_t vzp0 = quantization_params[0].zero_point;
+  const float vinput_scale0 = quantization_params[0].scale;
+  const int32_t vminus_kernel_zero_point = params->scalar.minus_kernel_zero_point;
+  const float vmin = params->scalar.min;
+  const float vmax = params->scalar.max;
+  do {
+    // Packed weights start with the negated sums of the weights in every output channel: scaled by the zero point of
+    // the row, they cancel out the contribution of the zero point to the accumulators.
+    const int32_t vksum0 = ((const int32_t*) w)[0];
+    const int32_t vksum1 = ((const int32_t*) w)[1];
+    const int32_t vksum2 = ((const int32_t*) w)[2];
+    const int32_t vksum3 = ((const int32_t*) w)[3];
+    int32_t vacc0x0 = vksum0 * vzp0;
+    int32_t vacc0x1 = vksum1 * vzp0;
+    int32_t vacc0x2 = vksum2 * vzp0;
+    int32_t vacc0x3 = vksum3 * vzp0;
+    w = (const void*) ((const int32_t*) w + 4);
+
+    // Every byte of packed weights holds two consecutive elements along K of an output channel: the even element in
+    // the low nibble, and the odd element in the high nibble.
+    size_t k = kc;
+    for (; k >= 2 * sizeof(int8_t); k -= 2 * sizeof(int8_t)) {
+      const int32_t va0c0 = (int32_t) a0[0];
+      const int32_t va0c1 = (int32_t) a0[1];
+      a0 += 2;
+
+      const uint32_t vbi0 = (uint32_t) ((const uint8_t*) w)[0];
+      const uint32_t vbi1 = (uint32_t) ((const uint8_t*) w)[1];
+      const uint32_t vbi2 = (uint32_t) ((const uint8_t*) w)[2];
+      const uint32_t vbi3 = (uint32_t) ((const uint8_t*) w)[3];
+      w = (const void*) ((const uint8_t*) w + 4);
+      const int32_t vb0c0 = (int32_t) (vbi0 & UINT32_C(0xF)) + vminus_kernel_zero_point;
+      const int32_t vb0c1 = (int32_t) (vbi0 >> 4) + vminus_kernel_zero_point;
+      const int32_t vb1c0 = (int32_t) (vbi1 & UINT32_C(0xF)) + vminus_kernel_zero_point;
+      const int32_t vb1c1 = (int32_t) (vbi1 >> 4) + vminus_kernel_zero_point;
+      const int32_t vb2c0 = (int32_t) (vbi2 & UINT32_C(0xF)) + vminus_kernel_zero_point;
+      const int32_t vb2c1 = (int32_t) (vbi2 >> 4) + vminus_kernel_zero_point;
+      const int32_t vb3c0 = (int32_t) (vbi3 & UINT32_C(0xF)) + vminus_kernel_zero_point;
+      const int32_t vb3c1 = (int32_t) (vbi3 >> 4) + vminus_kernel_zero_point;
+
+      vacc0x0 += va0c0 * vb0c0;
+      vacc0x1 += va0c0 * vb1c0;
+      vacc0x2 += va0c0 * vb2c0;
+      vacc0x3 += va0c0 * vb3c0;
+      vacc0x0 += va0c1 * vb0c1;
+      vacc0x1 += va0c1 * vb1c1;
+      vacc0x2 += va0c1 * vb2c1;
+      vacc0x3 += va0c1 * vb3c1;
+    }
+    if XNN_UNLIKELY(k != 0) {
+      const int32_t va0 = (int32_t) *a0++;
+
+      const int32_t vb0 = (int32_t) (((const uint8_t*) w)[0] & UINT8_C(0xF)) + vminus_kernel_zero_point;
+      const int32_t vb1 = (int32_t) (((const uint8_t*) w)[1] & UINT8_C(0xF)) + vminus_kernel_zero_point;
+      const int32_t vb2 = (int32_t) (((const uint8_t*) w)[2] & UINT8_C(0xF)) + vminus_kernel_zero_point;
+      const int32_t vb3 = (int32_t) (((const uint8_t*) w)[3] & UINT8_C(0xF)) + vminus_kernel_zero_point;
+      w = (const void*) ((const uint8_t*) w + 4);
+
+      vacc0x0 += va0 * vb0;
+      vacc0x1 += va0 * vb1;
+      vacc0x2 += va0 * vb2;
+      vacc0x3 += va0 * vb3;
+    }
+
+    float vout0x0 = (float) vacc0x0 * vinput_scale0;
+    float vout0x1 = (float) vacc0x1 * vinput_scale0;
+    float vout0x2 = (float) vacc0x2 * vinput_scale0;
+    float vout0x3 = (float) vacc0x3 * vinput_scale0;
+
+    const float vfilter_scale0 = ((const float*) w)[0];
+    const float vfilter_scale1 = ((const float*) w)[1];
+    const float vfilter_scale2 = ((const float*) w)[2];
+    const float vfilter_scale3 = ((const float*) w)[3];
+    vout0x0 *= vfilter_scale0;
+    vout0x1 *= vfilter_scale1;
+    vout0x2 *= vfilter_scale2;
+    vout0x3 *= vfilter_scale3;
+    w = (const void*) ((const float*) w + 4);
+
+    const float vbias0 = ((const float*) w)[0];
+    const float vbias1 = ((const float*) w)[1];
+    const float vbias2 = ((const float*) w)[2];
+    const float vbias3 = ((const float*) w)[3];
+    vout0x0 += vbias0;
+    vout0x1 += vbias1;
+    vout0x2 += vbias2;
+    vout0x3 += vbias3;
+    w = (const void*) ((const float*) w + 4);
+
+    vout0x0 = math_max_f32(vout0x0, vmin);
+    vout0x1 = math_max_f32(vout0x1, vmin);
+    vout0x2 = math_max_f32(vout0x2, vmin);
+    vout0x3 = math_max_f32(vout0x3, vmin);
+
+    vout0x0 = math_min_f32(vout0x0, vmax);
+    vout0x1 = math_min_f32(vout0x1, vmax);
+    vout0x2 = math_min_f32(vout0x2, vmax);
+    vout0x3 = math_min_f32(vout0x3, vmax);
+
+    if XNN_LIKELY(nc >= 4) {
+      c0[0] = vout0x0;
+      c0[1] = vout0x1;
+      c0[2] = vout0x2;
+      c0[3] = vout0x3;
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+
+      nc -= 4;
+    } else {
+      if (nc & 2) {
+        c0[0] = vout0x0;
+        c0[1] = vout0x1;
+        vout0x0 = vout0x2;
+        c0 += 2;
+      }
+      if (nc & 1) {
+        c0[0] = vout0x0;
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
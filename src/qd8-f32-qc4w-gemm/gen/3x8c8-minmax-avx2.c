@@ -0,0 +1,225 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qd8-f32-qc4w-gemm/MRx8c8-avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qd8_f32_qc4w_gemm_minmax_ukernel_3x8c8__avx2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_qc4w_minmax_params params[restrict XNN_MIN_ELEMENTS(1)],
+    const struct xnn_qd8_quantization_params quantization_params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 3);
+  assert(nc != 0);
+  assert(kc != 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8);
+  const int8_t* a0 = a;
+  float* c0 = c;
+  const int8_t* a1 = (const int8_t*) ((uintptr_t) a0 + a_stride);
+  float* c1 = (float*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const int8_t* a2 = (const int8_t*) ((uintptr_t) a1 + a_stride);
+  float* c2 = (float*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+
+  const __m256i vzp0 = _mm256_set1_epi32(quantization_params[0].zero_point);
+  const __m256i vzp1 = _mm256_set1_epi32(quantization_params[1].zero_point);
+  const __m256i vzp2 = _mm256_set1_epi32(quantization_params[2].zero_point);
+  const __m256 vinput_scale0 = _mm256_set1_ps(quantization_params[0].scale);
+  const __m256 vinput_scale1 = _mm256_set1_ps(quantization_params[1].scale);
+  const __m256 vinput_scale2 = _mm256_set1_ps(quantization_params[2].scale);
+  // Lookup table maps 4-bit weights to their values with the kernel zero point subtracted.
+  const __m256i vkernel_lut = _mm256_load_si256((const __m256i*) params->avx.kernel_lut);
+  const __m256i vmask = _mm256_set1_epi8(0x0F);
+  do {
+    // Packed weights start with the negated sums of the weights in every output channel: scaled by the zero point of
+    // the row, they cancel out the contribution of the zero point to the accumulators.
+    const __m128i vksum0x0 = _mm_loadu_si32(w);
+    const __m128i vksum0x1 = _mm_loadu_si32((const int32_t*) w + 1);
+    const __m256i vksum01 = _mm256_inserti128_si256(_mm256_castsi128_si256(vksum0x0), vksum0x1, 1);
+    const __m128i vksum0x2 = _mm_loadu_si32((const int32_t*) w + 2);
+    const __m128i vksum0x3 = _mm_loadu_si32((const int32_t*) w + 3);
+    const __m256i vksum23 = _mm256_inserti128_si256(_mm256_castsi128_si256(vksum0x2), vksum0x3, 1);
+    const __m128i vksum0x4 = _mm_loadu_si32((const int32_t*) w + 4);
+    const __m128i vksum0x5 = _mm_loadu_si32((const int32_t*) w + 5);
+    const __m256i vksum45 = _mm256_inserti128_si256(_mm256_castsi128_si256(vksum0x4), vksum0x5, 1);
+    const __m128i vksum0x6 = _mm_loadu_si32((const int32_t*) w + 6);
+    const __m128i vksum0x7 = _mm_loadu_si32((const int32_t*) w + 7);
+    const __m256i vksum67 = _mm256_inserti128_si256(_mm256_castsi128_si256(vksum0x6), vksum0x7, 1);
+    __m256i vacc0x01 = _mm256_mullo_epi32(vksum01, vzp0);
+    __m256i vacc0x23 = _mm256_mullo_epi32(vksum23, vzp0);
+    __m256i vacc0x45 = _mm256_mullo_epi32(vksum45, vzp0);
+    __m256i vacc0x67 = _mm256_mullo_epi32(vksum67, vzp0);
+    __m256i vacc1x01 = _mm256_mullo_epi32(vksum01, vzp1);
+    __m256i vacc1x23 = _mm256_mullo_epi32(vksum23, vzp1);
+    __m256i vacc1x45 = _mm256_mullo_epi32(vksum45, vzp1);
+    __m256i vacc1x67 = _mm256_mullo_epi32(vksum67, vzp1);
+    __m256i vacc2x01 = _mm256_mullo_epi32(vksum01, vzp2);
+    __m256i vacc2x23 = _mm256_mullo_epi32(vksum23, vzp2);
+    __m256i vacc2x45 = _mm256_mullo_epi32(vksum45, vzp2);
+    __m256i vacc2x67 = _mm256_mullo_epi32(vksum67, vzp2);
+    w = (const void*) ((const int32_t*) w + 8);
+
+    size_t k = 0;
+    while (k < kc) {
+      const __m128i va0 = _mm_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a0));
+      const __m256i vxa0 = _mm256_cvtepi8_epi16(va0);
+      a0 += 8;
+      const __m128i va1 = _mm_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a1));
+      const __m256i vxa1 = _mm256_cvtepi8_epi16(va1);
+      a1 += 8;
+      const __m128i va2 = _mm_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a2));
+      const __m256i vxa2 = _mm256_cvtepi8_epi16(va2);
+      a2 += 8;
+
+      // Every byte of packed weights holds two consecutive elements along K of an output channel: the even element in
+      // the low nibble, and the odd element in the high nibble.
+      const __m256i vbi = _mm256_load_si256((const __m256i*) w);
+      const __m256i vblo = _mm256_shuffle_epi8(vkernel_lut, _mm256_and_si256(vbi, vmask));
+      const __m256i vbhi = _mm256_shuffle_epi8(vkernel_lut, _mm256_and_si256(_mm256_srli_epi16(vbi, 4), vmask));
+      const __m256i vb0145 = _mm256_unpacklo_epi8(vblo, vbhi);
+      const __m256i vb2367 = _mm256_unpackhi_epi8(vblo, vbhi);
+      const __m256i vxb01 = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(vb0145));
+      const __m256i vxb23 = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(vb2367));
+      const __m256i vxb45 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(vb0145, 1));
+      const __m256i vxb67 = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(vb2367, 1));
+
+      vacc0x01 = _mm256_add_epi32(vacc0x01, _mm256_madd_epi16(vxa0, vxb01));
+      vacc1x01 = _mm256_add_epi32(vacc1x01, _mm256_madd_epi16(vxa1, vxb01));
+      vacc2x01 = _mm256_add_epi32(vacc2x01, _mm256_madd_epi16(vxa2, vxb01));
+      vacc0x23 = _mm256_add_epi32(vacc0x23, _mm256_madd_epi16(vxa0, vxb23));
+      vacc1x23 = _mm256_add_epi32(vacc1x23, _mm256_madd_epi16(vxa1, vxb23));
+      vacc2x23 = _mm256_add_epi32(vacc2x23, _mm256_madd_epi16(vxa2, vxb23));
+      vacc0x45 = _mm256_add_epi32(vacc0x45, _mm256_madd_epi16(vxa0, vxb45));
+      vacc1x45 = _mm256_add_epi32(vacc1x45, _mm256_madd_epi16(vxa1, vxb45));
+      vacc2x45 = _mm256_add_epi32(vacc2x45, _mm256_madd_epi16(vxa2, vxb45));
+      vacc0x67 = _mm256_add_epi32(vacc0x67, _mm256_madd_epi16(vxa0, vxb67));
+      vacc1x67 = _mm256_add_epi32(vacc1x67, _mm256_madd_epi16(vxa1, vxb67));
+      vacc2x67 = _mm256_add_epi32(vacc2x67, _mm256_madd_epi16(vxa2, vxb67));
+
+      w = (const void*) ((const uint8_t*) w + 32);
+      k += 8 * sizeof(int8_t);
+    }
+
+    const __m256i vacc0x0213 = _mm256_hadd_epi32(vacc0x01, vacc0x23);
+    const __m256i vacc0x4657 = _mm256_hadd_epi32(vacc0x45, vacc0x67);
+    const __m256i vacc1x0213 = _mm256_hadd_epi32(vacc1x01, vacc1x23);
+    const __m256i vacc1x4657 = _mm256_hadd_epi32(vacc1x45, vacc1x67);
+    const __m256i vacc2x0213 = _mm256_hadd_epi32(vacc2x01, vacc2x23);
+    const __m256i vacc2x4657 = _mm256_hadd_epi32(vacc2x45, vacc2x67);
+
+    const __m256i vacc0x02461357 = _mm256_hadd_epi32(vacc0x0213, vacc0x4657);
+    const __m256i vacc1x02461357 = _mm256_hadd_epi32(vacc1x0213, vacc1x4657);
+    const __m256i vacc2x02461357 = _mm256_hadd_epi32(vacc2x0213, vacc2x4657);
+
+    const __m256i vpermute_mask = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+    const __m256i vacc0x01234567 = _mm256_permutevar8x32_epi32(vacc0x02461357, vpermute_mask);
+    const __m256i vacc1x01234567 = _mm256_permutevar8x32_epi32(vacc1x02461357, vpermute_mask);
+    const __m256i vacc2x01234567 = _mm256_permutevar8x32_epi32(vacc2x02461357, vpermute_mask);
+
+    __m256 vout0x01234567 = _mm256_mul_ps(_mm256_cvtepi32_ps(vacc0x01234567), vinput_scale0);
+    __m256 vout1x01234567 = _mm256_mul_ps(_mm256_cvtepi32_ps(vacc1x01234567), vinput_scale1);
+    __m256 vout2x01234567 = _mm256_mul_ps(_mm256_cvtepi32_ps(vacc2x01234567), vinput_scale2);
+
+    const __m256 vfilter_scale01234567 = _mm256_load_ps((const float*) w);
+    const __m256 vbias01234567 = _mm256_load_ps((const float*) w + 8);
+    w = (const void*) ((const float*) w + 16);
+    vout0x01234567 = _mm256_fmadd_ps(vout0x01234567, vfilter_scale01234567, vbias01234567);
+    vout1x01234567 = _mm256_fmadd_ps(vout1x01234567, vfilter_scale01234567, vbias01234567);
+    vout2x01234567 = _mm256_fmadd_ps(vout2x01234567, vfilter_scale01234567, vbias01234567);
+
+    const __m256 vmin = _mm256_load_ps(params->avx.min);
+    vout0x01234567 = _mm256_max_ps(vout0x01234567, vmin);
+    vout1x01234567 = _mm256_max_ps(vout1x01234567, vmin);
+    vout2x01234567 = _mm256_max_ps(vout2x01234567, vmin);
+
+    const __m256 vmax = _mm256_load_ps(params->avx.max);
+    vout0x01234567 = _mm256_min_ps(vout0x01234567, vmax);
+    vout1x01234567 = _mm256_min_ps(vout1x01234567, vmax);
+    vout2x01234567 = _mm256_min_ps(vout2x01234567, vmax);
+
+    if XNN_LIKELY(nc >= 8) {
+      _mm256_storeu_ps(c2, vout2x01234567);
+      _mm256_storeu_ps(c1, vout1x01234567);
+      _mm256_storeu_ps(c0, vout0x01234567);
+
+      a0 = (const int8_t*) ((uintptr_t) a0 - kc);
+      a1 = (const int8_t*) ((uintptr_t) a1 - kc);
+      a2 = (const int8_t*) ((uintptr_t) a2 - kc);
+
+      c0 = (float*) ((uintptr_t) c0 + cn_stride);
+      c1 = (float*) ((uintptr_t) c1 + cn_stride);
+      c2 = (float*) ((uintptr_t) c2 + cn_stride);
+
+      nc -= 8;
+    } else {
+      __m128 vout0x0123 = _mm256_castps256_ps128(vout0x01234567);
+      __m128 vout1x0123 = _mm256_castps256_ps128(vout1x01234567);
+      __m128 vout2x0123 = _mm256_castps256_ps128(vout2x01234567);
+      if (nc & 4) {
+        _mm_storeu_ps(c2, vout2x0123);
+        _mm_storeu_ps(c1, vout1x0123);
+        _mm_storeu_ps(c0, vout0x0123);
+
+        vout0x0123 = _mm256_extractf128_ps(vout0x01234567, 1);
+        vout1x0123 = _mm256_extractf128_ps(vout1x01234567, 1);
+        vout2x0123 = _mm256_extractf128_ps(vout2x01234567, 1);
+
+        c0 += 4;
+        c1 += 4;
+        c2 += 4;
+      }
+      if (nc & 2) {
+        _mm_storel_pi((__m64*) c2, vout2x0123);
+        _mm_storel_pi((__m64*) c1, vout1x0123);
+        _mm_storel_pi((__m64*) c0, vout0x0123);
+
+        vout0x0123 = _mm_movehl_ps(vout0x0123, vout0x0123);
+        vout1x0123 = _mm_movehl_ps(vout1x0123, vout1x0123);
+        vout2x0123 = _mm_movehl_ps(vout2x0123, vout2x0123);
+
+        c0 += 2;
+        c1 += 2;
+        c2 += 2;
+      }
+      if (nc & 1) {
+        _mm_store_ss(c2, vout2x0123);
+        _mm_store_ss(c1, vout1x0123);
+        _mm_store_ss(c0, vout0x0123);
+      }
+
+      nc = 0;
+    }
+  } while (nc != 0);
+}
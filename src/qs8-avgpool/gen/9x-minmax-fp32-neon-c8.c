@@ -0,0 +1,218 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-avgpool/unipass-neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/avgpool.h>
+
+
+void xnn_qs8_avgpool_minmax_fp32_ukernel_9x__neon_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const int32x4_t vinit_bias = vld1q_dup_s32(&params->fp32_neon.init_bias);
+  const float32x4_t vscale = vld1q_dup_f32(&params->fp32_neon.scale);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->fp32_neon.magic_bias);
+  const int32x4_t vmagic_bias_less_output_zero_point = vld1q_dup_s32(&params->fp32_neon.magic_bias_less_output_zero_point);
+  const int8x8_t voutput_min = vld1_dup_s8(&params->fp32_neon.output_min);
+  const int8x8_t voutput_max = vld1_dup_s8(&params->fp32_neon.output_max);
+  do {
+    const int8_t* i0 = input[0];
+    assert(i0 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+    }
+    const int8_t* i1 = input[1];
+    if XNN_UNPREDICTABLE(kernel_elements <= 1) {
+      i1 = zero;
+    }
+    assert(i1 != NULL);
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+    }
+    const int8_t* i2 = input[2];
+    if XNN_UNPREDICTABLE(kernel_elements <= 2) {
+      i2 = zero;
+    }
+    assert(i2 != NULL);
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+    }
+    const int8_t* i3 = input[3];
+    if XNN_UNPREDICTABLE(kernel_elements <= 3) {
+      i3 = zero;
+    }
+    assert(i3 != NULL);
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+    }
+    const int8_t* i4 = input[4];
+    if XNN_UNPREDICTABLE(kernel_elements <= 4) {
+      i4 = zero;
+    }
+    assert(i4 != NULL);
+    if XNN_UNPREDICTABLE(i4 != zero) {
+      i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+    }
+    const int8_t* i5 = input[5];
+    if XNN_UNPREDICTABLE(kernel_elements <= 5) {
+      i5 = zero;
+    }
+    assert(i5 != NULL);
+    if XNN_UNPREDICTABLE(i5 != zero) {
+      i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+    }
+    const int8_t* i6 = input[6];
+    if XNN_UNPREDICTABLE(kernel_elements <= 6) {
+      i6 = zero;
+    }
+    assert(i6 != NULL);
+    if XNN_UNPREDICTABLE(i6 != zero) {
+      i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+    }
+    const int8_t* i7 = input[7];
+    if XNN_UNPREDICTABLE(kernel_elements <= 7) {
+      i7 = zero;
+    }
+    assert(i7 != NULL);
+    if XNN_UNPREDICTABLE(i7 != zero) {
+      i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+    }
+    const int8_t* i8 = input[8];
+    if XNN_UNPREDICTABLE(kernel_elements <= 8) {
+      i8 = zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i8 != zero) {
+      i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+    }
+    input = (const int8_t**) ((uintptr_t) input + input_increment);
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      // Sums of up to 16 int8 elements fit into 16 bits.
+      const int8x8_t vi0 = vld1_s8(i0); i0 += 8;
+      const int8x8_t vi1 = vld1_s8(i1); i1 += 8;
+      int16x8_t vsum01234567 = vaddl_s8(vi0, vi1);
+      const int8x8_t vi2 = vld1_s8(i2); i2 += 8;
+      vsum01234567 = vaddw_s8(vsum01234567, vi2);
+      const int8x8_t vi3 = vld1_s8(i3); i3 += 8;
+      vsum01234567 = vaddw_s8(vsum01234567, vi3);
+      const int8x8_t vi4 = vld1_s8(i4); i4 += 8;
+      vsum01234567 = vaddw_s8(vsum01234567, vi4);
+      const int8x8_t vi5 = vld1_s8(i5); i5 += 8;
+      vsum01234567 = vaddw_s8(vsum01234567, vi5);
+      const int8x8_t vi6 = vld1_s8(i6); i6 += 8;
+      vsum01234567 = vaddw_s8(vsum01234567, vi6);
+      const int8x8_t vi7 = vld1_s8(i7); i7 += 8;
+      vsum01234567 = vaddw_s8(vsum01234567, vi7);
+      const int8x8_t vi8 = vld1_s8(i8); i8 += 8;
+      vsum01234567 = vaddw_s8(vsum01234567, vi8);
+
+      int32x4_t vacc0123 = vaddw_s16(vinit_bias, vget_low_s16(vsum01234567));
+      int32x4_t vacc4567 = vaddw_s16(vinit_bias, vget_high_s16(vsum01234567));
+
+      float32x4_t vfpacc0123 = vcvtq_f32_s32(vacc0123);
+      float32x4_t vfpacc4567 = vcvtq_f32_s32(vacc4567);
+
+      vfpacc0123 = vmulq_f32(vfpacc0123, vscale);
+      vfpacc4567 = vmulq_f32(vfpacc4567, vscale);
+
+      vacc0123 = vreinterpretq_s32_f32(vaddq_f32(vfpacc0123, vmagic_bias));
+      vacc4567 = vreinterpretq_s32_f32(vaddq_f32(vfpacc4567, vmagic_bias));
+
+      vacc0123 = vqsubq_s32(vacc0123, vmagic_bias_less_output_zero_point);
+      vacc4567 = vqsubq_s32(vacc4567, vmagic_bias_less_output_zero_point);
+
+      #if XNN_ARCH_ARM64
+        const int16x8_t vacc01234567 = vqmovn_high_s32(vqmovn_s32(vacc0123), vacc4567);
+      #else  // !XNN_ARCH_ARM64
+        const int16x8_t vacc01234567 = vcombine_s16(vqmovn_s32(vacc0123), vqmovn_s32(vacc4567));
+      #endif  // !XNN_ARCH_ARM64
+
+      int8x8_t vout01234567 = vqmovn_s16(vacc01234567);
+      vout01234567 = vmax_s8(vout01234567, voutput_min);
+      vout01234567 = vmin_s8(vout01234567, voutput_max);
+
+      vst1_s8(output, vout01234567); output += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      const int8x8_t vi0 = vld1_s8(i0);
+      const int8x8_t vi1 = vld1_s8(i1);
+      int16x8_t vsum01234567 = vaddl_s8(vi0, vi1);
+      const int8x8_t vi2 = vld1_s8(i2);
+      vsum01234567 = vaddw_s8(vsum01234567, vi2);
+      const int8x8_t vi3 = vld1_s8(i3);
+      vsum01234567 = vaddw_s8(vsum01234567, vi3);
+      const int8x8_t vi4 = vld1_s8(i4);
+      vsum01234567 = vaddw_s8(vsum01234567, vi4);
+      const int8x8_t vi5 = vld1_s8(i5);
+      vsum01234567 = vaddw_s8(vsum01234567, vi5);
+      const int8x8_t vi6 = vld1_s8(i6);
+      vsum01234567 = vaddw_s8(vsum01234567, vi6);
+      const int8x8_t vi7 = vld1_s8(i7);
+      vsum01234567 = vaddw_s8(vsum01234567, vi7);
+      const int8x8_t vi8 = vld1_s8(i8);
+      vsum01234567 = vaddw_s8(vsum01234567, vi8);
+
+      int32x4_t vacc0123 = vaddw_s16(vinit_bias, vget_low_s16(vsum01234567));
+      int32x4_t vacc4567 = vaddw_s16(vinit_bias, vget_high_s16(vsum01234567));
+
+      float32x4_t vfpacc0123 = vcvtq_f32_s32(vacc0123);
+      float32x4_t vfpacc4567 = vcvtq_f32_s32(vacc4567);
+
+      vfpacc0123 = vmulq_f32(vfpacc0123, vscale);
+      vfpacc4567 = vmulq_f32(vfpacc4567, vscale);
+
+      vacc0123 = vreinterpretq_s32_f32(vaddq_f32(vfpacc0123, vmagic_bias));
+      vacc4567 = vreinterpretq_s32_f32(vaddq_f32(vfpacc4567, vmagic_bias));
+
+      vacc0123 = vqsubq_s32(vacc0123, vmagic_bias_less_output_zero_point);
+      vacc4567 = vqsubq_s32(vacc4567, vmagic_bias_less_output_zero_point);
+
+      #if XNN_ARCH_ARM64
+        const int16x8_t vacc01234567 = vqmovn_high_s32(vqmovn_s32(vacc0123), vacc4567);
+      #else  // !XNN_ARCH_ARM64
+        const int16x8_t vacc01234567 = vcombine_s16(vqmovn_s32(vacc0123), vqmovn_s32(vacc4567));
+      #endif  // !XNN_ARCH_ARM64
+
+      int8x8_t vout01234567 = vqmovn_s16(vacc01234567);
+      vout01234567 = vmax_s8(vout01234567, voutput_min);
+      vout01234567 = vmin_s8(vout01234567, voutput_max);
+
+      if (c & 4) {
+        vst1_lane_u32((void*) output, vreinterpret_u32_s8(vout01234567), 0); output += 4;
+        vout01234567 = vext_s8(vout01234567, vout01234567, 4);
+      }
+      if (c & 2) {
+        vst1_lane_u16((void*) output, vreinterpret_u16_s8(vout01234567), 0); output += 2;
+        vout01234567 = vext_s8(vout01234567, vout01234567, 2);
+      }
+      if (c & 1) {
+        vst1_lane_s8(output, vout01234567, 0); output += 1;
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
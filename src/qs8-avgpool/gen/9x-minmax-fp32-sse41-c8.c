@@ -0,0 +1,218 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-avgpool/unipass-sse4.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/avgpool.h>
+
+
+void xnn_qs8_avgpool_minmax_fp32_ukernel_9x__sse41_c8(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(output_pixels != 0);
+  assert(kernel_elements != 0);
+  assert(kernel_elements <= 9);
+  assert(channels != 0);
+
+  const __m128i vinit_bias = _mm_load_si128((const __m128i*) params->fp32_sse4.init_bias);
+  const __m128 vscale = _mm_load_ps(params->fp32_sse4.scale);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->fp32_sse4.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->fp32_sse4.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->fp32_sse4.output_min);
+  do {
+    const int8_t* i0 = input[0];
+    assert(i0 != NULL);
+    if XNN_UNPREDICTABLE(i0 != zero) {
+      i0 = (const int8_t*) ((uintptr_t) i0 + input_offset);
+    }
+    const int8_t* i1 = input[1];
+    if XNN_UNPREDICTABLE(kernel_elements <= 1) {
+      i1 = zero;
+    }
+    assert(i1 != NULL);
+    if XNN_UNPREDICTABLE(i1 != zero) {
+      i1 = (const int8_t*) ((uintptr_t) i1 + input_offset);
+    }
+    const int8_t* i2 = input[2];
+    if XNN_UNPREDICTABLE(kernel_elements <= 2) {
+      i2 = zero;
+    }
+    assert(i2 != NULL);
+    if XNN_UNPREDICTABLE(i2 != zero) {
+      i2 = (const int8_t*) ((uintptr_t) i2 + input_offset);
+    }
+    const int8_t* i3 = input[3];
+    if XNN_UNPREDICTABLE(kernel_elements <= 3) {
+      i3 = zero;
+    }
+    assert(i3 != NULL);
+    if XNN_UNPREDICTABLE(i3 != zero) {
+      i3 = (const int8_t*) ((uintptr_t) i3 + input_offset);
+    }
+    const int8_t* i4 = input[4];
+    if XNN_UNPREDICTABLE(kernel_elements <= 4) {
+      i4 = zero;
+    }
+    assert(i4 != NULL);
+    if XNN_UNPREDICTABLE(i4 != zero) {
+      i4 = (const int8_t*) ((uintptr_t) i4 + input_offset);
+    }
+    const int8_t* i5 = input[5];
+    if XNN_UNPREDICTABLE(kernel_elements <= 5) {
+      i5 = zero;
+    }
+    assert(i5 != NULL);
+    if XNN_UNPREDICTABLE(i5 != zero) {
+      i5 = (const int8_t*) ((uintptr_t) i5 + input_offset);
+    }
+    const int8_t* i6 = input[6];
+    if XNN_UNPREDICTABLE(kernel_elements <= 6) {
+      i6 = zero;
+    }
+    assert(i6 != NULL);
+    if XNN_UNPREDICTABLE(i6 != zero) {
+      i6 = (const int8_t*) ((uintptr_t) i6 + input_offset);
+    }
+    const int8_t* i7 = input[7];
+    if XNN_UNPREDICTABLE(kernel_elements <= 7) {
+      i7 = zero;
+    }
+    assert(i7 != NULL);
+    if XNN_UNPREDICTABLE(i7 != zero) {
+      i7 = (const int8_t*) ((uintptr_t) i7 + input_offset);
+    }
+    const int8_t* i8 = input[8];
+    if XNN_UNPREDICTABLE(kernel_elements <= 8) {
+      i8 = zero;
+    }
+    assert(i8 != NULL);
+    if XNN_UNPREDICTABLE(i8 != zero) {
+      i8 = (const int8_t*) ((uintptr_t) i8 + input_offset);
+    }
+    input = (const int8_t**) ((uintptr_t) input + input_increment);
+
+    size_t c = channels;
+    for (; c >= 8; c -= 8) {
+      // Sums of up to 16 int8 elements fit into 16 bits.
+      __m128i vacc01234567 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i0));
+      i0 += 8;
+      const __m128i vxi1 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i1));
+      i1 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi1);
+      const __m128i vxi2 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i2));
+      i2 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi2);
+      const __m128i vxi3 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i3));
+      i3 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi3);
+      const __m128i vxi4 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i4));
+      i4 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi4);
+      const __m128i vxi5 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i5));
+      i5 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi5);
+      const __m128i vxi6 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i6));
+      i6 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi6);
+      const __m128i vxi7 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i7));
+      i7 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi7);
+      const __m128i vxi8 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i8));
+      i8 += 8;
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi8);
+
+      __m128i vacc0123 = _mm_cvtepi16_epi32(vacc01234567);
+      __m128i vacc4567 = _mm_srai_epi32(_mm_unpackhi_epi16(vacc01234567, vacc01234567), 16);
+
+      vacc0123 = _mm_add_epi32(vacc0123, vinit_bias);
+      vacc4567 = _mm_add_epi32(vacc4567, vinit_bias);
+
+      __m128 vfpacc0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0123), vscale);
+      __m128 vfpacc4567 = _mm_mul_ps(_mm_cvtepi32_ps(vacc4567), vscale);
+
+      vfpacc0123 = _mm_min_ps(vfpacc0123, voutput_max_less_zero_point);
+      vfpacc4567 = _mm_min_ps(vfpacc4567, voutput_max_less_zero_point);
+
+      vacc0123 = _mm_cvtps_epi32(vfpacc0123);
+      vacc4567 = _mm_cvtps_epi32(vfpacc4567);
+
+      const __m128i vout01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0123, vacc4567), voutput_zero_point);
+      __m128i vout0123456701234567 = _mm_packs_epi16(vout01234567, vout01234567);
+      vout0123456701234567 = _mm_max_epi8(vout0123456701234567, voutput_min);
+
+      _mm_storel_epi64((__m128i*) output, vout0123456701234567);
+      output += 8;
+    }
+    if XNN_UNLIKELY(c != 0) {
+      __m128i vacc01234567 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i0));
+      const __m128i vxi1 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i1));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi1);
+      const __m128i vxi2 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i2));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi2);
+      const __m128i vxi3 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i3));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi3);
+      const __m128i vxi4 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i4));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi4);
+      const __m128i vxi5 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i5));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi5);
+      const __m128i vxi6 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i6));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi6);
+      const __m128i vxi7 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i7));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi7);
+      const __m128i vxi8 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) i8));
+      vacc01234567 = _mm_add_epi16(vacc01234567, vxi8);
+
+      __m128i vacc0123 = _mm_cvtepi16_epi32(vacc01234567);
+      __m128i vacc4567 = _mm_srai_epi32(_mm_unpackhi_epi16(vacc01234567, vacc01234567), 16);
+
+      vacc0123 = _mm_add_epi32(vacc0123, vinit_bias);
+      vacc4567 = _mm_add_epi32(vacc4567, vinit_bias);
+
+      __m128 vfpacc0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0123), vscale);
+      __m128 vfpacc4567 = _mm_mul_ps(_mm_cvtepi32_ps(vacc4567), vscale);
+
+      vfpacc0123 = _mm_min_ps(vfpacc0123, voutput_max_less_zero_point);
+      vfpacc4567 = _mm_min_ps(vfpacc4567, voutput_max_less_zero_point);
+
+      vacc0123 = _mm_cvtps_epi32(vfpacc0123);
+      vacc4567 = _mm_cvtps_epi32(vfpacc4567);
+
+      const __m128i vout01234567 = _mm_adds_epi16(_mm_packs_epi32(vacc0123, vacc4567), voutput_zero_point);
+      __m128i vout0123456701234567 = _mm_packs_epi16(vout01234567, vout01234567);
+      vout0123456701234567 = _mm_max_epi8(vout0123456701234567, voutput_min);
+
+      if (c & 4) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout0123456701234567);
+        vout0123456701234567 = _mm_srli_epi64(vout0123456701234567, 32);
+        output += 4;
+      }
+      if (c & 2) {
+        *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout0123456701234567, 0);
+        vout0123456701234567 = _mm_srli_epi32(vout0123456701234567, 16);
+        output += 2;
+      }
+      if (c & 1) {
+        *output = (int8_t) _mm_extract_epi8(vout0123456701234567, 0);
+        output += 1;
+      }
+    }
+    output = (int8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_pixels != 0);
+}
@@ -0,0 +1,92 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-gemm/MRx4c8-acc32-sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    int32_t* restrict c,
+    size_t cm_stride) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(nc <= 4);
+  assert(kc != 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8);
+  const int8_t* a0 = a;
+  int32_t* c0 = c;
+
+  __m128i vacc0x0 = _mm_setzero_si128();
+  __m128i vacc0x1 = _mm_setzero_si128();
+  __m128i vacc0x2 = _mm_setzero_si128();
+  __m128i vacc0x3 = _mm_setzero_si128();
+
+  size_t k = 0;
+  while (k < kc) {
+    const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+    const __m128i vxa0 = _mm_srai_epi16(_mm_unpacklo_epi8(va0, va0), 8);
+    a0 += 8;
+
+    const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+    const __m128i vxb0 = _mm_srai_epi16(_mm_unpacklo_epi8(vb0, vb0), 8);
+
+    vacc0x0 = _mm_add_epi32(vacc0x0, _mm_madd_epi16(vxa0, vxb0));
+    const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 8));
+    const __m128i vxb1 = _mm_srai_epi16(_mm_unpacklo_epi8(vb1, vb1), 8);
+
+    vacc0x1 = _mm_add_epi32(vacc0x1, _mm_madd_epi16(vxa0, vxb1));
+    const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 16));
+    const __m128i vxb2 = _mm_srai_epi16(_mm_unpacklo_epi8(vb2, vb2), 8);
+
+    vacc0x2 = _mm_add_epi32(vacc0x2, _mm_madd_epi16(vxa0, vxb2));
+    const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 24));
+    const __m128i vxb3 = _mm_srai_epi16(_mm_unpacklo_epi8(vb3, vb3), 8);
+
+    vacc0x3 = _mm_add_epi32(vacc0x3, _mm_madd_epi16(vxa0, vxb3));
+
+    w = (const void*) ((const int8_t*) w + 32);
+    k += 8 * sizeof(int8_t);
+  }
+
+  const __m128i vacc0x02 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x0, vacc0x2), _mm_unpackhi_epi32(vacc0x0, vacc0x2));
+  const __m128i vacc0x13 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x1, vacc0x3), _mm_unpackhi_epi32(vacc0x1, vacc0x3));
+
+  __m128i vacc0x0123 = _mm_add_epi32(_mm_unpacklo_epi32(vacc0x02, vacc0x13), _mm_unpackhi_epi32(vacc0x02, vacc0x13));
+
+  if XNN_LIKELY(nc == 4) {
+    _mm_storeu_si128((__m128i*) c0, vacc0x0123);
+  } else {
+    if (nc & 2) {
+      _mm_storel_epi64((__m128i*) c0, vacc0x0123);
+
+      vacc0x0123 = _mm_unpackhi_epi64(vacc0x0123, vacc0x0123);
+
+      c0 += 2;
+    }
+    if (nc & 1) {
+      *c0 = _mm_cvtsi128_si32(vacc0x0123);
+    }
+  }
+}
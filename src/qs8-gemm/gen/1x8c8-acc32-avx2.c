@@ -0,0 +1,104 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-gemm/MRx8c8-acc32-avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    int32_t* restrict c,
+    size_t cm_stride) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 1);
+  assert(nc != 0);
+  assert(nc <= 8);
+  assert(kc != 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8);
+  const int8_t* a0 = a;
+  int32_t* c0 = c;
+
+  __m256i vacc0x01 = _mm256_setzero_si256();
+  __m256i vacc0x23 = _mm256_setzero_si256();
+  __m256i vacc0x45 = _mm256_setzero_si256();
+  __m256i vacc0x67 = _mm256_setzero_si256();
+
+  size_t k = 0;
+  while (k < kc) {
+    const __m128i va0 = _mm_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a0));
+    const __m256i vxa0 = _mm256_cvtepi8_epi16(va0);
+    a0 += 8;
+
+    const __m128i vb01 = _mm_load_si128((const __m128i*) w);
+    const __m256i vxb01 = _mm256_cvtepi8_epi16(vb01);
+
+    vacc0x01 = _mm256_add_epi32(vacc0x01, _mm256_madd_epi16(vxa0, vxb01));
+    const __m128i vb23 = _mm_load_si128((const __m128i*) ((const int8_t*) w + 16));
+    const __m256i vxb23 = _mm256_cvtepi8_epi16(vb23);
+
+    vacc0x23 = _mm256_add_epi32(vacc0x23, _mm256_madd_epi16(vxa0, vxb23));
+    const __m128i vb45 = _mm_load_si128((const __m128i*) ((const int8_t*) w + 32));
+    const __m256i vxb45 = _mm256_cvtepi8_epi16(vb45);
+
+    vacc0x45 = _mm256_add_epi32(vacc0x45, _mm256_madd_epi16(vxa0, vxb45));
+    const __m128i vb67 = _mm_load_si128((const __m128i*) ((const int8_t*) w + 48));
+    const __m256i vxb67 = _mm256_cvtepi8_epi16(vb67);
+
+    vacc0x67 = _mm256_add_epi32(vacc0x67, _mm256_madd_epi16(vxa0, vxb67));
+
+    w = (const void*) ((const int8_t*) w + 64);
+    k += 8 * sizeof(int8_t);
+  }
+
+  const __m256i vacc0x0213 = _mm256_hadd_epi32(vacc0x01, vacc0x23);
+  const __m256i vacc0x4657 = _mm256_hadd_epi32(vacc0x45, vacc0x67);
+
+  const __m256i vacc0x02461357 = _mm256_hadd_epi32(vacc0x0213, vacc0x4657);
+
+  const __m256i vpermute_mask = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+  const __m256i vacc0x01234567 = _mm256_permutevar8x32_epi32(vacc0x02461357, vpermute_mask);
+
+  if XNN_LIKELY(nc == 8) {
+    _mm256_storeu_si256((__m256i*) c0, vacc0x01234567);
+  } else {
+    __m128i vacc0x0123 = _mm256_castsi256_si128(vacc0x01234567);
+    if (nc & 4) {
+      _mm_storeu_si128((__m128i*) c0, vacc0x0123);
+
+      vacc0x0123 = _mm256_extracti128_si256(vacc0x01234567, 1);
+
+      c0 += 4;
+    }
+    if (nc & 2) {
+      _mm_storel_epi64((__m128i*) c0, vacc0x0123);
+
+      vacc0x0123 = _mm_unpackhi_epi64(vacc0x0123, vacc0x0123);
+
+      c0 += 2;
+    }
+    if (nc & 1) {
+      *c0 = _mm_cvtsi128_si32(vacc0x0123);
+    }
+  }
+}
@@ -0,0 +1,117 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-gemm/MRx4c8-acc32-sse.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    int32_t* restrict c,
+    size_t cm_stride) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 2);
+  assert(nc != 0);
+  assert(nc <= 4);
+  assert(kc != 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8);
+  const int8_t* a0 = a;
+  int32_t* c0 = c;
+  const int8_t* a1 = (const int8_t*) ((uintptr_t) a0 + a_stride);
+  int32_t* c1 = (int32_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr != 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+
+  __m128i vacc0x0 = _mm_setzero_si128();
+  __m128i vacc0x1 = _mm_setzero_si128();
+  __m128i vacc0x2 = _mm_setzero_si128();
+  __m128i vacc0x3 = _mm_setzero_si128();
+  __m128i vacc1x0 = _mm_setzero_si128();
+  __m128i vacc1x1 = _mm_setzero_si128();
+  __m128i vacc1x2 = _mm_setzero_si128();
+  __m128i vacc1x3 = _mm_setzero_si128();
+
+  size_t k = 0;
+  while (k < kc) {
+    const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+    const __m128i vxa0 = _mm_cvtepi8_epi16(va0);
+    a0 += 8;
+    const __m128i va1 = _mm_loadl_epi64((const __m128i*) a1);
+    const __m128i vxa1 = _mm_cvtepi8_epi16(va1);
+    a1 += 8;
+
+    const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+    const __m128i vxb0 = _mm_cvtepi8_epi16(vb0);
+
+    vacc0x0 = _mm_add_epi32(vacc0x0, _mm_madd_epi16(vxa0, vxb0));
+    vacc1x0 = _mm_add_epi32(vacc1x0, _mm_madd_epi16(vxa1, vxb0));
+    const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 8));
+    const __m128i vxb1 = _mm_cvtepi8_epi16(vb1);
+
+    vacc0x1 = _mm_add_epi32(vacc0x1, _mm_madd_epi16(vxa0, vxb1));
+    vacc1x1 = _mm_add_epi32(vacc1x1, _mm_madd_epi16(vxa1, vxb1));
+    const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 16));
+    const __m128i vxb2 = _mm_cvtepi8_epi16(vb2);
+
+    vacc0x2 = _mm_add_epi32(vacc0x2, _mm_madd_epi16(vxa0, vxb2));
+    vacc1x2 = _mm_add_epi32(vacc1x2, _mm_madd_epi16(vxa1, vxb2));
+    const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((const int8_t*) w + 24));
+    const __m128i vxb3 = _mm_cvtepi8_epi16(vb3);
+
+    vacc0x3 = _mm_add_epi32(vacc0x3, _mm_madd_epi16(vxa0, vxb3));
+    vacc1x3 = _mm_add_epi32(vacc1x3, _mm_madd_epi16(vxa1, vxb3));
+
+    w = (const void*) ((const int8_t*) w + 32);
+    k += 8 * sizeof(int8_t);
+  }
+
+  const __m128i vacc0x01 = _mm_hadd_epi32(vacc0x0, vacc0x1);
+  const __m128i vacc0x23 = _mm_hadd_epi32(vacc0x2, vacc0x3);
+  const __m128i vacc1x01 = _mm_hadd_epi32(vacc1x0, vacc1x1);
+  const __m128i vacc1x23 = _mm_hadd_epi32(vacc1x2, vacc1x3);
+
+  __m128i vacc0x0123 = _mm_hadd_epi32(vacc0x01, vacc0x23);
+  __m128i vacc1x0123 = _mm_hadd_epi32(vacc1x01, vacc1x23);
+
+  if XNN_LIKELY(nc == 4) {
+    _mm_storeu_si128((__m128i*) c1, vacc1x0123);
+    _mm_storeu_si128((__m128i*) c0, vacc0x0123);
+  } else {
+    if (nc & 2) {
+      _mm_storel_epi64((__m128i*) c1, vacc1x0123);
+      _mm_storel_epi64((__m128i*) c0, vacc0x0123);
+
+      vacc1x0123 = _mm_unpackhi_epi64(vacc1x0123, vacc1x0123);
+      vacc0x0123 = _mm_unpackhi_epi64(vacc0x0123, vacc0x0123);
+
+      c1 += 2;
+      c0 += 2;
+    }
+    if (nc & 1) {
+      *c1 = _mm_cvtsi128_si32(vacc1x0123);
+      *c0 = _mm_cvtsi128_si32(vacc0x0123);
+    }
+  }
+}
@@ -0,0 +1,164 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-gemm/MRx8c8-acc32-avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/intrinsics-polyfill.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2(
+    size_t mr,
+    size_t nc,
+    size_t kc,
+    const int8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    int32_t* restrict c,
+    size_t cm_stride) XNN_OOB_READS
+{
+  assert(mr != 0);
+  assert(mr <= 3);
+  assert(nc != 0);
+  assert(nc <= 8);
+  assert(kc != 0);
+  assert(a != NULL);
+  assert(w != NULL);
+  assert(c != NULL);
+
+  kc = round_up_po2(kc, 8);
+  const int8_t* a0 = a;
+  int32_t* c0 = c;
+  const int8_t* a1 = (const int8_t*) ((uintptr_t) a0 + a_stride);
+  int32_t* c1 = (int32_t*) ((uintptr_t) c0 + cm_stride);
+  if XNN_UNPREDICTABLE(mr < 2) {
+    a1 = a0;
+    c1 = c0;
+  }
+  const int8_t* a2 = (const int8_t*) ((uintptr_t) a1 + a_stride);
+  int32_t* c2 = (int32_t*) ((uintptr_t) c1 + cm_stride);
+  if XNN_UNPREDICTABLE(mr <= 2) {
+    a2 = a1;
+    c2 = c1;
+  }
+
+  __m256i vacc0x01 = _mm256_setzero_si256();
+  __m256i vacc0x23 = _mm256_setzero_si256();
+  __m256i vacc0x45 = _mm256_setzero_si256();
+  __m256i vacc0x67 = _mm256_setzero_si256();
+  __m256i vacc1x01 = _mm256_setzero_si256();
+  __m256i vacc1x23 = _mm256_setzero_si256();
+  __m256i vacc1x45 = _mm256_setzero_si256();
+  __m256i vacc1x67 = _mm256_setzero_si256();
+  __m256i vacc2x01 = _mm256_setzero_si256();
+  __m256i vacc2x23 = _mm256_setzero_si256();
+  __m256i vacc2x45 = _mm256_setzero_si256();
+  __m256i vacc2x67 = _mm256_setzero_si256();
+
+  size_t k = 0;
+  while (k < kc) {
+    const __m128i va0 = _mm_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a0));
+    const __m256i vxa0 = _mm256_cvtepi8_epi16(va0);
+    a0 += 8;
+    const __m128i va1 = _mm_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a1));
+    const __m256i vxa1 = _mm256_cvtepi8_epi16(va1);
+    a1 += 8;
+    const __m128i va2 = _mm_broadcastq_epi64(_mm_loadl_epi64((const __m128i*) a2));
+    const __m256i vxa2 = _mm256_cvtepi8_epi16(va2);
+    a2 += 8;
+
+    const __m128i vb01 = _mm_load_si128((const __m128i*) w);
+    const __m256i vxb01 = _mm256_cvtepi8_epi16(vb01);
+
+    vacc0x01 = _mm256_add_epi32(vacc0x01, _mm256_madd_epi16(vxa0, vxb01));
+    vacc1x01 = _mm256_add_epi32(vacc1x01, _mm256_madd_epi16(vxa1, vxb01));
+    vacc2x01 = _mm256_add_epi32(vacc2x01, _mm256_madd_epi16(vxa2, vxb01));
+    const __m128i vb23 = _mm_load_si128((const __m128i*) ((const int8_t*) w + 16));
+    const __m256i vxb23 = _mm256_cvtepi8_epi16(vb23);
+
+    vacc0x23 = _mm256_add_epi32(vacc0x23, _mm256_madd_epi16(vxa0, vxb23));
+    vacc1x23 = _mm256_add_epi32(vacc1x23, _mm256_madd_epi16(vxa1, vxb23));
+    vacc2x23 = _mm256_add_epi32(vacc2x23, _mm256_madd_epi16(vxa2, vxb23));
+    const __m128i vb45 = _mm_load_si128((const __m128i*) ((const int8_t*) w + 32));
+    const __m256i vxb45 = _mm256_cvtepi8_epi16(vb45);
+
+    vacc0x45 = _mm256_add_epi32(vacc0x45, _mm256_madd_epi16(vxa0, vxb45));
+    vacc1x45 = _mm256_add_epi32(vacc1x45, _mm256_madd_epi16(vxa1, vxb45));
+    vacc2x45 = _mm256_add_epi32(vacc2x45, _mm256_madd_epi16(vxa2, vxb45));
+    const __m128i vb67 = _mm_load_si128((const __m128i*) ((const int8_t*) w + 48));
+    const __m256i vxb67 = _mm256_cvtepi8_epi16(vb67);
+
+    vacc0x67 = _mm256_add_epi32(vacc0x67, _mm256_madd_epi16(vxa0, vxb67));
+    vacc1x67 = _mm256_add_epi32(vacc1x67, _mm256_madd_epi16(vxa1, vxb67));
+    vacc2x67 = _mm256_add_epi32(vacc2x67, _mm256_madd_epi16(vxa2, vxb67));
+
+    w = (const void*) ((const int8_t*) w + 64);
+    k += 8 * sizeof(int8_t);
+  }
+
+  const __m256i vacc0x0213 = _mm256_hadd_epi32(vacc0x01, vacc0x23);
+  const __m256i vacc0x4657 = _mm256_hadd_epi32(vacc0x45, vacc0x67);
+  const __m256i vacc1x0213 = _mm256_hadd_epi32(vacc1x01, vacc1x23);
+  const __m256i vacc1x4657 = _mm256_hadd_epi32(vacc1x45, vacc1x67);
+  const __m256i vacc2x0213 = _mm256_hadd_epi32(vacc2x01, vacc2x23);
+  const __m256i vacc2x4657 = _mm256_hadd_epi32(vacc2x45, vacc2x67);
+
+  const __m256i vacc0x02461357 = _mm256_hadd_epi32(vacc0x0213, vacc0x4657);
+  const __m256i vacc1x02461357 = _mm256_hadd_epi32(vacc1x0213, vacc1x4657);
+  const __m256i vacc2x02461357 = _mm256_hadd_epi32(vacc2x0213, vacc2x4657);
+
+  const __m256i vpermute_mask = _mm256_set_epi32(7, 3, 6, 2, 5, 1, 4, 0);
+  const __m256i vacc0x01234567 = _mm256_permutevar8x32_epi32(vacc0x02461357, vpermute_mask);
+  const __m256i vacc1x01234567 = _mm256_permutevar8x32_epi32(vacc1x02461357, vpermute_mask);
+  const __m256i vacc2x01234567 = _mm256_permutevar8x32_epi32(vacc2x02461357, vpermute_mask);
+
+  if XNN_LIKELY(nc == 8) {
+    _mm256_storeu_si256((__m256i*) c2, vacc2x01234567);
+    _mm256_storeu_si256((__m256i*) c1, vacc1x01234567);
+    _mm256_storeu_si256((__m256i*) c0, vacc0x01234567);
+  } else {
+    __m128i vacc2x0123 = _mm256_castsi256_si128(vacc2x01234567);
+    __m128i vacc1x0123 = _mm256_castsi256_si128(vacc1x01234567);
+    __m128i vacc0x0123 = _mm256_castsi256_si128(vacc0x01234567);
+    if (nc & 4) {
+      _mm_storeu_si128((__m128i*) c2, vacc2x0123);
+      _mm_storeu_si128((__m128i*) c1, vacc1x0123);
+      _mm_storeu_si128((__m128i*) c0, vacc0x0123);
+
+      vacc2x0123 = _mm256_extracti128_si256(vacc2x01234567, 1);
+      vacc1x0123 = _mm256_extracti128_si256(vacc1x01234567, 1);
+      vacc0x0123 = _mm256_extracti128_si256(vacc0x01234567, 1);
+
+      c2 += 4;
+      c1 += 4;
+      c0 += 4;
+    }
+    if (nc & 2) {
+      _mm_storel_epi64((__m128i*) c2, vacc2x0123);
+      _mm_storel_epi64((__m128i*) c1, vacc1x0123);
+      _mm_storel_epi64((__m128i*) c0, vacc0x0123);
+
+      vacc2x0123 = _mm_unpackhi_epi64(vacc2x0123, vacc2x0123);
+      vacc1x0123 = _mm_unpackhi_epi64(vacc1x0123, vacc1x0123);
+      vacc0x0123 = _mm_unpackhi_epi64(vacc0x0123, vacc0x0123);
+
+      c2 += 2;
+      c1 += 2;
+      c0 += 2;
+    }
+    if (nc & 1) {
+      *c2 = _mm_cvtsi128_si32(vacc2x0123);
+      *c1 = _mm_cvtsi128_si32(vacc1x0123);
+      *c0 = _mm_cvtsi128_si32(vacc0x0123);
+    }
+  }
+}
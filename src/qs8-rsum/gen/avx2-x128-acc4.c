@@ -0,0 +1,74 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-rsum/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_qs8_rsum_ukernel__avx2_x128_acc4(
+    size_t batch,
+    const int8_t* input,
+    int32_t* output)
+{
+  assert(batch != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Signed inputs are biased to unsigned by flipping the sign bit, and summed up with VPSADBW against zero into 64-bit
+  // lanes. The bias of 128 per element is subtracted from the total at the end.
+  const uint32_t vbias = UINT32_C(128) * (uint32_t) batch;
+  const __m256i vsign_mask = _mm256_set1_epi8(INT8_C(-128));
+  const __m256i vzero = _mm256_setzero_si256();
+  __m256i vacc0 = _mm256_setzero_si256();
+  __m256i vacc1 = _mm256_setzero_si256();
+  __m256i vacc2 = _mm256_setzero_si256();
+  __m256i vacc3 = _mm256_setzero_si256();
+  for (; batch >= 128 * sizeof(int8_t); batch -= 128 * sizeof(int8_t)) {
+    const __m256i vt0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) input), vsign_mask);
+    const __m256i vt1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) (input + 32)), vsign_mask);
+    const __m256i vt2 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) (input + 64)), vsign_mask);
+    const __m256i vt3 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) (input + 96)), vsign_mask);
+    input += 128;
+
+    vacc0 = _mm256_add_epi64(vacc0, _mm256_sad_epu8(vt0, vzero));
+    vacc1 = _mm256_add_epi64(vacc1, _mm256_sad_epu8(vt1, vzero));
+    vacc2 = _mm256_add_epi64(vacc2, _mm256_sad_epu8(vt2, vzero));
+    vacc3 = _mm256_add_epi64(vacc3, _mm256_sad_epu8(vt3, vzero));
+  }
+  vacc0 = _mm256_add_epi64(vacc0, vacc1);
+  vacc2 = _mm256_add_epi64(vacc2, vacc3);
+  vacc0 = _mm256_add_epi64(vacc0, vacc2);
+  for (; batch >= 32 * sizeof(int8_t); batch -= 32 * sizeof(int8_t)) {
+    const __m256i vt = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*) input), vsign_mask);
+    input += 32;
+
+    vacc0 = _mm256_add_epi64(vacc0, _mm256_sad_epu8(vt, vzero));
+  }
+  __m128i vacc = _mm_add_epi64(_mm256_castsi256_si128(vacc0), _mm256_extracti128_si256(vacc0, 1));
+  if (batch >= 16 * sizeof(int8_t)) {
+    const __m128i vt = _mm_xor_si128(_mm_loadu_si128((const __m128i*) input), _mm256_castsi256_si128(vsign_mask));
+    input += 16;
+
+    vacc = _mm_add_epi64(vacc, _mm_sad_epu8(vt, _mm256_castsi256_si128(vzero)));
+    batch -= 16 * sizeof(int8_t);
+  }
+  vacc = _mm_add_epi64(vacc, _mm_unpackhi_epi64(vacc, vacc));
+  uint32_t vsum = (uint32_t) _mm_cvtsi128_si32(vacc);
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      vsum += (uint32_t) (uint8_t) (*input++ ^ INT8_C(-128));
+      batch -= sizeof(int8_t);
+    } while (batch != 0);
+  }
+  *output = (int32_t) (vsum - vbias);
+}
@@ -0,0 +1,61 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-rsum/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_qs8_rsum_ukernel__neon_x32_acc2(
+    size_t batch,
+    const int8_t* input,
+    int32_t* output)
+{
+  assert(batch != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  int32x4_t vacc0 = vmovq_n_s32(0);
+  int32x4_t vacc1 = vmovq_n_s32(0);
+  for (; batch >= 32 * sizeof(int8_t); batch -= 32 * sizeof(int8_t)) {
+    const int8x16_t vt0 = vld1q_s8(input); input += 16;
+    const int8x16_t vt1 = vld1q_s8(input); input += 16;
+
+    vacc0 = vpadalq_s16(vacc0, vpaddlq_s8(vt0));
+    vacc1 = vpadalq_s16(vacc1, vpaddlq_s8(vt1));
+  }
+  vacc0 = vaddq_s32(vacc0, vacc1);
+  for (; batch >= 16 * sizeof(int8_t); batch -= 16 * sizeof(int8_t)) {
+    const int8x16_t vt = vld1q_s8(input); input += 16;
+
+    vacc0 = vpadalq_s16(vacc0, vpaddlq_s8(vt));
+  }
+  if (batch >= 8 * sizeof(int8_t)) {
+    const int8x8_t vt = vld1_s8(input); input += 8;
+
+    vacc0 = vaddw_s16(vacc0, vpaddl_s8(vt));
+    batch -= 8 * sizeof(int8_t);
+  }
+  #if XNN_ARCH_ARM64
+    int32_t vsum = vaddvq_s32(vacc0);
+  #else
+    const int32x2_t vacc_lo = vadd_s32(vget_low_s32(vacc0), vget_high_s32(vacc0));
+    int32_t vsum = vget_lane_s32(vpadd_s32(vacc_lo, vacc_lo), 0);
+  #endif
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      vsum += (int32_t) *input++;
+      batch -= sizeof(int8_t);
+    } while (batch != 0);
+  }
+  *output = vsum;
+}
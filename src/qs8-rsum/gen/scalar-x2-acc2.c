@@ -0,0 +1,45 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-rsum/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_qs8_rsum_ukernel__scalar_x2_acc2(
+    size_t batch,
+    const int8_t* input,
+    int32_t* output)
+{
+  assert(batch != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  int32_t vacc0 = 0;
+  int32_t vacc1 = 0;
+  for (; batch >= 2 * sizeof(int8_t); batch -= 2 * sizeof(int8_t)) {
+    const int32_t vt0 = (int32_t) input[0];
+    const int32_t vt1 = (int32_t) input[1];
+    input += 2;
+
+    vacc0 += vt0;
+    vacc1 += vt1;
+  }
+  vacc0 += vacc1;
+
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      const int32_t vt = (int32_t) *input++;
+      vacc0 += vt;
+      batch -= sizeof(int8_t);
+    } while (batch != 0);
+  }
+  *output = vacc0;
+}
@@ -0,0 +1,58 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-rsum/sse2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/reduce.h>
+
+
+void xnn_qs8_rsum_ukernel__sse2_x32_acc2(
+    size_t batch,
+    const int8_t* input,
+    int32_t* output)
+{
+  assert(batch != 0);
+  assert(input != NULL);
+  assert(output != NULL);
+
+  // Signed inputs are biased to unsigned by flipping the sign bit, and summed up with PSADBW against zero into 64-bit
+  // lanes. The bias of 128 per element is subtracted from the total at the end.
+  const uint32_t vbias = UINT32_C(128) * (uint32_t) batch;
+  const __m128i vsign_mask = _mm_set1_epi8(INT8_C(-128));
+  const __m128i vzero = _mm_setzero_si128();
+  __m128i vacc0 = _mm_setzero_si128();
+  __m128i vacc1 = _mm_setzero_si128();
+  for (; batch >= 32 * sizeof(int8_t); batch -= 32 * sizeof(int8_t)) {
+    const __m128i vt0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) input), vsign_mask);
+    const __m128i vt1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*) (input + 16)), vsign_mask);
+    input += 32;
+
+    vacc0 = _mm_add_epi64(vacc0, _mm_sad_epu8(vt0, vzero));
+    vacc1 = _mm_add_epi64(vacc1, _mm_sad_epu8(vt1, vzero));
+  }
+  vacc0 = _mm_add_epi64(vacc0, vacc1);
+  for (; batch >= 16 * sizeof(int8_t); batch -= 16 * sizeof(int8_t)) {
+    const __m128i vt = _mm_xor_si128(_mm_loadu_si128((const __m128i*) input), vsign_mask);
+    input += 16;
+
+    vacc0 = _mm_add_epi64(vacc0, _mm_sad_epu8(vt, vzero));
+  }
+  vacc0 = _mm_add_epi64(vacc0, _mm_unpackhi_epi64(vacc0, vacc0));
+  uint32_t vsum = (uint32_t) _mm_cvtsi128_si32(vacc0);
+  if XNN_UNLIKELY(batch != 0) {
+    do {
+      vsum += (uint32_t) (uint8_t) (*input++ ^ INT8_C(-128));
+      batch -= sizeof(int8_t);
+    } while (batch != 0);
+  }
+  *output = (int32_t) (vsum - vbias);
+}
@@ -0,0 +1,110 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-softmax/avx2.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_softmax_ukernel__avx2(
+    size_t n,
+    const int8_t* x,
+    const uint32_t* t,
+    int8_t* y)
+{
+  assert(n != 0);
+
+  const int8_t* xmax = x;
+  size_t nmax = n;
+  __m256i vmax32 = _mm256_set1_epi8((char) *xmax);
+  for (; nmax >= 32; nmax -= 32) {
+    vmax32 = _mm256_max_epi8(vmax32, _mm256_loadu_si256((const __m256i*) xmax));
+    xmax += 32;
+  }
+  __m128i vmax16 = _mm_max_epi8(_mm256_castsi256_si128(vmax32), _mm256_extracti128_si256(vmax32, 1));
+  vmax16 = _mm_max_epi8(vmax16, _mm_unpackhi_epi64(vmax16, vmax16));
+  vmax16 = _mm_max_epi8(vmax16, _mm_srli_epi64(vmax16, 32));
+  vmax16 = _mm_max_epi8(vmax16, _mm_srli_epi32(vmax16, 16));
+  vmax16 = _mm_max_epi8(vmax16, _mm_srli_epi16(vmax16, 8));
+  int32_t vmax = (int32_t) (int8_t) _mm_cvtsi128_si32(vmax16);
+  for (; nmax != 0; nmax--) {
+    vmax = math_max_s32(vmax, (int32_t) *xmax++);
+  }
+  // The maximum input element maps to the last table entry.
+  const int32_t vadjustment = 255 - vmax;
+  const __m256i vadjustment_vec = _mm256_set1_epi32(vadjustment);
+
+  __m256i vacc = _mm256_setzero_si256();
+  const int8_t* xsum = x;
+  size_t nsum = n;
+  for (; nsum >= 8; nsum -= 8) {
+    const __m256i vx = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*) xsum));
+    xsum += 8;
+    const __m256i vidx = _mm256_add_epi32(vx, vadjustment_vec);
+    vacc = _mm256_add_epi32(vacc, _mm256_i32gather_epi32((const int*) t, vidx, sizeof(uint32_t)));
+  }
+  __m128i vacc_lo = _mm_add_epi32(_mm256_castsi256_si128(vacc), _mm256_extracti128_si256(vacc, 1));
+  vacc_lo = _mm_add_epi32(vacc_lo, _mm_shuffle_epi32(vacc_lo, _MM_SHUFFLE(1, 0, 3, 2)));
+  vacc_lo = _mm_add_epi32(vacc_lo, _mm_shuffle_epi32(vacc_lo, _MM_SHUFFLE(2, 3, 0, 1)));
+  uint32_t vsum = (uint32_t) _mm_cvtsi128_si32(vacc_lo);
+  for (; nsum != 0; nsum--) {
+    vsum += t[(int32_t) *xsum++ + vadjustment];
+  }
+  assert(vsum != 0);
+
+  // Division by the sum is replaced with a multiplication by a magic number and shifts, as in fxdiv:
+  // q = (t + ((n - t) >> shift1)) >> shift2, where t is the high half of n * multiplier.
+  uint32_t vmultiplier = 1;
+  uint32_t vshift1 = 0;
+  uint32_t vshift2 = 0;
+  if (vsum != 1) {
+    const uint32_t l_minus_1 = 31 - math_clz_nonzero_u32(vsum - 1);
+    const uint32_t u_hi = (UINT32_C(2) << l_minus_1) - vsum;
+    vmultiplier = (uint32_t) ((((uint64_t) u_hi) << 32) / vsum) + 1;
+    vshift1 = 1;
+    vshift2 = l_minus_1;
+  }
+
+  const uint32_t vrounding = vsum >> 1;
+  const __m256i vrounding_vec = _mm256_set1_epi32((int) vrounding);
+  const __m256i vmultiplier_vec = _mm256_set1_epi32((int) vmultiplier);
+  const __m128i vshift1_vec = _mm_cvtsi32_si128((int) vshift1);
+  const __m128i vshift2_vec = _mm_cvtsi32_si128((int) vshift2);
+  const __m256i vmax_output = _mm256_set1_epi32(255);
+  const __m256i voutput_zero_point = _mm256_set1_epi32(-128);
+  for (; n >= 8; n -= 8) {
+    const __m256i vx = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*) x));
+    x += 8;
+    const __m256i vt = _mm256_i32gather_epi32((const int*) t, _mm256_add_epi32(vx, vadjustment_vec), sizeof(uint32_t));
+    const __m256i vn = _mm256_add_epi32(_mm256_slli_epi32(vt, 8), vrounding_vec);
+
+    const __m256i vprod_even = _mm256_mul_epu32(vn, vmultiplier_vec);
+    const __m256i vprod_odd = _mm256_mul_epu32(_mm256_srli_epi64(vn, 32), vmultiplier_vec);
+    const __m256i vmulhi = _mm256_blend_epi32(_mm256_srli_epi64(vprod_even, 32), vprod_odd, 0xAA);
+    const __m256i vq = _mm256_srl_epi32(
+      _mm256_add_epi32(vmulhi, _mm256_srl_epi32(_mm256_sub_epi32(vn, vmulhi), vshift1_vec)), vshift2_vec);
+
+    const __m256i vy = _mm256_add_epi32(_mm256_min_epu32(vq, vmax_output), voutput_zero_point);
+    const __m256i vy16 = _mm256_packs_epi32(vy, vy);
+    const __m256i vy8 = _mm256_packs_epi16(vy16, vy16);
+    const __m128i vout = _mm_unpacklo_epi32(_mm256_castsi256_si128(vy8), _mm256_extracti128_si256(vy8, 1));
+    _mm_storel_epi64((__m128i*) y, vout);
+    y += 8;
+  }
+  for (; n != 0; n--) {
+    const uint32_t vn = (t[(int32_t) *x++ + vadjustment] << 8) + vrounding;
+    const uint32_t vmulhi = (uint32_t) (((uint64_t) vn * (uint64_t) vmultiplier) >> 32);
+    const uint32_t vq = (vmulhi + ((vn - vmulhi) >> vshift1)) >> vshift2;
+    const int32_t vout = (int32_t) math_min_u32(vq, 255);
+    *y++ = (int8_t) (vout - 128);
+  }
+}
@@ -0,0 +1,47 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-softmax/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fxdiv.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qs8_softmax_ukernel__scalar(
+    size_t n,
+    const int8_t* x,
+    const uint32_t* t,
+    int8_t* y)
+{
+  assert(n != 0);
+
+  int32_t vmax = (int32_t) x[0];
+  for (size_t i = 1; i < n; i++) {
+    vmax = math_max_s32(vmax, (int32_t) x[i]);
+  }
+  // The maximum input element maps to the last table entry.
+  const int32_t vadjustment = 255 - vmax;
+
+  uint32_t vsum = 0;
+  for (size_t i = 0; i < n; i++) {
+    vsum += t[(int32_t) x[i] + vadjustment];
+  }
+  assert(vsum != 0);
+
+  struct fxdiv_divisor_uint32_t vsum_divisor = fxdiv_init_uint32_t(vsum);
+  const uint32_t vrounding = (vsum >> 1);
+  do {
+    const uint32_t vt = t[(int32_t) *x++ + vadjustment];
+    const uint32_t vq = fxdiv_quotient_uint32_t((vt << 8) + vrounding, vsum_divisor);
+    const int32_t vout = (int32_t) math_min_u32(vq, 255);
+    *y++ = (int8_t) (vout - 128);
+  } while (--n != 0);
+}
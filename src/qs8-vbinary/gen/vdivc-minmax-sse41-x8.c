@@ -0,0 +1,89 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vbinary/vopc-sse41.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vbinary.h>
+
+
+void xnn_qs8_vdivc_minmax_ukernel__sse41_x8(
+    size_t n,
+    const int8_t* input_a,
+    const int8_t* input_b,
+    int8_t* output,
+    const union xnn_qs8_binary_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input_a != NULL);
+  assert(input_b != NULL);
+  assert(output != NULL);
+
+  const __m128i va_zero_point = _mm_load_si128((const __m128i*) params->sse4.a_zero_point);
+  const __m128 va_scale = _mm_load_ps(params->sse4.a_scale);
+  const __m128 vscale = _mm_load_ps(params->sse4.scale);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->sse4.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->sse4.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->sse4.output_min);
+  const __m128 vb = _mm_set1_ps((float) ((int32_t) *input_b - (int32_t) params->sse4.b_zero_point[0]) * params->sse4.b_scale[0]);
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    __m128i vam = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) input_a));
+    vam = _mm_sub_epi16(vam, va_zero_point);
+    input_a += 8;
+
+    const __m128 va_lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vam)), va_scale);
+    const __m128 va_hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vam, vam))), va_scale);
+    __m128 vacc_lo = _mm_div_ps(va_lo, vb);
+    __m128 vacc_hi = _mm_div_ps(va_hi, vb);
+    vacc_lo = _mm_min_ps(_mm_mul_ps(vacc_lo, vscale), voutput_max_less_zero_point);
+    vacc_hi = _mm_min_ps(_mm_mul_ps(vacc_hi, vscale), voutput_max_less_zero_point);
+
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vacc_lo), _mm_cvtps_epi32(vacc_hi)), voutput_zero_point);
+    __m128i vout = _mm_packs_epi16(vacc, vacc);
+    vout = _mm_max_epi8(vout, voutput_min);
+
+    _mm_storel_epi64((__m128i*) output, vout);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    __m128i vam = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) input_a));
+    vam = _mm_sub_epi16(vam, va_zero_point);
+
+    const __m128 va_lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vam)), va_scale);
+    const __m128 va_hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vam, vam))), va_scale);
+    __m128 vacc_lo = _mm_div_ps(va_lo, vb);
+    __m128 vacc_hi = _mm_div_ps(va_hi, vb);
+    vacc_lo = _mm_min_ps(_mm_mul_ps(vacc_lo, vscale), voutput_max_less_zero_point);
+    vacc_hi = _mm_min_ps(_mm_mul_ps(vacc_hi, vscale), voutput_max_less_zero_point);
+
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vacc_lo), _mm_cvtps_epi32(vacc_hi)), voutput_zero_point);
+    __m128i vout = _mm_packs_epi16(vacc, vacc);
+    vout = _mm_max_epi8(vout, voutput_min);
+
+    if (n & (4 * sizeof(int8_t))) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+      vout = _mm_srli_epi64(vout, 32);
+      output += 4;
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+      vout = _mm_srli_epi32(vout, 16);
+      output += 2;
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      *output = (int8_t) _mm_extract_epi8(vout, 0);
+    }
+  }
+}
@@ -0,0 +1,53 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vbinary/vop-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vbinary.h>
+
+
+void xnn_qs8_vmax_minmax_ukernel__scalar_x1(
+    size_t n,
+    const int8_t* input_a,
+    const int8_t* input_b,
+    int8_t* output,
+    const union xnn_qs8_binary_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input_a != NULL);
+  assert(input_b != NULL);
+  assert(output != NULL);
+
+  const int32_t va_zero_point = params->scalar.a_zero_point;
+  const int32_t vb_zero_point = params->scalar.b_zero_point;
+  const float va_scale = params->scalar.a_scale;
+  const float vb_scale = params->scalar.b_scale;
+  const float vscale = params->scalar.scale;
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+  do {
+    const float va = (float) ((int32_t) *input_a++ - va_zero_point) * va_scale;
+    const float vb = (float) ((int32_t) *input_b++ - vb_zero_point) * vb_scale;
+    float vacc = math_max_f32(va, vb);
+    vacc *= vscale;
+    vacc = math_max_f32(vacc, voutput_min_less_zero_point);
+    vacc = math_min_f32(vacc, voutput_max_less_zero_point);
+    vacc += vmagic_bias;
+    const int32_t vout = (int32_t) fp32_to_bits(vacc) - vmagic_bias_less_output_zero_point;
+    *output++ = (int8_t) vout;
+
+    n -= sizeof(int8_t);
+  } while (n != 0);
+}
@@ -0,0 +1,105 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vbinary/vop-scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vbinary.h>
+
+
+void xnn_qs8_vmax_minmax_ukernel__scalar_x4(
+    size_t n,
+    const int8_t* input_a,
+    const int8_t* input_b,
+    int8_t* output,
+    const union xnn_qs8_binary_minmax_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input_a != NULL);
+  assert(input_b != NULL);
+  assert(output != NULL);
+
+  const int32_t va_zero_point = params->scalar.a_zero_point;
+  const int32_t vb_zero_point = params->scalar.b_zero_point;
+  const float va_scale = params->scalar.a_scale;
+  const float vb_scale = params->scalar.b_scale;
+  const float vscale = params->scalar.scale;
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+  for (; n >= 4 * sizeof(int8_t); n -= 4 * sizeof(int8_t)) {
+    const float va0 = (float) ((int32_t) input_a[0] - va_zero_point) * va_scale;
+    const float va1 = (float) ((int32_t) input_a[1] - va_zero_point) * va_scale;
+    const float va2 = (float) ((int32_t) input_a[2] - va_zero_point) * va_scale;
+    const float va3 = (float) ((int32_t) input_a[3] - va_zero_point) * va_scale;
+    input_a += 4;
+
+    const float vb0 = (float) ((int32_t) input_b[0] - vb_zero_point) * vb_scale;
+    const float vb1 = (float) ((int32_t) input_b[1] - vb_zero_point) * vb_scale;
+    const float vb2 = (float) ((int32_t) input_b[2] - vb_zero_point) * vb_scale;
+    const float vb3 = (float) ((int32_t) input_b[3] - vb_zero_point) * vb_scale;
+    input_b += 4;
+
+    float vacc0 = math_max_f32(va0, vb0);
+    float vacc1 = math_max_f32(va1, vb1);
+    float vacc2 = math_max_f32(va2, vb2);
+    float vacc3 = math_max_f32(va3, vb3);
+
+
+    vacc0 *= vscale;
+    vacc1 *= vscale;
+    vacc2 *= vscale;
+    vacc3 *= vscale;
+
+    vacc0 = math_max_f32(vacc0, voutput_min_less_zero_point);
+    vacc1 = math_max_f32(vacc1, voutput_min_less_zero_point);
+    vacc2 = math_max_f32(vacc2, voutput_min_less_zero_point);
+    vacc3 = math_max_f32(vacc3, voutput_min_less_zero_point);
+
+    vacc0 = math_min_f32(vacc0, voutput_max_less_zero_point);
+    vacc1 = math_min_f32(vacc1, voutput_max_less_zero_point);
+    vacc2 = math_min_f32(vacc2, voutput_max_less_zero_point);
+    vacc3 = math_min_f32(vacc3, voutput_max_less_zero_point);
+
+    vacc0 += vmagic_bias;
+    vacc1 += vmagic_bias;
+    vacc2 += vmagic_bias;
+    vacc3 += vmagic_bias;
+
+    const int32_t vout0 = (int32_t) fp32_to_bits(vacc0) - vmagic_bias_less_output_zero_point;
+    const int32_t vout1 = (int32_t) fp32_to_bits(vacc1) - vmagic_bias_less_output_zero_point;
+    const int32_t vout2 = (int32_t) fp32_to_bits(vacc2) - vmagic_bias_less_output_zero_point;
+    const int32_t vout3 = (int32_t) fp32_to_bits(vacc3) - vmagic_bias_less_output_zero_point;
+
+    output[0] = (int8_t) vout0;
+    output[1] = (int8_t) vout1;
+    output[2] = (int8_t) vout2;
+    output[3] = (int8_t) vout3;
+    output += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float va = (float) ((int32_t) *input_a++ - va_zero_point) * va_scale;
+      const float vb = (float) ((int32_t) *input_b++ - vb_zero_point) * vb_scale;
+      float vacc = math_max_f32(va, vb);
+      vacc *= vscale;
+      vacc = math_max_f32(vacc, voutput_min_less_zero_point);
+      vacc = math_min_f32(vacc, voutput_max_less_zero_point);
+      vacc += vmagic_bias;
+      const int32_t vout = (int32_t) fp32_to_bits(vacc) - vmagic_bias_less_output_zero_point;
+      *output++ = (int8_t) vout;
+
+      n -= sizeof(int8_t);
+    } while (n != 0);
+  }
+}
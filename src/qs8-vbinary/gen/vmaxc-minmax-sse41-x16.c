@@ -0,0 +1,133 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vbinary/vopc-sse41.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vbinary.h>
+
+
+void xnn_qs8_vmaxc_minmax_ukernel__sse41_x16(
+    size_t n,
+    const int8_t* input_a,
+    const int8_t* input_b,
+    int8_t* output,
+    const union xnn_qs8_binary_minmax_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(input_a != NULL);
+  assert(input_b != NULL);
+  assert(output != NULL);
+
+  const __m128i va_zero_point = _mm_load_si128((const __m128i*) params->sse4.a_zero_point);
+  const __m128 va_scale = _mm_load_ps(params->sse4.a_scale);
+  const __m128 vscale = _mm_load_ps(params->sse4.scale);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->sse4.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->sse4.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->sse4.output_min);
+  const __m128 vb = _mm_set1_ps((float) ((int32_t) *input_b - (int32_t) params->sse4.b_zero_point[0]) * params->sse4.b_scale[0]);
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    __m128i vam01234567 = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) (input_a + 0)));
+    __m128i vam89ABCDEF = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) (input_a + 8)));
+    input_a += 16;
+
+    vam01234567 = _mm_sub_epi16(vam01234567, va_zero_point);
+    vam89ABCDEF = _mm_sub_epi16(vam89ABCDEF, va_zero_point);
+
+    const __m128 va0123 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vam01234567)), va_scale);
+    const __m128 va4567 = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vam01234567, vam01234567))), va_scale);
+    const __m128 va89AB = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vam89ABCDEF)), va_scale);
+    const __m128 vaCDEF = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vam89ABCDEF, vam89ABCDEF))), va_scale);
+
+    __m128 vacc0123 = _mm_max_ps(va0123, vb);
+    __m128 vacc4567 = _mm_max_ps(va4567, vb);
+    __m128 vacc89AB = _mm_max_ps(va89AB, vb);
+    __m128 vaccCDEF = _mm_max_ps(vaCDEF, vb);
+
+
+    vacc0123 = _mm_mul_ps(vacc0123, vscale);
+    vacc4567 = _mm_mul_ps(vacc4567, vscale);
+    vacc89AB = _mm_mul_ps(vacc89AB, vscale);
+    vaccCDEF = _mm_mul_ps(vaccCDEF, vscale);
+
+    vacc0123 = _mm_min_ps(vacc0123, voutput_max_less_zero_point);
+    vacc4567 = _mm_min_ps(vacc4567, voutput_max_less_zero_point);
+    vacc89AB = _mm_min_ps(vacc89AB, voutput_max_less_zero_point);
+    vaccCDEF = _mm_min_ps(vaccCDEF, voutput_max_less_zero_point);
+
+    const __m128i vout0123 = _mm_cvtps_epi32(vacc0123);
+    const __m128i vout4567 = _mm_cvtps_epi32(vacc4567);
+    const __m128i vout89AB = _mm_cvtps_epi32(vacc89AB);
+    const __m128i voutCDEF = _mm_cvtps_epi32(vaccCDEF);
+
+    const __m128i vout01234567 = _mm_adds_epi16(_mm_packs_epi32(vout0123, vout4567), voutput_zero_point);
+    const __m128i vout89ABCDEF = _mm_adds_epi16(_mm_packs_epi32(vout89AB, voutCDEF), voutput_zero_point);
+
+    __m128i vout0123456789ABCDEF = _mm_packs_epi16(vout01234567, vout89ABCDEF);
+
+    vout0123456789ABCDEF = _mm_max_epi8(vout0123456789ABCDEF, voutput_min);
+
+    _mm_storeu_si128((__m128i*) (output + 0), vout0123456789ABCDEF);
+    output += 16;
+  }
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    __m128i vam = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) input_a));
+    vam = _mm_sub_epi16(vam, va_zero_point);
+    input_a += 8;
+
+    const __m128 va_lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vam)), va_scale);
+    const __m128 va_hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vam, vam))), va_scale);
+    __m128 vacc_lo = _mm_max_ps(va_lo, vb);
+    __m128 vacc_hi = _mm_max_ps(va_hi, vb);
+    vacc_lo = _mm_min_ps(_mm_mul_ps(vacc_lo, vscale), voutput_max_less_zero_point);
+    vacc_hi = _mm_min_ps(_mm_mul_ps(vacc_hi, vscale), voutput_max_less_zero_point);
+
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vacc_lo), _mm_cvtps_epi32(vacc_hi)), voutput_zero_point);
+    __m128i vout = _mm_packs_epi16(vacc, vacc);
+    vout = _mm_max_epi8(vout, voutput_min);
+
+    _mm_storel_epi64((__m128i*) output, vout);
+    output += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    __m128i vam = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) input_a));
+    vam = _mm_sub_epi16(vam, va_zero_point);
+
+    const __m128 va_lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(vam)), va_scale);
+    const __m128 va_hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vam, vam))), va_scale);
+    __m128 vacc_lo = _mm_max_ps(va_lo, vb);
+    __m128 vacc_hi = _mm_max_ps(va_hi, vb);
+    vacc_lo = _mm_min_ps(_mm_mul_ps(vacc_lo, vscale), voutput_max_less_zero_point);
+    vacc_hi = _mm_min_ps(_mm_mul_ps(vacc_hi, vscale), voutput_max_less_zero_point);
+
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vacc_lo), _mm_cvtps_epi32(vacc_hi)), voutput_zero_point);
+    __m128i vout = _mm_packs_epi16(vacc, vacc);
+    vout = _mm_max_epi8(vout, voutput_min);
+
+    if (n & (4 * sizeof(int8_t))) {
+      *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+      vout = _mm_srli_epi64(vout, 32);
+      output += 4;
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+      vout = _mm_srli_epi32(vout, 16);
+      output += 2;
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      *output = (int8_t) _mm_extract_epi8(vout, 0);
+    }
+  }
+}
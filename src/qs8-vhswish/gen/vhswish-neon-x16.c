@@ -0,0 +1,172 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vhswish/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vhswish_ukernel__neon_x16(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_hswish_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const int16x8_t vinput_zero_point = vld1q_dup_s16(&params->neon.input_zero_point);
+  const float32x4_t vgate_scale = vld1q_dup_f32(&params->neon.gate_scale);
+  const float32x4_t vscale = vld1q_dup_f32(&params->neon.scale);
+  const float32x4_t vmagic_bias = vld1q_dup_f32(&params->neon.magic_bias);
+  const int32x4_t vmagic_bias_less_output_zero_point = vld1q_dup_s32(&params->neon.magic_bias_less_output_zero_point);
+  const int8x8_t voutput_min = vld1_dup_s8(&params->neon.output_min);
+  const int8x8_t voutput_max = vld1_dup_s8(&params->neon.output_max);
+  const float32x4_t vhalf = vmovq_n_f32(0.5f);
+  const float32x4_t vone = vmovq_n_f32(1.0f);
+  const float32x4_t vzero = vmovq_n_f32(0.0f);
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    const int8x8_t vx01234567 = vld1_s8(x); x += 8;
+    const int8x8_t vx89ABCDEF = vld1_s8(x); x += 8;
+
+    const int16x8_t vxm01234567 = vsubq_s16(vmovl_s8(vx01234567), vinput_zero_point);
+    const int16x8_t vxm89ABCDEF = vsubq_s16(vmovl_s8(vx89ABCDEF), vinput_zero_point);
+
+    const float32x4_t vfpx0123 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(vxm01234567)));
+    const float32x4_t vfpx4567 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(vxm01234567)));
+    const float32x4_t vfpx89AB = vcvtq_f32_s32(vmovl_s16(vget_low_s16(vxm89ABCDEF)));
+    const float32x4_t vfpxCDEF = vcvtq_f32_s32(vmovl_s16(vget_high_s16(vxm89ABCDEF)));
+
+    float32x4_t vgate0123 = vmlaq_f32(vhalf, vfpx0123, vgate_scale);
+    float32x4_t vgate4567 = vmlaq_f32(vhalf, vfpx4567, vgate_scale);
+    float32x4_t vgate89AB = vmlaq_f32(vhalf, vfpx89AB, vgate_scale);
+    float32x4_t vgateCDEF = vmlaq_f32(vhalf, vfpxCDEF, vgate_scale);
+
+    vgate0123 = vmaxq_f32(vgate0123, vzero);
+    vgate4567 = vmaxq_f32(vgate4567, vzero);
+    vgate89AB = vmaxq_f32(vgate89AB, vzero);
+    vgateCDEF = vmaxq_f32(vgateCDEF, vzero);
+
+    vgate0123 = vminq_f32(vgate0123, vone);
+    vgate4567 = vminq_f32(vgate4567, vone);
+    vgate89AB = vminq_f32(vgate89AB, vone);
+    vgateCDEF = vminq_f32(vgateCDEF, vone);
+
+    float32x4_t vfpacc0123 = vmulq_f32(vfpx0123, vscale);
+    float32x4_t vfpacc4567 = vmulq_f32(vfpx4567, vscale);
+    float32x4_t vfpacc89AB = vmulq_f32(vfpx89AB, vscale);
+    float32x4_t vfpaccCDEF = vmulq_f32(vfpxCDEF, vscale);
+
+    vfpacc0123 = vmulq_f32(vfpacc0123, vgate0123);
+    vfpacc4567 = vmulq_f32(vfpacc4567, vgate4567);
+    vfpacc89AB = vmulq_f32(vfpacc89AB, vgate89AB);
+    vfpaccCDEF = vmulq_f32(vfpaccCDEF, vgateCDEF);
+
+    int32x4_t vacc0123 = vreinterpretq_s32_f32(vaddq_f32(vfpacc0123, vmagic_bias));
+    int32x4_t vacc4567 = vreinterpretq_s32_f32(vaddq_f32(vfpacc4567, vmagic_bias));
+    int32x4_t vacc89AB = vreinterpretq_s32_f32(vaddq_f32(vfpacc89AB, vmagic_bias));
+    int32x4_t vaccCDEF = vreinterpretq_s32_f32(vaddq_f32(vfpaccCDEF, vmagic_bias));
+
+    vacc0123 = vqsubq_s32(vacc0123, vmagic_bias_less_output_zero_point);
+    vacc4567 = vqsubq_s32(vacc4567, vmagic_bias_less_output_zero_point);
+    vacc89AB = vqsubq_s32(vacc89AB, vmagic_bias_less_output_zero_point);
+    vaccCDEF = vqsubq_s32(vaccCDEF, vmagic_bias_less_output_zero_point);
+
+    #if XNN_ARCH_ARM64
+      const int16x8_t vacc01234567 = vqmovn_high_s32(vqmovn_s32(vacc0123), vacc4567);
+      const int16x8_t vacc89ABCDEF = vqmovn_high_s32(vqmovn_s32(vacc89AB), vaccCDEF);
+    #else  // !XNN_ARCH_ARM64
+      const int16x8_t vacc01234567 = vcombine_s16(vqmovn_s32(vacc0123), vqmovn_s32(vacc4567));
+      const int16x8_t vacc89ABCDEF = vcombine_s16(vqmovn_s32(vacc89AB), vqmovn_s32(vaccCDEF));
+    #endif  // !XNN_ARCH_ARM64
+
+    int8x8_t vy01234567 = vqmovn_s16(vacc01234567);
+    int8x8_t vy89ABCDEF = vqmovn_s16(vacc89ABCDEF);
+
+    vy01234567 = vmax_s8(vy01234567, voutput_min);
+    vy89ABCDEF = vmax_s8(vy89ABCDEF, voutput_min);
+
+    vy01234567 = vmin_s8(vy01234567, voutput_max);
+    vy89ABCDEF = vmin_s8(vy89ABCDEF, voutput_max);
+
+    vst1_s8(y, vy01234567); y += 8;
+    vst1_s8(y, vy89ABCDEF); y += 8;
+  }
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    const int8x8_t vx = vld1_s8(x); x += 8;
+    const int16x8_t vxm = vsubq_s16(vmovl_s8(vx), vinput_zero_point);
+
+    const float32x4_t vfpx_lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(vxm)));
+    const float32x4_t vfpx_hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(vxm)));
+    float32x4_t vgate_lo = vmlaq_f32(vhalf, vfpx_lo, vgate_scale);
+    float32x4_t vgate_hi = vmlaq_f32(vhalf, vfpx_hi, vgate_scale);
+    vgate_lo = vminq_f32(vmaxq_f32(vgate_lo, vzero), vone);
+    vgate_hi = vminq_f32(vmaxq_f32(vgate_hi, vzero), vone);
+    const float32x4_t vfpacc_lo = vmulq_f32(vmulq_f32(vfpx_lo, vscale), vgate_lo);
+    const float32x4_t vfpacc_hi = vmulq_f32(vmulq_f32(vfpx_hi, vscale), vgate_hi);
+    const int32x4_t vacc_lo = vqsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_lo, vmagic_bias)), vmagic_bias_less_output_zero_point);
+    const int32x4_t vacc_hi = vqsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_hi, vmagic_bias)), vmagic_bias_less_output_zero_point);
+
+    #if XNN_ARCH_ARM64
+      const int16x8_t vacc = vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi);
+    #else  // !XNN_ARCH_ARM64
+      const int16x8_t vacc = vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi));
+    #endif  // !XNN_ARCH_ARM64
+
+    int8x8_t vy = vqmovn_s16(vacc);
+    vy = vmax_s8(vy, voutput_min);
+    vy = vmin_s8(vy, voutput_max);
+    vst1_s8(y, vy); y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    const int8x8_t vx = vld1_s8(x);
+    const int16x8_t vxm = vsubq_s16(vmovl_s8(vx), vinput_zero_point);
+
+    const float32x4_t vfpx_lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(vxm)));
+    const float32x4_t vfpx_hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(vxm)));
+    float32x4_t vgate_lo = vmlaq_f32(vhalf, vfpx_lo, vgate_scale);
+    float32x4_t vgate_hi = vmlaq_f32(vhalf, vfpx_hi, vgate_scale);
+    vgate_lo = vminq_f32(vmaxq_f32(vgate_lo, vzero), vone);
+    vgate_hi = vminq_f32(vmaxq_f32(vgate_hi, vzero), vone);
+    const float32x4_t vfpacc_lo = vmulq_f32(vmulq_f32(vfpx_lo, vscale), vgate_lo);
+    const float32x4_t vfpacc_hi = vmulq_f32(vmulq_f32(vfpx_hi, vscale), vgate_hi);
+    const int32x4_t vacc_lo = vqsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_lo, vmagic_bias)), vmagic_bias_less_output_zero_point);
+    const int32x4_t vacc_hi = vqsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vfpacc_hi, vmagic_bias)), vmagic_bias_less_output_zero_point);
+
+    #if XNN_ARCH_ARM64
+      const int16x8_t vacc = vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi);
+    #else  // !XNN_ARCH_ARM64
+      const int16x8_t vacc = vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi));
+    #endif  // !XNN_ARCH_ARM64
+
+    int8x8_t vy = vqmovn_s16(vacc);
+    vy = vmax_s8(vy, voutput_min);
+    vy = vmin_s8(vy, voutput_max);
+
+    if (n & (4 * sizeof(int8_t))) {
+      vst1_lane_u32((void*) y, vreinterpret_u32_s8(vy), 0); y += 4;
+      vy = vext_s8(vy, vy, 4);
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      vst1_lane_u16((void*) y, vreinterpret_u16_s8(vy), 0); y += 2;
+      vy = vext_s8(vy, vy, 2);
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      vst1_lane_s8(y, vy, 0);
+    }
+  }
+}
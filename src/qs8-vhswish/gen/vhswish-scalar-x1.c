@@ -0,0 +1,51 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vhswish/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vhswish_ukernel__scalar_x1(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_hswish_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const float vgate_scale = params->scalar.gate_scale;
+  const float vscale = params->scalar.scale;
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+  do {
+    const float vx = (float) ((int32_t) *x++ - vinput_zero_point);
+    float vgate = vx * vgate_scale + 0.5f;
+    vgate = math_max_f32(vgate, 0.0f);
+    vgate = math_min_f32(vgate, 1.0f);
+    float vacc = vx * vscale;
+    vacc *= vgate;
+    vacc = math_max_f32(vacc, voutput_min_less_zero_point);
+    vacc = math_min_f32(vacc, voutput_max_less_zero_point);
+    vacc += vmagic_bias;
+    const int32_t vy = (int32_t) fp32_to_bits(vacc) - vmagic_bias_less_output_zero_point;
+    *y++ = (int8_t) vy;
+
+    n -= sizeof(int8_t);
+  } while (n != 0);
+}
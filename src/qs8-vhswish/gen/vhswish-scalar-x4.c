@@ -0,0 +1,111 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vhswish/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <fp16.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vhswish_ukernel__scalar_x4(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_hswish_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const float vgate_scale = params->scalar.gate_scale;
+  const float vscale = params->scalar.scale;
+  const float voutput_min_less_zero_point = params->scalar.output_min_less_zero_point;
+  const float voutput_max_less_zero_point = params->scalar.output_max_less_zero_point;
+  const float vmagic_bias = params->scalar.magic_bias;
+  const int32_t vmagic_bias_less_output_zero_point = params->scalar.magic_bias_less_output_zero_point;
+  for (; n >= 4 * sizeof(int8_t); n -= 4 * sizeof(int8_t)) {
+    const float vx0 = (float) ((int32_t) x[0] - vinput_zero_point);
+    const float vx1 = (float) ((int32_t) x[1] - vinput_zero_point);
+    const float vx2 = (float) ((int32_t) x[2] - vinput_zero_point);
+    const float vx3 = (float) ((int32_t) x[3] - vinput_zero_point);
+    x += 4;
+
+    float vgate0 = vx0 * vgate_scale + 0.5f;
+    float vgate1 = vx1 * vgate_scale + 0.5f;
+    float vgate2 = vx2 * vgate_scale + 0.5f;
+    float vgate3 = vx3 * vgate_scale + 0.5f;
+
+    vgate0 = math_max_f32(vgate0, 0.0f);
+    vgate1 = math_max_f32(vgate1, 0.0f);
+    vgate2 = math_max_f32(vgate2, 0.0f);
+    vgate3 = math_max_f32(vgate3, 0.0f);
+
+    vgate0 = math_min_f32(vgate0, 1.0f);
+    vgate1 = math_min_f32(vgate1, 1.0f);
+    vgate2 = math_min_f32(vgate2, 1.0f);
+    vgate3 = math_min_f32(vgate3, 1.0f);
+
+    float vacc0 = vx0 * vscale;
+    float vacc1 = vx1 * vscale;
+    float vacc2 = vx2 * vscale;
+    float vacc3 = vx3 * vscale;
+
+    vacc0 *= vgate0;
+    vacc1 *= vgate1;
+    vacc2 *= vgate2;
+    vacc3 *= vgate3;
+
+    vacc0 = math_max_f32(vacc0, voutput_min_less_zero_point);
+    vacc1 = math_max_f32(vacc1, voutput_min_less_zero_point);
+    vacc2 = math_max_f32(vacc2, voutput_min_less_zero_point);
+    vacc3 = math_max_f32(vacc3, voutput_min_less_zero_point);
+
+    vacc0 = math_min_f32(vacc0, voutput_max_less_zero_point);
+    vacc1 = math_min_f32(vacc1, voutput_max_less_zero_point);
+    vacc2 = math_min_f32(vacc2, voutput_max_less_zero_point);
+    vacc3 = math_min_f32(vacc3, voutput_max_less_zero_point);
+
+    vacc0 += vmagic_bias;
+    vacc1 += vmagic_bias;
+    vacc2 += vmagic_bias;
+    vacc3 += vmagic_bias;
+
+    const int32_t vy0 = (int32_t) fp32_to_bits(vacc0) - vmagic_bias_less_output_zero_point;
+    const int32_t vy1 = (int32_t) fp32_to_bits(vacc1) - vmagic_bias_less_output_zero_point;
+    const int32_t vy2 = (int32_t) fp32_to_bits(vacc2) - vmagic_bias_less_output_zero_point;
+    const int32_t vy3 = (int32_t) fp32_to_bits(vacc3) - vmagic_bias_less_output_zero_point;
+
+    y[0] = (int8_t) vy0;
+    y[1] = (int8_t) vy1;
+    y[2] = (int8_t) vy2;
+    y[3] = (int8_t) vy3;
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      const float vx = (float) ((int32_t) *x++ - vinput_zero_point);
+      float vgate = vx * vgate_scale + 0.5f;
+      vgate = math_max_f32(vgate, 0.0f);
+      vgate = math_min_f32(vgate, 1.0f);
+      float vacc = vx * vscale;
+      vacc *= vgate;
+      vacc = math_max_f32(vacc, voutput_min_less_zero_point);
+      vacc = math_min_f32(vacc, voutput_max_less_zero_point);
+      vacc += vmagic_bias;
+      const int32_t vy = (int32_t) fp32_to_bits(vacc) - vmagic_bias_less_output_zero_point;
+      *y++ = (int8_t) vy;
+
+      n -= sizeof(int8_t);
+    } while (n != 0);
+  }
+}
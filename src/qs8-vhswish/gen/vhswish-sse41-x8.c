@@ -0,0 +1,97 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vhswish/sse4.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vhswish_ukernel__sse41_x8(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_hswish_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m128i vinput_zero_point = _mm_load_si128((const __m128i*) params->sse4.input_zero_point);
+  const __m128 vgate_scale = _mm_load_ps(params->sse4.gate_scale);
+  const __m128 vhalf = _mm_load_ps(params->sse4.half);
+  const __m128 vone = _mm_load_ps(params->sse4.one);
+  const __m128 vscale = _mm_load_ps(params->sse4.scale);
+  const __m128 voutput_max_less_zero_point = _mm_load_ps(params->sse4.output_max_less_zero_point);
+  const __m128i voutput_zero_point = _mm_load_si128((const __m128i*) params->sse4.output_zero_point);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->sse4.output_min);
+  const __m128 vzero = _mm_setzero_ps();
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    __m128i vxm = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) x));
+    vxm = _mm_sub_epi16(vxm, vinput_zero_point);
+    x += 8;
+
+    const __m128 vx_lo = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(vxm));
+    const __m128 vx_hi = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vxm, vxm)));
+    __m128 vgate_lo = _mm_add_ps(_mm_mul_ps(vx_lo, vgate_scale), vhalf);
+    __m128 vgate_hi = _mm_add_ps(_mm_mul_ps(vx_hi, vgate_scale), vhalf);
+    vgate_lo = _mm_min_ps(_mm_max_ps(vgate_lo, vzero), vone);
+    vgate_hi = _mm_min_ps(_mm_max_ps(vgate_hi, vzero), vone);
+    __m128 vacc_lo = _mm_mul_ps(_mm_mul_ps(vx_lo, vscale), vgate_lo);
+    __m128 vacc_hi = _mm_mul_ps(_mm_mul_ps(vx_hi, vscale), vgate_hi);
+    vacc_lo = _mm_min_ps(vacc_lo, voutput_max_less_zero_point);
+    vacc_hi = _mm_min_ps(vacc_hi, voutput_max_less_zero_point);
+
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vacc_lo), _mm_cvtps_epi32(vacc_hi)), voutput_zero_point);
+    __m128i vy = _mm_packs_epi16(vacc, vacc);
+    vy = _mm_max_epi8(vy, voutput_min);
+
+    _mm_storel_epi64((__m128i*) y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    __m128i vxm = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) x));
+    vxm = _mm_sub_epi16(vxm, vinput_zero_point);
+
+    const __m128 vx_lo = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(vxm));
+    const __m128 vx_hi = _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(vxm, vxm)));
+    __m128 vgate_lo = _mm_add_ps(_mm_mul_ps(vx_lo, vgate_scale), vhalf);
+    __m128 vgate_hi = _mm_add_ps(_mm_mul_ps(vx_hi, vgate_scale), vhalf);
+    vgate_lo = _mm_min_ps(_mm_max_ps(vgate_lo, vzero), vone);
+    vgate_hi = _mm_min_ps(_mm_max_ps(vgate_hi, vzero), vone);
+    __m128 vacc_lo = _mm_mul_ps(_mm_mul_ps(vx_lo, vscale), vgate_lo);
+    __m128 vacc_hi = _mm_mul_ps(_mm_mul_ps(vx_hi, vscale), vgate_hi);
+    vacc_lo = _mm_min_ps(vacc_lo, voutput_max_less_zero_point);
+    vacc_hi = _mm_min_ps(vacc_hi, voutput_max_less_zero_point);
+
+    const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(_mm_cvtps_epi32(vacc_lo), _mm_cvtps_epi32(vacc_hi)), voutput_zero_point);
+    __m128i vy = _mm_packs_epi16(vacc, vacc);
+    vy = _mm_max_epi8(vy, voutput_min);
+
+    if (n & (4 * sizeof(int8_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+      y += 4;
+      vy = _mm_srli_epi64(vy, 32);
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      *((uint16_t*) y) = (uint16_t) _mm_cvtsi128_si32(vy);
+      y += 2;
+      vy = _mm_srli_epi32(vy, 16);
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      *y = (int8_t) _mm_cvtsi128_si32(vy);
+    }
+  }
+}
@@ -0,0 +1,140 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vlrelu/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vlrelu_ukernel__neon_x16(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_lrelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const int16x8_t vinput_zero_point = vld1q_dup_s16(&params->neon.input_zero_point);
+  const int32x4_t vpositive_multiplier = vld1q_dup_s32(&params->neon.positive_multiplier);
+  const int32x4_t vnegative_multiplier = vld1q_dup_s32(&params->neon.negative_multiplier);
+  const int32x4_t vbias = vld1q_dup_s32(&params->neon.bias);
+  const int8x8_t voutput_min = vld1_dup_s8(&params->neon.output_min);
+  const int8x8_t voutput_max = vld1_dup_s8(&params->neon.output_max);
+  for (; n >= 16 * sizeof(int8_t); n -= 16 * sizeof(int8_t)) {
+    const int8x8_t vx01234567 = vld1_s8(x); x += 8;
+    const int8x8_t vx89ABCDEF = vld1_s8(x); x += 8;
+
+    const int16x8_t vxm01234567 = vsubq_s16(vmovl_s8(vx01234567), vinput_zero_point);
+    const int16x8_t vxm89ABCDEF = vsubq_s16(vmovl_s8(vx89ABCDEF), vinput_zero_point);
+
+    int32x4_t vacc0123 = vmovl_s16(vget_low_s16(vxm01234567));
+    int32x4_t vacc4567 = vmovl_s16(vget_high_s16(vxm01234567));
+    int32x4_t vacc89AB = vmovl_s16(vget_low_s16(vxm89ABCDEF));
+    int32x4_t vaccCDEF = vmovl_s16(vget_high_s16(vxm89ABCDEF));
+
+    const int32x4_t vmultiplier0123 = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vacc0123, 31)), vnegative_multiplier, vpositive_multiplier);
+    const int32x4_t vmultiplier4567 = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vacc4567, 31)), vnegative_multiplier, vpositive_multiplier);
+    const int32x4_t vmultiplier89AB = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vacc89AB, 31)), vnegative_multiplier, vpositive_multiplier);
+    const int32x4_t vmultiplierCDEF = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vaccCDEF, 31)), vnegative_multiplier, vpositive_multiplier);
+
+    vacc0123 = vmlaq_s32(vbias, vacc0123, vmultiplier0123);
+    vacc4567 = vmlaq_s32(vbias, vacc4567, vmultiplier4567);
+    vacc89AB = vmlaq_s32(vbias, vacc89AB, vmultiplier89AB);
+    vaccCDEF = vmlaq_s32(vbias, vaccCDEF, vmultiplierCDEF);
+
+    vacc0123 = vshrq_n_s32(vacc0123, 12);
+    vacc4567 = vshrq_n_s32(vacc4567, 12);
+    vacc89AB = vshrq_n_s32(vacc89AB, 12);
+    vaccCDEF = vshrq_n_s32(vaccCDEF, 12);
+
+    #if XNN_ARCH_ARM64
+      const int16x8_t vacc01234567 = vqmovn_high_s32(vqmovn_s32(vacc0123), vacc4567);
+      const int16x8_t vacc89ABCDEF = vqmovn_high_s32(vqmovn_s32(vacc89AB), vaccCDEF);
+    #else  // !XNN_ARCH_ARM64
+      const int16x8_t vacc01234567 = vcombine_s16(vqmovn_s32(vacc0123), vqmovn_s32(vacc4567));
+      const int16x8_t vacc89ABCDEF = vcombine_s16(vqmovn_s32(vacc89AB), vqmovn_s32(vaccCDEF));
+    #endif  // !XNN_ARCH_ARM64
+
+    int8x8_t vy01234567 = vqmovn_s16(vacc01234567);
+    int8x8_t vy89ABCDEF = vqmovn_s16(vacc89ABCDEF);
+
+    vy01234567 = vmax_s8(vy01234567, voutput_min);
+    vy89ABCDEF = vmax_s8(vy89ABCDEF, voutput_min);
+
+    vy01234567 = vmin_s8(vy01234567, voutput_max);
+    vy89ABCDEF = vmin_s8(vy89ABCDEF, voutput_max);
+
+    vst1_s8(y, vy01234567); y += 8;
+    vst1_s8(y, vy89ABCDEF); y += 8;
+  }
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    const int8x8_t vx = vld1_s8(x); x += 8;
+    const int16x8_t vxm = vsubq_s16(vmovl_s8(vx), vinput_zero_point);
+
+    int32x4_t vacc_lo = vmovl_s16(vget_low_s16(vxm));
+    int32x4_t vacc_hi = vmovl_s16(vget_high_s16(vxm));
+    const int32x4_t vmultiplier_lo = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vacc_lo, 31)), vnegative_multiplier, vpositive_multiplier);
+    const int32x4_t vmultiplier_hi = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vacc_hi, 31)), vnegative_multiplier, vpositive_multiplier);
+    vacc_lo = vshrq_n_s32(vmlaq_s32(vbias, vacc_lo, vmultiplier_lo), 12);
+    vacc_hi = vshrq_n_s32(vmlaq_s32(vbias, vacc_hi, vmultiplier_hi), 12);
+
+    #if XNN_ARCH_ARM64
+      const int16x8_t vacc = vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi);
+    #else  // !XNN_ARCH_ARM64
+      const int16x8_t vacc = vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi));
+    #endif  // !XNN_ARCH_ARM64
+
+    int8x8_t vy = vqmovn_s16(vacc);
+    vy = vmax_s8(vy, voutput_min);
+    vy = vmin_s8(vy, voutput_max);
+    vst1_s8(y, vy); y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    const int8x8_t vx = vld1_s8(x);
+    const int16x8_t vxm = vsubq_s16(vmovl_s8(vx), vinput_zero_point);
+
+    int32x4_t vacc_lo = vmovl_s16(vget_low_s16(vxm));
+    int32x4_t vacc_hi = vmovl_s16(vget_high_s16(vxm));
+    const int32x4_t vmultiplier_lo = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vacc_lo, 31)), vnegative_multiplier, vpositive_multiplier);
+    const int32x4_t vmultiplier_hi = vbslq_s32(vreinterpretq_u32_s32(vshrq_n_s32(vacc_hi, 31)), vnegative_multiplier, vpositive_multiplier);
+    vacc_lo = vshrq_n_s32(vmlaq_s32(vbias, vacc_lo, vmultiplier_lo), 12);
+    vacc_hi = vshrq_n_s32(vmlaq_s32(vbias, vacc_hi, vmultiplier_hi), 12);
+
+    #if XNN_ARCH_ARM64
+      const int16x8_t vacc = vqmovn_high_s32(vqmovn_s32(vacc_lo), vacc_hi);
+    #else  // !XNN_ARCH_ARM64
+      const int16x8_t vacc = vcombine_s16(vqmovn_s32(vacc_lo), vqmovn_s32(vacc_hi));
+    #endif  // !XNN_ARCH_ARM64
+
+    int8x8_t vy = vqmovn_s16(vacc);
+    vy = vmax_s8(vy, voutput_min);
+    vy = vmin_s8(vy, voutput_max);
+
+    if (n & (4 * sizeof(int8_t))) {
+      vst1_lane_u32((void*) y, vreinterpret_u32_s8(vy), 0); y += 4;
+      vy = vext_s8(vy, vy, 4);
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      vst1_lane_u16((void*) y, vreinterpret_u16_s8(vy), 0); y += 2;
+      vy = vext_s8(vy, vy, 2);
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      vst1_lane_s8(y, vy, 0);
+    }
+  }
+}
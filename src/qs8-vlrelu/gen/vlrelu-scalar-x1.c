@@ -0,0 +1,44 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vlrelu/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vlrelu_ukernel__scalar_x1(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_lrelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const int32_t vpositive_multiplier = params->scalar.positive_multiplier;
+  const int32_t vnegative_multiplier = params->scalar.negative_multiplier;
+  const int32_t vbias = params->scalar.bias;
+  const int32_t voutput_min = params->scalar.output_min;
+  const int32_t voutput_max = params->scalar.output_max;
+  do {
+    int32_t vacc = (int32_t) *x++;
+    vacc -= vinput_zero_point;
+    const int32_t vmultiplier = XNN_UNPREDICTABLE(vacc >= 0) ? vpositive_multiplier : vnegative_multiplier;
+    vacc = asr_s32(vbias + vacc * vmultiplier, 12);
+    vacc = math_max_s32(vacc, voutput_min);
+    vacc = math_min_s32(vacc, voutput_max);
+    *y++ = (int8_t) vacc;
+
+    n -= sizeof(int8_t);
+  } while (n != 0);
+}
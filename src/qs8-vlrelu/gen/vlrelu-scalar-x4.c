@@ -0,0 +1,84 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vlrelu/scalar.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <xnnpack/math.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vlrelu_ukernel__scalar_x4(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_lrelu_params params[restrict XNN_MIN_ELEMENTS(1)])
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const int32_t vinput_zero_point = params->scalar.input_zero_point;
+  const int32_t vpositive_multiplier = params->scalar.positive_multiplier;
+  const int32_t vnegative_multiplier = params->scalar.negative_multiplier;
+  const int32_t vbias = params->scalar.bias;
+  const int32_t voutput_min = params->scalar.output_min;
+  const int32_t voutput_max = params->scalar.output_max;
+  for (; n >= 4 * sizeof(int8_t); n -= 4 * sizeof(int8_t)) {
+    int32_t vacc0 = (int32_t) x[0];
+    int32_t vacc1 = (int32_t) x[1];
+    int32_t vacc2 = (int32_t) x[2];
+    int32_t vacc3 = (int32_t) x[3];
+    x += 4;
+
+    vacc0 -= vinput_zero_point;
+    vacc1 -= vinput_zero_point;
+    vacc2 -= vinput_zero_point;
+    vacc3 -= vinput_zero_point;
+
+    const int32_t vmultiplier0 = XNN_UNPREDICTABLE(vacc0 >= 0) ? vpositive_multiplier : vnegative_multiplier;
+    const int32_t vmultiplier1 = XNN_UNPREDICTABLE(vacc1 >= 0) ? vpositive_multiplier : vnegative_multiplier;
+    const int32_t vmultiplier2 = XNN_UNPREDICTABLE(vacc2 >= 0) ? vpositive_multiplier : vnegative_multiplier;
+    const int32_t vmultiplier3 = XNN_UNPREDICTABLE(vacc3 >= 0) ? vpositive_multiplier : vnegative_multiplier;
+
+    vacc0 = asr_s32(vbias + vacc0 * vmultiplier0, 12);
+    vacc1 = asr_s32(vbias + vacc1 * vmultiplier1, 12);
+    vacc2 = asr_s32(vbias + vacc2 * vmultiplier2, 12);
+    vacc3 = asr_s32(vbias + vacc3 * vmultiplier3, 12);
+
+    vacc0 = math_max_s32(vacc0, voutput_min);
+    vacc1 = math_max_s32(vacc1, voutput_min);
+    vacc2 = math_max_s32(vacc2, voutput_min);
+    vacc3 = math_max_s32(vacc3, voutput_min);
+
+    vacc0 = math_min_s32(vacc0, voutput_max);
+    vacc1 = math_min_s32(vacc1, voutput_max);
+    vacc2 = math_min_s32(vacc2, voutput_max);
+    vacc3 = math_min_s32(vacc3, voutput_max);
+
+    y[0] = (int8_t) vacc0;
+    y[1] = (int8_t) vacc1;
+    y[2] = (int8_t) vacc2;
+    y[3] = (int8_t) vacc3;
+    y += 4;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    do {
+      int32_t vacc = (int32_t) *x++;
+      vacc -= vinput_zero_point;
+      const int32_t vmultiplier = XNN_UNPREDICTABLE(vacc >= 0) ? vpositive_multiplier : vnegative_multiplier;
+      vacc = asr_s32(vbias + vacc * vmultiplier, 12);
+      vacc = math_max_s32(vacc, voutput_min);
+      vacc = math_min_s32(vacc, voutput_max);
+      *y++ = (int8_t) vacc;
+
+      n -= sizeof(int8_t);
+    } while (n != 0);
+  }
+}
@@ -0,0 +1,88 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-vlrelu/sse4.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <smmintrin.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/vunary.h>
+
+
+void xnn_qs8_vlrelu_ukernel__sse41_x8(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_lrelu_params params[restrict XNN_MIN_ELEMENTS(1)]) XNN_OOB_READS
+{
+  assert(n != 0);
+  assert(n % sizeof(int8_t) == 0);
+  assert(x != NULL);
+  assert(y != NULL);
+
+  const __m128i vinput_zero_point = _mm_load_si128((const __m128i*) params->sse4.input_zero_point);
+  const __m128i vpositive_multiplier = _mm_load_si128((const __m128i*) params->sse4.positive_multiplier);
+  const __m128i vnegative_multiplier = _mm_load_si128((const __m128i*) params->sse4.negative_multiplier);
+  const __m128i vbias = _mm_load_si128((const __m128i*) params->sse4.bias);
+  const __m128i voutput_min = _mm_load_si128((const __m128i*) params->sse4.output_min);
+  const __m128i voutput_max = _mm_load_si128((const __m128i*) params->sse4.output_max);
+  for (; n >= 8 * sizeof(int8_t); n -= 8 * sizeof(int8_t)) {
+    __m128i vx = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) x));
+    vx = _mm_sub_epi16(vx, vinput_zero_point);
+    x += 8;
+
+    __m128i vacc_lo = _mm_cvtepi16_epi32(vx);
+    __m128i vacc_hi = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(vx, vx));
+    const __m128i vmultiplier_lo = _mm_blendv_epi8(vpositive_multiplier, vnegative_multiplier, _mm_srai_epi32(vacc_lo, 31));
+    const __m128i vmultiplier_hi = _mm_blendv_epi8(vpositive_multiplier, vnegative_multiplier, _mm_srai_epi32(vacc_hi, 31));
+    vacc_lo = _mm_srai_epi32(_mm_add_epi32(vbias, _mm_mullo_epi32(vacc_lo, vmultiplier_lo)), 12);
+    vacc_hi = _mm_srai_epi32(_mm_add_epi32(vbias, _mm_mullo_epi32(vacc_hi, vmultiplier_hi)), 12);
+
+    const __m128i vacc = _mm_packs_epi32(vacc_lo, vacc_hi);
+    __m128i vy = _mm_packs_epi16(vacc, vacc);
+    vy = _mm_max_epi8(vy, voutput_min);
+    vy = _mm_min_epi8(vy, voutput_max);
+
+    _mm_storel_epi64((__m128i*) y, vy);
+    y += 8;
+  }
+  if XNN_UNLIKELY(n != 0) {
+    assert(n >= 1 * sizeof(int8_t));
+    assert(n <= 7 * sizeof(int8_t));
+
+    __m128i vx = _mm_cvtepi8_epi16(_mm_loadl_epi64((const __m128i*) x));
+    vx = _mm_sub_epi16(vx, vinput_zero_point);
+
+    __m128i vacc_lo = _mm_cvtepi16_epi32(vx);
+    __m128i vacc_hi = _mm_cvtepi16_epi32(_mm_unpackhi_epi64(vx, vx));
+    const __m128i vmultiplier_lo = _mm_blendv_epi8(vpositive_multiplier, vnegative_multiplier, _mm_srai_epi32(vacc_lo, 31));
+    const __m128i vmultiplier_hi = _mm_blendv_epi8(vpositive_multiplier, vnegative_multiplier, _mm_srai_epi32(vacc_hi, 31));
+    vacc_lo = _mm_srai_epi32(_mm_add_epi32(vbias, _mm_mullo_epi32(vacc_lo, vmultiplier_lo)), 12);
+    vacc_hi = _mm_srai_epi32(_mm_add_epi32(vbias, _mm_mullo_epi32(vacc_hi, vmultiplier_hi)), 12);
+
+    const __m128i vacc = _mm_packs_epi32(vacc_lo, vacc_hi);
+    __m128i vy = _mm_packs_epi16(vacc, vacc);
+    vy = _mm_max_epi8(vy, voutput_min);
+    vy = _mm_min_epi8(vy, voutput_max);
+
+    if (n & (4 * sizeof(int8_t))) {
+      *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+      y += 4;
+      vy = _mm_srli_epi64(vy, 32);
+    }
+    if (n & (2 * sizeof(int8_t))) {
+      *((uint16_t*) y) = (uint16_t) _mm_cvtsi128_si32(vy);
+      y += 2;
+      vy = _mm_srli_epi32(vy, 16);
+    }
+    if (n & (1 * sizeof(int8_t))) {
+      *y = (int8_t) _mm_cvtsi128_si32(vy);
+    }
+  }
+}
@@ -0,0 +1,118 @@
+// Auto-generated file. Do not edit!
+//   Template: src/qs8-softmax/neon.c.in
+//   Generator: tools/xngen
+//
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <xnnpack/lut.h>
+#include <xnnpack/math.h>
+
+
+void xnn_qu8_softmax_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y)
+{
+  assert(n != 0);
+
+  const uint8_t* xmax = x;
+  size_t nmax = n;
+  uint8x16_t vmax16 = vld1q_dup_u8(xmax);
+  for (; nmax >= 16; nmax -= 16) {
+    vmax16 = vmaxq_u8(vmax16, vld1q_u8(xmax));
+    xmax += 16;
+  }
+  #if XNN_ARCH_ARM64
+    int32_t vmax = (int32_t) vmaxvq_u8(vmax16);
+  #else
+    uint8x8_t vmax8 = vmax_u8(vget_low_u8(vmax16), vget_high_u8(vmax16));
+    vmax8 = vpmax_u8(vmax8, vmax8);
+    vmax8 = vpmax_u8(vmax8, vmax8);
+    vmax8 = vpmax_u8(vmax8, vmax8);
+    int32_t vmax = (int32_t) vget_lane_u8(vmax8, 0);
+  #endif
+  for (; nmax != 0; nmax--) {
+    vmax = math_max_s32(vmax, (int32_t) *xmax++);
+  }
+  // The maximum input element maps to the last table entry.
+  const int32_t vadjustment = 255 - vmax;
+
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  const uint8_t* xsum = x;
+  size_t nsum = n;
+  for (; nsum >= 2; nsum -= 2) {
+    vsum0 += t[(int32_t) xsum[0] + vadjustment];
+    vsum1 += t[(int32_t) xsum[1] + vadjustment];
+    xsum += 2;
+  }
+  if (nsum != 0) {
+    vsum0 += t[(int32_t) *xsum + vadjustment];
+  }
+  const uint32_t vsum = vsum0 + vsum1;
+  assert(vsum != 0);
+
+  // Division by the sum is replaced with a multiplication by a magic number and shifts, as in fxdiv:
+  // q = (t + ((n - t) >> shift1)) >> shift2, where t is the high half of n * multiplier.
+  uint32_t vmultiplier = 1;
+  uint32_t vshift1 = 0;
+  uint32_t vshift2 = 0;
+  if (vsum != 1) {
+    const uint32_t l_minus_1 = 31 - math_clz_nonzero_u32(vsum - 1);
+    const uint32_t u_hi = (UINT32_C(2) << l_minus_1) - vsum;
+    vmultiplier = (uint32_t) ((((uint64_t) u_hi) << 32) / vsum) + 1;
+    vshift1 = 1;
+    vshift2 = l_minus_1;
+  }
+
+  const uint32_t vrounding = vsum >> 1;
+  const uint32x4_t vrounding_vec = vdupq_n_u32(vrounding);
+  const uint32x2_t vmultiplier_vec = vdup_n_u32(vmultiplier);
+  const int32x4_t vminus_shift1 = vdupq_n_s32(-(int32_t) vshift1);
+  const int32x4_t vminus_shift2 = vdupq_n_s32(-(int32_t) vshift2);
+  for (; n >= 8; n -= 8) {
+    uint32x4_t vt0123 = vdupq_n_u32(t[(int32_t) x[0] + vadjustment]);
+    uint32x4_t vt4567 = vdupq_n_u32(t[(int32_t) x[4] + vadjustment]);
+    vt0123 = vld1q_lane_u32(t + ((int32_t) x[1] + vadjustment), vt0123, 1);
+    vt4567 = vld1q_lane_u32(t + ((int32_t) x[5] + vadjustment), vt4567, 1);
+    vt0123 = vld1q_lane_u32(t + ((int32_t) x[2] + vadjustment), vt0123, 2);
+    vt4567 = vld1q_lane_u32(t + ((int32_t) x[6] + vadjustment), vt4567, 2);
+    vt0123 = vld1q_lane_u32(t + ((int32_t) x[3] + vadjustment), vt0123, 3);
+    vt4567 = vld1q_lane_u32(t + ((int32_t) x[7] + vadjustment), vt4567, 3);
+    x += 8;
+
+    const uint32x4_t vn0123 = vaddq_u32(vshlq_n_u32(vt0123, 8), vrounding_vec);
+    const uint32x4_t vn4567 = vaddq_u32(vshlq_n_u32(vt4567, 8), vrounding_vec);
+
+    const uint32x4_t vmulhi0123 = vcombine_u32(
+      vshrn_n_u64(vmull_u32(vget_low_u32(vn0123), vmultiplier_vec), 32),
+      vshrn_n_u64(vmull_u32(vget_high_u32(vn0123), vmultiplier_vec), 32));
+    const uint32x4_t vmulhi4567 = vcombine_u32(
+      vshrn_n_u64(vmull_u32(vget_low_u32(vn4567), vmultiplier_vec), 32),
+      vshrn_n_u64(vmull_u32(vget_high_u32(vn4567), vmultiplier_vec), 32));
+
+    const uint32x4_t vq0123 = vshlq_u32(
+      vaddq_u32(vmulhi0123, vshlq_u32(vsubq_u32(vn0123, vmulhi0123), vminus_shift1)), vminus_shift2);
+    const uint32x4_t vq4567 = vshlq_u32(
+      vaddq_u32(vmulhi4567, vshlq_u32(vsubq_u32(vn4567, vmulhi4567), vminus_shift1)), vminus_shift2);
+
+    const uint16x8_t vq01234567 = vcombine_u16(vqmovn_u32(vq0123), vqmovn_u32(vq4567));
+    vst1_u8(y, vqmovn_u16(vq01234567));
+    y += 8;
+  }
+  for (; n != 0; n--) {
+    const uint32_t vn = (t[(int32_t) *x++ + vadjustment] << 8) + vrounding;
+    const uint32_t vmulhi = (uint32_t) (((uint64_t) vn * (uint64_t) vmultiplier) >> 32);
+    const uint32_t vq = (vmulhi + ((vn - vmulhi) >> vshift1)) >> vshift2;
+    const int32_t vout = (int32_t) math_min_u32(vq, 255);
+    *y++ = (uint8_t) vout;
+  }
+}
@@ -102,7 +102,8 @@ enum xnn_status xnn_create_runtime_v3(
     goto error;
   }
 
-  const uint32_t optimization_flags = XNN_FLAG_SPARSE_INFERENCE | XNN_FLAG_HINT_FP16_INFERENCE | XNN_FLAG_FORCE_FP16_INFERENCE;
+  const uint32_t optimization_flags = XNN_FLAG_SPARSE_INFERENCE | XNN_FLAG_HINT_FP16_INFERENCE | XNN_FLAG_FORCE_FP16_INFERENCE |
+    XNN_FLAG_HINT_BF16_INFERENCE | XNN_FLAG_HINT_QS8_INFERENCE;
   status = xnn_subgraph_optimize(subgraph, flags & optimization_flags);
   if (status != xnn_status_success) {
     xnn_log_error("failed to optimize subgraph");
@@ -163,6 +164,8 @@ enum xnn_status xnn_create_runtime_v3(
         goto error;
       }
       runtime->opdata[i].setup = node->setup;
+      runtime->opdata[i].num_inputs = node->num_inputs;
+      runtime->opdata[i].num_outputs = node->num_outputs;
     }
   }
 
@@ -178,6 +181,13 @@ enum xnn_status xnn_create_runtime_v3(
   }
   runtime->num_blobs = subgraph->num_values;
 
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const struct xnn_operator_data* opdata = &runtime->opdata[i];
+    if (opdata->output_is_view) {
+      runtime->blobs[opdata->outputs[0]].view = true;
+    }
+  }
+
   struct xnn_value_allocation_tracker mem_alloc_tracker;
   xnn_init_value_allocation_tracker(&mem_alloc_tracker, subgraph);
 
@@ -187,8 +197,12 @@ enum xnn_status xnn_create_runtime_v3(
     if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
       blob->size = xnn_tensor_get_size(subgraph, i);
       blob->data = (void*) (uintptr_t) value->data;
+      blob->datatype = value->datatype;
       if (blob->data == NULL) {
-        if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
+        if (blob->view) {
+          // Value aliases the memory of another Value, its data pointer is computed in xnn_setup_runtime.
+          continue;
+        } else if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) == 0) {
           // Value is purely internal to the runtime, and must be allocated in its workspace.
           xnn_add_value_allocation_tracker(&mem_alloc_tracker, i, round_up_po2(blob->size, XNN_EXTRA_BYTES));
         } else {
@@ -198,6 +212,13 @@ enum xnn_status xnn_create_runtime_v3(
       }
     }
   }
+  // Views keep the Values they alias alive. Views of views are visited first, so lifetimes propagate along chains.
+  for (size_t i = runtime->num_ops; i != 0; i--) {
+    const struct xnn_operator_data* opdata = &runtime->opdata[i - 1];
+    if (opdata->output_is_view) {
+      xnn_add_view_allocation_tracker(&mem_alloc_tracker, opdata->outputs[0], opdata->inputs[0]);
+    }
+  }
   xnn_plan_value_allocation_tracker(&mem_alloc_tracker);
 
   if (mem_alloc_tracker.mem_arena_size != 0) {
@@ -213,7 +234,7 @@ enum xnn_status xnn_create_runtime_v3(
       const struct xnn_value* value = &subgraph->values[i];
       struct xnn_blob* blob = &runtime->blobs[i];
       if (value->datatype != xnn_datatype_invalid && value->type == xnn_value_type_dense_tensor) {
-        if (value->data == NULL && !blob->external) {
+        if (value->data == NULL && !blob->external && !blob->view) {
           // Value is purely internal to the runtime, allocate it in the workspace.
           blob->data = (void*) ((uintptr_t) runtime->workspace + mem_alloc_tracker.usage[i].alloc_offset);
         }
@@ -225,6 +246,23 @@ enum xnn_status xnn_create_runtime_v3(
     runtime->profiling = true;
   }
 
+  if (flags & XNN_FLAG_COLLECT_VALUE_RANGES) {
+    if (xnn_params.f32.rminmax == NULL) {
+      xnn_log_error("failed to create runtime: collection of value ranges is not supported on this hardware");
+      status = xnn_status_unsupported_hardware;
+      xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+      goto error;
+    }
+    runtime->value_ranges = xnn_allocate_memory(sizeof(struct xnn_value_range) * subgraph->num_values);
+    if (runtime->value_ranges == NULL) {
+      xnn_log_error("failed to allocate %zu bytes for value ranges",
+        sizeof(struct xnn_value_range) * subgraph->num_values);
+      xnn_release_value_allocation_tracker(&mem_alloc_tracker);
+      goto error;
+    }
+    xnn_reset_runtime_value_ranges(runtime);
+  }
+
   xnn_release_value_allocation_tracker(&mem_alloc_tracker);
 
   runtime->threadpool = threadpool;
@@ -268,6 +306,16 @@ enum xnn_status xnn_setup_runtime(
     blob->data = external_value->data;
   }
 
+  // Views are resolved in execution order, after the Values they alias.
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    const struct xnn_operator_data* opdata = &runtime->opdata[i];
+    if (opdata->output_is_view) {
+      const struct xnn_blob* base_blob = &runtime->blobs[opdata->inputs[0]];
+      assert(base_blob->data != NULL);
+      runtime->blobs[opdata->outputs[0]].data = (void*) ((uintptr_t) base_blob->data + opdata->view_offset);
+    }
+  }
+
   for (size_t i = 0; i < runtime->num_ops; i++) {
     const struct xnn_operator_data* opdata = &runtime->opdata[i];
     if (opdata->operator_objects[0] == NULL) {
@@ -432,6 +480,97 @@ enum xnn_status xnn_get_runtime_profiling_info(xnn_runtime_t runtime,
   return status;
 }
 
+enum xnn_status xnn_get_runtime_value_range(
+  xnn_runtime_t runtime,
+  uint32_t value_id,
+  float* min_out,
+  float* max_out)
+{
+  if (runtime->value_ranges == NULL) {
+    xnn_log_error("failed to get value range: runtime was created without XNN_FLAG_COLLECT_VALUE_RANGES");
+    return xnn_status_invalid_state;
+  }
+  if (value_id >= runtime->num_blobs) {
+    xnn_log_error("failed to get value range: out-of-bounds ID %" PRIu32, value_id);
+    return xnn_status_invalid_parameter;
+  }
+  if (runtime->blobs[value_id].datatype != xnn_datatype_fp32) {
+    xnn_log_error("failed to get value range for Value %" PRIu32 ": unsupported datatype %s",
+      value_id, xnn_datatype_to_string(runtime->blobs[value_id].datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+  *min_out = runtime->value_ranges[value_id].min;
+  *max_out = runtime->value_ranges[value_id].max;
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_reset_runtime_value_ranges(
+  xnn_runtime_t runtime)
+{
+  if (runtime->value_ranges == NULL) {
+    xnn_log_error("failed to reset value ranges: runtime was created without XNN_FLAG_COLLECT_VALUE_RANGES");
+    return xnn_status_invalid_state;
+  }
+
+  for (size_t i = 0; i < runtime->num_blobs; i++) {
+    runtime->value_ranges[i].min = INFINITY;
+    runtime->value_ranges[i].max = -INFINITY;
+  }
+  return xnn_status_success;
+}
+
+static void update_value_range(
+  xnn_runtime_t runtime,
+  uint32_t value_id)
+{
+  assert(value_id < runtime->num_blobs);
+  const struct xnn_blob* blob = &runtime->blobs[value_id];
+  if (blob->datatype != xnn_datatype_fp32 || blob->size == 0) {
+    return;
+  }
+
+  float range[2];
+  xnn_params.f32.rminmax(blob->size, (const float*) blob->data, range);
+  struct xnn_value_range* value_range = &runtime->value_ranges[value_id];
+  value_range->min = math_min_f32(value_range->min, range[0]);
+  value_range->max = math_max_f32(value_range->max, range[1]);
+}
+
+static void update_value_ranges(
+  xnn_runtime_t runtime,
+  const struct xnn_operator_data* opdata)
+{
+  // External inputs are not produced by any operator, record their ranges when they are consumed.
+  for (size_t i = 0; i < opdata->num_inputs; i++) {
+    const uint32_t input_id = opdata->inputs[i];
+    if (input_id != XNN_INVALID_VALUE_ID && input_id < runtime->num_blobs && runtime->blobs[input_id].external) {
+      update_value_range(runtime, input_id);
+    }
+  }
+  for (size_t o = 0; o < opdata->num_outputs; o++) {
+    const uint32_t output_id = opdata->outputs[o];
+    if (output_id == XNN_INVALID_VALUE_ID) {
+      // Output was not requested, e.g. an unused output of a Split Node.
+      continue;
+    }
+    update_value_range(runtime, output_id);
+  }
+}
+
+static void update_view_value_range(
+  xnn_runtime_t runtime,
+  const struct xnn_operator_data* opdata)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  const uint32_t output_id = opdata->outputs[0];
+  if (runtime->blobs[input_id].external) {
+    update_value_range(runtime, input_id);
+  }
+  // A view shares memory, and therefore quantization parameters, with the Value it aliases.
+  runtime->value_ranges[output_id] = runtime->value_ranges[input_id];
+}
+
 enum xnn_status xnn_invoke_runtime(
   xnn_runtime_t runtime)
 {
@@ -453,6 +592,42 @@ enum xnn_status xnn_invoke_runtime(
         runtime->opdata[i].end_ts[j] = xnn_read_timer();
       }
     }
+    if (runtime->value_ranges != NULL) {
+      if (runtime->opdata[i].output_is_view) {
+        update_view_value_range(runtime, &runtime->opdata[i]);
+      } else if (runtime->opdata[i].operator_objects[0] != NULL) {
+        update_value_ranges(runtime, &runtime->opdata[i]);
+      }
+    }
+  }
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_reset_runtime_state(
+  xnn_runtime_t runtime)
+{
+  for (size_t i = 0; i < runtime->num_ops; i++) {
+    for (size_t j = 0; j < XNN_MAX_OPERATOR_OBJECTS; j++) {
+      const xnn_operator_t op = runtime->opdata[i].operator_objects[j];
+      if (op == NULL) {
+        continue;
+      }
+
+      switch (op->type) {
+        case xnn_operator_type_streaming_convolution_nwc_f16:
+        case xnn_operator_type_streaming_convolution_nwc_f32:
+        case xnn_operator_type_streaming_convolution_nwc_qs8:
+        {
+          const enum xnn_status status = xnn_reset_streaming_convolution1d_nwc(op);
+          if (status != xnn_status_success) {
+            return status;
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
   }
   return xnn_status_success;
 }
@@ -472,6 +647,7 @@ enum xnn_status xnn_delete_runtime(
       xnn_release_memory(runtime->blobs);
       xnn_release_simd_memory(runtime->workspace);
     }
+    xnn_release_memory(runtime->value_ranges);
 #if XNN_PLATFORM_JIT
     xnn_release_code_cache(&runtime->code_cache);
 #endif
@@ -441,17 +441,24 @@ uint32_t xnn_check_nchw_compatibility(xnn_subgraph_t subgraph, struct xnn_node*
                      xnn_node_type_to_string(node->type));
         return 0;
       }
+    case xnn_node_type_static_resize_nearest_neighbor_2d:
+      return XNN_LAYOUT_FLAG_COMPATIBLE_NCHW;
     case xnn_node_type_abs:
     case xnn_node_type_bankers_rounding:
     case xnn_node_type_ceiling:
     case xnn_node_type_clamp:
     case xnn_node_type_elu:
+    case xnn_node_type_exp:
     case xnn_node_type_floor:
+    case xnn_node_type_gelu:
     case xnn_node_type_hardswish:
     case xnn_node_type_leaky_relu:
+    case xnn_node_type_log:
     case xnn_node_type_negate:
     case xnn_node_type_sigmoid:
+    case xnn_node_type_silu:
     case xnn_node_type_square:
+    case xnn_node_type_tanh:
       assert(node->num_inputs == 1);
       assert(node->num_outputs == 1);
       if (subgraph->values[node->inputs[0]].shape.num_dims == 4) {
@@ -688,6 +695,24 @@ void xnn_subgraph_rewrite_for_nchw(xnn_subgraph_t subgraph)
   }
 }
 
+static bool xnn_f16_vunary_available(enum xnn_node_type node_type)
+{
+  switch (node_type) {
+    case xnn_node_type_exp:
+      return xnn_params.f16.exp.ukernel != NULL;
+    case xnn_node_type_gelu:
+      return xnn_params.f16.gelu.ukernel != NULL;
+    case xnn_node_type_log:
+      return xnn_params.f16.log.ukernel != NULL;
+    case xnn_node_type_silu:
+      return xnn_params.f16.silu.ukernel != NULL;
+    case xnn_node_type_tanh:
+      return xnn_params.f16.tanh.ukernel != NULL;
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
 bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
 {
   xnn_log_info("Analyzing subgraph for FP16 compatibility");
@@ -732,6 +757,7 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_concatenate2:
       case xnn_node_type_concatenate3:
       case xnn_node_type_concatenate4:
+      case xnn_node_type_scaled_dot_product_attention:
         for (uint32_t i = 0; i < node->num_inputs; i++) {
           if (subgraph->values[node->inputs[i]].data != NULL) {
             xnn_log_warning("FP16 rewrite aborted: node #%" PRIu32 " (%s) has static input %i",
@@ -740,8 +766,10 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
           }
         }
         break;
+      case xnn_node_type_argmax:
       case xnn_node_type_clamp:
       case xnn_node_type_convolution_2d:
+      case xnn_node_type_convolution_3d:
       case xnn_node_type_deconvolution_2d:
       case xnn_node_type_depthwise_convolution_2d:
       case xnn_node_type_depth_to_space:
@@ -750,14 +778,32 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
       case xnn_node_type_even_split4:
       case xnn_node_type_global_average_pooling_2d:
       case xnn_node_type_hardswish:
+      case xnn_node_type_layer_normalization:
       case xnn_node_type_leaky_relu:
       case xnn_node_type_max_pooling_2d:
+      case xnn_node_type_max_pooling_3d:
       case xnn_node_type_prelu:
       case xnn_node_type_sigmoid:
       case xnn_node_type_softmax:
       case xnn_node_type_static_constant_pad:
+      case xnn_node_type_static_reduce:
       case xnn_node_type_static_reshape:
       case xnn_node_type_static_resize_bilinear_2d:
+      case xnn_node_type_static_resize_nearest_neighbor_2d:
+      case xnn_node_type_static_slice:
+      case xnn_node_type_streaming_convolution_1d:
+        break;
+      // FP16 micro-kernels for these operators are not available on every architecture.
+      case xnn_node_type_exp:
+      case xnn_node_type_gelu:
+      case xnn_node_type_log:
+      case xnn_node_type_silu:
+      case xnn_node_type_tanh:
+        if (!xnn_f16_vunary_available(node->type)) {
+          xnn_log_warning("FP16 rewrite aborted: node #%" PRIu32 " (%s) has no FP16 micro-kernel on this architecture",
+            n, xnn_node_type_to_string(node->type));
+          return false;
+        }
         break;
       default:
         xnn_log_warning("FP16 rewrite aborted: node #%" PRIu32 " (%s) is not supported for FP16 inference",
@@ -767,18 +813,25 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
   }
 
   // Annotate Values to be converted to FP16 as FP16-compatible.
-  // Note that static weights in [Depthwise] Convolution, Fully Connected, and PReLU Nodes remain FP32,
-  // they will be converted to FP16 during weight repacking when the operator is created.
+  // Note that static weights in [Depthwise] Convolution, Fully Connected, Layer Normalization, and PReLU Nodes remain
+  // FP32, they will be converted to FP16 during weight repacking when the operator is created.
   for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
     struct xnn_node* node = &subgraph->nodes[n];
     switch (node->type) {
       case xnn_node_type_convolution_2d:
+      case xnn_node_type_convolution_3d:
       case xnn_node_type_deconvolution_2d:
       case xnn_node_type_depthwise_convolution_2d:
+      case xnn_node_type_layer_normalization:
       case xnn_node_type_prelu:
+      case xnn_node_type_streaming_convolution_1d:
         subgraph->values[node->inputs[0]].fp16_compatible = true;
         subgraph->values[node->outputs[0]].fp16_compatible = true;
         break;
+      case xnn_node_type_argmax:
+        // Indices in the output remain INT32.
+        subgraph->values[node->inputs[0]].fp16_compatible = true;
+        break;
       default:
         for (uint32_t i = 0; i < node->num_inputs; i++) {
           subgraph->values[node->inputs[i]].fp16_compatible = true;
@@ -932,6 +985,648 @@ bool xnn_subgraph_rewrite_for_fp16(xnn_subgraph_t subgraph)
   return true;
 }
 
+// Checks if a Value which is an input or output of BF16 Nodes is also needed in FP32: by FP32 Nodes, as a static
+// weight, or as an external input or output of the Subgraph.
+static bool is_bf16_value_used_in_fp32(xnn_subgraph_t subgraph, const struct xnn_value* value)
+{
+  if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) != 0) {
+    return true;
+  }
+  if (value->producer == XNN_INVALID_NODE_ID ||
+      subgraph->nodes[value->producer].compute_type != xnn_compute_type_bf16)
+  {
+    return true;
+  }
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    if (node->type == xnn_node_type_invalid) {
+      continue;
+    }
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      if (node->inputs[i] == value->id && (node->compute_type != xnn_compute_type_bf16 || i != 0)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool xnn_subgraph_rewrite_for_bf16(xnn_subgraph_t subgraph)
+{
+  xnn_log_info("Analyzing subgraph for BF16 compatibility");
+
+  // Run Fully Connected Nodes on BF16 activations, keeping FP32 accumulation inside the operators, and keep the other
+  // Nodes in FP32:
+  // 1. Check that all operators in the subgraph are FP32, and switch Fully Connected Nodes to BF16.
+  // 2. Indicate values that must be converted to BF16.
+  // 3. Replace FP32 Values with BF16 Values as BF16 Nodes' inputs/outputs.
+  // 4. Insert FP32->BF16 Convert Nodes before BF16 Nodes which consume FP32 Values, and BF16->FP32 Convert Nodes after
+  //    BF16 Nodes whose outputs are consumed in FP32.
+
+  // Check that all operators in the subgraph are FP32, bail out on any other one.
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->type == xnn_node_type_invalid) {
+      // Node was fused away, skip.
+      continue;
+    }
+
+    if (node->compute_type != xnn_compute_type_fp32) {
+      xnn_log_warning("BF16 rewrite aborted: node #%" PRIu32 " (%s) is not FP32", n, xnn_node_type_to_string(node->type));
+      return false;
+    }
+  }
+
+  // Switch Fully Connected Nodes with dynamic inputs to BF16, other Nodes stay in FP32.
+  uint32_t num_bf16_nodes = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->type == xnn_node_type_fully_connected && subgraph->values[node->inputs[0]].data == NULL) {
+      node->compute_type = xnn_compute_type_bf16;
+      num_bf16_nodes += 1;
+    }
+  }
+  if (num_bf16_nodes == 0) {
+    xnn_log_warning("BF16 rewrite aborted: subgraph has no nodes supported for BF16 inference");
+    return false;
+  }
+
+  // Annotate Values to be converted to BF16 as BF16-compatible.
+  // Note that static weights in Fully Connected Nodes remain FP32,
+  // they will be converted to BF16 during weight repacking when the operator is created.
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->compute_type != xnn_compute_type_bf16) {
+      continue;
+    }
+
+    subgraph->values[node->inputs[0]].bf16_compatible = true;
+    subgraph->values[node->outputs[0]].bf16_compatible = true;
+  }
+
+  // Replace FP32 Values in BF16 Nodes' inputs/outputs with BF16 Values.
+  // FP32 Values that are only produced and consumed by BF16 Nodes are converted to BF16 in-place,
+  // for the other Values we create same-shaped BF16 Values and use those in BF16 Nodes instead.
+  const uint32_t num_original_values = subgraph->num_values;
+  xnn_subgraph_analyze_consumers_and_producers(subgraph);
+  for (uint32_t n = 0; n < num_original_values; n++) {
+    struct xnn_value* value = &subgraph->values[n];
+    value->bf16_id = XNN_INVALID_VALUE_ID;
+    value->fp32_id = XNN_INVALID_VALUE_ID;
+    if (value->bf16_compatible) {
+      assert(value->data == NULL);
+      assert(value->datatype == xnn_datatype_fp32);
+      if (is_bf16_value_used_in_fp32(subgraph, value)) {
+        struct xnn_value* bf16_value = xnn_subgraph_new_internal_value(subgraph);
+
+        // Recompute value due to potential reallocation in xnn_subgraph_new_internal_value
+        value = &subgraph->values[n];
+        xnn_value_copy(bf16_value, value);
+        bf16_value->datatype = xnn_datatype_bf16;
+
+        // The BF16 Value is produced either by a BF16 Node, followed by a BF16->FP32 Convert Node, or by an
+        // FP32->BF16 Convert Node inserted before its first BF16 consumer.
+        bf16_value->num_consumers = 0;
+        bf16_value->first_consumer = XNN_INVALID_NODE_ID;
+        for (uint32_t c = value->first_consumer; c < subgraph->num_nodes; c++) {
+          const struct xnn_node* consumer = &subgraph->nodes[c];
+          if (consumer->compute_type == xnn_compute_type_bf16 && consumer->inputs[0] == n) {
+            if (bf16_value->first_consumer == XNN_INVALID_NODE_ID) {
+              bf16_value->first_consumer = c;
+            }
+            bf16_value->num_consumers += 1;
+          }
+        }
+        if (value->producer != XNN_INVALID_NODE_ID &&
+            subgraph->nodes[value->producer].compute_type == xnn_compute_type_bf16)
+        {
+          value->producer = XNN_INVALID_NODE_ID;
+        } else {
+          bf16_value->producer = XNN_INVALID_NODE_ID;
+        }
+
+        // Clear external input/output flags
+        bf16_value->flags = 0;
+        xnn_log_debug("BF16 rewrite: created BF16 tensor #%" PRIu32 " for FP32 tensor #%" PRIu32, bf16_value->id, n);
+
+        value->bf16_id = bf16_value->id;
+        bf16_value->fp32_id = n;
+      } else {
+        xnn_log_debug("BF16 rewrite: converted FP32 tensor #%" PRIu32 " to BF16", n);
+        value->datatype = xnn_datatype_bf16;
+      }
+    }
+  }
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->compute_type != xnn_compute_type_bf16) {
+      continue;
+    }
+
+    const uint32_t input_bf16_id = subgraph->values[node->inputs[0]].bf16_id;
+    if (input_bf16_id != XNN_INVALID_VALUE_ID) {
+      assert(subgraph->values[input_bf16_id].fp32_id == node->inputs[0]);
+      node->inputs[0] = input_bf16_id;
+    }
+    const uint32_t output_bf16_id = subgraph->values[node->outputs[0]].bf16_id;
+    if (output_bf16_id != XNN_INVALID_VALUE_ID) {
+      assert(subgraph->values[output_bf16_id].fp32_id == node->outputs[0]);
+      node->outputs[0] = output_bf16_id;
+    }
+  }
+
+  // Count the number of FP32 inputs and outputs of BF16 Nodes which require Convert nodes
+  uint32_t num_fp32_inputs = 0;
+  uint32_t num_fp32_outputs = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    if (node->compute_type != xnn_compute_type_bf16) {
+      continue;
+    }
+    const struct xnn_value* input_value = &subgraph->values[node->inputs[0]];
+    if (input_value->fp32_id != XNN_INVALID_VALUE_ID && input_value->producer == XNN_INVALID_NODE_ID &&
+        input_value->first_consumer == n)
+    {
+      assert(input_value->datatype == xnn_datatype_bf16);
+      num_fp32_inputs += 1;
+    }
+    const struct xnn_value* output_value = &subgraph->values[node->outputs[0]];
+    if (output_value->fp32_id != XNN_INVALID_VALUE_ID) {
+      assert(output_value->datatype == xnn_datatype_bf16);
+      num_fp32_outputs += 1;
+    }
+  }
+  xnn_log_debug("Discovered %"PRIu32" FP32 inputs and %"PRIu32" FP32 outputs of BF16 nodes",
+    num_fp32_inputs, num_fp32_outputs);
+
+  const uint32_t num_original_nodes = subgraph->num_nodes;
+  xnn_subgraph_add_nodes(subgraph, num_fp32_inputs + num_fp32_outputs);
+  struct xnn_node* output_node = subgraph->nodes + subgraph->num_nodes - 1;
+  for (uint32_t n = num_original_nodes; n != 0; n--) {
+    const struct xnn_node* node = &subgraph->nodes[n - 1];
+    const bool is_bf16_node = node->compute_type == xnn_compute_type_bf16;
+    // Insert Convert nodes for outputs
+    if (is_bf16_node) {
+      const struct xnn_value* value = &subgraph->values[node->outputs[0]];
+      if (value->fp32_id != XNN_INVALID_VALUE_ID) {
+        xnn_log_debug("Inserted BF16->FP32 Convert Node from tensor #%"PRIu32" to tensor #%"PRIu32,
+          value->id, value->fp32_id);
+        const uint32_t output_node_id = output_node->id;
+        assert(output_node >= subgraph->nodes);
+        xnn_node_clear(output_node);
+        output_node->id = output_node_id;
+        xnn_init_convert_node(output_node, xnn_compute_type_bf16_to_fp32, value->id, value->fp32_id, 0 /* flags */);
+        output_node -= 1;
+      }
+    }
+    // Move the Node to the new location
+    if (output_node != node) {
+      const uint32_t output_node_id = output_node->id;
+      assert(output_node >= subgraph->nodes);
+      memcpy(output_node, node, sizeof(struct xnn_node));
+      output_node->id = output_node_id;
+      output_node -= 1;
+    }
+    // Insert Convert nodes for inputs
+    if (is_bf16_node) {
+      const struct xnn_value* value = &subgraph->values[node->inputs[0]];
+      if (value->fp32_id != XNN_INVALID_VALUE_ID && value->producer == XNN_INVALID_NODE_ID &&
+          value->first_consumer == n - 1)
+      {
+        xnn_log_debug("Inserted FP32->BF16 Convert Node from tensor #%"PRIu32" to tensor #%"PRIu32,
+          value->fp32_id, value->id);
+        const uint32_t output_node_id = output_node->id;
+        assert(output_node >= subgraph->nodes);
+        xnn_node_clear(output_node);
+        output_node->id = output_node_id;
+        xnn_init_convert_node(output_node, xnn_compute_type_fp32_to_bf16, value->fp32_id, value->id, 0 /* flags */);
+        output_node -= 1;
+      }
+    }
+  }
+
+  return true;
+}
+
+enum xnn_status xnn_quantize_qc8_weights(
+  size_t channels,
+  size_t channel_size,
+  size_t channel_stride,
+  size_t element_stride,
+  const float* filter,
+  const float* bias,
+  float input_scale,
+  struct xnn_qc8_weights* weights)
+{
+  assert(filter != NULL);
+  assert(weights != NULL);
+
+  weights->filter = NULL;
+  weights->filter_scale = NULL;
+  weights->bias = NULL;
+
+  const size_t filter_size = (channels - 1) * channel_stride + (channel_size - 1) * element_stride + 1;
+  weights->filter = xnn_allocate_memory(filter_size * sizeof(int8_t));
+  weights->filter_scale = xnn_allocate_memory(channels * sizeof(float));
+  if (bias != NULL) {
+    weights->bias = xnn_allocate_memory(channels * sizeof(int32_t));
+  }
+  if (weights->filter == NULL || weights->filter_scale == NULL || (bias != NULL && weights->bias == NULL)) {
+    xnn_log_error("failed to allocate %zu bytes for quantized weights",
+      filter_size * sizeof(int8_t) + channels * (sizeof(float) + sizeof(int32_t)));
+    xnn_release_qc8_weights(weights);
+    return xnn_status_out_of_memory;
+  }
+  memset(weights->filter, 0, filter_size * sizeof(int8_t));
+
+  for (size_t c = 0; c < channels; c++) {
+    float filter_absmax = 0.0f;
+    for (size_t k = 0; k < channel_size; k++) {
+      filter_absmax = math_max_f32(filter_absmax, fabsf(filter[c * channel_stride + k * element_stride]));
+    }
+    const float filter_scale = filter_absmax != 0.0f ? filter_absmax / 127.0f : 1.0f;
+    const float filter_inv_scale = 1.0f / filter_scale;
+    for (size_t k = 0; k < channel_size; k++) {
+      const size_t index = c * channel_stride + k * element_stride;
+      const float q = math_min_f32(math_max_f32(filter[index] * filter_inv_scale, -127.0f), 127.0f);
+      weights->filter[index] = (int8_t) lrintf(q);
+    }
+    weights->filter_scale[c] = filter_scale;
+    if (bias != NULL) {
+      const double q = (double) bias[c] / ((double) input_scale * (double) filter_scale);
+      weights->bias[c] = (int32_t) lrint(fmin(fmax(q, (double) INT32_MIN), (double) INT32_MAX));
+    }
+  }
+  return xnn_status_success;
+}
+
+void xnn_release_qc8_weights(struct xnn_qc8_weights* weights)
+{
+  xnn_release_memory(weights->filter);
+  xnn_release_memory(weights->filter_scale);
+  xnn_release_memory(weights->bias);
+  weights->filter = NULL;
+  weights->filter_scale = NULL;
+  weights->bias = NULL;
+}
+
+// Nodes which compute QS8 outputs with the same quantization parameters as their input.
+static bool is_qs8_pass_through_node(const struct xnn_node* node)
+{
+  switch (node->type) {
+    case xnn_node_type_clamp:
+    case xnn_node_type_max_pooling_2d:
+    case xnn_node_type_max_pooling_3d:
+    case xnn_node_type_static_reshape:
+    case xnn_node_type_static_slice:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Nodes which compute QS8 outputs with fixed quantization parameters, regardless of the output range.
+static bool has_fixed_qs8_output_quantization(const struct xnn_node* node)
+{
+  switch (node->type) {
+    case xnn_node_type_sigmoid:
+    case xnn_node_type_softmax:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Number of leading Node inputs which are activations quantized to QS8; the remaining inputs are static weights.
+static uint32_t num_qs8_activation_inputs(const struct xnn_node* node)
+{
+  switch (node->type) {
+    case xnn_node_type_add2:
+    case xnn_node_type_concatenate2:
+    case xnn_node_type_concatenate3:
+    case xnn_node_type_concatenate4:
+    case xnn_node_type_divide:
+    case xnn_node_type_maximum2:
+    case xnn_node_type_minimum2:
+    case xnn_node_type_multiply2:
+    case xnn_node_type_squared_difference:
+      return node->num_inputs;
+    default:
+      return 1;
+  }
+}
+
+static void set_qs8_quantization_from_range(struct xnn_value* value)
+{
+  assert(value->has_range);
+  // The quantized range must include zero for zero padding to be exact.
+  const float range_min = math_min_f32(value->range_min, 0.0f);
+  const float range_max = math_max_f32(value->range_max, 0.0f);
+  float scale = (range_max - range_min) / 255.0f;
+  if (scale == 0.0f || !isnormal(scale)) {
+    scale = 1.0f;
+  }
+  const long zero_point = lrintf(-128.0f - range_min / scale);
+  value->quantization.scale = scale;
+  value->quantization.zero_point = (int32_t) math_min_s32(math_max_s32((int32_t) zero_point, INT8_MIN), INT8_MAX);
+}
+
+bool xnn_subgraph_rewrite_for_qs8(xnn_subgraph_t subgraph)
+{
+  xnn_log_info("Analyzing subgraph for QS8 compatibility");
+
+  // Quantize tensors and operators in the subgraph to QS8 using the value ranges provided by the user:
+  // 1. Check that all operators in the subgraph are supported in QS8, and all quantized values have known ranges.
+  // 2. Derive quantization parameters of values from their ranges and indicate values that must be converted to QS8.
+  // 3. Replace FP32 Values with QS8 Values as Nodes' inputs/outputs.
+  // 4. Insert FP32->QS8 Convert Nodes for external FP32 inputs and QS8->FP32 Convert Nodes for external outputs.
+  // FP32 static weights of Convolution and Fully Connected Nodes are quantized per output channel when the operator is
+  // created.
+
+  xnn_subgraph_analyze_consumers_and_producers(subgraph);
+
+  // Check that all operators in the subgraph are supported in QS8, bail out on any unsupported one.
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->type == xnn_node_type_invalid) {
+      // Node was fused away, skip.
+      continue;
+    }
+
+    if (node->compute_type != xnn_compute_type_fp32) {
+      xnn_log_warning("QS8 rewrite aborted: node #%" PRIu32 " (%s) is not FP32", n, xnn_node_type_to_string(node->type));
+      return false;
+    }
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      if (subgraph->values[node->inputs[i]].layout == xnn_layout_type_nchw) {
+        xnn_log_warning(
+          "QS8 rewrite aborted: input #%" PRIu32 " (Value #%" PRIu32 ") of node #%" PRIu32 " (%s) has NCHW layout",
+          i, node->inputs[i], n, xnn_node_type_to_string(node->type));
+        return false;
+      }
+    }
+    for (uint32_t o = 0; o < node->num_outputs; o++) {
+      if (subgraph->values[node->outputs[o]].layout == xnn_layout_type_nchw) {
+        xnn_log_warning(
+          "QS8 rewrite aborted: output #%" PRIu32 " (Value #%" PRIu32 ") of node #%" PRIu32 " (%s) has NCHW layout",
+          o, node->outputs[o], n, xnn_node_type_to_string(node->type));
+        return false;
+      }
+    }
+    switch (node->type) {
+      case xnn_node_type_convolution_2d:
+      case xnn_node_type_depthwise_convolution_2d:
+      case xnn_node_type_fully_connected:
+        if (subgraph->values[node->inputs[0]].data != NULL) {
+          xnn_log_warning("QS8 rewrite aborted: node #%" PRIu32 " (%s) has static input",
+            n, xnn_node_type_to_string(node->type));
+          return false;
+        }
+        for (uint32_t i = 1; i < node->num_inputs; i++) {
+          if (subgraph->values[node->inputs[i]].data == NULL) {
+            xnn_log_warning("QS8 rewrite aborted: node #%" PRIu32 " (%s) has non-static weights",
+              n, xnn_node_type_to_string(node->type));
+            return false;
+          }
+        }
+        break;
+      case xnn_node_type_add2:
+      case xnn_node_type_concatenate2:
+      case xnn_node_type_concatenate3:
+      case xnn_node_type_concatenate4:
+      case xnn_node_type_divide:
+      case xnn_node_type_maximum2:
+      case xnn_node_type_minimum2:
+      case xnn_node_type_multiply2:
+      case xnn_node_type_squared_difference:
+        for (uint32_t i = 0; i < node->num_inputs; i++) {
+          if (subgraph->values[node->inputs[i]].data != NULL) {
+            xnn_log_warning("QS8 rewrite aborted: node #%" PRIu32 " (%s) has static input %i",
+              n, xnn_node_type_to_string(node->type), i);
+            return false;
+          }
+        }
+        break;
+      case xnn_node_type_average_pooling_2d:
+      case xnn_node_type_clamp:
+      case xnn_node_type_global_average_pooling_2d:
+      case xnn_node_type_hardswish:
+      case xnn_node_type_leaky_relu:
+      case xnn_node_type_max_pooling_2d:
+      case xnn_node_type_max_pooling_3d:
+      case xnn_node_type_sigmoid:
+      case xnn_node_type_softmax:
+      case xnn_node_type_static_reshape:
+      case xnn_node_type_static_slice:
+        if (subgraph->values[node->inputs[0]].data != NULL) {
+          xnn_log_warning("QS8 rewrite aborted: node #%" PRIu32 " (%s) has static input",
+            n, xnn_node_type_to_string(node->type));
+          return false;
+        }
+        break;
+      default:
+        xnn_log_warning("QS8 rewrite aborted: node #%" PRIu32 " (%s) is not supported for QS8 inference",
+          n, xnn_node_type_to_string(node->type));
+        return false;
+    }
+
+    // Quantization parameters of the inputs are derived either from their ranges, or from the producer Node.
+    // Quantization parameters of the outputs of pass-through Nodes are inherited from the input.
+    const uint32_t num_activation_inputs = num_qs8_activation_inputs(node);
+    for (uint32_t i = 0; i < num_activation_inputs; i++) {
+      const struct xnn_value* value = &subgraph->values[node->inputs[i]];
+      if (value->producer == XNN_INVALID_NODE_ID && !value->has_range) {
+        xnn_log_warning("QS8 rewrite aborted: input #%" PRIu32 " (Value #%" PRIu32 ") of node #%" PRIu32 " (%s) "
+          "has no range", i, node->inputs[i], n, xnn_node_type_to_string(node->type));
+        return false;
+      }
+    }
+    if (!is_qs8_pass_through_node(node) && !has_fixed_qs8_output_quantization(node)) {
+      for (uint32_t o = 0; o < node->num_outputs; o++) {
+        if (!subgraph->values[node->outputs[o]].has_range) {
+          xnn_log_warning("QS8 rewrite aborted: output #%" PRIu32 " (Value #%" PRIu32 ") of node #%" PRIu32 " (%s) "
+            "has no range", o, node->outputs[o], n, xnn_node_type_to_string(node->type));
+          return false;
+        }
+      }
+    }
+  }
+
+  // Derive quantization parameters and annotate Values to be converted to QS8 as QS8-compatible.
+  // Note that static weights remain FP32, they will be quantized when the operator is created.
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->type == xnn_node_type_invalid) {
+      continue;
+    }
+
+    const uint32_t num_activation_inputs = num_qs8_activation_inputs(node);
+    for (uint32_t i = 0; i < num_activation_inputs; i++) {
+      struct xnn_value* value = &subgraph->values[node->inputs[i]];
+      if (!value->qs8_compatible) {
+        set_qs8_quantization_from_range(value);
+        value->qs8_compatible = true;
+      }
+    }
+    for (uint32_t o = 0; o < node->num_outputs; o++) {
+      struct xnn_value* value = &subgraph->values[node->outputs[o]];
+      if (is_qs8_pass_through_node(node)) {
+        value->quantization.scale = subgraph->values[node->inputs[0]].quantization.scale;
+        value->quantization.zero_point = subgraph->values[node->inputs[0]].quantization.zero_point;
+      } else if (has_fixed_qs8_output_quantization(node)) {
+        // Sigmoid and Softmax outputs are in [0, 1] and quantized with 1/256 scale.
+        value->quantization.scale = 0x1.0p-8f;
+        value->quantization.zero_point = -128;
+      } else {
+        set_qs8_quantization_from_range(value);
+      }
+      value->qs8_compatible = true;
+    }
+  }
+
+  // Replace FP32 Values in Nodes' inputs/outputs with QS8 Values.
+  // FP32 Values that are not external inputs or outputs are converted to QS8 in-place,
+  // for external inputs and outputs we create same-shaped QS8 Values and use those instead.
+  const uint32_t num_original_values = subgraph->num_values;
+  for (uint32_t n = 0; n < num_original_values; n++) {
+    struct xnn_value* value = &subgraph->values[n];
+    value->qs8_id = XNN_INVALID_VALUE_ID;
+    value->fp32_id = XNN_INVALID_VALUE_ID;
+    if (value->qs8_compatible) {
+      assert(value->data == NULL);
+      assert(value->datatype == xnn_datatype_fp32);
+      if ((value->flags & (XNN_VALUE_FLAG_EXTERNAL_INPUT | XNN_VALUE_FLAG_EXTERNAL_OUTPUT)) != 0) {
+        struct xnn_value* qs8_value = xnn_subgraph_new_internal_value(subgraph);
+
+        // Recompute value due to potential reallocation in xnn_subgraph_new_internal_value
+        value = &subgraph->values[n];
+        xnn_value_copy(qs8_value, value);
+        qs8_value->datatype = xnn_datatype_qint8;
+
+        qs8_value->producer = value->producer;
+        qs8_value->num_consumers = value->num_consumers;
+        qs8_value->first_consumer = value->first_consumer;
+        value->producer = XNN_INVALID_NODE_ID;
+        value->num_consumers = 0;
+        value->first_consumer = XNN_INVALID_NODE_ID;
+
+        // Clear external input/output flags
+        qs8_value->flags = 0;
+        xnn_log_debug("QS8 rewrite: created QS8 tensor #%" PRIu32 " for FP32 tensor #%" PRIu32, qs8_value->id, n);
+
+        value->qs8_id = qs8_value->id;
+        qs8_value->fp32_id = n;
+      } else {
+        xnn_log_debug("QS8 rewrite: converted FP32 tensor #%" PRIu32 " to QS8", n);
+        value->datatype = xnn_datatype_qint8;
+      }
+    }
+  }
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    struct xnn_node* node = &subgraph->nodes[n];
+    if (node->type == xnn_node_type_invalid) {
+      // Node was fused away, skip.
+      continue;
+    }
+
+    assert(node->compute_type == xnn_compute_type_fp32);
+    switch (node->type) {
+      case xnn_node_type_convolution_2d:
+      case xnn_node_type_depthwise_convolution_2d:
+      case xnn_node_type_fully_connected:
+        node->compute_type = xnn_compute_type_qc8;
+        break;
+      default:
+        node->compute_type = xnn_compute_type_qs8;
+        break;
+    }
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      const uint32_t qs8_id = subgraph->values[node->inputs[i]].qs8_id;
+      if (qs8_id != XNN_INVALID_VALUE_ID) {
+        assert(subgraph->values[qs8_id].fp32_id == node->inputs[i]);
+        node->inputs[i] = qs8_id;
+      }
+    }
+    for (uint32_t o = 0; o < node->num_outputs; o++) {
+      const uint32_t qs8_id = subgraph->values[node->outputs[o]].qs8_id;
+      if (qs8_id != XNN_INVALID_VALUE_ID) {
+        assert(subgraph->values[qs8_id].fp32_id == node->outputs[o]);
+        node->outputs[o] = qs8_id;
+      }
+    }
+  }
+
+  // Count the number of external inputs and outputs which require Convert nodes
+  uint32_t num_external_inputs = 0;
+  uint32_t num_external_outputs = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const struct xnn_node* node = &subgraph->nodes[n];
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      const struct xnn_value* value = &subgraph->values[node->inputs[i]];
+      if (value->fp32_id != XNN_INVALID_VALUE_ID && value->first_consumer == n) {
+        assert(value->datatype == xnn_datatype_qint8);
+        assert(subgraph->values[value->fp32_id].flags & XNN_VALUE_FLAG_EXTERNAL_INPUT);
+        num_external_inputs += 1;
+      }
+    }
+    for (uint32_t o = 0; o < node->num_outputs; o++) {
+      const struct xnn_value* value = &subgraph->values[node->outputs[o]];
+      if (value->fp32_id != XNN_INVALID_VALUE_ID) {
+        assert(value->datatype == xnn_datatype_qint8);
+        assert(subgraph->values[value->fp32_id].flags & XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+        num_external_outputs += 1;
+      }
+    }
+  }
+  xnn_log_debug("Discovered %"PRIu32" external inputs and %"PRIu32" external outputs",
+    num_external_inputs, num_external_outputs);
+
+  const uint32_t num_original_nodes = subgraph->num_nodes;
+  xnn_subgraph_add_nodes(subgraph, num_external_inputs + num_external_outputs);
+  struct xnn_node* output_node = subgraph->nodes + subgraph->num_nodes - 1;
+  for (uint32_t n = num_original_nodes; n != 0; n--) {
+    const struct xnn_node* node = &subgraph->nodes[n - 1];
+    // Insert Convert nodes for outputs
+    for (uint32_t o = 0; o < node->num_outputs; o++) {
+      const struct xnn_value* value = &subgraph->values[node->outputs[o]];
+      if (value->fp32_id != XNN_INVALID_VALUE_ID) {
+        xnn_log_debug("Inserted QS8->FP32 Convert Node from tensor #%"PRIu32" to tensor #%"PRIu32,
+          value->id, value->fp32_id);
+        const uint32_t output_node_id = output_node->id;
+        assert(output_node >= subgraph->nodes);
+        xnn_node_clear(output_node);
+        output_node->id = output_node_id;
+        xnn_init_convert_node(output_node, xnn_compute_type_qs8_to_fp32, value->id, value->fp32_id, 0 /* flags */);
+        output_node -= 1;
+      }
+    }
+    // Move the Node to the new location
+    if (output_node != node) {
+      const uint32_t output_node_id = output_node->id;
+      assert(output_node >= subgraph->nodes);
+      memcpy(output_node, node, sizeof(struct xnn_node));
+      output_node->id = output_node_id;
+      output_node -= 1;
+    }
+    // Insert Convert nodes for inputs
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      const struct xnn_value* value = &subgraph->values[node->inputs[i]];
+      if (value->fp32_id != XNN_INVALID_VALUE_ID && value->first_consumer == n - 1) {
+        xnn_log_debug("Inserted FP32->QS8 Convert Node from tensor #%"PRIu32" to tensor #%"PRIu32,
+          value->fp32_id, value->id);
+        const uint32_t output_node_id = output_node->id;
+        assert(output_node >= subgraph->nodes);
+        xnn_node_clear(output_node);
+        output_node->id = output_node_id;
+        xnn_init_convert_node(output_node, xnn_compute_type_fp32_to_qs8, value->fp32_id, value->id, 0 /* flags */);
+        output_node -= 1;
+      }
+    }
+  }
+
+  return true;
+}
+
 enum xnn_status xnn_subgraph_optimize(
   xnn_subgraph_t subgraph,
   uint32_t flags)
@@ -976,14 +1671,18 @@ enum xnn_status xnn_subgraph_optimize(
         switch (producer->type) {
           case xnn_node_type_add2:
           case xnn_node_type_average_pooling_2d:
+          case xnn_node_type_average_pooling_3d:
           case xnn_node_type_clamp:
           case xnn_node_type_convolution_2d:
+          case xnn_node_type_convolution_3d:
           case xnn_node_type_divide:
           case xnn_node_type_deconvolution_2d:
           case xnn_node_type_depthwise_convolution_2d:
           case xnn_node_type_fully_connected:
           case xnn_node_type_multiply2:
           case xnn_node_type_max_pooling_2d:
+          case xnn_node_type_max_pooling_3d:
+          case xnn_node_type_streaming_convolution_1d:
           case xnn_node_type_subtract:
             xnn_log_info("fuse Clamp Node #%"PRIu32" into upstream Node #%"PRIu32, consumer_id, producer_id);
             assert(producer->num_outputs == 1);
@@ -1077,9 +1776,92 @@ enum xnn_status xnn_subgraph_optimize(
             break;
         }
       }
+      // Try to remove a pair of Convert Nodes which convert a Value to FP32 and back to the original datatype.
+      // Together with the QS8->FP32 Convert fusion below, these are the only Convert eliminations: FP32->QS8 Converts
+      // after Fully Connected, Convolution, and Depthwise Convolution Nodes are not folded into their epilogues.
+      if (producer->type == xnn_node_type_convert && consumer->type == xnn_node_type_convert) {
+        assert(producer->num_inputs == 1);
+        assert(consumer->num_outputs == 1);
+        const uint32_t original_id = producer->inputs[0];
+        const uint32_t roundtrip_id = consumer->outputs[0];
+        const struct xnn_value* original_value = &subgraph->values[original_id];
+        const struct xnn_value* roundtrip_value = &subgraph->values[roundtrip_id];
+        bool is_lossless_roundtrip = false;
+        switch (original_value->datatype) {
+          case xnn_datatype_fp16:
+          case xnn_datatype_bf16:
+            is_lossless_roundtrip = roundtrip_value->datatype == original_value->datatype;
+            break;
+          case xnn_datatype_qint8:
+          case xnn_datatype_quint8:
+            is_lossless_roundtrip = roundtrip_value->datatype == original_value->datatype &&
+              roundtrip_value->quantization.zero_point == original_value->quantization.zero_point &&
+              roundtrip_value->quantization.scale == original_value->quantization.scale;
+            break;
+          default:
+            break;
+        }
+        if (is_lossless_roundtrip && value->datatype == xnn_datatype_fp32 &&
+            (roundtrip_value->flags & XNN_VALUE_FLAG_EXTERNAL_OUTPUT) == 0)
+        {
+          xnn_log_info("remove Convert Nodes #%"PRIu32" and #%"PRIu32" which convert Value #%"PRIu32" to FP32 and back",
+            producer_id, consumer_id, original_id);
+          const uint32_t num_roundtrip_consumers = roundtrip_value->num_consumers;
+          xnn_node_clear(producer);
+          xnn_node_clear(consumer);
+
+          // Consumers of the round-tripped Value read the original Value instead.
+          uint32_t first_consumer = XNN_INVALID_NODE_ID;
+          for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+            struct xnn_node* node = &subgraph->nodes[n];
+            for (uint32_t k = 0; k < node->num_inputs; k++) {
+              if (node->inputs[k] == roundtrip_id) {
+                node->inputs[k] = original_id;
+              }
+              if (node->inputs[k] == original_id && first_consumer == XNN_INVALID_NODE_ID) {
+                first_consumer = n;
+              }
+            }
+          }
+          subgraph->values[original_id].num_consumers += num_roundtrip_consumers - 1;
+          subgraph->values[original_id].first_consumer = first_consumer;
+
+          xnn_value_clear(&subgraph->values[roundtrip_id]);
+          xnn_value_clear(value);
+          continue;
+        }
+      }
+      // Try to fuse QS8->FP32 Convert Node downstream into Fully Connected Node with dynamically quantized input
+      if (producer->type == xnn_node_type_convert && producer->compute_type == xnn_compute_type_qs8_to_fp32 &&
+          consumer->type == xnn_node_type_fully_connected && consumer->compute_type == xnn_compute_type_qd8_f32_qc8w &&
+          consumer->inputs[0] == i)
+      {
+        xnn_log_info("fuse Convert Node #%"PRIu32" into Fully Connected Node #%"PRIu32, producer_id, consumer_id);
+        assert(producer->num_inputs == 1);
+
+        // The Fully Connected Node reads the QS8 input directly, with its static quantization parameters instead of
+        // parameters computed for every row of the dequantized input.
+        consumer->inputs[0] = producer->inputs[0];
+        consumer->compute_type = xnn_compute_type_qs8_f32_qc8w;
+
+        const uint32_t fused_input_id = producer->inputs[0];
+        assert(fused_input_id < subgraph->num_values);
+        if (subgraph->values[fused_input_id].first_consumer == producer_id) {
+          subgraph->values[fused_input_id].first_consumer = consumer_id;
+        }
+
+        xnn_node_clear(producer);
+        xnn_value_clear(value);
+      }
     }
   }
 
+  #if !defined(XNN_NO_QS8_OPERATORS) && !defined(XNN_NO_QC8_OPERATORS)
+    if (flags & XNN_FLAG_HINT_QS8_INFERENCE) {
+      xnn_subgraph_rewrite_for_qs8(subgraph);
+    }
+  #endif  // !defined(XNN_NO_QS8_OPERATORS) && !defined(XNN_NO_QC8_OPERATORS)
+
   #if XNN_ENABLE_SPARSE
     if ((flags & XNN_FLAG_HINT_SPARSE_INFERENCE) && (xnn_params.init_flags & XNN_INIT_FLAG_CHW_OPT)) {
       xnn_subgraph_rewrite_for_nchw(subgraph);
@@ -1103,6 +1885,12 @@ enum xnn_status xnn_subgraph_optimize(
     }
   #endif  // XNN_NO_F16_OPERATORS
 
+  #ifndef XNN_NO_BF16_OPERATORS
+    if ((flags & XNN_FLAG_HINT_BF16_INFERENCE) && (xnn_params.init_flags & XNN_INIT_FLAG_BF16)) {
+      xnn_subgraph_rewrite_for_bf16(subgraph);
+    }
+  #endif  // XNN_NO_BF16_OPERATORS
+
   return xnn_status_success;
 }
 
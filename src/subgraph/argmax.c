@@ -0,0 +1,220 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_argmax_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  const size_t channel_dim = input_shape->dim[input_shape->num_dims - 1];
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_argmax_nc_f16(
+        channel_dim /* channels */, channel_dim /* input stride */,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_compute_type_fp32:
+      status = xnn_create_argmax_nc_f32(
+        channel_dim /* channels */, channel_dim /* input stride */,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+      status = xnn_create_argmax_nc_qs8(
+        channel_dim /* channels */, channel_dim /* input stride */,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    opdata->batch_size = xnn_shape_multiply_non_channel_dims(input_shape);
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_argmax_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  int32_t* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_argmax_nc_f16:
+      return xnn_setup_argmax_nc_f16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_operator_type_argmax_nc_f32:
+      return xnn_setup_argmax_nc_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_argmax_nc_qs8:
+      return xnn_setup_argmax_nc_qs8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+enum xnn_status xnn_define_argmax(
+  xnn_subgraph_t subgraph,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_argmax)) != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = xnn_subgraph_check_input_node_id(xnn_node_type_argmax, input_id, subgraph->num_values)) !=
+      xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(xnn_node_type_argmax, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_argmax), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->shape.num_dims == 0) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": input must have at least 1 dimension",
+      xnn_node_type_to_string(xnn_node_type_argmax), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_argmax, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_argmax, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_value->datatype != xnn_datatype_int32) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(xnn_node_type_argmax), output_id,
+      xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t batch_size = xnn_shape_multiply_non_channel_dims(&input_value->shape);
+  if (xnn_shape_multiply_all_dims(&output_value->shape) != batch_size) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": number of output elements (%zu) does not match the number of input rows (%zu)",
+      xnn_node_type_to_string(xnn_node_type_argmax), input_id, output_id,
+      xnn_shape_multiply_all_dims(&output_value->shape), batch_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_argmax;
+  node->compute_type = compute_type;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_argmax_operator;
+  node->setup = setup_argmax_operator;
+
+  return xnn_status_success;
+}
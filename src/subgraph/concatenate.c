@@ -4,6 +4,7 @@
 // LICENSE file in the root directory of this source tree.
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <xnnpack.h>
@@ -15,12 +16,17 @@
 
 static enum xnn_status create_concatenate_operator_helper(
   const struct xnn_node *node,
+  const struct xnn_value* input_value,
+  const struct xnn_value* output_value,
   size_t channels,
   size_t input_stride,
   size_t output_stride,
   struct xnn_operator_data *opdata,
   size_t index)
 {
+  // Inputs quantized differently from the output are requantized while they are copied into the output.
+  const bool requantize = input_value->quantization.zero_point != output_value->quantization.zero_point ||
+    input_value->quantization.scale != output_value->quantization.scale;
   switch (node->compute_type) {
 #ifndef XNN_NO_F16_OPERATORS
     case xnn_compute_type_fp16: {
@@ -31,16 +37,29 @@ static enum xnn_status create_concatenate_operator_helper(
       return xnn_create_copy_nc_x32(channels, input_stride, output_stride, node->flags, &opdata->operator_objects[index]);
     }
 #ifndef XNN_NO_QS8_OPERATORS
-    case xnn_compute_type_qs8:
+    case xnn_compute_type_qs8: {
+      if (requantize) {
+        return xnn_create_convert_nc_qs8(
+          channels, input_stride, output_stride,
+          input_value->quantization.scale, (int8_t) input_value->quantization.zero_point,
+          output_value->quantization.scale, (int8_t) output_value->quantization.zero_point,
+          node->flags, &opdata->operator_objects[index]);
+      }
+      return xnn_create_copy_nc_x8(channels, input_stride, output_stride, node->flags, &opdata->operator_objects[index]);
+    }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
 #ifndef XNN_NO_QU8_OPERATORS
-    case xnn_compute_type_qu8:
-#endif  // !defined(XNN_NO_QU8_OPERATORS)
-#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
-    {
+    case xnn_compute_type_qu8: {
+      if (requantize) {
+        return xnn_create_convert_nc_qu8(
+          channels, input_stride, output_stride,
+          input_value->quantization.scale, (uint8_t) input_value->quantization.zero_point,
+          output_value->quantization.scale, (uint8_t) output_value->quantization.zero_point,
+          node->flags, &opdata->operator_objects[index]);
+      }
       return xnn_create_copy_nc_x8(channels, input_stride, output_stride, node->flags, &opdata->operator_objects[index]);
     }
-#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
     default:
       XNN_UNREACHABLE;
   }
@@ -79,11 +98,13 @@ static enum xnn_status create_concatenate2_operator(
   const size_t output_stride = channels_1 + channels_2;
 
   enum xnn_status status;
-  status = create_concatenate_operator_helper(node, channels_1, channels_1, output_stride, opdata, 0);
+  status = create_concatenate_operator_helper(
+    node, &values[input1_id], &values[output_id], channels_1, channels_1, output_stride, opdata, 0);
   if (status != xnn_status_success) {
     return status;
   }
-  status = create_concatenate_operator_helper(node, channels_2, channels_2, output_stride, opdata, 1);
+  status = create_concatenate_operator_helper(
+    node, &values[input2_id], &values[output_id], channels_2, channels_2, output_stride, opdata, 1);
   if (status != xnn_status_success) {
     return status;
   }
@@ -133,15 +154,18 @@ static enum xnn_status create_concatenate3_operator(
   const size_t output_stride = channels_1 + channels_2 + channels_3;
 
   enum xnn_status status;
-  status = create_concatenate_operator_helper(node, channels_1, channels_1, output_stride, opdata, 0);
+  status = create_concatenate_operator_helper(
+    node, &values[input1_id], &values[output_id], channels_1, channels_1, output_stride, opdata, 0);
   if (status != xnn_status_success) {
     return status;
   }
-  status = create_concatenate_operator_helper(node, channels_2, channels_2, output_stride, opdata, 1);
+  status = create_concatenate_operator_helper(
+    node, &values[input2_id], &values[output_id], channels_2, channels_2, output_stride, opdata, 1);
   if (status != xnn_status_success) {
     return status;
   }
-  status = create_concatenate_operator_helper(node, channels_3, channels_3, output_stride, opdata, 2);
+  status = create_concatenate_operator_helper(
+    node, &values[input3_id], &values[output_id], channels_3, channels_3, output_stride, opdata, 2);
   if (status != xnn_status_success) {
     return status;
   }
@@ -196,19 +220,23 @@ static enum xnn_status create_concatenate4_operator(
   const size_t output_stride = channels_1 + channels_2 + channels_3 + channels_4;
 
   enum xnn_status status;
-  status = create_concatenate_operator_helper(node, channels_1, channels_1, output_stride, opdata, 0);
+  status = create_concatenate_operator_helper(
+    node, &values[input1_id], &values[output_id], channels_1, channels_1, output_stride, opdata, 0);
   if (status != xnn_status_success) {
     return status;
   }
-  status = create_concatenate_operator_helper(node, channels_2, channels_2, output_stride, opdata, 1);
+  status = create_concatenate_operator_helper(
+    node, &values[input2_id], &values[output_id], channels_2, channels_2, output_stride, opdata, 1);
   if (status != xnn_status_success) {
     return status;
   }
-  status = create_concatenate_operator_helper(node, channels_3, channels_3, output_stride, opdata, 2);
+  status = create_concatenate_operator_helper(
+    node, &values[input3_id], &values[output_id], channels_3, channels_3, output_stride, opdata, 2);
   if (status != xnn_status_success) {
     return status;
   }
-  status = create_concatenate_operator_helper(node, channels_4, channels_4, output_stride, opdata, 3);
+  status = create_concatenate_operator_helper(
+    node, &values[input4_id], &values[output_id], channels_4, channels_4, output_stride, opdata, 3);
   if (status != xnn_status_success) {
     return status;
   }
@@ -265,6 +293,26 @@ static enum xnn_status setup_concatenate_operator_helper(
         threadpool);
     }
 #endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_convert_nc_qs8: {
+      return xnn_setup_convert_nc_qs8(
+        opdata->operator_objects[index],
+        opdata->batch_size,
+        input_data,
+        (int8_t*) output_data + channels,
+        threadpool);
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_operator_type_convert_nc_qu8: {
+      return xnn_setup_convert_nc_qu8(
+        opdata->operator_objects[index],
+        opdata->batch_size,
+        input_data,
+        (uint8_t*) output_data + channels,
+        threadpool);
+    }
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
     default:
       XNN_UNREACHABLE;
   }
@@ -475,36 +523,6 @@ enum xnn_status check_input_value(
   return xnn_status_success;
 }
 
-#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
-enum xnn_status check_input_compute_type(
-  xnn_subgraph_t subgraph,
-  uint32_t input_id,
-  uint32_t output_id,
-  const char* nth,
-  enum xnn_node_type node_type)
-{
-  const struct xnn_value* input_value = &subgraph->values[input_id];
-  const struct xnn_value* output_value = &subgraph->values[output_id];
-  if (input_value->quantization.zero_point != output_value->quantization.zero_point) {
-    xnn_log_error(
-        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
-        ": mismatching quantization zero point across the %s input (%d) and the output (%d)",
-        xnn_node_type_to_string(node_type), input_id, output_id,
-        nth, input_value->quantization.zero_point, output_value->quantization.zero_point);
-    return xnn_status_invalid_parameter;
-  }
-  if (input_value->quantization.scale != output_value->quantization.scale) {
-    xnn_log_error(
-        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
-        ": mismatching quantization scale across the %s input (%.7g) and the output (%.7g)",
-        xnn_node_type_to_string(node_type), input_id, output_id,
-        nth, input_value->quantization.scale, output_value->quantization.scale);
-    return xnn_status_invalid_parameter;
-  }
-  return xnn_status_success;
-}
-#endif  // !defined( XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
-
 enum xnn_status xnn_define_concatenate_n(
   enum xnn_node_type node_type,
   xnn_subgraph_t subgraph,
@@ -542,13 +560,11 @@ enum xnn_status xnn_define_concatenate_n(
     return xnn_status_invalid_parameter;
   }
 
-  check_input_value(subgraph, axis, input_ids[0], output_id, 1, node_type);
-  check_input_value(subgraph, axis, input_ids[1], output_id, 2, node_type);
-  if (num_inputs > 2) {
-    check_input_value(subgraph, axis, input_ids[2], output_id, 3, node_type);
-  }
-  if (num_inputs > 3) {
-    check_input_value(subgraph, axis, input_ids[3], output_id, 4, node_type);
+  for (size_t i = 0; i < num_inputs; i++) {
+    status = check_input_value(subgraph, axis, input_ids[i], output_id, i + 1, node_type);
+    if (status != xnn_status_success) {
+      return status;
+    }
   }
 
   size_t input_axis_dimensions_sum = 0;
@@ -593,19 +609,6 @@ enum xnn_status xnn_define_concatenate_n(
       return xnn_status_invalid_parameter;
   }
 
-  #if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
-    if (compute_type == xnn_compute_type_qs8 || compute_type == xnn_compute_type_qu8) {
-      check_input_compute_type(subgraph, input_ids[0], output_id, "first", node_type);
-      check_input_compute_type(subgraph, input_ids[1], output_id, "second", node_type);
-    }
-    if (num_inputs > 2) {
-      check_input_compute_type(subgraph, input_ids[2], output_id, "third", node_type);
-    }
-    if (num_inputs > 3) {
-      check_input_compute_type(subgraph, input_ids[3], output_id, "fourth", node_type);
-    }
-  #endif  // !defined( XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
-
   struct xnn_node* node = xnn_subgraph_new_node(subgraph);
   if (node == NULL) {
     return xnn_status_out_of_memory;
@@ -39,6 +39,20 @@ static enum xnn_status create_convert_operator(
 
   enum xnn_status status = xnn_status_uninitialized;
   switch (node->compute_type) {
+#ifndef XNN_NO_BF16_OPERATORS
+    case xnn_compute_type_fp32_to_bf16:
+      status = xnn_create_convert_nc_f32_bf16(
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    case xnn_compute_type_bf16_to_fp32:
+      status = xnn_create_convert_nc_bf16_f32(
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_BF16_OPERATORS)
     case xnn_compute_type_fp32_to_fp16:
       status = xnn_create_convert_nc_f32_f16(
         channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
@@ -119,6 +133,22 @@ static enum xnn_status setup_convert_operator(
   assert(output_data != NULL);
 
   switch (opdata->operator_objects[0]->type) {
+#ifndef XNN_NO_BF16_OPERATORS
+    case xnn_operator_type_convert_nc_f32_bf16:
+      return xnn_setup_convert_nc_f32_bf16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_convert_nc_bf16_f32:
+      return xnn_setup_convert_nc_bf16_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_BF16_OPERATORS)
     case xnn_operator_type_convert_nc_f32_f16:
       return xnn_setup_convert_nc_f32_f16(
         opdata->operator_objects[0],
@@ -173,6 +203,8 @@ static inline enum xnn_compute_type validate_datatypes(
   switch (input_datatype) {
     case xnn_datatype_fp32:
       switch (output_datatype) {
+        case xnn_datatype_bf16:
+          return xnn_compute_type_fp32_to_bf16;
         case xnn_datatype_fp16:
           return xnn_compute_type_fp32_to_fp16;
         case xnn_datatype_qint8:
@@ -183,6 +215,11 @@ static inline enum xnn_compute_type validate_datatypes(
           break;
       }
       break;
+    case xnn_datatype_bf16:
+      if (output_datatype == xnn_datatype_fp32) {
+        return xnn_compute_type_bf16_to_fp32;
+      }
+      break;
     case xnn_datatype_fp16:
       if (output_datatype == xnn_datatype_fp32) {
         return xnn_compute_type_fp16_to_fp32;
@@ -246,6 +283,7 @@ enum xnn_status xnn_define_convert(
   }
 
   switch (input_value->datatype) {
+    case xnn_datatype_bf16:
     case xnn_datatype_fp16:
     case xnn_datatype_fp32:
     case xnn_datatype_qint8:
@@ -271,6 +309,7 @@ enum xnn_status xnn_define_convert(
   }
 
   switch (output_value->datatype) {
+    case xnn_datatype_bf16:
     case xnn_datatype_fp16:
     case xnn_datatype_fp32:
     case xnn_datatype_qint8:
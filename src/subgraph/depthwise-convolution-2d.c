@@ -178,6 +178,25 @@ static enum xnn_status create_convolution_operator(
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
         const int8_t output_max =
           (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+        const float* filter_scale = values[filter_id].quantization.channelwise_scale;
+        const void* qc8_filter_data = filter_data;
+        const void* qc8_bias_data = bias_data;
+        struct xnn_qc8_weights qc8_weights = { 0 };
+        if (values[filter_id].datatype == xnn_datatype_fp32) {
+          // FP32 weights of a Node rewritten for QS8 inference are quantized per output channel here.
+          status = xnn_quantize_qc8_weights(
+            node->params.depthwise_convolution_2d.input_channels * node->params.depthwise_convolution_2d.depth_multiplier /* channels */,
+            node->params.depthwise_convolution_2d.kernel_height * node->params.depthwise_convolution_2d.kernel_width /* channel size */,
+            1 /* channel stride */,
+            node->params.depthwise_convolution_2d.input_channels * node->params.depthwise_convolution_2d.depth_multiplier /* element stride */,
+            filter_data, bias_data, values[input_id].quantization.scale, &qc8_weights);
+          if (status != xnn_status_success) {
+            break;
+          }
+          filter_scale = qc8_weights.filter_scale;
+          qc8_filter_data = qc8_weights.filter;
+          qc8_bias_data = qc8_weights.bias;
+        }
         status = xnn_create_convolution2d_nhwc_qc8(
           node->params.depthwise_convolution_2d.input_padding_top,
           node->params.depthwise_convolution_2d.input_padding_right,
@@ -196,14 +215,15 @@ static enum xnn_status create_convolution_operator(
           node->params.depthwise_convolution_2d.input_channels * node->params.depthwise_convolution_2d.depth_multiplier /* output_channel_stride */,
           (int8_t) values[input_id].quantization.zero_point,
           values[input_id].quantization.scale,
-          values[filter_id].quantization.channelwise_scale,
-          filter_data,
-          bias_data,
+          filter_scale,
+          qc8_filter_data,
+          qc8_bias_data,
           (int8_t) output_zero_point,
           output_scale, output_min, output_max,
           node->flags | XNN_FLAG_DEPTHWISE_CONVOLUTION,
           NULL,
           &opdata->operator_objects[0]);
+        xnn_release_qc8_weights(&qc8_weights);
         break;
       }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
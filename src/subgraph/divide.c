@@ -11,6 +11,7 @@
 
 #include <xnnpack.h>
 #include <xnnpack/log.h>
+#include <xnnpack/operator.h>
 #include <xnnpack/params.h>
 #include <xnnpack/subgraph.h>
 #include <xnnpack/subgraph-validation.h>
@@ -23,8 +24,6 @@ static enum xnn_status create_divide_operator(
   struct xnn_operator_data* opdata,
   const struct xnn_caches* caches)
 {
-  assert(node->compute_type == xnn_compute_type_fp32);
-
   assert(node->num_inputs == 2);
   const uint32_t input1_id = node->inputs[0];
   assert(input1_id != XNN_INVALID_VALUE_ID);
@@ -38,11 +37,38 @@ static enum xnn_status create_divide_operator(
   assert(output_id != XNN_INVALID_VALUE_ID);
   assert(output_id < num_values);
 
-  const enum xnn_status status = xnn_create_divide_nd_f32(
-    node->activation.output_min,
-    node->activation.output_max,
-    node->flags,
-    &opdata->operator_objects[0]);
+  enum xnn_status status;
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      status = xnn_create_divide_nd_f32(
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+    {
+      const float output_scale = values[output_id].quantization.scale;
+      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      const int8_t output_min =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      const int8_t output_max =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      status = xnn_create_divide_nd_qs8(
+        (int8_t) values[input1_id].quantization.zero_point,
+        values[input1_id].quantization.scale,
+        (int8_t) values[input2_id].quantization.zero_point,
+        values[input2_id].quantization.scale,
+        (int8_t) output_zero_point,
+        output_scale, output_min, output_max, node->flags,
+        &opdata->operator_objects[0]);
+      break;
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
   if (status == xnn_status_success) {
     opdata->shape1.num_dims = values[input1_id].shape.num_dims;
     opdata->shape2.num_dims = values[input2_id].shape.num_dims;
@@ -103,14 +129,30 @@ static enum xnn_status setup_divide_operator(
   void* output_data = output_blob->data;
   assert(output_data != NULL);
 
-  return xnn_setup_divide_nd_f32(
-    opdata->operator_objects[0],
-    opdata->shape1.num_dims,
-    opdata->shape1.dim,
-    opdata->shape2.num_dims,
-    opdata->shape2.dim,
-    input1_data, input2_data, output_data,
-    threadpool);
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_divide_nd_f32:
+      return xnn_setup_divide_nd_f32(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->shape2.num_dims,
+        opdata->shape2.dim,
+        input1_data, input2_data, output_data,
+        threadpool);
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_divide_nd_qs8:
+      return xnn_setup_divide_nd_qs8(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->shape2.num_dims,
+        opdata->shape2.dim,
+        input1_data, input2_data, output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
 }
 
 enum xnn_status xnn_define_divide(
@@ -161,6 +203,9 @@ enum xnn_status xnn_define_divide(
 
   switch (input1_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -183,6 +228,9 @@ enum xnn_status xnn_define_divide(
 
   switch (input2_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -203,9 +251,16 @@ enum xnn_status xnn_define_divide(
     return status;
   }
 
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
   switch (output_value->datatype) {
     case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
       break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
     default:
       xnn_log_error(
         "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
@@ -214,13 +269,26 @@ enum xnn_status xnn_define_divide(
       return xnn_status_invalid_parameter;
   }
 
+  if (input1_value->datatype != input2_value->datatype ||
+      input1_value->datatype != output_value->datatype)
+  {
+    xnn_log_error(
+      "failed to define %s operator with input IDs #%" PRIu32 " and #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across the first input (%s), the second input (%s), and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_divide), input1_id, input2_id, output_id,
+      xnn_datatype_to_string(input1_value->datatype),
+      xnn_datatype_to_string(input2_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
   struct xnn_node* node = xnn_subgraph_new_node(subgraph);
   if (node == NULL) {
     return xnn_status_out_of_memory;
   }
 
   node->type = xnn_node_type_divide;
-  node->compute_type = xnn_compute_type_fp32;
+  node->compute_type = compute_type;
   node->activation.output_min = output_min;
   node->activation.output_max = output_max;
   node->num_inputs = 2;
@@ -0,0 +1,391 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_embedding_lookup_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 2);
+  const uint32_t table_id = node->inputs[0];
+  assert(table_id != XNN_INVALID_VALUE_ID);
+  assert(table_id < num_values);
+  const uint32_t indices_id = node->inputs[1];
+  assert(indices_id != XNN_INVALID_VALUE_ID);
+  assert(indices_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_value* table_value = values + table_id;
+  const void* table_data = table_value->data;
+  assert(table_data != NULL);
+  const size_t num_embeddings = table_value->shape.dim[0];
+  const size_t embedding_dim = table_value->shape.dim[1];
+  const enum xnn_reduce_operator bag_operator = node->params.embedding_lookup.bag_operator;
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      if (bag_operator == xnn_reduce_invalid) {
+        status = xnn_create_embedding_lookup_nc_x16(
+          num_embeddings, embedding_dim, table_data,
+          node->flags,
+          &opdata->operator_objects[0]);
+      } else {
+        status = xnn_create_embedding_bag_nc_f16(
+          bag_operator, num_embeddings, embedding_dim, table_data,
+          node->flags,
+          &opdata->operator_objects[0]);
+      }
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_compute_type_fp32:
+      if (bag_operator == xnn_reduce_invalid) {
+        status = xnn_create_embedding_lookup_nc_x32(
+          num_embeddings, embedding_dim, table_data,
+          node->flags,
+          &opdata->operator_objects[0]);
+      } else {
+        status = xnn_create_embedding_bag_nc_f32(
+          bag_operator, num_embeddings, embedding_dim, table_data,
+          node->flags,
+          &opdata->operator_objects[0]);
+      }
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_compute_type_qu8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      assert(bag_operator == xnn_reduce_invalid);
+      status = xnn_create_embedding_lookup_nc_x8(
+        num_embeddings, embedding_dim, table_data,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    // Without bags, every index produces an output row. With bags, the innermost dimension of the indices enumerates
+    // the indices in a bag.
+    const struct xnn_shape* indices_shape = &values[indices_id].shape;
+    size_t num_indices = 1;
+    for (size_t i = 0; i < indices_shape->num_dims; i++) {
+      num_indices *= indices_shape->dim[i];
+    }
+    if (bag_operator == xnn_reduce_invalid) {
+      opdata->batch_size = num_indices;
+    } else {
+      const size_t bag_size = indices_shape->dim[indices_shape->num_dims - 1];
+      opdata->batch_size = bag_size == 0 ? 0 : num_indices / bag_size;
+      opdata->input_width = bag_size;
+    }
+    opdata->inputs[0] = indices_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_embedding_lookup_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t indices_id = opdata->inputs[0];
+  assert(indices_id != XNN_INVALID_VALUE_ID);
+  assert(indices_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* indices_blob = blobs + indices_id;
+  const int32_t* indices_data = indices_blob->data;
+  assert(indices_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    case xnn_operator_type_embedding_lookup_nc_x8:
+      return xnn_setup_embedding_lookup_nc_x8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        indices_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_embedding_lookup_nc_x16:
+      return xnn_setup_embedding_lookup_nc_x16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        indices_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_embedding_bag_nc_f16:
+      return xnn_setup_embedding_bag_nc_f16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        indices_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_operator_type_embedding_lookup_nc_x32:
+      return xnn_setup_embedding_lookup_nc_x32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        indices_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_embedding_bag_nc_f32:
+      return xnn_setup_embedding_bag_nc_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        indices_data,
+        output_data,
+        threadpool);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status define_embedding_lookup(
+  xnn_subgraph_t subgraph,
+  enum xnn_reduce_operator bag_operator,
+  uint32_t table_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_embedding_lookup)) != xnn_status_success) {
+    return status;
+  }
+
+  // Check the table.
+  status = xnn_subgraph_check_nth_input_node_id(xnn_node_type_embedding_lookup, table_id, subgraph->num_values, 1);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* table_value = &subgraph->values[table_id];
+  status = xnn_subgraph_check_nth_input_type_dense(xnn_node_type_embedding_lookup, table_id, table_value, 1);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (table_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_datatype_fp16:
+      compute_type = xnn_compute_type_fp16;
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with table ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_embedding_lookup), table_id,
+        xnn_datatype_to_string(table_value->datatype), table_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (bag_operator != xnn_reduce_invalid && compute_type != xnn_compute_type_fp32 &&
+      compute_type != xnn_compute_type_fp16)
+  {
+    xnn_log_error(
+      "failed to define %s operator with table ID #%" PRIu32 ": bags of %s embeddings are not supported",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), table_id,
+      xnn_datatype_to_string(table_value->datatype));
+    return xnn_status_unsupported_parameter;
+  }
+
+  if (table_value->data == NULL) {
+    xnn_log_error(
+      "failed to define %s operator with table ID #%" PRIu32 ": non-static Value",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), table_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (table_value->shape.num_dims != 2) {
+    xnn_log_error(
+      "failed to define %s operator with table ID #%" PRIu32 ": %zu dimensions (expected 2)",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), table_id, table_value->shape.num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Check the indices.
+  status = xnn_subgraph_check_nth_input_node_id(xnn_node_type_embedding_lookup, indices_id, subgraph->num_values, 2);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* indices_value = &subgraph->values[indices_id];
+  status = xnn_subgraph_check_nth_input_type_dense(xnn_node_type_embedding_lookup, indices_id, indices_value, 2);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (indices_value->datatype != xnn_datatype_int32) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), indices_id,
+      xnn_datatype_to_string(indices_value->datatype), indices_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (bag_operator != xnn_reduce_invalid && indices_value->shape.num_dims == 0) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 ": indices of bags must have at least 1 dimension",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), indices_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Check the output.
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_embedding_lookup, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_embedding_lookup, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_value->datatype != table_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with table ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across table (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), table_id, output_id,
+      xnn_datatype_to_string(table_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+#if !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+  if (output_value->datatype == xnn_datatype_qint8 || output_value->datatype == xnn_datatype_quint8) {
+    if (table_value->quantization.zero_point != output_value->quantization.zero_point ||
+        table_value->quantization.scale != output_value->quantization.scale)
+    {
+      xnn_log_error(
+        "failed to define %s operator with table ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching quantization parameters across table (%" PRId32 ", %.7g) and output (%" PRId32 ", %.7g)",
+        xnn_node_type_to_string(xnn_node_type_embedding_lookup), table_id, output_id,
+        table_value->quantization.zero_point, table_value->quantization.scale,
+        output_value->quantization.zero_point, output_value->quantization.scale);
+      return xnn_status_invalid_parameter;
+    }
+  }
+#endif  // !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+
+  // Output shape is the indices shape with an extra embedding dimension, or with the bag dimension replaced by the
+  // embedding dimension.
+  const struct xnn_shape* indices_shape = &indices_value->shape;
+  const struct xnn_shape* output_shape = &output_value->shape;
+  const size_t num_index_dims = bag_operator == xnn_reduce_invalid ? indices_shape->num_dims : indices_shape->num_dims - 1;
+  bool valid_output_shape = output_shape->num_dims == num_index_dims + 1 &&
+    output_shape->dim[num_index_dims] == table_value->shape.dim[1];
+  for (size_t i = 0; valid_output_shape && i < num_index_dims; i++) {
+    valid_output_shape = output_shape->dim[i] == indices_shape->dim[i];
+  }
+  if (!valid_output_shape) {
+    xnn_log_error(
+      "failed to define %s operator with indices ID #%" PRIu32 " and output ID #%" PRIu32
+      ": output shape does not match the indices shape and the embedding dimension (%zu)",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), indices_id, output_id, table_value->shape.dim[1]);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_embedding_lookup;
+  node->compute_type = compute_type;
+  node->params.embedding_lookup.bag_operator = bag_operator;
+  node->num_inputs = 2;
+  node->inputs[0] = table_id;
+  node->inputs[1] = indices_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_embedding_lookup_operator;
+  node->setup = setup_embedding_lookup_operator;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_embedding_lookup(
+  xnn_subgraph_t subgraph,
+  uint32_t table_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_embedding_lookup(subgraph, xnn_reduce_invalid, table_id, indices_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_embedding_bag(
+  xnn_subgraph_t subgraph,
+  enum xnn_reduce_operator bag_operator,
+  uint32_t table_id,
+  uint32_t indices_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  if (bag_operator != xnn_reduce_sum && bag_operator != xnn_reduce_mean) {
+    xnn_log_error(
+      "failed to define %s operator with %d bag operator: bag operator must be sum or mean",
+      xnn_node_type_to_string(xnn_node_type_embedding_lookup), bag_operator);
+    return xnn_status_invalid_parameter;
+  }
+
+  return define_embedding_lookup(subgraph, bag_operator, table_id, indices_id, output_id, flags);
+}
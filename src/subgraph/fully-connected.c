@@ -76,6 +76,22 @@ static enum xnn_status create_fully_connected_operator(
         caches,
         &opdata->operator_objects[0]);
       break;
+#ifndef XNN_NO_BF16_OPERATORS
+    case xnn_compute_type_bf16:
+      status = xnn_create_fully_connected_nc_bf16(
+        input_channels,
+        output_channels,
+        input_channels /* input stride */,
+        output_channels /* output stride */,
+        filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags | XNN_FLAG_FP32_STATIC_WEIGHTS,
+        caches,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_BF16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_compute_type_qs8:
     {
@@ -103,6 +119,101 @@ static enum xnn_status create_fully_connected_operator(
       break;
     }
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QC8_OPERATORS
+    case xnn_compute_type_qc8:
+    {
+      const float output_scale = values[output_id].quantization.scale;
+      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      const int8_t output_min =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      const int8_t output_max =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      const float* filter_scale = values[filter_id].quantization.channelwise_scale;
+      const void* qc8_filter_data = filter_data;
+      const void* qc8_bias_data = bias_data;
+      struct xnn_qc8_weights qc8_weights = { 0 };
+      if (values[filter_id].datatype == xnn_datatype_fp32) {
+        // FP32 weights of a Node rewritten for QS8 inference are quantized per output channel here.
+        status = xnn_quantize_qc8_weights(
+          output_channels,
+          input_channels /* channel size */,
+          node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS ? 1 : input_channels /* channel stride */,
+          node->flags & XNN_FLAG_TRANSPOSE_WEIGHTS ? output_channels : 1 /* element stride */,
+          filter_data, bias_data, values[input_id].quantization.scale, &qc8_weights);
+        if (status != xnn_status_success) {
+          break;
+        }
+        filter_scale = qc8_weights.filter_scale;
+        qc8_filter_data = qc8_weights.filter;
+        qc8_bias_data = qc8_weights.bias;
+      }
+      status = xnn_create_fully_connected_nc_qc8(
+        input_channels,
+        output_channels,
+        input_channels /* input stride */,
+        output_channels /* output stride */,
+        (int8_t) values[input_id].quantization.zero_point,
+        values[input_id].quantization.scale,
+        filter_scale,
+        qc8_filter_data,
+        qc8_bias_data,
+        (int8_t) output_zero_point,
+        output_scale, output_min, output_max,
+        node->flags /* flags */,
+        caches,
+        &opdata->operator_objects[0]);
+      xnn_release_qc8_weights(&qc8_weights);
+      break;
+    }
+    case xnn_compute_type_qd8_f32_qc8w:
+      status = xnn_create_fully_connected_nc_qd8_f32_qc8w(
+        input_channels,
+        output_channels,
+        input_channels /* input stride */,
+        output_channels /* output stride */,
+        values[filter_id].quantization.channelwise_scale,
+        filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags /* flags */,
+        caches,
+        &opdata->operator_objects[0]);
+      break;
+    case xnn_compute_type_qs8_f32_qc8w:
+      status = xnn_create_fully_connected_nc_qs8_f32_qc8w(
+        input_channels,
+        output_channels,
+        input_channels /* input stride */,
+        output_channels /* output stride */,
+        (int8_t) values[input_id].quantization.zero_point,
+        values[input_id].quantization.scale,
+        values[filter_id].quantization.channelwise_scale,
+        filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags /* flags */,
+        caches,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QC8_OPERATORS)
+    case xnn_compute_type_fp32_qc4w:
+      status = xnn_create_fully_connected_nc_f32_qc4w(
+        input_channels,
+        output_channels,
+        input_channels /* input stride */,
+        output_channels /* output stride */,
+        (uint8_t) values[filter_id].quantization.zero_point,
+        values[filter_id].quantization.channelwise_scale,
+        filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags /* flags */,
+        caches,
+        &opdata->operator_objects[0]);
+      break;
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_compute_type_qu8:
     {
@@ -172,6 +283,15 @@ static enum xnn_status setup_fully_connected_operator(
         input_data,
         output_data,
         threadpool);
+#ifndef XNN_NO_BF16_OPERATORS
+    case xnn_operator_type_fully_connected_nc_bf16:
+      return xnn_setup_fully_connected_nc_bf16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_BF16_OPERATORS)
 #ifndef XNN_NO_QS8_OPERATORS
     case xnn_operator_type_fully_connected_nc_qs8:
       return xnn_setup_fully_connected_nc_qs8(
@@ -181,6 +301,36 @@ static enum xnn_status setup_fully_connected_operator(
         output_data,
         threadpool);
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QC8_OPERATORS
+    case xnn_operator_type_fully_connected_nc_qc8:
+      return xnn_setup_fully_connected_nc_qc8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_fully_connected_nc_qd8_f32_qc8w:
+      return xnn_setup_fully_connected_nc_qd8_f32_qc8w(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+    case xnn_operator_type_fully_connected_nc_qs8_f32_qc8w:
+      return xnn_setup_fully_connected_nc_qs8_f32_qc8w(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QC8_OPERATORS)
+    case xnn_operator_type_fully_connected_nc_f32_qc4w:
+      return xnn_setup_fully_connected_nc_f32_qc4w(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_operator_type_fully_connected_nc_qu8:
       return xnn_setup_fully_connected_nc_qu8(
@@ -220,6 +370,30 @@ static inline enum xnn_compute_type validate_datatypes_with_bias(
       }
       break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QC8_OPERATORS
+    case xnn_datatype_qcint8:
+      if (input_datatype == xnn_datatype_qint8 &&
+          bias_datatype == xnn_datatype_qcint32 &&
+          output_datatype == xnn_datatype_qint8)
+      {
+        return xnn_compute_type_qc8;
+      }
+      if (input_datatype == xnn_datatype_fp32 &&
+          bias_datatype == xnn_datatype_fp32 &&
+          output_datatype == xnn_datatype_fp32)
+      {
+        return xnn_compute_type_qd8_f32_qc8w;
+      }
+      break;
+#endif  // !defined(XNN_NO_QC8_OPERATORS)
+    case xnn_datatype_qcint4:
+      if (input_datatype == xnn_datatype_fp32 &&
+          bias_datatype == xnn_datatype_fp32 &&
+          output_datatype == xnn_datatype_fp32)
+      {
+        return xnn_compute_type_fp32_qc4w;
+      }
+      break;
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_datatype_quint8:
       if (input_datatype == xnn_datatype_quint8 &&
@@ -254,6 +428,21 @@ static inline enum xnn_compute_type validate_datatypes_without_bias(
       }
       break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QC8_OPERATORS
+    case xnn_datatype_qcint8:
+      if (input_datatype == xnn_datatype_qint8 && output_datatype == xnn_datatype_qint8) {
+        return xnn_compute_type_qc8;
+      }
+      if (input_datatype == xnn_datatype_fp32 && output_datatype == xnn_datatype_fp32) {
+        return xnn_compute_type_qd8_f32_qc8w;
+      }
+      break;
+#endif  // !defined(XNN_NO_QC8_OPERATORS)
+    case xnn_datatype_qcint4:
+      if (input_datatype == xnn_datatype_fp32 && output_datatype == xnn_datatype_fp32) {
+        return xnn_compute_type_fp32_qc4w;
+      }
+      break;
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_datatype_quint8:
       if (input_datatype == xnn_datatype_quint8 && output_datatype == xnn_datatype_quint8) {
@@ -366,6 +555,37 @@ enum xnn_status xnn_define_fully_connected(
       }
       break;
 #endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QC8_OPERATORS
+    case xnn_datatype_qcint8:
+    {
+      // Output channels are the first dimension of the filter, or the second one with transposed weights.
+      const size_t channel_dimension = (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) != 0 ? 1 : 0;
+      if (filter_value->quantization.channel_dimension != channel_dimension) {
+        xnn_log_error(
+          "failed to define %s operator with filter ID #%" PRIu32 ": invalid channel dimension %zu",
+          xnn_node_type_to_string(xnn_node_type_fully_connected), filter_id,
+          filter_value->quantization.channel_dimension);
+        return xnn_status_invalid_parameter;
+      }
+      break;
+    }
+#endif  // !defined(XNN_NO_QC8_OPERATORS)
+    case xnn_datatype_qcint4:
+      if (flags & XNN_FLAG_TRANSPOSE_WEIGHTS) {
+        xnn_log_error(
+          "failed to define %s operator with filter ID #%" PRIu32 ": transposed weights are unsupported for datatype %s",
+          xnn_node_type_to_string(xnn_node_type_fully_connected), filter_id,
+          xnn_datatype_to_string(filter_value->datatype));
+        return xnn_status_unsupported_parameter;
+      }
+      if (filter_value->quantization.channel_dimension != 0) {
+        xnn_log_error(
+          "failed to define %s operator with filter ID #%" PRIu32 ": invalid channel dimension %zu",
+          xnn_node_type_to_string(xnn_node_type_fully_connected), filter_id,
+          filter_value->quantization.channel_dimension);
+        return xnn_status_invalid_parameter;
+      }
+      break;
 #ifndef XNN_NO_QU8_OPERATORS
     case xnn_datatype_quint8:
       break;
@@ -407,6 +627,9 @@ enum xnn_status xnn_define_fully_connected(
 #if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
       case xnn_datatype_qint32:
 #endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+#ifndef XNN_NO_QC8_OPERATORS
+      case xnn_datatype_qcint32:
+#endif  // !defined(XNN_NO_QC8_OPERATORS)
         break;
       default:
         xnn_log_error(
@@ -415,6 +638,13 @@ enum xnn_status xnn_define_fully_connected(
           xnn_datatype_to_string(bias_value->datatype), bias_value->datatype);
         return xnn_status_invalid_parameter;
     }
+
+    if (bias_value->datatype == xnn_datatype_qcint32 && bias_value->quantization.channel_dimension != 0) {
+      xnn_log_error(
+        "failed to define %s operator with bias ID #%" PRIu32 ": invalid channel dimension %zu",
+        xnn_node_type_to_string(xnn_node_type_fully_connected), bias_id, bias_value->quantization.channel_dimension);
+      return xnn_status_invalid_parameter;
+    }
   }
 
   status = xnn_subgraph_check_output_node_id(xnn_node_type_fully_connected, output_id, subgraph->num_values);
@@ -23,8 +23,6 @@ static enum xnn_status create_hardswish_operator(
   struct xnn_operator_data* opdata,
   const struct xnn_caches* caches)
 {
-  assert(node->compute_type == xnn_compute_type_fp32);
-
   assert(node->num_inputs == 1);
   const uint32_t input_id = node->inputs[0];
   assert(input_id != XNN_INVALID_VALUE_ID);
@@ -54,6 +52,19 @@ static enum xnn_status create_hardswish_operator(
         &opdata->operator_objects[0]);
       break;
 #endif  // !defined(XNN_NO_F16_OPERATORS)
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+      status = xnn_create_hardswish_nc_qs8(
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        (int8_t) values[input_id].quantization.zero_point,
+        values[input_id].quantization.scale,
+        (int8_t) values[output_id].quantization.zero_point,
+        values[output_id].quantization.scale,
+        INT8_MIN, INT8_MAX,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
     default:
       XNN_UNREACHABLE;
   }
@@ -104,6 +115,15 @@ static enum xnn_status setup_hardswish_operator(
         output_data,
         threadpool);
 #endif  // !defined(XNN_NO_F16_OPERATORS)
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_hardswish_nc_qs8:
+      return xnn_setup_hardswish_nc_qs8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
     default:
       XNN_UNREACHABLE;
   }
@@ -133,6 +153,9 @@ enum xnn_status xnn_define_hardswish(
 
   switch (input_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -153,9 +176,16 @@ enum xnn_status xnn_define_hardswish(
     return status;
   }
 
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
   switch (output_value->datatype) {
     case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
       break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
     default:
       xnn_log_error(
         "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
@@ -164,13 +194,23 @@ enum xnn_status xnn_define_hardswish(
       return xnn_status_invalid_parameter;
   }
 
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across the input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_hardswish), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
   struct xnn_node* node = xnn_subgraph_new_node(subgraph);
   if (node == NULL) {
     return xnn_status_out_of_memory;
   }
 
   node->type = xnn_node_type_hardswish;
-  node->compute_type = xnn_compute_type_fp32;
+  node->compute_type = compute_type;
   node->num_inputs = 1;
   node->inputs[0] = input_id;
   node->num_outputs = 1;
@@ -0,0 +1,269 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_layer_normalization_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 3);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t gamma_id = node->inputs[1];
+  assert(gamma_id != XNN_INVALID_VALUE_ID);
+  assert(gamma_id < num_values);
+  const uint32_t beta_id = node->inputs[2];
+  assert(beta_id != XNN_INVALID_VALUE_ID);
+  assert(beta_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const size_t num_input_dims = values[input_id].shape.num_dims;
+  const size_t channel_dim = num_input_dims == 0 ? 1 : values[input_id].shape.dim[num_input_dims - 1];
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      status = xnn_create_layer_normalization_nc_f32(
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->params.layer_normalization.epsilon,
+        values[gamma_id].data, values[beta_id].data,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_layer_normalization_nc_f16(
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->params.layer_normalization.epsilon,
+        values[gamma_id].data, values[beta_id].data,
+        node->flags | XNN_FLAG_FP32_STATIC_WEIGHTS,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    opdata->batch_size = xnn_shape_multiply_non_channel_dims(&values[input_id].shape);
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_layer_normalization_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_layer_normalization_nc_f32:
+      return xnn_setup_layer_normalization_nc_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_layer_normalization_nc_f16:
+      return xnn_setup_layer_normalization_nc_f16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status check_static_parameter(
+  xnn_subgraph_t subgraph,
+  const char* parameter_name,
+  uint32_t parameter_id,
+  size_t channels)
+{
+  if (parameter_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), parameter_name, parameter_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* parameter_value = &subgraph->values[parameter_id];
+  if (parameter_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), parameter_name, parameter_id,
+      parameter_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (parameter_value->data == NULL) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": non-static Value",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), parameter_name, parameter_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (parameter_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_layer_normalization), parameter_name, parameter_id,
+        xnn_datatype_to_string(parameter_value->datatype), parameter_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (xnn_shape_multiply_all_dims(&parameter_value->shape) != channels) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": "
+      "number of elements must match the number of channels (%zu)",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), parameter_name, parameter_id, channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_layer_normalization(
+  xnn_subgraph_t subgraph,
+  float epsilon,
+  uint32_t input_id,
+  uint32_t gamma_id,
+  uint32_t beta_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_layer_normalization)) != xnn_status_success) {
+    return status;
+  }
+
+  if (!(epsilon > 0.0f) || !isfinite(epsilon)) {
+    xnn_log_error(
+      "failed to define %s operator with %.7g epsilon: epsilon must be finite and positive",
+      xnn_node_type_to_string(xnn_node_type_layer_normalization), epsilon);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((status = xnn_subgraph_check_input_node_id(xnn_node_type_layer_normalization, input_id, subgraph->num_values)) !=
+      xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(xnn_node_type_layer_normalization, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_layer_normalization), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_input_dims = input_value->shape.num_dims;
+  const size_t channels = num_input_dims == 0 ? 1 : input_value->shape.dim[num_input_dims - 1];
+
+  status = check_static_parameter(subgraph, "gamma", gamma_id, channels);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  status = check_static_parameter(subgraph, "beta", beta_id, channels);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_layer_normalization, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_layer_normalization, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_layer_normalization), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_layer_normalization;
+  node->compute_type = xnn_compute_type_fp32;
+  node->params.layer_normalization.epsilon = epsilon;
+  node->num_inputs = 3;
+  node->inputs[0] = input_id;
+  node->inputs[1] = gamma_id;
+  node->inputs[2] = beta_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_layer_normalization_operator;
+  node->setup = setup_layer_normalization_operator;
+
+  return xnn_status_success;
+}
@@ -54,6 +54,34 @@ static enum xnn_status create_leaky_relu_operator(
         node->flags,
         &opdata->operator_objects[0]);
       break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+      status = xnn_create_leaky_relu_nc_qs8(
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->params.leaky_relu.negative_slope,
+        (int8_t) values[input_id].quantization.zero_point,
+        values[input_id].quantization.scale,
+        (int8_t) values[output_id].quantization.zero_point,
+        values[output_id].quantization.scale,
+        INT8_MIN, INT8_MAX,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_compute_type_qu8:
+      status = xnn_create_leaky_relu_nc_qu8(
+        channel_dim /* channels */, channel_dim /* input stride */, channel_dim /* output stride */,
+        node->params.leaky_relu.negative_slope,
+        (uint8_t) values[input_id].quantization.zero_point,
+        values[input_id].quantization.scale,
+        (uint8_t) values[output_id].quantization.zero_point,
+        values[output_id].quantization.scale,
+        0, UINT8_MAX,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
     default:
       XNN_UNREACHABLE;
   }
@@ -104,6 +132,24 @@ static enum xnn_status setup_leaky_relu_operator(
         input_data,
         output_data,
         threadpool);
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_leaky_relu_nc_qs8:
+      return xnn_setup_leaky_relu_nc_qs8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_operator_type_leaky_relu_nc_qu8:
+      return xnn_setup_leaky_relu_nc_qu8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
     default:
       XNN_UNREACHABLE;
   }
@@ -142,6 +188,12 @@ enum xnn_status xnn_define_leaky_relu(
 
   switch (input_value->datatype) {
     case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
       break;
     default:
       xnn_log_error(
@@ -162,9 +214,21 @@ enum xnn_status xnn_define_leaky_relu(
     return status;
   }
 
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
   switch (output_value->datatype) {
     case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
       break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
     default:
       xnn_log_error(
         "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
@@ -173,13 +237,23 @@ enum xnn_status xnn_define_leaky_relu(
       return xnn_status_invalid_parameter;
   }
 
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across the input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_leaky_relu), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
   struct xnn_node* node = xnn_subgraph_new_node(subgraph);
   if (node == NULL) {
     return xnn_status_out_of_memory;
   }
 
   node->type = xnn_node_type_leaky_relu;
-  node->compute_type = xnn_compute_type_fp32;
+  node->compute_type = compute_type;
   node->params.leaky_relu.negative_slope = negative_slope;
   node->num_inputs = 1;
   node->inputs[0] = input_id;
@@ -0,0 +1,302 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_scaled_dot_product_attention_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 3 || node->num_inputs == 4);
+  const uint32_t query_id = node->inputs[0];
+  assert(query_id != XNN_INVALID_VALUE_ID);
+  assert(query_id < num_values);
+  const uint32_t value_id = node->inputs[2];
+  assert(value_id != XNN_INVALID_VALUE_ID);
+  assert(value_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      status = xnn_create_scaled_dot_product_attention_nhtc_f32(
+        node->params.scaled_dot_product_attention.scale,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_scaled_dot_product_attention_nhtc_f16(
+        node->params.scaled_dot_product_attention.scale,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    // Query shape is [N, H, T, C], and value shape is [N, H, S, V].
+    opdata->shape1 = values[query_id].shape;
+    opdata->shape2 = values[value_id].shape;
+    for (uint32_t i = 0; i < node->num_inputs; i++) {
+      opdata->inputs[i] = node->inputs[i];
+    }
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_scaled_dot_product_attention_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const void* input_data[4] = { NULL, NULL, NULL, NULL };
+  for (uint32_t i = 0; i < opdata->num_inputs; i++) {
+    const uint32_t input_id = opdata->inputs[i];
+    assert(input_id != XNN_INVALID_VALUE_ID);
+    assert(input_id < num_blobs);
+
+    input_data[i] = blobs[input_id].data;
+    assert(input_data[i] != NULL);
+  }
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  const size_t batch_size = opdata->shape1.dim[0];
+  const size_t heads = opdata->shape1.dim[1];
+  const size_t query_tokens = opdata->shape1.dim[2];
+  const size_t channels = opdata->shape1.dim[3];
+  const size_t key_tokens = opdata->shape2.dim[2];
+  const size_t value_channels = opdata->shape2.dim[3];
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_scaled_dot_product_attention_nhtc_f32:
+      return xnn_setup_scaled_dot_product_attention_nhtc_f32(
+        opdata->operator_objects[0],
+        batch_size, heads, query_tokens, key_tokens, channels, value_channels,
+        input_data[0], input_data[1], input_data[2], input_data[3],
+        output_data,
+        threadpool);
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_scaled_dot_product_attention_nhtc_f16:
+      return xnn_setup_scaled_dot_product_attention_nhtc_f16(
+        opdata->operator_objects[0],
+        batch_size, heads, query_tokens, key_tokens, channels, value_channels,
+        input_data[0], input_data[1], input_data[2], input_data[3],
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status check_input(
+  xnn_subgraph_t subgraph,
+  const char* input_name,
+  uint32_t input_id,
+  size_t nth,
+  size_t num_dims)
+{
+  enum xnn_status status = xnn_subgraph_check_nth_input_node_id(
+    xnn_node_type_scaled_dot_product_attention, input_id, subgraph->num_values, nth);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_nth_input_type_dense(
+    xnn_node_type_scaled_dot_product_attention, input_id, input_value, nth);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with %s ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), input_name, input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with %s ID #%" PRIu32 ": %zu dimensions (expected %zu)",
+      xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), input_name, input_id,
+      input_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_scaled_dot_product_attention(
+  xnn_subgraph_t subgraph,
+  float scale,
+  uint32_t query_id,
+  uint32_t key_id,
+  uint32_t value_id,
+  uint32_t mask_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_scaled_dot_product_attention)) !=
+      xnn_status_success) {
+    return status;
+  }
+
+  if (scale <= 0.0f || !isnormal(scale)) {
+    xnn_log_error(
+      "failed to define %s operator with %.7g scale: scale must be finite, normalized, and positive",
+      xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), scale);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((status = check_input(subgraph, "query", query_id, 1, 4)) != xnn_status_success) {
+    return status;
+  }
+  if ((status = check_input(subgraph, "key", key_id, 2, 4)) != xnn_status_success) {
+    return status;
+  }
+  if ((status = check_input(subgraph, "value", value_id, 3, 4)) != xnn_status_success) {
+    return status;
+  }
+  if (mask_id != XNN_INVALID_VALUE_ID) {
+    if ((status = check_input(subgraph, "mask", mask_id, 4, 2)) != xnn_status_success) {
+      return status;
+    }
+  }
+
+  const struct xnn_shape* query_shape = &subgraph->values[query_id].shape;
+  const struct xnn_shape* key_shape = &subgraph->values[key_id].shape;
+  const struct xnn_shape* value_shape = &subgraph->values[value_id].shape;
+  if (key_shape->dim[0] != query_shape->dim[0] || key_shape->dim[1] != query_shape->dim[1] ||
+      key_shape->dim[3] != query_shape->dim[3])
+  {
+    xnn_log_error(
+      "failed to define %s operator with query ID #%" PRIu32 " and key ID #%" PRIu32 ": "
+      "batch size, number of heads, and number of channels must match",
+      xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), query_id, key_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (value_shape->dim[0] != key_shape->dim[0] || value_shape->dim[1] != key_shape->dim[1] ||
+      value_shape->dim[2] != key_shape->dim[2])
+  {
+    xnn_log_error(
+      "failed to define %s operator with key ID #%" PRIu32 " and value ID #%" PRIu32 ": "
+      "batch size, number of heads, and number of tokens must match",
+      xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), key_id, value_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((flags & XNN_FLAG_CAUSAL_ATTENTION) && key_shape->dim[2] < query_shape->dim[2]) {
+    xnn_log_error(
+      "failed to define %s operator with %zu query tokens and %zu key tokens: "
+      "causal attention requires at least as many key tokens as query tokens",
+      xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), query_shape->dim[2], key_shape->dim[2]);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (mask_id != XNN_INVALID_VALUE_ID) {
+    const struct xnn_shape* mask_shape = &subgraph->values[mask_id].shape;
+    if (mask_shape->dim[0] != query_shape->dim[2] || mask_shape->dim[1] != key_shape->dim[2]) {
+      xnn_log_error(
+        "failed to define %s operator with mask ID #%" PRIu32 ": "
+        "mask dimensions must match the number of query tokens (%zu) and key tokens (%zu)",
+        xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), mask_id,
+        query_shape->dim[2], key_shape->dim[2]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  status = xnn_subgraph_check_output_node_id(
+    xnn_node_type_scaled_dot_product_attention, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_scaled_dot_product_attention, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_shape* output_shape = &output_value->shape;
+  if (output_shape->num_dims != 4 ||
+      output_shape->dim[0] != query_shape->dim[0] || output_shape->dim[1] != query_shape->dim[1] ||
+      output_shape->dim[2] != query_shape->dim[2] || output_shape->dim[3] != value_shape->dim[3])
+  {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": "
+      "output shape must be [N, H, T, V] for [N, H, T, C] query and [N, H, S, V] value",
+      xnn_node_type_to_string(xnn_node_type_scaled_dot_product_attention), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_scaled_dot_product_attention;
+  node->compute_type = xnn_compute_type_fp32;
+  node->params.scaled_dot_product_attention.scale = scale;
+  node->num_inputs = mask_id == XNN_INVALID_VALUE_ID ? 3 : 4;
+  node->inputs[0] = query_id;
+  node->inputs[1] = key_id;
+  node->inputs[2] = value_id;
+  node->inputs[3] = mask_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_scaled_dot_product_attention_operator;
+  node->setup = setup_scaled_dot_product_attention_operator;
+
+  return xnn_status_success;
+}
@@ -0,0 +1,324 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_reduce_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_reduce_nd_f16(
+        node->params.reduce.reduce_operator,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_compute_type_fp32:
+      status = xnn_create_reduce_nd_f32(
+        node->params.reduce.reduce_operator,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+      status = xnn_create_reduce_nd_qs8(
+        node->params.reduce.reduce_operator,
+        (int8_t) values[input_id].quantization.zero_point,
+        values[input_id].quantization.scale,
+        (int8_t) values[output_id].quantization.zero_point,
+        values[output_id].quantization.scale,
+        node->flags,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    opdata->shape1 = values[input_id].shape;
+    opdata->num_reduction_axes = node->params.reduce.num_reduction_axes;
+    memcpy(opdata->reduction_axes, node->params.reduce.reduction_axes,
+      node->params.reduce.num_reduction_axes * sizeof(size_t));
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_reduce_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_reduce_nd_f16:
+      return xnn_setup_reduce_nd_f16(
+        opdata->operator_objects[0],
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_operator_type_reduce_nd_f32:
+      return xnn_setup_reduce_nd_f32(
+        opdata->operator_objects[0],
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_reduce_nd_qs8:
+      return xnn_setup_reduce_nd_qs8(
+        opdata->operator_objects[0],
+        opdata->num_reduction_axes,
+        opdata->reduction_axes,
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static enum xnn_status define_static_reduce(
+  xnn_subgraph_t subgraph,
+  enum xnn_reduce_operator reduce_operator,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_static_reduce)) != xnn_status_success) {
+    return status;
+  }
+
+  status = xnn_subgraph_check_input_node_id(xnn_node_type_static_reduce, input_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(xnn_node_type_static_reduce, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_static_reduce, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_static_reduce, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_static_reduce), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t num_input_dims = input_value->shape.num_dims;
+  if (num_reduction_axes > num_input_dims) {
+    xnn_log_error(
+      "failed to define %s operator with %zu reduction axes: the number of reduction axes must not exceed the number "
+      "of input dimensions (%zu)",
+      xnn_node_type_to_string(xnn_node_type_static_reduce), num_reduction_axes, num_input_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    if (reduction_axes[i] >= num_input_dims) {
+      xnn_log_error(
+        "failed to define %s operator with #%zu reduction axis of %zu: the index is out of bounds for a %zuD input shape",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), i, reduction_axes[i], num_input_dims);
+      return xnn_status_invalid_parameter;
+    }
+    if (i != 0 && reduction_axes[i] <= reduction_axes[i - 1]) {
+      xnn_log_error(
+        "failed to define %s operator with #%zu reduction axis of %zu: the reduction axes must be in increasing order",
+        xnn_node_type_to_string(xnn_node_type_static_reduce), i, reduction_axes[i]);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  // Output shape is the input shape with the reduction axes removed, or set to 1 with XNN_FLAG_KEEP_DIMS.
+  const bool keep_dims = (flags & XNN_FLAG_KEEP_DIMS) != 0;
+  const size_t num_output_dims = keep_dims ? num_input_dims : num_input_dims - num_reduction_axes;
+  bool valid_output_shape = output_value->shape.num_dims == num_output_dims;
+  for (size_t i = 0, axis = 0, output_dim = 0; valid_output_shape && i < num_input_dims; i++) {
+    const bool is_reduction_axis = axis < num_reduction_axes && reduction_axes[axis] == i;
+    if (is_reduction_axis) {
+      axis++;
+      if (keep_dims) {
+        valid_output_shape = output_value->shape.dim[output_dim++] == 1;
+      }
+    } else {
+      valid_output_shape = output_value->shape.dim[output_dim++] == input_value->shape.dim[i];
+    }
+  }
+  if (!valid_output_shape) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": output shape does not match the input shape with the reduction axes %s",
+      xnn_node_type_to_string(xnn_node_type_static_reduce), input_id, output_id,
+      keep_dims ? "set to 1" : "removed");
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_static_reduce;
+  node->compute_type = compute_type;
+  node->params.reduce.reduce_operator = reduce_operator;
+  node->params.reduce.num_reduction_axes = num_reduction_axes;
+  memcpy(node->params.reduce.reduction_axes, reduction_axes, num_reduction_axes * sizeof(size_t));
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_reduce_operator;
+  node->setup = setup_reduce_operator;
+
+  return xnn_status_success;
+}
+
+enum xnn_status xnn_define_static_reduce_sum(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_static_reduce(
+    subgraph, xnn_reduce_sum, num_reduction_axes, reduction_axes, input_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_static_reduce_mean(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_static_reduce(
+    subgraph, xnn_reduce_mean, num_reduction_axes, reduction_axes, input_id, output_id, flags);
+}
+
+enum xnn_status xnn_define_static_reduce_max(
+  xnn_subgraph_t subgraph,
+  size_t num_reduction_axes,
+  const size_t* reduction_axes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  return define_static_reduce(
+    subgraph, xnn_reduce_max, num_reduction_axes, reduction_axes, input_id, output_id, flags);
+}
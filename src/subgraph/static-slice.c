@@ -0,0 +1,325 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/normalization.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_slice_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  opdata->shape1 = *input_shape;
+  memcpy(opdata->offsets, node->params.static_slice.offsets, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
+  memcpy(opdata->sizes, node->params.static_slice.sizes, sizeof(size_t) * XNN_MAX_TENSOR_DIMS);
+  opdata->inputs[0] = input_id;
+  opdata->outputs[0] = output_id;
+
+  // A slice of a contiguous block of the input normalizes to a single dimension. Unless the output is external (and
+  // thus provided by the caller), it is represented as a view into the input and no operator is created.
+  if ((values[output_id].flags & XNN_VALUE_FLAG_EXTERNAL_OUTPUT) == 0) {
+    size_t num_normalized_dims = input_shape->num_dims;
+    size_t normalized_offsets[XNN_MAX_TENSOR_DIMS];
+    size_t normalized_sizes[XNN_MAX_TENSOR_DIMS];
+    size_t normalized_input_shape[XNN_MAX_TENSOR_DIMS];
+    memcpy(normalized_offsets, opdata->offsets, sizeof(size_t) * num_normalized_dims);
+    memcpy(normalized_sizes, opdata->sizes, sizeof(size_t) * num_normalized_dims);
+    memcpy(normalized_input_shape, input_shape->dim, sizeof(size_t) * num_normalized_dims);
+    xnn_normalize_slice(&num_normalized_dims, normalized_offsets, normalized_sizes, normalized_input_shape);
+    if (num_normalized_dims <= 1) {
+      size_t element_size = 0;
+      switch (node->compute_type) {
+        case xnn_compute_type_fp16:
+          element_size = sizeof(uint16_t);
+          break;
+        case xnn_compute_type_fp32:
+          element_size = sizeof(float);
+          break;
+        case xnn_compute_type_qs8:
+        case xnn_compute_type_qu8:
+          element_size = sizeof(uint8_t);
+          break;
+        default:
+          XNN_UNREACHABLE;
+      }
+      opdata->output_is_view = true;
+      opdata->view_offset = num_normalized_dims == 0 ? 0 : normalized_offsets[0] * element_size;
+      return xnn_status_success;
+    }
+  }
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_slice_nd_x16(node->flags, &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_compute_type_fp32:
+      status = xnn_create_slice_nd_x32(node->flags, &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_compute_type_qu8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+      status = xnn_create_slice_nd_x8(node->flags, &opdata->operator_objects[0]);
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  return status;
+}
+
+static enum xnn_status setup_slice_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+#if !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+    case xnn_operator_type_slice_nd_x8:
+      return xnn_setup_slice_nd_x8(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->offsets,
+        opdata->sizes,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS) || !defined(XNN_NO_QU8_OPERATORS)
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_slice_nd_x16:
+      return xnn_setup_slice_nd_x16(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->offsets,
+        opdata->sizes,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+    case xnn_operator_type_slice_nd_x32:
+      return xnn_setup_slice_nd_x32(
+        opdata->operator_objects[0],
+        opdata->shape1.num_dims,
+        opdata->shape1.dim,
+        opdata->offsets,
+        opdata->sizes,
+        input_data,
+        output_data,
+        threadpool);
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+enum xnn_status xnn_define_static_slice(
+  xnn_subgraph_t subgraph,
+  size_t num_dims,
+  const size_t* offsets,
+  const size_t* sizes,
+  uint32_t input_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_static_slice)) != xnn_status_success) {
+    return status;
+  }
+
+  status = xnn_subgraph_check_input_node_id(xnn_node_type_static_slice, input_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(xnn_node_type_static_slice, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->shape.num_dims != num_dims) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": number of input dimensions (%zu) does not match the "
+      "number of slice dimensions (%zu)",
+      xnn_node_type_to_string(xnn_node_type_static_slice), input_id, input_value->shape.num_dims, num_dims);
+    return xnn_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    const size_t input_dim = input_value->shape.dim[i];
+    if (sizes[i] == 0 || offsets[i] >= input_dim || sizes[i] > input_dim - offsets[i]) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": slice [%zu, %zu) in dimension #%zu is empty or "
+        "exceeds input dimension of %zu",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id, offsets[i], offsets[i] + sizes[i], i,
+        input_dim);
+      return xnn_status_invalid_parameter;
+    }
+  }
+
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_static_slice, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_static_slice, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  enum xnn_compute_type compute_type = xnn_compute_type_invalid;
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+      compute_type = xnn_compute_type_fp32;
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      compute_type = xnn_compute_type_qs8;
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+#ifndef XNN_NO_QU8_OPERATORS
+    case xnn_datatype_quint8:
+      compute_type = xnn_compute_type_qu8;
+      break;
+#endif  // !defined(XNN_NO_QU8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_static_slice), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (input_value->datatype != output_value->datatype) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s) and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_static_slice), input_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+#if !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+  if (output_value->datatype == xnn_datatype_qint8 || output_value->datatype == xnn_datatype_quint8) {
+    if (input_value->quantization.zero_point != output_value->quantization.zero_point) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching zero point quantization parameter across input (%"PRId32") and output (%"PRId32")",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id, output_id,
+        input_value->quantization.zero_point, output_value->quantization.zero_point);
+      return xnn_status_invalid_parameter;
+    }
+    if (input_value->quantization.scale != output_value->quantization.scale) {
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 " and output ID #%" PRIu32
+        ": mismatching scale quantization parameter across input (%.7g) and output (%.7g)",
+        xnn_node_type_to_string(xnn_node_type_static_slice), input_id, output_id,
+        input_value->quantization.scale, output_value->quantization.scale);
+      return xnn_status_invalid_parameter;
+    }
+  }
+#endif  // !defined(XNN_NO_QU8_OPERATORS) || !defined(XNN_NO_QS8_OPERATORS)
+
+  bool valid_output_shape = output_value->shape.num_dims == num_dims;
+  for (size_t i = 0; valid_output_shape && i < num_dims; i++) {
+    valid_output_shape = output_value->shape.dim[i] == sizes[i];
+  }
+  if (!valid_output_shape) {
+    xnn_log_error(
+      "failed to define %s operator with output ID #%" PRIu32 ": output shape does not match slice sizes",
+      xnn_node_type_to_string(xnn_node_type_static_slice), output_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  memcpy(node->params.static_slice.offsets, offsets, num_dims * sizeof(size_t));
+  memcpy(node->params.static_slice.sizes, sizes, num_dims * sizeof(size_t));
+
+  node->type = xnn_node_type_static_slice;
+  node->compute_type = compute_type;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_slice_operator;
+  node->setup = setup_slice_operator;
+
+  return xnn_status_success;
+}
@@ -0,0 +1,492 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_convolution_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs >= 2);
+  assert(node->num_inputs <= 3);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+  const uint32_t filter_id = node->inputs[1];
+  assert(filter_id != XNN_INVALID_VALUE_ID);
+  assert(filter_id < num_values);
+
+  assert(node->num_outputs == 1);
+  const uint32_t output_id = node->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_values);
+
+  const void* filter_data = values[filter_id].data;
+  assert(filter_data != NULL);
+
+  const void* bias_data = NULL;
+  if (node->num_inputs > 2) {
+    const uint32_t bias_id = node->inputs[2];
+    assert(bias_id != XNN_INVALID_VALUE_ID);
+    assert(bias_id < num_values);
+
+    bias_data = values[bias_id].data;
+    assert(bias_data != NULL);
+  }
+
+  const size_t input_channel_stride =
+    node->params.streaming_convolution_1d.group_input_channels * node->params.streaming_convolution_1d.groups;
+  const size_t output_channel_stride =
+    node->params.streaming_convolution_1d.group_output_channels * node->params.streaming_convolution_1d.groups;
+
+  enum xnn_status status;
+  switch (node->compute_type) {
+    case xnn_compute_type_fp32:
+      status = xnn_create_streaming_convolution1d_nwc_f32(
+        node->params.streaming_convolution_1d.kernel_size,
+        node->params.streaming_convolution_1d.dilation,
+        node->params.streaming_convolution_1d.groups,
+        node->params.streaming_convolution_1d.group_input_channels,
+        node->params.streaming_convolution_1d.group_output_channels,
+        input_channel_stride,
+        output_channel_stride,
+        filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags,
+        caches,
+        &opdata->operator_objects[0]);
+      break;
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_compute_type_fp16:
+      status = xnn_create_streaming_convolution1d_nwc_f16(
+        node->params.streaming_convolution_1d.kernel_size,
+        node->params.streaming_convolution_1d.dilation,
+        node->params.streaming_convolution_1d.groups,
+        node->params.streaming_convolution_1d.group_input_channels,
+        node->params.streaming_convolution_1d.group_output_channels,
+        input_channel_stride,
+        output_channel_stride,
+        filter_data,
+        bias_data,
+        node->activation.output_min,
+        node->activation.output_max,
+        node->flags | XNN_FLAG_FP32_STATIC_WEIGHTS,
+        NULL,
+        &opdata->operator_objects[0]);
+      break;
+#endif  // XNN_NO_F16_OPERATORS
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_compute_type_qs8:
+    {
+      const float output_scale = values[output_id].quantization.scale;
+      const int32_t output_zero_point = values[output_id].quantization.zero_point;
+      const int8_t output_min =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_min / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      const int8_t output_max =
+        (int8_t) lrintf(fminf(fmaxf(node->activation.output_max / output_scale + (float) output_zero_point, -128.0f), 127.0f));
+      status = xnn_create_streaming_convolution1d_nwc_qs8(
+        node->params.streaming_convolution_1d.kernel_size,
+        node->params.streaming_convolution_1d.dilation,
+        node->params.streaming_convolution_1d.groups,
+        node->params.streaming_convolution_1d.group_input_channels,
+        node->params.streaming_convolution_1d.group_output_channels,
+        input_channel_stride,
+        output_channel_stride,
+        (int8_t) values[input_id].quantization.zero_point,
+        values[input_id].quantization.scale,
+        values[filter_id].quantization.scale,
+        filter_data,
+        bias_data,
+        (int8_t) output_zero_point,
+        output_scale, output_min, output_max,
+        node->flags,
+        NULL,
+        &opdata->operator_objects[0]);
+      break;
+    }
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  if (status == xnn_status_success) {
+    opdata->batch_size = values[input_id].shape.dim[0];
+    opdata->input_width = values[input_id].shape.dim[1];
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_convolution_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_id = opdata->outputs[0];
+  assert(output_id != XNN_INVALID_VALUE_ID);
+  assert(output_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const void* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_blob = blobs + output_id;
+  void* output_data = output_blob->data;
+  assert(output_data != NULL);
+
+  switch (opdata->operator_objects[0]->type) {
+    case xnn_operator_type_streaming_convolution_nwc_f32:
+      return xnn_setup_streaming_convolution1d_nwc_f32(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+#ifndef XNN_NO_F16_OPERATORS
+    case xnn_operator_type_streaming_convolution_nwc_f16:
+      return xnn_setup_streaming_convolution1d_nwc_f16(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_F16_OPERATORS)
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_operator_type_streaming_convolution_nwc_qs8:
+      return xnn_setup_streaming_convolution1d_nwc_qs8(
+        opdata->operator_objects[0],
+        opdata->batch_size,
+        opdata->input_width,
+        input_data,
+        output_data,
+        threadpool);
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+}
+
+static inline enum xnn_compute_type validate_datatypes(
+  enum xnn_datatype input_datatype,
+  enum xnn_datatype filter_datatype,
+  enum xnn_datatype bias_datatype,
+  enum xnn_datatype output_datatype)
+{
+  switch (filter_datatype) {
+    case xnn_datatype_fp32:
+      if (input_datatype == xnn_datatype_fp32 &&
+          (bias_datatype == xnn_datatype_invalid || bias_datatype == xnn_datatype_fp32) &&
+          output_datatype == xnn_datatype_fp32)
+      {
+        return xnn_compute_type_fp32;
+      }
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      if (input_datatype == xnn_datatype_qint8 &&
+          (bias_datatype == xnn_datatype_invalid || bias_datatype == xnn_datatype_qint32) &&
+          output_datatype == xnn_datatype_qint8)
+      {
+        return xnn_compute_type_qs8;
+      }
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      XNN_UNREACHABLE;
+  }
+  return xnn_compute_type_invalid;
+}
+
+enum xnn_status xnn_define_streaming_convolution_1d(
+  xnn_subgraph_t subgraph,
+  uint32_t kernel_size,
+  uint32_t dilation,
+  uint32_t groups,
+  size_t group_input_channels,
+  size_t group_output_channels,
+  float output_min,
+  float output_max,
+  uint32_t input_id,
+  uint32_t filter_id,
+  uint32_t bias_id,
+  uint32_t output_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_streaming_convolution_1d)) != xnn_status_success) {
+    return status;
+  }
+
+  if (kernel_size == 0) {
+    xnn_log_error(
+      "failed to define %s operator with %" PRIu32 " kernel size: kernel size must be non-zero",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), kernel_size);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (dilation == 0) {
+    xnn_log_error(
+      "failed to define %s operator with %" PRIu32 " dilation: dilation must be non-zero",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), dilation);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (groups == 0) {
+    xnn_log_error(
+      "failed to define %s operator with %" PRIu32 " groups: number of groups must be non-zero",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), groups);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (group_input_channels == 0) {
+    xnn_log_error(
+      "failed to define %s operator with %zu input channels per group: number of channels must be non-zero",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), group_input_channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (group_output_channels == 0) {
+    xnn_log_error(
+      "failed to define %s operator with %zu output channels per group: number of channels must be non-zero",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), group_output_channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_min)) {
+    xnn_log_error(
+      "failed to define %s operator with NaN output lower bound: lower bound must be non-NaN",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (isnan(output_max)) {
+    xnn_log_error(
+      "failed to define %s operator with NaN output upper bound: upper bound must be non-NaN",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d));
+    return xnn_status_invalid_parameter;
+  }
+
+  if (output_min >= output_max) {
+    xnn_log_error(
+      "failed to define %s operator with [%.7g, %.7g] output range: lower bound must be below upper bound",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), output_min, output_max);
+    return xnn_status_invalid_parameter;
+  }
+
+  const uint32_t supported_flags = XNN_FLAG_DEPTHWISE_CONVOLUTION;
+  const uint32_t invalid_flags = flags & ~supported_flags;
+  if (invalid_flags != 0) {
+    xnn_log_error(
+      "failed to define %s operator with 0x%08" PRIx32 " flags: invalid flags 0x%08" PRIx32,
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), flags, invalid_flags);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((flags & XNN_FLAG_DEPTHWISE_CONVOLUTION) != 0 && group_input_channels != 1) {
+    xnn_log_error(
+      "failed to define depthwise %s operator with %zu input channels per group: "
+      "depthwise convolution must have exactly 1 input channel per group",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), group_input_channels);
+    return xnn_status_invalid_parameter;
+  }
+
+  if ((status = xnn_subgraph_check_input_node_id(xnn_node_type_streaming_convolution_1d, input_id, subgraph->num_values)) !=
+      xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(xnn_node_type_streaming_convolution_1d, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (input_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), input_id,
+        xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  if (filter_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to define %s operator with filter ID #%" PRIu32 ": invalid Value ID",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), filter_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* filter_value = &subgraph->values[filter_id];
+  if (filter_value->type != xnn_value_type_dense_tensor) {
+    xnn_log_error(
+      "failed to define %s operator with filter ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), filter_id, filter_value->type);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (filter_value->data == NULL) {
+    xnn_log_error(
+      "failed to define %s operator with filter ID #%" PRIu32 ": non-static Value",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), filter_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  switch (filter_value->datatype) {
+    case xnn_datatype_fp32:
+      break;
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+      if (filter_value->quantization.zero_point != 0) {
+        xnn_log_error(
+          "failed to define %s operator with filter ID #%" PRIu32 ": unsupported quantization zero point %" PRId32 " for datatype %s",
+          xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), filter_id,
+          filter_value->quantization.zero_point, xnn_datatype_to_string(filter_value->datatype));
+        return xnn_status_invalid_parameter;
+      }
+      break;
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+    default:
+      xnn_log_error(
+        "failed to define %s operator with filter ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), filter_id,
+        xnn_datatype_to_string(filter_value->datatype), filter_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_value* bias_value = NULL;
+  if (bias_id != XNN_INVALID_VALUE_ID) {
+    if (bias_id >= subgraph->num_values) {
+      xnn_log_error(
+        "failed to define %s operator with bias ID #%" PRIu32 ": invalid Value ID",
+        xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), bias_id);
+      return xnn_status_invalid_parameter;
+    }
+
+    bias_value = &subgraph->values[bias_id];
+    if (bias_value->type != xnn_value_type_dense_tensor) {
+      xnn_log_error(
+        "failed to define %s operator with bias ID #%" PRIu32 ": unsupported Value type %d (expected dense tensor)",
+        xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), bias_id, bias_value->type);
+      return xnn_status_invalid_parameter;
+    }
+
+    if (bias_value->data == NULL) {
+      xnn_log_error(
+        "failed to define %s operator with bias ID #%" PRIu32 ": non-static Value",
+        xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), bias_id);
+      return xnn_status_invalid_parameter;
+    }
+
+    switch (bias_value->datatype) {
+      case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+      case xnn_datatype_qint32:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+        break;
+      default:
+        xnn_log_error(
+          "failed to define %s operator with bias ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+          xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), bias_id,
+          xnn_datatype_to_string(bias_value->datatype), bias_value->datatype);
+        return xnn_status_invalid_parameter;
+    }
+  }
+
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_streaming_convolution_1d, output_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_value = &subgraph->values[output_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_streaming_convolution_1d, output_id, output_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  switch (output_value->datatype) {
+    case xnn_datatype_fp32:
+#ifndef XNN_NO_QS8_OPERATORS
+    case xnn_datatype_qint8:
+#endif  // !defined(XNN_NO_QS8_OPERATORS)
+      break;
+    default:
+      xnn_log_error(
+        "failed to define %s operator with output ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+        xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), output_id,
+        xnn_datatype_to_string(output_value->datatype), output_value->datatype);
+      return xnn_status_invalid_parameter;
+  }
+
+  const enum xnn_compute_type compute_type = validate_datatypes(
+    input_value->datatype, filter_value->datatype,
+    bias_value != NULL ? bias_value->datatype : xnn_datatype_invalid,
+    output_value->datatype);
+  if (compute_type == xnn_compute_type_invalid) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ", filter ID #%" PRIu32 ", and output ID #%" PRIu32
+      ": mismatching datatypes across input (%s), filter (%s), and output (%s)",
+      xnn_node_type_to_string(xnn_node_type_streaming_convolution_1d), input_id, filter_id, output_id,
+      xnn_datatype_to_string(input_value->datatype),
+      xnn_datatype_to_string(filter_value->datatype),
+      xnn_datatype_to_string(output_value->datatype));
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_streaming_convolution_1d;
+  node->compute_type = compute_type;
+  node->params.streaming_convolution_1d.kernel_size = kernel_size;
+  node->params.streaming_convolution_1d.dilation = dilation;
+  node->params.streaming_convolution_1d.groups = groups;
+  node->params.streaming_convolution_1d.group_input_channels = group_input_channels;
+  node->params.streaming_convolution_1d.group_output_channels = group_output_channels;
+  node->activation.output_min = output_min;
+  node->activation.output_max = output_max;
+  node->num_inputs = 2 + (size_t) (bias_id != XNN_INVALID_VALUE_ID);
+  node->inputs[0] = input_id;
+  node->inputs[1] = filter_id;
+  node->inputs[2] = bias_id;
+  node->num_outputs = 1;
+  node->outputs[0] = output_id;
+  node->flags = flags;
+
+  node->create = create_convolution_operator;
+  node->setup = setup_convolution_operator;
+
+  return xnn_status_success;
+}
@@ -0,0 +1,224 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack.h>
+#include <xnnpack/log.h>
+#include <xnnpack/operator.h>
+#include <xnnpack/params.h>
+#include <xnnpack/subgraph.h>
+#include <xnnpack/subgraph-validation.h>
+
+
+static enum xnn_status create_topk_operator(
+  const struct xnn_node* node,
+  const struct xnn_value* values,
+  size_t num_values,
+  struct xnn_operator_data* opdata,
+  const struct xnn_caches* caches)
+{
+  assert(node->num_inputs == 1);
+  const uint32_t input_id = node->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_values);
+
+  assert(node->num_outputs == 2);
+  const uint32_t output_values_id = node->outputs[0];
+  assert(output_values_id != XNN_INVALID_VALUE_ID);
+  assert(output_values_id < num_values);
+  const uint32_t output_indices_id = node->outputs[1];
+  assert(output_indices_id != XNN_INVALID_VALUE_ID);
+  assert(output_indices_id < num_values);
+
+  const struct xnn_shape* input_shape = &values[input_id].shape;
+  const size_t channel_dim = input_shape->dim[input_shape->num_dims - 1];
+
+  assert(node->compute_type == xnn_compute_type_fp32);
+  const enum xnn_status status = xnn_create_topk_nc_f32(
+    channel_dim /* channels */, channel_dim /* input stride */,
+    node->params.topk.k,
+    node->flags,
+    &opdata->operator_objects[0]);
+  if (status == xnn_status_success) {
+    opdata->batch_size = xnn_shape_multiply_non_channel_dims(input_shape);
+    opdata->inputs[0] = input_id;
+    opdata->outputs[0] = output_values_id;
+    opdata->outputs[1] = output_indices_id;
+  }
+  return status;
+}
+
+static enum xnn_status setup_topk_operator(
+  const struct xnn_operator_data* opdata,
+  const struct xnn_blob* blobs,
+  size_t num_blobs,
+  pthreadpool_t threadpool)
+{
+  const uint32_t input_id = opdata->inputs[0];
+  assert(input_id != XNN_INVALID_VALUE_ID);
+  assert(input_id < num_blobs);
+
+  const uint32_t output_values_id = opdata->outputs[0];
+  assert(output_values_id != XNN_INVALID_VALUE_ID);
+  assert(output_values_id < num_blobs);
+
+  const uint32_t output_indices_id = opdata->outputs[1];
+  assert(output_indices_id != XNN_INVALID_VALUE_ID);
+  assert(output_indices_id < num_blobs);
+
+  const struct xnn_blob* input_blob = blobs + input_id;
+  const float* input_data = input_blob->data;
+  assert(input_data != NULL);
+
+  const struct xnn_blob* output_values_blob = blobs + output_values_id;
+  float* output_values_data = output_values_blob->data;
+  assert(output_values_data != NULL);
+
+  const struct xnn_blob* output_indices_blob = blobs + output_indices_id;
+  int32_t* output_indices_data = output_indices_blob->data;
+  assert(output_indices_data != NULL);
+
+  assert(opdata->operator_objects[0]->type == xnn_operator_type_topk_nc_f32);
+  return xnn_setup_topk_nc_f32(
+    opdata->operator_objects[0],
+    opdata->batch_size,
+    input_data,
+    output_values_data,
+    output_indices_data,
+    threadpool);
+}
+
+enum xnn_status xnn_define_topk(
+  xnn_subgraph_t subgraph,
+  size_t k,
+  uint32_t input_id,
+  uint32_t output_values_id,
+  uint32_t output_indices_id,
+  uint32_t flags)
+{
+  enum xnn_status status;
+  if ((status = xnn_subgraph_check_xnnpack_initialized(xnn_node_type_topk)) != xnn_status_success) {
+    return status;
+  }
+
+  if ((status = xnn_subgraph_check_input_node_id(xnn_node_type_topk, input_id, subgraph->num_values)) !=
+      xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* input_value = &subgraph->values[input_id];
+  status = xnn_subgraph_check_input_type_dense(xnn_node_type_topk, input_id, input_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (input_value->datatype != xnn_datatype_fp32) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(xnn_node_type_topk), input_id,
+      xnn_datatype_to_string(input_value->datatype), input_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  const struct xnn_shape* input_shape = &input_value->shape;
+  if (input_shape->num_dims == 0) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ": input must have at least 1 dimension",
+      xnn_node_type_to_string(xnn_node_type_topk), input_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  const size_t channel_dim = input_shape->dim[input_shape->num_dims - 1];
+  if (k == 0 || k > channel_dim) {
+    xnn_log_error(
+      "failed to define %s operator with k of %zu: k must be in [1, %zu] range",
+      xnn_node_type_to_string(xnn_node_type_topk), k, channel_dim);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Check the output values.
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_topk, output_values_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_values_value = &subgraph->values[output_values_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_topk, output_values_id, output_values_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_values_value->datatype != xnn_datatype_fp32) {
+    xnn_log_error(
+      "failed to define %s operator with output values ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(xnn_node_type_topk), output_values_id,
+      xnn_datatype_to_string(output_values_value->datatype), output_values_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Check the output indices.
+  status = xnn_subgraph_check_output_node_id(xnn_node_type_topk, output_indices_id, subgraph->num_values);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  const struct xnn_value* output_indices_value = &subgraph->values[output_indices_id];
+  status = xnn_subgraph_check_output_type_dense(xnn_node_type_topk, output_indices_id, output_indices_value);
+  if (status != xnn_status_success) {
+    return status;
+  }
+
+  if (output_indices_value->datatype != xnn_datatype_int32) {
+    xnn_log_error(
+      "failed to define %s operator with output indices ID #%" PRIu32 ": unsupported Value datatype %s (%d)",
+      xnn_node_type_to_string(xnn_node_type_topk), output_indices_id,
+      xnn_datatype_to_string(output_indices_value->datatype), output_indices_value->datatype);
+    return xnn_status_invalid_parameter;
+  }
+
+  // Both outputs have the input shape with the innermost dimension replaced by k.
+  const struct xnn_shape* output_values_shape = &output_values_value->shape;
+  const struct xnn_shape* output_indices_shape = &output_indices_value->shape;
+  const size_t num_dims = input_shape->num_dims;
+  bool valid_output_shapes = output_values_shape->num_dims == num_dims && output_indices_shape->num_dims == num_dims &&
+    output_values_shape->dim[num_dims - 1] == k && output_indices_shape->dim[num_dims - 1] == k;
+  for (size_t i = 0; valid_output_shapes && i + 1 < num_dims; i++) {
+    valid_output_shapes = output_values_shape->dim[i] == input_shape->dim[i] &&
+      output_indices_shape->dim[i] == input_shape->dim[i];
+  }
+  if (!valid_output_shapes) {
+    xnn_log_error(
+      "failed to define %s operator with input ID #%" PRIu32 ", output values ID #%" PRIu32
+      ", and output indices ID #%" PRIu32 ": output shapes do not match the input shape with the innermost dimension "
+      "of %zu",
+      xnn_node_type_to_string(xnn_node_type_topk), input_id, output_values_id, output_indices_id, k);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_node* node = xnn_subgraph_new_node(subgraph);
+  if (node == NULL) {
+    return xnn_status_out_of_memory;
+  }
+
+  node->type = xnn_node_type_topk;
+  node->compute_type = xnn_compute_type_fp32;
+  node->params.topk.k = k;
+  node->num_inputs = 1;
+  node->inputs[0] = input_id;
+  node->num_outputs = 2;
+  node->outputs[0] = output_values_id;
+  node->outputs[1] = output_indices_id;
+  node->flags = flags;
+
+  node->create = create_topk_operator;
+  node->setup = setup_topk_operator;
+
+  return xnn_status_success;
+}
@@ -48,6 +48,8 @@ enum xnn_status xnn_define_tensor_value(
   switch (datatype) {
     case xnn_datatype_fp32:
     case xnn_datatype_fp16:
+    case xnn_datatype_bf16:
+    case xnn_datatype_int32:
       break;
     default:
       xnn_log_error("failed to create Dense Tensor value: unsupported datatype %s (%d)",
@@ -174,6 +176,23 @@ enum xnn_status xnn_define_channelwise_quantized_tensor_value(
     uint32_t external_id,
     uint32_t flags,
     uint32_t* id_out)
+{
+  return xnn_define_channelwise_quantized_tensor_value_v2(
+    subgraph, datatype, 0 /* zero point */, scale, num_dims, channel_dim, dims, data, external_id, flags, id_out);
+}
+
+enum xnn_status xnn_define_channelwise_quantized_tensor_value_v2(
+    xnn_subgraph_t subgraph,
+    enum xnn_datatype datatype,
+    int32_t zero_point,
+    const float* scale,
+    size_t num_dims,
+    size_t channel_dim,
+    const size_t* dims,
+    const void* data,
+    uint32_t external_id,
+    uint32_t flags,
+    uint32_t* id_out)
 {
   if ((xnn_params.init_flags & XNN_INIT_FLAG_XNNPACK) == 0) {
     xnn_log_error("failed to create Channelwise Quantized Dense Tensor value: XNNPACK is not initialized");
@@ -210,8 +229,24 @@ enum xnn_status xnn_define_channelwise_quantized_tensor_value(
   }
 
   switch (datatype) {
+    case xnn_datatype_qcint4:
+      if (zero_point < 0 || zero_point > 15) {
+        xnn_log_error(
+          "failed to create Channelwise Quantized Dense Tensor value with %" PRId32 " zero point: "
+          "zero point must be in [0, 15] range for %s datatype",
+          zero_point, xnn_datatype_to_string(datatype));
+        return xnn_status_invalid_parameter;
+      }
+      break;
     case xnn_datatype_qcint8:
     case xnn_datatype_qcint32:
+      if (zero_point != 0) {
+        xnn_log_error(
+          "failed to create Channelwise Quantized Dense Tensor value with %" PRId32 " zero point: "
+          "zero point must be 0 for %s datatype",
+          zero_point, xnn_datatype_to_string(datatype));
+        return xnn_status_invalid_parameter;
+      }
       break;
     default:
       xnn_log_error("failed to create Channelwise Quantized Dense Tensor value: unsupported datatype %s (%d)",
@@ -239,7 +274,7 @@ enum xnn_status xnn_define_channelwise_quantized_tensor_value(
   }
   value->type = xnn_value_type_dense_tensor;
   value->datatype = datatype;
-  value->quantization.zero_point = 0;
+  value->quantization.zero_point = zero_point;
   value->quantization.channelwise_scale = scale;
   value->quantization.channel_dimension = channel_dim;
   value->shape.num_dims = num_dims;
@@ -251,6 +286,44 @@ enum xnn_status xnn_define_channelwise_quantized_tensor_value(
   return xnn_status_success;
 }
 
+enum xnn_status xnn_set_subgraph_value_range(
+    xnn_subgraph_t subgraph,
+    uint32_t value_id,
+    float min,
+    float max)
+{
+  if (value_id >= subgraph->num_values) {
+    xnn_log_error(
+      "failed to set range of Value #%" PRIu32 ": Value ID exceeds the number of Values in subgraph (%" PRIu32 ")",
+      value_id, subgraph->num_values);
+    return xnn_status_invalid_parameter;
+  }
+
+  struct xnn_value* value = &subgraph->values[value_id];
+  if (value->type != xnn_value_type_dense_tensor || value->datatype != xnn_datatype_fp32) {
+    xnn_log_error(
+      "failed to set range of Value #%" PRIu32 ": only FP32 Dense Tensor Values are supported", value_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (value->data != NULL) {
+    xnn_log_error("failed to set range of Value #%" PRIu32 ": Value is static", value_id);
+    return xnn_status_invalid_parameter;
+  }
+
+  if (!isfinite(min) || !isfinite(max) || min > max) {
+    xnn_log_error(
+      "failed to set range of Value #%" PRIu32 " to [%.7g, %.7g]: bounds must be finite and ordered",
+      value_id, min, max);
+    return xnn_status_invalid_parameter;
+  }
+
+  value->has_range = true;
+  value->range_min = min;
+  value->range_max = max;
+  return xnn_status_success;
+}
+
 size_t xnn_tensor_get_size(
   xnn_subgraph_t subgraph,
   uint32_t value_id)
@@ -264,6 +337,7 @@ size_t xnn_tensor_get_size(
   size_t size = 0;
   switch (value->datatype) {
     case xnn_datatype_fp16:
+    case xnn_datatype_bf16:
       size = 2;
       break;
     case xnn_datatype_fp32:
@@ -276,8 +350,19 @@ size_t xnn_tensor_get_size(
       break;
     case xnn_datatype_qint32:
     case xnn_datatype_qcint32:
+    case xnn_datatype_int32:
       size = 4;
       break;
+    case xnn_datatype_qcint4:
+    {
+      // Two elements per byte, with every row along the last dimension padded to a whole byte.
+      assert(value->shape.num_dims != 0);
+      size = (value->shape.dim[value->shape.num_dims - 1] + 1) / 2;
+      for (size_t i = 0; i + 1 < value->shape.num_dims; i++) {
+        size *= value->shape.dim[i];
+      }
+      return size;
+    }
     case xnn_datatype_invalid:
       XNN_UNREACHABLE;
   }
@@ -13,7 +13,7 @@
 
 #include <xnnpack/ukernel-type.h>
 
-static const uint16_t offset[] = {0,8,24,39,46,51,57,83,88,98};
+static const uint16_t offset[] = {0,8,24,39,46,51,57,83,88,98,108};
 
 static const char *data =
     "Default\0"
@@ -26,9 +26,10 @@ static const char *data =
     "SPMM\0"
     "Subconv2D\0"
     "VMulCAddC\0"
+    "Winograd\0"
 ;
 
 const char* xnn_ukernel_type_to_string(enum xnn_ukernel_type type) {
-  assert(type <= xnn_ukernel_type_vmulcaddc);
+  assert(type <= xnn_ukernel_type_winograd);
   return &data[offset[type]];
 }
\ No newline at end of file
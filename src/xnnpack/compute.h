@@ -6,6 +6,7 @@
 #pragma once
 
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -181,9 +182,11 @@ struct gemm_context {
   struct xnn_hmp_gemm_ukernel ukernel;
   union {
     union xnn_qs8_conv_minmax_params qs8;
+    union xnn_qs8_minmax_params qc8;
     union xnn_qu8_conv_minmax_params qu8;
     union xnn_f16_scaleminmax_params f16;
     union xnn_f32_minmax_params f32;
+    union xnn_f32_qc4w_minmax_params f32_qc4w;
   } params;
 };
 
@@ -223,6 +226,186 @@ struct gemm_context {
   #endif  // XNN_MAX_UARCH_TYPES > 1
 #endif
 
+// Context for cache-blocked F32 GEMM.
+// The reduction dimension is split into KC-sized blocks: the first block is computed with the regular GEMM
+// micro-kernel into the accumulator workspace, the following blocks accumulate into it with the GEMMINC micro-kernel,
+// and the last block writes the clamped result to the output.
+struct blocked_gemm_context {
+  // Size of the reduction dimension, in bytes.
+  size_t k_scaled;
+  // Size of a reduction block, in bytes. Multiple of KR * SR elements.
+  size_t kc_scaled;
+  const void* a;
+  size_t a_stride;
+  const void* packed_w;
+  // Stride of packed weights per output channel, in bytes.
+  size_t w_stride;
+  // Size of the bias per NR-block of packed weights, in bytes.
+  size_t w_bias_size;
+  void* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  // Accumulators, stored as contiguous MR x NR tiles.
+  void* acc;
+  // Stride between accumulator tiles of adjacent MR-blocks, in bytes.
+  size_t acc_m_stride;
+  // Stride between accumulator tiles of adjacent NR-blocks, in bytes.
+  size_t acc_n_stride;
+  uint32_t mr;
+  uint32_t nr;
+  xnn_gemm_ukernel_function ukernel;
+  xnn_f32_gemminc_minmax_ukernel_function inc_ukernel;
+  union xnn_f32_minmax_params params;
+  // Parameters with infinite bounds, used when writing intermediate accumulators.
+  union xnn_f32_minmax_params acc_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_blocked_gemm(
+      const struct blocked_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t nr_block_start,
+      size_t mr_block_start,
+      size_t nr_block_size,
+      size_t mr_block_size);
+#endif
+
+// Context for split-K F32 GEMM.
+// The reduction dimension is split into KC-sized slices, and every slice computes a partial product into a separate
+// buffer: the partial product of the first slice includes the bias, partial products of other slices start from zero.
+// Partial products are then added up, and the sum is clamped into the output.
+struct splitk_gemm_context {
+  // Size of the reduction dimension, in bytes.
+  size_t k_scaled;
+  // Size of a reduction slice, in bytes. Multiple of KR * SR elements.
+  size_t kc_scaled;
+  const void* a;
+  size_t a_stride;
+  const void* packed_w;
+  // Stride of packed weights per output channel, in bytes.
+  size_t w_stride;
+  // Size of the bias per NR-block of packed weights, in bytes.
+  size_t w_bias_size;
+  // Number of output channels.
+  size_t n;
+  size_t num_slices;
+  void* partial;
+  size_t partial_slice_stride;
+  size_t partial_m_stride;
+  // MR x NR tile of zero accumulators.
+  const void* zero;
+  void* c;
+  size_t cm_stride;
+  uint32_t mr;
+  uint32_t nr;
+  xnn_gemm_ukernel_function ukernel;
+  xnn_f32_gemminc_minmax_ukernel_function inc_ukernel;
+  xnn_vbinary_ukernel_function vadd_ukernel;
+  // GEMM parameters with infinite bounds.
+  union xnn_f32_minmax_params gemm_params;
+  // VADD parameters with the output bounds.
+  union xnn_f32_minmax_params params;
+  // VADD parameters with infinite bounds, used when adding up intermediate partial products.
+  union xnn_f32_minmax_params acc_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_splitk_gemm(
+      const struct splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t slice_index,
+      size_t mr_block_start,
+      size_t mr_block_size);
+
+  XNN_PRIVATE void xnn_compute_splitk_reduce(
+      const struct splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t channel_start,
+      size_t channel_size);
+#endif
+
+// Context for split-K QS8/QC8 GEMM.
+// Every KC-sized slice of the reduction dimension computes 32-bit partial products into a separate buffer, without the
+// bias. Partial products are then added up with the bias, and the sum is requantized into the output.
+struct qs8_splitk_gemm_context {
+  // Size of the reduction dimension, in elements.
+  size_t k;
+  // Size of a reduction slice, in elements. Multiple of KR * SR.
+  size_t kc;
+  const int8_t* a;
+  size_t a_stride;
+  const void* packed_w;
+  // Stride of packed weights per output channel, in bytes.
+  size_t w_stride;
+  // Offset of per-channel requantization scales in an NR-block of packed weights, in bytes, or 0 if the operator uses
+  // a per-tensor requantization scale.
+  size_t w_scale_offset;
+  // Number of output channels.
+  size_t n;
+  size_t num_slices;
+  int32_t* partial;
+  size_t partial_slice_stride;
+  size_t partial_m_stride;
+  int8_t* c;
+  size_t cm_stride;
+  uint32_t nr;
+  xnn_qs8_gemm_acc32_ukernel_function ukernel;
+  union xnn_qs8_conv_minmax_params params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_qs8_splitk_gemm(
+      const struct qs8_splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t slice_index,
+      size_t mr_block_start,
+      size_t mr_block_size);
+
+  XNN_PRIVATE void xnn_compute_qs8_splitk_reduce(
+      const struct qs8_splitk_gemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t channel_start,
+      size_t channel_size);
+#endif
+
+// Context for GEMM with dynamically quantized inputs.
+// Every row of the FP32 input is quantized into the int8 workspace with its own scale and zero point, then the int8
+// GEMM micro-kernel computes FP32 outputs using the per-row quantization parameters and per-channel weight scales.
+struct dqgemm_context {
+  // Size of the reduction dimension, in bytes of the quantized input.
+  size_t k_scaled;
+  const void* a;
+  size_t a_stride;
+  // Quantized input, with rows stored qa_stride bytes apart.
+  void* qa;
+  size_t qa_stride;
+  // Quantization parameters of input rows. Padded with MR - 1 extra entries, which micro-kernels may read.
+  struct xnn_qd8_quantization_params* quantization_params;
+  const void* packed_w;
+  size_t w_stride;
+  void* c;
+  size_t cm_stride;
+  size_t cn_stride;
+  xnn_dqgemm_ukernel_function ukernel;
+  xnn_f32_rminmax_ukernel_function rminmax_ukernel;
+  xnn_univector_ukernel_function convert_ukernel;
+  xnn_init_f32_qs8_cvt_params_fn init_convert_params;
+  union {
+    union xnn_f32_minmax_params f32_minmax;
+    union xnn_f32_qc4w_minmax_params f32_qc4w_minmax;
+  } params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_f32_qd8_convert(
+      const struct dqgemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+
+  XNN_PRIVATE void xnn_compute_dqgemm(
+      const struct dqgemm_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t mr_block_start,
+      size_t nr_block_start,
+      size_t mr_block_size,
+      size_t nr_block_size);
+#endif
+
 // Context for Sparse Matrix-Dense Matrix Multiplication.
 // C [MxN] := A [MxK] * B [KxN] + bias [N]
 // A and C are dense matrices with row-major storage, B is a sparse matrix.
@@ -362,6 +545,57 @@ struct igemm_context {
   #endif  // XNN_MAX_UARCH_TYPES > 1
 #endif
 
+struct winograd_context {
+  // Tiles are processed in blocks: the input transform, the 16 GEMMs, and the output transform of a block run back to
+  // back on a per-slot buffer, so transformed tiles stay in cache and the workspace does not grow with the image size.
+  size_t tiles;
+  size_t tile_block;
+  size_t num_slots;
+  size_t slot_stride;
+  // Input transform: 4x4 input tiles -> 16 transformed rows per tile.
+  size_t input_height;
+  size_t input_width;
+  const void* input;
+  size_t input_pixel_stride;
+  size_t input_batch_stride;
+  size_t input_channels;
+  size_t input_padding_top;
+  size_t input_padding_left;
+  const void* zero;
+  size_t tiles_height;
+  size_t tiles_width;
+  void* workspace;
+  size_t transformed_input_tile_stride;
+  size_t transformed_input_position_stride;
+  xnn_f32_winograd_input_ukernel_function input_ukernel;
+  // Batched GEMM: one GEMM per transformed position.
+  size_t mr;
+  size_t output_channels;
+  const void* packed_w;
+  size_t packed_w_position_stride;
+  size_t transformed_output_offset;
+  size_t transformed_output_tile_stride;
+  size_t transformed_output_position_stride;
+  size_t cn_stride;
+  struct xnn_hmp_gemm_ukernel gemm_ukernel;
+  union xnn_f32_minmax_params gemm_params;
+  // Output transform: 16 transformed rows per tile -> 2x2 output tile.
+  const void* bias;
+  size_t output_height;
+  size_t output_width;
+  void* output;
+  size_t output_pixel_stride;
+  size_t output_batch_stride;
+  xnn_f32_winograd_output_ukernel_function output_ukernel;
+  union xnn_f32_minmax_params output_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_winograd(
+      const struct winograd_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t slot);
+#endif
+
 struct subgemm_context {
   const struct subconvolution_params* subconvolution_params;
   size_t kc;
@@ -690,6 +924,7 @@ struct average_pooling_context {
   size_t input_increment;
   size_t output_increment;
   union {
+    union xnn_qs8_avgpool_minmax_params qs8;
     union xnn_qu8_avgpool_minmax_params qu8;
     union xnn_f32_scaleminmax_params f32;
   } params;
@@ -863,6 +1098,70 @@ struct resize_bilinear_chw_context {
     size_t pixel_range);
 #endif
 
+struct resize_nearest_neighbor_context {
+  // Number of channels multiplied by sizeof(input element).
+  size_t scaled_channels;
+  // Pointer to the input tensor.
+  const void* input;
+  // Stride, in bytes, between images of consecutive batches in the input.
+  size_t input_batch_stride;
+  // Offsets, in bytes, of the nearest input row for each output row.
+  const size_t* input_row_offsets;
+  // Offsets, in bytes, of the nearest input pixel within a row for each output column.
+  const size_t* input_pixel_offsets;
+  // Pointer to the output tensor.
+  void* output;
+  // Number of pixels in an output row.
+  size_t output_width;
+  // Stride, in bytes, between adjacent pixels in the output.
+  size_t output_pixel_stride;
+  // Stride, in bytes, between images of consecutive batches in the output.
+  size_t output_batch_stride;
+  // Pointer to COPY micro-kernel function.
+  xnn_univector_ukernel_function copy_ukernel;
+};
+
+struct resize_nearest_neighbor_chw_context {
+  // Pointer to the input tensor.
+  const void* input;
+  // Stride, in bytes, between adjacent channels in the input.
+  size_t input_channel_stride;
+  // Stride, in bytes, between images of consecutive batches in the input.
+  size_t input_batch_stride;
+  // Offsets, in bytes, of the nearest input row for each output row.
+  const size_t* input_row_offsets;
+  // Offsets, in bytes, of the nearest input element within a row for each output column.
+  const size_t* input_pixel_offsets;
+  // Pointer to the output tensor.
+  void* output;
+  // Number of rows and columns in an output image plane.
+  size_t output_height;
+  size_t output_width;
+  // Stride, in bytes, between consecutive channels of an output image.
+  size_t output_channel_stride;
+  // Stride, in bytes, between images of consecutive batches in the output.
+  size_t output_batch_stride;
+  // Integer horizontal upscaling factor, or 0 if output columns do not map onto input columns as x / factor.
+  size_t width_scale;
+  // log2(sizeof(element)).
+  uint32_t log2_element_size;
+  // Pointer to COPY micro-kernel function.
+  xnn_univector_ukernel_function copy_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_resize_nearest_neighbor(
+      const struct resize_nearest_neighbor_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t output_y_start,
+      size_t output_y_range);
+  XNN_PRIVATE void xnn_compute_resize_nearest_neighbor_chw(
+      const struct resize_nearest_neighbor_chw_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t channel_start,
+      size_t channel_range);
+#endif
+
 struct elementwise_binary_context {
   const void* a;
   size_t a_stride[XNN_MAX_TENSOR_DIMS - 1];
@@ -876,6 +1175,7 @@ struct elementwise_binary_context {
     union xnn_qu8_addsub_minmax_params qu8_addsub;
     union xnn_qs8_mul_minmax_params qs8_mul;
     union xnn_qu8_mul_minmax_params qu8_mul;
+    union xnn_qs8_binary_minmax_params qs8_binary;
     union xnn_f16_minmax_params f16;
     union xnn_f32_minmax_params f32;
   } params;
@@ -951,15 +1251,23 @@ struct univector_strided_context {
   size_t y_stride;
   xnn_univector_ukernel_function ukernel;
   union {
+    union xnn_f16_exp_params f16_exp;
     union xnn_f16_f32_cvt_params f16_f32_cvt;
+    union xnn_f16_gelu_params f16_gelu;
     union xnn_f16_hswish_params f16_hswish;
+    union xnn_f16_log_params f16_log;
     union xnn_f16_lrelu_params f16_lrelu;
     union xnn_f16_sigmoid_params f16_sigmoid;
+    union xnn_f16_silu_params f16_silu;
+    union xnn_f16_tanh_params f16_tanh;
     union xnn_f32_abs_params f32_abs;
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
+    union xnn_f32_exp_params f32_exp;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
+    union xnn_f32_gelu_params f32_gelu;
     union xnn_f32_hswish_params f32_hswish;
+    union xnn_f32_log_params f32_log;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_minmax_params f32_minmax;
     union xnn_f32_neg_params f32_neg;
@@ -967,8 +1275,12 @@ struct univector_strided_context {
     union xnn_f32_qu8_cvt_params f32_qu8_cvt;
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
+    union xnn_f32_silu_params f32_silu;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     union xnn_qs8_f32_cvt_params qs8_f32_cvt;
+    union xnn_qs8_hswish_params qs8_hswish;
+    union xnn_qs8_lrelu_params qs8_lrelu;
     union xnn_qu8_f32_cvt_params qu8_f32_cvt;
     union xnn_s8_minmax_params s8_minmax;
     union xnn_u8_minmax_params u8_minmax;
@@ -989,13 +1301,21 @@ struct univector_contiguous_context {
   uint16_t log2_ysize;
   xnn_univector_ukernel_function ukernel;
   union {
+    union xnn_f16_exp_params f16_exp;
     union xnn_f16_f32_cvt_params f16_f32_cvt;
+    union xnn_f16_gelu_params f16_gelu;
     union xnn_f16_hswish_params f16_hswish;
+    union xnn_f16_log_params f16_log;
+    union xnn_f16_silu_params f16_silu;
+    union xnn_f16_tanh_params f16_tanh;
     union xnn_f32_abs_params f32_abs;
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
+    union xnn_f32_exp_params f32_exp;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
+    union xnn_f32_gelu_params f32_gelu;
     union xnn_f32_hswish_params f32_hswish;
+    union xnn_f32_log_params f32_log;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_minmax_params f32_minmax;
     union xnn_f32_neg_params f32_neg;
@@ -1003,8 +1323,12 @@ struct univector_contiguous_context {
     union xnn_f32_qu8_cvt_params f32_qu8_cvt;
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
+    union xnn_f32_silu_params f32_silu;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     union xnn_qs8_f32_cvt_params qs8_f32_cvt;
+    union xnn_qs8_hswish_params qs8_hswish;
+    union xnn_qs8_lrelu_params qs8_lrelu;
     union xnn_qu8_f32_cvt_params qu8_f32_cvt;
     union xnn_s8_minmax_params s8_minmax;
     union xnn_u8_minmax_params u8_minmax;
@@ -1056,6 +1380,38 @@ struct vmulcaddc_context {
       size_t batch_size);
 #endif
 
+struct streaming_convolution_context {
+  // Context of the convolution over the window of history and new frames. It must be the first member: the convolution
+  // compute functions receive a pointer to the streaming context.
+  union {
+    struct gemm_context gemm;
+    struct igemm_context igemm;
+    struct dwconv_context dwconv;
+    struct vmulcaddc_context vmulcaddc;
+  } convolution;
+  const void* input;
+  size_t input_frame_stride;
+  size_t input_batch_stride;
+  // History of every batch element is a ring buffer of history_frames frames, and state_heads holds the index of the
+  // oldest frame in every ring buffer.
+  void* state;
+  size_t state_batch_stride;
+  size_t* state_heads;
+  void* window;
+  size_t window_frame_stride;
+  size_t window_batch_stride;
+  // Size in bytes of the channels of one frame.
+  size_t frame_size;
+  size_t history_frames;
+  size_t input_frames;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_streaming_convolution_window(
+      const struct streaming_convolution_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+#endif
+
 struct pad_context {
   const void* input;
   size_t input_stride[XNN_MAX_TENSOR_DIMS - 1];
@@ -1076,20 +1432,35 @@ struct pad_context {
       size_t i, size_t j, size_t k, size_t l, size_t m);
 #endif
 
-struct u8_softmax_context {
+struct slice_context {
+  xnn_univector_ukernel_function ukernel;
+  const void* input;
+  size_t input_stride[XNN_MAX_TENSOR_DIMS - 1];
+  void* output;
+  size_t output_stride[XNN_MAX_TENSOR_DIMS - 1];
+  // Size in bytes of the innermost contiguous run of sliced elements.
+  size_t contiguous_size;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_slice_5d(
+      const struct slice_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t i, size_t j, size_t k, size_t l, size_t m);
+#endif
+
+struct quantized_softmax_context {
   size_t n;
-  const uint8_t* x;
+  const void* x;
   size_t x_stride;
   const uint32_t* t;
-  uint8_t* y;
+  void* y;
   size_t y_stride;
-  xnn_u8_rmax_ukernel_function rmax_ukernel;
-  xnn_u8_lut32norm_ukernel_function lut_norm_ukernel;
+  xnn_softmax_ukernel_function ukernel;
 };
 
 #ifndef __cplusplus
-  XNN_PRIVATE void xnn_compute_u8_softmax(
-      const struct u8_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
+  XNN_PRIVATE void xnn_compute_quantized_softmax(
+      const struct quantized_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
       size_t batch_index);
 #endif
 
@@ -1120,3 +1491,248 @@ struct floating_point_softmax_context {
       const struct floating_point_softmax_context context[restrict XNN_MIN_ELEMENTS(1)],
       size_t batch_index);
 #endif
+
+struct layer_normalization_context {
+  size_t n;
+  const void* x;
+  size_t x_stride;
+  const void* gamma;
+  const void* beta;
+  void* y;
+  size_t y_stride;
+  float epsilon;
+  xnn_rmoments_ukernel_function rmoments_ukernel;
+  xnn_vlayernorm_ukernel_function vlayernorm_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_layer_normalization(
+      const struct layer_normalization_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+#endif
+
+typedef float (*xnn_compute_to_fp32_function)(const void* input);
+typedef void (*xnn_compute_from_fp32_function)(float input, void* output);
+
+struct scaled_dot_product_attention_context {
+  size_t query_tokens;
+  size_t key_tokens;
+  size_t channels;
+  size_t value_channels;
+  uint32_t log2_element_size;
+  bool causal;
+  const void* q;
+  size_t q_head_stride;
+  const void* k;
+  size_t k_head_stride;
+  const void* v;
+  size_t v_head_stride;
+  // Optional additive mask of [query_tokens][key_tokens] elements, shared by all heads.
+  const void* mask;
+  size_t mask_stride;
+  void* o;
+  size_t o_head_stride;
+  size_t mr;
+  size_t nr;
+  size_t kr;
+  size_t sr;
+  // Number of keys processed in one step of the online softmax (multiple of nr).
+  size_t key_tile;
+  void* packed_k;
+  size_t packed_k_head_stride;
+  size_t packed_k_tile_stride;
+  void* packed_v;
+  size_t packed_v_head_stride;
+  size_t packed_v_tile_stride;
+  void* scratch;
+  size_t scratch_head_stride;
+  size_t scratch_tile_stride;
+  xnn_pack_gemm_goi_w_function pack_gemm_goi_w;
+  xnn_pack_gemm_io_w_function pack_gemm_io_w;
+  xnn_gemm_ukernel_function gemm_ukernel;
+  xnn_rmax_ukernel_function rmax_ukernel;
+  xnn_raddstoreexpminusmax_ukernel_function raddstoreexpminusmax_ukernel;
+  xnn_vbinary_ukernel_function vadd_ukernel;
+  xnn_vbinary_ukernel_function vmulc_ukernel;
+  xnn_compute_to_fp32_function to_fp32;
+  xnn_compute_from_fp32_function from_fp32;
+  union {
+    uint16_t as_half;
+    float as_float;
+  } scale;
+  union {
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } gemm_params;
+  union {
+    union xnn_f16_expminus_params f16;
+    union xnn_f32_expminus_params f32;
+  } expminus_params;
+  union {
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } minmax_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_scaled_dot_product_attention_pack(
+      const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t head_index);
+
+  XNN_PRIVATE void xnn_compute_scaled_dot_product_attention(
+      const struct scaled_dot_product_attention_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t head_index,
+      size_t query_tile_index);
+#endif
+
+// Reduction over a normalized 6D input shape where reduced and kept dimensions alternate. In the contiguous case the
+// innermost dimension is reduced, and dimensions 1, 3, 5 are reduced. In the discontiguous case the innermost dimension
+// is kept, and dimensions 0, 2, 4 are reduced.
+struct reduce_context {
+  const void* input;
+  void* output;
+  // FP32 accumulators with the same layout as the output, or NULL if the output is FP32 and accumulates in-place.
+  float* accumulators;
+  // FP32 scratch space with the same layout as the output for input rows converted to FP32. Used only in the
+  // discontiguous reduction of FP16 and QS8 inputs.
+  float* scratch;
+  size_t input_shape[XNN_MAX_TENSOR_DIMS];
+  // Strides of the input dimensions, in bytes.
+  size_t input_stride[XNN_MAX_TENSOR_DIMS];
+  // Strides of the two outer kept dimensions in the output, in elements. The innermost kept dimension is contiguous.
+  size_t output_stride[2];
+  uint32_t log2_input_element_size;
+  uint32_t log2_output_element_size;
+  // Reciprocal of the number of reduced elements for the mean, 1.0 otherwise.
+  float scale;
+  // Zero point of QS8 input, multiplied by the number of elements in the innermost dimension for the sum.
+  int32_t zero_point_correction;
+  bool compute_max;
+  // Micro-kernels for the contiguous reduction. Exactly one of them is set.
+  xnn_rsum_ukernel_function rsum_ukernel;
+  xnn_qs8_rsum_ukernel_function qs8_rsum_ukernel;
+  xnn_rmax_ukernel_function rmax_ukernel;
+  xnn_compute_to_fp32_function to_fp32;
+  // U8 RMAX micro-kernel for the maximum of QS8 rows, with the sign bit of the elements flipped.
+  xnn_u8_rmax_ukernel_function u8_rmax_ukernel;
+  // Micro-kernels for the discontiguous reduction: element-wise FP32 addition or maximum, and multiplication by scale.
+  xnn_vbinary_ukernel_function vbinary_ukernel;
+  xnn_vbinary_ukernel_function vmulc_ukernel;
+  // Conversion of input rows to FP32 and of FP32 accumulators to the output datatype, NULL for FP32 operators.
+  xnn_univector_ukernel_function cvt_input_ukernel;
+  xnn_univector_ukernel_function cvt_output_ukernel;
+  // Parameters of the element-wise micro-kernels: default parameters for the maximum, unbounded minmax otherwise.
+  union {
+    union xnn_f32_default_params f32_default;
+    union xnn_f32_minmax_params f32_minmax;
+  } vbinary_params;
+  union {
+    union xnn_f16_f32_cvt_params f16_f32_cvt;
+    union xnn_qs8_f32_cvt_params qs8_f32_cvt;
+  } cvt_input_params;
+  union {
+    union xnn_f32_f16_cvt_params f32_f16_cvt;
+    union xnn_f32_qs8_cvt_params f32_qs8_cvt;
+  } cvt_output_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_contiguous_reduce(
+      const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t output_idx0,
+      size_t output_idx1,
+      size_t output_idx2,
+      size_t output1_block_size,
+      size_t output2_block_size);
+
+  XNN_PRIVATE void xnn_compute_discontiguous_reduce(
+      const struct reduce_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t output_idx0,
+      size_t output_idx1,
+      size_t output_idx2,
+      size_t output1_block_size,
+      size_t output2_block_size);
+#endif
+
+// Context for ArgMax and TopK operators. Every row is split into blocks of up to block_size elements, and the first
+// pass finds the k largest elements of each block, using the RMAX micro-kernel to scan for the maximum and to skip
+// chunks of elements which cannot enter the k largest. NaN orders above all other values, and the RSUM micro-kernel
+// detects NaN in a chunk, because RMAX micro-kernels may ignore it. With several blocks per row, the candidates of each block are
+// written to the partial buffers, and the second pass merges them into the output. With a single block per row, the
+// first pass writes the output directly.
+struct topk_context {
+  const void* input;
+  // Stride, in bytes, between consecutive rows of the input.
+  size_t input_stride;
+  // Number of elements in a row.
+  size_t channels;
+  // Number of elements in a block. At least k.
+  size_t block_size;
+  size_t num_blocks;
+  size_t k;
+  uint32_t log2_element_size;
+  // Datatype of the input elements: FP32, FP16, or QINT8.
+  enum xnn_datatype datatype;
+  // Candidate values (converted to FP32) and indices, k for every block of every row.
+  float* partial_values;
+  int32_t* partial_indices;
+  // Largest values of every row, k per row. NULL for the ArgMax operator.
+  float* output_values;
+  // Indices of the largest values of every row, k per row.
+  int32_t* output_indices;
+  xnn_rmax_ukernel_function rmax_ukernel;
+  xnn_u8_rmax_ukernel_function u8_rmax_ukernel;
+  xnn_f16_rsum_ukernel_function f16_rsum_ukernel;
+  xnn_f32_rsum_ukernel_function f32_rsum_ukernel;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_topk(
+      const struct topk_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index,
+      size_t block_index);
+
+  XNN_PRIVATE void xnn_compute_topk_merge(
+      const struct topk_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_index);
+#endif
+
+struct embedding_lookup_context {
+  const void* table;
+  // Number of rows in the table. Indices are checked against it at run time, because they may be produced by other
+  // operators after setup.
+  size_t num_embeddings;
+  // Set to true when an index is out of range. Output rows for out-of-range indices are filled with zeros.
+  bool* invalid_indices;
+  // Size of a row of the table and of the output, in bytes.
+  size_t row_size;
+  const int32_t* indices;
+  void* output;
+  // Number of indices reduced to a single output row by Embedding Bag operators.
+  size_t bag_size;
+  xnn_univector_ukernel_function copy_ukernel;
+  // Micro-kernels for Embedding Bag operators: element-wise addition of rows, and multiplication by the scale of the
+  // mean. The multiplication is skipped if vmulc_ukernel is NULL.
+  xnn_vbinary_ukernel_function vadd_ukernel;
+  xnn_vbinary_ukernel_function vmulc_ukernel;
+  union {
+    uint16_t f16;
+    float f32;
+  } scale;
+  union {
+    union xnn_f16_minmax_params f16;
+    union xnn_f32_minmax_params f32;
+  } minmax_params;
+};
+
+#ifndef __cplusplus
+  XNN_PRIVATE void xnn_compute_embedding_lookup(
+      const struct embedding_lookup_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_start,
+      size_t batch_range);
+
+  XNN_PRIVATE void xnn_compute_embedding_bag(
+      const struct embedding_lookup_context context[restrict XNN_MIN_ELEMENTS(1)],
+      size_t batch_start,
+      size_t batch_range);
+#endif
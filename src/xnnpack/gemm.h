@@ -193,6 +193,11 @@ DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemm_minmax_ukernel_6x16__avx51
 DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemm_minmax_ukernel_7x16__avx512f_broadcast)
 DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemm_minmax_ukernel_8x16__avx512f_broadcast)
 
+DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm)
+DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm)
+DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm)
+DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm)
+
 DECLARE_F32_GEMM_UKERNEL_FUNCTION(xnn_f32_gemm_ukernel_1x8__wasmsimd_loadsplat)
 DECLARE_F32_GEMM_UKERNEL_FUNCTION(xnn_f32_gemm_ukernel_3x8__wasmsimd_loadsplat)
 DECLARE_F32_GEMM_UKERNEL_FUNCTION(xnn_f32_gemm_ukernel_4x8__wasmsimd_loadsplat)
@@ -374,6 +379,71 @@ DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemm_minmax_ukernel_4x2__scalar
 DECLARE_F32_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_gemm_minmax_ukernel_4x4__scalar)
 
 
+#define DECLARE_F32_F16W_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                   \
+      size_t mr,                                               \
+      size_t nr,                                               \
+      size_t k,                                                \
+      const float* a,                                          \
+      size_t a_stride,                                         \
+      const void* w,                                           \
+      float* c,                                                \
+      size_t cm_stride,                                        \
+      size_t cn_stride,                                        \
+      const union xnn_f32_minmax_params* params);
+
+DECLARE_F32_F16W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_f16w_gemm_minmax_ukernel_1x16__fma3_broadcast)
+DECLARE_F32_F16W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_f16w_gemm_minmax_ukernel_5x16__fma3_broadcast)
+
+
+#define DECLARE_BF16_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                              \
+      size_t mr,                                          \
+      size_t nr,                                          \
+      size_t k,                                           \
+      const void* a,                                      \
+      size_t a_stride,                                    \
+      const void* w,                                      \
+      void* c,                                            \
+      size_t cm_stride,                                   \
+      size_t cn_stride,                                   \
+      const union xnn_f32_minmax_params* params);
+
+DECLARE_BF16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast)
+DECLARE_BF16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast)
+
+DECLARE_BF16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_bf16_gemm_minmax_ukernel_1x4__scalar)
+DECLARE_BF16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_bf16_gemm_minmax_ukernel_4x4__scalar)
+
+
+#define DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                   \
+      size_t mr,                                               \
+      size_t nr,                                               \
+      size_t k,                                                \
+      const float* a,                                          \
+      size_t a_stride,                                         \
+      const void* w,                                           \
+      float* c,                                                \
+      size_t cm_stride,                                        \
+      size_t cn_stride,                                        \
+      const union xnn_f32_qc4w_minmax_params* params);
+
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_1x8__neon_lane_ld64)
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_4x8__neon_lane_ld64)
+
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_1x8__neonfma_lane_ld64)
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_4x8__neonfma_lane_ld64)
+
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_1x16__avx2_broadcast)
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_3x16__avx2_broadcast)
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_4x16__avx2_broadcast)
+
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_1x4__scalar)
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_2x4__scalar)
+DECLARE_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_qc4w_gemm_minmax_ukernel_4x4__scalar)
+
+
 #define DECLARE_F32_GEMMINC_MINMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                                 \
       size_t mr,                                             \
@@ -626,6 +696,8 @@ DECLARE_F16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_gemm_minmax_ukernel_5x16__avx2_
 DECLARE_F16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_gemm_minmax_ukernel_6x8__avx2_broadcast)
 DECLARE_F16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_gemm_minmax_ukernel_7x8__avx2_broadcast)
 
+DECLARE_F16_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_f16_gemv_minmax_ukernel_1x16__avx2_broadcast_acc4_prfm)
+
 
 #define DECLARE_QU8_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                              \
@@ -893,6 +965,31 @@ DECLARE_QU8_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qu8_gemm_minmax_fp32_ukernel_4x2__s
 DECLARE_QU8_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qu8_gemm_minmax_fp32_ukernel_4x4__scalar_lrintf)
 
 
+#define DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                             \
+      size_t mr,                                         \
+      size_t nr,                                         \
+      size_t k,                                          \
+      const int8_t* a,                                   \
+      size_t a_stride,                                   \
+      const void* w,                                     \
+      int32_t* c,                                        \
+      size_t cm_stride);
+
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2)
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2)
+
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41)
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41)
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41)
+
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2)
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2)
+
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx)
+DECLARE_QS8_GEMM_ACC32_UKERNEL_FUNCTION(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx)
+
+
 #define DECLARE_QS8_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                              \
       size_t mr,                                          \
@@ -1536,6 +1633,54 @@ DECLARE_QS8_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qs8_gemm_minmax_fp32_ukernel_4x2__s
 DECLARE_QS8_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qs8_gemm_minmax_fp32_ukernel_4x4__scalar_lrintf)
 
 
+#define DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                       \
+      size_t mr,                                                   \
+      size_t nr,                                                   \
+      size_t k,                                                    \
+      const int8_t* a,                                             \
+      size_t a_stride,                                             \
+      const void* w,                                               \
+      float* c,                                                    \
+      size_t cm_stride,                                            \
+      size_t cn_stride,                                            \
+      const union xnn_f32_minmax_params* params,                   \
+      const struct xnn_qd8_quantization_params* quantization_params);
+
+DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x8c8__avx2)
+DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc8w_gemm_minmax_ukernel_2x8c8__avx2)
+DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc8w_gemm_minmax_ukernel_3x8c8__avx2)
+DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc8w_gemm_minmax_ukernel_4x8c8__avx2)
+
+DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc8w_gemm_minmax_ukernel_1x4__scalar)
+DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc8w_gemm_minmax_ukernel_2x4__scalar)
+DECLARE_QD8_F32_QC8W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc8w_gemm_minmax_ukernel_4x4__scalar)
+
+
+#define DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                       \
+      size_t mr,                                                   \
+      size_t nr,                                                   \
+      size_t k,                                                    \
+      const int8_t* a,                                             \
+      size_t a_stride,                                             \
+      const void* w,                                               \
+      float* c,                                                    \
+      size_t cm_stride,                                            \
+      size_t cn_stride,                                            \
+      const union xnn_f32_qc4w_minmax_params* params,              \
+      const struct xnn_qd8_quantization_params* quantization_params);
+
+DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc4w_gemm_minmax_ukernel_1x8c8__avx2)
+DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc4w_gemm_minmax_ukernel_2x8c8__avx2)
+DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc4w_gemm_minmax_ukernel_3x8c8__avx2)
+DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc4w_gemm_minmax_ukernel_4x8c8__avx2)
+
+DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc4w_gemm_minmax_ukernel_1x4__scalar)
+DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc4w_gemm_minmax_ukernel_2x4__scalar)
+DECLARE_QD8_F32_QC4W_GEMM_MINMAX_UKERNEL_FUNCTION(xnn_qd8_f32_qc4w_gemm_minmax_ukernel_4x4__scalar)
+
+
 #define DECLARE_QC8_GEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                              \
       size_t mr,                                          \
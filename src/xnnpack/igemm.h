@@ -377,6 +377,25 @@ DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x2__scal
 DECLARE_F32_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_igemm_minmax_ukernel_4x4__scalar)
 
 
+#define DECLARE_F32_F16W_IGEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                    \
+      size_t mr,                                                \
+      size_t nr,                                                \
+      size_t kc,                                                \
+      size_t ks,                                                \
+      const float** a,                                          \
+      const void* w,                                            \
+      float* c,                                                 \
+      size_t cm_stride,                                         \
+      size_t cn_stride,                                         \
+      size_t a_offset,                                          \
+      const float* zero,                                        \
+      const union xnn_f32_minmax_params* params);
+
+DECLARE_F32_F16W_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_f16w_igemm_minmax_ukernel_1x16__fma3_broadcast)
+DECLARE_F32_F16W_IGEMM_MINMAX_UKERNEL_FUNCTION(xnn_f32_f16w_igemm_minmax_ukernel_5x16__fma3_broadcast)
+
+
 #define DECLARE_F16_IGEMM_MINMAX_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                               \
       size_t mr,                                           \
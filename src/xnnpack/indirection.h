@@ -24,6 +24,11 @@ XNN_INTERNAL void xnn_indirection_init_conv2d(
   size_t output_tile_size,
   uint32_t log2_element_size);
 
+XNN_INTERNAL void xnn_indirection_init_conv3d(
+  xnn_operator_t op,
+  size_t output_tile_size,
+  uint32_t log2_element_size);
+
 XNN_INTERNAL void xnn_indirection_init_dwconv2d(
   xnn_operator_t op,
   size_t step_height,
@@ -46,6 +51,18 @@ XNN_INTERNAL void xnn_indirection_init_maxpool2d(
   size_t step_width,
   uint32_t log2_element_size);
 
+XNN_INTERNAL void xnn_indirection_init_maxpool3d(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width,
+  uint32_t log2_element_size);
+
+XNN_INTERNAL void xnn_indirection_init_avgpool3d(
+  xnn_operator_t op,
+  size_t step_height,
+  size_t step_width,
+  uint32_t log2_element_size);
+
 typedef void (*xnn_indirection_init_resize_bilinear2d_hwc_fn)(
   size_t input_pixel_stride,
   size_t input_height,
@@ -106,6 +123,17 @@ XNN_INTERNAL void xnn_indirection_init_resize_bilinear2d_chw_f32(
   bool align_corners,
   bool tensorflow_legacy);
 
+XNN_INTERNAL void xnn_indirection_init_resize_nearest_neighbor2d(
+  size_t input_pixel_stride,
+  size_t input_height,
+  size_t input_width,
+  size_t output_height,
+  size_t output_width,
+  size_t* input_row_offsets,
+  size_t* input_pixel_offsets,
+  bool align_corners,
+  bool tensorflow_legacy);
+
 XNN_INTERNAL void xnn_indirection_init_unpool2d(
   xnn_operator_t op,
   size_t batch_start,
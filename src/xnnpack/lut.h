@@ -69,6 +69,34 @@ DECLARE_X8_LUT_UKERNEL_FUNCTION(xnn_x8_lut_ukernel__wasmsimd_x64)
       uint8_t* y);
 
 DECLARE_U8_LUT32NORM_UKERNEL_FUNCTION(xnn_u8_lut32norm_ukernel__scalar)
+DECLARE_U8_LUT32NORM_UKERNEL_FUNCTION(xnn_u8_lut32norm_ukernel__neon)
+DECLARE_U8_LUT32NORM_UKERNEL_FUNCTION(xnn_u8_lut32norm_ukernel__avx2)
+
+
+// Softmax of a row with a 256-entry exp table: t[i] holds the scaled exp((i - 255) * input_scale), and the maximum
+// element of the row is looked up in the last entry.
+#define DECLARE_QS8_SOFTMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                          \
+      size_t n,                                       \
+      const int8_t* x,                                \
+      const uint32_t* t,                              \
+      int8_t* y);
+
+DECLARE_QS8_SOFTMAX_UKERNEL_FUNCTION(xnn_qs8_softmax_ukernel__scalar)
+DECLARE_QS8_SOFTMAX_UKERNEL_FUNCTION(xnn_qs8_softmax_ukernel__neon)
+DECLARE_QS8_SOFTMAX_UKERNEL_FUNCTION(xnn_qs8_softmax_ukernel__avx2)
+
+
+#define DECLARE_QU8_SOFTMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                          \
+      size_t n,                                       \
+      const uint8_t* x,                               \
+      const uint32_t* t,                              \
+      uint8_t* y);
+
+DECLARE_QU8_SOFTMAX_UKERNEL_FUNCTION(xnn_qu8_softmax_ukernel__scalar)
+DECLARE_QU8_SOFTMAX_UKERNEL_FUNCTION(xnn_qu8_softmax_ukernel__neon)
+DECLARE_QU8_SOFTMAX_UKERNEL_FUNCTION(xnn_qu8_softmax_ukernel__avx2)
 
 
 #ifdef __cplusplus
@@ -131,6 +131,31 @@ XNN_INLINE static float math_nonsign_mask_f32() {
   #endif
 }
 
+// Widens a bfloat16 number, stored as its bit representation, to single-precision floating-point.
+XNN_INLINE static float math_cvt_fp32_bf16(uint16_t x) {
+  union {
+    uint32_t as_word;
+    float as_float;
+  } f;
+  f.as_word = (uint32_t) x << 16;
+  return f.as_float;
+}
+
+// Narrows a single-precision floating-point number to bfloat16 with rounding to nearest-even, and returns the bit
+// representation of the result. NaN inputs produce quiet NaN outputs.
+XNN_INLINE static uint16_t math_cvt_bf16_fp32(float x) {
+  union {
+    uint32_t as_word;
+    float as_float;
+  } f;
+  f.as_float = x;
+  const uint32_t w = f.as_word;
+  if XNN_UNLIKELY((w & UINT32_C(0x7FFFFFFF)) > UINT32_C(0x7F800000)) {
+    return (uint16_t) ((w >> 16) | UINT32_C(0x0040));
+  }
+  return (uint16_t) ((w + UINT32_C(0x7FFF) + ((w >> 16) & UINT32_C(1))) >> 16);
+}
+
 
 #if defined(__clang__)
   #if __clang_major__ == 3 && __clang_minor__ >= 7 || __clang_major__ > 3
@@ -186,6 +211,17 @@ XNN_INLINE static uint32_t math_ctz_u32(uint32_t x) {
   #endif
 }
 
+XNN_INLINE static uint32_t math_clz_nonzero_u32(uint32_t x) {
+  assert(x != 0);
+  #ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse(&index, (unsigned long) x);
+    return (uint32_t) index ^ 31;
+  #else
+    return (uint32_t) __builtin_clz((unsigned int) x);
+  #endif
+}
+
 XNN_INLINE static uint32_t math_rotl_u32(uint32_t x, int8_t r)
 {
   #if XNN_COMPILER_MSVC
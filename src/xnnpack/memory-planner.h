@@ -53,6 +53,12 @@ inline static void xnn_release_value_allocation_tracker(struct xnn_value_allocat
 XNN_INTERNAL void xnn_add_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
                                                    uint32_t value_id, size_t tensor_size);
 
+// Mark the xnn_value referred by 'view_value_id' as a view into the memory of the xnn_value referred by
+// 'base_value_id': the view is not allocated on its own, and the base value is kept alive while the view is in use.
+// Note: the view must not be added to the tracker, and chains of views must be marked in reverse execution order.
+XNN_INTERNAL void xnn_add_view_allocation_tracker(struct xnn_value_allocation_tracker* tracker,
+                                                  uint32_t view_value_id, uint32_t base_value_id);
+
 // Plan the exact the memory allocation for intermediate tensors according to the xnn_value allocation tracker.
 XNN_INTERNAL void xnn_plan_value_allocation_tracker(struct xnn_value_allocation_tracker* tracker);
 
@@ -9,8 +9,10 @@ enum xnn_node_type {
   xnn_node_type_invalid = 0,
   xnn_node_type_abs,
   xnn_node_type_add2,
+  xnn_node_type_argmax,
   xnn_node_type_argmax_pooling_2d,
   xnn_node_type_average_pooling_2d,
+  xnn_node_type_average_pooling_3d,
   xnn_node_type_bankers_rounding,
   xnn_node_type_ceiling,
   xnn_node_type_clamp,
@@ -19,33 +21,48 @@ enum xnn_node_type {
   xnn_node_type_concatenate4,
   xnn_node_type_convert,
   xnn_node_type_convolution_2d,
+  xnn_node_type_convolution_3d,
   xnn_node_type_deconvolution_2d,
   xnn_node_type_depthwise_convolution_2d,
   xnn_node_type_depth_to_space,
   xnn_node_type_divide,
   xnn_node_type_elu,
+  xnn_node_type_embedding_lookup,
+  xnn_node_type_exp,
   xnn_node_type_fully_connected,
   xnn_node_type_floor,
+  xnn_node_type_gelu,
   xnn_node_type_global_average_pooling_2d,
   xnn_node_type_hardswish,
+  xnn_node_type_layer_normalization,
   xnn_node_type_leaky_relu,
+  xnn_node_type_log,
   xnn_node_type_max_pooling_2d,
+  xnn_node_type_max_pooling_3d,
   xnn_node_type_maximum2,
   xnn_node_type_minimum2,
   xnn_node_type_multiply2,
   xnn_node_type_negate,
   xnn_node_type_prelu,
+  xnn_node_type_scaled_dot_product_attention,
   xnn_node_type_sigmoid,
+  xnn_node_type_silu,
   xnn_node_type_even_split2,
   xnn_node_type_even_split3,
   xnn_node_type_even_split4,
   xnn_node_type_softmax,
   xnn_node_type_static_constant_pad,
+  xnn_node_type_static_reduce,
   xnn_node_type_static_reshape,
   xnn_node_type_static_resize_bilinear_2d,
+  xnn_node_type_static_resize_nearest_neighbor_2d,
+  xnn_node_type_static_slice,
+  xnn_node_type_streaming_convolution_1d,
   xnn_node_type_square,
   xnn_node_type_square_root,
   xnn_node_type_squared_difference,
   xnn_node_type_subtract,
+  xnn_node_type_tanh,
+  xnn_node_type_topk,
   xnn_node_type_unpooling_2d,
 };
@@ -21,6 +21,24 @@ void xnn_normalize_transpose_permutation(
     size_t* normalized_perm,
     size_t* normalized_shape);
 
+// Normalize reduction axes and input shape in-place: drop dimensions of size 1 and merge adjacent dimensions which are
+// both reduced or both kept. Reduction axes must be in increasing order. Reduced and kept dimensions alternate in the
+// normalized shape.
+void xnn_normalize_reduction(
+    size_t* num_reduction_axes,
+    size_t* reduction_axes,
+    size_t* num_input_dims,
+    size_t* input_dims);
+
+// Normalize slice offsets, sizes and input shape in-place: merge every dimension which is sliced in full, or which
+// follows a dimension sliced to a single element, into the preceding dimension. A slice of a contiguous block of the
+// input is normalized to a single dimension.
+void xnn_normalize_slice(
+    size_t* num_dims,
+    size_t* offsets,
+    size_t* sizes,
+    size_t* input_shape);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
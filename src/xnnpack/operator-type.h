@@ -16,9 +16,14 @@ enum xnn_operator_type {
   xnn_operator_type_add_nd_f32,
   xnn_operator_type_add_nd_qs8,
   xnn_operator_type_add_nd_qu8,
+  xnn_operator_type_argmax_nc_f16,
+  xnn_operator_type_argmax_nc_f32,
+  xnn_operator_type_argmax_nc_qs8,
   xnn_operator_type_argmax_pooling_nhwc_f32,
   xnn_operator_type_average_pooling_nhwc_f32,
+  xnn_operator_type_average_pooling_nhwc_qs8,
   xnn_operator_type_average_pooling_nhwc_qu8,
+  xnn_operator_type_average_pooling_ndhwc_f32,
   xnn_operator_type_bankers_rounding_nc_f32,
   xnn_operator_type_ceiling_nc_f32,
   xnn_operator_type_channel_shuffle_nc_x8,
@@ -30,11 +35,15 @@ enum xnn_operator_type {
   xnn_operator_type_constant_pad_nd_x8,
   xnn_operator_type_constant_pad_nd_x16,
   xnn_operator_type_constant_pad_nd_x32,
+  xnn_operator_type_convert_nc_bf16_f32,
   xnn_operator_type_convert_nc_f16_f32,
   xnn_operator_type_convert_nc_f32_f16,
+  xnn_operator_type_convert_nc_f32_bf16,
   xnn_operator_type_convert_nc_f32_qs8,
   xnn_operator_type_convert_nc_f32_qu8,
+  xnn_operator_type_convert_nc_qs8,
   xnn_operator_type_convert_nc_qs8_f32,
+  xnn_operator_type_convert_nc_qu8,
   xnn_operator_type_convert_nc_qu8_f32,
   xnn_operator_type_convolution_nhwc_f16,
   xnn_operator_type_convolution_nhwc_f32,
@@ -42,6 +51,9 @@ enum xnn_operator_type {
   xnn_operator_type_convolution_nhwc_qs8,
   xnn_operator_type_convolution_nhwc_qu8,
   xnn_operator_type_convolution_nchw_f32,
+  xnn_operator_type_convolution_ndhwc_f16,
+  xnn_operator_type_convolution_ndhwc_f32,
+  xnn_operator_type_convolution_ndhwc_qs8,
   xnn_operator_type_copy_nc_x8,
   xnn_operator_type_copy_nc_x16,
   xnn_operator_type_copy_nc_x32,
@@ -54,13 +66,29 @@ enum xnn_operator_type {
   xnn_operator_type_depth_to_space_nhwc_x16,
   xnn_operator_type_depth_to_space_nhwc_x32,
   xnn_operator_type_divide_nd_f32,
+  xnn_operator_type_divide_nd_qs8,
   xnn_operator_type_elu_nc_f32,
   xnn_operator_type_elu_nc_qs8,
+  xnn_operator_type_embedding_bag_nc_f16,
+  xnn_operator_type_embedding_bag_nc_f32,
+  xnn_operator_type_embedding_lookup_nc_x8,
+  xnn_operator_type_embedding_lookup_nc_x16,
+  xnn_operator_type_embedding_lookup_nc_x32,
+  xnn_operator_type_exp_nc_f16,
+  xnn_operator_type_exp_nc_f32,
   xnn_operator_type_floor_nc_f32,
+  xnn_operator_type_fully_connected_nc_bf16,
   xnn_operator_type_fully_connected_nc_f16,
   xnn_operator_type_fully_connected_nc_f32,
+  xnn_operator_type_fully_connected_nc_f32_qc4w,
+  xnn_operator_type_fully_connected_nc_qc8,
+  xnn_operator_type_fully_connected_nc_qd8_f32_qc4w,
+  xnn_operator_type_fully_connected_nc_qd8_f32_qc8w,
   xnn_operator_type_fully_connected_nc_qs8,
+  xnn_operator_type_fully_connected_nc_qs8_f32_qc8w,
   xnn_operator_type_fully_connected_nc_qu8,
+  xnn_operator_type_gelu_nc_f16,
+  xnn_operator_type_gelu_nc_f32,
   xnn_operator_type_global_average_pooling_nwc_f16,
   xnn_operator_type_global_average_pooling_nwc_f32,
   xnn_operator_type_global_average_pooling_nwc_qs8,
@@ -68,15 +96,27 @@ enum xnn_operator_type {
   xnn_operator_type_global_average_pooling_ncw_f32,
   xnn_operator_type_hardswish_nc_f16,
   xnn_operator_type_hardswish_nc_f32,
+  xnn_operator_type_hardswish_nc_qs8,
+  xnn_operator_type_layer_normalization_nc_f16,
+  xnn_operator_type_layer_normalization_nc_f32,
   xnn_operator_type_leaky_relu_nc_f16,
   xnn_operator_type_leaky_relu_nc_f32,
+  xnn_operator_type_leaky_relu_nc_qs8,
   xnn_operator_type_leaky_relu_nc_qu8,
+  xnn_operator_type_log_nc_f16,
+  xnn_operator_type_log_nc_f32,
   xnn_operator_type_max_pooling_nhwc_f16,
   xnn_operator_type_max_pooling_nhwc_f32,
   xnn_operator_type_max_pooling_nhwc_s8,
   xnn_operator_type_max_pooling_nhwc_u8,
+  xnn_operator_type_max_pooling_ndhwc_f16,
+  xnn_operator_type_max_pooling_ndhwc_f32,
+  xnn_operator_type_max_pooling_ndhwc_s8,
+  xnn_operator_type_max_pooling_ndhwc_u8,
   xnn_operator_type_maximum_nd_f32,
+  xnn_operator_type_maximum_nd_qs8,
   xnn_operator_type_minimum_nd_f32,
+  xnn_operator_type_minimum_nd_qs8,
   xnn_operator_type_multiply_nd_f16,
   xnn_operator_type_multiply_nd_f32,
   xnn_operator_type_multiply_nd_qs8,
@@ -84,26 +124,52 @@ enum xnn_operator_type {
   xnn_operator_type_negate_nc_f32,
   xnn_operator_type_prelu_nc_f16,
   xnn_operator_type_prelu_nc_f32,
+  xnn_operator_type_reduce_nd_f16,
+  xnn_operator_type_reduce_nd_f32,
+  xnn_operator_type_reduce_nd_qs8,
   xnn_operator_type_resize_bilinear_nhwc_f16,
   xnn_operator_type_resize_bilinear_nhwc_f32,
   xnn_operator_type_resize_bilinear_nhwc_s8,
   xnn_operator_type_resize_bilinear_nhwc_u8,
   xnn_operator_type_resize_bilinear_nchw_f32,
+  xnn_operator_type_resize_nearest_neighbor_nhwc_f16,
+  xnn_operator_type_resize_nearest_neighbor_nhwc_f32,
+  xnn_operator_type_resize_nearest_neighbor_nhwc_s8,
+  xnn_operator_type_resize_nearest_neighbor_nhwc_u8,
+  xnn_operator_type_resize_nearest_neighbor_nchw_f16,
+  xnn_operator_type_resize_nearest_neighbor_nchw_f32,
+  xnn_operator_type_resize_nearest_neighbor_nchw_s8,
+  xnn_operator_type_resize_nearest_neighbor_nchw_u8,
+  xnn_operator_type_scaled_dot_product_attention_nhtc_f16,
+  xnn_operator_type_scaled_dot_product_attention_nhtc_f32,
   xnn_operator_type_sigmoid_nc_f16,
   xnn_operator_type_sigmoid_nc_f32,
   xnn_operator_type_sigmoid_nc_qs8,
   xnn_operator_type_sigmoid_nc_qu8,
+  xnn_operator_type_silu_nc_f16,
+  xnn_operator_type_silu_nc_f32,
+  xnn_operator_type_slice_nd_x8,
+  xnn_operator_type_slice_nd_x16,
+  xnn_operator_type_slice_nd_x32,
   xnn_operator_type_softmax_nc_f16,
   xnn_operator_type_softmax_nc_f32,
+  xnn_operator_type_softmax_nc_qs8,
   xnn_operator_type_softmax_nc_qu8,
   xnn_operator_type_square_nc_f32,
   xnn_operator_type_square_root_nc_f32,
   xnn_operator_type_squared_difference_nd_f32,
+  xnn_operator_type_squared_difference_nd_qs8,
+  xnn_operator_type_streaming_convolution_nwc_f16,
+  xnn_operator_type_streaming_convolution_nwc_f32,
+  xnn_operator_type_streaming_convolution_nwc_qs8,
   xnn_operator_type_subtract_nd_f32,
   xnn_operator_type_subtract_nd_qs8,
   xnn_operator_type_subtract_nd_qu8,
+  xnn_operator_type_tanh_nc_f16,
+  xnn_operator_type_tanh_nc_f32,
   xnn_operator_type_tanh_nc_qs8,
   xnn_operator_type_tanh_nc_qu8,
+  xnn_operator_type_topk_nc_f32,
   xnn_operator_type_truncation_nc_f32,
   xnn_operator_type_transpose_nd_x8,
   xnn_operator_type_transpose_nd_x16,
@@ -48,8 +48,19 @@ struct xnn_ukernel_dwconv2d {
 };
 
 struct xnn_ukernel_gemm {
-  struct xnn_hmp_gemm_ukernel general_case;
-  struct xnn_hmp_gemm_ukernel mr1_case;
+  union {
+    struct xnn_hmp_gemm_ukernel general_case;
+    struct xnn_hmp_dqgemm_ukernel dq_general_case;
+  };
+  union {
+    struct xnn_hmp_gemm_ukernel mr1_case;
+    struct xnn_hmp_dqgemm_ukernel dq_mr1_case;
+  };
+  // Accumulating variant of general_case, or NULL if the cache-blocked GEMM path is not supported.
+  xnn_f32_gemminc_minmax_ukernel_function inc_case;
+  // Variant of general_case which computes partial products without the bias and requantization, or NULL if the
+  // split-K path is not supported for quantized GEMM.
+  xnn_qs8_gemm_acc32_ukernel_function acc32_case;
   uint8_t mr;
   uint8_t nr;
   uint8_t kr;
@@ -76,6 +87,16 @@ struct xnn_ukernel_vmulcaddc {
   uint8_t mr;
 };
 
+struct xnn_ukernel_winograd {
+  struct xnn_hmp_gemm_ukernel gemm;
+  xnn_f32_winograd_input_ukernel_function input_function;
+  xnn_f32_winograd_output_ukernel_function output_function;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t kr;
+  uint8_t sr;
+};
+
 struct xnn_ukernel_vbinary {
   xnn_vbinary_ukernel_function op_function;
   xnn_vbinary_ukernel_function opc_function;
@@ -98,6 +119,7 @@ struct xnn_ukernel {
     struct xnn_ukernel_vmulcaddc vmulcaddc;
     struct xnn_ukernel_vbinary vbinary;
     struct xnn_ukernel_vunary vunary;
+    struct xnn_ukernel_winograd winograd;
   };
 };
 
@@ -126,6 +148,12 @@ struct xnn_operator {
   uint32_t padding_right;
   uint32_t padding_bottom;
   uint32_t padding_left;
+  // Depth padding, kernel, stride, and dilation of 3D Convolution and Pooling operators.
+  uint32_t padding_front;
+  uint32_t padding_back;
+  uint32_t kernel_depth;
+  uint32_t stride_depth;
+  uint32_t dilation_depth;
   uint32_t kernel_height;
   uint32_t kernel_width;
   uint32_t stride_height;
@@ -142,6 +170,7 @@ struct xnn_operator {
   size_t pad_after_channels;
   uint32_t pad_value;
 
+  size_t input_depth;
   size_t input_height;
   size_t input_width;
   size_t input_pixel_stride;
@@ -149,6 +178,7 @@ struct xnn_operator {
   const void* input2;
   const void** indirection_buffer;
 
+  size_t output_depth;
   size_t output_height;
   size_t output_width;
   size_t output_pixel_stride;
@@ -160,6 +190,8 @@ struct xnn_operator {
     // Offset into the weights cache where the packed weights are. Only valid if weights_cache is not NULL.
     size_t offset;
   } packed_weights;
+  // Size of packed weights, in bytes, for every output channel of a Fully Connected operator.
+  size_t weights_stride;
   // Total number of non-zero kernel elements when weights use sparse representation.
   size_t num_nonzero_values;
   // Total number of non-zero kernel blocks when weights use sparse representation.
@@ -177,6 +209,7 @@ struct xnn_operator {
   uint8_t output_max;
 
   size_t valid_batch_size;
+  size_t last_input_depth;
   size_t last_input_height;
   size_t last_input_width;
   const void* last_input;
@@ -190,21 +223,44 @@ struct xnn_operator {
   void* lookup_table;
   void* pixelwise_buffer;
   struct subconvolution_params* subconvolution_buffer;
+  // Scratch space for transformed input and output tiles of Winograd convolution, or for accumulators and partial
+  // products of the cache-blocked and split-K GEMM paths of Fully Connected operators, or for the candidates of every
+  // block of a row in ArgMax and TopK operators.
+  void* workspace;
+  size_t workspace_size;
+  // Last input frames of every batch element, kept between runs of Streaming Convolution operators as ring buffers,
+  // preceded by the index of the oldest frame in every ring buffer.
+  void* state_buffer;
+  size_t state_buffer_size;
+  size_t state_batch_size;
+  // Set by Embedding Lookup and Embedding Bag operators when they meet an out-of-range index at run time. Reported and
+  // cleared by xnn_run_operator.
+  bool invalid_indices;
   uint32_t flags;
 
   union {
+    union xnn_f16_exp_params f16_exp;
     union xnn_f16_f32_cvt_params f16_f32_cvt;
+    union xnn_f16_gelu_params f16_gelu;
     union xnn_f16_hswish_params f16_hswish;
+    union xnn_f16_log_params f16_log;
     union xnn_f16_lrelu_params f16_lrelu;
     union xnn_f16_sigmoid_params f16_sigmoid;
+    union xnn_f16_silu_params f16_silu;
+    union xnn_f16_tanh_params f16_tanh;
     union xnn_f32_abs_params f32_abs;
     union xnn_f32_default_params f32_default;
     union xnn_f32_elu_params f32_elu;
+    union xnn_f32_exp_params f32_exp;
+    union xnn_f32_gelu_params f32_gelu;
+    union xnn_f32_log_params f32_log;
     union xnn_f32_lrelu_params f32_lrelu;
     union xnn_f32_neg_params f32_neg;
     union xnn_f32_rnd_params f32_rnd;
     union xnn_f32_sigmoid_params f32_sigmoid;
+    union xnn_f32_silu_params f32_silu;
     union xnn_f32_sqrt_params f32_sqrt;
+    union xnn_f32_tanh_params f32_tanh;
     // Parameters for Global Average Pooling in CHW layout
     union xnn_f32_gavgpool_params f32_gavgpool;
     union xnn_f32_hswish_params f32_hswish;
@@ -212,17 +268,37 @@ struct xnn_operator {
     union xnn_f16_scaleminmax_params f16_scaleminmax;
     // Pixelwise Average Pooling normally use f32_minmax_params, but also initialize
     // f32_scaleminmax_params in case it needs to switch to Global Average Pooling operation.
+    // Fully Connected uses f32_minmax_params for GEMM micro-kernels, and f32_vadd_minmax for VADD micro-kernels which
+    // add up partial products in the split-K mode.
     struct {
       union xnn_f32_minmax_params f32_minmax;
       union xnn_f32_scaleminmax_params f32_scaleminmax;
+      union xnn_f32_minmax_params f32_vadd_minmax;
+    };
+    // Winograd convolution clamps the output after the inverse transform, and uses unbounded parameters for the GEMM.
+    struct {
+      union xnn_f32_minmax_params f32_winograd_output;
+      union xnn_f32_minmax_params f32_winograd_gemm;
     };
     union xnn_f32_chw_params f32_chw;
+    union xnn_f32_qc4w_minmax_params f32_qc4w_minmax;
     union xnn_f32_f16_cvt_params f32_f16_cvt;
     union xnn_f32_qs8_cvt_params f32_qs8_cvt;
     union xnn_f32_qu8_cvt_params f32_qu8_cvt;
     union xnn_qs8_f32_cvt_params qs8_f32_cvt;
     union xnn_qu8_f32_cvt_params qu8_f32_cvt;
-    union xnn_qs8_conv_minmax_params qs8_conv_minmax;
+    union xnn_qs8_hswish_params qs8_hswish;
+    union xnn_qs8_lrelu_params qs8_lrelu;
+    // Quantized Fully Connected keeps a copy of the requantization parameters in the scalar layout for the split-K
+    // mode, which requantizes the sum of partial products outside of micro-kernels.
+    struct {
+      union xnn_qs8_conv_minmax_params qs8_conv_minmax;
+      union xnn_qs8_conv_minmax_params qs8_splitk_minmax;
+    };
+    struct {
+      union xnn_qs8_minmax_params qc8_minmax;
+      union xnn_qs8_conv_minmax_params qc8_splitk_minmax;
+    };
     // Average Pooling normally use qs8_avgpool_params, but also initialize qs8_gavgpool_params in case it needs to switch
     // to Global Average Pooling operation.
     struct {
@@ -238,6 +314,10 @@ struct xnn_operator {
       union xnn_qs8_mul_minmax_params qs8_mul;
       union xnn_qs8_mul_minmax_params qs8_rmul;
     };
+    struct {
+      union xnn_qs8_binary_minmax_params qs8_binary;
+      union xnn_qs8_binary_minmax_params qs8_rbinary;
+    };
     struct {
       union xnn_qu8_addsub_minmax_params qu8_addsub;
       union xnn_qu8_addsub_minmax_params qu8_raddsub;
@@ -255,6 +335,19 @@ struct xnn_operator {
     };
     union xnn_s8_minmax_params s8_minmax;
     union xnn_u8_minmax_params u8_minmax;
+    // Layer Normalization adds epsilon to the variance in FP32 for both FP16 and FP32 operators.
+    float layernorm_epsilon;
+    // Scaled Dot-Product Attention keeps the scale in FP32 and converts it when the keys are packed.
+    float attention_scale;
+    enum xnn_reduce_operator reduce_operator;
+    // Embedding Lookup and Embedding Bag operators gather rows of a static table.
+    struct {
+      const void* table;
+      size_t num_embeddings;
+      enum xnn_reduce_operator bag_operator;
+    } embedding;
+    // Number of largest elements found in every row by ArgMax (always 1) and TopK operators.
+    size_t topk_k;
   } params;
   enum xnn_operator_type type;
   struct xnn_ukernel ukernel;
@@ -264,35 +357,49 @@ struct xnn_operator {
   union {
     struct argmax_pooling_context argmax_pooling;
     struct average_pooling_context average_pooling;
+    struct blocked_gemm_context blocked_gemm;
     struct channel_shuffle_context channel_shuffle;
     struct conv2d_context conv2d;
     struct dwconv2d_context dwconv2d;
     struct dwconv_context dwconv;
+    struct dqgemm_context dqgemm;
     struct depthtospace2d_chw2hwc_context depthtospace2d_chw;
     struct depthtospace2d_hwc_context depthtospace2d_hwc;
     struct elementwise_binary_context elementwise_binary;
+    struct embedding_lookup_context embedding_lookup;
     struct gemm_context gemm;
     struct global_average_pooling_nwc_context global_average_pooling_nwc;
     struct global_average_pooling_ncw_context global_average_pooling_ncw;
     struct igemm_context igemm;
+    struct layer_normalization_context layer_normalization;
     struct lut_contiguous_context lut_contiguous;
     struct lut_strided_context lut_strided;
     struct max_pooling_context max_pooling;
     struct pad_context pad;
+    struct slice_context slice;
     struct pixelwise_average_pooling_context pixelwise_average_pooling;
     struct prelu_context prelu;
+    struct reduce_context reduce;
     struct resize_bilinear_context resize_bilinear;
     struct resize_bilinear_chw_context resize_bilinear_chw;
+    struct resize_nearest_neighbor_context resize_nearest_neighbor;
+    struct resize_nearest_neighbor_chw_context resize_nearest_neighbor_chw;
+    struct topk_context topk;
+    struct scaled_dot_product_attention_context scaled_dot_product_attention;
     struct spmm_context spmm;
+    struct streaming_convolution_context streaming_convolution;
+    struct splitk_gemm_context splitk_gemm;
+    struct qs8_splitk_gemm_context qs8_splitk_gemm;
     struct subconv_context subconv;
     struct subgemm_context subgemm;
     struct transpose_context transpose;
     struct floating_point_softmax_context floating_point_softmax;
-    struct u8_softmax_context u8_softmax;
+    struct quantized_softmax_context quantized_softmax;
     struct univector_contiguous_context univector_contiguous;
     struct univector_strided_context univector_strided;
     struct unpooling_context unpooling;
     struct vmulcaddc_context vmulcaddc;
+    struct winograd_context winograd;
   } context;
 
   struct xnn_code_cache* code_cache;
@@ -29,21 +29,39 @@ struct xnn_qs8_packing_params {
   int8_t input_zero_point;
 };
 
+struct xnn_qs8_qc4w_packing_params {
+  int8_t input_zero_point;
+  uint8_t kernel_zero_point;
+};
 
-typedef void (*xnn_pack_gemm_goi_w_function)(
+
+XNN_INTERNAL void xnn_pack_f32_gemm_goi_w(
   size_t g,
   size_t nc,
   size_t kc,
   size_t nr,
   size_t kr,
   size_t sr,
-  const void* k,
-  const void* b,
-  void* packed_w,
+  const float* k,
+  const float* b,
+  float* packed_w,
   size_t extra_bytes,
   const void* params);
 
-XNN_INTERNAL void xnn_pack_f32_gemm_goi_w(
+XNN_INTERNAL void xnn_pack_f16_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint16_t* k,
+  const uint16_t* b,
+  uint16_t* packed_w,
+  size_t extra_bytes,
+  const void* params);
+
+XNN_INTERNAL void xnn_pack_f32_to_f16_gemm_goi_w(
   size_t g,
   size_t nc,
   size_t kc,
@@ -52,11 +70,11 @@ XNN_INTERNAL void xnn_pack_f32_gemm_goi_w(
   size_t sr,
   const float* k,
   const float* b,
-  float* packed_w,
+  uint16_t* packed_w,
   size_t extra_bytes,
   const void* params);
 
-XNN_INTERNAL void xnn_pack_f16_gemm_goi_w(
+XNN_INTERNAL void xnn_pack_bf16_gemm_goi_w(
   size_t g,
   size_t nc,
   size_t kc,
@@ -64,12 +82,12 @@ XNN_INTERNAL void xnn_pack_f16_gemm_goi_w(
   size_t kr,
   size_t sr,
   const uint16_t* k,
-  const uint16_t* b,
-  uint16_t* packed_w,
+  const float* b,
+  void* packed_w,
   size_t extra_bytes,
   const void* params);
 
-XNN_INTERNAL void xnn_pack_f32_to_f16_gemm_goi_w(
+XNN_INTERNAL void xnn_pack_f32_to_bf16_gemm_goi_w(
   size_t g,
   size_t nc,
   size_t kc,
@@ -78,7 +96,7 @@ XNN_INTERNAL void xnn_pack_f32_to_f16_gemm_goi_w(
   size_t sr,
   const float* k,
   const float* b,
-  uint16_t* packed_w,
+  void* packed_w,
   size_t extra_bytes,
   const void* params);
 
@@ -121,17 +139,34 @@ XNN_INTERNAL void xnn_pack_qs8_gemm_xw_goi_w(
   size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
+// Weights with 4-bit elements are stored with two elements per byte, the even element along K in the low nibble, and
+// every row of KC elements is padded to a whole number of bytes.
+XNN_INTERNAL void xnn_pack_f32_qc4w_gemm_goi_w(
+  size_t g,
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint8_t* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const struct xnn_qs8_qc4w_packing_params* params);
 
-typedef void (*xnn_pack_gemm_io_w_function)(
+XNN_INTERNAL void xnn_pack_qs8_qc4w_gemm_goi_w(
+  size_t g,
   size_t nc,
   size_t kc,
   size_t nr,
   size_t kr,
   size_t sr,
-  const void* k,
-  const void* b,
+  const uint8_t* k,
+  const int32_t* b,
   void* packed_w,
-  const void* params);
+  size_t extra_bytes,
+  const struct xnn_qs8_qc4w_packing_params* params);
+
 
 XNN_INTERNAL void xnn_pack_f32_gemm_io_w(
   size_t nc,
@@ -142,6 +177,7 @@ XNN_INTERNAL void xnn_pack_f32_gemm_io_w(
   const float* k,
   const float* b,
   float* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f16_gemm_io_w(
@@ -153,6 +189,7 @@ XNN_INTERNAL void xnn_pack_f16_gemm_io_w(
   const uint16_t* k,
   const uint16_t* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_f32_to_f16_gemm_io_w(
@@ -164,6 +201,31 @@ XNN_INTERNAL void xnn_pack_f32_to_f16_gemm_io_w(
   const float* k,
   const float* b,
   uint16_t* packed_w,
+  size_t extra_bytes,
+  const void* params);
+
+XNN_INTERNAL void xnn_pack_bf16_gemm_io_w(
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const uint16_t* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
+  const void* params);
+
+XNN_INTERNAL void xnn_pack_f32_to_bf16_gemm_io_w(
+  size_t nc,
+  size_t kc,
+  size_t nr,
+  size_t kr,
+  size_t sr,
+  const float* k,
+  const float* b,
+  void* packed_w,
+  size_t extra_bytes,
   const void* params);
 
 XNN_INTERNAL void xnn_pack_qu8_gemm_io_w(
@@ -175,6 +237,7 @@ XNN_INTERNAL void xnn_pack_qu8_gemm_io_w(
   const uint8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qu8_packing_params* params);
 
 XNN_INTERNAL void xnn_pack_qs8_gemm_io_w(
@@ -186,6 +249,7 @@ XNN_INTERNAL void xnn_pack_qs8_gemm_io_w(
   const int8_t* k,
   const int32_t* b,
   void* packed_w,
+  size_t extra_bytes,
   const struct xnn_qs8_packing_params* params);
 
 
@@ -662,6 +726,15 @@ XNN_INTERNAL void xnn_pack_f32_chw_dwconv_hwg_w(
   const void* params);
 
 
+// Transforms 3x3 filters in OHWI layout into the 4x4 Winograd F(2x2, 3x3) domain: U = G * g * G^T.
+// The transformed filters are stored as 16 GOI-layout matrices, one per transformed position.
+XNN_INTERNAL void xnn_pack_f32_winograd_2x2_3x3_filter(
+  size_t nc,
+  size_t kc,
+  const float* k,
+  float* transformed_k);
+
+
 typedef void (*xnn_pack_vmulcaddc_w_function)(
   size_t c,
   size_t cr,
@@ -363,6 +363,20 @@ DECLARE_INIT_F32_MINMAX_PARAMS_FUNCTION(xnn_init_f32_minmax_params)
 DECLARE_INIT_F32_MINMAX_PARAMS_FUNCTION(xnn_init_f32_minmax_scalar_params)
 
 
+#define DECLARE_INIT_F32_QC4W_MINMAX_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL void fn_name(                                      \
+    union xnn_f32_qc4w_minmax_params params[XNN_MIN_ELEMENTS(1)], \
+    float output_min,                                             \
+    float output_max,                                             \
+    uint8_t kernel_zero_point);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_QC4W_MINMAX_PARAMS_FUNCTION(xnn_init_f32_qc4w_minmax_avx_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+DECLARE_INIT_F32_QC4W_MINMAX_PARAMS_FUNCTION(xnn_init_f32_qc4w_minmax_scalar_params)
+
+
 #define DECLARE_INIT_F16_HSWISH_PARAMS_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                             \
     union xnn_f16_hswish_params params[XNN_MIN_ELEMENTS(1)]);
@@ -439,6 +453,134 @@ DECLARE_INIT_F32_SIGMOID_PARAMS_FUNCTION(xnn_init_f32_sigmoid_scalar_rr2_p5_para
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
 
+#define DECLARE_INIT_F16_EXP_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                               \
+    union xnn_f16_exp_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F16_EXP_PARAMS_FUNCTION(xnn_init_f16_exp_avx2_rr2_p5_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_EXP_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                               \
+    union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_INIT_F32_EXP_PARAMS_FUNCTION(xnn_init_f32_exp_scalar_rr2_p5_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_F32_EXP_PARAMS_FUNCTION(xnn_init_f32_exp_neon_rr2_p5_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_EXP_PARAMS_FUNCTION(xnn_init_f32_exp_sse2_rr2_p5_params)
+  DECLARE_INIT_F32_EXP_PARAMS_FUNCTION(xnn_init_f32_exp_avx2_rr2_p5_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F16_GELU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f16_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F16_GELU_PARAMS_FUNCTION(xnn_init_f16_gelu_avx2_rr1_p5_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_scalar_rr2_p5_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_neon_rr2_p5_params)
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_neonfma_rr1_p5_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_sse2_rr2_p5_params)
+  DECLARE_INIT_F32_GELU_PARAMS_FUNCTION(xnn_init_f32_gelu_avx2_rr1_p5_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F16_LOG_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                               \
+    union xnn_f16_log_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F16_LOG_PARAMS_FUNCTION(xnn_init_f16_log_avx2_p4_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_LOG_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                               \
+    union xnn_f32_log_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_INIT_F32_LOG_PARAMS_FUNCTION(xnn_init_f32_log_scalar_p4_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_F32_LOG_PARAMS_FUNCTION(xnn_init_f32_log_neon_p4_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_LOG_PARAMS_FUNCTION(xnn_init_f32_log_sse2_p4_params)
+  DECLARE_INIT_F32_LOG_PARAMS_FUNCTION(xnn_init_f32_log_avx2_p4_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F16_SILU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f16_silu_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F16_SILU_PARAMS_FUNCTION(xnn_init_f16_silu_avx2_rr1_p5_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(xnn_init_f32_silu_scalar_rr2_p5_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(xnn_init_f32_silu_neon_rr2_p5_params)
+  DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(xnn_init_f32_silu_neonfma_rr1_p5_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(xnn_init_f32_silu_sse2_rr2_p5_params)
+  DECLARE_INIT_F32_SILU_PARAMS_FUNCTION(xnn_init_f32_silu_avx2_rr1_p5_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F16_TANH_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f16_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F16_TANH_PARAMS_FUNCTION(xnn_init_f16_tanh_avx2_expm1minus_rr1_p6_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(fn_name)      \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
+DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_scalar_expm1minus_rr2_p6_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_neon_expm1minus_rr2_p6_params)
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_neonfma_expm1minus_rr1_p6_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_sse2_expm1minus_rr2_p6_params)
+  DECLARE_INIT_F32_TANH_PARAMS_FUNCTION(xnn_init_f32_tanh_avx2_expm1minus_rr1_p6_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #define DECLARE_INIT_F32_ABS_PARAMS_FUNCTION(fn_name)      \
   XNN_INTERNAL void fn_name(                               \
     union xnn_f32_abs_params params[XNN_MIN_ELEMENTS(1)]);
@@ -585,6 +727,48 @@ DECLARE_INIT_F32_LRELU_PARAMS_FUNCTION(xnn_init_f32_lrelu_scalar_params)
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
 
+#define DECLARE_INIT_QS8_LRELU_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL void fn_name(                                \
+    union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)], \
+    float positive_scale,                                   \
+    float negative_scale,                                   \
+    int8_t input_zero_point,                                \
+    int8_t output_zero_point,                               \
+    int8_t output_min,                                      \
+    int8_t output_max);
+
+DECLARE_INIT_QS8_LRELU_PARAMS_FUNCTION(xnn_init_qs8_lrelu_scalar_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_QS8_LRELU_PARAMS_FUNCTION(xnn_init_qs8_lrelu_neon_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_QS8_LRELU_PARAMS_FUNCTION(xnn_init_qs8_lrelu_sse4_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#define DECLARE_INIT_QS8_HSWISH_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL void fn_name(                                 \
+    union xnn_qs8_hswish_params params[XNN_MIN_ELEMENTS(1)], \
+    float input_scale,                                       \
+    float output_scale,                                      \
+    int8_t input_zero_point,                                 \
+    int8_t output_zero_point,                                \
+    int8_t output_min,                                       \
+    int8_t output_max);
+
+DECLARE_INIT_QS8_HSWISH_PARAMS_FUNCTION(xnn_init_qs8_hswish_scalar_params)
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  DECLARE_INIT_QS8_HSWISH_PARAMS_FUNCTION(xnn_init_qs8_hswish_neon_params)
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_QS8_HSWISH_PARAMS_FUNCTION(xnn_init_qs8_hswish_sse4_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #define DECLARE_INIT_F32_SQRT_PARAMS_FUNCTION(fn_name)      \
   XNN_INTERNAL void fn_name(                                \
     union xnn_f32_sqrt_params params[XNN_MIN_ELEMENTS(1)]);
@@ -771,6 +955,25 @@ DECLARE_INIT_QS8_MUL_MINMAX_PARAMS_FUNCTION(xnn_init_qs8_mul_minmax_fp32_scalar_
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 
 
+#define DECLARE_INIT_QS8_BINARY_MINMAX_PARAMS_FUNCTION(fn_name)     \
+  XNN_INTERNAL void fn_name(                                        \
+    union xnn_qs8_binary_minmax_params params[XNN_MIN_ELEMENTS(1)], \
+    int8_t a_zero_point,                                            \
+    int8_t b_zero_point,                                            \
+    int8_t output_zero_point,                                       \
+    float a_scale,                                                  \
+    float b_scale,                                                  \
+    float output_scale,                                             \
+    int8_t output_min,                                              \
+    int8_t output_max);
+
+DECLARE_INIT_QS8_BINARY_MINMAX_PARAMS_FUNCTION(xnn_init_qs8_binary_minmax_scalar_params)
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  DECLARE_INIT_QS8_BINARY_MINMAX_PARAMS_FUNCTION(xnn_init_qs8_binary_minmax_sse4_params)
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 #define DECLARE_INIT_F16_F32_CVT_PARAMS_FUNCTION(fn_name)      \
   XNN_INTERNAL void fn_name(                                   \
     union xnn_f16_f32_cvt_params params[XNN_MIN_ELEMENTS(1)]);
@@ -97,6 +97,28 @@ union xnn_f32_minmax_params {
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 };
 
+union xnn_f32_qc4w_minmax_params {
+  struct {
+    float min;
+    float max;
+    int32_t minus_kernel_zero_point;
+  } scalar;
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(32) float min[8];
+    XNN_ALIGN(32) float max[8];
+    // Values of 4-bit weights with the kernel zero point subtracted, replicated in both 128-bit lanes.
+    XNN_ALIGN(32) int8_t kernel_lut[32];
+  } avx;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// Quantization parameters of a dynamically quantized row of the input: real value = (quantized value - zero_point) * scale.
+struct xnn_qd8_quantization_params {
+  int32_t zero_point;
+  float scale;
+};
+
 union xnn_f32_abs_params {
   char _; // Dummy member variable to comply with the C standard
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
@@ -679,7 +701,488 @@ union xnn_f32_sigmoid_params {
     float ln2_lo;
     float c2;
     float denorm_cutoff;
-  } neon_rr2_lut64_p2;
+  } neon_rr2_lut64_p2;
+  struct {
+    float magic_bias;
+    float minus_log2e;
+    float ln2_hi;
+    float ln2_lo;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float denorm_cutoff;
+  } neon_rr2_p5;
+  struct {
+    float magic_bias;
+    float minus_log2e;
+    float ln2;
+    float c1;
+    float denorm_cutoff;
+  } neonfma_rr1_lut2048_p1;
+  struct {
+    float magic_bias;
+    float minus_log2e;
+    float ln2;
+    float c2;
+    float denorm_cutoff;
+  } neonfma_rr1_lut64_p2;
+  struct {
+    float magic_bias;
+    float minus_log2e;
+    float ln2;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float denorm_cutoff;
+  } neonfma_rr1_p5;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float sign_mask[4];
+    XNN_ALIGN(16) float magic_bias[4];
+    XNN_ALIGN(16) float log2e[4];
+    XNN_ALIGN(16) uint32_t index_mask[4];
+    XNN_ALIGN(16) float minus_ln2_hi[4];
+    XNN_ALIGN(16) float minus_ln2_lo[4];
+    XNN_ALIGN(16) float c2[4];
+    XNN_ALIGN(16) float one[4];
+    XNN_ALIGN(16) float denorm_cutoff[4];
+  } sse2_rr2_lut64_p2;
+  struct {
+    XNN_ALIGN(16) float sign_mask[4];
+    XNN_ALIGN(16) float magic_bias[4];
+    XNN_ALIGN(16) float log2e[4];
+    XNN_ALIGN(16) float minus_ln2_hi[4];
+    XNN_ALIGN(16) float minus_ln2_lo[4];
+    XNN_ALIGN(16) float c5[4];
+    XNN_ALIGN(16) float c4[4];
+    XNN_ALIGN(16) float c3[4];
+    XNN_ALIGN(16) float c2[4];
+    XNN_ALIGN(16) float c1[4];
+    XNN_ALIGN(16) float one[4];
+    XNN_ALIGN(16) float denorm_cutoff[4];
+  } sse2_rr2_p5;
+  struct {
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float minus_ln2_hi[8];
+    XNN_ALIGN(32) float minus_ln2_lo[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float two[8];
+    XNN_ALIGN(32) float denorm_cutoff[8];
+    int32_t mask_table[14];
+  } avx_rr2_p5;
+  struct {
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float minus_ln2[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float denorm_cutoff[8];
+    int32_t mask_table[14];
+  } avx2_rr1_p5;
+  struct {
+    uint32_t sign_mask;
+    float magic_bias;
+    float log2e;
+    float minus_ln2;
+    float c3;
+    float c2;
+    float one;
+    XNN_ALIGN(64) float table[16];
+  } avx512_rr1_lut16_p3;
+  struct {
+    uint32_t sign_mask;
+    float magic_bias;
+    float log2e;
+    float minus_ln2_hi;
+    float minus_ln2_lo;
+    float c2;
+    float c1;
+    float one;
+    XNN_ALIGN(64) float table_lo[16];
+    XNN_ALIGN(64) float table_hi[16];
+  } avx512_rr2_lut32_p2;
+  struct {
+    uint32_t sign_mask;
+    float log2e;
+    float minus_ln2;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float one;
+  } avx512_rr1_p5;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+#if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+  struct {
+    XNN_ALIGN(8) float magic_bias[2];
+    XNN_ALIGN(8) float minus_log2e[2];
+    XNN_ALIGN(8) uint32_t index_mask[2];
+    XNN_ALIGN(8) float ln2_hi[2];
+    XNN_ALIGN(8) float ln2_lo[2];
+    XNN_ALIGN(8) float c2[2];
+    XNN_ALIGN(8) float one[2];
+    XNN_ALIGN(8) float denorm_cutoff[2];
+  } wasmsimd_rr2_lut64_p2;
+  struct {
+    XNN_ALIGN(8) float magic_bias[2];
+    XNN_ALIGN(8) float minus_log2e[2];
+    XNN_ALIGN(8) float ln2_hi[2];
+    XNN_ALIGN(8) float ln2_lo[2];
+    XNN_ALIGN(8) float c5[2];
+    XNN_ALIGN(8) float c4[2];
+    XNN_ALIGN(8) float c3[2];
+    XNN_ALIGN(8) float c2[2];
+    XNN_ALIGN(8) float c1[2];
+    XNN_ALIGN(8) float one[2];
+    XNN_ALIGN(8) float denorm_cutoff[2];
+  } wasmsimd_rr2_p5;
+#endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+};
+
+union xnn_f16_exp_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float minus_ln2_hi[8];
+    XNN_ALIGN(32) float minus_ln2_lo[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) int32_t min_exponent[8];
+    XNN_ALIGN(32) int32_t max_exponent[8];
+    XNN_ALIGN(32) float zero_cutoff[8];
+    XNN_ALIGN(32) float inf_cutoff[8];
+    XNN_ALIGN(32) float plus_inf[8];
+  } avx2_rr2_p5;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f32_exp_params {
+  struct {
+    float log2e;
+    float magic_bias;
+    float minus_ln2_hi;
+    float minus_ln2_lo;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    int32_t min_exponent;
+    int32_t max_exponent;
+    float zero_cutoff;
+    float inf_cutoff;
+  } scalar_rr2_p5;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float log2e;
+    float magic_bias;
+    float minus_ln2_hi;
+    float minus_ln2_lo;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    int32_t min_exponent;
+    int32_t max_exponent;
+    float zero_cutoff;
+    float inf_cutoff;
+  } neon_rr2_p5;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float log2e[4];
+    XNN_ALIGN(16) float magic_bias[4];
+    XNN_ALIGN(16) float minus_ln2_hi[4];
+    XNN_ALIGN(16) float minus_ln2_lo[4];
+    XNN_ALIGN(16) float c5[4];
+    XNN_ALIGN(16) float c4[4];
+    XNN_ALIGN(16) float c3[4];
+    XNN_ALIGN(16) float c2[4];
+    XNN_ALIGN(16) float c1[4];
+    XNN_ALIGN(16) int32_t min_exponent[4];
+    XNN_ALIGN(16) int32_t max_exponent[4];
+    XNN_ALIGN(16) float zero_cutoff[4];
+    XNN_ALIGN(16) float inf_cutoff[4];
+    XNN_ALIGN(16) float plus_inf[4];
+  } sse2_rr2_p5;
+  struct {
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float minus_ln2_hi[8];
+    XNN_ALIGN(32) float minus_ln2_lo[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) int32_t min_exponent[8];
+    XNN_ALIGN(32) int32_t max_exponent[8];
+    XNN_ALIGN(32) float zero_cutoff[8];
+    XNN_ALIGN(32) float inf_cutoff[8];
+    XNN_ALIGN(32) float plus_inf[8];
+    int32_t mask_table[14];
+  } avx2_rr2_p5;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f16_gelu_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(32) float alpha[8];
+    XNN_ALIGN(32) float beta[8];
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float minus_ln2[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float denorm_cutoff[8];
+  } avx2_rr1_p5;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f32_gelu_params {
+  struct {
+    float alpha;
+    float beta;
+    float magic_bias;
+    float minus_log2e;
+    float ln2_hi;
+    float ln2_lo;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float one;
+    float denorm_cutoff;
+  } scalar_rr2_p5;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float alpha;
+    float beta;
+    float magic_bias;
+    float minus_log2e;
+    float ln2_hi;
+    float ln2_lo;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float denorm_cutoff;
+  } neon_rr2_p5;
+  struct {
+    float alpha;
+    float beta;
+    float magic_bias;
+    float minus_log2e;
+    float ln2;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float denorm_cutoff;
+  } neonfma_rr1_p5;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float alpha[4];
+    XNN_ALIGN(16) float beta[4];
+    XNN_ALIGN(16) float sign_mask[4];
+    XNN_ALIGN(16) float magic_bias[4];
+    XNN_ALIGN(16) float log2e[4];
+    XNN_ALIGN(16) float minus_ln2_hi[4];
+    XNN_ALIGN(16) float minus_ln2_lo[4];
+    XNN_ALIGN(16) float c5[4];
+    XNN_ALIGN(16) float c4[4];
+    XNN_ALIGN(16) float c3[4];
+    XNN_ALIGN(16) float c2[4];
+    XNN_ALIGN(16) float c1[4];
+    XNN_ALIGN(16) float one[4];
+    XNN_ALIGN(16) float denorm_cutoff[4];
+  } sse2_rr2_p5;
+  struct {
+    XNN_ALIGN(32) float alpha[8];
+    XNN_ALIGN(32) float beta[8];
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float minus_ln2[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float denorm_cutoff[8];
+    int32_t mask_table[14];
+  } avx2_rr1_p5;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f16_log_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(32) int32_t sqrt_half[8];
+    XNN_ALIGN(32) int32_t mantissa_mask[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float two[8];
+    XNN_ALIGN(32) float half[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float ln2_hi[8];
+    XNN_ALIGN(32) float ln2_lo[8];
+    XNN_ALIGN(32) float minus_inf[8];
+    XNN_ALIGN(32) float plus_inf[8];
+    XNN_ALIGN(32) float nan[8];
+  } avx2_p4;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f32_log_params {
+  struct {
+    float min_normal;
+    float denorm_scale;
+    float denorm_exponent;
+    int32_t sqrt_half;
+    int32_t mantissa_mask;
+    float one;
+    float two;
+    float half;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float ln2_hi;
+    float ln2_lo;
+  } scalar_p4;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    float min_normal;
+    float denorm_scale;
+    float denorm_exponent;
+    int32_t sqrt_half;
+    int32_t mantissa_mask;
+    float half;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float ln2_hi;
+    float ln2_lo;
+  } neon_p4;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) float min_normal[4];
+    XNN_ALIGN(16) float denorm_scale[4];
+    XNN_ALIGN(16) float denorm_exponent[4];
+    XNN_ALIGN(16) int32_t sqrt_half[4];
+    XNN_ALIGN(16) int32_t mantissa_mask[4];
+    XNN_ALIGN(16) float one[4];
+    XNN_ALIGN(16) float two[4];
+    XNN_ALIGN(16) float half[4];
+    XNN_ALIGN(16) float c4[4];
+    XNN_ALIGN(16) float c3[4];
+    XNN_ALIGN(16) float c2[4];
+    XNN_ALIGN(16) float c1[4];
+    XNN_ALIGN(16) float ln2_hi[4];
+    XNN_ALIGN(16) float ln2_lo[4];
+    XNN_ALIGN(16) float minus_inf[4];
+    XNN_ALIGN(16) float plus_inf[4];
+    XNN_ALIGN(16) float nan[4];
+  } sse2_p4;
+  struct {
+    XNN_ALIGN(32) float min_normal[8];
+    XNN_ALIGN(32) float denorm_scale[8];
+    XNN_ALIGN(32) float denorm_exponent[8];
+    XNN_ALIGN(32) int32_t sqrt_half[8];
+    XNN_ALIGN(32) int32_t mantissa_mask[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float two[8];
+    XNN_ALIGN(32) float half[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float ln2_hi[8];
+    XNN_ALIGN(32) float ln2_lo[8];
+    XNN_ALIGN(32) float minus_inf[8];
+    XNN_ALIGN(32) float plus_inf[8];
+    XNN_ALIGN(32) float nan[8];
+    int32_t mask_table[14];
+  } avx2_p4;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f16_silu_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float minus_ln2[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float one[8];
+    XNN_ALIGN(32) float denorm_cutoff[8];
+  } avx2_rr1_p5;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f32_silu_params {
+  struct {
+    float magic_bias;
+    float minus_log2e;
+    float ln2_hi;
+    float ln2_lo;
+    float c5;
+    float c4;
+    float c3;
+    float c2;
+    float c1;
+    float one;
+    float denorm_cutoff;
+  } scalar_rr2_p5;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
   struct {
     float magic_bias;
     float minus_log2e;
@@ -692,20 +1195,6 @@ union xnn_f32_sigmoid_params {
     float c1;
     float denorm_cutoff;
   } neon_rr2_p5;
-  struct {
-    float magic_bias;
-    float minus_log2e;
-    float ln2;
-    float c1;
-    float denorm_cutoff;
-  } neonfma_rr1_lut2048_p1;
-  struct {
-    float magic_bias;
-    float minus_log2e;
-    float ln2;
-    float c2;
-    float denorm_cutoff;
-  } neonfma_rr1_lut64_p2;
   struct {
     float magic_bias;
     float minus_log2e;
@@ -719,17 +1208,6 @@ union xnn_f32_sigmoid_params {
   } neonfma_rr1_p5;
 #endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
 #if XNN_ARCH_X86 || XNN_ARCH_X86_64
-  struct {
-    XNN_ALIGN(16) float sign_mask[4];
-    XNN_ALIGN(16) float magic_bias[4];
-    XNN_ALIGN(16) float log2e[4];
-    XNN_ALIGN(16) uint32_t index_mask[4];
-    XNN_ALIGN(16) float minus_ln2_hi[4];
-    XNN_ALIGN(16) float minus_ln2_lo[4];
-    XNN_ALIGN(16) float c2[4];
-    XNN_ALIGN(16) float one[4];
-    XNN_ALIGN(16) float denorm_cutoff[4];
-  } sse2_rr2_lut64_p2;
   struct {
     XNN_ALIGN(16) float sign_mask[4];
     XNN_ALIGN(16) float magic_bias[4];
@@ -748,91 +1226,113 @@ union xnn_f32_sigmoid_params {
     XNN_ALIGN(32) float sign_mask[8];
     XNN_ALIGN(32) float magic_bias[8];
     XNN_ALIGN(32) float log2e[8];
-    XNN_ALIGN(32) float minus_ln2_hi[8];
-    XNN_ALIGN(32) float minus_ln2_lo[8];
+    XNN_ALIGN(32) float minus_ln2[8];
     XNN_ALIGN(32) float c5[8];
     XNN_ALIGN(32) float c4[8];
     XNN_ALIGN(32) float c3[8];
     XNN_ALIGN(32) float c2[8];
     XNN_ALIGN(32) float c1[8];
     XNN_ALIGN(32) float one[8];
-    XNN_ALIGN(32) float two[8];
     XNN_ALIGN(32) float denorm_cutoff[8];
     int32_t mask_table[14];
-  } avx_rr2_p5;
+  } avx2_rr1_p5;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f16_tanh_params {
+  char _; // Dummy member variable to comply with the C standard
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
   struct {
     XNN_ALIGN(32) float sign_mask[8];
-    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float sat_cutoff[8];
     XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float magic_bias[8];
     XNN_ALIGN(32) float minus_ln2[8];
+    XNN_ALIGN(32) float c6[8];
     XNN_ALIGN(32) float c5[8];
     XNN_ALIGN(32) float c4[8];
     XNN_ALIGN(32) float c3[8];
     XNN_ALIGN(32) float c2[8];
-    XNN_ALIGN(32) float c1[8];
+    XNN_ALIGN(32) float minus_two[8];
     XNN_ALIGN(32) float one[8];
-    XNN_ALIGN(32) float denorm_cutoff[8];
-    int32_t mask_table[14];
-  } avx2_rr1_p5;
+  } avx2_expm1minus_rr1_p6;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+union xnn_f32_tanh_params {
   struct {
-    uint32_t sign_mask;
-    float magic_bias;
+    float sat_cutoff;
     float log2e;
-    float minus_ln2;
+    float magic_bias;
+    float minus_ln2_hi;
+    float minus_ln2_lo;
+    float c6;
+    float c5;
+    float c4;
     float c3;
     float c2;
+    float minus_two;
     float one;
-    XNN_ALIGN(64) float table[16];
-  } avx512_rr1_lut16_p3;
+  } scalar_expm1minus_rr2_p6;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
   struct {
-    uint32_t sign_mask;
-    float magic_bias;
+    float sat_cutoff;
     float log2e;
+    float magic_bias;
     float minus_ln2_hi;
     float minus_ln2_lo;
+    float c6;
+    float c5;
+    float c4;
+    float c3;
     float c2;
-    float c1;
-    float one;
-    XNN_ALIGN(64) float table_lo[16];
-    XNN_ALIGN(64) float table_hi[16];
-  } avx512_rr2_lut32_p2;
+    float minus_two;
+  } neon_expm1minus_rr2_p6;
   struct {
-    uint32_t sign_mask;
+    float sat_cutoff;
     float log2e;
+    float magic_bias;
     float minus_ln2;
+    float c6;
     float c5;
     float c4;
     float c3;
     float c2;
-    float c1;
-    float one;
-  } avx512_rr1_p5;
-#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
-#if XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+    float minus_two;
+  } neonfma_expm1minus_rr1_p6;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
   struct {
-    XNN_ALIGN(8) float magic_bias[2];
-    XNN_ALIGN(8) float minus_log2e[2];
-    XNN_ALIGN(8) uint32_t index_mask[2];
-    XNN_ALIGN(8) float ln2_hi[2];
-    XNN_ALIGN(8) float ln2_lo[2];
-    XNN_ALIGN(8) float c2[2];
-    XNN_ALIGN(8) float one[2];
-    XNN_ALIGN(8) float denorm_cutoff[2];
-  } wasmsimd_rr2_lut64_p2;
+    XNN_ALIGN(16) float sign_mask[4];
+    XNN_ALIGN(16) float sat_cutoff[4];
+    XNN_ALIGN(16) float log2e[4];
+    XNN_ALIGN(16) float magic_bias[4];
+    XNN_ALIGN(16) float minus_ln2_hi[4];
+    XNN_ALIGN(16) float minus_ln2_lo[4];
+    XNN_ALIGN(16) float c6[4];
+    XNN_ALIGN(16) float c5[4];
+    XNN_ALIGN(16) float c4[4];
+    XNN_ALIGN(16) float c3[4];
+    XNN_ALIGN(16) float c2[4];
+    XNN_ALIGN(16) float minus_two[4];
+    XNN_ALIGN(16) float one[4];
+  } sse2_expm1minus_rr2_p6;
   struct {
-    XNN_ALIGN(8) float magic_bias[2];
-    XNN_ALIGN(8) float minus_log2e[2];
-    XNN_ALIGN(8) float ln2_hi[2];
-    XNN_ALIGN(8) float ln2_lo[2];
-    XNN_ALIGN(8) float c5[2];
-    XNN_ALIGN(8) float c4[2];
-    XNN_ALIGN(8) float c3[2];
-    XNN_ALIGN(8) float c2[2];
-    XNN_ALIGN(8) float c1[2];
-    XNN_ALIGN(8) float one[2];
-    XNN_ALIGN(8) float denorm_cutoff[2];
-  } wasmsimd_rr2_p5;
-#endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
+    XNN_ALIGN(32) float sign_mask[8];
+    XNN_ALIGN(32) float sat_cutoff[8];
+    XNN_ALIGN(32) float log2e[8];
+    XNN_ALIGN(32) float magic_bias[8];
+    XNN_ALIGN(32) float minus_ln2[8];
+    XNN_ALIGN(32) float c6[8];
+    XNN_ALIGN(32) float c5[8];
+    XNN_ALIGN(32) float c4[8];
+    XNN_ALIGN(32) float c3[8];
+    XNN_ALIGN(32) float c2[8];
+    XNN_ALIGN(32) float minus_two[8];
+    XNN_ALIGN(32) float one[8];
+    int32_t mask_table[14];
+  } avx2_expm1minus_rr1_p6;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
 };
 
 union xnn_f32_sqrt_params {
@@ -1551,6 +2051,34 @@ union xnn_qs8_mul_minmax_params {
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 };
 
+// The scale field is the reciprocal of the output scale: the operation is computed on the dequantized inputs in FP32
+// and the result is multiplied by it to get the output in units of the output quantization step.
+union xnn_qs8_binary_minmax_params {
+  struct {
+    int32_t a_zero_point;
+    int32_t b_zero_point;
+    float a_scale;
+    float b_scale;
+    float scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+  } scalar;
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) int16_t a_zero_point[8];
+    XNN_ALIGN(16) int16_t b_zero_point[8];
+    XNN_ALIGN(16) float a_scale[4];
+    XNN_ALIGN(16) float b_scale[4];
+    XNN_ALIGN(16) float scale[4];
+    XNN_ALIGN(16) float output_max_less_zero_point[4];
+    XNN_ALIGN(16) int16_t output_zero_point[8];
+    XNN_ALIGN(16) int8_t output_min[16];
+  } sse4;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
 union xnn_qu8_avgpool_minmax_params {
   struct {
     int32_t init_bias;
@@ -2100,6 +2628,77 @@ union xnn_qu8_f32_cvt_params {
 #endif  // XNN_ARCH_WASMSIMD || XNN_ARCH_WASMRELAXEDSIMD
 };
 
+// Leaky ReLU on QS8 values is computed in fixed point: the input, less its zero point, is multiplied by the positive or
+// the negative multiplier (input-to-output scale ratio, times the negative slope for the negative multiplier) in Q12
+// format, and the bias adds the output zero point and the rounding constant.
+union xnn_qs8_lrelu_params {
+  struct {
+    int32_t input_zero_point;
+    int32_t positive_multiplier;
+    int32_t negative_multiplier;
+    int32_t bias;
+    int32_t output_min;
+    int32_t output_max;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    int16_t input_zero_point;
+    int32_t positive_multiplier;
+    int32_t negative_multiplier;
+    int32_t bias;
+    int8_t output_min;
+    int8_t output_max;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) int16_t input_zero_point[8];
+    XNN_ALIGN(16) int32_t positive_multiplier[4];
+    XNN_ALIGN(16) int32_t negative_multiplier[4];
+    XNN_ALIGN(16) int32_t bias[4];
+    XNN_ALIGN(16) int8_t output_min[16];
+    XNN_ALIGN(16) int8_t output_max[16];
+  } sse4;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
+// HardSwish on QS8 values is computed in FP32: the gate scale is the input scale divided by 6, and the scale is the
+// input-to-output scale ratio.
+union xnn_qs8_hswish_params {
+  struct {
+    int32_t input_zero_point;
+    float gate_scale;
+    float scale;
+    float output_min_less_zero_point;
+    float output_max_less_zero_point;
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+  } scalar;
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  struct {
+    int16_t input_zero_point;
+    float gate_scale;
+    float scale;
+    float magic_bias;
+    int32_t magic_bias_less_output_zero_point;
+    int8_t output_min;
+    int8_t output_max;
+  } neon;
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  struct {
+    XNN_ALIGN(16) int16_t input_zero_point[8];
+    XNN_ALIGN(16) float gate_scale[4];
+    XNN_ALIGN(16) float half[4];
+    XNN_ALIGN(16) float one[4];
+    XNN_ALIGN(16) float scale[4];
+    XNN_ALIGN(16) float output_max_less_zero_point[4];
+    XNN_ALIGN(16) int16_t output_zero_point[8];
+    XNN_ALIGN(16) int8_t output_min[16];
+  } sse4;
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+};
+
 typedef void (*xnn_ppmm_ukernel_function)(
     size_t mr,
     size_t nc,
@@ -2145,6 +2744,19 @@ typedef void (*xnn_gemm_ukernel_function)(
     size_t cn_stride,
     const void* params);
 
+typedef void (*xnn_dqgemm_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int8_t* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const void* params,
+    const struct xnn_qd8_quantization_params* quantization_params);
+
 typedef void (*xnn_f32_gemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -2206,29 +2818,77 @@ typedef void (*xnn_transposev_ukernel_function)(
     size_t block_width,
     size_t block_height);
 
-typedef void (*xnn_f32_gemm_relu_ukernel_function)(
+typedef void (*xnn_f32_gemm_relu_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const float* a,
+    size_t a_stride,
+    const float* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_relu_params* params);
+
+typedef void (*xnn_f32_gemm_minmax_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const float* a,
+    size_t a_stride,
+    const float* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params* params);
+
+typedef void (*xnn_f32_f16w_gemm_minmax_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const float* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params* params);
+
+typedef void (*xnn_bf16_gemm_minmax_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const void* a,
+    size_t a_stride,
+    const void* w,
+    void* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params* params);
+
+typedef void (*xnn_f32_qc4w_gemm_minmax_ukernel_function)(
     size_t mr,
     size_t nr,
     size_t k,
     const float* a,
     size_t a_stride,
-    const float* w,
+    const void* w,
     float* c,
     size_t cm_stride,
     size_t cn_stride,
-    const union xnn_f32_relu_params* params);
+    const union xnn_f32_qc4w_minmax_params* params);
 
-typedef void (*xnn_f32_gemm_minmax_ukernel_function)(
+// Computes int32 dot products of MR rows of int8 inputs with up to NR columns of one NR-block of packed int8 weights,
+// without the bias and without requantization.
+typedef void (*xnn_qs8_gemm_acc32_ukernel_function)(
     size_t mr,
     size_t nr,
     size_t k,
-    const float* a,
+    const int8_t* a,
     size_t a_stride,
-    const float* w,
-    float* c,
-    size_t cm_stride,
-    size_t cn_stride,
-    const union xnn_f32_minmax_params* params);
+    const void* w,
+    int32_t* c,
+    size_t cm_stride);
 
 typedef void (*xnn_f32_gemminc_minmax_ukernel_function)(
     size_t mr,
@@ -2281,6 +2941,32 @@ typedef void (*xnn_qc8_gemm_minmax_ukernel_function)(
     size_t cn_stride,
     const union xnn_qs8_minmax_params* params);
 
+typedef void (*xnn_qd8_f32_qc8w_gemm_minmax_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int8_t* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_minmax_params* params,
+    const struct xnn_qd8_quantization_params* quantization_params);
+
+typedef void (*xnn_qd8_f32_qc4w_gemm_minmax_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const int8_t* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    const union xnn_f32_qc4w_minmax_params* params,
+    const struct xnn_qd8_quantization_params* quantization_params);
+
 typedef void (*xnn_qs8_gemm_minmax_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -2361,6 +3047,20 @@ typedef void (*xnn_f32_igemm_minmax_ukernel_function)(
     const float* zero,
     const union xnn_f32_minmax_params* params);
 
+typedef void (*xnn_f32_f16w_igemm_minmax_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const float** a,
+    const void* w,
+    float* c,
+    size_t cm_stride,
+    size_t cn_stride,
+    size_t a_offset,
+    const float* zero,
+    const union xnn_f32_minmax_params* params);
+
 typedef void (*xnn_qu8_igemm_minmax_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -2525,6 +3225,31 @@ typedef void (*xnn_x32_packx_ukernel_function)(
     size_t x_stride,
     uint32_t* y);
 
+typedef void (*xnn_pack_gemm_goi_w_function)(
+    size_t g,
+    size_t nc,
+    size_t kc,
+    size_t nr,
+    size_t kr,
+    size_t sr,
+    const void* k,
+    const void* b,
+    void* packed_w,
+    size_t extra_bytes,
+    const void* params);
+
+typedef void (*xnn_pack_gemm_io_w_function)(
+    size_t nc,
+    size_t kc,
+    size_t nr,
+    size_t kr,
+    size_t sr,
+    const void* k,
+    const void* b,
+    void* packed_w,
+    size_t extra_bytes,
+    const void* params);
+
 typedef void (*xnn_fill_ukernel_function)(
     size_t rows,
     size_t channels,
@@ -2953,6 +3678,18 @@ typedef void (*xnn_qu8_avgpool_minmax_unipass_ukernel_function)(
     size_t output_increment,
     const union xnn_qu8_avgpool_minmax_params* params);
 
+typedef void (*xnn_qs8_avgpool_minmax_unipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params* params);
+
 typedef void (*xnn_avgpool_multipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -3005,6 +3742,19 @@ typedef void (*xnn_qu8_avgpool_minmax_multipass_ukernel_function)(
     size_t output_increment,
     const union xnn_qu8_avgpool_minmax_params* params);
 
+typedef void (*xnn_qs8_avgpool_minmax_multipass_ukernel_function)(
+    size_t output_pixels,
+    size_t kernel_elements,
+    size_t channels,
+    const int8_t** input,
+    size_t input_offset,
+    const int8_t* zero,
+    int32_t* buffer,
+    int8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union xnn_qs8_avgpool_minmax_params* params);
+
 typedef void (*xnn_pavgpool_unipass_ukernel_function)(
     size_t output_pixels,
     size_t kernel_elements,
@@ -3255,6 +4005,18 @@ typedef void (*xnn_f32_vlrelu_ukernel_function)(
     float* y,
     const union xnn_f32_lrelu_params* params);
 
+typedef void (*xnn_qs8_vlrelu_ukernel_function)(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_lrelu_params* params);
+
+typedef void (*xnn_qs8_vhswish_ukernel_function)(
+    size_t n,
+    const int8_t* x,
+    int8_t* y,
+    const union xnn_qs8_hswish_params* params);
+
 typedef void (*xnn_f32_vneg_ukernel_function)(
     size_t n,
     const float* x,
@@ -3279,6 +4041,66 @@ typedef void (*xnn_f32_vsigmoid_ukernel_function)(
     float* y,
     const union xnn_f32_sigmoid_params* params);
 
+typedef void (*xnn_f16_vexp_ukernel_function)(
+    size_t n,
+    const void* x,
+    void* y,
+    const union xnn_f16_exp_params* params);
+
+typedef void (*xnn_f32_vexp_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_exp_params* params);
+
+typedef void (*xnn_f16_vgelu_ukernel_function)(
+    size_t n,
+    const void* x,
+    void* y,
+    const union xnn_f16_gelu_params* params);
+
+typedef void (*xnn_f32_vgelu_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_gelu_params* params);
+
+typedef void (*xnn_f16_vlog_ukernel_function)(
+    size_t n,
+    const void* x,
+    void* y,
+    const union xnn_f16_log_params* params);
+
+typedef void (*xnn_f32_vlog_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_log_params* params);
+
+typedef void (*xnn_f16_vsilu_ukernel_function)(
+    size_t n,
+    const void* x,
+    void* y,
+    const union xnn_f16_silu_params* params);
+
+typedef void (*xnn_f32_vsilu_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_silu_params* params);
+
+typedef void (*xnn_f16_vtanh_ukernel_function)(
+    size_t n,
+    const void* x,
+    void* y,
+    const union xnn_f16_tanh_params* params);
+
+typedef void (*xnn_f32_vtanh_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y,
+    const union xnn_f32_tanh_params* params);
+
 typedef void (*xnn_rmax_ukernel_function)(
     size_t n,
     const void* x,
@@ -3299,12 +4121,72 @@ typedef void (*xnn_f32_rmax_ukernel_function)(
     const float* x,
     float* y);
 
+typedef void (*xnn_f32_rminmax_ukernel_function)(
+    size_t batch,
+    const float* input,
+    float* output);
+
+// Mean and variance reduction: output[0] receives the mean, output[1] the (biased) variance of the input elements.
+typedef void (*xnn_rmoments_ukernel_function)(
+    size_t batch,
+    const void* input,
+    float* output);
+
+typedef void (*xnn_f16_rmoments_ukernel_function)(
+    size_t batch,
+    const void* input,
+    float* output);
+
+typedef void (*xnn_f32_rmoments_ukernel_function)(
+    size_t batch,
+    const float* input,
+    float* output);
+
+// Sum reduction with FP32 output of FP16 or FP32 input elements.
+typedef void (*xnn_rsum_ukernel_function)(
+    size_t batch,
+    const void* input,
+    float* output);
+
+typedef void (*xnn_f16_rsum_ukernel_function)(
+    size_t batch,
+    const void* input,
+    float* output);
+
+typedef void (*xnn_f32_rsum_ukernel_function)(
+    size_t batch,
+    const float* input,
+    float* output);
+
+typedef void (*xnn_qs8_rsum_ukernel_function)(
+    size_t batch,
+    const int8_t* input,
+    int32_t* output);
+
 typedef void (*xnn_u8_lut32norm_ukernel_function)(
     size_t n,
     const uint8_t* x,
     const uint32_t* t,
     uint8_t* y);
 
+typedef void (*xnn_softmax_ukernel_function)(
+    size_t n,
+    const void* x,
+    const uint32_t* t,
+    void* y);
+
+typedef void (*xnn_qs8_softmax_ukernel_function)(
+    size_t n,
+    const int8_t* x,
+    const uint32_t* t,
+    int8_t* y);
+
+typedef void (*xnn_qu8_softmax_ukernel_function)(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y);
+
 typedef void (*xnn_vadd_ukernel_function)(
     size_t n,
     const void* a,
@@ -3387,6 +4269,13 @@ typedef void (*xnn_f32_vbinary_ukernel_function)(
     float* y,
     const union xnn_f32_default_params* params);
 
+typedef void (*xnn_qs8_vbinary_minmax_ukernel_function)(
+    size_t n,
+    const int8_t* input_a,
+    const int8_t* input_b,
+    int8_t* output,
+    const union xnn_qs8_binary_minmax_params* params);
+
 typedef void (*xnn_f32_vbinary_minmax_ukernel_function)(
     size_t n,
     const float* a,
@@ -3443,6 +4332,18 @@ typedef void (*xnn_f32_f16_vcvt_ukernel_function)(
     void* output,
     const union xnn_f32_f16_cvt_params* params);
 
+typedef void (*xnn_bf16_f32_vcvt_ukernel_function)(
+    size_t n,
+    const void* input,
+    float* output,
+    const void* params);
+
+typedef void (*xnn_f32_bf16_vcvt_ukernel_function)(
+    size_t n,
+    const float* input,
+    void* output,
+    const void* params);
+
 typedef void (*xnn_f32_qs8_vcvt_ukernel_function)(
     size_t n,
     const float* input,
@@ -3467,6 +4368,32 @@ typedef void (*xnn_qu8_f32_vcvt_ukernel_function)(
     float* output,
     const union xnn_qu8_f32_cvt_params* params);
 
+// Layer Normalization of a single row: output[i] = (input[i] - stats[0]) * stats[1] * gamma[i] + beta[i], where stats
+// holds the mean and the inverse standard deviation of the row.
+typedef void (*xnn_vlayernorm_ukernel_function)(
+    size_t batch,
+    const void* input,
+    const float* stats,
+    const void* gamma,
+    const void* beta,
+    void* output);
+
+typedef void (*xnn_f16_vlayernorm_ukernel_function)(
+    size_t batch,
+    const void* input,
+    const float* stats,
+    const void* gamma,
+    const void* beta,
+    void* output);
+
+typedef void (*xnn_f32_vlayernorm_ukernel_function)(
+    size_t batch,
+    const float* input,
+    const float* stats,
+    const float* gamma,
+    const float* beta,
+    float* output);
+
 typedef void (*xnn_vmulcaddc_ukernel_function)(
     size_t m,
     size_t c,
@@ -3497,6 +4424,20 @@ typedef void (*xnn_f32_vmulcaddc_ukernel_function)(
     size_t y_stride,
     const union xnn_f32_minmax_params* params);
 
+typedef void (*xnn_f32_winograd_input_ukernel_function)(
+    size_t channels,
+    const float** input,
+    float* output,
+    size_t output_stride);
+
+typedef void (*xnn_f32_winograd_output_ukernel_function)(
+    size_t channels,
+    const float* input,
+    size_t input_stride,
+    const float* bias,
+    float** output,
+    const union xnn_f32_minmax_params* params);
+
 typedef void (*xnn_prelu_ukernel_function)(
     size_t mr,
     size_t n,
@@ -3606,6 +4547,24 @@ typedef void (*xnn_init_qs8_f32_cvt_params_fn)(
   float scale,
   int8_t zero_point);
 
+typedef void (*xnn_init_qs8_lrelu_params_fn)(
+  union xnn_qs8_lrelu_params params[XNN_MIN_ELEMENTS(1)],
+  float positive_scale,
+  float negative_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max);
+
+typedef void (*xnn_init_qs8_hswish_params_fn)(
+  union xnn_qs8_hswish_params params[XNN_MIN_ELEMENTS(1)],
+  float input_scale,
+  float output_scale,
+  int8_t input_zero_point,
+  int8_t output_zero_point,
+  int8_t output_min,
+  int8_t output_max);
+
 typedef void (*xnn_init_qu8_f32_cvt_params_fn)(
   union xnn_qu8_f32_cvt_params params[XNN_MIN_ELEMENTS(1)],
   float scale,
@@ -3678,6 +4637,17 @@ typedef void (*xnn_init_qu8_addsub_minmax_params_fn)(
   uint8_t output_min,
   uint8_t output_max);
 
+typedef void (*xnn_init_qs8_binary_minmax_params_fn)(
+  union xnn_qs8_binary_minmax_params params[XNN_MIN_ELEMENTS(1)],
+  int8_t a_zero_point,
+  int8_t b_zero_point,
+  int8_t output_zero_point,
+  float a_scale,
+  float b_scale,
+  float output_scale,
+  int8_t output_min,
+  int8_t output_max);
+
 typedef void (*xnn_init_qs8_mul_minmax_params_fn)(
   union xnn_qs8_mul_minmax_params params[XNN_MIN_ELEMENTS(1)],
   int8_t a_zero_point,
@@ -3748,6 +4718,12 @@ typedef void (*xnn_init_f32_minmax_params_fn)(
   float output_min,
   float output_max);
 
+typedef void (*xnn_init_f32_qc4w_minmax_params_fn)(
+  union xnn_f32_qc4w_minmax_params params[XNN_MIN_ELEMENTS(1)],
+  float output_min,
+  float output_max,
+  uint8_t kernel_zero_point);
+
 typedef void (*xnn_init_f32_neg_params_fn)(
   union xnn_f32_neg_params params[XNN_MIN_ELEMENTS(1)]);
 
@@ -3770,6 +4746,36 @@ typedef void (*xnn_init_f16_sigmoid_params_fn)(
 typedef void (*xnn_init_f32_sigmoid_params_fn)(
   union xnn_f32_sigmoid_params params[XNN_MIN_ELEMENTS(1)]);
 
+typedef void (*xnn_init_f16_exp_params_fn)(
+  union xnn_f16_exp_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f32_exp_params_fn)(
+  union xnn_f32_exp_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f16_gelu_params_fn)(
+  union xnn_f16_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f32_gelu_params_fn)(
+  union xnn_f32_gelu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f16_log_params_fn)(
+  union xnn_f16_log_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f32_log_params_fn)(
+  union xnn_f32_log_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f16_silu_params_fn)(
+  union xnn_f16_silu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f32_silu_params_fn)(
+  union xnn_f32_silu_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f16_tanh_params_fn)(
+  union xnn_f16_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
+typedef void (*xnn_init_f32_tanh_params_fn)(
+  union xnn_f32_tanh_params params[XNN_MIN_ELEMENTS(1)]);
+
 typedef void (*xnn_init_f32_sqrt_params_fn)(
   union xnn_f32_sqrt_params params[XNN_MIN_ELEMENTS(1)]);
 
@@ -3836,6 +4842,24 @@ static inline bool xnn_is_hmp_gemm_ukernel(struct xnn_hmp_gemm_ukernel ukernel)
 #endif
 }
 
+struct xnn_hmp_dqgemm_ukernel {
+  xnn_dqgemm_ukernel_function function[XNN_MAX_UARCH_TYPES];
+#if XNN_PLATFORM_JIT
+  size_t generated_code_offset[XNN_MAX_UARCH_TYPES];
+#endif  // XNN_PLATFORM_JIT
+};
+
+static inline struct xnn_hmp_dqgemm_ukernel xnn_init_hmp_dqgemm_ukernel(xnn_dqgemm_ukernel_function function) {
+  struct xnn_hmp_dqgemm_ukernel ukernel = {{ function }};
+  for (size_t i = 1; i < XNN_MAX_UARCH_TYPES; i++) {
+    ukernel.function[i] = function;
+#if XNN_PLATFORM_JIT
+    ukernel.generated_code_offset[i] = SIZE_MAX;
+#endif  // XNN_PLATFORM_JIT
+  }
+  return ukernel;
+}
+
 struct xnn_hmp_igemm_ukernel {
   xnn_igemm_ukernel_function function[XNN_MAX_UARCH_TYPES];
 #if XNN_PLATFORM_JIT
@@ -3868,10 +4892,17 @@ static inline bool xnn_is_hmp_igemm_ukernel(struct xnn_hmp_igemm_ukernel ukernel
 }
 
 struct gemm_fused_ukernels {
-  struct xnn_hmp_gemm_ukernel gemm;
+  union {
+    struct xnn_hmp_gemm_ukernel gemm;
+    // GEMM micro-kernels on dynamically quantized inputs, which take per-row quantization parameters.
+    struct xnn_hmp_dqgemm_ukernel dqgemm;
+  };
   struct xnn_hmp_igemm_ukernel igemm;
   // Optional GEMM and IGEMM micro-kernels with MR=1 and the same NR and KR parameters.
-  struct xnn_hmp_gemm_ukernel gemm1;
+  union {
+    struct xnn_hmp_gemm_ukernel gemm1;
+    struct xnn_hmp_dqgemm_ukernel dqgemm1;
+  };
   struct xnn_hmp_igemm_ukernel igemm1;
 };
 
@@ -3957,6 +4988,7 @@ struct gemm_parameters {
     xnn_init_qu8_conv_minmax_params_fn qu8;
     xnn_init_f16_minmax_params_fn f16;
     xnn_init_f32_minmax_params_fn f32;
+    xnn_init_f32_qc4w_minmax_params_fn f32_qc4w;
   } init;
   uint8_t mr;
   uint8_t nr;
@@ -3967,16 +4999,24 @@ struct gemm_parameters {
 struct vunary_parameters {
   xnn_univector_ukernel_function ukernel;
   union {
+    xnn_init_f16_exp_params_fn f16_exp;
     xnn_init_f16_f32_cvt_params_fn f16_f32_cvt;
+    xnn_init_f16_gelu_params_fn f16_gelu;
     xnn_init_f16_hswish_params_fn f16_hswish;
+    xnn_init_f16_log_params_fn f16_log;
     xnn_init_f16_lrelu_params_fn f16_lrelu;
     xnn_init_f16_minmax_params_fn f16_minmax;
     xnn_init_f16_sigmoid_params_fn f16_sigmoid;
+    xnn_init_f16_silu_params_fn f16_silu;
+    xnn_init_f16_tanh_params_fn f16_tanh;
     xnn_init_f32_abs_params_fn f32_abs;
     xnn_init_f32_default_params_fn f32_default;
     xnn_init_f32_elu_params_fn f32_elu;
+    xnn_init_f32_exp_params_fn f32_exp;
     xnn_init_f32_f16_cvt_params_fn f32_f16_cvt;
+    xnn_init_f32_gelu_params_fn f32_gelu;
     xnn_init_f32_hswish_params_fn f32_hswish;
+    xnn_init_f32_log_params_fn f32_log;
     xnn_init_f32_lrelu_params_fn f32_lrelu;
     xnn_init_f32_minmax_params_fn f32_minmax;
     xnn_init_f32_neg_params_fn f32_neg;
@@ -3984,8 +5024,12 @@ struct vunary_parameters {
     xnn_init_f32_qu8_cvt_params_fn f32_qu8_cvt;
     xnn_init_f32_rnd_params_fn f32_rnd;
     xnn_init_f32_sigmoid_params_fn f32_sigmoid;
+    xnn_init_f32_silu_params_fn f32_silu;
     xnn_init_f32_sqrt_params_fn f32_sqrt;
+    xnn_init_f32_tanh_params_fn f32_tanh;
     xnn_init_qs8_f32_cvt_params_fn qs8_f32_cvt;
+    xnn_init_qs8_hswish_params_fn qs8_hswish;
+    xnn_init_qs8_lrelu_params_fn qs8_lrelu;
     xnn_init_qu8_f32_cvt_params_fn qu8_f32_cvt;
     xnn_init_s8_minmax_params_fn s8_minmax;
     xnn_init_u8_minmax_params_fn u8_minmax;
@@ -4009,6 +5053,7 @@ struct vbinary_parameters {
     xnn_init_f32_default_params_fn f32_default;
     xnn_init_f32_minmax_params_fn f32_minmax;
     xnn_init_qs8_addsub_minmax_params_fn qs8_addsub;
+    xnn_init_qs8_binary_minmax_params_fn qs8_binary;
     xnn_init_qs8_mul_minmax_params_fn qs8_mul;
     xnn_init_qu8_addsub_minmax_params_fn qu8_addsub;
     xnn_init_qu8_mul_minmax_params_fn qu8_mul;
@@ -4114,6 +5159,7 @@ struct avgpool_parameters {
   xnn_avgpool_multipass_ukernel_function multipass;
   union {
     xnn_init_f32_scaleminmax_params_fn f32;
+    xnn_init_qs8_avgpool_minmax_params_fn qs8;
     xnn_init_qu8_avgpool_minmax_params_fn qu8;
   } init;
   // Number of rows in a primary tile.
@@ -4202,6 +5248,11 @@ struct prelu_parameters {
   uint16_t channel_tile;
 };
 
+struct layernorm_parameters {
+  xnn_rmoments_ukernel_function rmoments;
+  xnn_vlayernorm_ukernel_function vlayernorm;
+};
+
 struct raddstoreexpminusmax_parameters {
   xnn_raddstoreexpminusmax_ukernel_function ukernel;
   union {
@@ -4237,6 +5288,17 @@ struct vmulcaddc_parameters {
   uint8_t row_tile;
 };
 
+struct winograd_parameters {
+  // Transforms a 4x4 input tile into 16 transformed rows for the F(2x2, 3x3) algorithm.
+  xnn_f32_winograd_input_ukernel_function input;
+  // Transforms 16 rows of GEMM outputs into a 2x2 output tile, adds bias and clamps the result.
+  xnn_f32_winograd_output_ukernel_function output;
+  union {
+    xnn_init_f32_minmax_params_fn f32;
+  } init;
+  uint8_t channel_tile;
+};
+
 #define XNN_MAX_QC8_DWCONV_UKERNELS 2
 #define XNN_MAX_QS8_DWCONV_UKERNELS 2
 #define XNN_MAX_QU8_DWCONV_UKERNELS 2
@@ -4275,21 +5337,51 @@ struct vmulcaddc_parameters {
 #define XNN_INIT_FLAG_VCVT       0x00002000
 // Indicates that CHW XNNPACK microkernels are optimized for the host platform.
 #define XNN_INIT_FLAG_CHW_OPT    0x00004000
+// Indicates that BF16 XNNPACK microkernels are available for use.
+#define XNN_INIT_FLAG_BF16       0x00008000
 
 struct xnn_parameters {
   // Bitwise combination of XNN_INIT_FLAG_* flags
   uint32_t init_flags;
   struct xnn_allocator allocator;
+  // Size of L1 data cache and L2 cache of the first core in bytes, or 0 if unknown.
+  uint32_t l1d_cache_size;
+  uint32_t l2_cache_size;
   struct {
     struct gemm_parameters gemm;
+    // Partial-sum variant of the gemm.minmax micro-kernel with the same MR x NR tile and packing, used to split the
+    // reduction dimension in the split-K Fully Connected path. NULL if not available on this architecture.
+    xnn_qs8_gemm_acc32_ukernel_function gemm_acc32;
     struct dwconv_parameters dwconv[XNN_MAX_QC8_DWCONV_UKERNELS];
   } qc8;
+  struct {
+    // GEMM micro-kernels with int8 inputs quantized on the fly with per-row parameters, per-channel quantized int8
+    // weights, and FP32 outputs, in the dqgemm members of minmax.
+    struct gemm_parameters gemm;
+  } qd8_f32_qc8w;
+  struct {
+    // GEMM micro-kernels with int8 inputs quantized on the fly with per-row parameters, per-channel quantized 4-bit
+    // weights, and FP32 outputs, in the dqgemm members of minmax.
+    struct gemm_parameters gemm;
+  } qd8_f32_qc4w;
   struct {
     struct gemm_parameters gemm;
+    // Partial-sum variant of the gemm.minmax micro-kernel with the same MR x NR tile and packing, used to split the
+    // reduction dimension in the split-K Fully Connected path. NULL if not available on this architecture.
+    xnn_qs8_gemm_acc32_ukernel_function gemm_acc32;
     struct dwconv_parameters dwconv[XNN_MAX_QS8_DWCONV_UKERNELS];
+    struct avgpool_parameters avgpool;
     struct gavgpool_parameters gavgpool;
+    struct vunary_parameters hswish;
+    struct vunary_parameters lrelu;
     struct vbinary_parameters vadd;
+    struct vbinary_parameters vdiv;
+    struct vbinary_parameters vmax;
+    struct vbinary_parameters vmin;
     struct vbinary_parameters vmul;
+    struct vbinary_parameters vsqrdiff;
+    xnn_qs8_rsum_ukernel_function rsum;
+    xnn_qs8_softmax_ukernel_function softmax;
   } qs8;
   struct {
     struct gemm_parameters gemm;
@@ -4298,6 +5390,7 @@ struct xnn_parameters {
     struct gavgpool_parameters gavgpool;
     struct vbinary_parameters vadd;
     struct vbinary_parameters vmul;
+    xnn_qu8_softmax_ukernel_function softmax;
   } qu8;
   struct {
     struct vunary_parameters clamp;
@@ -4310,7 +5403,6 @@ struct xnn_parameters {
     // Bilinear interpolation (2D).
     struct ibilinear_parameters ibilinear;
     struct maxpool_parameters maxpool;
-    xnn_u8_lut32norm_ukernel_function lut32norm;
     xnn_u8_rmax_ukernel_function rmax;
   } u8;
   struct {
@@ -4321,6 +5413,11 @@ struct xnn_parameters {
   struct {
     struct transpose_parameters transpose;
   } x16;
+  struct {
+    // GEMM micro-kernels with BF16 inputs, weights, and outputs, FP32 biases, and FP32 accumulation. The micro-kernels
+    // are cast back to xnn_bf16_gemm_minmax_ukernel_function when called. Left zero-initialized if not available.
+    struct gemm_parameters gemm;
+  } bf16;
   struct {
     struct gavgpool_parameters gavgpool;
     struct gemm_parameters gemm;
@@ -4330,19 +5427,36 @@ struct xnn_parameters {
     struct ibilinear_parameters ibilinear;
     struct maxpool_parameters maxpool;
     struct vunary_parameters clamp;
+    struct vunary_parameters exp;
+    struct vunary_parameters gelu;
     struct vunary_parameters hswish;
+    struct vunary_parameters log;
     struct vunary_parameters lrelu;
     struct vunary_parameters sigmoid;
+    struct vunary_parameters silu;
+    struct vunary_parameters tanh;
     struct prelu_parameters prelu;
     struct vbinary_parameters vadd;
     struct vbinary_parameters vmul;
     struct vmulcaddc_parameters vmulcaddc;
     struct raddstoreexpminusmax_parameters raddstoreexpminusmax;
     xnn_rmax_ukernel_function rmax;
+    xnn_f16_rsum_ukernel_function rsum;
+    struct layernorm_parameters layernorm;
   } f16;
   struct {
     struct gemm_parameters gemm;
     struct gemm_parameters gemm2;
+    // Accumulating variant of the gemm.minmax micro-kernel with the same MR x NR tile and packing, used to split the
+    // reduction dimension in the cache-blocked Fully Connected path. NULL if not available on this architecture.
+    xnn_f32_gemminc_minmax_ukernel_function gemminc;
+    // Variant of the gemm micro-kernels which read FP16 packed weights, used by Fully Connected and Convolution
+    // operators created with XNN_FLAG_FP16_STATIC_WEIGHTS. Has its own MR x NR tile. Left zero-initialized if not
+    // available.
+    struct gemm_parameters gemm_f16w;
+    // Variant of the gemm micro-kernels which read per-channel quantized 4-bit packed weights, used by the F32-QC4W
+    // Fully Connected operator. Has its own MR x NR tile. Left zero-initialized if not available.
+    struct gemm_parameters gemm_qc4w;
     struct dwconv_parameters dwconv[XNN_MAX_F32_DWCONV_UKERNELS];
     struct avgpool_parameters avgpool;
     struct pavgpool_parameters pavgpool;
@@ -4354,7 +5468,10 @@ struct xnn_parameters {
     struct vunary_parameters abs;
     struct vunary_parameters clamp;
     struct vunary_parameters elu;
+    struct vunary_parameters exp;
+    struct vunary_parameters gelu;
     struct vunary_parameters hswish;
+    struct vunary_parameters log;
     struct vunary_parameters lrelu;
     struct vunary_parameters neg;
     struct vunary_parameters relu;
@@ -4363,8 +5480,10 @@ struct xnn_parameters {
     struct vunary_parameters rndu;
     struct vunary_parameters rndd;
     struct vunary_parameters sigmoid;
+    struct vunary_parameters silu;
     struct vunary_parameters sqr;
     struct vunary_parameters sqrt;
+    struct vunary_parameters tanh;
     struct prelu_parameters prelu;
     struct vbinary_parameters vadd;
     struct vbinary_parameters vdiv;
@@ -4374,8 +5493,14 @@ struct xnn_parameters {
     struct vbinary_parameters vsub;
     struct vbinary_parameters vsqrdiff;
     struct vmulcaddc_parameters vmulcaddc;
+    // Winograd F(2x2, 3x3) input and output transforms for 3x3 stride-1 Convolution in NHWC layout.
+    struct winograd_parameters winograd;
     struct raddstoreexpminusmax_parameters raddstoreexpminusmax;
     xnn_rmax_ukernel_function rmax;
+    // Fused minimum and maximum reduction: output[0] receives the minimum, output[1] the maximum.
+    xnn_f32_rminmax_ukernel_function rminmax;
+    xnn_f32_rsum_ukernel_function rsum;
+    struct layernorm_parameters layernorm;
     // Sparse Matrix-Dense Matrix Multiplication (NR=1 block).
     struct spmm_parameters spmm;
     // Sparse Matrix-Dense Matrix Multiplication (NR=2 block).
@@ -4398,7 +5523,9 @@ struct xnn_parameters {
     struct ibilinear_chw_parameters ibilinear_chw;
   } f32;
   struct {
+    struct vunary_parameters bf16_to_f32;
     struct vunary_parameters f16_to_f32;
+    struct vunary_parameters f32_to_bf16;
     struct vunary_parameters f32_to_f16;
     struct vunary_parameters f32_to_qs8;
     struct vunary_parameters f32_to_qu8;
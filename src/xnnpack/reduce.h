@@ -0,0 +1,134 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DECLARE_F16_RSUM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t batch,                                \
+      const void* input,                           \
+      float* output);
+
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__avx512skx_x16)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__avx512skx_x32_acc2)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__avx512skx_x64_acc4)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__f16c_x8)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__f16c_x16_acc2)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__f16c_x32_acc4)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__neonfp16_x8)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__neonfp16_x16_acc2)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__neonfp16_x32_acc4)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__scalar_x1)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__scalar_x2_acc2)
+DECLARE_F16_RSUM_UKERNEL_FUNCTION(xnn_f16_rsum_ukernel__scalar_x4_acc4)
+
+
+#define DECLARE_F16_RMOMENTS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                           \
+      size_t batch,                                    \
+      const void* input,                               \
+      float* output);
+
+DECLARE_F16_RMOMENTS_UKERNEL_FUNCTION(xnn_f16_rmoments_ukernel__f16c_x16)
+DECLARE_F16_RMOMENTS_UKERNEL_FUNCTION(xnn_f16_rmoments_ukernel__f16c_x32)
+DECLARE_F16_RMOMENTS_UKERNEL_FUNCTION(xnn_f16_rmoments_ukernel__neonfp16_x8)
+DECLARE_F16_RMOMENTS_UKERNEL_FUNCTION(xnn_f16_rmoments_ukernel__neonfp16_x16)
+
+
+#define DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                          \
+      size_t batch,                                   \
+      const float* input,                             \
+      float* output);
+
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx_x8)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx_x16_acc2)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx_x32_acc4)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx512f_x16)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx512f_x32_acc2)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__avx512f_x64_acc4)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__neon_x4)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__neon_x8_acc2)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__neon_x16_acc4)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__scalar_x1)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__scalar_x2_acc2)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__scalar_x4_acc4)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__sse_x4)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__sse_x8_acc2)
+DECLARE_F32_RMINMAX_UKERNEL_FUNCTION(xnn_f32_rminmax_ukernel__sse_x16_acc4)
+
+
+#define DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                           \
+      size_t batch,                                    \
+      const float* input,                              \
+      float* output);
+
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__avx_x16)
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__avx_x32)
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__neon_x8)
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__neon_x16)
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__scalar_x1)
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__scalar_x4)
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__sse_x8)
+DECLARE_F32_RMOMENTS_UKERNEL_FUNCTION(xnn_f32_rmoments_ukernel__sse_x16)
+
+
+#define DECLARE_F32_RSUM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t batch,                                \
+      const float* input,                          \
+      float* output);
+
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx_x8)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx_x16_acc2)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx_x32_acc4)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx512f_x16)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx512f_x32_acc2)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__avx512f_x64_acc4)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__neon_x4)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__neon_x8_acc2)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__neon_x16_acc4)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__scalar_x1)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__scalar_x2_acc2)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__scalar_x4_acc4)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__sse_x4)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__sse_x8_acc2)
+DECLARE_F32_RSUM_UKERNEL_FUNCTION(xnn_f32_rsum_ukernel__sse_x16_acc4)
+
+
+#define DECLARE_QS8_RSUM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t batch,                                \
+      const int8_t* input,                         \
+      int32_t* output);
+
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__avx2_x32)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__avx2_x64_acc2)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__avx2_x128_acc4)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__neon_x16)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__neon_x32_acc2)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__neon_x64_acc4)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__scalar_x1)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__scalar_x2_acc2)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__scalar_x4_acc4)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__sse2_x16)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__sse2_x32_acc2)
+DECLARE_QS8_RSUM_UKERNEL_FUNCTION(xnn_qs8_rsum_ukernel__sse2_x64_acc4)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
@@ -101,9 +101,28 @@ struct xnn_value {
   /// Set during analysis in xnn_subgraph_rewrite_for_fp16.
   /// Indicates Value ID of the FP16 variant of this Value.
   uint32_t fp16_id;
-  /// Set during analysis in xnn_subgraph_rewrite_for_fp16.
+  /// Set during analysis in xnn_subgraph_rewrite_for_bf16.
+  /// Indicates that this value should be converted to BF16.
+  bool bf16_compatible;
+  /// Set during analysis in xnn_subgraph_rewrite_for_bf16.
+  /// Indicates Value ID of the BF16 variant of this Value.
+  uint32_t bf16_id;
+  /// Set during analysis in xnn_subgraph_rewrite_for_fp16, xnn_subgraph_rewrite_for_bf16, and
+  /// xnn_subgraph_rewrite_for_qs8.
   /// Indicates Value ID of the FP32 variant of this Value.
   uint32_t fp32_id;
+  /// Set during analysis in xnn_subgraph_rewrite_for_qs8.
+  /// Indicates that this value should be converted to QS8.
+  bool qs8_compatible;
+  /// Set during analysis in xnn_subgraph_rewrite_for_qs8.
+  /// Indicates Value ID of the QS8 variant of this Value.
+  uint32_t qs8_id;
+  /// Indicates that range_min and range_max were set with xnn_set_subgraph_value_range.
+  bool has_range;
+  /// Expected range of elements of an FP32 Value, used to derive quantization parameters in
+  /// xnn_subgraph_rewrite_for_qs8.
+  float range_min;
+  float range_max;
 };
 
 struct xnn_blob {
@@ -112,6 +131,16 @@ struct xnn_blob {
   /// Data pointer.
   void* data;
   bool external;
+  /// Blob aliases the memory of another blob, and its data pointer is computed in xnn_setup_runtime.
+  bool view;
+  /// Datatype of the Value backing this blob.
+  enum xnn_datatype datatype;
+};
+
+/// Range of values observed in a Value, recorded when XNN_FLAG_COLLECT_VALUE_RANGES is specified.
+struct xnn_value_range {
+  float min;
+  float max;
 };
 
 struct xnn_node;
@@ -137,9 +166,20 @@ enum xnn_compute_type {
   xnn_compute_type_qc8,
   xnn_compute_type_qs8,
   xnn_compute_type_qu8,
+  // FP32 input and output, with INT8 channelwise-quantized weights and dynamically quantized input.
+  xnn_compute_type_qd8_f32_qc8w,
+  // QS8 input and FP32 output, with INT8 channelwise-quantized weights. Produced by fusing a QS8->FP32 Convert Node
+  // into the consumer of its output.
+  xnn_compute_type_qs8_f32_qc8w,
+  // FP32 input and output, with 4-bit channelwise-quantized weights.
+  xnn_compute_type_fp32_qc4w,
+  // BF16 input and output, with FP32 static weights converted to BF16 during packing and FP32 accumulation.
+  xnn_compute_type_bf16,
+  xnn_compute_type_fp32_to_bf16,
   xnn_compute_type_fp32_to_fp16,
   xnn_compute_type_fp32_to_qs8,
   xnn_compute_type_fp32_to_qu8,
+  xnn_compute_type_bf16_to_fp32,
   xnn_compute_type_fp16_to_fp32,
   xnn_compute_type_qs8_to_fp32,
   xnn_compute_type_qu8_to_fp32,
@@ -166,6 +206,33 @@ struct xnn_node {
       size_t group_input_channels;
       size_t group_output_channels;
     } convolution_2d;
+    struct {
+      uint32_t input_padding_front;
+      uint32_t input_padding_back;
+      uint32_t input_padding_top;
+      uint32_t input_padding_right;
+      uint32_t input_padding_bottom;
+      uint32_t input_padding_left;
+      uint32_t kernel_depth;
+      uint32_t kernel_height;
+      uint32_t kernel_width;
+      uint32_t subsampling_depth;
+      uint32_t subsampling_height;
+      uint32_t subsampling_width;
+      uint32_t dilation_depth;
+      uint32_t dilation_height;
+      uint32_t dilation_width;
+      uint32_t groups;
+      size_t group_input_channels;
+      size_t group_output_channels;
+    } convolution_3d;
+    struct {
+      uint32_t kernel_size;
+      uint32_t dilation;
+      uint32_t groups;
+      size_t group_input_channels;
+      size_t group_output_channels;
+    } streaming_convolution_1d;
     struct {
       uint32_t padding_top;
       uint32_t padding_right;
@@ -212,12 +279,41 @@ struct xnn_node {
       uint32_t dilation_height;
       uint32_t dilation_width;
     } pooling_2d;
+    struct {
+      uint32_t padding_front;
+      uint32_t padding_back;
+      uint32_t padding_top;
+      uint32_t padding_right;
+      uint32_t padding_bottom;
+      uint32_t padding_left;
+      uint32_t pooling_depth;
+      uint32_t pooling_height;
+      uint32_t pooling_width;
+      uint32_t stride_depth;
+      uint32_t stride_height;
+      uint32_t stride_width;
+    } pooling_3d;
     struct {
       float alpha;
     } elu;
+    struct {
+      // xnn_reduce_invalid for plain lookups, xnn_reduce_sum or xnn_reduce_mean for bags.
+      enum xnn_reduce_operator bag_operator;
+    } embedding_lookup;
+    struct {
+      float epsilon;
+    } layer_normalization;
     struct {
       float negative_slope;
     } leaky_relu;
+    struct {
+      enum xnn_reduce_operator reduce_operator;
+      size_t num_reduction_axes;
+      size_t reduction_axes[XNN_MAX_TENSOR_DIMS];
+    } reduce;
+    struct {
+      float scale;
+    } scaled_dot_product_attention;
     struct {
       size_t pre_paddings[XNN_MAX_TENSOR_DIMS];
       size_t post_paddings[XNN_MAX_TENSOR_DIMS];
@@ -226,6 +322,10 @@ struct xnn_node {
     struct {
       struct xnn_shape new_shape;
     } static_reshape;
+    struct {
+      size_t offsets[XNN_MAX_TENSOR_DIMS];
+      size_t sizes[XNN_MAX_TENSOR_DIMS];
+    } static_slice;
     struct {
       size_t new_height;
       size_t new_width;
@@ -236,6 +336,9 @@ struct xnn_node {
     struct {
       size_t axis;
     } even_split;
+    struct {
+      size_t k;
+    } topk;
   } params;
   struct {
     float output_min;
@@ -276,6 +379,7 @@ struct xnn_operator_data {
   xnn_operator_t operator_objects[XNN_MAX_OPERATOR_OBJECTS];
   xnn_setup_operator_fn setup;
   size_t batch_size;
+  size_t input_depth;
   size_t input_height;
   size_t input_width;
   size_t output_height;
@@ -284,10 +388,20 @@ struct xnn_operator_data {
   struct xnn_shape shape2;
   size_t pre_paddings[XNN_MAX_TENSOR_DIMS];
   size_t post_paddings[XNN_MAX_TENSOR_DIMS];
+  size_t num_reduction_axes;
+  size_t reduction_axes[XNN_MAX_TENSOR_DIMS];
+  size_t offsets[XNN_MAX_TENSOR_DIMS];
+  size_t sizes[XNN_MAX_TENSOR_DIMS];
+  // Nodes which can be computed without running an operator (e.g. a Static Slice of a contiguous block) leave
+  // operator_objects empty and set output_is_view: their output aliases the memory of inputs[0] at view_offset bytes.
+  bool output_is_view;
+  size_t view_offset;
   uint32_t adjustment_height;
   uint32_t adjustment_width;
   uint32_t inputs[XNN_MAX_RUNTIME_INPUTS];
   uint32_t outputs[XNN_MAX_RUNTIME_OUTPUTS];
+  uint32_t num_inputs;
+  uint32_t num_outputs;
   xnn_timestamp end_ts[XNN_MAX_OPERATOR_OBJECTS];
 };
 
@@ -328,6 +442,10 @@ struct xnn_runtime {
   bool profiling;
   // The start timestamp of the first operator in the subgraph. This is set when profiling is true.
   xnn_timestamp start_ts;
+
+  // Ranges of values observed in every blob, one entry per blob. NULL unless XNN_FLAG_COLLECT_VALUE_RANGES was
+  // specified.
+  struct xnn_value_range* value_ranges;
 };
 
 struct xnn_value* xnn_subgraph_new_internal_value(xnn_subgraph_t subgraph);
@@ -352,6 +470,32 @@ enum xnn_status xnn_subgraph_optimize(xnn_subgraph_t subgraph, uint32_t flags);
 
 void xnn_subgraph_rewrite_for_nchw(xnn_subgraph_t subgraph);
 
+bool xnn_subgraph_rewrite_for_bf16(xnn_subgraph_t subgraph);
+
+bool xnn_subgraph_rewrite_for_qs8(xnn_subgraph_t subgraph);
+
+// Per-output-channel quantized copy of FP32 static weights, created for Nodes rewritten by
+// xnn_subgraph_rewrite_for_qs8.
+struct xnn_qc8_weights {
+  int8_t* filter;
+  float* filter_scale;
+  int32_t* bias;
+};
+
+// Quantizes FP32 filter to INT8 with a symmetric per-channel scale, and FP32 bias (if not NULL) to INT32 with
+// input_scale * filter_scale. Element k of channel c is filter[c * channel_stride + k * element_stride].
+enum xnn_status xnn_quantize_qc8_weights(
+  size_t channels,
+  size_t channel_size,
+  size_t channel_stride,
+  size_t element_stride,
+  const float* filter,
+  const float* bias,
+  float input_scale,
+  struct xnn_qc8_weights* weights);
+
+void xnn_release_qc8_weights(struct xnn_qc8_weights* weights);
+
 void xnn_node_clear(struct xnn_node* node);
 void xnn_value_clear(struct xnn_value* value);
 
@@ -20,4 +20,5 @@ enum xnn_ukernel_type {
   xnn_ukernel_type_spmm,
   xnn_ukernel_type_subconv2d,
   xnn_ukernel_type_vmulcaddc,
+  xnn_ukernel_type_winograd,
 };
\ No newline at end of file
@@ -685,6 +685,59 @@ DECLARE_F32_VBINOP_RELU_UKERNEL_FUNCTION(xnn_f32_vrsubc_relu_ukernel__wasmsimd_x
 DECLARE_F32_VBINOP_RELU_UKERNEL_FUNCTION(xnn_f32_vrsubc_relu_ukernel__wasmsimd_x8)
 DECLARE_F32_VBINOP_RELU_UKERNEL_FUNCTION(xnn_f32_vrsubc_relu_ukernel__wasmsimd_x16)
 
+#define DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                \
+      size_t n,                                             \
+      const int8_t* input_a,                                \
+      const int8_t* input_b,                                \
+      int8_t* output,                                       \
+      const union xnn_qs8_binary_minmax_params* params);
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdiv_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdiv_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdiv_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdiv_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdivc_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdivc_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdivc_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vdivc_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vrdivc_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vrdivc_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vrdivc_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vrdivc_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmax_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmax_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmax_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmax_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmaxc_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmaxc_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmaxc_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmaxc_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmin_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmin_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmin_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vmin_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vminc_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vminc_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vminc_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vminc_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiff_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiff_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiff_minmax_ukernel__sse41_x16)
+
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x1)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiffc_minmax_ukernel__scalar_x4)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiffc_minmax_ukernel__sse41_x8)
+DECLARE_QS8_VBINOP_MINMAX_UKERNEL_FUNCTION(xnn_qs8_vsqrdiffc_minmax_ukernel__sse41_x16)
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -377,6 +377,40 @@ DECLARE_QU8_F32_VCVT_UKERNEL_FUNCTION(xnn_qu8_f32_vcvt_ukernel__scalar_x3)
 DECLARE_QU8_F32_VCVT_UKERNEL_FUNCTION(xnn_qu8_f32_vcvt_ukernel__scalar_x4)
 
 
+#define DECLARE_BF16_F32_VCVT_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                            \
+      size_t n,                                         \
+      const void* input,                                \
+      float* output,                                    \
+      const void* params);
+
+DECLARE_BF16_F32_VCVT_UKERNEL_FUNCTION(xnn_bf16_f32_vcvt_ukernel__sse2_x8)
+DECLARE_BF16_F32_VCVT_UKERNEL_FUNCTION(xnn_bf16_f32_vcvt_ukernel__sse2_x16)
+
+DECLARE_BF16_F32_VCVT_UKERNEL_FUNCTION(xnn_bf16_f32_vcvt_ukernel__avx2_x8)
+DECLARE_BF16_F32_VCVT_UKERNEL_FUNCTION(xnn_bf16_f32_vcvt_ukernel__avx2_x16)
+
+DECLARE_BF16_F32_VCVT_UKERNEL_FUNCTION(xnn_bf16_f32_vcvt_ukernel__scalar_x1)
+DECLARE_BF16_F32_VCVT_UKERNEL_FUNCTION(xnn_bf16_f32_vcvt_ukernel__scalar_x4)
+
+
+#define DECLARE_F32_BF16_VCVT_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                            \
+      size_t n,                                         \
+      const float* input,                               \
+      void* output,                                     \
+      const void* params);
+
+DECLARE_F32_BF16_VCVT_UKERNEL_FUNCTION(xnn_f32_bf16_vcvt_ukernel__sse2_x8)
+DECLARE_F32_BF16_VCVT_UKERNEL_FUNCTION(xnn_f32_bf16_vcvt_ukernel__sse2_x16)
+
+DECLARE_F32_BF16_VCVT_UKERNEL_FUNCTION(xnn_f32_bf16_vcvt_ukernel__avx2_x8)
+DECLARE_F32_BF16_VCVT_UKERNEL_FUNCTION(xnn_f32_bf16_vcvt_ukernel__avx2_x16)
+
+DECLARE_F32_BF16_VCVT_UKERNEL_FUNCTION(xnn_f32_bf16_vcvt_ukernel__scalar_x1)
+DECLARE_F32_BF16_VCVT_UKERNEL_FUNCTION(xnn_f32_bf16_vcvt_ukernel__scalar_x4)
+
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
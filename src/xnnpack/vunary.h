@@ -44,6 +44,22 @@ DECLARE_F16_VHSWISH_UKERNEL_FUNCTION(xnn_f16_vhswish_ukernel__f16c_x8)
 DECLARE_F16_VHSWISH_UKERNEL_FUNCTION(xnn_f16_vhswish_ukernel__f16c_x16)
 
 
+#define DECLARE_F16_VLAYERNORM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                             \
+      size_t batch,                                      \
+      const void* input,                                 \
+      const float* stats,                                \
+      const void* gamma,                                 \
+      const void* beta,                                  \
+      void* output);
+
+DECLARE_F16_VLAYERNORM_UKERNEL_FUNCTION(xnn_f16_vlayernorm_ukernel__neonfp16_x8)
+DECLARE_F16_VLAYERNORM_UKERNEL_FUNCTION(xnn_f16_vlayernorm_ukernel__neonfp16_x16)
+
+DECLARE_F16_VLAYERNORM_UKERNEL_FUNCTION(xnn_f16_vlayernorm_ukernel__f16c_x8)
+DECLARE_F16_VLAYERNORM_UKERNEL_FUNCTION(xnn_f16_vlayernorm_ukernel__f16c_x16)
+
+
 #define DECLARE_F16_VSIGMOID_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                           \
       size_t batch,                                    \
@@ -97,6 +113,61 @@ DECLARE_F16_VSIGMOID_UKERNEL_FUNCTION(xnn_f16_vsigmoid_ukernel__neonfp16arith_rr
 DECLARE_F16_VSIGMOID_UKERNEL_FUNCTION(xnn_f16_vsigmoid_ukernel__neonfp16arith_rr2_p2_nr1recps_x64)
 
 
+#define DECLARE_F16_VEXP_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t batch,                                \
+      const void* input,                           \
+      void* output,                                \
+      const union xnn_f16_exp_params* params);
+
+DECLARE_F16_VEXP_UKERNEL_FUNCTION(xnn_f16_vexp_ukernel__avx2_rr2_p5_x8)
+DECLARE_F16_VEXP_UKERNEL_FUNCTION(xnn_f16_vexp_ukernel__avx2_rr2_p5_x16)
+
+
+#define DECLARE_F16_VGELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t batch,                                 \
+      const void* input,                            \
+      void* output,                                 \
+      const union xnn_f16_gelu_params* params);
+
+DECLARE_F16_VGELU_UKERNEL_FUNCTION(xnn_f16_vgelu_ukernel__avx2_rr1_p5_div_x8)
+DECLARE_F16_VGELU_UKERNEL_FUNCTION(xnn_f16_vgelu_ukernel__avx2_rr1_p5_div_x16)
+
+
+#define DECLARE_F16_VLOG_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t batch,                                \
+      const void* input,                           \
+      void* output,                                \
+      const union xnn_f16_log_params* params);
+
+DECLARE_F16_VLOG_UKERNEL_FUNCTION(xnn_f16_vlog_ukernel__avx2_p4_div_x8)
+DECLARE_F16_VLOG_UKERNEL_FUNCTION(xnn_f16_vlog_ukernel__avx2_p4_div_x16)
+
+
+#define DECLARE_F16_VSILU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t batch,                                 \
+      const void* input,                            \
+      void* output,                                 \
+      const union xnn_f16_silu_params* params);
+
+DECLARE_F16_VSILU_UKERNEL_FUNCTION(xnn_f16_vsilu_ukernel__avx2_rr1_p5_div_x8)
+DECLARE_F16_VSILU_UKERNEL_FUNCTION(xnn_f16_vsilu_ukernel__avx2_rr1_p5_div_x16)
+
+
+#define DECLARE_F16_VTANH_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t batch,                                 \
+      const void* input,                            \
+      void* output,                                 \
+      const union xnn_f16_tanh_params* params);
+
+DECLARE_F16_VTANH_UKERNEL_FUNCTION(xnn_f16_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x8)
+DECLARE_F16_VTANH_UKERNEL_FUNCTION(xnn_f16_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x16)
+
+
 #define DECLARE_F32_VABS_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                       \
       size_t n,                                    \
@@ -390,6 +461,28 @@ DECLARE_F32_VHSWISH_UKERNEL_FUNCTION(xnn_f32_vhswish_ukernel__scalar_x2)
 DECLARE_F32_VHSWISH_UKERNEL_FUNCTION(xnn_f32_vhswish_ukernel__scalar_x4)
 
 
+#define DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                             \
+      size_t batch,                                      \
+      const float* input,                                \
+      const float* stats,                                \
+      const float* gamma,                                \
+      const float* beta,                                 \
+      float* output);
+
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__neon_x4)
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__neon_x8)
+
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__sse_x4)
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__sse_x8)
+
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__avx_x8)
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__avx_x16)
+
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__scalar_x1)
+DECLARE_F32_VLAYERNORM_UKERNEL_FUNCTION(xnn_f32_vlayernorm_ukernel__scalar_x4)
+
+
 #define DECLARE_F16_VLRELU_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                         \
       size_t n,                                      \
@@ -445,6 +538,40 @@ DECLARE_F32_VLRELU_UKERNEL_FUNCTION(xnn_f32_vlrelu_ukernel__scalar_x2)
 DECLARE_F32_VLRELU_UKERNEL_FUNCTION(xnn_f32_vlrelu_ukernel__scalar_x4)
 
 
+#define DECLARE_QS8_VLRELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                         \
+      size_t n,                                      \
+      const int8_t* x,                               \
+      int8_t* y,                                     \
+      const union xnn_qs8_lrelu_params* params);
+
+DECLARE_QS8_VLRELU_UKERNEL_FUNCTION(xnn_qs8_vlrelu_ukernel__neon_x8)
+DECLARE_QS8_VLRELU_UKERNEL_FUNCTION(xnn_qs8_vlrelu_ukernel__neon_x16)
+
+DECLARE_QS8_VLRELU_UKERNEL_FUNCTION(xnn_qs8_vlrelu_ukernel__sse41_x8)
+DECLARE_QS8_VLRELU_UKERNEL_FUNCTION(xnn_qs8_vlrelu_ukernel__sse41_x16)
+
+DECLARE_QS8_VLRELU_UKERNEL_FUNCTION(xnn_qs8_vlrelu_ukernel__scalar_x1)
+DECLARE_QS8_VLRELU_UKERNEL_FUNCTION(xnn_qs8_vlrelu_ukernel__scalar_x4)
+
+
+#define DECLARE_QS8_VHSWISH_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                          \
+      size_t n,                                       \
+      const int8_t* x,                                \
+      int8_t* y,                                      \
+      const union xnn_qs8_hswish_params* params);
+
+DECLARE_QS8_VHSWISH_UKERNEL_FUNCTION(xnn_qs8_vhswish_ukernel__neon_x8)
+DECLARE_QS8_VHSWISH_UKERNEL_FUNCTION(xnn_qs8_vhswish_ukernel__neon_x16)
+
+DECLARE_QS8_VHSWISH_UKERNEL_FUNCTION(xnn_qs8_vhswish_ukernel__sse41_x8)
+DECLARE_QS8_VHSWISH_UKERNEL_FUNCTION(xnn_qs8_vhswish_ukernel__sse41_x16)
+
+DECLARE_QS8_VHSWISH_UKERNEL_FUNCTION(xnn_qs8_vhswish_ukernel__scalar_x1)
+DECLARE_QS8_VHSWISH_UKERNEL_FUNCTION(xnn_qs8_vhswish_ukernel__scalar_x4)
+
+
 #define DECLARE_F32_VNEG_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                       \
       size_t n,                                    \
@@ -924,6 +1051,144 @@ DECLARE_F32_VSIGMOID_UKERNEL_FUNCTION(xnn_f32_vsigmoid_ukernel__scalar_rr2_p5_di
 DECLARE_F32_VSIGMOID_UKERNEL_FUNCTION(xnn_f32_vsigmoid_ukernel__scalar_rr2_p5_div_x4)
 
 
+#define DECLARE_F32_VEXP_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t n,                                    \
+      const float* x,                              \
+      float* y,                                    \
+      const union xnn_f32_exp_params* params);
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x4)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neonfma_rr2_p5_x8)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neon_rr2_p5_x4)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__neon_rr2_p5_x8)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__sse2_rr2_p5_x4)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__sse2_rr2_p5_x8)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__avx2_rr2_p5_x8)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__avx2_rr2_p5_x16)
+
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__scalar_rr2_p5_x1)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__scalar_rr2_p5_x2)
+DECLARE_F32_VEXP_UKERNEL_FUNCTION(xnn_f32_vexp_ukernel__scalar_rr2_p5_x4)
+
+
+#define DECLARE_F32_VGELU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_gelu_params* params);
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rr1_p5_div_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rr1_p5_div_x8)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rr1_p5_nr2recps_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neonfma_rr1_p5_nr2recps_x8)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rr2_p5_nr2recps_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__neon_rr2_p5_nr2recps_x8)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rr2_p5_div_x4)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__sse2_rr2_p5_div_x8)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rr1_p5_div_x8)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rr1_p5_div_x16)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rr1_p5_nr1fma_x8)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__avx2_rr1_p5_nr1fma_x16)
+
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x1)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x2)
+DECLARE_F32_VGELU_UKERNEL_FUNCTION(xnn_f32_vgelu_ukernel__scalar_rr2_p5_div_x4)
+
+
+#define DECLARE_F32_VLOG_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                       \
+      size_t n,                                    \
+      const float* x,                              \
+      float* y,                                    \
+      const union xnn_f32_log_params* params);
+
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__neonfma_p4_div_x4)
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__neonfma_p4_div_x8)
+
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__neonfma_p4_nr2recps_x4)
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__neonfma_p4_nr2recps_x8)
+
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__neon_p4_nr2recps_x4)
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__neon_p4_nr2recps_x8)
+
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__sse2_p4_div_x4)
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__sse2_p4_div_x8)
+
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__avx2_p4_div_x8)
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__avx2_p4_div_x16)
+
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__scalar_p4_div_x1)
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__scalar_p4_div_x2)
+DECLARE_F32_VLOG_UKERNEL_FUNCTION(xnn_f32_vlog_ukernel__scalar_p4_div_x4)
+
+
+#define DECLARE_F32_VSILU_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_silu_params* params);
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neonfma_rr1_p5_div_x4)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neonfma_rr1_p5_div_x8)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neonfma_rr1_p5_nr2recps_x4)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neonfma_rr1_p5_nr2recps_x8)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neon_rr2_p5_nr2recps_x4)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__neon_rr2_p5_nr2recps_x8)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__sse2_rr2_p5_div_x4)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__sse2_rr2_p5_div_x8)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx2_rr1_p5_div_x8)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx2_rr1_p5_div_x16)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx2_rr1_p5_nr1fma_x8)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__avx2_rr1_p5_nr1fma_x16)
+
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x1)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x2)
+DECLARE_F32_VSILU_UKERNEL_FUNCTION(xnn_f32_vsilu_ukernel__scalar_rr2_p5_div_x4)
+
+
+#define DECLARE_F32_VTANH_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                        \
+      size_t n,                                     \
+      const float* x,                               \
+      float* y,                                     \
+      const union xnn_f32_tanh_params* params);
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_div_x8)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neonfma_expm1minus_rr1_p6_nr2recps_x8)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__neon_expm1minus_rr2_p6_nr2recps_x8)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x4)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__sse2_expm1minus_rr2_p6_div_x8)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x8)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__avx2_expm1minus_rr1_p6_div_x16)
+
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x1)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x2)
+DECLARE_F32_VTANH_UKERNEL_FUNCTION(xnn_f32_vtanh_ukernel__scalar_expm1minus_rr2_p6_div_x4)
+
+
 #define DECLARE_F32_VSQR_UKERNEL_FUNCTION(fn_name) \
   XNN_INTERNAL void fn_name(                       \
       size_t n,                                    \
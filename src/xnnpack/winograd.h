@@ -0,0 +1,47 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <xnnpack/params.h>
+#include <xnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                 \
+      size_t channels,                                       \
+      const float** input,                                   \
+      float* output,                                         \
+      size_t output_stride);
+
+DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4)
+DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4)
+DECLARE_F32_WINOGRAD_INPUT_UKERNEL_FUNCTION(xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1)
+
+
+#define DECLARE_F32_WINOGRAD_OUTPUT_MINMAX_UKERNEL_FUNCTION(fn_name) \
+  XNN_INTERNAL void fn_name(                                         \
+      size_t channels,                                               \
+      const float* input,                                            \
+      size_t input_stride,                                           \
+      const float* bias,                                             \
+      float** output,                                                \
+      const union xnn_f32_minmax_params* params);
+
+DECLARE_F32_WINOGRAD_OUTPUT_MINMAX_UKERNEL_FUNCTION(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4)
+DECLARE_F32_WINOGRAD_OUTPUT_MINMAX_UKERNEL_FUNCTION(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4)
+DECLARE_F32_WINOGRAD_OUTPUT_MINMAX_UKERNEL_FUNCTION(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1)
+
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
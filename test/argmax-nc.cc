@@ -0,0 +1,261 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "topk-operator-tester.h"
+
+
+TEST(ARGMAX_NC_F16, unit_channels) {
+  TopKOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .TestArgMaxF16();
+}
+
+TEST(ARGMAX_NC_F16, small_channels) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(1)
+      .TestArgMaxF16();
+  }
+}
+
+TEST(ARGMAX_NC_F16, small_channels_with_ties) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .ties(true)
+      .iterations(1)
+      .TestArgMaxF16();
+  }
+}
+
+TEST(ARGMAX_NC_F16, large_channels) {
+  for (size_t channels : {4095, 4096, 4097, 10000, 50001}) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .TestArgMaxF16();
+  }
+}
+
+TEST(ARGMAX_NC_F16, large_channels_with_ties) {
+  for (size_t channels : {4097, 10000}) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .ties(true)
+      .TestArgMaxF16();
+  }
+}
+
+TEST(ARGMAX_NC_F16, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(1)
+      .TestArgMaxF16();
+  }
+}
+
+TEST(ARGMAX_NC_F16, large_channels_with_input_stride) {
+  TopKOperatorTester()
+    .batch_size(3)
+    .channels(10000)
+    .input_stride(10013)
+    .TestArgMaxF16();
+}
+
+TEST(ARGMAX_NC_F16, multithreaded) {
+  for (size_t batch_size : {1, 2, 7}) {
+    TopKOperatorTester()
+      .batch_size(batch_size)
+      .channels(10000)
+      .num_threads(4)
+      .TestArgMaxF16();
+  }
+}
+
+TEST(ARGMAX_NC_F32, unit_channels) {
+  TopKOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .TestArgMaxF32();
+}
+
+TEST(ARGMAX_NC_F32, small_channels) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(1)
+      .TestArgMaxF32();
+  }
+}
+
+TEST(ARGMAX_NC_F32, small_channels_with_ties) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .ties(true)
+      .iterations(1)
+      .TestArgMaxF32();
+  }
+}
+
+TEST(ARGMAX_NC_F32, large_channels) {
+  for (size_t channels : {4095, 4096, 4097, 10000, 50001}) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .TestArgMaxF32();
+  }
+}
+
+TEST(ARGMAX_NC_F32, large_channels_with_ties) {
+  for (size_t channels : {4097, 10000}) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .ties(true)
+      .TestArgMaxF32();
+  }
+}
+
+TEST(ARGMAX_NC_F32, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(1)
+      .TestArgMaxF32();
+  }
+}
+
+TEST(ARGMAX_NC_F32, large_channels_with_input_stride) {
+  TopKOperatorTester()
+    .batch_size(3)
+    .channels(10000)
+    .input_stride(10013)
+    .TestArgMaxF32();
+}
+
+TEST(ARGMAX_NC_F32, multithreaded) {
+  for (size_t batch_size : {1, 2, 7}) {
+    TopKOperatorTester()
+      .batch_size(batch_size)
+      .channels(10000)
+      .num_threads(4)
+      .TestArgMaxF32();
+  }
+}
+
+TEST(ARGMAX_NC_QS8, unit_channels) {
+  TopKOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .TestArgMaxQS8();
+}
+
+TEST(ARGMAX_NC_QS8, small_channels) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(1)
+      .TestArgMaxQS8();
+  }
+}
+
+TEST(ARGMAX_NC_QS8, small_channels_with_ties) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .ties(true)
+      .iterations(1)
+      .TestArgMaxQS8();
+  }
+}
+
+TEST(ARGMAX_NC_QS8, large_channels) {
+  for (size_t channels : {4095, 4096, 4097, 10000, 50001}) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .TestArgMaxQS8();
+  }
+}
+
+TEST(ARGMAX_NC_QS8, large_channels_with_ties) {
+  for (size_t channels : {4097, 10000}) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .ties(true)
+      .TestArgMaxQS8();
+  }
+}
+
+TEST(ARGMAX_NC_QS8, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(1)
+      .TestArgMaxQS8();
+  }
+}
+
+TEST(ARGMAX_NC_QS8, large_channels_with_input_stride) {
+  TopKOperatorTester()
+    .batch_size(3)
+    .channels(10000)
+    .input_stride(10013)
+    .TestArgMaxQS8();
+}
+
+TEST(ARGMAX_NC_QS8, multithreaded) {
+  for (size_t batch_size : {1, 2, 7}) {
+    TopKOperatorTester()
+      .batch_size(batch_size)
+      .channels(10000)
+      .num_threads(4)
+      .TestArgMaxQS8();
+  }
+}
+
+TEST(ARGMAX_NC_F16, with_nans) {
+  for (size_t channels : {1, 7, 100, 10000}) {
+    for (size_t nans : {1, 3}) {
+      TopKOperatorTester()
+        .batch_size(3)
+        .channels(channels)
+        .nans(nans)
+        .TestArgMaxF16();
+    }
+  }
+}
+
+TEST(ARGMAX_NC_F32, with_nans) {
+  for (size_t channels : {1, 7, 100, 10000}) {
+    for (size_t nans : {1, 3}) {
+      TopKOperatorTester()
+        .batch_size(3)
+        .channels(channels)
+        .nans(nans)
+        .TestArgMaxF32();
+    }
+  }
+}
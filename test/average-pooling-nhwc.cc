@@ -31,6 +31,2782 @@ static std::pair<size_t, size_t> LargePoolSize(size_t min_elements) {
 
 /**************************** AVGPOOL path, unipass ****************************/
 
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride_width = 1; stride_width <= 2; stride_width++) {
+      for (size_t stride_height = 1; stride_height <= 2; stride_height++) {
+        if (stride_width == 1 && stride_height == 1) {
+          continue;
+        }
+
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.first + 3)
+          .input_width(pooling_size.second + 2)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.second + 3)
+          .input_width(pooling_size.first + 2)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_left = 0; padding_left <= 1; padding_left++) {
+        for (size_t padding_right = 0; padding_right <= 1; padding_right++) {
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_top = 0; padding_top <= 1; padding_top++) {
+        for (size_t padding_bottom = 0; padding_bottom <= 1; padding_bottom++) {
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_tf_same_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t input_height = pooling_size.first + 3; input_height <= pooling_size.first + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .input_height(input_height)
+          .input_width(pooling_size.second + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.second + 2; input_width <= pooling_size.second + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.first + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_height = pooling_size.second + 3; input_height <= pooling_size.second + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .input_height(input_height)
+          .input_width(pooling_size.first + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.first + 2; input_width <= pooling_size.first + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.second + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_pool_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** AVGPOOL path, unipass, batched ****************************/
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride_width = 1; stride_width <= 2; stride_width++) {
+      for (size_t stride_height = 1; stride_height <= 2; stride_height++) {
+        if (stride_width == 1 && stride_height == 1) {
+          continue;
+        }
+
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.first + 3)
+          .input_width(pooling_size.second + 2)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.second + 3)
+          .input_width(pooling_size.first + 2)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_left = 0; padding_left <= 1; padding_left++) {
+        for (size_t padding_right = 0; padding_right <= 1; padding_right++) {
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_top = 0; padding_top <= 1; padding_top++) {
+        for (size_t padding_bottom = 0; padding_bottom <= 1; padding_bottom++) {
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_tf_same_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t input_height = pooling_size.first + 3; input_height <= pooling_size.first + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(input_height)
+          .input_width(pooling_size.second + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.second + 2; input_width <= pooling_size.second + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.first + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_height = pooling_size.second + 3; input_height <= pooling_size.second + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(input_height)
+          .input_width(pooling_size.first + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.first + 2; input_width <= pooling_size.first + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.second + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_pool_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.avgpool.primary_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** AVGPOOL path, multipass ****************************/
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.avgpool.primary_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride_width = 1; stride_width <= 2; stride_width++) {
+      for (size_t stride_height = 1; stride_height <= 2; stride_height++) {
+        if (stride_width == 1 && stride_height == 1) {
+          continue;
+        }
+
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.first + 3)
+          .input_width(pooling_size.second + 2)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.second + 3)
+          .input_width(pooling_size.first + 2)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_left = 0; padding_left <= 1; padding_left++) {
+        for (size_t padding_right = 0; padding_right <= 1; padding_right++) {
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_top = 0; padding_top <= 1; padding_top++) {
+        for (size_t padding_bottom = 0; padding_bottom <= 1; padding_bottom++) {
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_tf_same_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t input_height = pooling_size.first + 3; input_height <= pooling_size.first + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .input_height(input_height)
+          .input_width(pooling_size.second + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.second + 2; input_width <= pooling_size.second + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.first + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_height = pooling_size.second + 3; input_height <= pooling_size.second + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .input_height(input_height)
+          .input_width(pooling_size.first + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.first + 2; input_width <= pooling_size.first + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .input_height(pooling_size.second + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_pool_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** AVGPOOL path, multipass, batched ****************************/
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.avgpool.primary_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride_width = 1; stride_width <= 2; stride_width++) {
+      for (size_t stride_height = 1; stride_height <= 2; stride_height++) {
+        if (stride_width == 1 && stride_height == 1) {
+          continue;
+        }
+
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.first + 3)
+          .input_width(pooling_size.second + 2)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.second + 3)
+          .input_width(pooling_size.first + 2)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride_height(stride_height)
+          .stride_width(stride_width)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_left = 0; padding_left <= 1; padding_left++) {
+        for (size_t padding_right = 0; padding_right <= 1; padding_right++) {
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_left(padding_left)
+            .padding_right(padding_right)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t padding_top = 0; padding_top <= 1; padding_top++) {
+        for (size_t padding_bottom = 0; padding_bottom <= 1; padding_bottom++) {
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.first + 3)
+            .input_width(pooling_size.second + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.first)
+            .pooling_width(pooling_size.second)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+          AveragePoolingOperatorTester()
+            .batch_size(2)
+            .input_height(pooling_size.second + 3)
+            .input_width(pooling_size.first + 2)
+            .padding_top(padding_top)
+            .padding_bottom(padding_bottom)
+            .pooling_height(pooling_size.second)
+            .pooling_width(pooling_size.first)
+            .stride(stride)
+            .channels(channels)
+            .TestQS8();
+        }
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_tf_same_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t stride = 1; stride <= 2; stride++) {
+      for (size_t input_height = pooling_size.first + 3; input_height <= pooling_size.first + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(input_height)
+          .input_width(pooling_size.second + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.second + 2; input_width <= pooling_size.second + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.first + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.first)
+          .pooling_width(pooling_size.second)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_height = pooling_size.second + 3; input_height <= pooling_size.second + 4; input_height++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(input_height)
+          .input_width(pooling_size.first + 2)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+      for (size_t input_width = pooling_size.first + 2; input_width <= pooling_size.first + 3; input_width++) {
+        AveragePoolingOperatorTester()
+          .batch_size(2)
+          .input_height(pooling_size.second + 3)
+          .input_width(input_width)
+          .padding_tf_same(true)
+          .pooling_height(pooling_size.second)
+          .pooling_width(pooling_size.first)
+          .stride(stride)
+          .channels(channels)
+          .TestQS8();
+      }
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first + 3)
+        .input_width(pooling_size.second + 2)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second + 3)
+        .input_width(pooling_size.first + 2)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_pool_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first + 3)
+      .input_width(pooling_size.second + 2)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second + 3)
+      .input_width(pooling_size.first + 2)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** GAVGPOOL path, unipass ****************************/
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.f32.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    /* With left padding */
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second - 1)
+      .padding_left(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first - 1)
+      .padding_left(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+
+    /* With right padding */
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second - 1)
+      .padding_right(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first - 1)
+      .padding_right(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    /* With top padding */
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first - 1)
+      .input_width(pooling_size.second)
+      .padding_top(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second - 1)
+      .input_width(pooling_size.first)
+      .padding_top(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+
+    /* With bottom padding */
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first - 1)
+      .input_width(pooling_size.second)
+      .padding_bottom(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second - 1)
+      .input_width(pooling_size.first)
+      .padding_bottom(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, small_image_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** GAVGPOOL path, unipass, batched ****************************/
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.f32.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    /* With left padding */
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second - 1)
+      .padding_left(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first - 1)
+      .padding_left(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+
+    /* With right padding */
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second - 1)
+      .padding_right(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first - 1)
+      .padding_right(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    /* With top padding */
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first - 1)
+      .input_width(pooling_size.second)
+      .padding_top(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second - 1)
+      .input_width(pooling_size.first)
+      .padding_top(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+
+    /* With bottom padding */
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first - 1)
+      .input_width(pooling_size.second)
+      .padding_bottom(1)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second - 1)
+      .input_width(pooling_size.first)
+      .padding_bottom(1)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_small_image_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qs8.gavgpool.row_tile);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** GAVGPOOL path, multipass ****************************/
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t padding_left = 1; padding_left <= 2; padding_left++) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second - padding_left)
+        .padding_left(padding_left)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first - padding_left)
+        .padding_left(padding_left)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+    for (size_t padding_right = 1; padding_right <= 2; padding_right++) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second - padding_right)
+        .padding_right(padding_right)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first - padding_right)
+        .padding_right(padding_right)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t padding_top = 1; padding_top <= 2; padding_top++) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first - padding_top)
+        .input_width(pooling_size.second)
+        .padding_top(padding_top)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second - padding_top)
+        .input_width(pooling_size.first)
+        .padding_top(padding_top)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+    for (size_t padding_bottom = 0; padding_bottom <= 1; padding_bottom++) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first - padding_bottom)
+        .input_width(pooling_size.second)
+        .padding_bottom(padding_bottom)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second - padding_bottom)
+        .input_width(pooling_size.first)
+        .padding_bottom(padding_bottom)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, large_image_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** GAVGPOOL path, multipass, batched ****************************/
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_width_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t padding_left = 1; padding_left <= 2; padding_left++) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second - padding_left)
+        .padding_left(padding_left)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first - padding_left)
+        .padding_left(padding_left)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+    for (size_t padding_right = 1; padding_right <= 2; padding_right++) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second - padding_right)
+        .padding_right(padding_right)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first - padding_right)
+        .padding_right(padding_right)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_height_padding) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (size_t padding_top = 1; padding_top <= 2; padding_top++) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first - padding_top)
+        .input_width(pooling_size.second)
+        .padding_top(padding_top)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second - padding_top)
+        .input_width(pooling_size.first)
+        .padding_top(padding_top)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+    for (size_t padding_bottom = 1; padding_bottom <= 2; padding_bottom++) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first - padding_bottom)
+        .input_width(pooling_size.second)
+        .padding_bottom(padding_bottom)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second - padding_bottom)
+        .input_width(pooling_size.first)
+        .padding_bottom(padding_bottom)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_input_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .input_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_output_stride) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .output_pixel_stride(2 * channels + 3)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_input_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float input_scale = 0.01f; input_scale < 100.0f; input_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_scale(input_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_input_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t input_zero_point = 0; input_zero_point <= 255; input_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .input_zero_point(uint8_t(input_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_output_scale) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (float output_scale = 0.01f; output_scale < 100.0f; output_scale *= 3.14159265f) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_scale(output_scale)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_output_zero_point) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    for (int32_t output_zero_point = 0; output_zero_point <= 255; output_zero_point += 51) {
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.first)
+        .input_width(pooling_size.second)
+        .pooling_height(pooling_size.first)
+        .pooling_width(pooling_size.second)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+      AveragePoolingOperatorTester()
+        .batch_size(2)
+        .input_height(pooling_size.second)
+        .input_width(pooling_size.first)
+        .pooling_height(pooling_size.second)
+        .pooling_width(pooling_size.first)
+        .channels(channels)
+        .output_zero_point(uint8_t(output_zero_point))
+        .TestQS8();
+    }
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_qmin) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmin(128)
+      .TestQS8();
+  }
+}
+
+TEST(AVERAGE_POOLING_NHWC_QS8, batched_large_image_with_qmax) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  const std::pair<size_t, size_t> pooling_size = LargePoolSize(xnn_params.qs8.gavgpool.row_tile * 2);
+  for (size_t channels = 1; channels <= 100; channels += 15) {
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.first)
+      .input_width(pooling_size.second)
+      .pooling_height(pooling_size.first)
+      .pooling_width(pooling_size.second)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+    AveragePoolingOperatorTester()
+      .batch_size(2)
+      .input_height(pooling_size.second)
+      .input_width(pooling_size.first)
+      .pooling_height(pooling_size.second)
+      .pooling_width(pooling_size.first)
+      .channels(channels)
+      .qmax(128)
+      .TestQS8();
+  }
+}
+
+/**************************** AVGPOOL path, unipass ****************************/
+
 TEST(AVERAGE_POOLING_NHWC_QU8, small_pool) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   const std::pair<size_t, size_t> pooling_size = SmallPoolSize(xnn_params.qu8.avgpool.primary_tile);
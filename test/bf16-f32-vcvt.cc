@@ -0,0 +1,211 @@
+// Copyright 2021 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/bf16-f32-vcvt.yaml
+//   Generator: tools/generate-vcvt-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/vcvt.h>
+#include "vcvt-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(BF16_F32_VCVT__SSE2_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    VCvtMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x8);
+  }
+
+  TEST(BF16_F32_VCVT__SSE2_X8, batch_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__SSE2_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x8);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__SSE2_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x8);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(BF16_F32_VCVT__SSE2_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE2;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x16);
+  }
+
+  TEST(BF16_F32_VCVT__SSE2_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x16);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__SSE2_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x16);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__SSE2_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__sse2_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(BF16_F32_VCVT__AVX2_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_AVX2;
+    VCvtMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x8);
+  }
+
+  TEST(BF16_F32_VCVT__AVX2_X8, batch_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x8);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__AVX2_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x8);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__AVX2_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x8);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(BF16_F32_VCVT__AVX2_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX2;
+    VCvtMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x16);
+  }
+
+  TEST(BF16_F32_VCVT__AVX2_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x16);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__AVX2_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x16);
+    }
+  }
+
+  TEST(BF16_F32_VCVT__AVX2_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VCvtMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_bf16_f32_vcvt_ukernel__avx2_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(BF16_F32_VCVT__SCALAR_X1, batch_eq_1) {
+  VCvtMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_bf16_f32_vcvt_ukernel__scalar_x1);
+}
+
+TEST(BF16_F32_VCVT__SCALAR_X1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_bf16_f32_vcvt_ukernel__scalar_x1);
+  }
+}
+
+
+TEST(BF16_F32_VCVT__SCALAR_X4, batch_eq_4) {
+  VCvtMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_bf16_f32_vcvt_ukernel__scalar_x4);
+}
+
+TEST(BF16_F32_VCVT__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_bf16_f32_vcvt_ukernel__scalar_x4);
+  }
+}
+
+TEST(BF16_F32_VCVT__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_bf16_f32_vcvt_ukernel__scalar_x4);
+  }
+}
+
+TEST(BF16_F32_VCVT__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    VCvtMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_bf16_f32_vcvt_ukernel__scalar_x4);
+  }
+}
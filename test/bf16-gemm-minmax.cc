@@ -0,0 +1,1393 @@
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/bf16-gemm-minmax.yaml
+//   Generator: tools/generate-gemm-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/igemm.h>
+#include <xnnpack/ppmm.h>
+#include "gemm-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_1X16__AVX2_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_eq_1) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .cn_stride(19)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_eq_1_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .a_stride(3)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_eq_1_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(1)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_eq_1_subtile_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_eq_1_subtile_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_gt_1) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_gt_1_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, k_gt_1_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 2; k < 10; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .a_stride(7)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 5; k += 2) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 4; m++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .qmin(128)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .qmax(128)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(BF16_GEMM_MINMAX_4X16__AVX2_BROADCAST, strided_cm) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(1)
+      .cm_stride(19)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x16__avx2_broadcast, xnn_init_f32_minmax_avx_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_eq_1) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, strided_cn) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .cn_stride(7)
+    .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_eq_1_strided_a) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_eq_1_subtile) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_eq_1_subtile_m) {
+  for (uint32_t m = 1; m <= 1; m++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(m)
+      .n(4)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_eq_1_subtile_n) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(n)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(k)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_gt_1_strided_a) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(k)
+      .a_stride(11)
+      .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, k_gt_1_subtile) {
+  for (size_t k = 2; k < 10; k++) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_gt_4_strided_cn) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_gt_4_strided_a) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_gt_4_subtile) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_div_4_strided_cn) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_div_4_strided_a) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, n_div_4_subtile) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, strided_cm_subtile) {
+  for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .cm_stride(7)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, qmin) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .qmin(128)
+    .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, qmax) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .qmax(128)
+    .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_1X4__SCALAR, strided_cm) {
+  GemmMicrokernelTester()
+    .mr(1)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(1)
+    .n(4)
+    .k(1)
+    .cm_stride(7)
+    .Test(xnn_bf16_gemm_minmax_ukernel_1x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_eq_1) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, strided_cn) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .cn_stride(7)
+    .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_eq_1_strided_a) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .a_stride(3)
+    .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_eq_1_subtile) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    for (uint32_t m = 1; m <= 4; m++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(n)
+        .k(1)
+        .iterations(1)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_eq_1_subtile_m) {
+  for (uint32_t m = 1; m <= 4; m++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(m)
+      .n(4)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_eq_1_subtile_n) {
+  for (uint32_t n = 1; n <= 4; n++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(n)
+      .k(1)
+      .iterations(1)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_gt_1) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(k)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_gt_1_strided_a) {
+  for (size_t k = 2; k < 10; k++) {
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .kr(1)
+      .sr(1)
+      .m(4)
+      .n(4)
+      .k(k)
+      .a_stride(11)
+      .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, k_gt_1_subtile) {
+  for (size_t k = 2; k < 10; k++) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_gt_4) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_gt_4_strided_cn) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_gt_4_strided_a) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_gt_4_subtile) {
+  for (uint32_t n = 5; n < 8; n++) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_div_4) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_div_4_strided_cn) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .cn_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_div_4_strided_a) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .kr(1)
+        .sr(1)
+        .m(4)
+        .n(n)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, n_div_4_subtile) {
+  for (uint32_t n = 8; n <= 12; n += 4) {
+    for (size_t k = 1; k <= 5; k += 2) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, strided_cm_subtile) {
+  for (size_t k = 1; k <= 5; k += 2) {
+    for (uint32_t n = 1; n <= 4; n++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(4)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(k)
+          .cm_stride(7)
+          .iterations(1)
+          .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, qmin) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .qmin(128)
+    .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, qmax) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .qmax(128)
+    .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(BF16_GEMM_MINMAX_4X4__SCALAR, strided_cm) {
+  GemmMicrokernelTester()
+    .mr(4)
+    .nr(4)
+    .kr(1)
+    .sr(1)
+    .m(4)
+    .n(4)
+    .k(1)
+    .cm_stride(7)
+    .Test(xnn_bf16_gemm_minmax_ukernel_4x4__scalar, xnn_init_f32_minmax_scalar_params);
+}
@@ -249,6 +249,10 @@ class BinaryElementwiseOperatorTester {
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input1.begin(), input1.end(), [&]() { return i8dist(rng); });
       std::generate(input2.begin(), input2.end(), [&]() { return i8dist(rng); });
+      if (operation_type() == OperationType::Divide) {
+        // Avoid division by zero: the result of 0 / 0 is undefined.
+        std::replace(input2.begin(), input2.end(), int8_t(input2_zero_point()), int8_t(input2_zero_point() ^ 1));
+      }
       std::fill(output.begin(), output.end(), 0xAA);
 
       // Compute reference results.
@@ -286,6 +290,30 @@ class BinaryElementwiseOperatorTester {
             int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
             0, &binary_elementwise_op);
           break;
+        case OperationType::Divide:
+          status = xnn_create_divide_nd_qs8(
+            input1_zero_point(), input1_scale(),
+            input2_zero_point(), input2_scale(),
+            output_zero_point(), output_scale(),
+            int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            0, &binary_elementwise_op);
+          break;
+        case OperationType::Maximum:
+          status = xnn_create_maximum_nd_qs8(
+            input1_zero_point(), input1_scale(),
+            input2_zero_point(), input2_scale(),
+            output_zero_point(), output_scale(),
+            int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            0, &binary_elementwise_op);
+          break;
+        case OperationType::Minimum:
+          status = xnn_create_minimum_nd_qs8(
+            input1_zero_point(), input1_scale(),
+            input2_zero_point(), input2_scale(),
+            output_zero_point(), output_scale(),
+            int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            0, &binary_elementwise_op);
+          break;
         case OperationType::Multiply:
           status = xnn_create_multiply_nd_qs8(
             input1_zero_point(), input1_scale(),
@@ -294,6 +322,14 @@ class BinaryElementwiseOperatorTester {
             int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
             0, &binary_elementwise_op);
           break;
+        case OperationType::SquaredDifference:
+          status = xnn_create_squared_difference_nd_qs8(
+            input1_zero_point(), input1_scale(),
+            input2_zero_point(), input2_scale(),
+            output_zero_point(), output_scale(),
+            int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+            0, &binary_elementwise_op);
+          break;
         case OperationType::Subtract:
           status = xnn_create_subtract_nd_qs8(
             input1_zero_point(), input1_scale(),
@@ -326,6 +362,39 @@ class BinaryElementwiseOperatorTester {
               input1.data(), input2.data(), output.data(),
               nullptr /* thread pool */));
           break;
+        case OperationType::Divide:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_divide_nd_qs8(
+              binary_elementwise_op,
+              num_input1_dims(),
+              input1_shape().data(),
+              num_input2_dims(),
+              input2_shape().data(),
+              input1.data(), input2.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Maximum:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_maximum_nd_qs8(
+              binary_elementwise_op,
+              num_input1_dims(),
+              input1_shape().data(),
+              num_input2_dims(),
+              input2_shape().data(),
+              input1.data(), input2.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case OperationType::Minimum:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_minimum_nd_qs8(
+              binary_elementwise_op,
+              num_input1_dims(),
+              input1_shape().data(),
+              num_input2_dims(),
+              input2_shape().data(),
+              input1.data(), input2.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
         case OperationType::Multiply:
           ASSERT_EQ(xnn_status_success,
             xnn_setup_multiply_nd_qs8(
@@ -337,6 +406,17 @@ class BinaryElementwiseOperatorTester {
               input1.data(), input2.data(), output.data(),
               nullptr /* thread pool */));
           break;
+        case OperationType::SquaredDifference:
+          ASSERT_EQ(xnn_status_success,
+            xnn_setup_squared_difference_nd_qs8(
+              binary_elementwise_op,
+              num_input1_dims(),
+              input1_shape().data(),
+              num_input2_dims(),
+              input2_shape().data(),
+              input1.data(), input2.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
         case OperationType::Subtract:
           ASSERT_EQ(xnn_status_success,
             xnn_setup_subtract_nd_qs8(
@@ -0,0 +1,752 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class Convolution3DOperatorTester {
+ public:
+  inline Convolution3DOperatorTester& padding_tf_same(bool padding_same) {
+    if (padding_same) {
+      assert(padding_front() == 0);
+      assert(padding_back() == 0);
+      assert(padding_top() == 0);
+      assert(padding_right() == 0);
+      assert(padding_bottom() == 0);
+      assert(padding_left() == 0);
+    }
+    this->padding_tf_same_ = padding_same;
+    return *this;
+  }
+
+  inline bool padding_tf_same() const {
+    return this->padding_tf_same_;
+  }
+
+  inline Convolution3DOperatorTester& padding(uint32_t padding) {
+    assert(!padding_tf_same());
+    this->padding_front_ = padding;
+    this->padding_back_ = padding;
+    this->padding_top_ = padding;
+    this->padding_right_ = padding;
+    this->padding_bottom_ = padding;
+    this->padding_left_ = padding;
+    return *this;
+  }
+
+  inline Convolution3DOperatorTester& padding_front(uint32_t padding_front) {
+    assert(!padding_tf_same());
+    this->padding_front_ = padding_front;
+    return *this;
+  }
+
+  inline uint32_t padding_front() const {
+    if (padding_tf_same()) {
+      return compute_tf_same_padding(input_depth(), kernel_depth(), dilation_depth(), subsampling_depth()) / 2;
+    } else {
+      return this->padding_front_;
+    }
+  }
+
+  inline Convolution3DOperatorTester& padding_back(uint32_t padding_back) {
+    assert(!padding_tf_same());
+    this->padding_back_ = padding_back;
+    return *this;
+  }
+
+  inline uint32_t padding_back() const {
+    if (padding_tf_same()) {
+      const uint32_t total_padding =
+        compute_tf_same_padding(input_depth(), kernel_depth(), dilation_depth(), subsampling_depth());
+      return total_padding - total_padding / 2;
+    } else {
+      return this->padding_back_;
+    }
+  }
+
+  inline Convolution3DOperatorTester& padding_top(uint32_t padding_top) {
+    assert(!padding_tf_same());
+    this->padding_top_ = padding_top;
+    return *this;
+  }
+
+  inline uint32_t padding_top() const {
+    if (padding_tf_same()) {
+      return compute_tf_same_padding(input_height(), kernel_height(), dilation_height(), subsampling_height()) / 2;
+    } else {
+      return this->padding_top_;
+    }
+  }
+
+  inline Convolution3DOperatorTester& padding_right(uint32_t padding_right) {
+    assert(!padding_tf_same());
+    this->padding_right_ = padding_right;
+    return *this;
+  }
+
+  inline uint32_t padding_right() const {
+    if (padding_tf_same()) {
+      const uint32_t total_padding =
+        compute_tf_same_padding(input_width(), kernel_width(), dilation_width(), subsampling_width());
+      return total_padding - total_padding / 2;
+    } else {
+      return this->padding_right_;
+    }
+  }
+
+  inline Convolution3DOperatorTester& padding_bottom(uint32_t padding_bottom) {
+    assert(!padding_tf_same());
+    this->padding_bottom_ = padding_bottom;
+    return *this;
+  }
+
+  inline uint32_t padding_bottom() const {
+    if (padding_tf_same()) {
+      const uint32_t total_padding =
+        compute_tf_same_padding(input_height(), kernel_height(), dilation_height(), subsampling_height());
+      return total_padding - total_padding / 2;
+    } else {
+      return this->padding_bottom_;
+    }
+  }
+
+  inline Convolution3DOperatorTester& padding_left(uint32_t padding_left) {
+    assert(!padding_tf_same());
+    this->padding_left_ = padding_left;
+    return *this;
+  }
+
+  inline uint32_t padding_left() const {
+    if (padding_tf_same()) {
+      return compute_tf_same_padding(input_width(), kernel_width(), dilation_width(), subsampling_width()) / 2;
+    } else {
+      return this->padding_left_;
+    }
+  }
+
+  inline Convolution3DOperatorTester& input_size(uint32_t input_depth, uint32_t input_height, uint32_t input_width) {
+    assert(input_depth >= 1);
+    assert(input_height >= 1);
+    assert(input_width >= 1);
+    this->input_depth_ = input_depth;
+    this->input_height_ = input_height;
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline uint32_t input_depth() const {
+    return this->input_depth_;
+  }
+
+  inline uint32_t input_height() const {
+    return this->input_height_;
+  }
+
+  inline uint32_t input_width() const {
+    return this->input_width_;
+  }
+
+  inline Convolution3DOperatorTester& groups(uint32_t groups) {
+    assert(groups >= 1);
+    this->groups_ = groups;
+    return *this;
+  }
+
+  inline uint32_t groups() const {
+    return this->groups_;
+  }
+
+  inline Convolution3DOperatorTester& group_input_channels(size_t group_input_channels) {
+    assert(group_input_channels >= 1);
+    this->group_input_channels_ = group_input_channels;
+    return *this;
+  }
+
+  inline size_t group_input_channels() const {
+    return this->group_input_channels_;
+  }
+
+  inline Convolution3DOperatorTester& group_output_channels(size_t group_output_channels) {
+    assert(group_output_channels >= 1);
+    this->group_output_channels_ = group_output_channels;
+    return *this;
+  }
+
+  inline size_t group_output_channels() const {
+    return this->group_output_channels_;
+  }
+
+  inline Convolution3DOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size >= 1);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline Convolution3DOperatorTester& kernel_size(uint32_t kernel_size) {
+    assert(kernel_size >= 1);
+    this->kernel_depth_ = kernel_size;
+    this->kernel_height_ = kernel_size;
+    this->kernel_width_ = kernel_size;
+    return *this;
+  }
+
+  inline Convolution3DOperatorTester& kernel_size(uint32_t kernel_depth, uint32_t kernel_height, uint32_t kernel_width) {
+    assert(kernel_depth >= 1);
+    assert(kernel_height >= 1);
+    assert(kernel_width >= 1);
+    this->kernel_depth_ = kernel_depth;
+    this->kernel_height_ = kernel_height;
+    this->kernel_width_ = kernel_width;
+    return *this;
+  }
+
+  inline uint32_t kernel_depth() const {
+    return this->kernel_depth_;
+  }
+
+  inline uint32_t kernel_height() const {
+    return this->kernel_height_;
+  }
+
+  inline uint32_t kernel_width() const {
+    return this->kernel_width_;
+  }
+
+  inline Convolution3DOperatorTester& dilation(uint32_t dilation) {
+    assert(dilation >= 1);
+    this->dilation_depth_ = dilation;
+    this->dilation_height_ = dilation;
+    this->dilation_width_ = dilation;
+    return *this;
+  }
+
+  inline Convolution3DOperatorTester& dilation(uint32_t dilation_depth, uint32_t dilation_height, uint32_t dilation_width) {
+    assert(dilation_depth >= 1);
+    assert(dilation_height >= 1);
+    assert(dilation_width >= 1);
+    this->dilation_depth_ = dilation_depth;
+    this->dilation_height_ = dilation_height;
+    this->dilation_width_ = dilation_width;
+    return *this;
+  }
+
+  inline uint32_t dilation_depth() const {
+    return this->dilation_depth_;
+  }
+
+  inline uint32_t dilation_height() const {
+    return this->dilation_height_;
+  }
+
+  inline uint32_t dilation_width() const {
+    return this->dilation_width_;
+  }
+
+  inline Convolution3DOperatorTester& subsampling(uint32_t subsampling) {
+    assert(subsampling >= 1);
+    this->subsampling_depth_ = subsampling;
+    this->subsampling_height_ = subsampling;
+    this->subsampling_width_ = subsampling;
+    return *this;
+  }
+
+  inline Convolution3DOperatorTester& subsampling(uint32_t subsampling_depth, uint32_t subsampling_height, uint32_t subsampling_width) {
+    assert(subsampling_depth >= 1);
+    assert(subsampling_height >= 1);
+    assert(subsampling_width >= 1);
+    this->subsampling_depth_ = subsampling_depth;
+    this->subsampling_height_ = subsampling_height;
+    this->subsampling_width_ = subsampling_width;
+    return *this;
+  }
+
+  inline uint32_t subsampling_depth() const {
+    return this->subsampling_depth_;
+  }
+
+  inline uint32_t subsampling_height() const {
+    return this->subsampling_height_;
+  }
+
+  inline uint32_t subsampling_width() const {
+    return this->subsampling_width_;
+  }
+
+  inline Convolution3DOperatorTester& input_channel_stride(size_t input_channel_stride) {
+    assert(input_channel_stride >= 1);
+    this->input_channel_stride_ = input_channel_stride;
+    return *this;
+  }
+
+  inline size_t input_channel_stride() const {
+    if (this->input_channel_stride_ == 0) {
+      return group_input_channels() * groups();
+    } else {
+      assert(this->input_channel_stride_ >= group_input_channels() * groups());
+      return this->input_channel_stride_;
+    }
+  }
+
+  inline Convolution3DOperatorTester& output_channel_stride(size_t output_channel_stride) {
+    assert(output_channel_stride >= 1);
+    this->output_channel_stride_ = output_channel_stride;
+    return *this;
+  }
+
+  inline size_t output_channel_stride() const {
+    if (this->output_channel_stride_ == 0) {
+      return group_output_channels() * groups();
+    } else {
+      assert(this->output_channel_stride_ >= group_output_channels() * groups());
+      return this->output_channel_stride_;
+    }
+  }
+
+  inline size_t output_depth() const {
+    return compute_output_dimension(
+      padding_front() + input_depth() + padding_back(), kernel_depth(), dilation_depth(), subsampling_depth());
+  }
+
+  inline size_t output_height() const {
+    return compute_output_dimension(
+      padding_top() + input_height() + padding_bottom(), kernel_height(), dilation_height(), subsampling_height());
+  }
+
+  inline size_t output_width() const {
+    return compute_output_dimension(
+      padding_left() + input_width() + padding_right(), kernel_width(), dilation_width(), subsampling_width());
+  }
+
+  inline Convolution3DOperatorTester& has_bias(bool has_bias) {
+    this->has_bias_ = has_bias;
+    return *this;
+  }
+
+  inline bool has_bias() const {
+    return this->has_bias_;
+  }
+
+  inline Convolution3DOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline Convolution3DOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline Convolution3DOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestNDHWCxQS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i32dist(-10000, 10000);
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_int_distribution<int32_t> w8dist(
+      -std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max());
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) + input_elements());
+    std::vector<int8_t> kernel(kernel_elements());
+    std::vector<int32_t> bias(groups() * group_output_channels());
+    std::vector<int8_t> output(output_elements());
+    std::vector<double> accumulators(output_pixels() * groups() * group_output_channels());
+    std::vector<double> output_ref(accumulators.size());
+
+    const int8_t input_zero_point = -1;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return w8dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return i32dist(rng); });
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results, without renormalization.
+      ComputeReference(
+        [&](size_t i) { return double(int32_t(input[i]) - int32_t(input_zero_point)); },
+        [&](size_t i) { return double(kernel[i]); },
+        [&](size_t i) { return double(bias[i]); },
+        accumulators);
+
+      // Compute renormalization parameters.
+      const double accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const double accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double output_scale = std::max(accumulated_max - accumulated_min, 1.0) / 255.0;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * (accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Renormalize reference results.
+      std::transform(accumulators.cbegin(), accumulators.cend(), output_ref.begin(),
+        [this, output_scale, output_zero_point](double x) -> double {
+          return std::max<double>(std::min<double>(x / output_scale, double(qmax() - 0x80) - output_zero_point), double(qmin() - 0x80) - output_zero_point);
+        });
+
+      // Create, setup, run, and destroy Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      xnn_status status = xnn_create_convolution3d_ndhwc_qs8(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          kernel_depth(), kernel_height(), kernel_width(),
+          subsampling_depth(), subsampling_height(), subsampling_width(),
+          dilation_depth(), dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          input_zero_point, 1.0f /* input scale */, 1.0f /* kernel scale */,
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+          padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0,
+          nullptr /* caches */,
+          &convolution_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution3d_ndhwc_qs8(
+          convolution_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+      // Verify results.
+      Verify(
+        [&](size_t i) { return double(int32_t(output[i]) - int32_t(output_zero_point)); },
+        output_ref, [](double) { return 0.9; });
+    }
+  }
+
+  void TestNDHWCxF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) + input_elements());
+    std::vector<float> kernel(kernel_elements());
+    std::vector<float> bias(groups() * group_output_channels());
+    std::vector<uint16_t> output(output_elements());
+    std::vector<double> output_ref(output_pixels() * groups() * group_output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      // Weights are passed in FP32 and converted to FP16 during packing: round them to FP16 for the reference.
+      std::generate(kernel.begin(), kernel.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+      std::generate(bias.begin(), bias.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      ComputeReference(
+        [&](size_t i) { return double(fp16_ieee_to_fp32_value(input[i])); },
+        [&](size_t i) { return double(kernel[i]); },
+        [&](size_t i) { return double(bias[i]); },
+        output_ref);
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        float(accumulated_min + accumulated_range / 255.0 * double(qmin()))));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        float(accumulated_max - accumulated_range / 255.0 * double(255 - qmax()))));
+
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      xnn_status status = xnn_create_convolution3d_ndhwc_f16(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          kernel_depth(), kernel_height(), kernel_width(),
+          subsampling_depth(), subsampling_height(), subsampling_width(),
+          dilation_depth(), dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          XNN_FLAG_FP32_STATIC_WEIGHTS | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+          nullptr /* caches */,
+          &convolution_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution3d_ndhwc_f16(
+          convolution_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+      Verify(
+        [&](size_t i) { return double(fp16_ieee_to_fp32_value(output[i])); },
+        output_ref, [](double y) { return std::max(1.0e-4, std::abs(y) * 1.0e-2); });
+    }
+  }
+
+  void TestNDHWCxF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + input_elements());
+    std::vector<float> kernel(kernel_elements());
+    std::vector<float> bias(groups() * group_output_channels());
+    std::vector<float> output(output_elements());
+    std::vector<double> output_ref(output_pixels() * groups() * group_output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      ComputeReference(
+        [&](size_t i) { return double(input[i]); },
+        [&](size_t i) { return double(kernel[i]); },
+        [&](size_t i) { return double(bias[i]); },
+        output_ref);
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        float(accumulated_min + accumulated_range / 255.0 * double(qmin()));
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        float(accumulated_max - accumulated_range / 255.0 * double(255 - qmax()));
+
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, xnn_create_convolution3d_ndhwc_f32(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          kernel_depth(), kernel_height(), kernel_width(),
+          subsampling_depth(), subsampling_height(), subsampling_width(),
+          dilation_depth(), dilation_height(), dilation_width(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0,
+          nullptr /* caches */,
+          &convolution_op));
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_convolution3d_ndhwc_f32(
+          convolution_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+
+      Verify(
+        [&](size_t i) { return double(output[i]); },
+        output_ref, [](double y) { return std::max(1.0e-5, std::abs(y) * 1.0e-5); });
+    }
+  }
+
+ private:
+  static inline uint32_t compute_tf_same_padding(
+    size_t input_dimension, uint32_t kernel_dimension, uint32_t dilation_dimension, uint32_t subsampling_dimension)
+  {
+    const size_t output_dimension = (input_dimension + subsampling_dimension - 1) / subsampling_dimension;
+    const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+    const size_t padded_dimension = (output_dimension - 1) * subsampling_dimension + effective_kernel_dimension;
+    return padded_dimension > input_dimension ? uint32_t(padded_dimension - input_dimension) : 0;
+  }
+
+  static inline size_t compute_output_dimension(
+    size_t padded_input_dimension, uint32_t kernel_dimension, uint32_t dilation_dimension, uint32_t subsampling_dimension)
+  {
+    const size_t effective_kernel_dimension = (kernel_dimension - 1) * dilation_dimension + 1;
+    return padded_input_dimension > effective_kernel_dimension ?
+      (padded_input_dimension - effective_kernel_dimension) / subsampling_dimension + 1 : 1;
+  }
+
+  inline size_t input_pixels() const {
+    return input_depth() * input_height() * input_width();
+  }
+
+  inline size_t output_pixels() const {
+    return batch_size() * output_depth() * output_height() * output_width();
+  }
+
+  inline size_t input_elements() const {
+    return (batch_size() * input_pixels() - 1) * input_channel_stride() + groups() * group_input_channels();
+  }
+
+  inline size_t output_elements() const {
+    return (output_pixels() - 1) * output_channel_stride() + groups() * group_output_channels();
+  }
+
+  inline size_t kernel_elements() const {
+    return groups() * group_output_channels() * kernel_depth() * kernel_height() * kernel_width() * group_input_channels();
+  }
+
+  // Computes the reference output in [batch, output_depth, output_height, output_width, groups * group_output_channels]
+  // layout. Kernel elements are in [groups * group_output_channels, kernel_depth, kernel_height, kernel_width,
+  // group_input_channels] layout.
+  template<class InputFn, class KernelFn, class BiasFn>
+  void ComputeReference(InputFn input, KernelFn kernel, BiasFn bias, std::vector<double>& output_ref) const {
+    const size_t output_channels = groups() * group_output_channels();
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t oz = 0; oz < output_depth(); oz++) {
+        for (size_t oy = 0; oy < output_height(); oy++) {
+          for (size_t ox = 0; ox < output_width(); ox++) {
+            const size_t output_pixel = ((i * output_depth() + oz) * output_height() + oy) * output_width() + ox;
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t oc = 0; oc < group_output_channels(); oc++) {
+                const size_t output_channel = g * group_output_channels() + oc;
+                double acc = has_bias() ? bias(output_channel) : 0.0;
+                for (size_t kz = 0; kz < kernel_depth(); kz++) {
+                  const size_t iz = oz * subsampling_depth() + kz * dilation_depth() - padding_front();
+                  if (iz >= input_depth()) {
+                    continue;
+                  }
+                  for (size_t ky = 0; ky < kernel_height(); ky++) {
+                    const size_t iy = oy * subsampling_height() + ky * dilation_height() - padding_top();
+                    if (iy >= input_height()) {
+                      continue;
+                    }
+                    for (size_t kx = 0; kx < kernel_width(); kx++) {
+                      const size_t ix = ox * subsampling_width() + kx * dilation_width() - padding_left();
+                      if (ix >= input_width()) {
+                        continue;
+                      }
+                      const size_t input_pixel = ((i * input_depth() + iz) * input_height() + iy) * input_width() + ix;
+                      for (size_t ic = 0; ic < group_input_channels(); ic++) {
+                        acc += input(input_pixel * input_channel_stride() + g * group_input_channels() + ic) *
+                          kernel((((output_channel * kernel_depth() + kz) * kernel_height() + ky) * kernel_width() + kx) *
+                            group_input_channels() + ic);
+                      }
+                    }
+                  }
+                }
+                output_ref[output_pixel * output_channels + output_channel] = acc;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  template<class OutputFn, class ToleranceFn>
+  void Verify(OutputFn output, const std::vector<double>& output_ref, ToleranceFn tolerance) const {
+    const size_t output_channels = groups() * group_output_channels();
+    for (size_t p = 0; p < output_pixels(); p++) {
+      for (size_t c = 0; c < output_channels; c++) {
+        const double y_ref = output_ref[p * output_channels + c];
+        ASSERT_NEAR(output(p * output_channel_stride() + c), y_ref, tolerance(y_ref))
+          << "output pixel " << p << " / " << output_pixels() << ", channel " << c << " / " << output_channels;
+      }
+    }
+  }
+
+  uint32_t padding_front_{0};
+  uint32_t padding_back_{0};
+  uint32_t padding_top_{0};
+  uint32_t padding_right_{0};
+  uint32_t padding_bottom_{0};
+  uint32_t padding_left_{0};
+  bool padding_tf_same_{false};
+  size_t input_depth_{1};
+  size_t input_height_{1};
+  size_t input_width_{1};
+  uint32_t groups_{1};
+  size_t group_input_channels_{1};
+  size_t input_channel_stride_{0};
+  size_t group_output_channels_{1};
+  size_t output_channel_stride_{0};
+  size_t batch_size_{1};
+  uint32_t kernel_depth_{1};
+  uint32_t kernel_height_{1};
+  uint32_t kernel_width_{1};
+  uint32_t dilation_depth_{1};
+  uint32_t dilation_height_{1};
+  uint32_t dilation_width_{1};
+  uint32_t subsampling_depth_{1};
+  uint32_t subsampling_height_{1};
+  uint32_t subsampling_width_{1};
+  bool has_bias_{true};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{1};
+};
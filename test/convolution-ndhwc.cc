@@ -0,0 +1,348 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "convolution-3d-operator-tester.h"
+
+
+TEST(CONVOLUTION_NDHWC_QS8, 1x1x1) {
+  Convolution3DOperatorTester()
+    .input_size(3, 5, 4)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .TestNDHWCxQS8();
+}
+
+TEST(CONVOLUTION_NDHWC_QS8, 3x3x3) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxQS8();
+}
+
+TEST(CONVOLUTION_NDHWC_QS8, 3x3x3_with_qmin) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .qmin(128)
+    .TestNDHWCxQS8();
+}
+
+TEST(CONVOLUTION_NDHWC_QS8, 3x3x3_with_qmax) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .qmax(128)
+    .TestNDHWCxQS8();
+}
+
+TEST(CONVOLUTION_NDHWC_QS8, 3x3x3_grouped) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .groups(2)
+    .group_input_channels(5)
+    .group_output_channels(9)
+    .TestNDHWCxQS8();
+}
+
+TEST(CONVOLUTION_NDHWC_QS8, 3x3x3_depthwise) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .groups(17)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestNDHWCxQS8();
+}
+
+TEST(CONVOLUTION_NDHWC_QS8, 3x3x3_without_bias) {
+  Convolution3DOperatorTester()
+    .has_bias(false)
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxQS8();
+}
+
+TEST(CONVOLUTION_NDHWC_F16, 1x1x1) {
+  Convolution3DOperatorTester()
+    .input_size(3, 5, 4)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .TestNDHWCxF16();
+}
+
+TEST(CONVOLUTION_NDHWC_F16, 1x1x1_with_batch) {
+  Convolution3DOperatorTester()
+    .batch_size(3)
+    .input_size(3, 5, 4)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .TestNDHWCxF16();
+}
+
+TEST(CONVOLUTION_NDHWC_F16, 3x3x3) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF16();
+}
+
+TEST(CONVOLUTION_NDHWC_F16, 3x3x3_with_qmin_qmax) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .qmin(64)
+    .qmax(192)
+    .TestNDHWCxF16();
+}
+
+TEST(CONVOLUTION_NDHWC_F16, 3x3x3_grouped) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .groups(2)
+    .group_input_channels(5)
+    .group_output_channels(9)
+    .TestNDHWCxF16();
+}
+
+TEST(CONVOLUTION_NDHWC_F16, 3x3x3_tf_same_padding) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding_tf_same(true)
+    .kernel_size(3)
+    .subsampling(2)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF16();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 1x1x1) {
+  Convolution3DOperatorTester()
+    .input_size(3, 5, 4)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 1x1x1_with_batch) {
+  Convolution3DOperatorTester()
+    .batch_size(3)
+    .input_size(3, 5, 4)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 1x1x1_with_input_stride) {
+  Convolution3DOperatorTester()
+    .input_size(3, 5, 4)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .input_channel_stride(28)
+    .group_output_channels(19)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 1x1x1_with_output_stride) {
+  Convolution3DOperatorTester()
+    .input_size(3, 5, 4)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .output_channel_stride(29)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 1x1x1_with_padding) {
+  Convolution3DOperatorTester()
+    .input_size(3, 5, 4)
+    .padding(1)
+    .kernel_size(1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_without_padding) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_with_asymmetric_padding) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding_front(2)
+    .padding_back(0)
+    .padding_top(0)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_with_qmin_qmax) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .qmin(64)
+    .qmax(192)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_with_subsampling) {
+  for (uint32_t subsampling = 2; subsampling <= 3; subsampling++) {
+    Convolution3DOperatorTester()
+      .input_size(7, 8, 9)
+      .padding(1)
+      .kernel_size(3)
+      .subsampling(subsampling)
+      .group_input_channels(7)
+      .group_output_channels(13)
+      .TestNDHWCxF32();
+  }
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_with_dilation) {
+  for (uint32_t dilation = 2; dilation <= 3; dilation++) {
+    Convolution3DOperatorTester()
+      .input_size(7, 8, 9)
+      .padding(dilation)
+      .kernel_size(3)
+      .dilation(dilation)
+      .group_input_channels(7)
+      .group_output_channels(13)
+      .TestNDHWCxF32();
+  }
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_with_batch) {
+  Convolution3DOperatorTester()
+    .batch_size(3)
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_grouped) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .groups(2)
+    .group_input_channels(5)
+    .group_output_channels(9)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_depthwise) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .groups(17)
+    .group_input_channels(1)
+    .group_output_channels(1)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_without_bias) {
+  Convolution3DOperatorTester()
+    .has_bias(false)
+    .input_size(4, 5, 6)
+    .padding(1)
+    .kernel_size(3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 1x3x3) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding_top(1)
+    .padding_bottom(1)
+    .padding_left(1)
+    .padding_right(1)
+    .kernel_size(1, 3, 3)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x1x1) {
+  Convolution3DOperatorTester()
+    .input_size(4, 5, 6)
+    .padding_front(1)
+    .padding_back(1)
+    .kernel_size(3, 1, 1)
+    .group_input_channels(7)
+    .group_output_channels(13)
+    .TestNDHWCxF32();
+}
+
+TEST(CONVOLUTION_NDHWC_F32, 3x3x3_tf_same_padding) {
+  for (uint32_t subsampling = 1; subsampling <= 2; subsampling++) {
+    Convolution3DOperatorTester()
+      .input_size(4, 5, 6)
+      .padding_tf_same(true)
+      .kernel_size(3)
+      .subsampling(subsampling)
+      .group_input_channels(7)
+      .group_output_channels(13)
+      .TestNDHWCxF32();
+  }
+}
@@ -4252,6 +4252,203 @@ TEST(CONVOLUTION_NHWC_F32, 3x3_with_batch) {
     .TestNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_without_padding) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_odd_output) {
+  ConvolutionOperatorTester()
+    .input_size(10, 9)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_asymmetric_padding) {
+  for (size_t padding_top = 0; padding_top <= 2; padding_top++) {
+    for (size_t padding_left = 0; padding_left <= 2; padding_left++) {
+      ConvolutionOperatorTester()
+        .input_size(11, 10)
+        .padding_top(padding_top)
+        .padding_left(padding_left)
+        .padding_bottom(1)
+        .kernel_size(3, 3)
+        .group_input_channels(24)
+        .group_output_channels(28)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_tf_same_padding) {
+  ConvolutionOperatorTester()
+    .input_size(11, 10)
+    .padding_tf_same(true)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_input_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .input_channel_stride(37)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .output_channel_stride(43)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .qmin(128)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_qmax) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .qmax(128)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_without_bias) {
+  ConvolutionOperatorTester()
+    .has_bias(false)
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(10, 9)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_unit_output) {
+  ConvolutionOperatorTester()
+    .input_size(3, 3)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_many_channels) {
+  ConvolutionOperatorTester()
+    .input_size(9, 8)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(67)
+    .group_output_channels(71)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_large_image) {
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(41, 37)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_with_wide_channels) {
+  ConvolutionOperatorTester()
+    .input_size(9, 8)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(520)
+    .group_output_channels(530)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_multithreaded) {
+  ConvolutionOperatorTester()
+    .batch_size(2)
+    .input_size(41, 37)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .num_threads(4)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, winograd_3x3_disabled) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .disable_winograd(true)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, grouped_3x3) {
   ConvolutionOperatorTester()
     .input_size(10, 11)
@@ -4967,6 +5164,19 @@ TEST(CONVOLUTION_NHWC_F32, weights_cache_3x3) {
     .TestNHWCxF32();
 }
 
+// Tests Winograd transforms with weights cache.
+TEST(CONVOLUTION_NHWC_F32, weights_cache_winograd_3x3) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 // Tests vmulcaddc microkernel with weights cache.
 TEST(CONVOLUTION_NHWC_F32, weights_cache_depthwise_1x1) {
   ConvolutionOperatorTester()
@@ -6577,6 +6787,34 @@ TEST(CONVOLUTION_NHWC_F32, setup_changing_height) {
     .TestSetupNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, setup_changing_size_winograd) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(11)
+    .next_input_width(9)
+    .next_batch_size(4)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .TestSetupNHWCxF32();
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_height(8)
+    .input_width(8)
+    .next_input_height(5)
+    .next_input_width(7)
+    .next_batch_size(2)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(32)
+    .group_output_channels(40)
+    .TestSetupNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F32, setup_changing_height_grouped) {
   ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
   ConvolutionOperatorTester()
@@ -6752,6 +6990,107 @@ TEST(CONVOLUTION_NHWC_F32, setup_swap_height_and_width_depthwise) {
     .TestSetupNHWCxF32();
 }
 
+TEST(CONVOLUTION_NHWC_F32, 1x1_with_fp16_weights) {
+  ConvolutionOperatorTester()
+    .input_size(27, 29)
+    .kernel_size(1, 1)
+    .group_input_channels(23)
+    .group_output_channels(19)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_fp16_weights) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3_with_fp16_weights_and_qmin) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .qmin(128)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, 3x3s2_with_fp16_weights) {
+  ConvolutionOperatorTester()
+    .input_size(14, 13)
+    .padding(1)
+    .kernel_size(3, 3)
+    .subsampling(2)
+    .group_input_channels(27)
+    .group_output_channels(19)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_fp16_weights) {
+  ConvolutionOperatorTester()
+    .input_size(13, 12)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(15)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(CONVOLUTION_NHWC_F32, grouped_3x3_with_fp16_weights_and_batch) {
+  ConvolutionOperatorTester()
+    .batch_size(3)
+    .input_size(10, 9)
+    .padding(1)
+    .kernel_size(3, 3)
+    .groups(2)
+    .group_input_channels(17)
+    .group_output_channels(15)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(DEPTHWISE_CONVOLUTION_NHWC_F32, 3x3_with_fp16_weights) {
+  ConvolutionOperatorTester()
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(DEPTHWISE_CONVOLUTION_NHWC_F32, 3x3_with_depth_multiplier_and_fp16_weights) {
+  ConvolutionOperatorTester()
+    .depthwise_layout(true)
+    .input_size(15, 14)
+    .padding(1, 1)
+    .kernel_size(3, 3)
+    .groups(24)
+    .group_output_channels(3)
+    .weights_type(ConvolutionOperatorTester::WeightsType::FP16)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
 TEST(CONVOLUTION_NHWC_F16, 1x1) {
   ConvolutionOperatorTester()
     .input_size(27, 29)
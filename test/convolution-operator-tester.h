@@ -30,6 +30,7 @@ class ConvolutionOperatorTester {
  public:
   enum class WeightsType {
     Default,
+    FP16,
     FP32,
   };
 
@@ -494,6 +495,15 @@ class ConvolutionOperatorTester {
     return this->depthwise_layout_;
   }
 
+  inline ConvolutionOperatorTester& disable_winograd(bool disable_winograd) {
+    this->disable_winograd_ = disable_winograd;
+    return *this;
+  }
+
+  inline bool disable_winograd() const {
+    return this->disable_winograd_;
+  }
+
   inline ConvolutionOperatorTester& has_bias(bool has_bias) {
     this->has_bias_ = has_bias;
     return *this;
@@ -512,6 +522,16 @@ class ConvolutionOperatorTester {
     return this->weights_type_;
   }
 
+  inline ConvolutionOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads != 0);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
   inline ConvolutionOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -1253,7 +1273,14 @@ class ConvolutionOperatorTester {
   }
 
   void TestNHWCxF32() const {
-    ASSERT_EQ(weights_type(), WeightsType::Default);
+    switch (weights_type()) {
+      case WeightsType::Default:
+        break;
+      case WeightsType::FP16:
+        break;
+      default:
+        GTEST_FAIL() << "unexpected weights type";
+    }
 
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -1266,11 +1293,26 @@ class ConvolutionOperatorTester {
     std::vector<float> output(batch_size() * ((output_height() * output_width() - 1) * output_channel_stride() + groups() * group_output_channels()));
     std::vector<float> output_ref(batch_size() * output_height() * output_width() * groups() * group_output_channels());
 
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
+
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
       std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
       std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
       std::fill(output.begin(), output.end(), nanf(""));
+      if (weights_type() == WeightsType::FP16) {
+        // Weights are stored in FP16 format: round them in the reference too.
+        for (float& value : kernel) {
+          value = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(value));
+        }
+        for (float& value : bias) {
+          value = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(value));
+        }
+      }
 
       // Compute reference results, without clamping.
       if (has_bias()) {
@@ -1386,7 +1428,9 @@ class ConvolutionOperatorTester {
           input_channel_stride(), output_channel_stride(),
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_min, output_max,
-          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+          (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0) |
+          (disable_winograd() ? XNN_FLAG_DISABLE_WINOGRAD : 0) |
+          (weights_type() == WeightsType::FP16 ? XNN_FLAG_FP16_STATIC_WEIGHTS : 0),
           &caches,
           &convolution_op);
       if (status == xnn_status_unsupported_hardware) {
@@ -1409,10 +1453,10 @@ class ConvolutionOperatorTester {
           convolution_op,
           batch_size(), input_height(), input_width(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          auto_threadpool.get()));
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(convolution_op, nullptr /* thread pool */));
+        xnn_run_operator(convolution_op, auto_threadpool.get()));
 
       VerifyNHWCxF32(output, output_ref, output_min, output_max);
 
@@ -1431,7 +1475,8 @@ class ConvolutionOperatorTester {
             input_channel_stride(), output_channel_stride(),
             kernel.data(), has_bias() ? bias.data() : nullptr,
             output_min, output_max,
-            (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0),
+            (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0) | (padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0) |
+            (disable_winograd() ? XNN_FLAG_DISABLE_WINOGRAD : 0),
             &caches,
             &convolution_op2));
 
@@ -3012,7 +3057,7 @@ class ConvolutionOperatorTester {
           input_channel_stride(), output_channel_stride(),
           kernel.data(), has_bias() ? bias.data() : nullptr,
           output_min, output_max,
-          0, NULL, &convolution_op);
+          disable_winograd() ? XNN_FLAG_DISABLE_WINOGRAD : 0, NULL, &convolution_op);
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
       }
@@ -3183,9 +3228,11 @@ class ConvolutionOperatorTester {
   uint8_t qmin_{0};
   uint8_t qmax_{255};
   bool depthwise_layout_{false};
+  bool disable_winograd_{false};
   bool force_nhwc_input_{false};
   bool has_bias_{true};
   WeightsType weights_type_{WeightsType::Default};
+  size_t num_threads_{1};
   size_t iterations_{1};
 #if XNN_PLATFORM_JIT
   bool use_jit_{false};
@@ -0,0 +1,171 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "embedding-lookup-operator-tester.h"
+
+
+TEST(EMBEDDING_LOOKUP_NC_X8, single_index) {
+  for (size_t embedding_dim = 1; embedding_dim <= 33; embedding_dim += 4) {
+    EmbeddingLookupOperatorTester()
+      .num_embeddings(17)
+      .embedding_dim(embedding_dim)
+      .batch_size(1)
+      .TestX8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X8, batch_of_indices) {
+  for (size_t embedding_dim = 1; embedding_dim <= 33; embedding_dim += 4) {
+    EmbeddingLookupOperatorTester()
+      .num_embeddings(17)
+      .embedding_dim(embedding_dim)
+      .batch_size(29)
+      .TestX8();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X8, large_batch) {
+  EmbeddingLookupOperatorTester()
+    .num_embeddings(5)
+    .embedding_dim(7)
+    .batch_size(1001)
+    .TestX8();
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X16, single_index) {
+  for (size_t embedding_dim = 1; embedding_dim <= 33; embedding_dim += 4) {
+    EmbeddingLookupOperatorTester()
+      .num_embeddings(17)
+      .embedding_dim(embedding_dim)
+      .batch_size(1)
+      .TestX16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X16, batch_of_indices) {
+  for (size_t embedding_dim = 1; embedding_dim <= 33; embedding_dim += 4) {
+    EmbeddingLookupOperatorTester()
+      .num_embeddings(17)
+      .embedding_dim(embedding_dim)
+      .batch_size(29)
+      .TestX16();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X16, large_batch) {
+  EmbeddingLookupOperatorTester()
+    .num_embeddings(5)
+    .embedding_dim(7)
+    .batch_size(1001)
+    .TestX16();
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X32, single_index) {
+  for (size_t embedding_dim = 1; embedding_dim <= 33; embedding_dim += 4) {
+    EmbeddingLookupOperatorTester()
+      .num_embeddings(17)
+      .embedding_dim(embedding_dim)
+      .batch_size(1)
+      .TestX32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X32, batch_of_indices) {
+  for (size_t embedding_dim = 1; embedding_dim <= 33; embedding_dim += 4) {
+    EmbeddingLookupOperatorTester()
+      .num_embeddings(17)
+      .embedding_dim(embedding_dim)
+      .batch_size(29)
+      .TestX32();
+  }
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X32, large_batch) {
+  EmbeddingLookupOperatorTester()
+    .num_embeddings(5)
+    .embedding_dim(7)
+    .batch_size(1001)
+    .TestX32();
+}
+
+TEST(EMBEDDING_LOOKUP_NC_X32, indices_updated_after_setup) {
+  EmbeddingLookupOperatorTester()
+    .num_embeddings(17)
+    .embedding_dim(5)
+    .batch_size(3)
+    .iterations(5)
+    .TestIndicesUpdatedAfterSetup();
+}
+
+TEST(EMBEDDING_BAG_NC_F16, sum) {
+  for (size_t bag_size = 1; bag_size <= 9; bag_size += 2) {
+    EmbeddingLookupOperatorTester()
+      .bag_operator(xnn_reduce_sum)
+      .num_embeddings(19)
+      .embedding_dim(23)
+      .batch_size(7)
+      .bag_size(bag_size)
+      .TestBagF16();
+  }
+}
+
+TEST(EMBEDDING_BAG_NC_F16, mean) {
+  for (size_t bag_size = 1; bag_size <= 9; bag_size += 2) {
+    EmbeddingLookupOperatorTester()
+      .bag_operator(xnn_reduce_mean)
+      .num_embeddings(19)
+      .embedding_dim(23)
+      .batch_size(7)
+      .bag_size(bag_size)
+      .TestBagF16();
+  }
+}
+
+TEST(EMBEDDING_BAG_NC_F32, sum) {
+  for (size_t bag_size = 1; bag_size <= 9; bag_size += 2) {
+    EmbeddingLookupOperatorTester()
+      .bag_operator(xnn_reduce_sum)
+      .num_embeddings(19)
+      .embedding_dim(23)
+      .batch_size(7)
+      .bag_size(bag_size)
+      .TestBagF32();
+  }
+}
+
+TEST(EMBEDDING_BAG_NC_F32, mean) {
+  for (size_t bag_size = 1; bag_size <= 9; bag_size += 2) {
+    EmbeddingLookupOperatorTester()
+      .bag_operator(xnn_reduce_mean)
+      .num_embeddings(19)
+      .embedding_dim(23)
+      .batch_size(7)
+      .bag_size(bag_size)
+      .TestBagF32();
+  }
+}
+
+TEST(EMBEDDING_BAG_NC_F32, large_batch) {
+  EmbeddingLookupOperatorTester()
+    .bag_operator(xnn_reduce_mean)
+    .num_embeddings(11)
+    .embedding_dim(16)
+    .batch_size(301)
+    .bag_size(4)
+    .TestBagF32();
+}
+
+TEST(EMBEDDING_BAG_NC_F32, out_of_range_index) {
+  for (size_t bag_size : {1, 4}) {
+    EmbeddingLookupOperatorTester()
+      .num_embeddings(17)
+      .embedding_dim(5)
+      .batch_size(3)
+      .bag_size(bag_size)
+      .TestInvalidIndex();
+  }
+}
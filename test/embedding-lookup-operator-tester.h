@@ -0,0 +1,460 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class EmbeddingLookupOperatorTester {
+ public:
+  inline EmbeddingLookupOperatorTester& num_embeddings(size_t num_embeddings) {
+    assert(num_embeddings != 0);
+    this->num_embeddings_ = num_embeddings;
+    return *this;
+  }
+
+  inline size_t num_embeddings() const {
+    return this->num_embeddings_;
+  }
+
+  inline EmbeddingLookupOperatorTester& embedding_dim(size_t embedding_dim) {
+    assert(embedding_dim != 0);
+    this->embedding_dim_ = embedding_dim;
+    return *this;
+  }
+
+  inline size_t embedding_dim() const {
+    return this->embedding_dim_;
+  }
+
+  inline EmbeddingLookupOperatorTester& batch_size(size_t batch_size) {
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline EmbeddingLookupOperatorTester& bag_size(size_t bag_size) {
+    assert(bag_size != 0);
+    this->bag_size_ = bag_size;
+    return *this;
+  }
+
+  inline size_t bag_size() const {
+    return this->bag_size_;
+  }
+
+  inline EmbeddingLookupOperatorTester& bag_operator(xnn_reduce_operator bag_operator) {
+    this->bag_operator_ = bag_operator;
+    return *this;
+  }
+
+  inline xnn_reduce_operator bag_operator() const {
+    return this->bag_operator_;
+  }
+
+  inline EmbeddingLookupOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestX8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> u8dist(
+      std::numeric_limits<uint8_t>::min(), std::numeric_limits<uint8_t>::max());
+
+    std::vector<uint8_t> table(num_embeddings() * embedding_dim());
+    std::vector<int32_t> indices(batch_size());
+    std::vector<uint8_t> output(batch_size() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return u8dist(rng); });
+      GenerateIndices(rng, indices);
+      std::fill(output.begin(), output.end(), UINT8_C(0xA5));
+
+      // Create, setup, run, and destroy Embedding Lookup operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t embedding_lookup_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_embedding_lookup_nc_x8(
+          num_embeddings(), embedding_dim(), table.data(),
+          0, &embedding_lookup_op));
+      ASSERT_NE(nullptr, embedding_lookup_op);
+
+      // Smart pointer to automatically delete embedding_lookup_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_lookup_op(embedding_lookup_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_embedding_lookup_nc_x8(
+          embedding_lookup_op,
+          batch_size(), indices.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(embedding_lookup_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          ASSERT_EQ(uint32_t(table[size_t(indices[i]) * embedding_dim() + c]), uint32_t(output[i * embedding_dim() + c]))
+            << "at batch index " << i << " / " << batch_size() << ", channel " << c << " / " << embedding_dim()
+            << ", embedding " << indices[i];
+        }
+      }
+    }
+  }
+
+  void TestX16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<uint16_t> u16dist;
+
+    std::vector<uint16_t> table(num_embeddings() * embedding_dim());
+    std::vector<int32_t> indices(batch_size());
+    std::vector<uint16_t> output(batch_size() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return u16dist(rng); });
+      GenerateIndices(rng, indices);
+      std::fill(output.begin(), output.end(), UINT16_C(0xDEAD));
+
+      // Create, setup, run, and destroy Embedding Lookup operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t embedding_lookup_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_embedding_lookup_nc_x16(
+          num_embeddings(), embedding_dim(), table.data(),
+          0, &embedding_lookup_op));
+      ASSERT_NE(nullptr, embedding_lookup_op);
+
+      // Smart pointer to automatically delete embedding_lookup_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_lookup_op(embedding_lookup_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_embedding_lookup_nc_x16(
+          embedding_lookup_op,
+          batch_size(), indices.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(embedding_lookup_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          ASSERT_EQ(table[size_t(indices[i]) * embedding_dim() + c], output[i * embedding_dim() + c])
+            << "at batch index " << i << " / " << batch_size() << ", channel " << c << " / " << embedding_dim()
+            << ", embedding " << indices[i];
+        }
+      }
+    }
+  }
+
+  void TestX32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<uint32_t> u32dist;
+
+    std::vector<uint32_t> table(num_embeddings() * embedding_dim());
+    std::vector<int32_t> indices(batch_size());
+    std::vector<uint32_t> output(batch_size() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return u32dist(rng); });
+      GenerateIndices(rng, indices);
+      std::fill(output.begin(), output.end(), UINT32_C(0xDEADBEEF));
+
+      // Create, setup, run, and destroy Embedding Lookup operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t embedding_lookup_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_embedding_lookup_nc_x32(
+          num_embeddings(), embedding_dim(), table.data(),
+          0, &embedding_lookup_op));
+      ASSERT_NE(nullptr, embedding_lookup_op);
+
+      // Smart pointer to automatically delete embedding_lookup_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_lookup_op(embedding_lookup_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_embedding_lookup_nc_x32(
+          embedding_lookup_op,
+          batch_size(), indices.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(embedding_lookup_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          ASSERT_EQ(table[size_t(indices[i]) * embedding_dim() + c], output[i * embedding_dim() + c])
+            << "at batch index " << i << " / " << batch_size() << ", channel " << c << " / " << embedding_dim()
+            << ", embedding " << indices[i];
+        }
+      }
+    }
+  }
+
+  void TestBagF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<uint16_t> table(num_embeddings() * embedding_dim() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<int32_t> indices(batch_size() * bag_size());
+    std::vector<uint16_t> output(batch_size() * embedding_dim());
+    std::vector<float> output_ref(batch_size() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      GenerateIndices(rng, indices);
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      ComputeBagReference([&](size_t i) { return fp16_ieee_to_fp32_value(table[i]); }, indices, output_ref);
+
+      // Create, setup, run, and destroy Embedding Bag operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t embedding_bag_op = nullptr;
+
+      const xnn_status status = xnn_create_embedding_bag_nc_f16(
+        bag_operator(), num_embeddings(), embedding_dim(), table.data(),
+        0, &embedding_bag_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, embedding_bag_op);
+
+      // Smart pointer to automatically delete embedding_bag_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_bag_op(embedding_bag_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_embedding_bag_nc_f16(
+          embedding_bag_op,
+          batch_size(), bag_size(), indices.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(embedding_bag_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          ASSERT_NEAR(
+              fp16_ieee_to_fp32_value(output[i * embedding_dim() + c]),
+              output_ref[i * embedding_dim() + c],
+              std::max(1.0e-3f, std::abs(output_ref[i * embedding_dim() + c]) * 1.0e-2f))
+            << "at batch index " << i << " / " << batch_size() << ", channel " << c << " / " << embedding_dim();
+        }
+      }
+    }
+  }
+
+  void TestBagF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<float> table(num_embeddings() * embedding_dim() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<int32_t> indices(batch_size() * bag_size());
+    std::vector<float> output(batch_size() * embedding_dim());
+    std::vector<float> output_ref(batch_size() * embedding_dim());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(table.begin(), table.end(), [&]() { return f32dist(rng); });
+      GenerateIndices(rng, indices);
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      ComputeBagReference([&](size_t i) { return table[i]; }, indices, output_ref);
+
+      // Create, setup, run, and destroy Embedding Bag operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t embedding_bag_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_embedding_bag_nc_f32(
+          bag_operator(), num_embeddings(), embedding_dim(), table.data(),
+          0, &embedding_bag_op));
+      ASSERT_NE(nullptr, embedding_bag_op);
+
+      // Smart pointer to automatically delete embedding_bag_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_bag_op(embedding_bag_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_embedding_bag_nc_f32(
+          embedding_bag_op,
+          batch_size(), bag_size(), indices.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(embedding_bag_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          ASSERT_NEAR(
+              output[i * embedding_dim() + c],
+              output_ref[i * embedding_dim() + c],
+              std::max(1.0e-6f, std::abs(output_ref[i * embedding_dim() + c]) * 1.0e-5f))
+            << "at batch index " << i << " / " << batch_size() << ", channel " << c << " / " << embedding_dim();
+        }
+      }
+    }
+  }
+
+  void TestIndicesUpdatedAfterSetup() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<uint32_t> u32dist;
+
+    std::vector<uint32_t> table(num_embeddings() * embedding_dim());
+    std::vector<int32_t> indices(batch_size());
+    std::vector<uint32_t> output(batch_size() * embedding_dim());
+    std::generate(table.begin(), table.end(), [&]() { return u32dist(rng); });
+
+    ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+    xnn_operator_t embedding_lookup_op = nullptr;
+
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_embedding_lookup_nc_x32(
+        num_embeddings(), embedding_dim(), table.data(),
+        0, &embedding_lookup_op));
+    ASSERT_NE(nullptr, embedding_lookup_op);
+
+    // Smart pointer to automatically delete embedding_lookup_op.
+    std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_lookup_op(embedding_lookup_op, xnn_delete_operator);
+
+    // Indices are not read during setup, so they may be left uninitialized until the operator runs.
+    std::fill(indices.begin(), indices.end(), INT32_C(-1));
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_embedding_lookup_nc_x32(
+        embedding_lookup_op,
+        batch_size(), indices.data(), output.data(),
+        nullptr /* thread pool */));
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      GenerateIndices(rng, indices);
+      std::fill(output.begin(), output.end(), UINT32_C(0xDEADBEEF));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(embedding_lookup_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          ASSERT_EQ(table[size_t(indices[i]) * embedding_dim() + c], output[i * embedding_dim() + c])
+            << "at batch index " << i << " / " << batch_size() << ", channel " << c << " / " << embedding_dim()
+            << ", embedding " << indices[i];
+        }
+      }
+    }
+
+    // Out-of-range indices written after setup fail the run, and produce zero rows.
+    indices.back() = int32_t(num_embeddings());
+    ASSERT_EQ(xnn_status_invalid_parameter,
+      xnn_run_operator(embedding_lookup_op, nullptr /* thread pool */));
+    for (size_t c = 0; c < embedding_dim(); c++) {
+      ASSERT_EQ(output[(batch_size() - 1) * embedding_dim() + c], 0)
+        << "channel " << c << " / " << embedding_dim();
+    }
+  }
+
+  void TestInvalidIndex() const {
+    std::vector<float> table(num_embeddings() * embedding_dim(), 1.0f);
+    std::vector<int32_t> indices(batch_size() * bag_size(), 0);
+    std::vector<float> output(batch_size() * embedding_dim());
+
+    ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+    xnn_operator_t embedding_bag_op = nullptr;
+
+    ASSERT_EQ(xnn_status_success,
+      xnn_create_embedding_bag_nc_f32(
+        xnn_reduce_sum, num_embeddings(), embedding_dim(), table.data(),
+        0, &embedding_bag_op));
+    ASSERT_NE(nullptr, embedding_bag_op);
+
+    // Smart pointer to automatically delete embedding_bag_op.
+    std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_embedding_bag_op(embedding_bag_op, xnn_delete_operator);
+
+    ASSERT_EQ(xnn_status_success,
+      xnn_setup_embedding_bag_nc_f32(
+        embedding_bag_op,
+        batch_size(), bag_size(), indices.data(), output.data(),
+        nullptr /* thread pool */));
+    ASSERT_EQ(xnn_status_success,
+      xnn_run_operator(embedding_bag_op, nullptr /* thread pool */));
+
+    // Out-of-range indices written after setup fail the run, and their rows count as zeros.
+    for (int32_t invalid_index : {int32_t(num_embeddings()), INT32_C(-1), std::numeric_limits<int32_t>::max()}) {
+      indices.back() = invalid_index;
+      ASSERT_EQ(xnn_status_invalid_parameter,
+        xnn_run_operator(embedding_bag_op, nullptr /* thread pool */));
+      for (size_t c = 0; c < embedding_dim(); c++) {
+        ASSERT_EQ(output[(batch_size() - 1) * embedding_dim() + c], float(bag_size() - 1))
+          << "channel " << c << " / " << embedding_dim() << ", index " << invalid_index;
+      }
+    }
+
+    // The error is not sticky once the indices are valid again.
+    indices.back() = 0;
+    ASSERT_EQ(xnn_status_success,
+      xnn_run_operator(embedding_bag_op, nullptr /* thread pool */));
+  }
+
+ private:
+  void GenerateIndices(std::mt19937& rng, std::vector<int32_t>& indices) const {
+    std::uniform_int_distribution<int32_t> index_dist(0, int32_t(num_embeddings() - 1));
+    std::generate(indices.begin(), indices.end(), [&]() { return index_dist(rng); });
+  }
+
+  template<class T>
+  void ComputeBagReference(T table_value, const std::vector<int32_t>& indices, std::vector<float>& output_ref) const {
+    std::fill(output_ref.begin(), output_ref.end(), 0.0f);
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t j = 0; j < bag_size(); j++) {
+        const size_t embedding = size_t(indices[i * bag_size() + j]);
+        for (size_t c = 0; c < embedding_dim(); c++) {
+          output_ref[i * embedding_dim() + c] += table_value(embedding * embedding_dim() + c);
+        }
+      }
+    }
+    if (bag_operator() == xnn_reduce_mean) {
+      for (float& y : output_ref) {
+        y /= float(bag_size());
+      }
+    }
+  }
+
+  size_t num_embeddings_{1};
+  size_t embedding_dim_{1};
+  size_t batch_size_{1};
+  size_t bag_size_{1};
+  xnn_reduce_operator bag_operator_{xnn_reduce_sum};
+  size_t iterations_{3};
+};
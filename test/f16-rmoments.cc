@@ -0,0 +1,165 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f16-rmoments.yaml
+//   Generator: tools/generate-reduce-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/reduce.h>
+#include "reduce-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F16_RMOMENTS__NEONFP16_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f16_rmoments_ukernel__neonfp16_x8, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F16_RMOMENTS__NEONFP16_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__neonfp16_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__NEONFP16_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__neonfp16_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__NEONFP16_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__neonfp16_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F16_RMOMENTS__NEONFP16_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f16_rmoments_ukernel__neonfp16_x16, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F16_RMOMENTS__NEONFP16_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__neonfp16_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__NEONFP16_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__neonfp16_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__NEONFP16_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__neonfp16_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RMOMENTS__F16C_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_F16C;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f16_rmoments_ukernel__f16c_x16, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F16_RMOMENTS__F16C_X16, batch_div_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__f16c_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__F16C_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__f16c_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__F16C_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__f16c_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RMOMENTS__F16C_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_F16C;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f16_rmoments_ukernel__f16c_x32, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F16_RMOMENTS__F16C_X32, batch_div_32) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__f16c_x32, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__F16C_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__f16c_x32, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F16_RMOMENTS__F16C_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rmoments_ukernel__f16c_x32, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
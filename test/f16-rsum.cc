@@ -0,0 +1,425 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f16-rsum.yaml
+//   Generator: tools/generate-reduce-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/reduce.h>
+#include "reduce-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F16_RSUM__NEONFP16_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f16_rsum_ukernel__neonfp16_x8);
+  }
+
+  TEST(F16_RSUM__NEONFP16_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x8);
+    }
+  }
+
+  TEST(F16_RSUM__NEONFP16_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x8);
+    }
+  }
+
+  TEST(F16_RSUM__NEONFP16_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x8);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F16_RSUM__NEONFP16_X16_ACC2, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f16_rsum_ukernel__neonfp16_x16_acc2);
+  }
+
+  TEST(F16_RSUM__NEONFP16_X16_ACC2, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x16_acc2);
+    }
+  }
+
+  TEST(F16_RSUM__NEONFP16_X16_ACC2, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x16_acc2);
+    }
+  }
+
+  TEST(F16_RSUM__NEONFP16_X16_ACC2, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x16_acc2);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F16_RSUM__NEONFP16_X32_ACC4, batch_eq_32) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f16_rsum_ukernel__neonfp16_x32_acc4);
+  }
+
+  TEST(F16_RSUM__NEONFP16_X32_ACC4, batch_div_32) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x32_acc4);
+    }
+  }
+
+  TEST(F16_RSUM__NEONFP16_X32_ACC4, batch_lt_32) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x32_acc4);
+    }
+  }
+
+  TEST(F16_RSUM__NEONFP16_X32_ACC4, batch_gt_32) {
+    TEST_REQUIRES_ARM_NEON_FP16;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__neonfp16_x32_acc4);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RSUM__F16C_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_F16C;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f16_rsum_ukernel__f16c_x8);
+  }
+
+  TEST(F16_RSUM__F16C_X8, batch_div_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x8);
+    }
+  }
+
+  TEST(F16_RSUM__F16C_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x8);
+    }
+  }
+
+  TEST(F16_RSUM__F16C_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x8);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RSUM__F16C_X16_ACC2, batch_eq_16) {
+    TEST_REQUIRES_X86_F16C;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f16_rsum_ukernel__f16c_x16_acc2);
+  }
+
+  TEST(F16_RSUM__F16C_X16_ACC2, batch_div_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x16_acc2);
+    }
+  }
+
+  TEST(F16_RSUM__F16C_X16_ACC2, batch_lt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x16_acc2);
+    }
+  }
+
+  TEST(F16_RSUM__F16C_X16_ACC2, batch_gt_16) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x16_acc2);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RSUM__F16C_X32_ACC4, batch_eq_32) {
+    TEST_REQUIRES_X86_F16C;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f16_rsum_ukernel__f16c_x32_acc4);
+  }
+
+  TEST(F16_RSUM__F16C_X32_ACC4, batch_div_32) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x32_acc4);
+    }
+  }
+
+  TEST(F16_RSUM__F16C_X32_ACC4, batch_lt_32) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x32_acc4);
+    }
+  }
+
+  TEST(F16_RSUM__F16C_X32_ACC4, batch_gt_32) {
+    TEST_REQUIRES_X86_F16C;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__f16c_x32_acc4);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RSUM__AVX512SKX_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f16_rsum_ukernel__avx512skx_x16);
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x16);
+    }
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x16);
+    }
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x16);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RSUM__AVX512SKX_X32_ACC2, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f16_rsum_ukernel__avx512skx_x32_acc2);
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X32_ACC2, batch_div_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x32_acc2);
+    }
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X32_ACC2, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x32_acc2);
+    }
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X32_ACC2, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x32_acc2);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F16_RSUM__AVX512SKX_X64_ACC4, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    ReduceMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f16_rsum_ukernel__avx512skx_x64_acc4);
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X64_ACC4, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x64_acc4);
+    }
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X64_ACC4, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x64_acc4);
+    }
+  }
+
+  TEST(F16_RSUM__AVX512SKX_X64_ACC4, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f16_rsum_ukernel__avx512skx_x64_acc4);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F16_RSUM__SCALAR_X1, batch_eq_1) {
+  ReduceMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f16_rsum_ukernel__scalar_x1);
+}
+
+TEST(F16_RSUM__SCALAR_X1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f16_rsum_ukernel__scalar_x1);
+  }
+}
+
+TEST(F16_RSUM__SCALAR_X2_ACC2, batch_eq_2) {
+  ReduceMicrokernelTester()
+    .batch_size(2)
+    .Test(xnn_f16_rsum_ukernel__scalar_x2_acc2);
+}
+
+TEST(F16_RSUM__SCALAR_X2_ACC2, batch_div_2) {
+  for (size_t batch_size = 4; batch_size < 20; batch_size += 2) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f16_rsum_ukernel__scalar_x2_acc2);
+  }
+}
+
+TEST(F16_RSUM__SCALAR_X2_ACC2, batch_lt_2) {
+  for (size_t batch_size = 1; batch_size < 2; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f16_rsum_ukernel__scalar_x2_acc2);
+  }
+}
+
+TEST(F16_RSUM__SCALAR_X2_ACC2, batch_gt_2) {
+  for (size_t batch_size = 3; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f16_rsum_ukernel__scalar_x2_acc2);
+  }
+}
+
+TEST(F16_RSUM__SCALAR_X4_ACC4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f16_rsum_ukernel__scalar_x4_acc4);
+}
+
+TEST(F16_RSUM__SCALAR_X4_ACC4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f16_rsum_ukernel__scalar_x4_acc4);
+  }
+}
+
+TEST(F16_RSUM__SCALAR_X4_ACC4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f16_rsum_ukernel__scalar_x4_acc4);
+  }
+}
+
+TEST(F16_RSUM__SCALAR_X4_ACC4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f16_rsum_ukernel__scalar_x4_acc4);
+  }
+}
\ No newline at end of file
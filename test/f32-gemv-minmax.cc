@@ -0,0 +1,1847 @@
+// Copyright (c) Facebook, Inc. and its affiliates.
+// All rights reserved.
+//
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-gemv-minmax.yaml
+//   Generator: tools/generate-gemm-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/allocator.h>
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/gemm.h>
+#include <xnnpack/igemm.h>
+#include <xnnpack/ppmm.h>
+#include "gemm-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(4)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(4)
+      .cn_stride(11)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 8; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(8)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 1; n <= 8; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, k_div_4_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_gt_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_gt_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 9; n < 16; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_div_8_strided_cn) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(11)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_div_8_strided_a) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, n_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (uint32_t n = 16; n <= 24; n += 8) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, strided_cm_subtile) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 8; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(8)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(11)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X8__SSE_LOAD1_ACC4_PRFM, strided_cm) {
+    TEST_REQUIRES_X86_SSE;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(4)
+      .cm_stride(11)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x8__sse_load1_acc4_prfm, xnn_init_f32_minmax_sse_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_eq_4) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cn_stride(19)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_lt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_gt_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_div_4) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, k_div_4_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, qmin) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, qmax) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX_BROADCAST_ACC4_PRFM, strided_cm) {
+    TEST_REQUIRES_X86_AVX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cm_stride(19)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_eq_4) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cn_stride(19)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_lt_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_gt_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_div_4) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, k_div_4_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_gt_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_div_16) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, n_div_16_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, strided_cm_subtile) {
+    TEST_REQUIRES_X86_FMA3;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, qmin) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, qmax) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__FMA3_BROADCAST_ACC4_PRFM, strided_cm) {
+    TEST_REQUIRES_X86_FMA3;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cm_stride(19)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__fma3_broadcast_acc4_prfm, xnn_init_f32_minmax_avx_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_eq_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, strided_cn) {
+    TEST_REQUIRES_X86_AVX512F;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cn_stride(19)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_eq_4_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .a_stride(7)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_eq_4_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 16; n++) {
+      for (uint32_t m = 1; m <= 1; m++) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(m)
+          .n(n)
+          .k(4)
+          .iterations(1)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_eq_4_subtile_m) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t m = 1; m <= 1; m++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(m)
+        .n(16)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_eq_4_subtile_n) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 1; n <= 16; n++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(n)
+        .k(4)
+        .iterations(1)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_lt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_lt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 1; k < 4; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(7)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_lt_4_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 1; k < 4; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_gt_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_gt_4_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 5; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(11)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_gt_4_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 5; k < 8; k++) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_div_4) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_div_4_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 8; k <= 40; k += 4) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(1)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, k_div_4_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 8; k <= 40; k += 4) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_gt_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_gt_16_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 17; n < 32; n++) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_div_16_strided_cn) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .cn_stride(19)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_div_16_strided_a) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(1)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .a_stride(23)
+          .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, n_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (uint32_t n = 32; n <= 48; n += 16) {
+      for (size_t k = 1; k <= 20; k += 5) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, strided_cm_subtile) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t k = 1; k <= 20; k += 5) {
+      for (uint32_t n = 1; n <= 16; n++) {
+        for (uint32_t m = 1; m <= 1; m++) {
+          GemmMicrokernelTester()
+            .mr(1)
+            .nr(16)
+            .kr(1)
+            .sr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .cm_stride(19)
+            .iterations(1)
+            .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+        }
+      }
+    }
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, qmin) {
+    TEST_REQUIRES_X86_AVX512F;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmin(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, qmax) {
+    TEST_REQUIRES_X86_AVX512F;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .qmax(128)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_GEMV_MINMAX_1X16__AVX512F_BROADCAST_ACC4_PRFM, strided_cm) {
+    TEST_REQUIRES_X86_AVX512F;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(1)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(4)
+      .cm_stride(19)
+      .Test(xnn_f32_gemv_minmax_ukernel_1x16__avx512f_broadcast_acc4_prfm, xnn_init_f32_minmax_scalar_params);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
@@ -0,0 +1,284 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-rmoments.yaml
+//   Generator: tools/generate-reduce-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/reduce.h>
+#include "reduce-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RMOMENTS__NEON_X8, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rmoments_ukernel__neon_x8, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F32_RMOMENTS__NEON_X8, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__neon_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__NEON_X8, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__neon_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__NEON_X8, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__neon_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RMOMENTS__NEON_X16, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rmoments_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F32_RMOMENTS__NEON_X16, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__NEON_X16, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__NEON_X16, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__neon_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMOMENTS__SSE_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rmoments_ukernel__sse_x8, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F32_RMOMENTS__SSE_X8, batch_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__sse_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__SSE_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__sse_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__SSE_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__sse_x8, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMOMENTS__SSE_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rmoments_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F32_RMOMENTS__SSE_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__SSE_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__SSE_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__sse_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMOMENTS__AVX_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rmoments_ukernel__avx_x16, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F32_RMOMENTS__AVX_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__avx_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__AVX_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__avx_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__AVX_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__avx_x16, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RMOMENTS__AVX_X32, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rmoments_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Moments);
+  }
+
+  TEST(F32_RMOMENTS__AVX_X32, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__AVX_X32, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+
+  TEST(F32_RMOMENTS__AVX_X32, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rmoments_ukernel__avx_x32, ReduceMicrokernelTester::OpType::Moments);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_RMOMENTS__SCALAR_X1, batch_eq_1) {
+  ReduceMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f32_rmoments_ukernel__scalar_x1, ReduceMicrokernelTester::OpType::Moments);
+}
+
+TEST(F32_RMOMENTS__SCALAR_X1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmoments_ukernel__scalar_x1, ReduceMicrokernelTester::OpType::Moments);
+  }
+}
+
+TEST(F32_RMOMENTS__SCALAR_X4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rmoments_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Moments);
+}
+
+TEST(F32_RMOMENTS__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmoments_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Moments);
+  }
+}
+
+TEST(F32_RMOMENTS__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmoments_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Moments);
+  }
+}
+
+TEST(F32_RMOMENTS__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rmoments_ukernel__scalar_x4, ReduceMicrokernelTester::OpType::Moments);
+  }
+}
\ No newline at end of file
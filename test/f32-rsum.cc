@@ -0,0 +1,536 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/f32-rsum.yaml
+//   Generator: tools/generate-reduce-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/reduce.h>
+#include "reduce-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RSUM__NEON_X4, batch_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_rsum_ukernel__neon_x4, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__NEON_X4, batch_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X4, batch_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X4, batch_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RSUM__NEON_X8_ACC2, batch_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rsum_ukernel__neon_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__NEON_X8_ACC2, batch_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X8_ACC2, batch_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X8_ACC2, batch_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_RSUM__NEON_X16_ACC4, batch_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsum_ukernel__neon_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__NEON_X16_ACC4, batch_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X16_ACC4, batch_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__NEON_X16_ACC4, batch_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__neon_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__SSE_X4, batch_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(4)
+      .Test(xnn_f32_rsum_ukernel__sse_x4, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__SSE_X4, batch_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X4, batch_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X4, batch_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__SSE_X8_ACC2, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rsum_ukernel__sse_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__SSE_X8_ACC2, batch_div_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X8_ACC2, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X8_ACC2, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x8_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__SSE_X16_ACC4, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsum_ukernel__sse_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__SSE_X16_ACC4, batch_div_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X16_ACC4, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__SSE_X16_ACC4, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__sse_x16_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__AVX_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_f32_rsum_ukernel__avx_x8, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__AVX_X8, batch_div_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x8, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x8, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x8, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__AVX_X16_ACC2, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsum_ukernel__avx_x16_acc2, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__AVX_X16_ACC2, batch_div_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x16_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X16_ACC2, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x16_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X16_ACC2, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x16_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__AVX_X32_ACC4, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rsum_ukernel__avx_x32_acc4, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__AVX_X32_ACC4, batch_div_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x32_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X32_ACC4, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x32_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX_X32_ACC4, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx_x32_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__AVX512F_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_f32_rsum_ukernel__avx512f_x16, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__AVX512F_X16, batch_div_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x16, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x16, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x16, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__AVX512F_X32_ACC2, batch_eq_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(32)
+      .Test(xnn_f32_rsum_ukernel__avx512f_x32_acc2, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__AVX512F_X32_ACC2, batch_div_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 64; batch_size < 320; batch_size += 32) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x32_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X32_ACC2, batch_lt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 32; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x32_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X32_ACC2, batch_gt_32) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 33; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x32_acc2, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_RSUM__AVX512F_X64_ACC4, batch_eq_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    ReduceMicrokernelTester()
+      .batch_size(64)
+      .Test(xnn_f32_rsum_ukernel__avx512f_x64_acc4, ReduceMicrokernelTester::OpType::Sum);
+  }
+
+  TEST(F32_RSUM__AVX512F_X64_ACC4, batch_div_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 128; batch_size < 640; batch_size += 64) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x64_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X64_ACC4, batch_lt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 1; batch_size < 64; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x64_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+
+  TEST(F32_RSUM__AVX512F_X64_ACC4, batch_gt_64) {
+    TEST_REQUIRES_X86_AVX512F;
+    for (size_t batch_size = 65; batch_size < 128; batch_size++) {
+      ReduceMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_f32_rsum_ukernel__avx512f_x64_acc4, ReduceMicrokernelTester::OpType::Sum);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_RSUM__SCALAR_X1, batch_eq_1) {
+  ReduceMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_f32_rsum_ukernel__scalar_x1, ReduceMicrokernelTester::OpType::Sum);
+}
+
+TEST(F32_RSUM__SCALAR_X1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x1, ReduceMicrokernelTester::OpType::Sum);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X2_ACC2, batch_eq_2) {
+  ReduceMicrokernelTester()
+    .batch_size(2)
+    .Test(xnn_f32_rsum_ukernel__scalar_x2_acc2, ReduceMicrokernelTester::OpType::Sum);
+}
+
+TEST(F32_RSUM__SCALAR_X2_ACC2, batch_div_2) {
+  for (size_t batch_size = 4; batch_size < 20; batch_size += 2) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x2_acc2, ReduceMicrokernelTester::OpType::Sum);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X2_ACC2, batch_lt_2) {
+  for (size_t batch_size = 1; batch_size < 2; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x2_acc2, ReduceMicrokernelTester::OpType::Sum);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X2_ACC2, batch_gt_2) {
+  for (size_t batch_size = 3; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x2_acc2, ReduceMicrokernelTester::OpType::Sum);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X4_ACC4, batch_eq_4) {
+  ReduceMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_f32_rsum_ukernel__scalar_x4_acc4, ReduceMicrokernelTester::OpType::Sum);
+}
+
+TEST(F32_RSUM__SCALAR_X4_ACC4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x4_acc4, ReduceMicrokernelTester::OpType::Sum);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X4_ACC4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x4_acc4, ReduceMicrokernelTester::OpType::Sum);
+  }
+}
+
+TEST(F32_RSUM__SCALAR_X4_ACC4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    ReduceMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_f32_rsum_ukernel__scalar_x4_acc4, ReduceMicrokernelTester::OpType::Sum);
+  }
+}
\ No newline at end of file
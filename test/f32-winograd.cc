@@ -0,0 +1,306 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/winograd.h>
+#include "winograd-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__NEON_C4, channels_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4);
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__NEON_C4, channels_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 8; channels < 40; channels += 4) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__NEON_C4, channels_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__NEON_C4, channels_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 5; channels < 8; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__NEON_C4, transformed_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .transformed_stride(21)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__neon_c4);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__SSE_C4, channels_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4);
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__SSE_C4, channels_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 8; channels < 40; channels += 4) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__SSE_C4, channels_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__SSE_C4, channels_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 5; channels < 8; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4);
+    }
+  }
+
+  TEST(F32_WINOGRAD_INPUT_2X2_3X3__SSE_C4, transformed_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .transformed_stride(21)
+        .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__sse_c4);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_WINOGRAD_INPUT_2X2_3X3__SCALAR_C1, channels_eq_1) {
+  WinogradMicrokernelTester()
+    .channels(1)
+    .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1);
+}
+
+TEST(F32_WINOGRAD_INPUT_2X2_3X3__SCALAR_C1, channels_gt_1) {
+  for (size_t channels = 2; channels < 10; channels++) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1);
+  }
+}
+
+TEST(F32_WINOGRAD_INPUT_2X2_3X3__SCALAR_C1, transformed_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .transformed_stride(6)
+      .Test(xnn_f32_winograd_input_ukernel_2x2_3x3__scalar_c1);
+  }
+}
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__NEON_C4, channels_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4, xnn_init_f32_minmax_scalar_params);
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__NEON_C4, channels_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 8; channels < 40; channels += 4) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__NEON_C4, channels_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__NEON_C4, channels_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 5; channels < 8; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__NEON_C4, transformed_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .transformed_stride(21)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__NEON_C4, qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__NEON_C4, qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__neon_c4, xnn_init_f32_minmax_scalar_params);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SSE_C4, channels_eq_4) {
+    TEST_REQUIRES_X86_SSE;
+    WinogradMicrokernelTester()
+      .channels(4)
+      .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4, xnn_init_f32_minmax_sse_params);
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SSE_C4, channels_div_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 8; channels < 40; channels += 4) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SSE_C4, channels_lt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels < 4; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SSE_C4, channels_gt_4) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 5; channels < 8; channels++) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SSE_C4, transformed_stride) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .transformed_stride(21)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SSE_C4, qmin) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmin(128)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+
+  TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SSE_C4, qmax) {
+    TEST_REQUIRES_X86_SSE;
+    for (size_t channels = 1; channels <= 20; channels += 3) {
+      WinogradMicrokernelTester()
+        .channels(channels)
+        .qmax(128)
+        .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__sse_c4, xnn_init_f32_minmax_sse_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SCALAR_C1, channels_eq_1) {
+  WinogradMicrokernelTester()
+    .channels(1)
+    .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1, xnn_init_f32_minmax_scalar_params);
+}
+
+TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SCALAR_C1, channels_gt_1) {
+  for (size_t channels = 2; channels < 10; channels++) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SCALAR_C1, transformed_stride) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .transformed_stride(6)
+      .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SCALAR_C1, qmin) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .qmin(128)
+      .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1, xnn_init_f32_minmax_scalar_params);
+  }
+}
+
+TEST(F32_WINOGRAD_OUTPUT_MINMAX_2X2_3X3__SCALAR_C1, qmax) {
+  for (size_t channels = 1; channels <= 5; channels += 1) {
+    WinogradMicrokernelTester()
+      .channels(channels)
+      .qmax(128)
+      .Test(xnn_f32_winograd_output_minmax_ukernel_2x2_3x3__scalar_c1, xnn_init_f32_minmax_scalar_params);
+  }
+}
@@ -170,6 +170,92 @@ TEST(FULLY_CONNECTED_NC_QS8, weights_cache_unit_batch_transpose_weights) {
     .TestQS8();
 }
 
+TEST(FULLY_CONNECTED_NC_QS8, unit_batch_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, unit_batch_split_k_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .qmin(128)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, unit_batch_split_k_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .qmax(128)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, unit_batch_split_k_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .output_stride(43)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, unit_batch_split_k_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, unit_batch_split_k_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, small_batch_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(4)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8, small_batch_split_k_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(4)
+    .input_channels(1031)
+    .output_channels(37)
+    .input_stride(1039)
+    .num_threads(8)
+    .iterations(3)
+    .TestQS8();
+}
+
 TEST(FULLY_CONNECTED_NC_QU8, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -329,165 +415,1392 @@ TEST(FULLY_CONNECTED_NC_QU8, weights_cache_unit_batch_transpose_weights) {
     .TestQU8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, unit_batch) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_qmin) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_qmin) {
   FullyConnectedOperatorTester()
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
     .qmin(128)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_qmax) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_qmax) {
   FullyConnectedOperatorTester()
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
     .qmax(128)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_input_stride) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_input_stride) {
   FullyConnectedOperatorTester()
     .batch_size(1)
     .input_channels(23)
     .input_stride(28)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_output_stride) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_with_output_stride) {
   FullyConnectedOperatorTester()
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
     .output_stride(29)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, unit_batch_transpose_weights) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_transpose_weights) {
   FullyConnectedOperatorTester()
     .transpose_weights(true)
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, unit_batch_without_bias) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_without_bias) {
   FullyConnectedOperatorTester()
     .has_bias(false)
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, small_batch) {
+TEST(FULLY_CONNECTED_NC_QC8, small_batch) {
   FullyConnectedOperatorTester()
     .batch_size(12)
     .input_channels(23)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, small_batch_with_qmin) {
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_qmin) {
   FullyConnectedOperatorTester()
     .batch_size(12)
     .input_channels(23)
     .output_channels(19)
     .qmin(128)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, small_batch_with_qmax) {
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_qmax) {
   FullyConnectedOperatorTester()
     .batch_size(12)
     .input_channels(23)
     .output_channels(19)
     .qmax(128)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, small_batch_with_input_stride) {
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_input_stride) {
   FullyConnectedOperatorTester()
     .batch_size(12)
     .input_channels(23)
     .input_stride(28)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, small_batch_with_output_stride) {
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_with_output_stride) {
   FullyConnectedOperatorTester()
     .batch_size(12)
     .input_channels(23)
     .output_channels(19)
     .output_stride(29)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, small_batch_transpose_weights) {
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_transpose_weights) {
   FullyConnectedOperatorTester()
     .transpose_weights(true)
     .batch_size(12)
     .input_channels(23)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, small_batch_without_bias) {
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_without_bias) {
   FullyConnectedOperatorTester()
     .has_bias(false)
     .batch_size(12)
     .input_channels(23)
     .output_channels(19)
     .iterations(3)
-    .TestF32();
+    .TestQC8();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch) {
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_split_k_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .qmin(128)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_split_k_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .qmax(128)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_split_k_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .output_stride(43)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_split_k_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, unit_batch_split_k_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(4)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QC8, small_batch_split_k_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(4)
+    .input_channels(1031)
+    .output_channels(37)
+    .input_stride(1039)
+    .num_threads(8)
+    .iterations(3)
+    .TestQC8();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
-    .use_weights_cache(true)
     .iterations(3)
-    .TestF32();
+    .TestQD8F32QC8W();
 }
 
-TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch_transpose_weights) {
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_transpose_weights) {
   FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
     .transpose_weights(true)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
     .batch_size(1)
     .input_channels(23)
     .output_channels(19)
-    .use_weights_cache(true)
+    .has_bias(false)
     .iterations(3)
-    .TestF32();
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .transpose_weights(true)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC8W, small_batch_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestQD8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .transpose_weights(true)
+    .iterations(3)
+    .TestQS8F32QC8W();
 }
 
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QS8_F32_QC8W, small_batch_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestQS8F32QC8W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch_with_kernel_zero_point_0) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(0)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch_with_kernel_zero_point_15) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(15)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_with_kernel_zero_point_0) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(0)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_with_kernel_zero_point_15) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(15)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_QD8_F32_QC4W, small_batch_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestQD8F32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_weights) {
+  FullyConnectedOperatorTester()
+    .batch_size(19)
+    .input_channels(1031)
+    .output_channels(301)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_weights_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(19)
+    .input_channels(1031)
+    .output_channels(301)
+    .qmin(128)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_weights_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(19)
+    .input_channels(1031)
+    .output_channels(301)
+    .qmax(128)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_weights_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(19)
+    .input_channels(1031)
+    .output_channels(301)
+    .input_stride(1043)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_weights_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(19)
+    .input_channels(1031)
+    .output_channels(301)
+    .output_stride(317)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_weights_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(19)
+    .input_channels(1031)
+    .output_channels(301)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, large_weights_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(19)
+    .input_channels(1031)
+    .output_channels(301)
+    .iterations(1)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_split_k_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .qmin(128)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_split_k_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .qmax(128)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_split_k_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .output_stride(43)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_split_k_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_split_k_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_split_k) {
+  FullyConnectedOperatorTester()
+    .batch_size(4)
+    .input_channels(1031)
+    .output_channels(37)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_split_k_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(4)
+    .input_channels(1031)
+    .output_channels(37)
+    .input_stride(1043)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_split_k_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(4)
+    .input_channels(1031)
+    .output_channels(37)
+    .output_stride(43)
+    .num_threads(8)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_fp16_weights) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_fp16_weights_with_qmin) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_fp16_weights_with_qmax) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, unit_batch_fp16_weights_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_fp16_weights) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_fp16_weights_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(29)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_fp16_weights_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, small_batch_fp16_weights_without_bias) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP16)
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32, weights_cache_unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch_with_kernel_zero_point_0) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(0)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch_with_kernel_zero_point_15) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(15)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .input_stride(28)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_with_kernel_zero_point_0) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(0)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_with_kernel_zero_point_15) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .kernel_zero_point(15)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .has_bias(false)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_F32_QC4W, small_batch_multithreaded) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .num_threads(4)
+    .iterations(3)
+    .TestF32QC4W();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, unit_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_fp32_weights) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP32)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_with_qmin) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmin(128)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_with_qmax) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .qmax(128)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .input_stride(28)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .output_stride(29)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_transpose_fp32_weights) {
+  FullyConnectedOperatorTester()
+    .weights_type(FullyConnectedOperatorTester::WeightsType::FP32)
+    .transpose_weights(true)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, small_batch_without_bias) {
+  FullyConnectedOperatorTester()
+    .has_bias(false)
+    .batch_size(12)
+    .input_channels(23)
+    .output_channels(19)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, weights_cache_unit_batch) {
+  FullyConnectedOperatorTester()
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestBF16();
+}
+
+TEST(FULLY_CONNECTED_NC_BF16, weights_cache_unit_batch_transpose_weights) {
+  FullyConnectedOperatorTester()
+    .transpose_weights(true)
+    .batch_size(1)
+    .input_channels(23)
+    .output_channels(19)
+    .use_weights_cache(true)
+    .iterations(3)
+    .TestBF16();
+}
 TEST(FULLY_CONNECTED_NC_F16, unit_batch) {
   FullyConnectedOperatorTester()
     .batch_size(1)
@@ -23,12 +23,14 @@
 
 #include <xnnpack.h>
 #include <xnnpack/cache.h>
+#include <xnnpack/math.h>
 
 
 class FullyConnectedOperatorTester {
  public:
   enum class WeightsType {
     Default,
+    FP16,
     FP32,
   };
 
@@ -128,6 +130,15 @@ class FullyConnectedOperatorTester {
     return this->has_bias_;
   }
 
+  inline FullyConnectedOperatorTester& kernel_zero_point(uint8_t kernel_zero_point) {
+    this->kernel_zero_point_ = kernel_zero_point;
+    return *this;
+  }
+
+  inline uint8_t kernel_zero_point() const {
+    return this->kernel_zero_point_;
+  }
+
   inline FullyConnectedOperatorTester& weights_type(WeightsType weights_type) {
     this->weights_type_ = weights_type;
     return *this;
@@ -146,6 +157,16 @@ class FullyConnectedOperatorTester {
     return this->use_weights_cache_;
   }
 
+  inline FullyConnectedOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads != 0);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
   inline FullyConnectedOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -176,6 +197,12 @@ class FullyConnectedOperatorTester {
 
     const int8_t input_zero_point = 127;
 
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
+
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
       std::generate(kernel.begin(), kernel.end(), [&]() { return w8dist(rng); });
@@ -267,10 +294,10 @@ class FullyConnectedOperatorTester {
           fully_connected_op,
           batch_size(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          auto_threadpool.get()));
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
 
       // Verify results.
       VerifyQS8(output, output_ref, double(output_zero_point));
@@ -302,11 +329,11 @@ class FullyConnectedOperatorTester {
                       fully_connected_op2,
                       batch_size(),
                       input.data(), output2.data(),
-                      nullptr /* thread pool */));
+                      auto_threadpool.get()));
 
         ASSERT_EQ(
             xnn_status_success,
-            xnn_run_operator(fully_connected_op2, nullptr /* thread pool */));
+            xnn_run_operator(fully_connected_op2, auto_threadpool.get()));
 
         VerifyWeightsCache(weights_cache, old_weights_cache_size);
         xnn_release_weights_cache(&weights_cache);
@@ -333,6 +360,108 @@ class FullyConnectedOperatorTester {
     }
   }
 
+  void TestQC8() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i32dist(-10000, 10000);
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_int_distribution<int32_t> w8dist(
+      -std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max());
+    std::uniform_real_distribution<float> scale_dist(0.5f, 2.0f);
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<int8_t> kernel(output_channels() * input_channels());
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<int32_t> bias(output_channels());
+    std::vector<int8_t> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<double> accumulators(batch_size() * output_channels());
+    std::vector<double> output_ref(batch_size() * output_channels());
+
+    const int8_t input_zero_point = 127;
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return w8dist(rng); });
+      std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scale_dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return i32dist(rng); });
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results, scaled by per-channel kernel scales, but without renormalization.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          int32_t acc = has_bias() ? bias[oc] : 0;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            const int8_t k = transpose_weights() ?
+              kernel[ic * output_channels() + oc] : kernel[oc * input_channels() + ic];
+            acc += (int32_t(input[i * input_stride() + ic]) - int32_t(input_zero_point)) * int32_t(k);
+          }
+          accumulators[i * output_channels() + oc] = double(acc) * double(kernel_scale[oc]);
+        }
+      }
+
+      // Compute renormalization parameters.
+      const double accumulated_min = *std::min_element(accumulators.cbegin(), accumulators.cend());
+      const double accumulated_max = *std::max_element(accumulators.cbegin(), accumulators.cend());
+
+      const double output_scale = (accumulated_max - accumulated_min) / 255.0;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * (accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Renormalize reference results.
+      std::transform(accumulators.cbegin(), accumulators.cend(), output_ref.begin(),
+        [this, output_scale, output_zero_point](double x) -> double {
+          return std::max<double>(std::min<double>(x / output_scale, double(qmax() - 0x80) - output_zero_point), double(qmin() - 0x80) - output_zero_point);
+        });
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      const xnn_status status = xnn_create_fully_connected_nc_qc8(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          input_zero_point, 1.0f /* input scale */,
+          kernel_scale.data(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          nullptr /* caches */,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_qc8(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
+
+      // Verify results.
+      VerifyQS8(output, output_ref, double(output_zero_point));
+    }
+  }
+
   void TestQU8() const {
     ASSERT_EQ(weights_type(), WeightsType::Default);
 
@@ -507,53 +636,60 @@ class FullyConnectedOperatorTester {
     }
   }
 
-  void TestF32() const {
+  void TestQD8F32QC8W() const {
     ASSERT_EQ(weights_type(), WeightsType::Default);
 
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
-    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale_dist(0.5f / 127.0f, 2.0f / 127.0f);
+    std::uniform_int_distribution<int32_t> w8dist(
+      -std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max());
 
     std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
       (batch_size() - 1) * input_stride() + input_channels());
-    std::vector<float> kernel(output_channels() * input_channels());
+    std::vector<int8_t> kernel(output_channels() * input_channels());
+    std::vector<float> kernel_scale(output_channels());
     std::vector<float> bias(output_channels());
     std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
     std::vector<float> output_ref(batch_size() * output_channels());
+    std::vector<float> output_tolerance(batch_size() * output_channels());
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
 
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
       std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
-      std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return w8dist(rng); });
+      std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scale_dist(rng); });
       std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
       std::fill(output.begin(), output.end(), nanf(""));
 
-      // Compute reference results, without renormalization.
-      if (has_bias()) {
-        for (size_t i = 0; i < batch_size(); i++) {
-          for (size_t oc = 0; oc < output_channels(); oc++) {
-            output_ref[i * output_channels() + oc] = bias[oc];
-          }
-        }
-      } else {
-        std::fill(output_ref.begin(), output_ref.end(), 0.0f);
-      }
-      if (transpose_weights()) {
-        for (size_t i = 0; i < batch_size(); i++) {
-          for (size_t oc = 0; oc < output_channels(); oc++) {
-            for (size_t ic = 0; ic < input_channels(); ic++) {
-              output_ref[i * output_channels() + oc] +=
-                input[i * input_stride() + ic] * kernel[ic * output_channels() + oc];
-            }
-          }
+      // Compute reference results with unquantized input. Tolerance accounts for rounding of the input to the grid of
+      // the dynamic quantization: up to a half of the quantization step of the row per element.
+      for (size_t i = 0; i < batch_size(); i++) {
+        float input_min = 0.0f;
+        float input_max = 0.0f;
+        for (size_t ic = 0; ic < input_channels(); ic++) {
+          input_min = std::min(input_min, input[i * input_stride() + ic]);
+          input_max = std::max(input_max, input[i * input_stride() + ic]);
         }
-      } else {
-        for (size_t i = 0; i < batch_size(); i++) {
-          for (size_t oc = 0; oc < output_channels(); oc++) {
-            for (size_t ic = 0; ic < input_channels(); ic++) {
-              output_ref[i * output_channels() + oc] +=
-                input[i * input_stride() + ic] * kernel[oc * input_channels() + ic];
-            }
+        const double input_step = double(input_max - input_min) / 255.0;
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          double acc = has_bias() ? double(bias[oc]) : 0.0;
+          double abs_kernel_sum = 0.0;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            const int8_t k = transpose_weights() ?
+              kernel[ic * output_channels() + oc] : kernel[oc * input_channels() + ic];
+            const double w = double(k) * double(kernel_scale[oc]);
+            acc += double(input[i * input_stride() + ic]) * w;
+            abs_kernel_sum += std::abs(w);
           }
+          output_ref[i * output_channels() + oc] = float(acc);
+          output_tolerance[i * output_channels() + oc] = float(0.6 * input_step * abs_kernel_sum + 1.0e-5 * std::abs(acc));
         }
       }
 
@@ -575,23 +711,13 @@ class FullyConnectedOperatorTester {
       ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
       xnn_operator_t fully_connected_op = nullptr;
 
-      xnn_caches caches = {
-        .code_cache = NULL,
-        .weights_cache = NULL,
-      };
-      xnn_weights_cache weights_cache;
-      if (use_weights_cache()) {
-        xnn_init_weights_cache(&weights_cache);
-        caches.weights_cache = &weights_cache;
-      }
-
-      const xnn_status status = xnn_create_fully_connected_nc_f32(
+      const xnn_status status = xnn_create_fully_connected_nc_qd8_f32_qc8w(
           input_channels(), output_channels(),
           input_stride(), output_stride(),
-          kernel.data(), has_bias() ? bias.data() : nullptr,
+          kernel_scale.data(), kernel.data(), has_bias() ? bias.data() : nullptr,
           output_min, output_max,
           transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
-          &caches,
+          nullptr /* caches */,
           &fully_connected_op);
       if (status == xnn_status_unsupported_hardware) {
         GTEST_SKIP();
@@ -603,127 +729,622 @@ class FullyConnectedOperatorTester {
       std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
 
       ASSERT_EQ(xnn_status_success,
-        xnn_setup_fully_connected_nc_f32(
+        xnn_setup_fully_connected_nc_qd8_f32_qc8w(
           fully_connected_op,
           batch_size(),
           input.data(), output.data(),
-          nullptr /* thread pool */));
+          auto_threadpool.get()));
 
       ASSERT_EQ(xnn_status_success,
-        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
-
-      VerifyF32(output, output_ref, output_max, output_min);
-
-      if (use_weights_cache()) {
-        // Create another operator with the same weights cache.
-        xnn_operator_t fully_connected_op2 = nullptr;
-        size_t old_weights_cache_size = weights_cache.cache.weights.size;
-        ASSERT_EQ(xnn_status_success,
-                  xnn_create_fully_connected_nc_f32(
-                      input_channels(), output_channels(), input_stride(),
-                      output_stride(), kernel.data(),
-                      has_bias() ? bias.data() : nullptr, output_min,
-                      output_max,
-                      transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
-                      &caches, &fully_connected_op2));
-        ASSERT_NE(nullptr, fully_connected_op2);
-
-        std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op2, xnn_delete_operator);
-
-        std::vector<float> output2(output.size(), nanf(""));
-        ASSERT_EQ(xnn_status_success,
-                  xnn_setup_fully_connected_nc_f32(
-                      fully_connected_op2,
-                      batch_size(),
-                      input.data(), output2.data(),
-                      nullptr /* thread pool */));
-
-        ASSERT_EQ(xnn_status_success,
-                  xnn_run_operator(fully_connected_op2, nullptr /* thread pool */));
-        VerifyWeightsCache(weights_cache, old_weights_cache_size);
-        xnn_release_weights_cache(&weights_cache);
-
-        VerifyF32(output, output_ref, output_max, output_min);
-      }
-    }
-  }
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
 
-  void VerifyF32(const std::vector<float>& output,
-                 const std::vector<float>& output_ref,
-                 float output_max,
-                 float output_min) const {
-    // Verify results.
-    for (size_t i = 0; i < batch_size(); i++) {
-      for (size_t c = 0; c < output_channels(); c++) {
-        ASSERT_LE(output[i * output_stride() + c], output_max)
-            << "batch index = " << i << ", channel = " << c;
-        ASSERT_GE(output[i * output_stride() + c], output_min)
-            << "batch index = " << i << ", channel = " << c;
-        ASSERT_NEAR(output_ref[i * output_channels() + c],
-                    output[i * output_stride() + c],
-                    1.0e-4 * std::abs(output_ref[i * output_channels() + c]))
-            << "batch index = " << i << ", channel = " << c;
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(output_ref[i * output_channels() + c],
+                      output[i * output_stride() + c],
+                      output_tolerance[i * output_channels() + c])
+              << "batch index = " << i << ", channel = " << c;
+        }
       }
     }
   }
 
-  void TestF16() const {
-    switch (weights_type()) {
-      case WeightsType::Default:
-        break;
-      case WeightsType::FP32:
-        break;
-      default:
-        GTEST_FAIL() << "unexpected weights type";
-    }
+  void TestQS8F32QC8W() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
 
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
-    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale_dist(0.5f / 127.0f, 2.0f / 127.0f);
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_int_distribution<int32_t> w8dist(
+      -std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max());
 
-    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
       (batch_size() - 1) * input_stride() + input_channels());
-    std::vector<uint16_t> kernel(output_channels() * input_channels());
-    std::vector<float> kernel_as_float(kernel.size());
-    std::vector<uint16_t> bias(output_channels());
-    std::vector<float> bias_as_float(bias.size());
-    std::vector<uint16_t> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<int8_t> kernel(output_channels() * input_channels());
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
     std::vector<float> output_ref(batch_size() * output_channels());
 
-    for (size_t iteration = 0; iteration < iterations(); iteration++) {
-      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
-      std::generate(kernel.begin(), kernel.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
-      std::transform(kernel.cbegin(), kernel.cend(), kernel_as_float.begin(), fp16_ieee_to_fp32_value);
-      std::generate(bias.begin(), bias.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
-      std::transform(bias.cbegin(), bias.cend(), bias_as_float.begin(), fp16_ieee_to_fp32_value);
-      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
 
-      // Compute reference results, without renormalization.
-      if (has_bias()) {
-        for (size_t i = 0; i < batch_size(); i++) {
-          for (size_t oc = 0; oc < output_channels(); oc++) {
-            output_ref[i * output_channels() + oc] = fp16_ieee_to_fp32_value(bias[oc]);
-          }
-        }
-      } else {
-        std::fill(output_ref.begin(), output_ref.end(), 0.0f);
-      }
-      if (transpose_weights()) {
-        for (size_t i = 0; i < batch_size(); i++) {
-          for (size_t oc = 0; oc < output_channels(); oc++) {
-            for (size_t ic = 0; ic < input_channels(); ic++) {
-              output_ref[i * output_channels() + oc] +=
-                fp16_ieee_to_fp32_value(input[i * input_stride() + ic]) * fp16_ieee_to_fp32_value(kernel[ic * output_channels() + oc]);
-            }
-          }
-        }
-      } else {
-        for (size_t i = 0; i < batch_size(); i++) {
-          for (size_t oc = 0; oc < output_channels(); oc++) {
-            for (size_t ic = 0; ic < input_channels(); ic++) {
-              output_ref[i * output_channels() + oc] +=
-                fp16_ieee_to_fp32_value(input[i * input_stride() + ic]) * fp16_ieee_to_fp32_value(kernel[oc * input_channels() + ic]);
-            }
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return w8dist(rng); });
+      std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scale_dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+      const int8_t input_zero_point = int8_t(i8dist(rng));
+      const float input_scale = scale_dist(rng);
+
+      // Compute reference results. Products of quantized input and weights are exact, only the conversion of the
+      // accumulators to FP32 rounds.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          int32_t acc = 0;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            const int8_t k = transpose_weights() ?
+              kernel[ic * output_channels() + oc] : kernel[oc * input_channels() + ic];
+            acc += (int32_t(input[i * input_stride() + ic]) - int32_t(input_zero_point)) * int32_t(k);
+          }
+          output_ref[i * output_channels() + oc] = float(double(acc) * double(input_scale) * double(kernel_scale[oc]) +
+            (has_bias() ? double(bias[oc]) : 0.0));
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      const xnn_status status = xnn_create_fully_connected_nc_qs8_f32_qc8w(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          input_zero_point, input_scale,
+          kernel_scale.data(), kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          transpose_weights() ? XNN_FLAG_TRANSPOSE_WEIGHTS : 0,
+          nullptr /* caches */,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_qs8_f32_qc8w(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(output_ref[i * output_channels() + c],
+                      output[i * output_stride() + c],
+                      1.0e-5f * std::max(1.0f, std::abs(output_ref[i * output_channels() + c])))
+              << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void TestQD8F32QC4W() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
+    ASSERT_FALSE(transpose_weights());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale_dist(0.5f / 8.0f, 2.0f / 8.0f);
+    std::uniform_int_distribution<int32_t> u8dist(0, std::numeric_limits<uint8_t>::max());
+
+    // 4-bit weights are packed two per byte, with every row of the kernel starting at a byte boundary.
+    const size_t kernel_row_bytes = (input_channels() + 1) / 2;
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<uint8_t> kernel(output_channels() * kernel_row_bytes);
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+    std::vector<float> output_tolerance(batch_size() * output_channels());
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return uint8_t(u8dist(rng)); });
+      std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scale_dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results with unquantized input. Tolerance accounts for rounding of the input to the grid of
+      // the dynamic quantization: up to a half of the quantization step of the row per element.
+      for (size_t i = 0; i < batch_size(); i++) {
+        float input_min = 0.0f;
+        float input_max = 0.0f;
+        for (size_t ic = 0; ic < input_channels(); ic++) {
+          input_min = std::min(input_min, input[i * input_stride() + ic]);
+          input_max = std::max(input_max, input[i * input_stride() + ic]);
+        }
+        const double input_step = double(input_max - input_min) / 255.0;
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          double acc = has_bias() ? double(bias[oc]) : 0.0;
+          double abs_kernel_sum = 0.0;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            const uint8_t kbyte = kernel[oc * kernel_row_bytes + ic / 2];
+            const int32_t k = int32_t(ic % 2 == 0 ? kbyte & 0xF : kbyte >> 4) - int32_t(kernel_zero_point());
+            const double w = double(k) * double(kernel_scale[oc]);
+            acc += double(input[i * input_stride() + ic]) * w;
+            abs_kernel_sum += std::abs(w);
+          }
+          output_ref[i * output_channels() + oc] = float(acc);
+          output_tolerance[i * output_channels() + oc] = float(0.6 * input_step * abs_kernel_sum + 1.0e-5 * std::abs(acc));
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      const xnn_status status = xnn_create_fully_connected_nc_qd8_f32_qc4w(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel_zero_point(), kernel_scale.data(), kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          0 /* flags */,
+          nullptr /* caches */,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_qd8_f32_qc4w(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(output_ref[i * output_channels() + c],
+                      output[i * output_stride() + c],
+                      output_tolerance[i * output_channels() + c])
+              << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void TestF32QC4W() const {
+    ASSERT_EQ(weights_type(), WeightsType::Default);
+    ASSERT_FALSE(transpose_weights());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> scale_dist(0.5f / 8.0f, 2.0f / 8.0f);
+    std::uniform_int_distribution<int32_t> u8dist(0, std::numeric_limits<uint8_t>::max());
+
+    // 4-bit weights are packed two per byte, with every row of the kernel starting at a byte boundary.
+    const size_t kernel_row_bytes = (input_channels() + 1) / 2;
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<uint8_t> kernel(output_channels() * kernel_row_bytes);
+    std::vector<float> kernel_scale(output_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+    std::vector<float> output_tolerance(batch_size() * output_channels());
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return uint8_t(u8dist(rng)); });
+      std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scale_dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t oc = 0; oc < output_channels(); oc++) {
+          double acc = has_bias() ? double(bias[oc]) : 0.0;
+          double abs_kernel_sum = 0.0;
+          for (size_t ic = 0; ic < input_channels(); ic++) {
+            const uint8_t kbyte = kernel[oc * kernel_row_bytes + ic / 2];
+            const int32_t k = int32_t(ic % 2 == 0 ? kbyte & 0xF : kbyte >> 4) - int32_t(kernel_zero_point());
+            const double w = double(k) * double(kernel_scale[oc]);
+            acc += double(input[i * input_stride() + ic]) * w;
+            abs_kernel_sum += std::abs(w);
+          }
+          output_ref[i * output_channels() + oc] = float(acc);
+          output_tolerance[i * output_channels() + oc] = float(1.0e-5 * abs_kernel_sum + 1.0e-5 * std::abs(acc));
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      const xnn_status status = xnn_create_fully_connected_nc_f32_qc4w(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel_zero_point(), kernel_scale.data(), kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          0 /* flags */,
+          nullptr /* caches */,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_f32_qc4w(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < output_channels(); c++) {
+          ASSERT_LE(output[i * output_stride() + c], output_max)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_GE(output[i * output_stride() + c], output_min)
+              << "batch index = " << i << ", channel = " << c;
+          ASSERT_NEAR(output_ref[i * output_channels() + c],
+                      output[i * output_stride() + c],
+                      output_tolerance[i * output_channels() + c])
+              << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void TestF32() const {
+    switch (weights_type()) {
+      case WeightsType::Default:
+        break;
+      case WeightsType::FP16:
+        break;
+      default:
+        GTEST_FAIL() << "unexpected weights type";
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<float> kernel(output_channels() * input_channels());
+    std::vector<float> bias(output_channels());
+    std::vector<float> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+
+    std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+    if (num_threads() > 1) {
+      auto_threadpool.reset(pthreadpool_create(num_threads()));
+      ASSERT_NE(nullptr, auto_threadpool.get());
+    }
+
+    uint32_t flags = 0;
+    if (transpose_weights()) {
+      flags |= XNN_FLAG_TRANSPOSE_WEIGHTS;
+    }
+    if (weights_type() == WeightsType::FP16) {
+      flags |= XNN_FLAG_FP16_STATIC_WEIGHTS;
+    }
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+      if (weights_type() == WeightsType::FP16) {
+        // Weights are stored in FP16 format: round them in the reference too.
+        for (float& value : kernel) {
+          value = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(value));
+        }
+        for (float& value : bias) {
+          value = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(value));
+        }
+      }
+
+      // Compute reference results, without renormalization.
+      if (has_bias()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            output_ref[i * output_channels() + oc] = bias[oc];
+          }
+        }
+      } else {
+        std::fill(output_ref.begin(), output_ref.end(), 0.0f);
+      }
+      if (transpose_weights()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              output_ref[i * output_channels() + oc] +=
+                input[i * input_stride() + ic] * kernel[ic * output_channels() + oc];
+            }
+          }
+        }
+      } else {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              output_ref[i * output_channels() + oc] +=
+                input[i * input_stride() + ic] * kernel[oc * input_channels() + ic];
+            }
+          }
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      xnn_caches caches = {
+        .code_cache = NULL,
+        .weights_cache = NULL,
+      };
+      xnn_weights_cache weights_cache;
+      if (use_weights_cache()) {
+        xnn_init_weights_cache(&weights_cache);
+        caches.weights_cache = &weights_cache;
+      }
+
+      const xnn_status status = xnn_create_fully_connected_nc_f32(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          flags,
+          &caches,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_f32(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, auto_threadpool.get()));
+
+      VerifyF32(output, output_ref, output_max, output_min);
+
+      if (use_weights_cache()) {
+        // Create another operator with the same weights cache.
+        xnn_operator_t fully_connected_op2 = nullptr;
+        size_t old_weights_cache_size = weights_cache.cache.weights.size;
+        ASSERT_EQ(xnn_status_success,
+                  xnn_create_fully_connected_nc_f32(
+                      input_channels(), output_channels(), input_stride(),
+                      output_stride(), kernel.data(),
+                      has_bias() ? bias.data() : nullptr, output_min,
+                      output_max,
+                      flags,
+                      &caches, &fully_connected_op2));
+        ASSERT_NE(nullptr, fully_connected_op2);
+
+        std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op2, xnn_delete_operator);
+
+        std::vector<float> output2(output.size(), nanf(""));
+        ASSERT_EQ(xnn_status_success,
+                  xnn_setup_fully_connected_nc_f32(
+                      fully_connected_op2,
+                      batch_size(),
+                      input.data(), output2.data(),
+                      auto_threadpool.get()));
+
+        ASSERT_EQ(xnn_status_success,
+                  xnn_run_operator(fully_connected_op2, auto_threadpool.get()));
+        VerifyWeightsCache(weights_cache, old_weights_cache_size);
+        xnn_release_weights_cache(&weights_cache);
+
+        VerifyF32(output, output_ref, output_max, output_min);
+      }
+    }
+  }
+
+  void VerifyF32(const std::vector<float>& output,
+                 const std::vector<float>& output_ref,
+                 float output_max,
+                 float output_min) const {
+    // Verify results.
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t c = 0; c < output_channels(); c++) {
+        ASSERT_LE(output[i * output_stride() + c], output_max)
+            << "batch index = " << i << ", channel = " << c;
+        ASSERT_GE(output[i * output_stride() + c], output_min)
+            << "batch index = " << i << ", channel = " << c;
+        ASSERT_NEAR(output_ref[i * output_channels() + c],
+                    output[i * output_stride() + c],
+                    1.0e-4 * std::abs(output_ref[i * output_channels() + c]))
+            << "batch index = " << i << ", channel = " << c;
+      }
+    }
+  }
+
+  void TestF16() const {
+    switch (weights_type()) {
+      case WeightsType::Default:
+        break;
+      case WeightsType::FP32:
+        break;
+      default:
+        GTEST_FAIL() << "unexpected weights type";
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<uint16_t> kernel(output_channels() * input_channels());
+    std::vector<float> kernel_as_float(kernel.size());
+    std::vector<uint16_t> bias(output_channels());
+    std::vector<float> bias_as_float(bias.size());
+    std::vector<uint16_t> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::transform(kernel.cbegin(), kernel.cend(), kernel_as_float.begin(), fp16_ieee_to_fp32_value);
+      std::generate(bias.begin(), bias.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::transform(bias.cbegin(), bias.cend(), bias_as_float.begin(), fp16_ieee_to_fp32_value);
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results, without renormalization.
+      if (has_bias()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            output_ref[i * output_channels() + oc] = fp16_ieee_to_fp32_value(bias[oc]);
+          }
+        }
+      } else {
+        std::fill(output_ref.begin(), output_ref.end(), 0.0f);
+      }
+      if (transpose_weights()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              output_ref[i * output_channels() + oc] +=
+                fp16_ieee_to_fp32_value(input[i * input_stride() + ic]) * fp16_ieee_to_fp32_value(kernel[ic * output_channels() + oc]);
+            }
+          }
+        }
+      } else {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              output_ref[i * output_channels() + oc] +=
+                fp16_ieee_to_fp32_value(input[i * input_stride() + ic]) * fp16_ieee_to_fp32_value(kernel[oc * input_channels() + ic]);
+            }
           }
         }
       }
@@ -836,6 +1457,184 @@ class FullyConnectedOperatorTester {
     }
   }
 
+  void TestBF16() const {
+    switch (weights_type()) {
+      case WeightsType::Default:
+        break;
+      case WeightsType::FP32:
+        break;
+      default:
+        GTEST_FAIL() << "unexpected weights type";
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) +
+      (batch_size() - 1) * input_stride() + input_channels());
+    std::vector<uint16_t> kernel(output_channels() * input_channels());
+    std::vector<float> kernel_as_float(kernel.size());
+    std::vector<float> bias(output_channels());
+    std::vector<uint16_t> output((batch_size() - 1) * output_stride() + output_channels());
+    std::vector<float> output_ref(batch_size() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return math_cvt_bf16_fp32(f32dist(rng)); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return math_cvt_bf16_fp32(f32dist(rng)); });
+      std::transform(kernel.cbegin(), kernel.cend(), kernel_as_float.begin(), math_cvt_fp32_bf16);
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), UINT16_C(0x7FC0) /* NaN */);
+
+      // Compute reference results, without renormalization.
+      if (has_bias()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            output_ref[i * output_channels() + oc] = bias[oc];
+          }
+        }
+      } else {
+        std::fill(output_ref.begin(), output_ref.end(), 0.0f);
+      }
+      if (transpose_weights()) {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              output_ref[i * output_channels() + oc] +=
+                math_cvt_fp32_bf16(input[i * input_stride() + ic]) * kernel_as_float[ic * output_channels() + oc];
+            }
+          }
+        }
+      } else {
+        for (size_t i = 0; i < batch_size(); i++) {
+          for (size_t oc = 0; oc < output_channels(); oc++) {
+            for (size_t ic = 0; ic < input_channels(); ic++) {
+              output_ref[i * output_channels() + oc] +=
+                math_cvt_fp32_bf16(input[i * input_stride() + ic]) * kernel_as_float[oc * input_channels() + ic];
+            }
+          }
+        }
+      }
+
+      // Compute clamping parameters.
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float scaled_min = math_cvt_fp32_bf16(math_cvt_bf16_fp32(accumulated_min + accumulated_range / 255.0f * float(qmin())));
+      const float scaled_max = math_cvt_fp32_bf16(math_cvt_bf16_fp32(accumulated_max - accumulated_range / 255.0f * float(255 - qmax())));
+      const float output_min = scaled_min == scaled_max ? -std::numeric_limits<float>::infinity() : scaled_min;
+      const float output_max = scaled_min == scaled_max ? +std::numeric_limits<float>::infinity() : scaled_max;
+
+      // Clamp reference results.
+      for (float& value : output_ref) {
+        value = std::max(std::min(value, output_max), output_min);
+      }
+
+      // Create, setup, run, and destroy Fully Connected operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t fully_connected_op = nullptr;
+
+      xnn_caches caches = {
+        .code_cache = NULL,
+        .weights_cache = NULL,
+      };
+      xnn_weights_cache weights_cache;
+      if (use_weights_cache()) {
+        xnn_init_weights_cache(&weights_cache);
+        caches.weights_cache = &weights_cache;
+      }
+
+      const void* kernel_data = kernel.data();
+      uint32_t flags = 0;
+      if (transpose_weights()) {
+        flags |= XNN_FLAG_TRANSPOSE_WEIGHTS;
+      }
+      if (weights_type() == WeightsType::FP32) {
+        kernel_data = kernel_as_float.data();
+        flags |= XNN_FLAG_FP32_STATIC_WEIGHTS;
+      }
+      const xnn_status status = xnn_create_fully_connected_nc_bf16(
+          input_channels(), output_channels(),
+          input_stride(), output_stride(),
+          kernel_data, has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          flags,
+          &caches,
+          &fully_connected_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, fully_connected_op);
+
+      // Smart pointer to automatically delete fully_connected_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_fully_connected_nc_bf16(
+          fully_connected_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(fully_connected_op, nullptr /* thread pool */));
+
+      // Verify results.
+      VerifyBF16(output, output_ref, output_max, output_min);
+
+      if (use_weights_cache()) {
+        xnn_operator_t fully_connected_op2 = nullptr;
+        size_t old_weights_cache_size = weights_cache.cache.weights.size;
+        ASSERT_EQ(xnn_status_success,
+                  xnn_create_fully_connected_nc_bf16(
+                      input_channels(), output_channels(), input_stride(),
+                      output_stride(), kernel_data,
+                      has_bias() ? bias.data() : nullptr, output_min, output_max,
+                      flags, &caches, &fully_connected_op2));
+        ASSERT_NE(nullptr, fully_connected_op2);
+
+        // Smart pointer to automatically delete fully_connected_op2.
+        std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_fully_connected_op(fully_connected_op2, xnn_delete_operator);
+        std::vector<uint16_t> output2(output.size(), UINT16_C(0x7FC0) /* NaN */);
+
+        ASSERT_EQ(xnn_status_success,
+                  xnn_setup_fully_connected_nc_bf16(
+                      fully_connected_op2,
+                      batch_size(),
+                      input.data(), output2.data(),
+                      nullptr /* thread pool */));
+
+        ASSERT_EQ(xnn_status_success,
+                  xnn_run_operator(fully_connected_op2, nullptr /* thread pool */));
+
+        // Verify results.
+        VerifyBF16(output2, output_ref, output_max, output_min);
+        VerifyWeightsCache(weights_cache, old_weights_cache_size);
+        xnn_release_weights_cache(&weights_cache);
+      }
+    }
+  }
+
+  void VerifyBF16(const std::vector<uint16_t>& output,
+                  const std::vector<float>& output_ref,
+                  const float output_max,
+                  const float output_min) const {
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t c = 0; c < output_channels(); c++) {
+        ASSERT_LE(math_cvt_fp32_bf16(output[i * output_stride() + c]), output_max)
+          << "batch index = " << i << ", channel = " << c;
+        ASSERT_GE(math_cvt_fp32_bf16(output[i * output_stride() + c]), output_min)
+          << "batch index = " << i << ", channel = " << c;
+        ASSERT_NEAR(
+            output_ref[i * output_channels() + c],
+            math_cvt_fp32_bf16(output[i * output_stride() + c]),
+            1.0e-2f * std::abs(output_ref[i * output_channels() + c]))
+          << "batch index = " << i << ", channel = " << c;
+      }
+    }
+  }
+
   void VerifyF16(const std::vector<uint16_t>& output,
                  const std::vector<float>& output_ref,
                  const float output_max,
@@ -871,7 +1670,9 @@ class FullyConnectedOperatorTester {
   uint8_t qmax_{255};
   bool transpose_weights_{false};
   bool has_bias_{true};
+  uint8_t kernel_zero_point_{8};
   WeightsType weights_type_{WeightsType::Default};
   bool use_weights_cache_{false};
+  size_t num_threads_{1};
   size_t iterations_{1};
 };
@@ -234,6 +234,234 @@ void GemmMicrokernelTester::Test(
   }
 }
 
+void GemmMicrokernelTester::Test(
+  xnn_qd8_f32_qc8w_gemm_minmax_ukernel_function gemm,
+  xnn_init_f32_minmax_params_fn init_params) const
+{
+  ASSERT_LE(m(), mr());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+  auto w8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(-std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+  auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), std::ref(rng));
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+  std::vector<int8_t> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(int8_t));
+  std::vector<int8_t> b(n() * k());
+  std::vector<float> bias(n());
+  std::vector<float> kernel_scale(n());
+  std::vector<xnn_qd8_quantization_params> quantization_params(mr());
+  std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_w(
+    packed_n() * packed_k() + packed_n() * (sizeof(int32_t) + 2 * sizeof(float)) / sizeof(int8_t));
+  std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+  std::vector<float> c_ref(m() * n());
+  std::vector<float> c_tolerance(m() * n());
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    std::generate(a.begin(), a.end(), std::ref(i8rng));
+    std::generate(b.begin(), b.end(), std::ref(w8rng));
+    std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+    std::generate(kernel_scale.begin(), kernel_scale.end(), std::ref(scalerng));
+    for (xnn_qd8_quantization_params& row_params : quantization_params) {
+      row_params.zero_point = i8rng();
+      row_params.scale = scalerng() * 1.0e-3f;
+    }
+    std::fill(c.begin(), c.end(), nanf(""));
+
+    // Pack with a unit input zero point: the packed bias is the negated sum of the weights in every output channel.
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    const xnn_qs8_packing_params packing_params = { 1 };
+    xnn_pack_qs8_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
+      b.data(), nullptr, packed_w.data(), nr() * 2 * sizeof(float), &packing_params);
+    const size_t packed_w_stride = nr() * (packed_k() * sizeof(int8_t) + sizeof(int32_t) + 2 * sizeof(float));
+    xnn_init_qc8_scale_fp32_params(
+      n(), nr(), packed_w_stride, kernel_scale.data(),
+      (void*) ((uintptr_t) packed_w.data() + nr() * (packed_k() * sizeof(int8_t) + sizeof(int32_t))));
+    xnn_init_qc8_scale_fp32_params(
+      n(), nr(), packed_w_stride, bias.data(),
+      (void*) ((uintptr_t) packed_w.data() + nr() * (packed_k() * sizeof(int8_t) + sizeof(int32_t) + sizeof(float))));
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        int32_t acc = 0;
+        for (size_t k_index = 0; k_index < k(); k_index++) {
+          acc += (int32_t(a[m_index * a_stride() + k_index]) - quantization_params[m_index].zero_point) *
+            int32_t(b[n_index * k() + k_index]);
+        }
+        const double product =
+          double(acc) * double(quantization_params[m_index].scale) * double(kernel_scale[n_index]);
+        c_ref[m_index * n() + n_index] = float(product + double(bias[n_index]));
+        c_tolerance[m_index * n() + n_index] = 1.0e-5f * float(std::abs(product) + std::abs(double(bias[n_index])));
+      }
+    }
+
+    const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+    const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+    const float c_min =
+        qmin() == std::numeric_limits<uint8_t>::min() ? -std::numeric_limits<float>::infinity()
+                    : accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+    const float c_max =
+        qmax() == std::numeric_limits<uint8_t>::max() ? +std::numeric_limits<float>::infinity()
+                      : accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+    xnn_f32_minmax_params params;
+    init_params(&params, c_min, c_max);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        c_ref[m_index * n() + n_index] = std::max(std::min(c_ref[m_index * n() + n_index], c_max), c_min);
+      }
+    }
+
+    gemm(
+      m(), n(), k(),
+      a.data(), a_stride() * sizeof(int8_t),
+      packed_w.data(),
+      c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+      &params, quantization_params.data());
+
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        ASSERT_LE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_max)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_GE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_min)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_NEAR(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_ref[i * n() + j], c_tolerance[i * n() + j])
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+            << ", input zero point = " << quantization_params[i].zero_point;
+      }
+    }
+  }
+}
+
+void GemmMicrokernelTester::Test(
+  xnn_qd8_f32_qc4w_gemm_minmax_ukernel_function gemm,
+  xnn_init_f32_qc4w_minmax_params_fn init_params) const
+{
+  ASSERT_LE(m(), mr());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+  auto u8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(0, std::numeric_limits<uint8_t>::max()), std::ref(rng));
+  auto w4rng = std::bind(std::uniform_int_distribution<int32_t>(0, 15), std::ref(rng));
+  auto scalerng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), std::ref(rng));
+  auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), std::ref(rng));
+
+  // Weights hold two 4-bit elements per byte, and every row of weights is padded to a whole number of bytes.
+  const size_t k_stride = (k() + 1) / 2;
+  const size_t packed_k_bytes = round_up_po2(packed_k(), 2) / 2;
+  std::vector<int8_t> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(int8_t));
+  std::vector<uint8_t> b(n() * k_stride);
+  std::vector<float> bias(n());
+  std::vector<float> kernel_scale(n());
+  std::vector<xnn_qd8_quantization_params> quantization_params(mr());
+  std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> packed_w(
+    packed_n() * packed_k_bytes + packed_n() * (sizeof(int32_t) + 2 * sizeof(float)));
+  std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+  std::vector<float> c_ref(m() * n());
+  std::vector<float> c_tolerance(m() * n());
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    const uint8_t kernel_zero_point = uint8_t(w4rng());
+    std::generate(a.begin(), a.end(), std::ref(i8rng));
+    std::generate(b.begin(), b.end(), std::ref(u8rng));
+    std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+    std::generate(kernel_scale.begin(), kernel_scale.end(), std::ref(scalerng));
+    for (xnn_qd8_quantization_params& row_params : quantization_params) {
+      row_params.zero_point = i8rng();
+      row_params.scale = scalerng() * 1.0e-3f;
+    }
+    std::fill(c.begin(), c.end(), nanf(""));
+
+    // Pack with a unit input zero point: the packed bias is the negated sum of the weights in every output channel.
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    const xnn_qs8_qc4w_packing_params packing_params = { 1, kernel_zero_point };
+    xnn_pack_qs8_qc4w_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
+      b.data(), nullptr, packed_w.data(), nr() * 2 * sizeof(float), &packing_params);
+    const size_t packed_w_stride = nr() * (packed_k_bytes + sizeof(int32_t) + 2 * sizeof(float));
+    xnn_init_qc8_scale_fp32_params(
+      n(), nr(), packed_w_stride, kernel_scale.data(),
+      (void*) ((uintptr_t) packed_w.data() + nr() * (packed_k_bytes + sizeof(int32_t))));
+    xnn_init_qc8_scale_fp32_params(
+      n(), nr(), packed_w_stride, bias.data(),
+      (void*) ((uintptr_t) packed_w.data() + nr() * (packed_k_bytes + sizeof(int32_t) + sizeof(float))));
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        int32_t acc = 0;
+        for (size_t k_index = 0; k_index < k(); k_index++) {
+          const uint8_t b_byte = b[n_index * k_stride + k_index / 2];
+          const int32_t b_value = int32_t((k_index % 2 == 0 ? b_byte : b_byte >> 4) & 0xF) - int32_t(kernel_zero_point);
+          acc += (int32_t(a[m_index * a_stride() + k_index]) - quantization_params[m_index].zero_point) * b_value;
+        }
+        const double product =
+          double(acc) * double(quantization_params[m_index].scale) * double(kernel_scale[n_index]);
+        c_ref[m_index * n() + n_index] = float(product + double(bias[n_index]));
+        c_tolerance[m_index * n() + n_index] = 1.0e-5f * float(std::abs(product) + std::abs(double(bias[n_index])));
+      }
+    }
+
+    const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+    const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+    const float c_min =
+        qmin() == std::numeric_limits<uint8_t>::min() ? -std::numeric_limits<float>::infinity()
+                    : accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+    const float c_max =
+        qmax() == std::numeric_limits<uint8_t>::max() ? +std::numeric_limits<float>::infinity()
+                      : accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+    xnn_f32_qc4w_minmax_params params;
+    init_params(&params, c_min, c_max, kernel_zero_point);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        c_ref[m_index * n() + n_index] = std::max(std::min(c_ref[m_index * n() + n_index], c_max), c_min);
+      }
+    }
+
+    gemm(
+      m(), n(), k(),
+      a.data(), a_stride() * sizeof(int8_t),
+      packed_w.data(),
+      c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+      &params, quantization_params.data());
+
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        ASSERT_LE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_max)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_GE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_min)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_NEAR(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_ref[i * n() + j], c_tolerance[i * n() + j])
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+            << ", input zero point = " << quantization_params[i].zero_point
+            << ", kernel zero point = " << int32_t(kernel_zero_point);
+      }
+    }
+  }
+}
+
 void GemmMicrokernelTester::Test(
   xnn_qc8_gemm_minmax_ukernel_function gemm,
   xnn_init_qs8_minmax_params_fn init_params,
@@ -489,6 +717,62 @@ void GemmMicrokernelTester::Test(
   }
 }
 
+void GemmMicrokernelTester::Test(xnn_qs8_gemm_acc32_ukernel_function gemm_acc32) const {
+  ASSERT_LE(m(), mr());
+  ASSERT_LE(n(), nr());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  auto i8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+  auto w8rng = std::bind(
+    std::uniform_int_distribution<int32_t>(-std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max()),
+    std::ref(rng));
+
+  std::vector<int8_t> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(int8_t));
+  std::vector<int8_t> b(n() * k());
+  std::vector<int8_t, AlignedAllocator<int8_t, 64>> packed_w(packed_n() * packed_k() + packed_n() * sizeof(int32_t) / sizeof(int8_t));
+  std::vector<int32_t> c((mr() - 1) * cm_stride() + n());
+  std::vector<int32_t> c_ref(m() * n());
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    std::generate(a.begin(), a.end(), std::ref(i8rng));
+    std::generate(b.begin(), b.end(), std::ref(w8rng));
+    std::fill(c.begin(), c.end(), INT32_C(0x7FA5A5A5));
+
+    // Weights are packed the same way as for QS8 GEMM micro-kernels, and the micro-kernel reads them past the bias.
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    const xnn_qs8_packing_params packing_params = { 0 };
+    xnn_pack_qs8_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
+      b.data(), nullptr, packed_w.data(), 0, &packing_params);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        int32_t acc = 0;
+        for (size_t k_index = 0; k_index < k(); k_index++) {
+          acc += int32_t(a[m_index * a_stride() + k_index]) * int32_t(b[n_index * k() + k_index]);
+        }
+        c_ref[m_index * n() + n_index] = acc;
+      }
+    }
+
+    gemm_acc32(
+      m(), n(), k(),
+      a.data(), a_stride() * sizeof(int8_t),
+      packed_w.data() + nr() * sizeof(int32_t),
+      c.data(), cm_stride() * sizeof(int32_t));
+
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        ASSERT_EQ(c[i * cm_stride() + j], c_ref[i * n() + j])
+            << "at " << i << ", " << j << ": Mr x Nr x Kr = " << mr() << " x " << nr() << " x " << kr()
+            << ", M x N x K = " << m() << " x " << n() << " x " << k();
+      }
+    }
+  }
+}
+
 void GemmMicrokernelTester::Test(
   xnn_qs8_gemm_minmax_ukernel_function gemm,
   xnn_init_qs8_conv_minmax_params_fn init_params,
@@ -1195,6 +1479,289 @@ void GemmMicrokernelTester::Test(xnn_f32_gemm_minmax_ukernel_function gemm_minma
   }
 }
 
+void GemmMicrokernelTester::Test(xnn_f32_f16w_gemm_minmax_ukernel_function gemm_minmax, xnn_init_f32_minmax_params_fn init_params) const {
+  ASSERT_LE(m(), mr());
+  ASSERT_GE(a_stride(), k());
+  ASSERT_GE(cm_stride(), n());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  std::uniform_real_distribution<float> f32dist;
+
+  std::vector<float> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> b(n() * k());
+  std::vector<float> bias(n());
+  std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> packed_w(packed_n() * packed_k() + packed_n());
+  std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+  std::vector<float> c_ref(m() * n());
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    std::generate(a.begin(), a.end(), [&]() { return f32dist(rng); });
+    // Weights are stored in FP16 format: round them in the reference too.
+    std::generate(b.begin(), b.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+    std::generate(bias.begin(), bias.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+    std::fill(c.begin(), c.end(), nanf(""));
+    std::fill(c_ref.begin(), c_ref.end(), 0.0f);
+
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    xnn_pack_f32_to_f16_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        for (size_t k_index = 0; k_index < k(); k_index++) {
+          ASSERT_LE(n(), packed_n());
+          ASSERT_LT(m_index * n() + n_index, c_ref.size());
+          c_ref[m_index * n() + n_index] +=
+            a[m_index * a_stride() + k_index] *
+            b[n_index * k() + k_index];
+        }
+        c_ref[m_index * n() + n_index] += bias[n_index];
+      }
+    }
+
+    const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+    const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+    const float c_min =
+        qmin() == std::numeric_limits<uint8_t>::min() ? -std::numeric_limits<float>::infinity()
+                    : accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+    const float c_max =
+        qmax() == std::numeric_limits<uint8_t>::max() ? +std::numeric_limits<float>::infinity()
+                      : accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+    // Prepare parameters.
+    xnn_f32_minmax_params params;
+    init_params(&params, c_min, c_max);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        c_ref[m_index * n() + n_index] = std::max(std::min(c_ref[m_index * n() + n_index], c_max), c_min);
+      }
+    }
+
+    gemm_minmax(m(), n(), k() * sizeof(float),
+      a.data(), a_stride() * sizeof(float),
+      packed_w.data(),
+      c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+      &params);
+
+    // Validate micro-kernel outputs.
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        ASSERT_LE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_max)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_GE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_min)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_NEAR(
+            c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()],
+            c_ref[i * n() + j],
+            std::abs(c_ref[i * n() + j]) * 1.0e-6f)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+      }
+    }
+  }
+}
+
+void GemmMicrokernelTester::Test(xnn_bf16_gemm_minmax_ukernel_function gemm_minmax, xnn_init_f32_minmax_params_fn init_params) const {
+  ASSERT_LE(m(), mr());
+  ASSERT_GE(a_stride(), k());
+  ASSERT_GE(cm_stride(), n());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  std::uniform_real_distribution<float> f32dist;
+
+  std::vector<uint16_t> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+  std::vector<uint16_t> b(n() * k());
+  std::vector<float> bias(n());
+  std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> packed_w(packed_n() * packed_k() + packed_n() * sizeof(float) / sizeof(uint16_t));
+  std::vector<uint16_t> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+  std::vector<float> c_ref(m() * n());
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    std::generate(a.begin(), a.end(), [&]() { return math_cvt_bf16_fp32(f32dist(rng)); });
+    std::generate(b.begin(), b.end(), [&]() { return math_cvt_bf16_fp32(f32dist(rng)); });
+    std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+    std::fill(c.begin(), c.end(), UINT16_C(0x7FC0) /* NaN */);
+    std::fill(c_ref.begin(), c_ref.end(), 0.0f);
+
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    xnn_pack_bf16_gemm_goi_w(1, n(), k(), nr(), kr(), sr(), b.data(), bias.data(), packed_w.data(), 0, nullptr);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        for (size_t k_index = 0; k_index < k(); k_index++) {
+          ASSERT_LE(n(), packed_n());
+          ASSERT_LT(m_index * n() + n_index, c_ref.size());
+          c_ref[m_index * n() + n_index] +=
+            math_cvt_fp32_bf16(a[m_index * a_stride() + k_index]) *
+            math_cvt_fp32_bf16(b[n_index * k() + k_index]);
+        }
+        c_ref[m_index * n() + n_index] += bias[n_index];
+      }
+    }
+
+    // Output bounds are representable in BF16, so that rounding of the clamped outputs keeps them within bounds.
+    const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+    const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+    const float c_min =
+        qmin() == std::numeric_limits<uint8_t>::min() ? -std::numeric_limits<float>::infinity()
+                    : math_cvt_fp32_bf16(math_cvt_bf16_fp32(accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin())));
+    const float c_max =
+        qmax() == std::numeric_limits<uint8_t>::max() ? +std::numeric_limits<float>::infinity()
+                      : math_cvt_fp32_bf16(math_cvt_bf16_fp32(accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax())));
+
+    // Prepare parameters.
+    xnn_f32_minmax_params params;
+    init_params(&params, c_min, c_max);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        c_ref[m_index * n() + n_index] = std::max(std::min(c_ref[m_index * n() + n_index], c_max), c_min);
+      }
+    }
+
+    gemm_minmax(m(), n(), k() * sizeof(uint16_t),
+      a.data(), a_stride() * sizeof(uint16_t),
+      packed_w.data(),
+      c.data(), cm_stride() * sizeof(uint16_t), cn_stride() * sizeof(uint16_t),
+      &params);
+
+    // Validate micro-kernel outputs.
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        const float c_value = math_cvt_fp32_bf16(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()]);
+        ASSERT_LE(c_value, c_max)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c_value << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_GE(c_value, c_min)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c_value << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_NEAR(c_value, c_ref[i * n() + j], std::max(1.0e-4f, std::abs(c_ref[i * n() + j]) * 1.0e-2f))
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c_value << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+      }
+    }
+  }
+}
+
+void GemmMicrokernelTester::Test(xnn_f32_qc4w_gemm_minmax_ukernel_function gemm_minmax, xnn_init_f32_qc4w_minmax_params_fn init_params) const {
+  ASSERT_LE(m(), mr());
+  ASSERT_GE(a_stride(), k());
+  ASSERT_GE(cm_stride(), n());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+  std::uniform_real_distribution<float> scaledist(0.5f, 2.0f);
+  std::uniform_int_distribution<int32_t> u8dist(0, std::numeric_limits<uint8_t>::max());
+  std::uniform_int_distribution<int32_t> w4dist(0, 15);
+
+  // Weights hold two 4-bit elements per byte, and every row of weights is padded to a whole number of bytes.
+  const size_t k_stride = (k() + 1) / 2;
+  const size_t packed_k_bytes = round_up_po2(packed_k(), 2) / 2;
+  std::vector<float> a((m() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<uint8_t> b(n() * k_stride);
+  std::vector<float> bias(n());
+  std::vector<float> kernel_scale(n());
+  std::vector<uint8_t, AlignedAllocator<uint8_t, 64>> packed_w(
+    packed_n() * packed_k_bytes + packed_n() * 2 * sizeof(float));
+  std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+  std::vector<double> c_ref(m() * n());
+  std::vector<double> c_abs(m() * n());
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    const uint8_t kernel_zero_point = uint8_t(w4dist(rng));
+    std::generate(a.begin(), a.end(), [&]() { return f32dist(rng); });
+    std::generate(b.begin(), b.end(), [&]() { return uint8_t(u8dist(rng)); });
+    std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+    std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return scaledist(rng); });
+    std::fill(c.begin(), c.end(), nanf(""));
+
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    const xnn_qs8_qc4w_packing_params packing_params = { 0, kernel_zero_point };
+    xnn_pack_f32_qc4w_gemm_goi_w(1, n(), k(), nr(), kr(), sr(),
+      b.data(), nullptr, packed_w.data(), nr() * 2 * sizeof(float), &packing_params);
+    const size_t packed_w_stride = nr() * (packed_k_bytes + 2 * sizeof(float));
+    xnn_init_qc8_scale_fp32_params(
+      n(), nr(), packed_w_stride, kernel_scale.data(),
+      (void*) ((uintptr_t) packed_w.data() + nr() * packed_k_bytes));
+    xnn_init_qc8_scale_fp32_params(
+      n(), nr(), packed_w_stride, bias.data(),
+      (void*) ((uintptr_t) packed_w.data() + nr() * (packed_k_bytes + sizeof(float))));
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        double acc = 0.0;
+        double acc_abs = 0.0;
+        for (size_t k_index = 0; k_index < k(); k_index++) {
+          const uint8_t b_byte = b[n_index * k_stride + k_index / 2];
+          const int32_t b_value = int32_t((k_index % 2 == 0 ? b_byte : b_byte >> 4) & 0xF) - int32_t(kernel_zero_point);
+          acc += double(a[m_index * a_stride() + k_index]) * double(b_value);
+          acc_abs += std::abs(double(a[m_index * a_stride() + k_index]) * double(b_value));
+        }
+        c_ref[m_index * n() + n_index] = acc * double(kernel_scale[n_index]) + double(bias[n_index]);
+        c_abs[m_index * n() + n_index] = acc_abs * double(kernel_scale[n_index]) + std::abs(double(bias[n_index]));
+      }
+    }
+
+    const float accumulated_min = float(*std::min_element(c_ref.cbegin(), c_ref.cend()));
+    const float accumulated_max = float(*std::max_element(c_ref.cbegin(), c_ref.cend()));
+    const float c_min =
+        qmin() == std::numeric_limits<uint8_t>::min() ? -std::numeric_limits<float>::infinity()
+                    : accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+    const float c_max =
+        qmax() == std::numeric_limits<uint8_t>::max() ? +std::numeric_limits<float>::infinity()
+                      : accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+
+    // Prepare parameters.
+    xnn_f32_qc4w_minmax_params params;
+    init_params(&params, c_min, c_max, kernel_zero_point);
+
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        c_ref[m_index * n() + n_index] = std::max(std::min(c_ref[m_index * n() + n_index], double(c_max)), double(c_min));
+      }
+    }
+
+    gemm_minmax(m(), n(), k() * sizeof(float),
+      a.data(), a_stride() * sizeof(float),
+      packed_w.data(),
+      c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+      &params);
+
+    // Validate micro-kernel outputs.
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        ASSERT_LE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_max)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_GE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_min)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        ASSERT_NEAR(
+            c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()],
+            c_ref[i * n() + j],
+            c_abs[i * n() + j] * 1.0e-6)
+            << "at " << i << ", " << j << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k()
+            << ", kernel zero point = " << int32_t(kernel_zero_point);
+      }
+    }
+  }
+}
+
 void GemmMicrokernelTester::Test(xnn_f32_gemminc_minmax_ukernel_function gemminc, xnn_init_f32_minmax_params_fn init_params) const {
   ASSERT_LE(m(), mr());
   ASSERT_GE(a_stride(), k());
@@ -1583,6 +2150,122 @@ void GemmMicrokernelTester::Test(xnn_f32_igemm_minmax_ukernel_function igemm_min
   }
 }
 
+void GemmMicrokernelTester::Test(xnn_f32_f16w_igemm_minmax_ukernel_function igemm_minmax, xnn_init_f32_minmax_params_fn init_params) const {
+  ASSERT_LE(m(), mr());
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  std::uniform_real_distribution<float> f32dist;
+
+  std::vector<float> a((mr() - 1) * a_stride() + k() + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<float> b(n() * ks() * k());
+  std::vector<uint16_t, AlignedAllocator<uint16_t, 64>> packed_w(ks() * packed_k() * packed_n() + packed_n());
+  std::vector<float> bias(n());
+  std::vector<float> c((mr() - 1) * cm_stride() + ((n() - 1) / nr()) * cn_stride() + (n() - 1) % nr() + 1);
+  std::vector<float> c_ref(m() * n());
+  std::vector<float> junk(k() + XNN_EXTRA_BYTES / sizeof(float));
+  std::vector<const float*> im2col(mr() * ks());
+  std::fill(junk.begin(), junk.end(), nanf(""));
+
+  for (size_t iteration = 0; iteration < iterations(); iteration++) {
+    std::generate(a.begin(), a.end(), [&]() { return f32dist(rng); });
+    // Weights are stored in FP16 format: round them in the reference too.
+    std::generate(b.begin(), b.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+    std::generate(bias.begin(), bias.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+    std::fill(c.begin(), c.end(), nanf(""));
+    std::fill(c_ref.begin(), c_ref.end(), 0.0f);
+
+    std::fill(packed_w.begin(), packed_w.end(), 0);
+    xnn_pack_f32_to_f16_conv_goki_w(
+      1, n(), ks(), k(), nr(), kr(), sr(),
+      b.data(), bias.data(), packed_w.data(), 0 /* extra bytes */, nullptr);
+
+    for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+      for (size_t m_index = 0; m_index < mr(); m_index++) {
+        im2col[ks_index * mr() + m_index] = a.data() + a_stride() * m_index - a_offset();
+      }
+    }
+    std::shuffle(im2col.begin(), im2col.end(), rng);
+    if (zero_index() != SIZE_MAX) {
+      for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+        im2col[ks_index * mr() + zero_index()] = a.data();
+      }
+    }
+    for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+      for (size_t m_index = m(); m_index < mr(); m_index++) {
+        im2col[ks_index * mr() + m_index] = junk.data();
+      }
+    }
+
+    std::fill(c_ref.begin(), c_ref.end(), 0.0);
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        for (size_t ks_index = 0; ks_index < ks(); ks_index++) {
+          for (size_t k_index = 0; k_index < k(); k_index++) {
+            ASSERT_LT(ks_index * mr() + m_index, im2col.size());
+            ASSERT_LT(k_index, k());
+            ASSERT_LT(k_index, a_stride());
+            if (im2col[ks_index * mr() + m_index] == a.data()) {
+              c_ref[m_index * n() + n_index] +=
+                (im2col[ks_index * mr() + m_index][k_index]) *
+                (b[(n_index * ks() + ks_index) * k() + k_index]);
+            } else {
+              c_ref[m_index * n() + n_index] +=
+                (im2col[ks_index * mr() + m_index][k_index + a_offset()]) *
+                (b[(n_index * ks() + ks_index) * k() + k_index]);
+            }
+          }
+        }
+        c_ref[m_index * n() + n_index] += bias[n_index];
+      }
+    }
+
+    const float accumulated_min = *std::min_element(c_ref.cbegin(), c_ref.cend());
+    const float accumulated_max = *std::max_element(c_ref.cbegin(), c_ref.cend());
+    const float c_min = accumulated_min + (accumulated_max - accumulated_min) / 255.0f * float(qmin());
+    const float c_max = accumulated_max - (accumulated_max - accumulated_min) / 255.0f * float(255 - qmax());
+    for (size_t m_index = 0; m_index < m(); m_index++) {
+      for (size_t n_index = 0; n_index < n(); n_index++) {
+        c_ref[m_index * n() + n_index] = std::min(c_ref[m_index * n() + n_index], c_max);
+        c_ref[m_index * n() + n_index] = std::max(c_ref[m_index * n() + n_index], c_min);
+      }
+    }
+
+    // Prepare parameters.
+    xnn_f32_minmax_params params;
+    init_params(&params, c_min, c_max);
+
+    const float* zero_pointer = (zero_index() != SIZE_MAX) ? a.data() : NULL;
+
+    igemm_minmax(
+      m(), n(), k() * sizeof(float), ks() * mr() * sizeof(void*),
+      im2col.data(), packed_w.data(),
+      c.data(), cm_stride() * sizeof(float), cn_stride() * sizeof(float),
+      a_offset() * sizeof(float), zero_pointer,
+      &params);
+
+    for (size_t i = 0; i < m(); i++) {
+      for (size_t j = 0; j < n(); j++) {
+        ASSERT_LE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_max)
+            << "at " << i << ", " << i << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x KC x KS = " << m() << " x " << n() << " x " << k() << " x " << ks();
+        ASSERT_GE(c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()], c_min)
+            << "at " << i << ", " << i << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x KC x KS = " << m() << " x " << n() << " x " << k() << " x " << ks();
+        ASSERT_NEAR(
+            c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()],
+            c_ref[i * n() + j],
+            std::abs(c_ref[i * n() + j]) * 1.0e-6f)
+            << "at " << i << ", " << i << ": reference = " << c_ref[i * n() + j]
+            << ", optimized = " << c[i * cm_stride() + (j / nr()) * cn_stride() + j % nr()] << ", Mr x Nr x Kr = " << mr() << " x " << nr()
+            << " x " << kr() << ", M x N x KC x KS = " << m() << " x " << n() << " x " << k() << " x " << ks();
+      }
+    }
+  }
+}
+
 #if XNN_PLATFORM_JIT
 void GemmMicrokernelTester::Test(
     xnn_jit_gemm_code_generator_function gemm_generator,
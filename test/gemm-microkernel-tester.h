@@ -208,6 +208,14 @@ class GemmMicrokernelTester {
     xnn_init_qu8_conv_minmax_params_fn init_params,
     xnn_qu8_requantize_fn requantize);
 
+  void Test(
+    xnn_qd8_f32_qc8w_gemm_minmax_ukernel_function gemm,
+    xnn_init_f32_minmax_params_fn init_params) const;
+
+  void Test(
+    xnn_qd8_f32_qc4w_gemm_minmax_ukernel_function gemm,
+    xnn_init_f32_qc4w_minmax_params_fn init_params) const;
+
   void Test(
     xnn_qc8_gemm_minmax_ukernel_function gemm,
     xnn_init_qs8_minmax_params_fn init_params,
@@ -218,6 +226,8 @@ class GemmMicrokernelTester {
     xnn_init_qs8_minmax_params_fn init_params,
     xnn_qs8_requantize_fn requantize) const;
 
+  void Test(xnn_qs8_gemm_acc32_ukernel_function gemm_acc32) const;
+
   void Test(
     xnn_qs8_gemm_minmax_ukernel_function gemm,
     xnn_init_qs8_conv_minmax_params_fn init_params,
@@ -242,12 +252,20 @@ class GemmMicrokernelTester {
 
   void Test(xnn_f32_gemminc_minmax_ukernel_function gemminc, xnn_init_f32_minmax_params_fn init_params) const;
 
+  void Test(xnn_f32_f16w_gemm_minmax_ukernel_function gemm_minmax, xnn_init_f32_minmax_params_fn init_params) const;
+
+  void Test(xnn_bf16_gemm_minmax_ukernel_function gemm_minmax, xnn_init_f32_minmax_params_fn init_params) const;
+
+  void Test(xnn_f32_qc4w_gemm_minmax_ukernel_function gemm_minmax, xnn_init_f32_qc4w_minmax_params_fn init_params) const;
+
   void Test(xnn_f32_igemm_ukernel_function igemm) const;
 
   void Test(xnn_f32_igemm_relu_ukernel_function igemm_relu) const;
 
   void Test(xnn_f32_igemm_minmax_ukernel_function igemm_minmax, xnn_init_f32_minmax_params_fn init_params) const;
 
+  void Test(xnn_f32_f16w_igemm_minmax_ukernel_function igemm_minmax, xnn_init_f32_minmax_params_fn init_params) const;
+
 #if XNN_PLATFORM_JIT
   void Test(
     xnn_jit_gemm_code_generator_function gemm_generator,
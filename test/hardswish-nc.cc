@@ -114,3 +114,57 @@ TEST(HARDSWISH_NC_F32, small_batch_with_input_and_output_stride) {
       .TestF32();
   }
 }
+
+TEST(HARDSWISH_NC_QS8, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    HardSwishOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(HARDSWISH_NC_QS8, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    HardSwishOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(HARDSWISH_NC_QS8, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    HardSwishOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(HARDSWISH_NC_QS8, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    HardSwishOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(HARDSWISH_NC_QS8, small_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    HardSwishOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8();
+  }
+}
@@ -11,6 +11,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdlib>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -193,6 +194,74 @@ class HardSwishOperatorTester {
     }
   }
 
+  void TestQS8() const {
+    // Input covers [-4, 4) and output covers [-0.375, 4) with the default quantization parameters below.
+    const float input_scale = 8.0f / 256.0f;
+    const int8_t input_zero_point = 0;
+    const float output_scale = 4.375f / 256.0f;
+    const int8_t output_zero_point = -106;
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) +
+      (batch_size() - 1) * input_stride() + channels());
+    std::vector<int8_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const float x = input_scale * float(int32_t(input[i * input_stride() + c]) - int32_t(input_zero_point));
+          const float y = x * std::min(std::max(x + 3.0f, 0.0f), 6.0f) / 6.0f;
+          float y_scaled = y / output_scale + float(output_zero_point);
+          y_scaled = std::min<float>(y_scaled, float(std::numeric_limits<int8_t>::max()));
+          y_scaled = std::max<float>(y_scaled, float(std::numeric_limits<int8_t>::min()));
+          output_ref[i * channels() + c] = y_scaled;
+        }
+      }
+
+      // Create, setup, run, and destroy HardSwish operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t hardswish_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_hardswish_nc_qs8(
+          channels(), input_stride(), output_stride(),
+          input_zero_point, input_scale,
+          output_zero_point, output_scale,
+          std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max(),
+          0, &hardswish_op));
+      ASSERT_NE(nullptr, hardswish_op);
+
+      // Smart pointer to automatically delete hardswish_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_hardswish_op(hardswish_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_hardswish_nc_qs8(
+          hardswish_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(hardswish_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(float(int32_t(output[i * output_stride() + c])), output_ref[i * channels() + c], 0.6f)
+            << "at position " << i << ", batch size = " << batch_size() << ", channels = " << channels();
+        }
+      }
+    }
+  }
+
  private:
   size_t batch_size_{1};
   size_t channels_{1};
@@ -0,0 +1,149 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "layer-normalization-operator-tester.h"
+
+
+TEST(LAYER_NORMALIZATION_NC_F16, single_channel) {
+  LayerNormalizationOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(LAYER_NORMALIZATION_NC_F16, small_batch) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F16, small_batch_with_input_stride) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F16, small_batch_with_output_stride) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F16, large_input_offset) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_offset(100.0f)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F16, large_epsilon) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .epsilon(1.0f)
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F16, transformer_hidden_size) {
+  LayerNormalizationOperatorTester()
+    .batch_size(5)
+    .channels(768)
+    .iterations(3)
+    .TestF16();
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, single_channel) {
+  LayerNormalizationOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .iterations(3)
+    .TestF32();
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, small_batch) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, small_batch_with_input_stride) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, small_batch_with_output_stride) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, large_input_offset) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_offset(100.0f)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, large_epsilon) {
+  for (size_t channels = 2; channels < 100; channels += 7) {
+    LayerNormalizationOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .epsilon(1.0f)
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(LAYER_NORMALIZATION_NC_F32, transformer_hidden_size) {
+  LayerNormalizationOperatorTester()
+    .batch_size(5)
+    .channels(768)
+    .iterations(3)
+    .TestF32();
+}
@@ -0,0 +1,272 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class LayerNormalizationOperatorTester {
+ public:
+  inline LayerNormalizationOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline LayerNormalizationOperatorTester& input_stride(size_t input_stride) {
+    assert(input_stride != 0);
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->input_stride_ >= this->channels_);
+      return this->input_stride_;
+    }
+  }
+
+  inline LayerNormalizationOperatorTester& output_stride(size_t output_stride) {
+    assert(output_stride != 0);
+    this->output_stride_ = output_stride;
+    return *this;
+  }
+
+  inline size_t output_stride() const {
+    if (this->output_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->output_stride_ >= this->channels_);
+      return this->output_stride_;
+    }
+  }
+
+  inline LayerNormalizationOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline LayerNormalizationOperatorTester& epsilon(float epsilon) {
+    assert(epsilon > 0.0f);
+    this->epsilon_ = epsilon;
+    return *this;
+  }
+
+  inline float epsilon() const {
+    return this->epsilon_;
+  }
+
+  inline LayerNormalizationOperatorTester& input_offset(float input_offset) {
+    this->input_offset_ = input_offset;
+    return *this;
+  }
+
+  inline float input_offset() const {
+    return this->input_offset_;
+  }
+
+  inline LayerNormalizationOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(input_offset() - 2.0f, input_offset() + 2.0f);
+    std::uniform_real_distribution<float> gammadist(0.5f, 2.0f);
+    std::uniform_real_distribution<float> betadist(-1.0f, 1.0f);
+
+    std::vector<uint16_t> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<uint16_t> gamma(channels());
+    std::vector<uint16_t> beta(channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::generate(gamma.begin(), gamma.end(), [&]() { return fp16_ieee_from_fp32_value(gammadist(rng)); });
+      std::generate(beta.begin(), beta.end(), [&]() { return fp16_ieee_from_fp32_value(betadist(rng)); });
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        double sum = 0.0;
+        for (size_t c = 0; c < channels(); c++) {
+          sum += double(fp16_ieee_to_fp32_value(input[i * input_stride() + c]));
+        }
+        const double mean = sum / double(channels());
+        double sum_squares = 0.0;
+        for (size_t c = 0; c < channels(); c++) {
+          const double delta = double(fp16_ieee_to_fp32_value(input[i * input_stride() + c])) - mean;
+          sum_squares += delta * delta;
+        }
+        const double inv_stddev = 1.0 / std::sqrt(sum_squares / double(channels()) + double(epsilon()));
+        for (size_t c = 0; c < channels(); c++) {
+          output_ref[i * channels() + c] = float(
+            (double(fp16_ieee_to_fp32_value(input[i * input_stride() + c])) - mean) * inv_stddev *
+              double(fp16_ieee_to_fp32_value(gamma[c])) + double(fp16_ieee_to_fp32_value(beta[c])));
+        }
+      }
+
+      // Create, setup, run, and destroy Layer Normalization operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t layer_normalization_op = nullptr;
+
+      const xnn_status status = xnn_create_layer_normalization_nc_f16(
+          channels(), input_stride(), output_stride(),
+          epsilon(), gamma.data(), beta.data(),
+          0, &layer_normalization_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, layer_normalization_op);
+
+      // Smart pointer to automatically delete layer_normalization_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_layer_normalization_op(
+        layer_normalization_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_layer_normalization_nc_f16(
+          layer_normalization_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(layer_normalization_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+              fp16_ieee_to_fp32_value(output[i * output_stride() + c]),
+              output_ref[i * channels() + c],
+              std::max(1.0e-2f, std::abs(output_ref[i * channels() + c]) * 1.0e-2f))
+            << "element " << i << " / " << batch_size() << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(input_offset() - 2.0f, input_offset() + 2.0f);
+    std::uniform_real_distribution<float> gammadist(0.5f, 2.0f);
+    std::uniform_real_distribution<float> betadist(-1.0f, 1.0f);
+
+    std::vector<float> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> gamma(channels());
+    std::vector<float> beta(channels());
+    std::vector<double> output_ref(batch_size() * channels());
+    std::vector<double> inv_stddev_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(gamma.begin(), gamma.end(), [&]() { return gammadist(rng); });
+      std::generate(beta.begin(), beta.end(), [&]() { return betadist(rng); });
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        double sum = 0.0;
+        for (size_t c = 0; c < channels(); c++) {
+          sum += double(input[i * input_stride() + c]);
+        }
+        const double mean = sum / double(channels());
+        double sum_squares = 0.0;
+        for (size_t c = 0; c < channels(); c++) {
+          const double delta = double(input[i * input_stride() + c]) - mean;
+          sum_squares += delta * delta;
+        }
+        const double inv_stddev = 1.0 / std::sqrt(sum_squares / double(channels()) + double(epsilon()));
+        inv_stddev_ref[i] = inv_stddev;
+        for (size_t c = 0; c < channels(); c++) {
+          output_ref[i * channels() + c] =
+            (double(input[i * input_stride() + c]) - mean) * inv_stddev * double(gamma[c]) + double(beta[c]);
+        }
+      }
+
+      // Create, setup, run, and destroy Layer Normalization operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t layer_normalization_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_layer_normalization_nc_f32(
+          channels(), input_stride(), output_stride(),
+          epsilon(), gamma.data(), beta.data(),
+          0, &layer_normalization_op));
+      ASSERT_NE(nullptr, layer_normalization_op);
+
+      // Smart pointer to automatically delete layer_normalization_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_layer_normalization_op(
+        layer_normalization_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_layer_normalization_nc_f32(
+          layer_normalization_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(layer_normalization_op, nullptr /* thread pool */));
+
+      // Verify results. Rounding errors in the inputs relative to their offset are amplified by the inverse standard
+      // deviation, so the tolerance accounts for both.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const double offset_tolerance = 4.0 * double(std::numeric_limits<float>::epsilon()) *
+          (std::abs(double(input_offset())) + 2.0) * inv_stddev_ref[i] * 2.0 /* max gamma */;
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(
+              double(output[i * output_stride() + c]),
+              output_ref[i * channels() + c],
+              std::max(1.0e-5, std::abs(output_ref[i * channels() + c]) * 1.0e-5) + offset_tolerance)
+            << "element " << i << " / " << batch_size() << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batch_size_{1};
+  size_t channels_{1};
+  size_t input_stride_{0};
+  size_t output_stride_{0};
+  float epsilon_{1.0e-5f};
+  float input_offset_{0.0f};
+  size_t iterations_{15};
+};
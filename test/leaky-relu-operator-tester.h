@@ -333,6 +333,66 @@ class LeakyReLUOperatorTester {
     }
   }
 
+  void TestQS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) + (batch_size() - 1) * input_stride() + channels());
+    std::vector<int8_t> output((batch_size() - 1) * output_stride() + channels());
+    std::vector<float> output_ref(batch_size() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const float x = input_scale() * (int32_t(input[i * input_stride() + c]) - (int32_t(input_zero_point()) - 0x80));
+          float y = (x < 0.0f ? x * negative_slope() : x) / output_scale();
+          y = std::min<float>(y, (int32_t(qmax()) - 0x80) - (int32_t(output_zero_point()) - 0x80));
+          y = std::max<float>(y, (int32_t(qmin()) - 0x80) - (int32_t(output_zero_point()) - 0x80));
+          output_ref[i * channels() + c] = y + float((int32_t(output_zero_point()) - 0x80));
+        }
+      }
+
+      // Create, setup, run, and destroy Leaky ReLU operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t leaky_relu_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_leaky_relu_nc_qs8(
+          channels(), input_stride(), output_stride(),
+          negative_slope(),
+          int8_t(input_zero_point() - 0x80), input_scale(),
+          int8_t(output_zero_point() - 0x80), output_scale(),
+          int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+          0, &leaky_relu_op));
+      ASSERT_NE(nullptr, leaky_relu_op);
+
+      // Smart pointer to automatically delete leaky_relu_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_leaky_relu_op(leaky_relu_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_leaky_relu_nc_qs8(
+          leaky_relu_op,
+          batch_size(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(leaky_relu_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(float(int32_t(output[i * output_stride() + c])), output_ref[i * channels() + c], 0.6f);
+        }
+      }
+    }
+  }
+
  private:
   size_t batch_size_{1};
   size_t channels_{1};
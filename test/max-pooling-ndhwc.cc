@@ -0,0 +1,561 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "pooling-3d-operator-tester.h"
+
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_2x2x2) {
+  Pooling3DOperatorTester()
+    .input_size(4, 6, 8)
+    .pooling_size(2)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_3x3x3) {
+  for (size_t channels = 1; channels <= 40; channels += 13) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .pooling_size(3)
+      .channels(channels)
+      .TestMaxPoolS8();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_3x3x3_with_stride) {
+  Pooling3DOperatorTester()
+    .input_size(7, 8, 9)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_3x3x3_with_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_3x3x3_with_asymmetric_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding_front(2)
+    .padding_back(0)
+    .padding_top(0)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(1)
+    .pooling_size(3)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_3x3x3_with_tf_same_padding) {
+  for (uint32_t stride = 1; stride <= 2; stride++) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .padding_tf_same(true)
+      .pooling_size(3)
+      .stride(stride)
+      .channels(19)
+      .TestMaxPoolS8();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_1x3x3) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(1, 3, 3)
+    .stride(1, 2, 2)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_2x1x1) {
+  Pooling3DOperatorTester()
+    .input_size(6, 5, 4)
+    .pooling_size(2, 1, 1)
+    .stride(2, 1, 1)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_large_pool) {
+  Pooling3DOperatorTester()
+    .input_size(6, 7, 8)
+    .pooling_size(4, 4, 5)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_with_input_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .input_pixel_stride(23)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_with_output_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .output_pixel_stride(29)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_with_qmin) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmin(128)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, unit_batch_with_qmax) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmax(128)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_S8, small_batch) {
+  Pooling3DOperatorTester()
+    .batch_size(3)
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolS8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_2x2x2) {
+  Pooling3DOperatorTester()
+    .input_size(4, 6, 8)
+    .pooling_size(2)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_3x3x3) {
+  for (size_t channels = 1; channels <= 40; channels += 13) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .pooling_size(3)
+      .channels(channels)
+      .TestMaxPoolU8();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_3x3x3_with_stride) {
+  Pooling3DOperatorTester()
+    .input_size(7, 8, 9)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_3x3x3_with_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_3x3x3_with_asymmetric_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding_front(2)
+    .padding_back(0)
+    .padding_top(0)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(1)
+    .pooling_size(3)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_3x3x3_with_tf_same_padding) {
+  for (uint32_t stride = 1; stride <= 2; stride++) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .padding_tf_same(true)
+      .pooling_size(3)
+      .stride(stride)
+      .channels(19)
+      .TestMaxPoolU8();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_1x3x3) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(1, 3, 3)
+    .stride(1, 2, 2)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_2x1x1) {
+  Pooling3DOperatorTester()
+    .input_size(6, 5, 4)
+    .pooling_size(2, 1, 1)
+    .stride(2, 1, 1)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_large_pool) {
+  Pooling3DOperatorTester()
+    .input_size(6, 7, 8)
+    .pooling_size(4, 4, 5)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_with_input_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .input_pixel_stride(23)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_with_output_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .output_pixel_stride(29)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_with_qmin) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmin(128)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, unit_batch_with_qmax) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmax(128)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_U8, small_batch) {
+  Pooling3DOperatorTester()
+    .batch_size(3)
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolU8();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_2x2x2) {
+  Pooling3DOperatorTester()
+    .input_size(4, 6, 8)
+    .pooling_size(2)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_3x3x3) {
+  for (size_t channels = 1; channels <= 40; channels += 13) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .pooling_size(3)
+      .channels(channels)
+      .TestMaxPoolF16();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_3x3x3_with_stride) {
+  Pooling3DOperatorTester()
+    .input_size(7, 8, 9)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_3x3x3_with_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_3x3x3_with_asymmetric_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding_front(2)
+    .padding_back(0)
+    .padding_top(0)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(1)
+    .pooling_size(3)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_3x3x3_with_tf_same_padding) {
+  for (uint32_t stride = 1; stride <= 2; stride++) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .padding_tf_same(true)
+      .pooling_size(3)
+      .stride(stride)
+      .channels(19)
+      .TestMaxPoolF16();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_1x3x3) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(1, 3, 3)
+    .stride(1, 2, 2)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_2x1x1) {
+  Pooling3DOperatorTester()
+    .input_size(6, 5, 4)
+    .pooling_size(2, 1, 1)
+    .stride(2, 1, 1)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_large_pool) {
+  Pooling3DOperatorTester()
+    .input_size(6, 7, 8)
+    .pooling_size(4, 4, 5)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_with_input_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .input_pixel_stride(23)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_with_output_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .output_pixel_stride(29)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_with_qmin) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmin(128)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, unit_batch_with_qmax) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmax(128)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F16, small_batch) {
+  Pooling3DOperatorTester()
+    .batch_size(3)
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF16();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_2x2x2) {
+  Pooling3DOperatorTester()
+    .input_size(4, 6, 8)
+    .pooling_size(2)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_3x3x3) {
+  for (size_t channels = 1; channels <= 40; channels += 13) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .pooling_size(3)
+      .channels(channels)
+      .TestMaxPoolF32();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_3x3x3_with_stride) {
+  Pooling3DOperatorTester()
+    .input_size(7, 8, 9)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_3x3x3_with_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_3x3x3_with_asymmetric_padding) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .padding_front(2)
+    .padding_back(0)
+    .padding_top(0)
+    .padding_right(1)
+    .padding_bottom(2)
+    .padding_left(1)
+    .pooling_size(3)
+    .channels(19)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_3x3x3_with_tf_same_padding) {
+  for (uint32_t stride = 1; stride <= 2; stride++) {
+    Pooling3DOperatorTester()
+      .input_size(5, 6, 7)
+      .padding_tf_same(true)
+      .pooling_size(3)
+      .stride(stride)
+      .channels(19)
+      .TestMaxPoolF32();
+  }
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_1x3x3) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(1, 3, 3)
+    .stride(1, 2, 2)
+    .channels(19)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_2x1x1) {
+  Pooling3DOperatorTester()
+    .input_size(6, 5, 4)
+    .pooling_size(2, 1, 1)
+    .stride(2, 1, 1)
+    .channels(19)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_large_pool) {
+  Pooling3DOperatorTester()
+    .input_size(6, 7, 8)
+    .pooling_size(4, 4, 5)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_with_input_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .input_pixel_stride(23)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_with_output_stride) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .output_pixel_stride(29)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_with_qmin) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmin(128)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, unit_batch_with_qmax) {
+  Pooling3DOperatorTester()
+    .input_size(5, 6, 7)
+    .pooling_size(3)
+    .channels(19)
+    .qmax(128)
+    .TestMaxPoolF32();
+}
+
+TEST(MAX_POOLING_NDHWC_F32, small_batch) {
+  Pooling3DOperatorTester()
+    .batch_size(3)
+    .input_size(5, 6, 7)
+    .padding(1)
+    .pooling_size(3)
+    .stride(2)
+    .channels(19)
+    .TestMaxPoolF32();
+}
@@ -164,3 +164,40 @@ TEST(MemoryPlanner, GeneralPlanning) {
 
   xnn_release_value_allocation_tracker(&tracker);
 }
+
+TEST(MemoryPlanner, ViewExtendsBaseLifecycle) {
+  EXPECT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+  struct xnn_subgraph subgraph;
+  subgraph.num_nodes = 0;
+  subgraph.num_values = 4;
+  struct xnn_value_allocation_tracker tracker;
+  xnn_init_value_allocation_tracker(&tracker, &subgraph);
+  // Value 1 is a view into value 0, and value 2 is a view into value 1. Value 3 is produced while the views are alive.
+  tracker.usage[0].first_node = 0,
+  tracker.usage[0].last_node = 1,
+  xnn_add_value_allocation_tracker(&tracker, 0, 32);
+
+  tracker.usage[1].first_node = 1,
+  tracker.usage[1].last_node = 2;
+  tracker.usage[2].first_node = 2,
+  tracker.usage[2].last_node = 3;
+
+  tracker.usage[3].first_node = 3,
+  tracker.usage[3].last_node = 4,
+  xnn_add_value_allocation_tracker(&tracker, 3, 16);
+
+  xnn_add_view_allocation_tracker(&tracker, 2, 1);
+  xnn_add_view_allocation_tracker(&tracker, 1, 0);
+  xnn_plan_value_allocation_tracker(&tracker);
+
+#if XNN_ENABLE_MEMOPT
+  EXPECT_EQ(3, tracker.usage[0].last_node);
+  EXPECT_EQ(48, tracker.mem_arena_size);
+  EXPECT_EQ(0, tracker.usage[0].alloc_offset);
+  EXPECT_EQ(32, tracker.usage[3].alloc_offset);
+#else
+  EXPECT_EQ(48, tracker.mem_arena_size);
+#endif
+
+  xnn_release_value_allocation_tracker(&tracker);
+}
@@ -0,0 +1,753 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class Pooling3DOperatorTester {
+ public:
+  inline Pooling3DOperatorTester& padding_tf_same(bool padding_same) {
+    if (padding_same) {
+      assert(padding_front() == 0);
+      assert(padding_back() == 0);
+      assert(padding_top() == 0);
+      assert(padding_right() == 0);
+      assert(padding_bottom() == 0);
+      assert(padding_left() == 0);
+    }
+    this->padding_tf_same_ = padding_same;
+    return *this;
+  }
+
+  inline bool padding_tf_same() const {
+    return this->padding_tf_same_;
+  }
+
+  inline Pooling3DOperatorTester& padding(uint32_t padding) {
+    assert(!padding_tf_same());
+    this->padding_front_ = padding;
+    this->padding_back_ = padding;
+    this->padding_top_ = padding;
+    this->padding_right_ = padding;
+    this->padding_bottom_ = padding;
+    this->padding_left_ = padding;
+    return *this;
+  }
+
+  inline Pooling3DOperatorTester& padding_front(uint32_t padding_front) {
+    assert(!padding_tf_same());
+    this->padding_front_ = padding_front;
+    return *this;
+  }
+
+  inline uint32_t padding_front() const {
+    if (padding_tf_same()) {
+      return compute_tf_same_padding(input_depth(), pooling_depth(), stride_depth()) / 2;
+    } else {
+      return this->padding_front_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& padding_back(uint32_t padding_back) {
+    assert(!padding_tf_same());
+    this->padding_back_ = padding_back;
+    return *this;
+  }
+
+  inline uint32_t padding_back() const {
+    if (padding_tf_same()) {
+      const uint32_t total_padding = compute_tf_same_padding(input_depth(), pooling_depth(), stride_depth());
+      return total_padding - total_padding / 2;
+    } else {
+      return this->padding_back_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& padding_top(uint32_t padding_top) {
+    assert(!padding_tf_same());
+    this->padding_top_ = padding_top;
+    return *this;
+  }
+
+  inline uint32_t padding_top() const {
+    if (padding_tf_same()) {
+      return compute_tf_same_padding(input_height(), pooling_height(), stride_height()) / 2;
+    } else {
+      return this->padding_top_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& padding_right(uint32_t padding_right) {
+    assert(!padding_tf_same());
+    this->padding_right_ = padding_right;
+    return *this;
+  }
+
+  inline uint32_t padding_right() const {
+    if (padding_tf_same()) {
+      const uint32_t total_padding = compute_tf_same_padding(input_width(), pooling_width(), stride_width());
+      return total_padding - total_padding / 2;
+    } else {
+      return this->padding_right_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& padding_bottom(uint32_t padding_bottom) {
+    assert(!padding_tf_same());
+    this->padding_bottom_ = padding_bottom;
+    return *this;
+  }
+
+  inline uint32_t padding_bottom() const {
+    if (padding_tf_same()) {
+      const uint32_t total_padding = compute_tf_same_padding(input_height(), pooling_height(), stride_height());
+      return total_padding - total_padding / 2;
+    } else {
+      return this->padding_bottom_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& padding_left(uint32_t padding_left) {
+    assert(!padding_tf_same());
+    this->padding_left_ = padding_left;
+    return *this;
+  }
+
+  inline uint32_t padding_left() const {
+    if (padding_tf_same()) {
+      return compute_tf_same_padding(input_width(), pooling_width(), stride_width()) / 2;
+    } else {
+      return this->padding_left_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& input_size(size_t input_depth, size_t input_height, size_t input_width) {
+    assert(input_depth >= 1);
+    assert(input_height >= 1);
+    assert(input_width >= 1);
+    this->input_depth_ = input_depth;
+    this->input_height_ = input_height;
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline size_t input_depth() const {
+    return this->input_depth_;
+  }
+
+  inline size_t input_height() const {
+    return this->input_height_;
+  }
+
+  inline size_t input_width() const {
+    return this->input_width_;
+  }
+
+  inline Pooling3DOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline Pooling3DOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline Pooling3DOperatorTester& pooling_size(uint32_t pooling_size) {
+    assert(pooling_size >= 1);
+    this->pooling_depth_ = pooling_size;
+    this->pooling_height_ = pooling_size;
+    this->pooling_width_ = pooling_size;
+    return *this;
+  }
+
+  inline Pooling3DOperatorTester& pooling_size(uint32_t pooling_depth, uint32_t pooling_height, uint32_t pooling_width) {
+    assert(pooling_depth >= 1);
+    assert(pooling_height >= 1);
+    assert(pooling_width >= 1);
+    this->pooling_depth_ = pooling_depth;
+    this->pooling_height_ = pooling_height;
+    this->pooling_width_ = pooling_width;
+    return *this;
+  }
+
+  inline uint32_t pooling_depth() const {
+    return this->pooling_depth_;
+  }
+
+  inline uint32_t pooling_height() const {
+    return this->pooling_height_;
+  }
+
+  inline uint32_t pooling_width() const {
+    return this->pooling_width_;
+  }
+
+  inline Pooling3DOperatorTester& stride(uint32_t stride) {
+    assert(stride >= 1);
+    this->stride_depth_ = stride;
+    this->stride_height_ = stride;
+    this->stride_width_ = stride;
+    return *this;
+  }
+
+  inline Pooling3DOperatorTester& stride(uint32_t stride_depth, uint32_t stride_height, uint32_t stride_width) {
+    assert(stride_depth >= 1);
+    assert(stride_height >= 1);
+    assert(stride_width >= 1);
+    this->stride_depth_ = stride_depth;
+    this->stride_height_ = stride_height;
+    this->stride_width_ = stride_width;
+    return *this;
+  }
+
+  inline uint32_t stride_depth() const {
+    return this->stride_depth_;
+  }
+
+  inline uint32_t stride_height() const {
+    return this->stride_height_;
+  }
+
+  inline uint32_t stride_width() const {
+    return this->stride_width_;
+  }
+
+  inline size_t output_depth() const {
+    if (padding_tf_same()) {
+      return (input_depth() + stride_depth() - 1) / stride_depth();
+    } else {
+      return compute_output_dimension(padding_front() + input_depth() + padding_back(), pooling_depth(), stride_depth());
+    }
+  }
+
+  inline size_t output_height() const {
+    if (padding_tf_same()) {
+      return (input_height() + stride_height() - 1) / stride_height();
+    } else {
+      return compute_output_dimension(padding_top() + input_height() + padding_bottom(), pooling_height(), stride_height());
+    }
+  }
+
+  inline size_t output_width() const {
+    if (padding_tf_same()) {
+      return (input_width() + stride_width() - 1) / stride_width();
+    } else {
+      return compute_output_dimension(padding_left() + input_width() + padding_right(), pooling_width(), stride_width());
+    }
+  }
+
+  inline Pooling3DOperatorTester& input_pixel_stride(size_t input_pixel_stride) {
+    assert(input_pixel_stride != 0);
+    this->input_pixel_stride_ = input_pixel_stride;
+    return *this;
+  }
+
+  inline size_t input_pixel_stride() const {
+    if (this->input_pixel_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->input_pixel_stride_ >= channels());
+      return this->input_pixel_stride_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& output_pixel_stride(size_t output_pixel_stride) {
+    assert(output_pixel_stride != 0);
+    this->output_pixel_stride_ = output_pixel_stride;
+    return *this;
+  }
+
+  inline size_t output_pixel_stride() const {
+    if (this->output_pixel_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->output_pixel_stride_ >= channels());
+      return this->output_pixel_stride_;
+    }
+  }
+
+  inline Pooling3DOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline Pooling3DOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline Pooling3DOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestMaxPoolS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+
+    std::vector<int8_t> input(XNN_EXTRA_BYTES / sizeof(int8_t) + input_elements());
+    std::vector<int8_t> output(output_elements());
+    std::vector<double> output_ref(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      const int8_t output_min = int8_t(qmin() - 0x80);
+      const int8_t output_max = int8_t(qmax() - 0x80);
+      ComputeMaxReference([&](size_t i) { return double(input[i]); }, output_ref);
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Max Pooling operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t max_pooling_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_max_pooling3d_ndhwc_s8(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          pooling_depth(), pooling_height(), pooling_width(),
+          stride_depth(), stride_height(), stride_width(),
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          output_min, output_max,
+          padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0,
+          &max_pooling_op));
+      ASSERT_NE(nullptr, max_pooling_op);
+
+      // Smart pointer to automatically delete max_pooling_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_max_pooling_op(max_pooling_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_max_pooling3d_ndhwc_s8(
+          max_pooling_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(max_pooling_op, nullptr /* thread pool */));
+
+      Verify([&](size_t i) { return double(output[i]); }, output_ref, [](double) { return 0.0; });
+    }
+  }
+
+  void TestMaxPoolU8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> u8dist(
+      std::numeric_limits<uint8_t>::min(), std::numeric_limits<uint8_t>::max());
+
+    std::vector<uint8_t> input(XNN_EXTRA_BYTES / sizeof(uint8_t) + input_elements());
+    std::vector<uint8_t> output(output_elements());
+    std::vector<double> output_ref(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return u8dist(rng); });
+      std::fill(output.begin(), output.end(), UINT8_C(0xA5));
+
+      ComputeMaxReference([&](size_t i) { return double(input[i]); }, output_ref);
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(qmax())), double(qmin()));
+      }
+
+      // Create, setup, run, and destroy Max Pooling operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t max_pooling_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_max_pooling3d_ndhwc_u8(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          pooling_depth(), pooling_height(), pooling_width(),
+          stride_depth(), stride_height(), stride_width(),
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          qmin(), qmax(),
+          padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0,
+          &max_pooling_op));
+      ASSERT_NE(nullptr, max_pooling_op);
+
+      // Smart pointer to automatically delete max_pooling_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_max_pooling_op(max_pooling_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_max_pooling3d_ndhwc_u8(
+          max_pooling_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(max_pooling_op, nullptr /* thread pool */));
+
+      Verify([&](size_t i) { return double(output[i]); }, output_ref, [](double) { return 0.0; });
+    }
+  }
+
+  void TestMaxPoolF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    // Note: we need to avoid FP16 denormals in the generated tensor because they might be processed differently in
+    // native vs emulated arithmetics, and we use exact comparison to verify the results against reference.
+    std::uniform_real_distribution<float> f32dist(0.001f, 1.0f);
+
+    std::vector<uint16_t> input(XNN_EXTRA_BYTES / sizeof(uint16_t) + input_elements());
+    std::vector<uint16_t> output(output_elements());
+    std::vector<double> output_ref(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      ComputeMaxReference([&](size_t i) { return double(fp16_ieee_to_fp32_value(input[i])); }, output_ref);
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_range = accumulated_max - accumulated_min;
+      float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        float(accumulated_min + accumulated_range / 255.0 * double(qmin()))));
+      float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        float(accumulated_max - accumulated_range / 255.0 * double(255 - qmax()))));
+      if (accumulated_range == 0.0) {
+        output_min = -std::numeric_limits<float>::infinity();
+        output_max = +std::numeric_limits<float>::infinity();
+      }
+      if (qmin() == std::numeric_limits<uint8_t>::min()) {
+        output_min = -std::numeric_limits<float>::infinity();
+      }
+      if (qmax() == std::numeric_limits<uint8_t>::max()) {
+        output_max = +std::numeric_limits<float>::infinity();
+      }
+
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Max Pooling operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t max_pooling_op = nullptr;
+
+      const xnn_status status = xnn_create_max_pooling3d_ndhwc_f16(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          pooling_depth(), pooling_height(), pooling_width(),
+          stride_depth(), stride_height(), stride_width(),
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          output_min, output_max,
+          padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0,
+          &max_pooling_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, max_pooling_op);
+
+      // Smart pointer to automatically delete max_pooling_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_max_pooling_op(max_pooling_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_max_pooling3d_ndhwc_f16(
+          max_pooling_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(max_pooling_op, nullptr /* thread pool */));
+
+      Verify([&](size_t i) { return double(fp16_ieee_to_fp32_value(output[i])); }, output_ref, [](double) { return 0.0; });
+    }
+  }
+
+  void TestMaxPoolF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist;
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + input_elements());
+    std::vector<float> output(output_elements());
+    std::vector<double> output_ref(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      ComputeMaxReference([&](size_t i) { return double(input[i]); }, output_ref);
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        float(accumulated_min + accumulated_range / 255.0 * double(qmin()));
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        float(accumulated_max - accumulated_range / 255.0 * double(255 - qmax()));
+
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Max Pooling operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t max_pooling_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_max_pooling3d_ndhwc_f32(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          pooling_depth(), pooling_height(), pooling_width(),
+          stride_depth(), stride_height(), stride_width(),
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          output_min, output_max,
+          padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0,
+          &max_pooling_op));
+      ASSERT_NE(nullptr, max_pooling_op);
+
+      // Smart pointer to automatically delete max_pooling_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_max_pooling_op(max_pooling_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_max_pooling3d_ndhwc_f32(
+          max_pooling_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(max_pooling_op, nullptr /* thread pool */));
+
+      Verify([&](size_t i) { return double(output[i]); }, output_ref, [](double) { return 0.0; });
+    }
+  }
+
+  void TestAveragePoolF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist;
+
+    std::vector<float> input(XNN_EXTRA_BYTES / sizeof(float) + input_elements());
+    std::vector<float> output(output_elements());
+    std::vector<double> output_ref(output_pixels() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Padding elements are excluded from both the sum and the divisor.
+      ComputeAverageReference([&](size_t i) { return double(input[i]); }, output_ref);
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        float(accumulated_min + accumulated_range / 255.0 * double(qmin()));
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        float(accumulated_max - accumulated_range / 255.0 * double(255 - qmax()));
+
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Average Pooling operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t average_pooling_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_average_pooling3d_ndhwc_f32(
+          padding_tf_same() ? 0 : padding_front(), padding_tf_same() ? 0 : padding_back(),
+          padding_tf_same() ? 0 : padding_top(), padding_tf_same() ? 0 : padding_right(),
+          padding_tf_same() ? 0 : padding_bottom(), padding_tf_same() ? 0 : padding_left(),
+          pooling_depth(), pooling_height(), pooling_width(),
+          stride_depth(), stride_height(), stride_width(),
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          output_min, output_max,
+          padding_tf_same() ? XNN_FLAG_TENSORFLOW_SAME_PADDING : 0,
+          &average_pooling_op));
+      ASSERT_NE(nullptr, average_pooling_op);
+
+      // Smart pointer to automatically delete average_pooling_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_average_pooling_op(average_pooling_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_average_pooling3d_ndhwc_f32(
+          average_pooling_op,
+          batch_size(), input_depth(), input_height(), input_width(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(average_pooling_op, nullptr /* thread pool */));
+
+      Verify([&](size_t i) { return double(output[i]); }, output_ref,
+        [](double y) { return std::max(1.0e-6, std::abs(y) * 1.0e-5); });
+    }
+  }
+
+ private:
+  static inline uint32_t compute_tf_same_padding(size_t input_dimension, uint32_t pooling_dimension, uint32_t stride_dimension) {
+    const size_t output_dimension = (input_dimension + stride_dimension - 1) / stride_dimension;
+    const size_t padded_dimension = (output_dimension - 1) * stride_dimension + pooling_dimension;
+    return padded_dimension > input_dimension ? uint32_t(padded_dimension - input_dimension) : 0;
+  }
+
+  static inline size_t compute_output_dimension(size_t padded_input_dimension, uint32_t pooling_dimension, uint32_t stride_dimension) {
+    return (padded_input_dimension > pooling_dimension ? padded_input_dimension - pooling_dimension : 0) / stride_dimension + 1;
+  }
+
+  inline size_t output_pixels() const {
+    return batch_size() * output_depth() * output_height() * output_width();
+  }
+
+  inline size_t input_elements() const {
+    return (batch_size() * input_depth() * input_height() * input_width() - 1) * input_pixel_stride() + channels();
+  }
+
+  inline size_t output_elements() const {
+    return (output_pixels() - 1) * output_pixel_stride() + channels();
+  }
+
+  // Visits the input pixels within the pooling window of every output pixel, skipping padding, and stores
+  // reduce(window) into output_ref in [batch, output_depth, output_height, output_width, channels] layout.
+  template<class VisitFn>
+  void ForEachWindow(VisitFn visit) const {
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t oz = 0; oz < output_depth(); oz++) {
+        for (size_t oy = 0; oy < output_height(); oy++) {
+          for (size_t ox = 0; ox < output_width(); ox++) {
+            const size_t output_pixel = ((i * output_depth() + oz) * output_height() + oy) * output_width() + ox;
+            std::vector<size_t> window;
+            for (size_t pz = 0; pz < pooling_depth(); pz++) {
+              const size_t iz = oz * stride_depth() + pz - padding_front();
+              if (iz >= input_depth()) {
+                continue;
+              }
+              for (size_t py = 0; py < pooling_height(); py++) {
+                const size_t iy = oy * stride_height() + py - padding_top();
+                if (iy >= input_height()) {
+                  continue;
+                }
+                for (size_t px = 0; px < pooling_width(); px++) {
+                  const size_t ix = ox * stride_width() + px - padding_left();
+                  if (ix >= input_width()) {
+                    continue;
+                  }
+                  window.push_back(((i * input_depth() + iz) * input_height() + iy) * input_width() + ix);
+                }
+              }
+            }
+            visit(output_pixel, window);
+          }
+        }
+      }
+    }
+  }
+
+  template<class InputFn>
+  void ComputeMaxReference(InputFn input, std::vector<double>& output_ref) const {
+    ForEachWindow([&](size_t output_pixel, const std::vector<size_t>& window) {
+      for (size_t c = 0; c < channels(); c++) {
+        double max_value = -std::numeric_limits<double>::infinity();
+        for (size_t input_pixel : window) {
+          max_value = std::max(max_value, input(input_pixel * input_pixel_stride() + c));
+        }
+        output_ref[output_pixel * channels() + c] = max_value;
+      }
+    });
+  }
+
+  template<class InputFn>
+  void ComputeAverageReference(InputFn input, std::vector<double>& output_ref) const {
+    ForEachWindow([&](size_t output_pixel, const std::vector<size_t>& window) {
+      for (size_t c = 0; c < channels(); c++) {
+        double sum = 0.0;
+        for (size_t input_pixel : window) {
+          sum += input(input_pixel * input_pixel_stride() + c);
+        }
+        output_ref[output_pixel * channels() + c] = sum / double(window.size());
+      }
+    });
+  }
+
+  template<class OutputFn, class ToleranceFn>
+  void Verify(OutputFn output, const std::vector<double>& output_ref, ToleranceFn tolerance) const {
+    for (size_t p = 0; p < output_pixels(); p++) {
+      for (size_t c = 0; c < channels(); c++) {
+        const double y_ref = output_ref[p * channels() + c];
+        ASSERT_NEAR(output(p * output_pixel_stride() + c), y_ref, tolerance(y_ref))
+          << "output pixel " << p << " / " << output_pixels() << ", channel " << c << " / " << channels()
+          << ", pooling " << pooling_depth() << "x" << pooling_height() << "x" << pooling_width()
+          << ", stride " << stride_depth() << "x" << stride_height() << "x" << stride_width();
+      }
+    }
+  }
+
+  uint32_t padding_front_{0};
+  uint32_t padding_back_{0};
+  uint32_t padding_top_{0};
+  uint32_t padding_right_{0};
+  uint32_t padding_bottom_{0};
+  uint32_t padding_left_{0};
+  bool padding_tf_same_{false};
+  size_t input_depth_{1};
+  size_t input_height_{1};
+  size_t input_width_{1};
+  size_t channels_{1};
+  size_t batch_size_{1};
+  size_t input_pixel_stride_{0};
+  size_t output_pixel_stride_{0};
+  uint32_t pooling_depth_{1};
+  uint32_t pooling_height_{1};
+  uint32_t pooling_width_{1};
+  uint32_t stride_depth_{1};
+  uint32_t stride_height_{1};
+  uint32_t stride_width_{1};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{1};
+};
@@ -0,0 +1,1248 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/gemm.h>
+#include "gemm-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, k_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, k_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, k_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, k_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, k_gt_256) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, n_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 1; n < 4; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, m_eq_1) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(4)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE2, strided_cm) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(41)
+      .cm_stride(7)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse2);
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, k_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(3)
+      .n(4)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, k_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, k_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, k_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, k_gt_256) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, n_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t n = 1; n < 4; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(3)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, m_lt_3) {
+    TEST_REQUIRES_X86_SSE2;
+    for (uint32_t m = 1; m <= 3; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(4)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE2, strided_cm) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(3)
+      .n(4)
+      .k(41)
+      .cm_stride(7)
+      .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse2);
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, k_eq_8) {
+    TEST_REQUIRES_X86_SSE41;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, k_lt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, k_gt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, k_div_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, k_gt_256) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, n_lt_4) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t n = 1; n < 4; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, m_eq_1) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(4)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, strided_a) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(4)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X4C8__SSE41, strided_cm) {
+    TEST_REQUIRES_X86_SSE41;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(4)
+      .k(41)
+      .cm_stride(7)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x4c8__sse41);
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, k_eq_8) {
+    TEST_REQUIRES_X86_SSE41;
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, k_lt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, k_gt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, k_div_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, k_gt_256) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, n_lt_4) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t n = 1; n < 4; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(2)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, m_lt_2) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t m = 1; m <= 2; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(2)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(4)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, strided_a) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(2)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(2)
+        .n(4)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_2X4C8__SSE41, strided_cm) {
+    TEST_REQUIRES_X86_SSE41;
+    GemmMicrokernelTester()
+      .mr(2)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(2)
+      .n(4)
+      .k(41)
+      .cm_stride(7)
+      .Test(xnn_qs8_gemm_acc32_ukernel_2x4c8__sse41);
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, k_eq_8) {
+    TEST_REQUIRES_X86_SSE41;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(3)
+      .n(4)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, k_lt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, k_gt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, k_div_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, k_gt_256) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, n_lt_4) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t n = 1; n < 4; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(3)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, m_lt_3) {
+    TEST_REQUIRES_X86_SSE41;
+    for (uint32_t m = 1; m <= 3; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(4)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(4)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, strided_a) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(4)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(4)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X4C8__SSE41, strided_cm) {
+    TEST_REQUIRES_X86_SSE41;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(4)
+      .kr(8)
+      .sr(1)
+      .m(3)
+      .n(4)
+      .k(41)
+      .cm_stride(7)
+      .Test(xnn_qs8_gemm_acc32_ukernel_3x4c8__sse41);
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, k_eq_8) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, k_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, k_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, k_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, k_gt_256) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, n_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n < 8; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(8)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, m_eq_1) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(8)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(8)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X8C8__AVX2, strided_cm) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(8)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(8)
+      .k(41)
+      .cm_stride(11)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x8c8__avx2);
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, k_eq_8) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(8)
+      .kr(8)
+      .sr(1)
+      .m(3)
+      .n(8)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, k_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, k_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, k_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, k_gt_256) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, n_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t n = 1; n < 8; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(8)
+          .kr(8)
+          .sr(1)
+          .m(3)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, m_lt_3) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t m = 1; m <= 3; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(3)
+          .nr(8)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(8)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, strided_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(3)
+        .nr(8)
+        .kr(8)
+        .sr(1)
+        .m(3)
+        .n(8)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_3X8C8__AVX2, strided_cm) {
+    TEST_REQUIRES_X86_AVX2;
+    GemmMicrokernelTester()
+      .mr(3)
+      .nr(8)
+      .kr(8)
+      .sr(1)
+      .m(3)
+      .n(8)
+      .k(41)
+      .cm_stride(11)
+      .Test(xnn_qs8_gemm_acc32_ukernel_3x8c8__avx2);
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, k_eq_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, k_lt_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, k_gt_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, k_div_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, k_gt_256) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, n_lt_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (uint32_t n = 1; n < 16; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(8)
+          .sr(1)
+          .m(1)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, m_eq_1) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (uint32_t m = 1; m <= 1; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(1)
+          .nr(16)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(16)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, strided_a) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(1)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(1)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_1X16C8__AVX512SKX, strided_cm) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    GemmMicrokernelTester()
+      .mr(1)
+      .nr(16)
+      .kr(8)
+      .sr(1)
+      .m(1)
+      .n(16)
+      .k(41)
+      .cm_stride(19)
+      .Test(xnn_qs8_gemm_acc32_ukernel_1x16c8__avx512skx);
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, k_eq_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(8)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(8)
+      .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, k_lt_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 1; k < 8; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, k_gt_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, k_div_8) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 16; k <= 80; k += 8) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, k_gt_256) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 257; k <= 1031; k += 258) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, n_lt_16) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (uint32_t n = 1; n < 16; n++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(8)
+          .sr(1)
+          .m(4)
+          .n(n)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, m_lt_4) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (uint32_t m = 1; m <= 4; m++) {
+      for (size_t k = 1; k <= 40; k += 9) {
+        GemmMicrokernelTester()
+          .mr(4)
+          .nr(16)
+          .kr(8)
+          .sr(1)
+          .m(m)
+          .n(16)
+          .k(k)
+          .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+      }
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, strided_a) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    for (size_t k = 1; k <= 40; k += 9) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(16)
+        .kr(8)
+        .sr(1)
+        .m(4)
+        .n(16)
+        .k(k)
+        .a_stride(43)
+        .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+    }
+  }
+
+  TEST(QS8_GEMM_ACC32_4X16C8__AVX512SKX, strided_cm) {
+    TEST_REQUIRES_X86_AVX512SKX;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(16)
+      .kr(8)
+      .sr(1)
+      .m(4)
+      .n(16)
+      .k(41)
+      .cm_stride(19)
+      .Test(xnn_qs8_gemm_acc32_ukernel_4x16c8__avx512skx);
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
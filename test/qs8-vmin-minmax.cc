@@ -0,0 +1,607 @@
+// Copyright 2019 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+//
+// Auto-generated file. Do not edit!
+//   Specification: test/qs8-vmin-minmax.yaml
+//   Generator: tools/generate-vbinary-test.py
+
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/params-init.h>
+#include <xnnpack/vbinary.h>
+#include "vbinary-microkernel-tester.h"
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, batch_eq_8) {
+    TEST_REQUIRES_X86_SSE41;
+    VBinaryMicrokernelTester()
+      .batch_size(8)
+      .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, batch_div_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 16; batch_size < 80; batch_size += 8) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, batch_lt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size < 8; batch_size++) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, batch_gt_8) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 9; batch_size < 16; batch_size++) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, inplace_a) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace_a(true)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, inplace_b) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace_b(true)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, inplace_a_and_b) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace_a(true)
+        .inplace_b(true)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, a_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      for (int32_t a_zero_point = -128; a_zero_point <= 127; a_zero_point += 51) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .a_zero_point(a_zero_point)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, b_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      for (int32_t b_zero_point = -128; b_zero_point <= 127; b_zero_point += 51) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .b_zero_point(b_zero_point)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, y_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      for (int32_t y_zero_point = -128; y_zero_point <= 127; y_zero_point += 51) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .y_zero_point(y_zero_point)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, a_scale) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      for (float a_scale = 0.1f; a_scale <= 10.0f; a_scale *= 3.14f) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .a_scale(a_scale)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, b_scale) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      for (float b_scale = 0.1f; b_scale <= 10.0f; b_scale *= 3.14f) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .b_scale(b_scale)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, y_scale) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      for (float y_scale = 0.1f; y_scale <= 10.0f; y_scale *= 3.14f) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .y_scale(y_scale)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, qmin) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .qmin(128)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X8, qmax) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 40; batch_size += 7) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .qmax(128)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x8, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, batch_eq_16) {
+    TEST_REQUIRES_X86_SSE41;
+    VBinaryMicrokernelTester()
+      .batch_size(16)
+      .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, batch_div_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 32; batch_size < 160; batch_size += 16) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, batch_lt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size < 16; batch_size++) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, batch_gt_16) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 17; batch_size < 32; batch_size++) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, inplace_a) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace_a(true)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, inplace_b) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace_b(true)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, inplace_a_and_b) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .inplace_a(true)
+        .inplace_b(true)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, a_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      for (int32_t a_zero_point = -128; a_zero_point <= 127; a_zero_point += 51) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .a_zero_point(a_zero_point)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, b_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      for (int32_t b_zero_point = -128; b_zero_point <= 127; b_zero_point += 51) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .b_zero_point(b_zero_point)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, y_zero_point) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      for (int32_t y_zero_point = -128; y_zero_point <= 127; y_zero_point += 51) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .y_zero_point(y_zero_point)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, a_scale) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      for (float a_scale = 0.1f; a_scale <= 10.0f; a_scale *= 3.14f) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .a_scale(a_scale)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, b_scale) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      for (float b_scale = 0.1f; b_scale <= 10.0f; b_scale *= 3.14f) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .b_scale(b_scale)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, y_scale) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      for (float y_scale = 0.1f; y_scale <= 10.0f; y_scale *= 3.14f) {
+        VBinaryMicrokernelTester()
+          .batch_size(batch_size)
+          .y_scale(y_scale)
+          .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+      }
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, qmin) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .qmin(128)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+
+  TEST(QS8_VMIN_MINMAX__SSE41_X16, qmax) {
+    TEST_REQUIRES_X86_SSE41;
+    for (size_t batch_size = 1; batch_size <= 80; batch_size += 15) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .qmax(128)
+        .Test(xnn_qs8_vmin_minmax_ukernel__sse41_x16, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_sse4_params);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, batch_eq_1) {
+  VBinaryMicrokernelTester()
+    .batch_size(1)
+    .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, batch_gt_1) {
+  for (size_t batch_size = 2; batch_size < 10; batch_size++) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, inplace_a) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace_a(true)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, inplace_b) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace_b(true)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, inplace_a_and_b) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace_a(true)
+      .inplace_b(true)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, a_zero_point) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    for (int32_t a_zero_point = -128; a_zero_point <= 127; a_zero_point += 51) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .a_zero_point(a_zero_point)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, b_zero_point) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    for (int32_t b_zero_point = -128; b_zero_point <= 127; b_zero_point += 51) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .b_zero_point(b_zero_point)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, y_zero_point) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    for (int32_t y_zero_point = -128; y_zero_point <= 127; y_zero_point += 51) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .y_zero_point(y_zero_point)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, a_scale) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    for (float a_scale = 0.1f; a_scale <= 10.0f; a_scale *= 3.14f) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .a_scale(a_scale)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, b_scale) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    for (float b_scale = 0.1f; b_scale <= 10.0f; b_scale *= 3.14f) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .b_scale(b_scale)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, y_scale) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    for (float y_scale = 0.1f; y_scale <= 10.0f; y_scale *= 3.14f) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .y_scale(y_scale)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, qmin) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .qmin(128)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X1, qmax) {
+  for (size_t batch_size = 1; batch_size <= 5; batch_size += 1) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .qmax(128)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x1, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, batch_eq_4) {
+  VBinaryMicrokernelTester()
+    .batch_size(4)
+    .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, batch_div_4) {
+  for (size_t batch_size = 8; batch_size < 40; batch_size += 4) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, batch_lt_4) {
+  for (size_t batch_size = 1; batch_size < 4; batch_size++) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, batch_gt_4) {
+  for (size_t batch_size = 5; batch_size < 8; batch_size++) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, inplace_a) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace_a(true)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, inplace_b) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace_b(true)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, inplace_a_and_b) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .inplace_a(true)
+      .inplace_b(true)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, a_zero_point) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    for (int32_t a_zero_point = -128; a_zero_point <= 127; a_zero_point += 51) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .a_zero_point(a_zero_point)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, b_zero_point) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    for (int32_t b_zero_point = -128; b_zero_point <= 127; b_zero_point += 51) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .b_zero_point(b_zero_point)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, y_zero_point) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    for (int32_t y_zero_point = -128; y_zero_point <= 127; y_zero_point += 51) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .y_zero_point(y_zero_point)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, a_scale) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    for (float a_scale = 0.1f; a_scale <= 10.0f; a_scale *= 3.14f) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .a_scale(a_scale)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, b_scale) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    for (float b_scale = 0.1f; b_scale <= 10.0f; b_scale *= 3.14f) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .b_scale(b_scale)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, y_scale) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    for (float y_scale = 0.1f; y_scale <= 10.0f; y_scale *= 3.14f) {
+      VBinaryMicrokernelTester()
+        .batch_size(batch_size)
+        .y_scale(y_scale)
+        .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+    }
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, qmin) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .qmin(128)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
+
+TEST(QS8_VMIN_MINMAX__SCALAR_X4, qmax) {
+  for (size_t batch_size = 1; batch_size <= 20; batch_size += 3) {
+    VBinaryMicrokernelTester()
+      .batch_size(batch_size)
+      .qmax(128)
+      .Test(xnn_qs8_vmin_minmax_ukernel__scalar_x4, VBinaryMicrokernelTester::OpType::Min, xnn_init_qs8_binary_minmax_scalar_params);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
+#include <xnnpack/lut.h>
+#include "softmax-microkernel-tester.h"
+
+
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(QU8_SOFTMAX__NEON, n_eq_1) {
+    TEST_REQUIRES_ARM_NEON;
+    SoftmaxMicrokernelTester()
+      .n(1)
+      .Test(xnn_qu8_softmax_ukernel__neon);
+  }
+
+  TEST(QU8_SOFTMAX__NEON, small_n) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 2; n <= 16; n++) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_qu8_softmax_ukernel__neon);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__NEON, large_n) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n <= 128; n+=2) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_qu8_softmax_ukernel__neon);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__NEON, n_eq_1_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    SoftmaxMicrokernelTester()
+      .n(1)
+      .inplace(true)
+      .Test(xnn_qu8_softmax_ukernel__neon);
+  }
+
+  TEST(QU8_SOFTMAX__NEON, small_n_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 2; n <= 16; n++) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_qu8_softmax_ukernel__neon);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__NEON, large_n_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n <= 128; n+=2) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_qu8_softmax_ukernel__neon);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__NEON, input_scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (float input_scale : {0.001f, 0.01f, 0.1f, 1.0f, 10.0f}) {
+      for (size_t n = 1; n <= 80; n += 3) {
+        SoftmaxMicrokernelTester()
+          .n(n)
+          .input_scale(input_scale)
+          .Test(xnn_qu8_softmax_ukernel__neon);
+      }
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(QU8_SOFTMAX__AVX2, n_eq_1) {
+    TEST_REQUIRES_X86_AVX2;
+    SoftmaxMicrokernelTester()
+      .n(1)
+      .Test(xnn_qu8_softmax_ukernel__avx2);
+  }
+
+  TEST(QU8_SOFTMAX__AVX2, small_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n <= 16; n++) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_qu8_softmax_ukernel__avx2);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__AVX2, large_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n <= 128; n+=2) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .Test(xnn_qu8_softmax_ukernel__avx2);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__AVX2, n_eq_1_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    SoftmaxMicrokernelTester()
+      .n(1)
+      .inplace(true)
+      .Test(xnn_qu8_softmax_ukernel__avx2);
+  }
+
+  TEST(QU8_SOFTMAX__AVX2, small_n_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n <= 16; n++) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_qu8_softmax_ukernel__avx2);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__AVX2, large_n_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n <= 128; n+=2) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_qu8_softmax_ukernel__avx2);
+    }
+  }
+
+  TEST(QU8_SOFTMAX__AVX2, input_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (float input_scale : {0.001f, 0.01f, 0.1f, 1.0f, 10.0f}) {
+      for (size_t n = 1; n <= 80; n += 3) {
+        SoftmaxMicrokernelTester()
+          .n(n)
+          .input_scale(input_scale)
+          .Test(xnn_qu8_softmax_ukernel__avx2);
+      }
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
+TEST(QU8_SOFTMAX__SCALAR, n_eq_1) {
+  SoftmaxMicrokernelTester()
+    .n(1)
+    .Test(xnn_qu8_softmax_ukernel__scalar);
+}
+
+TEST(QU8_SOFTMAX__SCALAR, small_n) {
+  for (size_t n = 2; n <= 16; n++) {
+    SoftmaxMicrokernelTester()
+      .n(n)
+      .Test(xnn_qu8_softmax_ukernel__scalar);
+  }
+}
+
+TEST(QU8_SOFTMAX__SCALAR, large_n) {
+  for (size_t n = 16; n <= 128; n+=2) {
+    SoftmaxMicrokernelTester()
+      .n(n)
+      .Test(xnn_qu8_softmax_ukernel__scalar);
+  }
+}
+
+TEST(QU8_SOFTMAX__SCALAR, n_eq_1_inplace) {
+  SoftmaxMicrokernelTester()
+    .n(1)
+    .inplace(true)
+    .Test(xnn_qu8_softmax_ukernel__scalar);
+}
+
+TEST(QU8_SOFTMAX__SCALAR, small_n_inplace) {
+  for (size_t n = 2; n <= 16; n++) {
+    SoftmaxMicrokernelTester()
+      .n(n)
+      .inplace(true)
+      .Test(xnn_qu8_softmax_ukernel__scalar);
+  }
+}
+
+TEST(QU8_SOFTMAX__SCALAR, large_n_inplace) {
+  for (size_t n = 16; n <= 128; n+=2) {
+    SoftmaxMicrokernelTester()
+      .n(n)
+      .inplace(true)
+      .Test(xnn_qu8_softmax_ukernel__scalar);
+  }
+}
+
+TEST(QU8_SOFTMAX__SCALAR, input_scale) {
+  for (float input_scale : {0.001f, 0.01f, 0.1f, 1.0f, 10.0f}) {
+    for (size_t n = 1; n <= 80; n += 3) {
+      SoftmaxMicrokernelTester()
+        .n(n)
+        .input_scale(input_scale)
+        .Test(xnn_qu8_softmax_ukernel__scalar);
+    }
+  }
+}
@@ -0,0 +1,188 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+#include <xnnpack/params.h>
+
+
+class ReduceMicrokernelTester {
+ public:
+  enum class OpType {
+    MinMax,
+    Moments,
+    Sum,
+  };
+
+  inline ReduceMicrokernelTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline ReduceMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f16_rsum_ukernel_function reduce, OpType op_type = OpType::Sum) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<uint16_t> input(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+
+      // Call optimized micro-kernel.
+      float output[2] = { std::nanf(""), std::nanf("") };
+      reduce(batch_size() * sizeof(uint16_t), input.data(), output);
+
+      // Compute reference results and verify.
+      switch (op_type) {
+        case OpType::Moments:
+        {
+          double sum = 0.0;
+          double sum_squares = 0.0;
+          for (size_t i = 0; i < batch_size(); i++) {
+            const double x = fp16_ieee_to_fp32_value(input[i]);
+            sum += x;
+            sum_squares += x * x;
+          }
+          const double mean_ref = sum / double(batch_size());
+          const double variance_ref = std::max(sum_squares / double(batch_size()) - mean_ref * mean_ref, 0.0);
+          ASSERT_NEAR(output[0], mean_ref, 2.0 * std::numeric_limits<float>::epsilon() * batch_size())
+            << "batch " << batch_size();
+          ASSERT_NEAR(output[1], variance_ref, 2.0 * std::numeric_limits<float>::epsilon() * batch_size())
+            << "batch " << batch_size();
+          break;
+        }
+        case OpType::Sum:
+        {
+          double output_ref = 0.0;
+          double output_abs = 0.0;
+          for (size_t i = 0; i < batch_size(); i++) {
+            const double x = fp16_ieee_to_fp32_value(input[i]);
+            output_ref += x;
+            output_abs += std::abs(x);
+          }
+          ASSERT_NEAR(output[0], output_ref, output_abs * std::numeric_limits<float>::epsilon() * batch_size())
+            << "batch " << batch_size();
+          break;
+        }
+        default:
+          GTEST_FAIL() << "unsupported operation type";
+      }
+    }
+  }
+
+  void Test(xnn_f32_rsum_ukernel_function reduce, OpType op_type) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<float> input(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+
+      // Call optimized micro-kernel.
+      float output[2] = { std::nanf(""), std::nanf("") };
+      reduce(batch_size() * sizeof(float), input.data(), output);
+
+      // Compute reference results and verify.
+      switch (op_type) {
+        case OpType::MinMax:
+        {
+          const auto minmax = std::minmax_element(input.cbegin(), input.cbegin() + batch_size());
+          ASSERT_EQ(output[0], *minmax.first)
+            << "batch " << batch_size();
+          ASSERT_EQ(output[1], *minmax.second)
+            << "batch " << batch_size();
+          break;
+        }
+        case OpType::Moments:
+        {
+          double sum = 0.0;
+          double sum_squares = 0.0;
+          for (size_t i = 0; i < batch_size(); i++) {
+            sum += double(input[i]);
+            sum_squares += double(input[i]) * double(input[i]);
+          }
+          const double mean_ref = sum / double(batch_size());
+          const double variance_ref = std::max(sum_squares / double(batch_size()) - mean_ref * mean_ref, 0.0);
+          ASSERT_NEAR(output[0], mean_ref, 2.0 * std::numeric_limits<float>::epsilon() * batch_size())
+            << "batch " << batch_size();
+          ASSERT_NEAR(output[1], variance_ref, 2.0 * std::numeric_limits<float>::epsilon() * batch_size())
+            << "batch " << batch_size();
+          break;
+        }
+        case OpType::Sum:
+        {
+          double output_ref = 0.0;
+          double output_abs = 0.0;
+          for (size_t i = 0; i < batch_size(); i++) {
+            output_ref += double(input[i]);
+            output_abs += std::abs(double(input[i]));
+          }
+          ASSERT_NEAR(output[0], output_ref, output_abs * std::numeric_limits<float>::epsilon() * batch_size())
+            << "batch " << batch_size();
+          break;
+        }
+      }
+    }
+  }
+
+  void Test(xnn_qs8_rsum_ukernel_function rsum) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+
+    std::vector<int8_t> input(batch_size() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+
+      // Compute reference results.
+      int32_t output_ref = 0;
+      for (size_t i = 0; i < batch_size(); i++) {
+        output_ref += int32_t(input[i]);
+      }
+
+      // Call optimized micro-kernel.
+      int32_t output = INT32_C(0xDEADBEEF);
+      rsum(batch_size() * sizeof(int8_t), input.data(), &output);
+
+      // Verify results.
+      ASSERT_EQ(output, output_ref)
+        << "batch " << batch_size();
+    }
+  }
+
+ private:
+  size_t batch_size_{1};
+  size_t iterations_{15};
+};
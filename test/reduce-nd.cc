@@ -0,0 +1,939 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "reduce-operator-tester.h"
+
+
+namespace {
+
+// Reduction axes for each of the 2**num_dims subsets of dimensions.
+std::vector<size_t> ReductionAxes(size_t num_dims, uint32_t mask) {
+  std::vector<size_t> reduction_axes;
+  for (size_t i = 0; i < num_dims; i++) {
+    if (mask & (UINT32_C(1) << i)) {
+      reduction_axes.push_back(i);
+    }
+  }
+  return reduction_axes;
+}
+
+const std::vector<size_t> kShape6D = {3, 2, 5, 4, 3, 7};
+
+}  // namespace
+
+TEST(REDUCE_SUM_ND_F16, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F16, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_sum)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestF16();
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F16, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_mean)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestF16();
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestF16();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F16, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_max)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestF16();
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_SUM_ND_F32, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_sum)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_F32, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_mean)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestF32();
+  }
+}
+
+TEST(REDUCE_MAX_ND_F32, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_max)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestF32();
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_sum)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_SUM_ND_QS8, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_sum)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestQS8();
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_mean)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MEAN_ND_QS8, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_mean)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestQS8();
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_1d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 1, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 1); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(1, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_2d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 2, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 2); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(2, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_3d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 3, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 3); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(3, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_4d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 4, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 4); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(4, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_5d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 5, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 5); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(5, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_6d) {
+  const std::vector<size_t> input_shape(kShape6D.end() - 6, kShape6D.end());
+  for (uint32_t mask = 0; mask < (UINT32_C(1) << 6); mask++) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape(input_shape)
+      .reduction_axes(ReductionAxes(6, mask))
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_inner_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape({5, channels})
+      .reduction_axes({1})
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_outer_dim) {
+  for (size_t channels = 1; channels <= 100; channels += 3) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape({5, channels})
+      .reduction_axes({0})
+      .TestQS8();
+  }
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_unit_dims) {
+  ReduceOperatorTester()
+    .reduce_operator(xnn_reduce_max)
+    .input_shape({1, 7, 1, 11})
+    .reduction_axes({0, 2})
+    .TestQS8();
+}
+
+TEST(REDUCE_MAX_ND_QS8, reduce_long_rows) {
+  for (size_t channels = 250; channels <= 800; channels += 25) {
+    ReduceOperatorTester()
+      .reduce_operator(xnn_reduce_max)
+      .input_shape({3, channels})
+      .reduction_axes({1})
+      .TestQS8();
+  }
+}
@@ -0,0 +1,83 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/normalization.h>
+
+
+namespace {
+
+void TestNormalizeReduction(
+  std::vector<size_t> reduction_axes,
+  std::vector<size_t> input_shape,
+  std::vector<size_t> expected_reduction_axes,
+  std::vector<size_t> expected_input_shape)
+{
+  size_t num_reduction_axes = reduction_axes.size();
+  size_t num_input_dims = input_shape.size();
+  reduction_axes.resize(XNN_MAX_TENSOR_DIMS);
+  input_shape.resize(XNN_MAX_TENSOR_DIMS);
+  xnn_normalize_reduction(&num_reduction_axes, reduction_axes.data(), &num_input_dims, input_shape.data());
+
+  ASSERT_EQ(expected_reduction_axes.size(), num_reduction_axes);
+  ASSERT_EQ(expected_input_shape.size(), num_input_dims);
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    EXPECT_EQ(expected_reduction_axes[i], reduction_axes[i]) << "reduction axis #" << i;
+  }
+  for (size_t i = 0; i < num_input_dims; i++) {
+    EXPECT_EQ(expected_input_shape[i], input_shape[i]) << "dimension #" << i;
+  }
+}
+
+}  // namespace
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_all_1D) {
+  TestNormalizeReduction({0}, {37}, {0}, {37});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_all_3D) {
+  TestNormalizeReduction({0, 1, 2}, {3, 5, 7}, {0}, {3 * 5 * 7});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_none) {
+  TestNormalizeReduction({}, {3, 5, 7}, {}, {3 * 5 * 7});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_inner_2D) {
+  TestNormalizeReduction({1}, {11, 13}, {1}, {11, 13});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, reduce_outer_2D) {
+  TestNormalizeReduction({0}, {11, 13}, {0}, {11, 13});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, merge_reduced_dims) {
+  TestNormalizeReduction({1, 2}, {3, 5, 7, 11}, {1}, {3, 5 * 7, 11});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, merge_kept_dims) {
+  TestNormalizeReduction({2}, {3, 5, 7, 11}, {1}, {3 * 5, 7, 11});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, alternating_dims) {
+  TestNormalizeReduction({0, 2, 4}, {2, 3, 5, 7, 11, 13}, {0, 2, 4}, {2, 3, 5, 7, 11, 13});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, drop_unit_dims) {
+  TestNormalizeReduction({1, 3}, {5, 1, 7, 1}, {}, {5 * 7});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, drop_unit_dims_and_merge) {
+  TestNormalizeReduction({0, 2}, {5, 1, 7, 11}, {0}, {5 * 7, 11});
+}
+
+TEST(REDUCE_NORMALIZATION_TEST, all_unit_dims) {
+  TestNormalizeReduction({0, 1}, {1, 1, 1}, {}, {});
+}
@@ -0,0 +1,333 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class ReduceOperatorTester {
+ public:
+  inline ReduceOperatorTester& reduce_operator(xnn_reduce_operator reduce_operator) {
+    this->reduce_operator_ = reduce_operator;
+    return *this;
+  }
+
+  inline xnn_reduce_operator reduce_operator() const {
+    return this->reduce_operator_;
+  }
+
+  inline ReduceOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline ReduceOperatorTester& input_shape(const std::vector<size_t>& input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = input_shape;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return this->input_shape_;
+  }
+
+  inline size_t num_input_dims() const {
+    return this->input_shape_.size();
+  }
+
+  inline size_t num_input_elements() const {
+    return std::accumulate(
+      this->input_shape_.begin(), this->input_shape_.end(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline ReduceOperatorTester& reduction_axes(std::initializer_list<size_t> reduction_axes) {
+    assert(reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->reduction_axes_ = std::vector<size_t>(reduction_axes);
+    return *this;
+  }
+
+  inline ReduceOperatorTester& reduction_axes(const std::vector<size_t>& reduction_axes) {
+    assert(reduction_axes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->reduction_axes_ = reduction_axes;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& reduction_axes() const {
+    return this->reduction_axes_;
+  }
+
+  inline size_t num_reduction_axes() const {
+    return this->reduction_axes_.size();
+  }
+
+  inline ReduceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(min_input(), 1.0f);
+
+    std::vector<size_t> output_shape;
+    const size_t num_output_elements = ComputeOutputShape(output_shape);
+    std::vector<uint16_t> input(num_input_elements() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> output(num_output_elements);
+    std::vector<double> output_ref(num_output_elements);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      ComputeReference([&](size_t i) { return double(fp16_ieee_to_fp32_value(input[i])); }, output_ref);
+
+      // Create, setup, run, and destroy Reduce operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      const xnn_status status = xnn_create_reduce_nd_f16(reduce_operator(), 0, &reduce_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_reduce_nd_f16(
+          reduce_op,
+          num_reduction_axes(), reduction_axes().data(),
+          num_input_dims(), input_shape().data(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < num_output_elements; i++) {
+        ASSERT_NEAR(
+            fp16_ieee_to_fp32_value(output[i]),
+            output_ref[i],
+            std::max(1.0e-3, std::abs(output_ref[i]) * 1.0e-2))
+          << "output element " << i << " / " << num_output_elements;
+      }
+    }
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(min_input(), 1.0f);
+
+    std::vector<size_t> output_shape;
+    const size_t num_output_elements = ComputeOutputShape(output_shape);
+    std::vector<float> input(num_input_elements() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output(num_output_elements);
+    std::vector<double> output_ref(num_output_elements);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      ComputeReference([&](size_t i) { return double(input[i]); }, output_ref);
+
+      // Create, setup, run, and destroy Reduce operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, xnn_create_reduce_nd_f32(reduce_operator(), 0, &reduce_op));
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_reduce_nd_f32(
+          reduce_op,
+          num_reduction_axes(), reduction_axes().data(),
+          num_input_dims(), input_shape().data(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < num_output_elements; i++) {
+        ASSERT_NEAR(
+            output[i],
+            output_ref[i],
+            std::max(1.0e-6, std::abs(output_ref[i]) * 1.0e-5))
+          << "output element " << i << " / " << num_output_elements;
+      }
+    }
+  }
+
+  void TestQS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+
+    std::vector<size_t> output_shape;
+    const size_t num_output_elements = ComputeOutputShape(output_shape);
+    std::vector<int8_t> input(num_input_elements() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> output(num_output_elements);
+    std::vector<double> output_ref(num_output_elements);
+
+    const int8_t input_zero_point = -3;
+    const float input_scale = 0.5f;
+    const int8_t output_zero_point = 5;
+    // Sums of many elements are scaled down to stay mostly within the quantized range.
+    const size_t num_reduced_elements = num_input_elements() / num_output_elements;
+    const float output_scale = reduce_operator() == xnn_reduce_sum ?
+      input_scale * std::min(std::sqrt(float(num_reduced_elements)), 255.0f) : 0.75f;
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::fill(output.begin(), output.end(), INT8_C(0xA5));
+
+      // Compute reference results.
+      ComputeReference(
+        [&](size_t i) { return double(input_scale) * double(int32_t(input[i]) - int32_t(input_zero_point)); },
+        output_ref);
+      for (double& y : output_ref) {
+        y = y / double(output_scale) + double(output_zero_point);
+        y = std::min(std::max(y, double(std::numeric_limits<int8_t>::min())), double(std::numeric_limits<int8_t>::max()));
+      }
+
+      // Create, setup, run, and destroy Reduce operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t reduce_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_reduce_nd_qs8(
+          reduce_operator(),
+          input_zero_point, input_scale,
+          output_zero_point, output_scale,
+          0, &reduce_op));
+      ASSERT_NE(nullptr, reduce_op);
+
+      // Smart pointer to automatically delete reduce_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_reduce_op(reduce_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_reduce_nd_qs8(
+          reduce_op,
+          num_reduction_axes(), reduction_axes().data(),
+          num_input_dims(), input_shape().data(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(reduce_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < num_output_elements; i++) {
+        ASSERT_NEAR(double(output[i]), output_ref[i], 0.6)
+          << "output element " << i << " / " << num_output_elements;
+      }
+    }
+  }
+
+ private:
+  // Sum and mean of positive inputs avoid catastrophic cancellation in the reference comparison.
+  float min_input() const {
+    return reduce_operator() == xnn_reduce_max ? -1.0f : 0.01f;
+  }
+
+  bool IsReductionAxis(size_t axis) const {
+    return std::find(reduction_axes().begin(), reduction_axes().end(), axis) != reduction_axes().end();
+  }
+
+  size_t ComputeOutputShape(std::vector<size_t>& output_shape) const {
+    output_shape.clear();
+    for (size_t i = 0; i < num_input_dims(); i++) {
+      if (!IsReductionAxis(i)) {
+        output_shape.push_back(input_shape()[i]);
+      }
+    }
+    return std::accumulate(output_shape.begin(), output_shape.end(), size_t(1), std::multiplies<size_t>());
+  }
+
+  void ComputeReference(std::function<double(size_t)> input_value, std::vector<double>& output_ref) const {
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_dims;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_strides;
+    std::fill(input_dims.begin(), input_dims.end(), 1);
+    std::fill(output_strides.begin(), output_strides.end(), 0);
+    const size_t num_padding_dims = XNN_MAX_TENSOR_DIMS - num_input_dims();
+    std::copy(input_shape().begin(), input_shape().end(), input_dims.begin() + num_padding_dims);
+    size_t output_stride = 1;
+    for (size_t i = num_input_dims(); i != 0; i--) {
+      if (!IsReductionAxis(i - 1)) {
+        output_strides[num_padding_dims + i - 1] = output_stride;
+        output_stride *= input_shape()[i - 1];
+      }
+    }
+
+    const double initial_value = reduce_operator() == xnn_reduce_max ? -std::numeric_limits<double>::infinity() : 0.0;
+    std::fill(output_ref.begin(), output_ref.end(), initial_value);
+    size_t input_index = 0;
+    for (size_t i0 = 0; i0 < input_dims[0]; i0++) {
+      for (size_t i1 = 0; i1 < input_dims[1]; i1++) {
+        for (size_t i2 = 0; i2 < input_dims[2]; i2++) {
+          for (size_t i3 = 0; i3 < input_dims[3]; i3++) {
+            for (size_t i4 = 0; i4 < input_dims[4]; i4++) {
+              for (size_t i5 = 0; i5 < input_dims[5]; i5++) {
+                const size_t output_index =
+                  i0 * output_strides[0] + i1 * output_strides[1] + i2 * output_strides[2] +
+                  i3 * output_strides[3] + i4 * output_strides[4] + i5 * output_strides[5];
+                const double x = input_value(input_index++);
+                if (reduce_operator() == xnn_reduce_max) {
+                  output_ref[output_index] = std::max(output_ref[output_index], x);
+                } else {
+                  output_ref[output_index] += x;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+    if (reduce_operator() == xnn_reduce_mean) {
+      const double num_reduced_elements = double(num_input_elements()) / double(output_ref.size());
+      for (double& y : output_ref) {
+        y /= num_reduced_elements;
+      }
+    }
+  }
+
+  xnn_reduce_operator reduce_operator_{xnn_reduce_sum};
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> reduction_axes_;
+  size_t iterations_{3};
+};
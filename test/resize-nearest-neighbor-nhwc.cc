@@ -0,0 +1,1297 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "resize-nearest-neighbor-operator-tester.h"
+
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_corners_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_corners_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_corners_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_corners_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_corners_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, aligned_corners_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, tf_mode_aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, tf_mode_aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, tf_mode_aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, tf_mode_aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, tf_mode_aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, tf_mode_aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF16();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, varying_channels) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 1; channels <= 19; channels += 3) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .iterations(3)
+          .TestNHWCxF16();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, with_input_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .input_pixel_stride(23)
+          .iterations(3)
+          .TestNHWCxF16();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, with_output_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .output_pixel_stride(29)
+          .iterations(3)
+          .TestNHWCxF16();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, varying_batch_size) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t batch_size = 2; batch_size <= 3; batch_size++) {
+        ResizeNearestNeighborOperatorTester()
+          .batch_size(batch_size)
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(5)
+          .iterations(3)
+          .TestNHWCxF16();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F16, setup_changing_size) {
+  ResizeNearestNeighborOperatorTester()
+    .batch_size(2)
+    .input_size(3, 4)
+    .output_size(6, 8)
+    .next_batch_size(3)
+    .next_input_size(5, 3)
+    .next_output_size(7, 9)
+    .channels(7)
+    .iterations(3)
+    .TestNHWCxF16();
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_corners_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_corners_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_corners_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_corners_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_corners_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, aligned_corners_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, tf_mode_aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, tf_mode_aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, tf_mode_aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, tf_mode_aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, tf_mode_aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, tf_mode_aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxF32();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, varying_channels) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 1; channels <= 19; channels += 3) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .iterations(3)
+          .TestNHWCxF32();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, with_input_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .input_pixel_stride(23)
+          .iterations(3)
+          .TestNHWCxF32();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, with_output_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .output_pixel_stride(29)
+          .iterations(3)
+          .TestNHWCxF32();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, varying_batch_size) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t batch_size = 2; batch_size <= 3; batch_size++) {
+        ResizeNearestNeighborOperatorTester()
+          .batch_size(batch_size)
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(5)
+          .iterations(3)
+          .TestNHWCxF32();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_F32, setup_changing_size) {
+  ResizeNearestNeighborOperatorTester()
+    .batch_size(2)
+    .input_size(3, 4)
+    .output_size(6, 8)
+    .next_batch_size(3)
+    .next_input_size(5, 3)
+    .next_output_size(7, 9)
+    .channels(7)
+    .iterations(3)
+    .TestNHWCxF32();
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_corners_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_corners_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_corners_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_corners_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_corners_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, aligned_corners_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, tf_mode_aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, tf_mode_aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, tf_mode_aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, tf_mode_aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, tf_mode_aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, tf_mode_aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxS8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, varying_channels) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 1; channels <= 19; channels += 3) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .iterations(3)
+          .TestNHWCxS8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, with_input_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .input_pixel_stride(23)
+          .iterations(3)
+          .TestNHWCxS8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, with_output_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .output_pixel_stride(29)
+          .iterations(3)
+          .TestNHWCxS8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, varying_batch_size) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t batch_size = 2; batch_size <= 3; batch_size++) {
+        ResizeNearestNeighborOperatorTester()
+          .batch_size(batch_size)
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(5)
+          .iterations(3)
+          .TestNHWCxS8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_S8, setup_changing_size) {
+  ResizeNearestNeighborOperatorTester()
+    .batch_size(2)
+    .input_size(3, 4)
+    .output_size(6, 8)
+    .next_batch_size(3)
+    .next_input_size(5, 3)
+    .next_output_size(7, 9)
+    .channels(7)
+    .iterations(3)
+    .TestNHWCxS8();
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_corners_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_corners_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_corners_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_corners_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_corners_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, aligned_corners_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .align_corners(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, tf_mode_aligned_centers_upscale_y) {
+  for (size_t input_height = 1; input_height <= 3; input_height++) {
+    for (size_t output_height = input_height + 1; output_height < 15; output_height *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_height, 1)
+        .output_size(output_height, 1)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, tf_mode_aligned_centers_upscale_x) {
+  for (size_t input_width = 1; input_width <= 3; input_width++) {
+    for (size_t output_width = input_width + 1; output_width < 15; output_width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(1, input_width)
+        .output_size(1, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, tf_mode_aligned_centers_upscale) {
+  for (size_t output_height = 3; output_height <= 5; output_height += 2) {
+    for (size_t output_width = 3; output_width <= 5; output_width += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(2, 2)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, tf_mode_aligned_centers_integer_upscale) {
+  for (size_t scale = 2; scale <= 4; scale++) {
+    for (size_t input_size = 1; input_size <= 5; input_size += 2) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(input_size, input_size + 1)
+        .output_size(input_size * scale, (input_size + 1) * scale)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, tf_mode_aligned_centers_downscale) {
+  for (size_t output_height = 1; output_height <= 3; output_height++) {
+    for (size_t output_width = 1; output_width <= 3; output_width++) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(7, 8)
+        .output_size(output_height, output_width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, tf_mode_aligned_centers_identical_size) {
+  for (size_t height = 1; height < 10; height *= 3) {
+    for (size_t width = 1; width < 10; width *= 3) {
+      ResizeNearestNeighborOperatorTester()
+        .input_size(height, width)
+        .output_size(height, width)
+        .channels(17)
+        .tf_legacy_mode(true)
+        .iterations(3)
+        .TestNHWCxU8();
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, varying_channels) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 1; channels <= 19; channels += 3) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .iterations(3)
+          .TestNHWCxU8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, with_input_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .input_pixel_stride(23)
+          .iterations(3)
+          .TestNHWCxU8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, with_output_stride) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t channels = 15; channels <= 19; channels++) {
+        ResizeNearestNeighborOperatorTester()
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(channels)
+          .output_pixel_stride(29)
+          .iterations(3)
+          .TestNHWCxU8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, varying_batch_size) {
+  for (size_t input_size = 2; input_size <= 6; input_size += 2) {
+    for (size_t output_size = 2; output_size <= 6; output_size += 2) {
+      for (size_t batch_size = 2; batch_size <= 3; batch_size++) {
+        ResizeNearestNeighborOperatorTester()
+          .batch_size(batch_size)
+          .input_size(input_size, input_size)
+          .output_size(output_size, output_size)
+          .channels(5)
+          .iterations(3)
+          .TestNHWCxU8();
+      }
+    }
+  }
+}
+
+TEST(RESIZE_NEAREST_NEIGHBOR_NHWC_U8, setup_changing_size) {
+  ResizeNearestNeighborOperatorTester()
+    .batch_size(2)
+    .input_size(3, 4)
+    .output_size(6, 8)
+    .next_batch_size(3)
+    .next_input_size(5, 3)
+    .next_output_size(7, 9)
+    .channels(7)
+    .iterations(3)
+    .TestNHWCxU8();
+}
@@ -0,0 +1,511 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class ResizeNearestNeighborOperatorTester {
+ public:
+  inline ResizeNearestNeighborOperatorTester& input_size(size_t input_height, size_t input_width) {
+    assert(input_height >= 1);
+    assert(input_width >= 1);
+    this->input_height_ = input_height;
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& input_height(size_t input_height) {
+    assert(input_height >= 1);
+    this->input_height_ = input_height;
+    return *this;
+  }
+
+  inline size_t input_height() const {
+    return this->input_height_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& input_width(size_t input_width) {
+    assert(input_width >= 1);
+    this->input_width_ = input_width;
+    return *this;
+  }
+
+  inline size_t input_width() const {
+    return this->input_width_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& output_size(size_t output_height, size_t output_width) {
+    assert(output_height >= 1);
+    assert(output_width >= 1);
+    this->output_height_ = output_height;
+    this->output_width_ = output_width;
+    return *this;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& output_height(size_t output_height) {
+    assert(output_height >= 1);
+    this->output_height_ = output_height;
+    return *this;
+  }
+
+  inline size_t output_height() const {
+    return this->output_height_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& output_width(size_t output_width) {
+    assert(output_width >= 1);
+    this->output_width_ = output_width;
+    return *this;
+  }
+
+  inline size_t output_width() const {
+    return this->output_width_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& input_pixel_stride(size_t input_pixel_stride) {
+    assert(input_pixel_stride != 0);
+    this->input_pixel_stride_ = input_pixel_stride;
+    return *this;
+  }
+
+  inline size_t input_pixel_stride() const {
+    if (this->input_pixel_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->input_pixel_stride_ >= channels());
+      return this->input_pixel_stride_;
+    }
+  }
+
+  inline ResizeNearestNeighborOperatorTester& output_pixel_stride(size_t output_pixel_stride) {
+    assert(output_pixel_stride != 0);
+    this->output_pixel_stride_ = output_pixel_stride;
+    return *this;
+  }
+
+  inline size_t output_pixel_stride() const {
+    if (this->output_pixel_stride_ == 0) {
+      return channels();
+    } else {
+      assert(this->output_pixel_stride_ >= channels());
+      return this->output_pixel_stride_;
+    }
+  }
+
+  inline ResizeNearestNeighborOperatorTester& next_input_size(uint32_t next_input_height, uint32_t next_input_width) {
+    assert(next_input_height >= 1);
+    assert(next_input_width >= 1);
+    this->next_input_height_ = next_input_height;
+    this->next_input_width_ = next_input_width;
+    return *this;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& next_input_height(uint32_t next_input_height) {
+    assert(next_input_height >= 1);
+    this->next_input_height_ = next_input_height;
+    return *this;
+  }
+
+  inline uint32_t next_input_height() const {
+    if (this->next_input_height_ == 0) {
+      return input_height();
+    } else {
+      return this->next_input_height_;
+    }
+  }
+
+  inline ResizeNearestNeighborOperatorTester& next_input_width(uint32_t next_input_width) {
+    assert(next_input_width >= 1);
+    this->next_input_width_ = next_input_width;
+    return *this;
+  }
+
+  inline uint32_t next_input_width() const {
+    if (this->next_input_width_ == 0) {
+      return input_width();
+    } else {
+      return this->next_input_width_;
+    }
+  }
+
+  inline ResizeNearestNeighborOperatorTester& next_output_size(uint32_t next_output_height, uint32_t next_output_width) {
+    assert(next_output_height >= 1);
+    assert(next_output_width >= 1);
+    this->next_output_height_ = next_output_height;
+    this->next_output_width_ = next_output_width;
+    return *this;
+  }
+
+  inline uint32_t next_output_height() const {
+    if (this->next_output_height_ == 0) {
+      return output_height();
+    } else {
+      return this->next_output_height_;
+    }
+  }
+
+  inline uint32_t next_output_width() const {
+    if (this->next_output_width_ == 0) {
+      return output_width();
+    } else {
+      return this->next_output_width_;
+    }
+  }
+
+  inline ResizeNearestNeighborOperatorTester& next_batch_size(size_t next_batch_size) {
+    assert(next_batch_size >= 1);
+    this->next_batch_size_ = next_batch_size;
+    return *this;
+  }
+
+  inline size_t next_batch_size() const {
+    if (this->next_batch_size_ == 0) {
+      return batch_size();
+    } else {
+      return this->next_batch_size_;
+    }
+  }
+
+  inline ResizeNearestNeighborOperatorTester& align_corners(bool align_corners) {
+    this->align_corners_ = align_corners;
+    return *this;
+  }
+
+  inline bool align_corners() const {
+    return this->align_corners_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& tf_legacy_mode(bool tf_legacy_mode) {
+    this->tf_legacy_mode_ = tf_legacy_mode;
+    return *this;
+  }
+
+  inline bool tf_legacy_mode() const {
+    return this->tf_legacy_mode_;
+  }
+
+  inline ResizeNearestNeighborOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestNHWCxF16() const {
+    TestNHWC<uint16_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nhwc_f16(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const uint16_t* input, uint16_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nhwc_f16(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const void*>(input), reinterpret_cast<void*>(output), nullptr /* thread pool */);
+      });
+  }
+
+  void TestNHWCxF32() const {
+    TestNHWC<uint32_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nhwc_f32(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const uint32_t* input, uint32_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nhwc_f32(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const float*>(input), reinterpret_cast<float*>(output), nullptr /* thread pool */);
+      });
+  }
+
+  void TestNHWCxS8() const {
+    TestNHWC<int8_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nhwc_s8(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const int8_t* input, int8_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nhwc_s8(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const int8_t*>(input), reinterpret_cast<int8_t*>(output), nullptr /* thread pool */);
+      });
+  }
+
+  void TestNHWCxU8() const {
+    TestNHWC<uint8_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nhwc_u8(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const uint8_t* input, uint8_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nhwc_u8(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const uint8_t*>(input), reinterpret_cast<uint8_t*>(output), nullptr /* thread pool */);
+      });
+  }
+
+  void TestNCHWxF16() const {
+    TestNCHW<uint16_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nchw_f16(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const uint16_t* input, uint16_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nchw_f16(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const void*>(input), reinterpret_cast<void*>(output), nullptr /* thread pool */);
+      });
+  }
+
+  void TestNCHWxF32() const {
+    TestNCHW<uint32_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nchw_f32(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const uint32_t* input, uint32_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nchw_f32(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const float*>(input), reinterpret_cast<float*>(output), nullptr /* thread pool */);
+      });
+  }
+
+  void TestNCHWxS8() const {
+    TestNCHW<int8_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nchw_s8(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const int8_t* input, int8_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nchw_s8(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const int8_t*>(input), reinterpret_cast<int8_t*>(output), nullptr /* thread pool */);
+      });
+  }
+
+  void TestNCHWxU8() const {
+    TestNCHW<uint8_t>(
+      [](size_t channels, size_t input_pixel_stride, size_t output_pixel_stride, uint32_t flags, xnn_operator_t* op) {
+        return xnn_create_resize_nearest_neighbor2d_nchw_u8(channels, input_pixel_stride, output_pixel_stride, flags, op);
+      },
+      [](xnn_operator_t op, size_t batch_size, size_t input_height, size_t input_width,
+         size_t output_height, size_t output_width, const uint8_t* input, uint8_t* output) {
+        return xnn_setup_resize_nearest_neighbor2d_nchw_u8(
+          op, batch_size, input_height, input_width, output_height, output_width,
+          reinterpret_cast<const uint8_t*>(input), reinterpret_cast<uint8_t*>(output), nullptr /* thread pool */);
+      });
+  }
+
+ private:
+  // Returns the input coordinate whose value is copied into output coordinate output_index along a dimension.
+  size_t NearestInputIndex(size_t output_index, size_t input_size, size_t output_size) const {
+    const bool aligned_corners = align_corners() && output_size > 1;
+    const float scale = aligned_corners ?
+      float(input_size - 1) / float(output_size - 1) : float(input_size) / float(output_size);
+    const float offset = (tf_legacy_mode() || align_corners()) ? 0.0f : 0.5f;
+    const float input_coordinate = (float(output_index) + offset) * scale;
+    const size_t input_index = align_corners() ?
+      size_t(std::round(input_coordinate)) : size_t(std::floor(input_coordinate));
+    return std::min(input_index, input_size - 1);
+  }
+
+  template<typename T, typename CreateFn, typename SetupFn>
+  void TestNHWC(CreateFn create, SetupFn setup) const {
+    if (align_corners()) {
+      ASSERT_FALSE(tf_legacy_mode());
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> bits_dist(0, 255);
+
+    const size_t max_batch_size = std::max(batch_size(), next_batch_size());
+    const size_t max_input_pixels = std::max(input_height() * input_width(), size_t(next_input_height()) * next_input_width());
+    const size_t max_output_pixels = std::max(output_height() * output_width(), size_t(next_output_height()) * next_output_width());
+    std::vector<T> input((max_batch_size * max_input_pixels - 1) * input_pixel_stride() + channels() + XNN_EXTRA_BYTES / sizeof(T));
+    std::vector<T> output((max_batch_size * max_output_pixels - 1) * output_pixel_stride() + channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return RandomValue<T>(rng, bits_dist); });
+
+      // Create, setup, run, and destroy Resize Nearest Neighbor operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t resize_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        create(
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          (align_corners() ? XNN_FLAG_ALIGN_CORNERS : 0) | (tf_legacy_mode() ? XNN_FLAG_TENSORFLOW_LEGACY_MODE : 0),
+          &resize_op));
+      ASSERT_NE(nullptr, resize_op);
+
+      // Smart pointer to automatically delete resize_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_resize_op(resize_op, xnn_delete_operator);
+
+      // Run once with the initial shapes, then again with the next shapes to exercise re-setup.
+      for (size_t pass = 0; pass < 2; pass++) {
+        const size_t batch = pass == 0 ? batch_size() : next_batch_size();
+        const size_t in_height = pass == 0 ? input_height() : next_input_height();
+        const size_t in_width = pass == 0 ? input_width() : next_input_width();
+        const size_t out_height = pass == 0 ? output_height() : next_output_height();
+        const size_t out_width = pass == 0 ? output_width() : next_output_width();
+        std::fill(output.begin(), output.end(), T(0xA5));
+
+        ASSERT_EQ(xnn_status_success,
+          setup(resize_op, batch, in_height, in_width, out_height, out_width, input.data(), output.data()));
+
+        ASSERT_EQ(xnn_status_success,
+          xnn_run_operator(resize_op, nullptr /* thread pool */));
+
+        // Verify results.
+        for (size_t i = 0; i < batch; i++) {
+          for (size_t y = 0; y < out_height; y++) {
+            const size_t input_y = NearestInputIndex(y, in_height, out_height);
+            for (size_t x = 0; x < out_width; x++) {
+              const size_t input_x = NearestInputIndex(x, in_width, out_width);
+              for (size_t c = 0; c < channels(); c++) {
+                ASSERT_EQ(output[((i * out_height + y) * out_width + x) * output_pixel_stride() + c],
+                    input[((i * in_height + input_y) * in_width + input_x) * input_pixel_stride() + c]) <<
+                  "in batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c <<
+                  ", input pixel (" << input_y << ", " << input_x << ")";
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  template<typename T, typename CreateFn, typename SetupFn>
+  void TestNCHW(CreateFn create, SetupFn setup) const {
+    if (align_corners()) {
+      ASSERT_FALSE(tf_legacy_mode());
+    }
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> bits_dist(0, 255);
+
+    const size_t max_batch_size = std::max(batch_size(), next_batch_size());
+    const size_t max_input_pixels = std::max(input_height() * input_width(), size_t(next_input_height()) * next_input_width());
+    const size_t max_output_pixels = std::max(output_height() * output_width(), size_t(next_output_height()) * next_output_width());
+    std::vector<T> input(max_batch_size * max_input_pixels * input_pixel_stride() + XNN_EXTRA_BYTES / sizeof(T));
+    std::vector<T> output(max_batch_size * max_output_pixels * output_pixel_stride());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return RandomValue<T>(rng, bits_dist); });
+
+      // Create, setup, run, and destroy Resize Nearest Neighbor operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t resize_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        create(
+          channels(), input_pixel_stride(), output_pixel_stride(),
+          (align_corners() ? XNN_FLAG_ALIGN_CORNERS : 0) | (tf_legacy_mode() ? XNN_FLAG_TENSORFLOW_LEGACY_MODE : 0),
+          &resize_op));
+      ASSERT_NE(nullptr, resize_op);
+
+      // Smart pointer to automatically delete resize_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_resize_op(resize_op, xnn_delete_operator);
+
+      // Run once with the initial shapes, then again with the next shapes to exercise re-setup.
+      for (size_t pass = 0; pass < 2; pass++) {
+        const size_t batch = pass == 0 ? batch_size() : next_batch_size();
+        const size_t in_height = pass == 0 ? input_height() : next_input_height();
+        const size_t in_width = pass == 0 ? input_width() : next_input_width();
+        const size_t out_height = pass == 0 ? output_height() : next_output_height();
+        const size_t out_width = pass == 0 ? output_width() : next_output_width();
+        std::fill(output.begin(), output.end(), T(0xA5));
+
+        ASSERT_EQ(xnn_status_success,
+          setup(resize_op, batch, in_height, in_width, out_height, out_width, input.data(), output.data()));
+
+        ASSERT_EQ(xnn_status_success,
+          xnn_run_operator(resize_op, nullptr /* thread pool */));
+
+        // Verify results.
+        const size_t input_num_pixels = in_height * in_width;
+        const size_t output_num_pixels = out_height * out_width;
+        for (size_t i = 0; i < batch; i++) {
+          for (size_t c = 0; c < channels(); c++) {
+            for (size_t y = 0; y < out_height; y++) {
+              const size_t input_y = NearestInputIndex(y, in_height, out_height);
+              for (size_t x = 0; x < out_width; x++) {
+                const size_t input_x = NearestInputIndex(x, in_width, out_width);
+                ASSERT_EQ(output[(i * output_pixel_stride() + c) * output_num_pixels + y * out_width + x],
+                    input[(i * input_pixel_stride() + c) * input_num_pixels + input_y * in_width + input_x]) <<
+                  "in batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c <<
+                  ", input pixel (" << input_y << ", " << input_x << ")";
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Generates random bits: the operator only copies elements, so every bit pattern (including NaNs) must be preserved.
+  template<typename T>
+  static T RandomValue(std::mt19937& rng, std::uniform_int_distribution<int32_t>& bits_dist) {
+    typename std::make_unsigned<T>::type value = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+      value = (value << 8) | static_cast<typename std::make_unsigned<T>::type>(bits_dist(rng));
+    }
+    return static_cast<T>(value);
+  }
+
+  size_t input_height_{1};
+  size_t input_width_{1};
+  size_t output_height_{1};
+  size_t output_width_{1};
+  size_t channels_{1};
+  size_t batch_size_{1};
+  size_t input_pixel_stride_{0};
+  size_t output_pixel_stride_{0};
+  size_t next_input_height_{0};
+  size_t next_input_width_{0};
+  size_t next_output_height_{0};
+  size_t next_output_width_{0};
+  size_t next_batch_size_{0};
+  bool align_corners_{false};
+  bool tf_legacy_mode_{false};
+  size_t iterations_{1};
+};
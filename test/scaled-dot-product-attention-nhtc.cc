@@ -0,0 +1,217 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "scaled-dot-product-attention-operator-tester.h"
+
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, single_query) {
+  for (size_t channels = 1; channels < 40; channels += 3) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(1)
+      .key_tokens(17)
+      .channels(channels)
+      .TestF16();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, small_sequence) {
+  for (size_t tokens = 1; tokens < 20; tokens++) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(tokens)
+      .channels(16)
+      .TestF16();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, multiple_heads) {
+  ScaledDotProductAttentionOperatorTester()
+    .batch_size(2)
+    .heads(3)
+    .query_tokens(9)
+    .key_tokens(13)
+    .channels(8)
+    .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, value_channels) {
+  for (size_t value_channels = 1; value_channels < 40; value_channels += 5) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(7)
+      .key_tokens(11)
+      .channels(16)
+      .value_channels(value_channels)
+      .TestF16();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, long_sequence) {
+  for (size_t key_tokens = 127; key_tokens < 400; key_tokens += 67) {
+    ScaledDotProductAttentionOperatorTester()
+      .heads(2)
+      .query_tokens(19)
+      .key_tokens(key_tokens)
+      .channels(32)
+      .TestF16();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, custom_scale) {
+  ScaledDotProductAttentionOperatorTester()
+    .query_tokens(11)
+    .key_tokens(150)
+    .channels(16)
+    .scale(0.5f)
+    .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, mask) {
+  for (size_t key_tokens = 5; key_tokens < 300; key_tokens += 73) {
+    ScaledDotProductAttentionOperatorTester()
+      .heads(2)
+      .query_tokens(13)
+      .key_tokens(key_tokens)
+      .channels(16)
+      .mask(true)
+      .TestF16();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, causal) {
+  for (size_t tokens = 1; tokens < 300; tokens += 37) {
+    ScaledDotProductAttentionOperatorTester()
+      .heads(2)
+      .query_tokens(tokens)
+      .channels(16)
+      .causal(true)
+      .TestF16();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, causal_with_past_keys) {
+  for (size_t query_tokens = 1; query_tokens < 20; query_tokens += 3) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(query_tokens)
+      .key_tokens(query_tokens + 140)
+      .channels(16)
+      .causal(true)
+      .TestF16();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F16, causal_with_mask) {
+  ScaledDotProductAttentionOperatorTester()
+    .heads(2)
+    .query_tokens(150)
+    .channels(16)
+    .mask(true)
+    .causal(true)
+    .TestF16();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, single_query) {
+  for (size_t channels = 1; channels < 40; channels += 3) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(1)
+      .key_tokens(17)
+      .channels(channels)
+      .TestF32();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, small_sequence) {
+  for (size_t tokens = 1; tokens < 20; tokens++) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(tokens)
+      .channels(16)
+      .TestF32();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, multiple_heads) {
+  ScaledDotProductAttentionOperatorTester()
+    .batch_size(2)
+    .heads(3)
+    .query_tokens(9)
+    .key_tokens(13)
+    .channels(8)
+    .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, value_channels) {
+  for (size_t value_channels = 1; value_channels < 40; value_channels += 5) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(7)
+      .key_tokens(11)
+      .channels(16)
+      .value_channels(value_channels)
+      .TestF32();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, long_sequence) {
+  for (size_t key_tokens = 127; key_tokens < 400; key_tokens += 67) {
+    ScaledDotProductAttentionOperatorTester()
+      .heads(2)
+      .query_tokens(19)
+      .key_tokens(key_tokens)
+      .channels(32)
+      .TestF32();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, custom_scale) {
+  ScaledDotProductAttentionOperatorTester()
+    .query_tokens(11)
+    .key_tokens(150)
+    .channels(16)
+    .scale(0.5f)
+    .TestF32();
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, mask) {
+  for (size_t key_tokens = 5; key_tokens < 300; key_tokens += 73) {
+    ScaledDotProductAttentionOperatorTester()
+      .heads(2)
+      .query_tokens(13)
+      .key_tokens(key_tokens)
+      .channels(16)
+      .mask(true)
+      .TestF32();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, causal) {
+  for (size_t tokens = 1; tokens < 300; tokens += 37) {
+    ScaledDotProductAttentionOperatorTester()
+      .heads(2)
+      .query_tokens(tokens)
+      .channels(16)
+      .causal(true)
+      .TestF32();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, causal_with_past_keys) {
+  for (size_t query_tokens = 1; query_tokens < 20; query_tokens += 3) {
+    ScaledDotProductAttentionOperatorTester()
+      .query_tokens(query_tokens)
+      .key_tokens(query_tokens + 140)
+      .channels(16)
+      .causal(true)
+      .TestF32();
+  }
+}
+
+TEST(SCALED_DOT_PRODUCT_ATTENTION_NHTC_F32, causal_with_mask) {
+  ScaledDotProductAttentionOperatorTester()
+    .heads(2)
+    .query_tokens(150)
+    .channels(16)
+    .mask(true)
+    .causal(true)
+    .TestF32();
+}
@@ -0,0 +1,344 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class ScaledDotProductAttentionOperatorTester {
+ public:
+  inline ScaledDotProductAttentionOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& heads(size_t heads) {
+    assert(heads != 0);
+    this->heads_ = heads;
+    return *this;
+  }
+
+  inline size_t heads() const {
+    return this->heads_;
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& query_tokens(size_t query_tokens) {
+    assert(query_tokens != 0);
+    this->query_tokens_ = query_tokens;
+    return *this;
+  }
+
+  inline size_t query_tokens() const {
+    return this->query_tokens_;
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& key_tokens(size_t key_tokens) {
+    assert(key_tokens != 0);
+    this->key_tokens_ = key_tokens;
+    return *this;
+  }
+
+  inline size_t key_tokens() const {
+    if (this->key_tokens_ == 0) {
+      return this->query_tokens_;
+    } else {
+      return this->key_tokens_;
+    }
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& value_channels(size_t value_channels) {
+    assert(value_channels != 0);
+    this->value_channels_ = value_channels;
+    return *this;
+  }
+
+  inline size_t value_channels() const {
+    if (this->value_channels_ == 0) {
+      return this->channels_;
+    } else {
+      return this->value_channels_;
+    }
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& scale(float scale) {
+    assert(scale > 0.0f);
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    if (this->scale_ == 0.0f) {
+      return 1.0f / std::sqrt(float(channels()));
+    } else {
+      return this->scale_;
+    }
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& mask(bool mask) {
+    this->mask_ = mask;
+    return *this;
+  }
+
+  inline bool mask() const {
+    return this->mask_;
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& causal(bool causal) {
+    this->causal_ = causal;
+    return *this;
+  }
+
+  inline bool causal() const {
+    return this->causal_;
+  }
+
+  inline ScaledDotProductAttentionOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> maskdist(-4.0f, 0.0f);
+
+    const size_t num_heads = batch_size() * heads();
+    std::vector<uint16_t> query(num_heads * query_tokens() * channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> key(num_heads * key_tokens() * channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> value(num_heads * key_tokens() * value_channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> attention_mask(query_tokens() * key_tokens() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> output(num_heads * query_tokens() * value_channels());
+    std::vector<float> output_ref(num_heads * query_tokens() * value_channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(query.begin(), query.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::generate(key.begin(), key.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::generate(value.begin(), value.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      std::generate(attention_mask.begin(), attention_mask.end(),
+        [&]() { return fp16_ieee_from_fp32_value(maskdist(rng)); });
+      std::fill(output.begin(), output.end(), UINT16_C(0x7E00) /* NaN */);
+
+      // Compute reference results.
+      const float scale_f16 = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(scale()));
+      std::vector<double> scores(key_tokens());
+      for (size_t h = 0; h < num_heads; h++) {
+        for (size_t i = 0; i < query_tokens(); i++) {
+          double max_score = -std::numeric_limits<double>::infinity();
+          for (size_t j = 0; j < key_tokens(); j++) {
+            double score = 0.0;
+            for (size_t c = 0; c < channels(); c++) {
+              score += double(fp16_ieee_to_fp32_value(query[(h * query_tokens() + i) * channels() + c])) *
+                double(fp16_ieee_to_fp32_value(key[(h * key_tokens() + j) * channels() + c]));
+            }
+            score *= double(scale_f16);
+            if (mask()) {
+              score += double(fp16_ieee_to_fp32_value(attention_mask[i * key_tokens() + j]));
+            }
+            if (causal() && j > i + (key_tokens() - query_tokens())) {
+              score = -std::numeric_limits<double>::infinity();
+            }
+            scores[j] = score;
+            max_score = std::max(max_score, score);
+          }
+          double sum = 0.0;
+          for (size_t j = 0; j < key_tokens(); j++) {
+            scores[j] = std::exp(scores[j] - max_score);
+            sum += scores[j];
+          }
+          for (size_t v = 0; v < value_channels(); v++) {
+            double acc = 0.0;
+            for (size_t j = 0; j < key_tokens(); j++) {
+              acc += scores[j] * double(fp16_ieee_to_fp32_value(value[(h * key_tokens() + j) * value_channels() + v]));
+            }
+            output_ref[(h * query_tokens() + i) * value_channels() + v] = float(acc / sum);
+          }
+        }
+      }
+
+      // Create, setup, run, and destroy Scaled Dot-Product Attention operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t attention_op = nullptr;
+
+      const xnn_status status = xnn_create_scaled_dot_product_attention_nhtc_f16(
+          scale(), causal() ? XNN_FLAG_CAUSAL_ATTENTION : 0, &attention_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, attention_op);
+
+      // Smart pointer to automatically delete attention_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_attention_op(attention_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_scaled_dot_product_attention_nhtc_f16(
+          attention_op,
+          batch_size(), heads(), query_tokens(), key_tokens(), channels(), value_channels(),
+          query.data(), key.data(), value.data(), mask() ? attention_mask.data() : nullptr,
+          output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(attention_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t h = 0; h < num_heads; h++) {
+        for (size_t i = 0; i < query_tokens(); i++) {
+          for (size_t v = 0; v < value_channels(); v++) {
+            const size_t index = (h * query_tokens() + i) * value_channels() + v;
+            ASSERT_NEAR(
+                fp16_ieee_to_fp32_value(output[index]),
+                output_ref[index],
+                std::max(1.0e-2f, std::abs(output_ref[index]) * 2.0e-2f))
+              << "head " << h << " / " << num_heads << ", query " << i << " / " << query_tokens()
+              << ", channel " << v << " / " << value_channels();
+          }
+        }
+      }
+    }
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> maskdist(-4.0f, 0.0f);
+
+    const size_t num_heads = batch_size() * heads();
+    std::vector<float> query(num_heads * query_tokens() * channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> key(num_heads * key_tokens() * channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> value(num_heads * key_tokens() * value_channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> attention_mask(query_tokens() * key_tokens() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output(num_heads * query_tokens() * value_channels());
+    std::vector<double> output_ref(num_heads * query_tokens() * value_channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(query.begin(), query.end(), [&]() { return f32dist(rng); });
+      std::generate(key.begin(), key.end(), [&]() { return f32dist(rng); });
+      std::generate(value.begin(), value.end(), [&]() { return f32dist(rng); });
+      std::generate(attention_mask.begin(), attention_mask.end(), [&]() { return maskdist(rng); });
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      // Compute reference results.
+      std::vector<double> scores(key_tokens());
+      for (size_t h = 0; h < num_heads; h++) {
+        for (size_t i = 0; i < query_tokens(); i++) {
+          double max_score = -std::numeric_limits<double>::infinity();
+          for (size_t j = 0; j < key_tokens(); j++) {
+            double score = 0.0;
+            for (size_t c = 0; c < channels(); c++) {
+              score += double(query[(h * query_tokens() + i) * channels() + c]) *
+                double(key[(h * key_tokens() + j) * channels() + c]);
+            }
+            score *= double(scale());
+            if (mask()) {
+              score += double(attention_mask[i * key_tokens() + j]);
+            }
+            if (causal() && j > i + (key_tokens() - query_tokens())) {
+              score = -std::numeric_limits<double>::infinity();
+            }
+            scores[j] = score;
+            max_score = std::max(max_score, score);
+          }
+          double sum = 0.0;
+          for (size_t j = 0; j < key_tokens(); j++) {
+            scores[j] = std::exp(scores[j] - max_score);
+            sum += scores[j];
+          }
+          for (size_t v = 0; v < value_channels(); v++) {
+            double acc = 0.0;
+            for (size_t j = 0; j < key_tokens(); j++) {
+              acc += scores[j] * double(value[(h * key_tokens() + j) * value_channels() + v]);
+            }
+            output_ref[(h * query_tokens() + i) * value_channels() + v] = acc / sum;
+          }
+        }
+      }
+
+      // Create, setup, run, and destroy Scaled Dot-Product Attention operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t attention_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_scaled_dot_product_attention_nhtc_f32(
+          scale(), causal() ? XNN_FLAG_CAUSAL_ATTENTION : 0, &attention_op));
+      ASSERT_NE(nullptr, attention_op);
+
+      // Smart pointer to automatically delete attention_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_attention_op(attention_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_scaled_dot_product_attention_nhtc_f32(
+          attention_op,
+          batch_size(), heads(), query_tokens(), key_tokens(), channels(), value_channels(),
+          query.data(), key.data(), value.data(), mask() ? attention_mask.data() : nullptr,
+          output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(attention_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t h = 0; h < num_heads; h++) {
+        for (size_t i = 0; i < query_tokens(); i++) {
+          for (size_t v = 0; v < value_channels(); v++) {
+            const size_t index = (h * query_tokens() + i) * value_channels() + v;
+            ASSERT_NEAR(
+                double(output[index]),
+                output_ref[index],
+                std::max(1.0e-5, std::abs(output_ref[index]) * 1.0e-4))
+              << "head " << h << " / " << num_heads << ", query " << i << " / " << query_tokens()
+              << ", channel " << v << " / " << value_channels();
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batch_size_{1};
+  size_t heads_{1};
+  size_t query_tokens_{1};
+  size_t key_tokens_{0};
+  size_t channels_{1};
+  size_t value_channels_{0};
+  float scale_{0.0f};
+  bool mask_{false};
+  bool causal_{false};
+  size_t iterations_{3};
+};
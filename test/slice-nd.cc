@@ -0,0 +1,115 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "slice-operator-tester.h"
+
+
+namespace {
+
+const std::vector<size_t> kShape6D = {3, 4, 6, 5, 3, 7};
+
+// Slices dimensions selected by the mask to [1, dim - 1), and keeps the other dimensions in full.
+SliceOperatorTester MaskedSlice(size_t num_dims, uint32_t mask) {
+  std::vector<size_t> input_shape(kShape6D.end() - num_dims, kShape6D.end());
+  std::vector<size_t> offsets(num_dims, 0);
+  std::vector<size_t> sizes(input_shape);
+  for (size_t i = 0; i < num_dims; i++) {
+    if (mask & (UINT32_C(1) << i)) {
+      offsets[i] = 1;
+      sizes[i] = input_shape[i] - 2;
+    }
+  }
+  return SliceOperatorTester().input_shape(input_shape).offsets(offsets).sizes(sizes);
+}
+
+}  // namespace
+
+TEST(SLICE_ND_X8, 0d) {
+  SliceOperatorTester()
+    .TestX8();
+}
+
+TEST(SLICE_ND_X8, all_masks) {
+  for (size_t num_dims = 1; num_dims <= XNN_MAX_TENSOR_DIMS; num_dims++) {
+    for (uint32_t mask = 0; mask < (UINT32_C(1) << num_dims); mask++) {
+      MaskedSlice(num_dims, mask).TestX8();
+    }
+  }
+}
+
+TEST(SLICE_ND_X16, 0d) {
+  SliceOperatorTester()
+    .TestX16();
+}
+
+TEST(SLICE_ND_X16, all_masks) {
+  for (size_t num_dims = 1; num_dims <= XNN_MAX_TENSOR_DIMS; num_dims++) {
+    for (uint32_t mask = 0; mask < (UINT32_C(1) << num_dims); mask++) {
+      MaskedSlice(num_dims, mask).TestX16();
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, 0d) {
+  SliceOperatorTester()
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, all_masks) {
+  for (size_t num_dims = 1; num_dims <= XNN_MAX_TENSOR_DIMS; num_dims++) {
+    for (uint32_t mask = 0; mask < (UINT32_C(1) << num_dims); mask++) {
+      MaskedSlice(num_dims, mask).TestX32();
+    }
+  }
+}
+
+TEST(SLICE_ND_X32, contiguous_outer_range) {
+  SliceOperatorTester()
+    .input_shape({7, 5, 3})
+    .offsets({2, 0, 0})
+    .sizes({4, 5, 3})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, contiguous_inner_range) {
+  SliceOperatorTester()
+    .input_shape({7, 5, 3})
+    .offsets({4, 3, 1})
+    .sizes({1, 1, 2})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, single_element) {
+  SliceOperatorTester()
+    .input_shape({2, 3, 5, 7})
+    .offsets({1, 2, 3, 4})
+    .sizes({1, 1, 1, 1})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, unit_dims) {
+  SliceOperatorTester()
+    .input_shape({1, 5, 1, 7, 1})
+    .offsets({0, 1, 0, 2, 0})
+    .sizes({1, 3, 1, 4, 1})
+    .TestX32();
+}
+
+TEST(SLICE_ND_X32, head_split) {
+  // Split of attention heads along the channel dimension of a [batch, tokens, heads * head_dim] tensor.
+  for (size_t head = 0; head < 4; head++) {
+    SliceOperatorTester()
+      .input_shape({2, 9, 4 * 16})
+      .offsets({0, 0, head * 16})
+      .sizes({2, 9, 16})
+      .TestX32();
+  }
+}
@@ -0,0 +1,199 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+
+
+class SliceOperatorTester {
+ public:
+  inline SliceOperatorTester& input_shape(std::initializer_list<size_t> input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = std::vector<size_t>(input_shape);
+    return *this;
+  }
+
+  inline SliceOperatorTester& input_shape(const std::vector<size_t>& input_shape) {
+    assert(input_shape.size() <= XNN_MAX_TENSOR_DIMS);
+    this->input_shape_ = input_shape;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& input_shape() const {
+    return this->input_shape_;
+  }
+
+  inline size_t num_dims() const {
+    return this->input_shape_.size();
+  }
+
+  inline size_t num_input_elements() const {
+    return std::accumulate(
+      this->input_shape_.begin(), this->input_shape_.end(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline SliceOperatorTester& offsets(std::initializer_list<size_t> offsets) {
+    assert(offsets.size() <= XNN_MAX_TENSOR_DIMS);
+    this->offsets_ = std::vector<size_t>(offsets);
+    return *this;
+  }
+
+  inline SliceOperatorTester& offsets(const std::vector<size_t>& offsets) {
+    assert(offsets.size() <= XNN_MAX_TENSOR_DIMS);
+    this->offsets_ = offsets;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& offsets() const {
+    return this->offsets_;
+  }
+
+  inline SliceOperatorTester& sizes(std::initializer_list<size_t> sizes) {
+    assert(sizes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->sizes_ = std::vector<size_t>(sizes);
+    return *this;
+  }
+
+  inline SliceOperatorTester& sizes(const std::vector<size_t>& sizes) {
+    assert(sizes.size() <= XNN_MAX_TENSOR_DIMS);
+    this->sizes_ = sizes;
+    return *this;
+  }
+
+  inline const std::vector<size_t>& sizes() const {
+    return this->sizes_;
+  }
+
+  inline size_t num_output_elements() const {
+    return std::accumulate(
+      this->sizes_.begin(), this->sizes_.end(), size_t(1), std::multiplies<size_t>());
+  }
+
+  inline SliceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestX8() const {
+    Test<uint8_t>(xnn_create_slice_nd_x8, xnn_setup_slice_nd_x8);
+  }
+
+  void TestX16() const {
+    Test<uint16_t>(xnn_create_slice_nd_x16, xnn_setup_slice_nd_x16);
+  }
+
+  void TestX32() const {
+    Test<uint32_t>(xnn_create_slice_nd_x32, xnn_setup_slice_nd_x32);
+  }
+
+ private:
+  template<class T, class CreateFn, class SetupFn>
+  void Test(CreateFn create_fn, SetupFn setup_fn) const {
+    ASSERT_EQ(num_dims(), offsets().size());
+    ASSERT_EQ(num_dims(), sizes().size());
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<uint32_t> dist(0, std::numeric_limits<T>::max());
+
+    // Compute generalized shapes and strides.
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_dims;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> slice_offsets;
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> output_dims;
+    std::fill(input_dims.begin(), input_dims.end(), 1);
+    std::fill(slice_offsets.begin(), slice_offsets.end(), 0);
+    std::fill(output_dims.begin(), output_dims.end(), 1);
+    for (size_t i = 0; i < num_dims(); i++) {
+      input_dims[XNN_MAX_TENSOR_DIMS - num_dims() + i] = input_shape()[i];
+      slice_offsets[XNN_MAX_TENSOR_DIMS - num_dims() + i] = offsets()[i];
+      output_dims[XNN_MAX_TENSOR_DIMS - num_dims() + i] = sizes()[i];
+    }
+    std::array<size_t, XNN_MAX_TENSOR_DIMS> input_strides;
+    size_t input_stride = 1;
+    for (size_t i = XNN_MAX_TENSOR_DIMS; i != 0; i--) {
+      input_strides[i - 1] = input_stride;
+      input_stride *= input_dims[i - 1];
+    }
+
+    std::vector<T> input(XNN_EXTRA_BYTES / sizeof(T) + num_input_elements());
+    std::vector<T> output(num_output_elements());
+    std::vector<T> output_ref(num_output_elements());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return static_cast<T>(dist(rng)); });
+      std::fill(output.begin(), output.end(), static_cast<T>(0xA5A5A5A5));
+
+      // Compute reference results.
+      size_t output_index = 0;
+      for (size_t i = 0; i < output_dims[0]; i++) {
+        for (size_t j = 0; j < output_dims[1]; j++) {
+          for (size_t k = 0; k < output_dims[2]; k++) {
+            for (size_t l = 0; l < output_dims[3]; l++) {
+              for (size_t m = 0; m < output_dims[4]; m++) {
+                for (size_t n = 0; n < output_dims[5]; n++) {
+                  const size_t input_index =
+                    (i + slice_offsets[0]) * input_strides[0] + (j + slice_offsets[1]) * input_strides[1] +
+                    (k + slice_offsets[2]) * input_strides[2] + (l + slice_offsets[3]) * input_strides[3] +
+                    (m + slice_offsets[4]) * input_strides[4] + (n + slice_offsets[5]) * input_strides[5];
+                  output_ref[output_index++] = input[input_index];
+                }
+              }
+            }
+          }
+        }
+      }
+
+      // Create, setup, run, and destroy Slice operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t slice_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, create_fn(0, &slice_op));
+      ASSERT_NE(nullptr, slice_op);
+
+      // Smart pointer to automatically delete slice_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_slice_op(slice_op, xnn_delete_operator);
+
+      ASSERT_EQ(xnn_status_success,
+        setup_fn(
+          slice_op,
+          num_dims(), input_shape().data(), offsets().data(), sizes().data(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(slice_op, nullptr /* thread pool */));
+
+      // Verify results.
+      for (size_t i = 0; i < num_output_elements(); i++) {
+        ASSERT_EQ(output_ref[i], output[i]) << "output element " << i << " / " << num_output_elements();
+      }
+    }
+  }
+
+  std::vector<size_t> input_shape_;
+  std::vector<size_t> offsets_;
+  std::vector<size_t> sizes_;
+  size_t iterations_{3};
+};
@@ -0,0 +1,162 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <xnnpack/params.h>
+
+
+class SoftmaxMicrokernelTester {
+ public:
+  inline SoftmaxMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline SoftmaxMicrokernelTester& input_scale(float input_scale) {
+    assert(input_scale > 0.0f);
+    assert(std::isnormal(input_scale));
+    this->input_scale_ = input_scale;
+    return *this;
+  }
+
+  inline float input_scale() const {
+    return this->input_scale_;
+  }
+
+  inline SoftmaxMicrokernelTester& inplace(bool inplace) {
+    this->inplace_ = inplace;
+    return *this;
+  }
+
+  inline bool inplace() const {
+    return this->inplace_;
+  }
+
+  inline SoftmaxMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_qs8_softmax_ukernel_function softmax) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      rng);
+
+    const std::vector<uint32_t> t = LookupTable();
+    std::vector<int8_t> x(n());
+    std::vector<int8_t> y(n());
+    std::vector<float> y_ref(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(i8rng));
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(i8rng));
+      } else {
+        std::fill(y.begin(), y.end(), INT8_C(0xA5));
+      }
+      const int8_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      const int32_t x_max = int32_t(*std::max_element(x_data, x_data + n()));
+      uint32_t sum = 0;
+      for (size_t i = 0; i < n(); i++) {
+        sum += t[int32_t(x_data[i]) - x_max + 255];
+      }
+      for (size_t i = 0; i < n(); i++) {
+        y_ref[i] = 256.0f * float(t[int32_t(x_data[i]) - x_max + 255]) / float(sum);
+        y_ref[i] = std::min(y_ref[i], 255.0f) - 128.0f;
+      }
+
+      // Call optimized micro-kernel.
+      softmax(n(), x_data, t.data(), y.data());
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_NEAR(y_ref[i], float(int32_t(y[i])), 0.5f)
+          << "at position " << i << ", n = " << n() << ", sum = " << sum;
+      }
+    }
+  }
+
+  void Test(xnn_qu8_softmax_ukernel_function softmax) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, std::numeric_limits<uint8_t>::max()), rng);
+
+    const std::vector<uint32_t> t = LookupTable();
+    std::vector<uint8_t> x(n());
+    std::vector<uint8_t> y(n());
+    std::vector<float> y_ref(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(u8rng));
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(u8rng));
+      } else {
+        std::fill(y.begin(), y.end(), UINT8_C(0xA5));
+      }
+      const uint8_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      const int32_t x_max = int32_t(*std::max_element(x_data, x_data + n()));
+      uint32_t sum = 0;
+      for (size_t i = 0; i < n(); i++) {
+        sum += t[int32_t(x_data[i]) - x_max + 255];
+      }
+      for (size_t i = 0; i < n(); i++) {
+        y_ref[i] = 256.0f * float(t[int32_t(x_data[i]) - x_max + 255]) / float(sum);
+        y_ref[i] = std::min(y_ref[i], 255.0f);
+      }
+
+      // Call optimized micro-kernel.
+      softmax(n(), x_data, t.data(), y.data());
+
+      // Verify results.
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_NEAR(y_ref[i], float(int32_t(y[i])), 0.5f)
+          << "at position " << i << ", n = " << n() << ", sum = " << sum;
+      }
+    }
+  }
+
+ private:
+  // Same table as the Softmax operator builds.
+  std::vector<uint32_t> LookupTable() const {
+    std::vector<uint32_t> t(256);
+    const double qscale = std::min(double(std::numeric_limits<uint32_t>::max()) / double(n()), 8388607.0);
+    for (int32_t i = 0; i < 256; i++) {
+      t[i] = uint32_t(std::lrint(qscale * std::exp(double(i - 255) * double(input_scale()))));
+    }
+    return t;
+  }
+
+  size_t n_{1};
+  float input_scale_{0.0625f};
+  bool inplace_{false};
+  size_t iterations_{15};
+};
@@ -225,6 +225,125 @@ TEST(SOFTMAX_NC_F32, strided_batch_with_input_and_output_stride) {
 }
 
 
+TEST(SOFTMAX_NC_QS8, single_class) {
+  SoftMaxOperatorTester()
+    .batch_size(1)
+    .channels(1)
+    .iterations(100)
+    .TestQS8();
+}
+
+TEST(SOFTMAX_NC_QS8, two_classes) {
+  SoftMaxOperatorTester()
+    .batch_size(1)
+    .channels(2)
+    .iterations(100)
+    .TestQS8();
+}
+
+TEST(SOFTMAX_NC_QS8, many_classes) {
+  for (size_t channels = 3; channels < 100; channels++) {
+    SoftMaxOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .iterations(1)
+      .TestQS8();
+  }
+}
+
+TEST(SOFTMAX_NC_QS8, cifar_classes) {
+  // CIFAR-10
+  SoftMaxOperatorTester()
+    .batch_size(1)
+    .channels(10)
+    .iterations(15)
+    .TestQS8();
+  // CIFAR-100
+  SoftMaxOperatorTester()
+    .batch_size(1)
+    .channels(100)
+    .iterations(15)
+    .TestQS8();
+}
+
+TEST(SOFTMAX_NC_QS8, imagenet_classes) {
+  // ImageNet-1K
+  SoftMaxOperatorTester()
+    .batch_size(1)
+    .channels(1000)
+    .iterations(10)
+    .TestQS8();
+  // ImageNet-1K+1
+  SoftMaxOperatorTester()
+    .batch_size(1)
+    .channels(1001)
+    .iterations(10)
+    .TestQS8();
+  // ImageNet-22K
+  SoftMaxOperatorTester()
+    .batch_size(1)
+    .channels(21841)
+    .iterations(10)
+    .TestQS8();
+}
+
+TEST(SOFTMAX_NC_QS8, many_channels_with_input_scale) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    for (float input_scale = 1.0e-2f; input_scale < 1.0e+2f; input_scale *= 3.14159265f) {
+      SoftMaxOperatorTester()
+        .batch_size(1)
+        .channels(channels)
+        .input_scale(input_scale)
+        .iterations(1)
+        .TestQS8();
+    }
+  }
+}
+
+TEST(SOFTMAX_NC_QS8, small_batch) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(SOFTMAX_NC_QS8, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(SOFTMAX_NC_QS8, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
+TEST(SOFTMAX_NC_QS8, strided_batch_with_input_and_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftMaxOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .input_stride(129)
+      .output_stride(117)
+      .iterations(3)
+      .TestQS8();
+  }
+}
+
 TEST(SOFTMAX_NC_QU8, single_class) {
   SoftMaxOperatorTester()
     .batch_size(1)
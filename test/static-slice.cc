@@ -0,0 +1,128 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include "subgraph-tester.h"
+#include <gtest/gtest.h>
+
+static float clamp(float value, float min, float max) {
+  return std::min(std::max(value, min), max);
+}
+
+TEST(STATIC_SLICE, chained_views) {
+  auto tester = SubgraphTester(5);
+  tester
+    .add_input_tensor({4, 8}, 0)
+    .add_tensor({4, 8}, kDynamic, 1)
+    .add_tensor({2, 8}, kDynamic, 2)
+    .add_tensor({1, 8}, kDynamic, 3)
+    .add_output_tensor({1, 8}, 4)
+    .add_clamp(-0.5f, 0.5f, 0, 1)
+    .add_static_slice({1, 0}, {2, 8}, 1, 2)
+    .add_static_slice({1, 0}, {1, 8}, 2, 3)
+    .add_clamp(-0.25f, 0.25f, 3, 4)
+    .create_runtime()
+    .randomize_input(0)
+    .invoke();
+
+  ASSERT_TRUE(tester.runtime()->blobs[2].view);
+  ASSERT_TRUE(tester.runtime()->blobs[3].view);
+  const std::vector<float>& input = tester.external_data(0);
+  const std::vector<float>& output = tester.external_data(4);
+  for (size_t i = 0; i < 8; i++) {
+    ASSERT_EQ(output[i], clamp(input[2 * 8 + i], -0.25f, 0.25f)) << "i = " << i;
+  }
+}
+
+TEST(STATIC_SLICE, view_of_external_input) {
+  auto tester = SubgraphTester(3);
+  tester
+    .add_input_tensor({3, 5, 7}, 0)
+    .add_tensor({1, 5, 7}, kDynamic, 1)
+    .add_output_tensor({1, 5, 7}, 2)
+    .add_static_slice({2, 0, 0}, {1, 5, 7}, 0, 1)
+    .add_clamp(-0.5f, 0.5f, 1, 2)
+    .create_runtime()
+    .randomize_input(0)
+    .invoke();
+
+  ASSERT_TRUE(tester.runtime()->blobs[1].view);
+  ASSERT_EQ(tester.runtime()->blobs[1].data, tester.external_data(0).data() + 2 * 5 * 7);
+  const std::vector<float>& input = tester.external_data(0);
+  const std::vector<float>& output = tester.external_data(2);
+  for (size_t i = 0; i < 5 * 7; i++) {
+    ASSERT_EQ(output[i], clamp(input[2 * 5 * 7 + i], -0.5f, 0.5f)) << "i = " << i;
+  }
+}
+
+TEST(STATIC_SLICE, view_keeps_aliased_value_alive) {
+  // Value 2 is last read by the Slice Node, but its memory must not be reused while the view (Value 3) is alive:
+  // Values 4, 5, and 6 are computed before the view is consumed.
+  auto tester = SubgraphTester(8);
+  tester
+    .add_input_tensor({2, 16}, 0)
+    .add_input_tensor({1, 16}, 1)
+    .add_tensor({2, 16}, kDynamic, 2)
+    .add_tensor({1, 16}, kDynamic, 3)
+    .add_tensor({1, 16}, kDynamic, 4)
+    .add_tensor({1, 16}, kDynamic, 5)
+    .add_tensor({1, 16}, kDynamic, 6)
+    .add_output_tensor({1, 16}, 7)
+    .add_clamp(-0.5f, 0.5f, 0, 2)
+    .add_static_slice({1, 0}, {1, 16}, 2, 3)
+    .add_clamp(-0.75f, 0.75f, 1, 4)
+    .add_clamp(-0.625f, 0.625f, 4, 5)
+    .add_clamp(-0.25f, 0.25f, 5, 6)
+    .add_addition(3, 6, 7)
+    .create_runtime()
+    .randomize_input(0)
+    .randomize_input(1)
+    .invoke();
+
+  ASSERT_TRUE(tester.runtime()->blobs[3].view);
+  const std::vector<float>& input0 = tester.external_data(0);
+  const std::vector<float>& input1 = tester.external_data(1);
+  const std::vector<float>& output = tester.external_data(7);
+  for (size_t i = 0; i < 16; i++) {
+    const float expected = clamp(input0[16 + i], -0.5f, 0.5f) + clamp(input1[i], -0.25f, 0.25f);
+    ASSERT_EQ(output[i], expected) << "i = " << i;
+  }
+}
+
+TEST(STATIC_SLICE, view_value_range) {
+  auto tester = SubgraphTester(4);
+  tester
+    .add_input_tensor({4, 8}, 0)
+    .add_tensor({2, 8}, kDynamic, 1)
+    .add_tensor({1, 8}, kDynamic, 2)
+    .add_output_tensor({1, 8}, 3)
+    .add_static_slice({1, 0}, {2, 8}, 0, 1)
+    .add_static_slice({1, 0}, {1, 8}, 1, 2)
+    .add_clamp(-0.5f, 0.5f, 2, 3)
+    .create_runtime(XNN_FLAG_COLLECT_VALUE_RANGES)
+    .randomize_input(0)
+    .invoke();
+
+  ASSERT_TRUE(tester.runtime()->blobs[1].view);
+  ASSERT_TRUE(tester.runtime()->blobs[2].view);
+
+  // Views share quantization parameters with the Value they alias, and get the range of the whole aliased Value.
+  const std::vector<float>& input = tester.external_data(0);
+  const float input_min = *std::min_element(input.begin(), input.begin() + 4 * 8);
+  const float input_max = *std::max_element(input.begin(), input.begin() + 4 * 8);
+  for (uint32_t value_id : {0, 1, 2}) {
+    float min = 0.0f;
+    float max = 0.0f;
+    ASSERT_EQ(xnn_status_success, xnn_get_runtime_value_range(tester.runtime(), value_id, &min, &max));
+    EXPECT_EQ(min, input_min) << "value #" << value_id;
+    EXPECT_EQ(max, input_max) << "value #" << value_id;
+  }
+}
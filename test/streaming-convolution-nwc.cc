@@ -0,0 +1,277 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "streaming-convolution-operator-tester.h"
+
+
+TEST(STREAMING_CONVOLUTION_NWC_QS8, single_frame_chunks) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({1, 1, 1, 1, 1, 1})
+    .TestQS8();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_QS8, variable_chunks) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(5)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({3, 1, 7, 2})
+    .TestQS8();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_QS8, with_dilation) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .dilation(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({2, 1, 4, 3})
+    .TestQS8();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_QS8, with_qmin_qmax) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({2, 1, 4})
+    .qmin(64)
+    .qmax(192)
+    .TestQS8();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_QS8, depthwise) {
+  for (uint32_t kernel_size = 2; kernel_size <= 5; kernel_size++) {
+    StreamingConvolutionOperatorTester()
+      .kernel_size(kernel_size)
+      .groups(24)
+      .chunks({1, 3, 2, 1})
+      .TestQS8();
+  }
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_QS8, with_batch) {
+  StreamingConvolutionOperatorTester()
+    .batch_size(3)
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({2, 1, 4})
+    .TestQS8();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_QS8, many_chunks_with_batch) {
+  StreamingConvolutionOperatorTester()
+    .batch_size(3)
+    .kernel_size(5)
+    .dilation(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3, 2, 3, 8, 4, 6, 2, 6, 4, 3, 3})
+    .TestQS8();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F16, single_frame_chunks) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({1, 1, 1, 1, 1, 1})
+    .TestF16();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F16, variable_chunks) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(5)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({3, 1, 7, 2})
+    .TestF16();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F16, depthwise) {
+  for (uint32_t kernel_size = 2; kernel_size <= 5; kernel_size++) {
+    StreamingConvolutionOperatorTester()
+      .kernel_size(kernel_size)
+      .groups(24)
+      .chunks({1, 3, 2, 1})
+      .TestF16();
+  }
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, unit_kernel) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(1)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({1, 3, 2})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, single_frame_chunks) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({1, 1, 1, 1, 1, 1})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, chunks_shorter_than_history) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(7)
+    .dilation(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({1, 2, 1, 3, 1, 5})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, chunks_longer_than_history) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({10, 7, 12})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, many_chunks) {
+  // The history wraps around many times, with chunks shorter than, equal to, and longer than the history.
+  StreamingConvolutionOperatorTester()
+    .kernel_size(5)
+    .dilation(2)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3, 2, 3, 8, 4, 6, 2, 6, 4, 3, 3})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, many_single_frame_chunks) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(4)
+    .dilation(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks(std::vector<size_t>(100, 1))
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, with_dilation) {
+  for (uint32_t dilation = 2; dilation <= 3; dilation++) {
+    StreamingConvolutionOperatorTester()
+      .kernel_size(3)
+      .dilation(dilation)
+      .group_input_channels(15)
+      .group_output_channels(17)
+      .chunks({2, 1, 4, 3})
+      .TestF32();
+  }
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, with_input_stride) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .input_channel_stride(19)
+    .group_output_channels(17)
+    .chunks({2, 1, 4})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, with_output_stride) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .output_channel_stride(21)
+    .chunks({2, 1, 4})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, with_qmin_qmax) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({2, 1, 4})
+    .qmin(64)
+    .qmax(192)
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, without_bias) {
+  StreamingConvolutionOperatorTester()
+    .has_bias(false)
+    .kernel_size(3)
+    .group_input_channels(15)
+    .group_output_channels(17)
+    .chunks({2, 1, 4})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, grouped) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .groups(3)
+    .group_input_channels(5)
+    .group_output_channels(7)
+    .chunks({2, 1, 4})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, depthwise) {
+  for (uint32_t kernel_size = 2; kernel_size <= 5; kernel_size++) {
+    StreamingConvolutionOperatorTester()
+      .kernel_size(kernel_size)
+      .groups(24)
+      .chunks({1, 3, 2, 1})
+      .TestF32();
+  }
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, depthwise_with_dilation) {
+  StreamingConvolutionOperatorTester()
+    .kernel_size(3)
+    .dilation(4)
+    .groups(24)
+    .chunks({1, 3, 2, 5, 1})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, depthwise_layout) {
+  StreamingConvolutionOperatorTester()
+    .depthwise_layout(true)
+    .kernel_size(3)
+    .groups(24)
+    .chunks({1, 3, 2, 1})
+    .TestF32();
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, with_batch) {
+  for (uint32_t kernel_size = 3; kernel_size <= 5; kernel_size += 2) {
+    StreamingConvolutionOperatorTester()
+      .batch_size(3)
+      .kernel_size(kernel_size)
+      .group_input_channels(15)
+      .group_output_channels(17)
+      .chunks({2, 1, 4})
+      .TestF32();
+  }
+}
+
+TEST(STREAMING_CONVOLUTION_NWC_F32, depthwise_with_batch) {
+  StreamingConvolutionOperatorTester()
+    .batch_size(3)
+    .kernel_size(3)
+    .groups(24)
+    .chunks({2, 1, 4})
+    .TestF32();
+}
@@ -0,0 +1,498 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class StreamingConvolutionOperatorTester {
+ public:
+  inline StreamingConvolutionOperatorTester& kernel_size(uint32_t kernel_size) {
+    assert(kernel_size >= 1);
+    this->kernel_size_ = kernel_size;
+    return *this;
+  }
+
+  inline uint32_t kernel_size() const {
+    return this->kernel_size_;
+  }
+
+  inline StreamingConvolutionOperatorTester& dilation(uint32_t dilation) {
+    assert(dilation >= 1);
+    this->dilation_ = dilation;
+    return *this;
+  }
+
+  inline uint32_t dilation() const {
+    return this->dilation_;
+  }
+
+  inline StreamingConvolutionOperatorTester& groups(uint32_t groups) {
+    assert(groups >= 1);
+    this->groups_ = groups;
+    return *this;
+  }
+
+  inline uint32_t groups() const {
+    return this->groups_;
+  }
+
+  inline StreamingConvolutionOperatorTester& group_input_channels(size_t group_input_channels) {
+    assert(group_input_channels >= 1);
+    this->group_input_channels_ = group_input_channels;
+    return *this;
+  }
+
+  inline size_t group_input_channels() const {
+    return this->group_input_channels_;
+  }
+
+  inline StreamingConvolutionOperatorTester& group_output_channels(size_t group_output_channels) {
+    assert(group_output_channels >= 1);
+    this->group_output_channels_ = group_output_channels;
+    return *this;
+  }
+
+  inline size_t group_output_channels() const {
+    return this->group_output_channels_;
+  }
+
+  inline StreamingConvolutionOperatorTester& depthwise_layout(bool depthwise_layout) {
+    this->depthwise_layout_ = depthwise_layout;
+    return *this;
+  }
+
+  inline bool depthwise_layout() const {
+    return this->depthwise_layout_;
+  }
+
+  inline StreamingConvolutionOperatorTester& input_channel_stride(size_t input_channel_stride) {
+    assert(input_channel_stride >= 1);
+    this->input_channel_stride_ = input_channel_stride;
+    return *this;
+  }
+
+  inline size_t input_channel_stride() const {
+    if (this->input_channel_stride_ == 0) {
+      return groups() * group_input_channels();
+    } else {
+      assert(this->input_channel_stride_ >= groups() * group_input_channels());
+      return this->input_channel_stride_;
+    }
+  }
+
+  inline StreamingConvolutionOperatorTester& output_channel_stride(size_t output_channel_stride) {
+    assert(output_channel_stride >= 1);
+    this->output_channel_stride_ = output_channel_stride;
+    return *this;
+  }
+
+  inline size_t output_channel_stride() const {
+    if (this->output_channel_stride_ == 0) {
+      return groups() * group_output_channels();
+    } else {
+      assert(this->output_channel_stride_ >= groups() * group_output_channels());
+      return this->output_channel_stride_;
+    }
+  }
+
+  inline StreamingConvolutionOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size >= 1);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  // Number of new frames passed to every run of the operator.
+  inline StreamingConvolutionOperatorTester& chunks(std::vector<size_t> chunks) {
+    assert(!chunks.empty());
+    this->chunks_ = std::move(chunks);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& chunks() const {
+    return this->chunks_;
+  }
+
+  inline size_t total_frames() const {
+    return std::accumulate(chunks().cbegin(), chunks().cend(), size_t(0));
+  }
+
+  inline StreamingConvolutionOperatorTester& has_bias(bool has_bias) {
+    this->has_bias_ = has_bias;
+    return *this;
+  }
+
+  inline bool has_bias() const {
+    return this->has_bias_;
+  }
+
+  inline StreamingConvolutionOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline StreamingConvolutionOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline StreamingConvolutionOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestQS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i32dist(-10000, 10000);
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_int_distribution<int32_t> w8dist(
+      -std::numeric_limits<int8_t>::max(), std::numeric_limits<int8_t>::max());
+
+    std::vector<int8_t> input(batch_size() * total_frames() * input_channel_stride());
+    std::vector<int8_t> kernel(kernel_elements());
+    std::vector<int32_t> bias(output_channels());
+    std::vector<double> output_ref(batch_size() * total_frames() * output_channels());
+
+    const int8_t input_zero_point = 1;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return i8dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return w8dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return i32dist(rng); });
+
+      // Frames before the start of the stream equal the input zero point and contribute nothing.
+      ComputeReference(
+        [&](size_t i) { return double(int32_t(input[i]) - int32_t(input_zero_point)); },
+        [&](size_t i) { return double(kernel[i]); },
+        [&](size_t i) { return double(bias[i]); },
+        output_ref);
+
+      // Compute renormalization parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+
+      const double output_scale = std::max(accumulated_max - accumulated_min, 1.0) / 255.0;
+      const int8_t output_zero_point = int8_t(std::max(std::min(
+        lrint(-0.5 - 0.5 * (accumulated_min + accumulated_max) / output_scale),
+        long(std::numeric_limits<int8_t>::max())), long(std::numeric_limits<int8_t>::min())));
+
+      // Renormalize reference results.
+      for (double& value : output_ref) {
+        value = std::max<double>(std::min<double>(value / output_scale, double(qmax() - 0x80) - output_zero_point),
+          double(qmin() - 0x80) - output_zero_point);
+      }
+
+      // Create, setup, run, and destroy Streaming Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      const xnn_status status = xnn_create_streaming_convolution1d_nwc_qs8(
+          kernel_size(), dilation(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          input_zero_point, 1.0f /* input scale */, 1.0f /* kernel scale */,
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_zero_point, output_scale, int8_t(qmin() - 0x80), int8_t(qmax() - 0x80),
+          depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0,
+          nullptr /* caches */,
+          &convolution_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      // The second pass checks that a reset operator reproduces the output of a new operator.
+      for (size_t pass = 0; pass < 2; pass++) {
+        if (pass != 0) {
+          ASSERT_EQ(xnn_status_success, xnn_reset_streaming_convolution1d_nwc(convolution_op));
+        }
+        RunChunks<int8_t>(
+          input, INT8_C(0xA5),
+          [&](const int8_t* chunk_input, int8_t* chunk_output, size_t chunk_frames) {
+            ASSERT_EQ(xnn_status_success,
+              xnn_setup_streaming_convolution1d_nwc_qs8(
+                convolution_op, batch_size(), chunk_frames, chunk_input, chunk_output, nullptr /* thread pool */));
+            ASSERT_EQ(xnn_status_success, xnn_run_operator(convolution_op, nullptr /* thread pool */));
+          },
+          [&](int8_t y) { return double(int32_t(y) - int32_t(output_zero_point)); },
+          output_ref, [](double) { return 0.9; });
+      }
+    }
+  }
+
+  void TestF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<uint16_t> input(batch_size() * total_frames() * input_channel_stride());
+    std::vector<float> kernel(kernel_elements());
+    std::vector<float> bias(output_channels());
+    std::vector<double> output_ref(batch_size() * total_frames() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      // Weights are passed in FP32 and converted to FP16 during packing: round them to FP16 for the reference.
+      std::generate(kernel.begin(), kernel.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+      std::generate(bias.begin(), bias.end(), [&]() { return fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(f32dist(rng))); });
+
+      ComputeReference(
+        [&](size_t i) { return double(fp16_ieee_to_fp32_value(input[i])); },
+        [&](size_t i) { return double(kernel[i]); },
+        [&](size_t i) { return double(bias[i]); },
+        output_ref);
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        float(accumulated_min + accumulated_range / 255.0 * double(qmin()))));
+      const float output_max = fp16_ieee_to_fp32_value(fp16_ieee_from_fp32_value(
+        float(accumulated_max - accumulated_range / 255.0 * double(255 - qmax()))));
+
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Streaming Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      const xnn_status status = xnn_create_streaming_convolution1d_nwc_f16(
+          kernel_size(), dilation(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          XNN_FLAG_FP32_STATIC_WEIGHTS | (depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0),
+          nullptr /* caches */,
+          &convolution_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      for (size_t pass = 0; pass < 2; pass++) {
+        if (pass != 0) {
+          ASSERT_EQ(xnn_status_success, xnn_reset_streaming_convolution1d_nwc(convolution_op));
+        }
+        RunChunks<uint16_t>(
+          input, UINT16_C(0x7E00) /* NaN */,
+          [&](const uint16_t* chunk_input, uint16_t* chunk_output, size_t chunk_frames) {
+            ASSERT_EQ(xnn_status_success,
+              xnn_setup_streaming_convolution1d_nwc_f16(
+                convolution_op, batch_size(), chunk_frames, chunk_input, chunk_output, nullptr /* thread pool */));
+            ASSERT_EQ(xnn_status_success, xnn_run_operator(convolution_op, nullptr /* thread pool */));
+          },
+          [](uint16_t y) { return double(fp16_ieee_to_fp32_value(y)); },
+          output_ref, [](double y) { return std::max(1.0e-4, std::abs(y) * 1.0e-2); });
+      }
+    }
+  }
+
+  void TestF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(0.1f, 1.0f);
+
+    std::vector<float> input(batch_size() * total_frames() * input_channel_stride());
+    std::vector<float> kernel(kernel_elements());
+    std::vector<float> bias(output_channels());
+    std::vector<double> output_ref(batch_size() * total_frames() * output_channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(kernel.begin(), kernel.end(), [&]() { return f32dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+
+      ComputeReference(
+        [&](size_t i) { return double(input[i]); },
+        [&](size_t i) { return double(kernel[i]); },
+        [&](size_t i) { return double(bias[i]); },
+        output_ref);
+
+      // Compute clamping parameters.
+      const double accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const double accumulated_range = accumulated_max - accumulated_min;
+      const float output_min = qmin() == 0 ? -std::numeric_limits<float>::infinity() :
+        float(accumulated_min + accumulated_range / 255.0 * double(qmin()));
+      const float output_max = qmax() == 255 ? std::numeric_limits<float>::infinity() :
+        float(accumulated_max - accumulated_range / 255.0 * double(255 - qmax()));
+
+      for (double& value : output_ref) {
+        value = std::max(std::min(value, double(output_max)), double(output_min));
+      }
+
+      // Create, setup, run, and destroy Streaming Convolution operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t convolution_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success, xnn_create_streaming_convolution1d_nwc_f32(
+          kernel_size(), dilation(),
+          groups(), group_input_channels(), group_output_channels(),
+          input_channel_stride(), output_channel_stride(),
+          kernel.data(), has_bias() ? bias.data() : nullptr,
+          output_min, output_max,
+          depthwise_layout() ? XNN_FLAG_DEPTHWISE_CONVOLUTION : 0,
+          nullptr /* caches */,
+          &convolution_op));
+      ASSERT_NE(nullptr, convolution_op);
+
+      // Smart pointer to automatically delete convolution_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_convolution_op(convolution_op, xnn_delete_operator);
+
+      for (size_t pass = 0; pass < 2; pass++) {
+        if (pass != 0) {
+          ASSERT_EQ(xnn_status_success, xnn_reset_streaming_convolution1d_nwc(convolution_op));
+        }
+        RunChunks<float>(
+          input, nanf(""),
+          [&](const float* chunk_input, float* chunk_output, size_t chunk_frames) {
+            ASSERT_EQ(xnn_status_success,
+              xnn_setup_streaming_convolution1d_nwc_f32(
+                convolution_op, batch_size(), chunk_frames, chunk_input, chunk_output, nullptr /* thread pool */));
+            ASSERT_EQ(xnn_status_success, xnn_run_operator(convolution_op, nullptr /* thread pool */));
+          },
+          [](float y) { return double(y); },
+          output_ref, [](double y) { return std::max(1.0e-5, std::abs(y) * 1.0e-5); });
+      }
+    }
+  }
+
+ private:
+  inline size_t output_channels() const {
+    return groups() * group_output_channels();
+  }
+
+  inline size_t kernel_elements() const {
+    return groups() * group_output_channels() * kernel_size() * group_input_channels();
+  }
+
+  // Computes the causal convolution of the whole stream, in [batch, frames, output channels] layout. The kernel is in
+  // [groups * group_output_channels, kernel_size, group_input_channels] layout, or in
+  // [kernel_size, groups * group_output_channels] layout for the depthwise layout.
+  template<class InputFn, class KernelFn, class BiasFn>
+  void ComputeReference(InputFn input, KernelFn kernel, BiasFn bias, std::vector<double>& output_ref) const {
+    const size_t history_frames = (kernel_size() - 1) * dilation();
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t t = 0; t < total_frames(); t++) {
+        for (size_t g = 0; g < groups(); g++) {
+          for (size_t oc = 0; oc < group_output_channels(); oc++) {
+            const size_t output_channel = g * group_output_channels() + oc;
+            double acc = has_bias() ? bias(output_channel) : 0.0;
+            for (size_t k = 0; k < kernel_size(); k++) {
+              if (t + k * dilation() < history_frames) {
+                continue;
+              }
+              const size_t input_frame = t + k * dilation() - history_frames;
+              for (size_t ic = 0; ic < group_input_channels(); ic++) {
+                const size_t kernel_index = depthwise_layout() ?
+                  k * output_channels() + output_channel :
+                  (output_channel * kernel_size() + k) * group_input_channels() + ic;
+                acc += input((i * total_frames() + input_frame) * input_channel_stride() + g * group_input_channels() + ic) *
+                  kernel(kernel_index);
+              }
+            }
+            output_ref[(i * total_frames() + t) * output_channels() + output_channel] = acc;
+          }
+        }
+      }
+    }
+  }
+
+  // Splits the stream into chunks, runs the operator on every chunk in order, and verifies the outputs.
+  template<class T, class RunFn, class OutputFn, class ToleranceFn>
+  void RunChunks(
+    const std::vector<T>& input, T output_fill, RunFn run, OutputFn output_value,
+    const std::vector<double>& output_ref, ToleranceFn tolerance) const
+  {
+    size_t frame_offset = 0;
+    for (size_t chunk_frames : chunks()) {
+      std::vector<T> chunk_input(XNN_EXTRA_BYTES / sizeof(T) + batch_size() * chunk_frames * input_channel_stride());
+      for (size_t i = 0; i < batch_size(); i++) {
+        std::copy_n(
+          input.cbegin() + (i * total_frames() + frame_offset) * input_channel_stride(),
+          chunk_frames * input_channel_stride(),
+          chunk_input.begin() + i * chunk_frames * input_channel_stride());
+      }
+      std::vector<T> chunk_output((batch_size() * chunk_frames - 1) * output_channel_stride() + output_channels());
+      std::fill(chunk_output.begin(), chunk_output.end(), output_fill);
+
+      run(chunk_input.data(), chunk_output.data(), chunk_frames);
+
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t t = 0; t < chunk_frames; t++) {
+          for (size_t c = 0; c < output_channels(); c++) {
+            const double y_ref = output_ref[(i * total_frames() + frame_offset + t) * output_channels() + c];
+            ASSERT_NEAR(output_value(chunk_output[(i * chunk_frames + t) * output_channel_stride() + c]), y_ref, tolerance(y_ref))
+              << "batch " << i << " / " << batch_size() << ", frame " << frame_offset + t << " / " << total_frames()
+              << ", channel " << c << " / " << output_channels();
+          }
+        }
+      }
+      frame_offset += chunk_frames;
+    }
+  }
+
+  uint32_t kernel_size_{1};
+  uint32_t dilation_{1};
+  uint32_t groups_{1};
+  size_t group_input_channels_{1};
+  size_t group_output_channels_{1};
+  bool depthwise_layout_{false};
+  size_t input_channel_stride_{0};
+  size_t output_channel_stride_{0};
+  size_t batch_size_{1};
+  std::vector<size_t> chunks_{1};
+  bool has_bias_{true};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{1};
+};
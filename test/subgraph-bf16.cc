@@ -0,0 +1,102 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include "subgraph-tester.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+size_t CountNodes(xnn_subgraph_t subgraph, xnn_node_type type, xnn_compute_type compute_type) {
+  size_t count = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    if (subgraph->nodes[n].type == type && subgraph->nodes[n].compute_type == compute_type) {
+      count += 1;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(SUBGRAPH_BF16, mixed_with_fp32_nodes) {
+  // Input (0) -> Fully Connected -> 3 -> Fully Connected -> 6 -> Add with Input (11) -> 7 -> Fully Connected ->
+  // Output (10)
+  SubgraphTester tester(12);
+  tester
+    .add_input_tensor({5, 32}, 0)
+    .add_tensor({24, 32}, kStaticDense, 1)
+    .add_tensor({24}, kStaticDense, 2)
+    .add_tensor({5, 24}, kDynamic, 3)
+    .add_tensor({24, 24}, kStaticDense, 4)
+    .add_tensor({24}, kStaticDense, 5)
+    .add_tensor({5, 24}, kDynamic, 6)
+    .add_tensor({5, 24}, kDynamic, 7)
+    .add_tensor({16, 24}, kStaticDense, 8)
+    .add_tensor({16}, kStaticDense, 9)
+    .add_output_tensor({5, 16}, 10)
+    .add_input_tensor({5, 24}, 11)
+    .add_fully_connected(0, 1, 2, 3)
+    .add_fully_connected(3, 4, 5, 6)
+    .add_addition(6, 11, 7)
+    .add_fully_connected(7, 8, 9, 10);
+
+  tester
+    .create_runtime()
+    .randomize_input(0)
+    .randomize_input(11)
+    .invoke();
+  const std::vector<float> output_fp32(tester.external_data(10).begin(), tester.external_data(10).begin() + 5 * 16);
+
+  tester
+    .create_runtime(XNN_FLAG_HINT_BF16_INFERENCE)
+    .invoke();
+
+  // Value 3 is only used by BF16 Nodes and is converted in-place. Values 6 and 7 are shared with the Add Node, and
+  // the external Values 0 and 10 stay FP32, so each of them gets a Convert Node.
+  xnn_subgraph_t subgraph = tester.subgraph();
+  EXPECT_EQ(3, CountNodes(subgraph, xnn_node_type_fully_connected, xnn_compute_type_bf16));
+  EXPECT_EQ(1, CountNodes(subgraph, xnn_node_type_add2, xnn_compute_type_fp32));
+  EXPECT_EQ(2, CountNodes(subgraph, xnn_node_type_convert, xnn_compute_type_fp32_to_bf16));
+  EXPECT_EQ(2, CountNodes(subgraph, xnn_node_type_convert, xnn_compute_type_bf16_to_fp32));
+  EXPECT_EQ(xnn_datatype_bf16, subgraph->values[3].datatype);
+  EXPECT_EQ(xnn_datatype_fp32, subgraph->values[6].datatype);
+  EXPECT_EQ(xnn_datatype_fp32, subgraph->values[7].datatype);
+
+  // BF16 keeps 8 bits of mantissa, and every BF16 Value adds up to half a unit in the last place of error.
+  const float output_min = *std::min_element(output_fp32.begin(), output_fp32.end());
+  const float output_max = *std::max_element(output_fp32.begin(), output_fp32.end());
+  const float tolerance = 0.05f * (output_max - output_min);
+  const std::vector<float>& output_bf16 = tester.external_data(10);
+  for (size_t i = 0; i < output_fp32.size(); i++) {
+    EXPECT_NEAR(output_bf16[i], output_fp32[i], tolerance) << "i = " << i;
+  }
+}
+
+TEST(SUBGRAPH_BF16, no_fully_connected_nodes) {
+  SubgraphTester tester(3);
+  tester
+    .add_input_tensor({5, 16}, 0)
+    .add_tensor({5, 16}, kDynamic, 1)
+    .add_output_tensor({5, 16}, 2)
+    .add_clamp(-0.5f, 0.5f, 0, 1)
+    .add_clamp(-0.25f, 0.25f, 1, 2);
+
+  EXPECT_FALSE(xnn_subgraph_rewrite_for_bf16(tester.subgraph()));
+
+  xnn_subgraph_t subgraph = tester.subgraph();
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    EXPECT_EQ(xnn_compute_type_fp32, subgraph->nodes[n].compute_type) << "node #" << n;
+  }
+  for (uint32_t value_id = 0; value_id < 3; value_id++) {
+    EXPECT_EQ(xnn_datatype_fp32, subgraph->values[value_id].datatype) << "value #" << value_id;
+  }
+}
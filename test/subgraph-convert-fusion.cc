@@ -0,0 +1,213 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+size_t CountNodes(xnn_subgraph_t subgraph, xnn_node_type type) {
+  size_t count = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    if (subgraph->nodes[n].type == type) {
+      count += 1;
+    }
+  }
+  return count;
+}
+
+size_t CountNodes(xnn_subgraph_t subgraph) {
+  size_t count = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    if (subgraph->nodes[n].type != xnn_node_type_invalid) {
+      count += 1;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(SUBGRAPH_CONVERT_FUSION, qs8_to_fp32_convert_into_qd8_fully_connected) {
+  ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+  const size_t batch_size = 7;
+  const size_t input_channels = 37;
+  const size_t output_channels = 19;
+  const int32_t input_zero_point = -3;
+  const float input_scale = 0.0625f;
+
+  std::random_device random_device;
+  auto rng = std::mt19937(random_device());
+  std::uniform_int_distribution<int32_t> i8dist(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+  std::uniform_real_distribution<float> f32dist(0.5f, 2.0f);
+
+  std::vector<int8_t> input(batch_size * input_channels + XNN_EXTRA_BYTES / sizeof(int8_t));
+  std::vector<int8_t> kernel(output_channels * input_channels);
+  std::vector<float> kernel_scale(output_channels);
+  std::vector<float> bias(output_channels);
+  std::vector<float> output(batch_size * output_channels);
+  std::generate(input.begin(), input.end(), [&]() { return (int8_t) i8dist(rng); });
+  std::generate(kernel.begin(), kernel.end(), [&]() { return (int8_t) i8dist(rng); });
+  std::generate(kernel_scale.begin(), kernel_scale.end(), [&]() { return f32dist(rng) / 128.0f; });
+  std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+
+  // Input (0, QS8) -> Convert -> 1 (FP32) -> Fully Connected with QC8 weights -> Output (2, FP32)
+  xnn_subgraph_t subgraph_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_subgraph(3, 0 /* flags */, &subgraph_ptr));
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph(subgraph_ptr, xnn_delete_subgraph);
+
+  const size_t input_dims[2] = {batch_size, input_channels};
+  const size_t kernel_dims[2] = {output_channels, input_channels};
+  const size_t bias_dims[1] = {output_channels};
+  const size_t output_dims[2] = {batch_size, output_channels};
+  uint32_t input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+    subgraph.get(), xnn_datatype_qint8, input_zero_point, input_scale, 2, input_dims, nullptr,
+    0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &input_id));
+  uint32_t dequantized_input_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, 2, input_dims, nullptr, 1, 0 /* flags */, &dequantized_input_id));
+  uint32_t output_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, 2, output_dims, nullptr, 2, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &output_id));
+  uint32_t kernel_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_channelwise_quantized_tensor_value(
+    subgraph.get(), xnn_datatype_qcint8, kernel_scale.data(), 2, 0, kernel_dims, kernel.data(),
+    XNN_INVALID_VALUE_ID, 0 /* flags */, &kernel_id));
+  uint32_t bias_id = XNN_INVALID_VALUE_ID;
+  ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+    subgraph.get(), xnn_datatype_fp32, 1, bias_dims, bias.data(), XNN_INVALID_VALUE_ID, 0 /* flags */, &bias_id));
+
+  ASSERT_EQ(xnn_status_success, xnn_define_convert(subgraph.get(), input_id, dequantized_input_id, 0 /* flags */));
+  ASSERT_EQ(xnn_status_success, xnn_define_fully_connected(
+    subgraph.get(), -INFINITY, INFINITY, dequantized_input_id, kernel_id, bias_id, output_id, 0 /* flags */));
+
+  xnn_runtime_t runtime_ptr = nullptr;
+  ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph.get(), nullptr, nullptr, 0 /* flags */, &runtime_ptr));
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime(runtime_ptr, xnn_delete_runtime);
+
+  // The Convert Node is fused, and the Fully Connected Node reads the QS8 input.
+  ASSERT_EQ(1, CountNodes(subgraph.get()));
+  ASSERT_EQ(1, CountNodes(subgraph.get(), xnn_node_type_fully_connected));
+  const xnn_node* fully_connected_node = &subgraph->nodes[1];
+  ASSERT_EQ(xnn_node_type_fully_connected, fully_connected_node->type);
+  ASSERT_EQ(xnn_compute_type_qs8_f32_qc8w, fully_connected_node->compute_type);
+  ASSERT_EQ(input_id, fully_connected_node->inputs[0]);
+
+  const xnn_external_value external_values[2] = {
+    {input_id, input.data()},
+    {output_id, output.data()},
+  };
+  ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime.get(), 2, external_values));
+  ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime.get()));
+
+  // The QS8 input is exactly representable, so only the FP32 output conversion rounds.
+  for (size_t i = 0; i < batch_size; i++) {
+    for (size_t n = 0; n < output_channels; n++) {
+      int32_t accumulator = 0;
+      for (size_t k = 0; k < input_channels; k++) {
+        accumulator += (int32_t(input[i * input_channels + k]) - input_zero_point) * int32_t(kernel[n * input_channels + k]);
+      }
+      const double expected = double(accumulator) * double(input_scale) * double(kernel_scale[n]) + double(bias[n]);
+      EXPECT_NEAR(output[i * output_channels + n], expected, std::abs(expected) * 1.0e-5 + 1.0e-5)
+        << "batch " << i << ", channel " << n;
+    }
+  }
+}
+
+class RoundtripConvertTest : public ::testing::Test {
+ protected:
+  // Input (0, QS8) -> Convert -> 1 (FP32) -> Convert -> 2 (QS8, roundtrip params) -> Convert -> Output (3, FP32)
+  void Run(int32_t roundtrip_zero_point, float roundtrip_scale) {
+    ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    input_.resize(num_elements_ + XNN_EXTRA_BYTES / sizeof(int8_t));
+    output_.resize(num_elements_);
+    std::generate(input_.begin(), input_.end(), [&]() { return (int8_t) i8dist(rng); });
+
+    xnn_subgraph_t subgraph_ptr = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_subgraph(4, 0 /* flags */, &subgraph_ptr));
+    subgraph_.reset(subgraph_ptr);
+
+    const size_t dims[2] = {3, num_elements_ / 3};
+    uint32_t id = XNN_INVALID_VALUE_ID;
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph_.get(), xnn_datatype_qint8, zero_point_, scale_, 2, dims, nullptr,
+      0, XNN_VALUE_FLAG_EXTERNAL_INPUT, &id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph_.get(), xnn_datatype_fp32, 2, dims, nullptr, 1, 0 /* flags */, &id));
+    ASSERT_EQ(xnn_status_success, xnn_define_quantized_tensor_value(
+      subgraph_.get(), xnn_datatype_qint8, roundtrip_zero_point, roundtrip_scale, 2, dims, nullptr,
+      2, 0 /* flags */, &id));
+    ASSERT_EQ(xnn_status_success, xnn_define_tensor_value(
+      subgraph_.get(), xnn_datatype_fp32, 2, dims, nullptr, 3, XNN_VALUE_FLAG_EXTERNAL_OUTPUT, &id));
+    ASSERT_EQ(xnn_status_success, xnn_define_convert(subgraph_.get(), 0, 1, 0 /* flags */));
+    ASSERT_EQ(xnn_status_success, xnn_define_convert(subgraph_.get(), 1, 2, 0 /* flags */));
+    ASSERT_EQ(xnn_status_success, xnn_define_convert(subgraph_.get(), 2, 3, 0 /* flags */));
+
+    xnn_runtime_t runtime_ptr = nullptr;
+    ASSERT_EQ(xnn_status_success, xnn_create_runtime_v3(subgraph_.get(), nullptr, nullptr, 0 /* flags */, &runtime_ptr));
+    runtime_.reset(runtime_ptr);
+
+    const xnn_external_value external_values[2] = {
+      {0, input_.data()},
+      {3, output_.data()},
+    };
+    ASSERT_EQ(xnn_status_success, xnn_setup_runtime(runtime_.get(), 2, external_values));
+    ASSERT_EQ(xnn_status_success, xnn_invoke_runtime(runtime_.get()));
+  }
+
+  const size_t num_elements_ = 3 * 67;
+  const int32_t zero_point_ = 5;
+  const float scale_ = 0.125f;
+  std::vector<int8_t> input_;
+  std::vector<float> output_;
+  std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph_{nullptr, xnn_delete_subgraph};
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime_{nullptr, xnn_delete_runtime};
+};
+
+TEST_F(RoundtripConvertTest, lossless_roundtrip_is_removed) {
+  ASSERT_NO_FATAL_FAILURE(Run(zero_point_, scale_));
+
+  // Only the final QS8->FP32 Convert Node remains, and it reads the original input.
+  ASSERT_EQ(1, CountNodes(subgraph_.get()));
+  const xnn_node* convert_node = &subgraph_->nodes[2];
+  ASSERT_EQ(xnn_node_type_convert, convert_node->type);
+  ASSERT_EQ(0, convert_node->inputs[0]);
+
+  for (size_t i = 0; i < num_elements_; i++) {
+    EXPECT_EQ(output_[i], float(int32_t(input_[i]) - zero_point_) * scale_) << "i = " << i;
+  }
+}
+
+TEST_F(RoundtripConvertTest, lossy_roundtrip_is_kept) {
+  // Requantization with a 2x larger scale rounds odd values.
+  const float roundtrip_scale = 2.0f * scale_;
+  ASSERT_NO_FATAL_FAILURE(Run(zero_point_, roundtrip_scale));
+
+  ASSERT_EQ(3, CountNodes(subgraph_.get(), xnn_node_type_convert));
+
+  for (size_t i = 0; i < num_elements_; i++) {
+    const float dequantized = float(int32_t(input_[i]) - zero_point_) * scale_;
+    const float requantized = std::min(std::max(
+      std::nearbyint(dequantized / roundtrip_scale) + float(zero_point_), -128.0f), 127.0f);
+    EXPECT_EQ(output_[i], (requantized - float(zero_point_)) * roundtrip_scale) << "i = " << i;
+  }
+}
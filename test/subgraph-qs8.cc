@@ -0,0 +1,164 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/subgraph.h>
+
+#include "subgraph-tester.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+// Input (0) -> Fully Connected -> 3 -> Add with Input (4) -> 5 -> Fully Connected -> Output (8)
+SubgraphTester CreateTester() {
+  SubgraphTester tester(9);
+  tester
+    .add_input_tensor({5, 32}, 0)
+    .add_tensor({24, 32}, kStaticDense, 1)
+    .add_tensor({24}, kStaticDense, 2)
+    .add_tensor({5, 24}, kDynamic, 3)
+    .add_input_tensor({5, 24}, 4)
+    .add_tensor({5, 24}, kDynamic, 5)
+    .add_tensor({16, 24}, kStaticDense, 6)
+    .add_tensor({16}, kStaticDense, 7)
+    .add_output_tensor({5, 16}, 8)
+    .add_fully_connected(0, 1, 2, 3)
+    .add_addition(3, 4, 5)
+    .add_fully_connected(5, 6, 7, 8);
+  return tester;
+}
+
+const uint32_t kDynamicValues[] = {0, 3, 4, 5, 8};
+
+// Runs the graph in FP32, and sets the observed ranges of the dynamic Values (except for skip_value_id) on the
+// Subgraph. Returns the FP32 output.
+std::vector<float> Calibrate(SubgraphTester& tester, uint32_t skip_value_id = XNN_INVALID_VALUE_ID) {
+  tester
+    .create_runtime(XNN_FLAG_COLLECT_VALUE_RANGES)
+    .randomize_input(0)
+    .randomize_input(4)
+    .invoke();
+  for (uint32_t value_id : kDynamicValues) {
+    if (value_id == skip_value_id) {
+      continue;
+    }
+    float min = 0.0f;
+    float max = 0.0f;
+    EXPECT_EQ(xnn_status_success, xnn_get_runtime_value_range(tester.runtime(), value_id, &min, &max));
+    EXPECT_EQ(xnn_status_success, xnn_set_subgraph_value_range(tester.subgraph(), value_id, min, max));
+  }
+  return std::vector<float>(tester.external_data(8).begin(), tester.external_data(8).begin() + 5 * 16);
+}
+
+size_t CountNodes(xnn_subgraph_t subgraph, xnn_node_type type, xnn_compute_type compute_type) {
+  size_t count = 0;
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    if (subgraph->nodes[n].type == type && subgraph->nodes[n].compute_type == compute_type) {
+      count += 1;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(SUBGRAPH_QS8, matches_fp32) {
+  SubgraphTester tester = CreateTester();
+  const std::vector<float> output_fp32 = Calibrate(tester);
+
+  tester
+    .create_runtime(XNN_FLAG_HINT_QS8_INFERENCE)
+    .invoke();
+
+  xnn_subgraph_t subgraph = tester.subgraph();
+  EXPECT_EQ(2, CountNodes(subgraph, xnn_node_type_fully_connected, xnn_compute_type_qc8));
+  EXPECT_EQ(1, CountNodes(subgraph, xnn_node_type_add2, xnn_compute_type_qs8));
+  EXPECT_EQ(2, CountNodes(subgraph, xnn_node_type_convert, xnn_compute_type_fp32_to_qs8));
+  EXPECT_EQ(1, CountNodes(subgraph, xnn_node_type_convert, xnn_compute_type_qs8_to_fp32));
+
+  // Every quantized Value adds up to half a quantization step of error, and the errors accumulate through the graph.
+  const float output_min = *std::min_element(output_fp32.begin(), output_fp32.end());
+  const float output_max = *std::max_element(output_fp32.begin(), output_fp32.end());
+  const float tolerance = 0.05f * (output_max - output_min);
+  const std::vector<float>& output_qs8 = tester.external_data(8);
+  for (size_t i = 0; i < output_fp32.size(); i++) {
+    EXPECT_NEAR(output_qs8[i], output_fp32[i], tolerance) << "i = " << i;
+  }
+}
+
+TEST(SUBGRAPH_QS8, value_without_range_stays_fp32) {
+  SubgraphTester tester = CreateTester();
+  const std::vector<float> output_fp32 = Calibrate(tester, 5 /* skip value */);
+
+  EXPECT_FALSE(xnn_subgraph_rewrite_for_qs8(tester.subgraph()));
+
+  tester
+    .create_runtime(XNN_FLAG_HINT_QS8_INFERENCE)
+    .invoke();
+
+  xnn_subgraph_t subgraph = tester.subgraph();
+  for (uint32_t n = 0; n < subgraph->num_nodes; n++) {
+    const xnn_node* node = &subgraph->nodes[n];
+    if (node->type != xnn_node_type_invalid) {
+      EXPECT_EQ(xnn_compute_type_fp32, node->compute_type) << "node #" << n;
+    }
+  }
+  for (uint32_t value_id : kDynamicValues) {
+    EXPECT_EQ(xnn_datatype_fp32, subgraph->values[value_id].datatype) << "value #" << value_id;
+  }
+
+  const std::vector<float>& output = tester.external_data(8);
+  for (size_t i = 0; i < output_fp32.size(); i++) {
+    EXPECT_EQ(output[i], output_fp32[i]) << "i = " << i;
+  }
+}
+
+TEST(SUBGRAPH_QS8, concatenate_inputs_with_different_scales) {
+  // Input (0) -> Maximum with Input (1) -> 2 -> Concatenate with Input (1) -> Output (3)
+  SubgraphTester tester(4);
+  tester
+    .add_input_tensor({5, 16}, 0)
+    .add_input_tensor({5, 16}, 1)
+    .add_tensor({5, 16}, kDynamic, 2)
+    .add_output_tensor({5, 32}, 3)
+    .add_maximum(0, 1, 2)
+    .add_concatenate(1, 2, 1, 3);
+
+  // Value 2 gets a narrower range than Value 1 and the output, so it is requantized, while Value 1 is copied as is.
+  tester
+    .create_runtime(XNN_FLAG_COLLECT_VALUE_RANGES)
+    .randomize_input(0, -0.5f, 0.5f)
+    .randomize_input(1, -4.0f, 4.0f)
+    .invoke();
+  for (uint32_t value_id : {0, 1, 2, 3}) {
+    float min = 0.0f;
+    float max = 0.0f;
+    EXPECT_EQ(xnn_status_success, xnn_get_runtime_value_range(tester.runtime(), value_id, &min, &max));
+    EXPECT_EQ(xnn_status_success, xnn_set_subgraph_value_range(tester.subgraph(), value_id, min, max));
+  }
+  const std::vector<float> output_fp32(tester.external_data(3).begin(), tester.external_data(3).begin() + 5 * 32);
+
+  tester
+    .create_runtime(XNN_FLAG_HINT_QS8_INFERENCE)
+    .invoke();
+
+  xnn_subgraph_t subgraph = tester.subgraph();
+  EXPECT_EQ(1, CountNodes(subgraph, xnn_node_type_maximum2, xnn_compute_type_qs8));
+  EXPECT_EQ(1, CountNodes(subgraph, xnn_node_type_concatenate2, xnn_compute_type_qs8));
+  EXPECT_NE(subgraph->values[2].quantization.scale, subgraph->values[3].quantization.scale);
+
+  const float output_min = *std::min_element(output_fp32.begin(), output_fp32.end());
+  const float output_max = *std::max_element(output_fp32.begin(), output_fp32.end());
+  const float tolerance = 0.02f * (output_max - output_min);
+  const std::vector<float>& output_qs8 = tester.external_data(3);
+  for (size_t i = 0; i < output_fp32.size(); i++) {
+    EXPECT_NEAR(output_qs8[i], output_fp32[i], tolerance) << "i = " << i;
+  }
+}
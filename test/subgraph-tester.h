@@ -13,6 +13,9 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <limits>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -71,6 +74,14 @@ class SubgraphTester {
     return *this;
   }
 
+  inline SubgraphTester& add_input_tensor(const std::vector<size_t>& dims, uint32_t external_id) {
+    return add_external_tensor(dims, external_id, XNN_VALUE_FLAG_EXTERNAL_INPUT);
+  }
+
+  inline SubgraphTester& add_output_tensor(const std::vector<size_t>& dims, uint32_t external_id) {
+    return add_external_tensor(dims, external_id, XNN_VALUE_FLAG_EXTERNAL_OUTPUT);
+  }
+
   inline SubgraphTester& add_conv(
       uint32_t input_padding_top, uint32_t input_padding_right,
       uint32_t input_padding_bottom, uint32_t input_padding_left,
@@ -127,6 +138,23 @@ class SubgraphTester {
     return *this;
   }
 
+  inline SubgraphTester& add_maximum(uint32_t input_id1, uint32_t input_id2, uint32_t output_id)
+  {
+    const xnn_status status = xnn_define_maximum2(subgraph_.get(), input_id1, input_id2, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& add_concatenate(size_t axis, uint32_t input_id1, uint32_t input_id2, uint32_t output_id)
+  {
+    const xnn_status status =
+        xnn_define_concatenate2(subgraph_.get(), axis, input_id1, input_id2, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   inline SubgraphTester& add_global_average_pooling(uint32_t input_id, uint32_t output_id)
   {
     const xnn_status status = xnn_define_global_average_pooling_2d(
@@ -137,6 +165,39 @@ class SubgraphTester {
     return *this;
   }
 
+  inline SubgraphTester& add_fully_connected(
+      uint32_t input_id, uint32_t filter_id, uint32_t bias_id, uint32_t output_id)
+  {
+    const xnn_status status = xnn_define_fully_connected(
+        subgraph_.get(), -std::numeric_limits<float>::infinity(),
+        std::numeric_limits<float>::infinity(), input_id, filter_id, bias_id,
+        output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& add_clamp(float output_min, float output_max, uint32_t input_id, uint32_t output_id)
+  {
+    const xnn_status status = xnn_define_clamp(
+        subgraph_.get(), output_min, output_max, input_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
+  inline SubgraphTester& add_static_slice(
+      const std::vector<size_t>& offsets, const std::vector<size_t>& sizes,
+      uint32_t input_id, uint32_t output_id)
+  {
+    assert(offsets.size() == sizes.size());
+    const xnn_status status = xnn_define_static_slice(
+        subgraph_.get(), offsets.size(), offsets.data(), sizes.data(), input_id, output_id, 0 /* flags */);
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
   inline SubgraphTester& optimize() {
     const xnn_status status = xnn_subgraph_optimize(subgraph_.get(), 0 /* flags */);
     EXPECT_EQ(status, xnn_status_success);
@@ -154,8 +215,69 @@ class SubgraphTester {
     return subgraph_->values[value_id].layout;
   }
 
+  inline xnn_subgraph_t subgraph() const {
+    return subgraph_.get();
+  }
+
+  inline xnn_runtime_t runtime() const {
+    return runtime_.get();
+  }
+
+  inline SubgraphTester& create_runtime(uint32_t flags = 0) {
+    xnn_runtime_t runtime_ptr = nullptr;
+    const xnn_status status = xnn_create_runtime_v3(subgraph_.get(), nullptr /* weights cache */,
+                                                    nullptr /* threadpool */, flags, &runtime_ptr);
+    EXPECT_EQ(status, xnn_status_success);
+    runtime_.reset(runtime_ptr);
+
+    return *this;
+  }
+
+  // Fills the external input Value with random data in [min, max) range.
+  inline SubgraphTester& randomize_input(uint32_t value_id, float min = -1.0f, float max = 1.0f) {
+    std::vector<float>& data = external_data_.at(value_id);
+    std::uniform_real_distribution<float> f32dist(min, max);
+    std::generate(data.begin(), data.end(), [&]() { return f32dist(rng_); });
+
+    return *this;
+  }
+
+  inline std::vector<float>& external_data(uint32_t value_id) {
+    return external_data_.at(value_id);
+  }
+
+  inline SubgraphTester& invoke() {
+    EXPECT_NE(runtime_.get(), nullptr);
+    std::vector<xnn_external_value> external_values;
+    for (auto& value : external_data_) {
+      external_values.push_back(xnn_external_value{value.first, value.second.data()});
+    }
+    xnn_status status = xnn_setup_runtime(runtime_.get(), external_values.size(), external_values.data());
+    EXPECT_EQ(status, xnn_status_success);
+    status = xnn_invoke_runtime(runtime_.get());
+    EXPECT_EQ(status, xnn_status_success);
+
+    return *this;
+  }
+
  private:
+  inline SubgraphTester& add_external_tensor(const std::vector<size_t>& dims, uint32_t external_id, uint32_t flags) {
+    const size_t num_elements = std::accumulate(std::begin(dims), std::end(dims), size_t(1), std::multiplies<size_t>());
+    external_data_[external_id] = std::vector<float>(num_elements + XNN_EXTRA_BYTES / sizeof(float));
+    uint32_t id_out = 0;
+    const xnn_status status =
+        xnn_define_tensor_value(subgraph_.get(), xnn_datatype_fp32, dims.size(),
+                                dims.data(), nullptr, external_id, flags, &id_out);
+    EXPECT_EQ(status, xnn_status_success);
+    EXPECT_EQ(id_out, external_id);
+
+    return *this;
+  }
+
   std::vector<std::vector<float>> static_data_;
+  std::map<uint32_t, std::vector<float>> external_data_;
   std::unique_ptr<xnn_subgraph, decltype(&xnn_delete_subgraph)> subgraph_{nullptr, xnn_delete_subgraph};
+  // Runtime is declared after the subgraph, and is destroyed first.
+  std::unique_ptr<xnn_runtime, decltype(&xnn_delete_runtime)> runtime_{nullptr, xnn_delete_runtime};
   std::mt19937 rng_;
 };
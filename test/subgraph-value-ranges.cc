@@ -0,0 +1,130 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <xnnpack.h>
+
+#include "subgraph-tester.h"
+#include <gtest/gtest.h>
+
+namespace {
+
+struct Range {
+  float min = INFINITY;
+  float max = -INFINITY;
+
+  void update(const float* data, size_t size) {
+    min = std::min(min, *std::min_element(data, data + size));
+    max = std::max(max, *std::max_element(data, data + size));
+  }
+};
+
+// Input (0) -> Clamp -> 2 -> Slice (view) -> 3 -> Add with Input (1) -> Output (4)
+SubgraphTester CreateTester() {
+  SubgraphTester tester(5);
+  tester
+    .add_input_tensor({4, 16}, 0)
+    .add_input_tensor({2, 16}, 1)
+    .add_tensor({4, 16}, kDynamic, 2)
+    .add_tensor({2, 16}, kDynamic, 3)
+    .add_output_tensor({2, 16}, 4)
+    .add_clamp(-0.5f, 0.75f, 0, 2)
+    .add_static_slice({2, 0}, {2, 16}, 2, 3)
+    .add_addition(3, 1, 4);
+  return tester;
+}
+
+void ExpectRange(xnn_runtime_t runtime, uint32_t value_id, const Range& expected) {
+  float min = 0.0f;
+  float max = 0.0f;
+  ASSERT_EQ(xnn_status_success, xnn_get_runtime_value_range(runtime, value_id, &min, &max));
+  EXPECT_EQ(min, expected.min) << "value #" << value_id;
+  EXPECT_EQ(max, expected.max) << "value #" << value_id;
+}
+
+}  // namespace
+
+TEST(SUBGRAPH_VALUE_RANGES, accumulate_over_runs) {
+  SubgraphTester tester = CreateTester();
+  tester.create_runtime(XNN_FLAG_COLLECT_VALUE_RANGES);
+  ASSERT_TRUE(tester.runtime()->blobs[3].view);
+
+  Range ranges[5];
+  // The second run uses a wider input range, so both the minimum and the maximum of the first run are extended.
+  const float input_scales[2] = {0.5f, 2.0f};
+  for (float input_scale : input_scales) {
+    tester
+      .randomize_input(0, -input_scale, input_scale)
+      .randomize_input(1, -input_scale, input_scale)
+      .invoke();
+
+    const std::vector<float>& input0 = tester.external_data(0);
+    const std::vector<float>& input1 = tester.external_data(1);
+    const std::vector<float>& output = tester.external_data(4);
+    std::vector<float> clamped(4 * 16);
+    std::transform(input0.begin(), input0.begin() + 4 * 16, clamped.begin(),
+      [](float x) { return std::min(std::max(x, -0.5f), 0.75f); });
+    ranges[0].update(input0.data(), 4 * 16);
+    ranges[1].update(input1.data(), 2 * 16);
+    ranges[2].update(clamped.data(), 4 * 16);
+    // The view gets the range of the whole Value it aliases.
+    ranges[3].update(clamped.data(), 4 * 16);
+    ranges[4].update(output.data(), 2 * 16);
+
+    for (uint32_t value_id = 0; value_id < 5; value_id++) {
+      ExpectRange(tester.runtime(), value_id, ranges[value_id]);
+    }
+  }
+}
+
+TEST(SUBGRAPH_VALUE_RANGES, reset) {
+  SubgraphTester tester = CreateTester();
+  tester
+    .create_runtime(XNN_FLAG_COLLECT_VALUE_RANGES)
+    .randomize_input(0, -4.0f, 4.0f)
+    .randomize_input(1, -4.0f, 4.0f)
+    .invoke();
+
+  ASSERT_EQ(xnn_status_success, xnn_reset_runtime_value_ranges(tester.runtime()));
+  for (uint32_t value_id = 0; value_id < 5; value_id++) {
+    ExpectRange(tester.runtime(), value_id, Range());
+  }
+
+  tester
+    .randomize_input(0, -0.25f, 0.25f)
+    .randomize_input(1, -0.25f, 0.25f)
+    .invoke();
+
+  Range input_range;
+  input_range.update(tester.external_data(0).data(), 4 * 16);
+  ExpectRange(tester.runtime(), 0, input_range);
+}
+
+TEST(SUBGRAPH_VALUE_RANGES, not_collected) {
+  SubgraphTester tester = CreateTester();
+  tester
+    .create_runtime()
+    .randomize_input(0)
+    .randomize_input(1)
+    .invoke();
+
+  float min = 0.0f;
+  float max = 0.0f;
+  EXPECT_EQ(xnn_status_invalid_state, xnn_get_runtime_value_range(tester.runtime(), 0, &min, &max));
+  EXPECT_EQ(xnn_status_invalid_state, xnn_reset_runtime_value_ranges(tester.runtime()));
+}
+
+TEST(SUBGRAPH_VALUE_RANGES, invalid_value_id) {
+  SubgraphTester tester = CreateTester();
+  tester.create_runtime(XNN_FLAG_COLLECT_VALUE_RANGES);
+
+  float min = 0.0f;
+  float max = 0.0f;
+  EXPECT_EQ(xnn_status_invalid_parameter, xnn_get_runtime_value_range(tester.runtime(), 5, &min, &max));
+}
@@ -0,0 +1,147 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <gtest/gtest.h>
+
+#include "topk-operator-tester.h"
+
+
+TEST(TOPK_NC_F32, k_eq_channels) {
+  for (size_t channels = 1; channels < 32; channels++) {
+    TopKOperatorTester()
+      .batch_size(1)
+      .channels(channels)
+      .k(channels)
+      .iterations(1)
+      .TestTopKF32();
+  }
+}
+
+TEST(TOPK_NC_F32, small_channels) {
+  for (size_t channels = 2; channels < 200; channels += 3) {
+    for (size_t k : {1, 2, 5}) {
+      if (k > channels) {
+        continue;
+      }
+      TopKOperatorTester()
+        .batch_size(1)
+        .channels(channels)
+        .k(k)
+        .iterations(1)
+        .TestTopKF32();
+    }
+  }
+}
+
+TEST(TOPK_NC_F32, small_channels_with_ties) {
+  for (size_t channels = 2; channels < 200; channels += 3) {
+    for (size_t k : {1, 2, 5}) {
+      if (k > channels) {
+        continue;
+      }
+      TopKOperatorTester()
+        .batch_size(1)
+        .channels(channels)
+        .k(k)
+        .ties(true)
+        .iterations(1)
+        .TestTopKF32();
+    }
+  }
+}
+
+TEST(TOPK_NC_F32, large_channels) {
+  for (size_t channels : {4095, 4096, 4097, 10000, 50001}) {
+    for (size_t k : {1, 3, 10, 100}) {
+      TopKOperatorTester()
+        .batch_size(1)
+        .channels(channels)
+        .k(k)
+        .TestTopKF32();
+    }
+  }
+}
+
+TEST(TOPK_NC_F32, large_channels_with_ties) {
+  for (size_t channels : {4097, 10000}) {
+    for (size_t k : {1, 3, 10, 100}) {
+      TopKOperatorTester()
+        .batch_size(3)
+        .channels(channels)
+        .k(k)
+        .ties(true)
+        .TestTopKF32();
+    }
+  }
+}
+
+TEST(TOPK_NC_F32, large_k) {
+  // Blocks grow to hold at least k elements.
+  for (size_t k : {4000, 4096, 5000, 9999}) {
+    TopKOperatorTester()
+      .batch_size(2)
+      .channels(10000)
+      .k(k)
+      .iterations(1)
+      .TestTopKF32();
+  }
+}
+
+TEST(TOPK_NC_F32, small_batch_with_input_stride) {
+  for (size_t channels = 5; channels < 100; channels += 7) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(channels)
+      .k(5)
+      .input_stride(129)
+      .iterations(1)
+      .TestTopKF32();
+  }
+}
+
+TEST(TOPK_NC_F32, large_channels_with_input_stride) {
+  TopKOperatorTester()
+    .batch_size(3)
+    .channels(10000)
+    .k(10)
+    .input_stride(10013)
+    .TestTopKF32();
+}
+
+TEST(TOPK_NC_F32, multithreaded) {
+  for (size_t batch_size : {1, 2, 7}) {
+    TopKOperatorTester()
+      .batch_size(batch_size)
+      .channels(10000)
+      .k(10)
+      .num_threads(4)
+      .TestTopKF32();
+  }
+}
+
+TEST(TOPK_NC_F32, with_nans) {
+  for (size_t channels : {10, 100, 4097, 10000}) {
+    for (size_t nans : {1, 3, 50}) {
+      TopKOperatorTester()
+        .batch_size(3)
+        .channels(channels)
+        .k(10)
+        .nans(nans)
+        .TestTopKF32();
+    }
+  }
+}
+
+TEST(TOPK_NC_F32, with_nans_and_ties) {
+  for (size_t nans : {1, 20}) {
+    TopKOperatorTester()
+      .batch_size(3)
+      .channels(10000)
+      .k(10)
+      .ties(true)
+      .nans(nans)
+      .TestTopKF32();
+  }
+}
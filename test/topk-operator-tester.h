@@ -0,0 +1,388 @@
+// Copyright 2023 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <fp16.h>
+
+#include <xnnpack.h>
+
+
+class TopKOperatorTester {
+ public:
+  inline TopKOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline TopKOperatorTester& input_stride(size_t input_stride) {
+    assert(input_stride != 0);
+    this->input_stride_ = input_stride;
+    return *this;
+  }
+
+  inline size_t input_stride() const {
+    if (this->input_stride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->input_stride_ >= this->channels_);
+      return this->input_stride_;
+    }
+  }
+
+  inline TopKOperatorTester& batch_size(size_t batch_size) {
+    assert(batch_size != 0);
+    this->batch_size_ = batch_size;
+    return *this;
+  }
+
+  inline size_t batch_size() const {
+    return this->batch_size_;
+  }
+
+  inline TopKOperatorTester& k(size_t k) {
+    assert(k != 0);
+    this->k_ = k;
+    return *this;
+  }
+
+  inline size_t k() const {
+    return this->k_;
+  }
+
+  // When set, input elements are drawn from a small set of integers, so rows contain many equal elements.
+  inline TopKOperatorTester& ties(bool ties) {
+    this->ties_ = ties;
+    return *this;
+  }
+
+  inline bool ties() const {
+    return this->ties_;
+  }
+
+  // Number of NaN elements at random positions of every row.
+  inline TopKOperatorTester& nans(size_t nans) {
+    this->nans_ = nans;
+    return *this;
+  }
+
+  inline size_t nans() const {
+    return this->nans_;
+  }
+
+  inline TopKOperatorTester& num_threads(size_t num_threads) {
+    assert(num_threads != 0);
+    this->num_threads_ = num_threads;
+    return *this;
+  }
+
+  inline size_t num_threads() const {
+    return this->num_threads_;
+  }
+
+  inline TopKOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void TestArgMaxF16() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-10.0f, 10.0f);
+    std::uniform_int_distribution<int32_t> tiesdist(-3, 3);
+
+    std::vector<uint16_t> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<int32_t> output(batch_size());
+    std::vector<int32_t> output_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() {
+        return fp16_ieee_from_fp32_value(ties() ? float(tiesdist(rng)) : f32dist(rng));
+      });
+      InsertNaNs<uint16_t>(rng, input.data(), UINT16_C(0x7E00));
+      std::fill(output.begin(), output.end(), INT32_C(-1));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        size_t max_index = 0;
+        for (size_t c = 1; c < channels(); c++) {
+          if (Greater(fp16_ieee_to_fp32_value(input[i * input_stride() + c]),
+                      fp16_ieee_to_fp32_value(input[i * input_stride() + max_index])))
+          {
+            max_index = c;
+          }
+        }
+        output_ref[i] = int32_t(max_index);
+      }
+
+      // Create, setup, run, and destroy ArgMax operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t argmax_op = nullptr;
+
+      const xnn_status status = xnn_create_argmax_nc_f16(
+          channels(), input_stride(),
+          0, &argmax_op);
+      if (status == xnn_status_unsupported_hardware) {
+        GTEST_SKIP();
+      }
+      ASSERT_EQ(xnn_status_success, status);
+      ASSERT_NE(nullptr, argmax_op);
+
+      // Smart pointer to automatically delete argmax_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_argmax_op(argmax_op, xnn_delete_operator);
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+      if (num_threads() > 1) {
+        auto_threadpool.reset(pthreadpool_create(num_threads()));
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_argmax_nc_f16(
+          argmax_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(argmax_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(output[i], output_ref[i])
+          << "batch index " << i << " / " << batch_size() << ", channels = " << channels();
+      }
+    }
+  }
+
+  void TestArgMaxF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-10.0f, 10.0f);
+    std::uniform_int_distribution<int32_t> tiesdist(-3, 3);
+
+    std::vector<float> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<int32_t> output(batch_size());
+    std::vector<int32_t> output_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return ties() ? float(tiesdist(rng)) : f32dist(rng); });
+      InsertNaNs(rng, input.data(), std::nanf(""));
+      std::fill(output.begin(), output.end(), INT32_C(-1));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float* row = input.data() + i * input_stride();
+        output_ref[i] = int32_t(std::max_element(row, row + channels(),
+          [](float a, float b) { return Greater(b, a); }) - row);
+      }
+
+      // Create, setup, run, and destroy ArgMax operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t argmax_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_argmax_nc_f32(
+          channels(), input_stride(),
+          0, &argmax_op));
+      ASSERT_NE(nullptr, argmax_op);
+
+      // Smart pointer to automatically delete argmax_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_argmax_op(argmax_op, xnn_delete_operator);
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+      if (num_threads() > 1) {
+        auto_threadpool.reset(pthreadpool_create(num_threads()));
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_argmax_nc_f32(
+          argmax_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(argmax_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(output[i], output_ref[i])
+          << "batch index " << i << " / " << batch_size() << ", channels = " << channels();
+      }
+    }
+  }
+
+  void TestArgMaxQS8() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<int32_t> i8dist(
+      std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max());
+    std::uniform_int_distribution<int32_t> tiesdist(-3, 3);
+
+    std::vector<int8_t> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int32_t> output(batch_size());
+    std::vector<int32_t> output_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return int8_t(ties() ? tiesdist(rng) : i8dist(rng)); });
+      std::fill(output.begin(), output.end(), INT32_C(-1));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const int8_t* row = input.data() + i * input_stride();
+        output_ref[i] = int32_t(std::max_element(row, row + channels()) - row);
+      }
+
+      // Create, setup, run, and destroy ArgMax operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t argmax_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_argmax_nc_qs8(
+          channels(), input_stride(),
+          0, &argmax_op));
+      ASSERT_NE(nullptr, argmax_op);
+
+      // Smart pointer to automatically delete argmax_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_argmax_op(argmax_op, xnn_delete_operator);
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+      if (num_threads() > 1) {
+        auto_threadpool.reset(pthreadpool_create(num_threads()));
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_argmax_nc_qs8(
+          argmax_op,
+          batch_size(),
+          input.data(), output.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(argmax_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(output[i], output_ref[i])
+          << "batch index " << i << " / " << batch_size() << ", channels = " << channels();
+      }
+    }
+  }
+
+  void TestTopKF32() const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-10.0f, 10.0f);
+    std::uniform_int_distribution<int32_t> tiesdist(-3, 3);
+
+    std::vector<float> input((batch_size() - 1) * input_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> output_values(batch_size() * k());
+    std::vector<int32_t> output_indices(batch_size() * k());
+    std::vector<int32_t> output_indices_ref(batch_size() * k());
+    std::vector<int32_t> order(channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return ties() ? float(tiesdist(rng)) : f32dist(rng); });
+      InsertNaNs(rng, input.data(), std::nanf(""));
+      std::fill(output_values.begin(), output_values.end(), std::nanf(""));
+      std::fill(output_indices.begin(), output_indices.end(), INT32_C(-1));
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float* row = input.data() + i * input_stride();
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [row](int32_t a, int32_t b) { return Greater(row[a], row[b]); });
+        std::copy(order.cbegin(), order.cbegin() + k(), output_indices_ref.begin() + i * k());
+      }
+
+      // Create, setup, run, and destroy TopK operator.
+      ASSERT_EQ(xnn_status_success, xnn_initialize(nullptr /* allocator */));
+      xnn_operator_t topk_op = nullptr;
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_create_topk_nc_f32(
+          channels(), input_stride(), k(),
+          0, &topk_op));
+      ASSERT_NE(nullptr, topk_op);
+
+      // Smart pointer to automatically delete topk_op.
+      std::unique_ptr<xnn_operator, decltype(&xnn_delete_operator)> auto_topk_op(topk_op, xnn_delete_operator);
+
+      std::unique_ptr<pthreadpool, decltype(&pthreadpool_destroy)> auto_threadpool(nullptr, pthreadpool_destroy);
+      if (num_threads() > 1) {
+        auto_threadpool.reset(pthreadpool_create(num_threads()));
+      }
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_setup_topk_nc_f32(
+          topk_op,
+          batch_size(),
+          input.data(), output_values.data(), output_indices.data(),
+          auto_threadpool.get()));
+
+      ASSERT_EQ(xnn_status_success,
+        xnn_run_operator(topk_op, auto_threadpool.get()));
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        for (size_t j = 0; j < k(); j++) {
+          const int32_t index_ref = output_indices_ref[i * k() + j];
+          ASSERT_EQ(output_indices[i * k() + j], index_ref)
+            << "batch index " << i << " / " << batch_size() << ", position " << j << " / " << k()
+            << ", channels = " << channels();
+          const float value_ref = input[i * input_stride() + index_ref];
+          ASSERT_TRUE(output_values[i * k() + j] == value_ref ||
+                      (std::isnan(output_values[i * k() + j]) && std::isnan(value_ref)))
+            << "batch index " << i << " / " << batch_size() << ", position " << j << " / " << k()
+            << ", channels = " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  // Order of elements expected from the operators: NaN is greater than any other value.
+  static bool Greater(float a, float b) {
+    return a > b || (std::isnan(a) && !std::isnan(b));
+  }
+
+  template <class T>
+  void InsertNaNs(std::mt19937& rng, T* input, T nan) const {
+    std::uniform_int_distribution<size_t> channel_dist(0, channels() - 1);
+    for (size_t i = 0; i < batch_size(); i++) {
+      for (size_t n = 0; n < nans(); n++) {
+        input[i * input_stride() + channel_dist(rng)] = nan;
+      }
+    }
+  }
+
+  size_t batch_size_{1};
+  size_t channels_{1};
+  size_t input_stride_{0};
+  size_t k_{1};
+  bool ties_{false};
+  size_t nans_{0};
+  size_t num_threads_{1};
+  size_t iterations_{3};
+};
@@ -8,10 +8,125 @@
 
 #include <gtest/gtest.h>
 
+#include <xnnpack/common.h>
+#include <xnnpack/isa-checks.h>
+
 #include <xnnpack/lut.h>
 #include "lut-norm-microkernel-tester.h"
 
 
+#if XNN_ARCH_ARM || XNN_ARCH_ARM64
+  TEST(U8_LUT32NORM__NEON, n_eq_1) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTNormMicrokernelTester()
+      .n(1)
+      .Test(xnn_u8_lut32norm_ukernel__neon);
+  }
+
+  TEST(U8_LUT32NORM__NEON, small_n) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 2; n <= 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, large_n) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n <= 128; n+=2) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, n_eq_1_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTNormMicrokernelTester()
+      .n(1)
+      .inplace(true)
+      .Test(xnn_u8_lut32norm_ukernel__neon);
+  }
+
+  TEST(U8_LUT32NORM__NEON, small_n_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 2; n <= 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+
+  TEST(U8_LUT32NORM__NEON, large_n_inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n <= 128; n+=2) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__neon);
+    }
+  }
+#endif  // XNN_ARCH_ARM || XNN_ARCH_ARM64
+
+
+#if XNN_ARCH_X86 || XNN_ARCH_X86_64
+  TEST(U8_LUT32NORM__AVX2, n_eq_1) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTNormMicrokernelTester()
+      .n(1)
+      .Test(xnn_u8_lut32norm_ukernel__avx2);
+  }
+
+  TEST(U8_LUT32NORM__AVX2, small_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n <= 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__avx2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__AVX2, large_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n <= 128; n+=2) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .Test(xnn_u8_lut32norm_ukernel__avx2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__AVX2, n_eq_1_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTNormMicrokernelTester()
+      .n(1)
+      .inplace(true)
+      .Test(xnn_u8_lut32norm_ukernel__avx2);
+  }
+
+  TEST(U8_LUT32NORM__AVX2, small_n_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n <= 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__avx2);
+    }
+  }
+
+  TEST(U8_LUT32NORM__AVX2, large_n_inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n <= 128; n+=2) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .Test(xnn_u8_lut32norm_ukernel__avx2);
+    }
+  }
+#endif  // XNN_ARCH_X86 || XNN_ARCH_X86_64
+
+
 TEST(U8_LUT32NORM__SCALAR, n_eq_1) {
   LUTNormMicrokernelTester()
     .n(1)
@@ -9,9 +9,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <functional>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -55,6 +57,66 @@ class VBinaryCMicrokernelTester {
     return this->inplace_;
   }
 
+  inline VBinaryCMicrokernelTester& a_scale(float a_scale) {
+    assert(a_scale > 0.0f);
+    assert(std::isnormal(a_scale));
+    this->a_scale_ = a_scale;
+    return *this;
+  }
+
+  inline float a_scale() const {
+    return this->a_scale_;
+  }
+
+  inline VBinaryCMicrokernelTester& a_zero_point(uint8_t a_zero_point) {
+    this->a_zero_point_ = a_zero_point;
+    return *this;
+  }
+
+  inline uint8_t a_zero_point() const {
+    return this->a_zero_point_;
+  }
+
+  inline VBinaryCMicrokernelTester& b_scale(float b_scale) {
+    assert(b_scale > 0.0f);
+    assert(std::isnormal(b_scale));
+    this->b_scale_ = b_scale;
+    return *this;
+  }
+
+  inline float b_scale() const {
+    return this->b_scale_;
+  }
+
+  inline VBinaryCMicrokernelTester& b_zero_point(uint8_t b_zero_point) {
+    this->b_zero_point_ = b_zero_point;
+    return *this;
+  }
+
+  inline uint8_t b_zero_point() const {
+    return this->b_zero_point_;
+  }
+
+  inline VBinaryCMicrokernelTester& y_scale(float y_scale) {
+    assert(y_scale > 0.0f);
+    assert(std::isnormal(y_scale));
+    this->y_scale_ = y_scale;
+    return *this;
+  }
+
+  inline float y_scale() const {
+    return this->y_scale_;
+  }
+
+  inline VBinaryCMicrokernelTester& y_zero_point(uint8_t y_zero_point) {
+    this->y_zero_point_ = y_zero_point;
+    return *this;
+  }
+
+  inline uint8_t y_zero_point() const {
+    return this->y_zero_point_;
+  }
+
   inline VBinaryCMicrokernelTester& qmin(uint8_t qmin) {
     this->qmin_ = qmin;
     return *this;
@@ -450,9 +512,107 @@ class VBinaryCMicrokernelTester {
     }
   }
 
+  void Test(xnn_qs8_vbinary_minmax_ukernel_function vbinaryc_minmax, OpType op_type, xnn_init_qs8_binary_minmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()), rng);
+
+    std::vector<int8_t> a(batch_size() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(int8_t) : 0));
+    std::vector<float> y_fp(batch_size());
+    const int8_t a_zero_point = int8_t(this->a_zero_point() - 0x80);
+    const int8_t b_zero_point = int8_t(this->b_zero_point() - 0x80);
+    const int8_t y_zero_point = int8_t(this->y_zero_point() - 0x80);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(i8rng));
+      int8_t b = int8_t(i8rng());
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(i8rng));
+      } else {
+        std::fill(y.begin(), y.end(), 0xA5);
+      }
+      // Avoid division by zero: the result of 0 / 0 is undefined.
+      if (op_type == OpType::DivC && b == b_zero_point) {
+        b = int8_t(b_zero_point ^ 1);
+      }
+      if (op_type == OpType::RDivC) {
+        int8_t* a_divisor = inplace() ? y.data() : a.data();
+        std::replace(a_divisor, a_divisor + batch_size(), a_zero_point, int8_t(a_zero_point ^ 1));
+      }
+      const int8_t* a_data = inplace() ? y.data() : a.data();
+
+      // Prepare parameters.
+      xnn_qs8_binary_minmax_params quantization_params;
+      init_params(
+        &quantization_params,
+        a_zero_point, b_zero_point, y_zero_point,
+        a_scale(), b_scale(), y_scale(),
+        int8_t(qmin() - 0x80), int8_t(qmax() - 0x80));
+
+      // Compute reference results.
+      const float b_value = float(int32_t(b) - int32_t(b_zero_point)) * b_scale();
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float a_value = float(int32_t(a_data[i]) - int32_t(a_zero_point)) * a_scale();
+        float y_value = 0.0f;
+        switch (op_type) {
+          case OpType::AddC:
+            y_value = a_value + b_value;
+            break;
+          case OpType::DivC:
+            y_value = a_value / b_value;
+            break;
+          case OpType::RDivC:
+            y_value = b_value / a_value;
+            break;
+          case OpType::MaxC:
+            y_value = std::max<float>(a_value, b_value);
+            break;
+          case OpType::MinC:
+            y_value = std::min<float>(a_value, b_value);
+            break;
+          case OpType::MulC:
+            y_value = a_value * b_value;
+            break;
+          case OpType::SqrDiffC:
+            y_value = (a_value - b_value) * (a_value - b_value);
+            break;
+          case OpType::SubC:
+            y_value = a_value - b_value;
+            break;
+          case OpType::RSubC:
+            y_value = b_value - a_value;
+            break;
+        }
+        y_fp[i] = float(int32_t(y_zero_point)) + y_value / y_scale();
+        y_fp[i] = std::min<float>(y_fp[i], float(int32_t(qmax() - 0x80)));
+        y_fp[i] = std::max<float>(y_fp[i], float(int32_t(qmin() - 0x80)));
+      }
+
+      // Call optimized micro-kernel.
+      vbinaryc_minmax(batch_size(), a_data, &b, y.data(), &quantization_params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_LE(int32_t(y[i]), int32_t(qmax() - 0x80))
+          << "at element " << i << " / " << batch_size();
+        ASSERT_GE(int32_t(y[i]), int32_t(qmin() - 0x80))
+          << "at element " << i << " / " << batch_size();
+        ASSERT_NEAR(float(int32_t(y[i])), y_fp[i], 0.6f)
+          << "at element " << i << " / " << batch_size();
+      }
+    }
+  }
+
  private:
   size_t batch_size_{1};
   bool inplace_{false};
+  float a_scale_{0.75f};
+  uint8_t a_zero_point_{121};
+  float b_scale_{1.25f};
+  uint8_t b_zero_point_{127};
+  float y_scale_{0.96875f};
+  uint8_t y_zero_point_{133};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
   size_t iterations_{15};
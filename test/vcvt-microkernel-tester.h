@@ -20,6 +20,7 @@
 #include <fp16.h>
 
 #include <xnnpack.h>
+#include <xnnpack/math.h>
 #include <xnnpack/params.h>
 #include <xnnpack/params-init.h>
 
@@ -140,6 +141,57 @@ class VCvtMicrokernelTester {
     }
   }
 
+  void Test(xnn_bf16_f32_vcvt_ukernel_function vcvt) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_int_distribution<uint32_t> u16dist(0, std::numeric_limits<uint16_t>::max());
+
+    std::vector<uint16_t> input(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<float> output(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return uint16_t(u16dist(rng)); });
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Call optimized micro-kernel.
+      vcvt(batch_size() * sizeof(uint16_t), input.data(), output.data(), nullptr);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(fp32_to_bits(output[i]), uint32_t(input[i]) << 16)
+          << "at " << i << " / " << batch_size()
+          << ", x[" << i << "] = 0x" << std::hex << std::setw(4) << std::setfill('0') << input[i];
+      }
+    }
+  }
+
+  void Test(xnn_f32_bf16_vcvt_ukernel_function vcvt) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-100.0f, 100.0f);
+
+    std::vector<float> input(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<uint16_t> output(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      if (batch_size() > 1) {
+        input[0] = std::numeric_limits<float>::infinity();
+        input[1] = nanf("");
+      }
+      std::fill(output.begin(), output.end(), UINT16_C(0x7FC0) /* NaN */);
+
+      // Call optimized micro-kernel.
+      vcvt(batch_size() * sizeof(float), input.data(), output.data(), nullptr);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_EQ(output[i], math_cvt_bf16_fp32(input[i]))
+          << "at " << i << " / " << batch_size()
+          << ", x[" << i << "] = 0x" << std::hex << std::setw(8) << std::setfill('0') << fp32_to_bits(input[i])
+          << " (" << input[i] << ")";
+      }
+    }
+  }
+
   void Test(xnn_f32_qs8_vcvt_ukernel_function vcvt, xnn_init_f32_qs8_cvt_params_fn init_params) const {
     ASSERT_GE(qmin(), std::numeric_limits<int8_t>::min());
     ASSERT_LE(qmax(), std::numeric_limits<int8_t>::max());
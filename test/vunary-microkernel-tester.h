@@ -9,8 +9,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
+#include <limits>
 #include <random>
 #include <vector>
 
@@ -91,6 +94,46 @@ class VUnaryMicrokernelTester {
     return this->beta_;
   }
 
+  inline VUnaryMicrokernelTester& input_scale(float input_scale) {
+    assert(input_scale > 0.0f);
+    assert(std::isnormal(input_scale));
+    this->input_scale_ = input_scale;
+    return *this;
+  }
+
+  inline float input_scale() const {
+    return this->input_scale_;
+  }
+
+  inline VUnaryMicrokernelTester& input_zero_point(int16_t input_zero_point) {
+    this->input_zero_point_ = input_zero_point;
+    return *this;
+  }
+
+  inline int16_t input_zero_point() const {
+    return this->input_zero_point_;
+  }
+
+  inline VUnaryMicrokernelTester& output_scale(float output_scale) {
+    assert(output_scale > 0.0f);
+    assert(std::isnormal(output_scale));
+    this->output_scale_ = output_scale;
+    return *this;
+  }
+
+  inline float output_scale() const {
+    return this->output_scale_;
+  }
+
+  inline VUnaryMicrokernelTester& output_zero_point(int16_t output_zero_point) {
+    this->output_zero_point_ = output_zero_point;
+    return *this;
+  }
+
+  inline int16_t output_zero_point() const {
+    return this->output_zero_point_;
+  }
+
   inline VUnaryMicrokernelTester& qmin(uint8_t qmin) {
     this->qmin_ = qmin;
     return *this;
@@ -271,6 +314,162 @@ class VUnaryMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_vexp_ukernel_function vexp, xnn_init_f16_exp_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-10.0f, 10.0f);
+
+    std::vector<uint16_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = std::exp(fp16_ieee_to_fp32_value(x_data[i]));
+      }
+
+      // Prepare parameters.
+      union xnn_f16_exp_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vexp(batch_size() * sizeof(uint16_t), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(
+            fp16_ieee_to_fp32_value(y[i]),
+            y_ref[i],
+            std::max(1.0e-3f, std::abs(y_ref[i]) * 1.0e-2f))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << fp16_ieee_to_fp32_value(x_data[i]);
+      }
+    }
+  }
+
+  void Test(xnn_f32_vexp_ukernel_function vexp, xnn_init_f32_exp_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-100.0f, 88.0f);
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return f32dist(rng); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return f32dist(rng); });
+        std::fill(y.begin(), y.end(), nanf(""));
+      }
+      const float* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = std::exp(double(x_data[i]));
+      }
+
+      // Prepare parameters.
+      union xnn_f32_exp_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vexp(batch_size() * sizeof(float), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(double(std::numeric_limits<float>::min()), std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i];
+      }
+    }
+  }
+
+  void Test(xnn_f16_vgelu_ukernel_function vgelu, xnn_init_f16_gelu_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-10.0f, 10.0f);
+
+    std::vector<uint16_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float x_i = fp16_ieee_to_fp32_value(x_data[i]);
+        y_ref[i] = 0.5f * x_i * (1.0f + std::tanh(std::sqrt(2.0f / float(M_PI)) * (x_i + 0.044715f * x_i * x_i * x_i)));
+      }
+
+      // Prepare parameters.
+      union xnn_f16_gelu_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vgelu(batch_size() * sizeof(uint16_t), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(
+            fp16_ieee_to_fp32_value(y[i]),
+            y_ref[i],
+            std::max(1.0e-3f, std::abs(y_ref[i]) * 1.0e-2f))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << fp16_ieee_to_fp32_value(x_data[i]);
+      }
+    }
+  }
+
+  void Test(xnn_f32_vgelu_ukernel_function vgelu, xnn_init_f32_gelu_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-10.0f, 10.0f);
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return f32dist(rng); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return f32dist(rng); });
+        std::fill(y.begin(), y.end(), nanf(""));
+      }
+      const float* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const double x_i = double(x_data[i]);
+        y_ref[i] = 0.5 * x_i * (1.0 + std::tanh(std::sqrt(2.0 / M_PI) * (x_i + 0.044715 * x_i * x_i * x_i)));
+      }
+
+      // Prepare parameters.
+      union xnn_f32_gelu_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vgelu(batch_size() * sizeof(float), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(5.0e-6, std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i];
+      }
+    }
+  }
+
   void Test(xnn_f32_vhswish_ukernel_function vhswish, xnn_init_f32_hswish_params_fn init_params) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -308,6 +507,166 @@ class VUnaryMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_vlayernorm_ukernel_function vlayernorm) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-5.0f, 5.0f), std::ref(rng));
+    auto f16rng = std::bind(fp16_ieee_from_fp32_value, f32rng);
+    auto stddev_rng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), std::ref(rng));
+
+    std::vector<uint16_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> gamma(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> beta(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(f16rng));
+      } else {
+        std::generate(x.begin(), x.end(), std::ref(f16rng));
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      std::generate(gamma.begin(), gamma.end(), std::ref(f16rng));
+      std::generate(beta.begin(), beta.end(), std::ref(f16rng));
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+      const float stats[2] = { f32rng(), 1.0f / stddev_rng() };
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float x_value = fp16_ieee_to_fp32_value(x_data[i]);
+        y_ref[i] = (x_value - stats[0]) * stats[1] * fp16_ieee_to_fp32_value(gamma[i]) + fp16_ieee_to_fp32_value(beta[i]);
+      }
+
+      // Call optimized micro-kernel.
+      vlayernorm(batch_size() * sizeof(uint16_t), x_data, stats, gamma.data(), beta.data(), y.data());
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(
+            fp16_ieee_to_fp32_value(y[i]),
+            y_ref[i],
+            std::max(1.0e-3f, std::abs(y_ref[i]) * 1.0e-3f))
+          << "at " << i << " / " << batch_size() << ", mean = " << stats[0] << ", inverse stddev = " << stats[1];
+      }
+    }
+  }
+
+  void Test(xnn_f32_vlayernorm_ukernel_function vlayernorm) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-5.0f, 5.0f), std::ref(rng));
+    auto stddev_rng = std::bind(std::uniform_real_distribution<float>(0.5f, 2.0f), std::ref(rng));
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> gamma(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> beta(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(f32rng));
+      } else {
+        std::generate(x.begin(), x.end(), std::ref(f32rng));
+        std::fill(y.begin(), y.end(), nanf(""));
+      }
+      std::generate(gamma.begin(), gamma.end(), std::ref(f32rng));
+      std::generate(beta.begin(), beta.end(), std::ref(f32rng));
+      const float* x_data = inplace() ? y.data() : x.data();
+      const float stats[2] = { f32rng(), 1.0f / stddev_rng() };
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = (double(x_data[i]) - double(stats[0])) * double(stats[1]) * double(gamma[i]) + double(beta[i]);
+      }
+
+      // Call optimized micro-kernel.
+      vlayernorm(batch_size() * sizeof(float), x_data, stats, gamma.data(), beta.data(), y.data());
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(1.0e-5, std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << batch_size() << ", mean = " << stats[0] << ", inverse stddev = " << stats[1];
+      }
+    }
+  }
+
+  void Test(xnn_f16_vlog_ukernel_function vlog, xnn_init_f16_log_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(1.0e-3f, 1.0e+3f);
+
+    std::vector<uint16_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = std::log(fp16_ieee_to_fp32_value(x_data[i]));
+      }
+
+      // Prepare parameters.
+      union xnn_f16_log_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vlog(batch_size() * sizeof(uint16_t), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(
+            fp16_ieee_to_fp32_value(y[i]),
+            y_ref[i],
+            std::max(1.0e-3f, std::abs(y_ref[i]) * 1.0e-2f))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << fp16_ieee_to_fp32_value(x_data[i]);
+      }
+    }
+  }
+
+  void Test(xnn_f32_vlog_ukernel_function vlog, xnn_init_f32_log_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-87.0f, 88.0f);
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return std::exp(f32dist(rng)); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return std::exp(f32dist(rng)); });
+        std::fill(y.begin(), y.end(), nanf(""));
+      }
+      const float* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = std::log(double(x_data[i]));
+      }
+
+      // Prepare parameters.
+      union xnn_f32_log_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vlog(batch_size() * sizeof(float), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(5.0e-6, std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i];
+      }
+    }
+  }
+
   void Test(xnn_f16_vlrelu_ukernel_function vlrelu, xnn_init_f16_lrelu_params_fn init_params) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -564,6 +923,85 @@ class VUnaryMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_vsilu_ukernel_function vsilu, xnn_init_f16_silu_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-25.0f, 25.0f);
+
+    std::vector<uint16_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float x_i = fp16_ieee_to_fp32_value(x_data[i]);
+        y_ref[i] = x_i / (1.0f + std::exp(-x_i));
+      }
+
+      // Prepare parameters.
+      union xnn_f16_silu_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vsilu(batch_size() * sizeof(uint16_t), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(
+            fp16_ieee_to_fp32_value(y[i]),
+            y_ref[i],
+            std::max(1.0e-3f, std::abs(y_ref[i]) * 1.0e-2f))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << fp16_ieee_to_fp32_value(x_data[i]);
+      }
+    }
+  }
+
+  void Test(xnn_f32_vsilu_ukernel_function vsilu, xnn_init_f32_silu_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-125.0f, 125.0f);
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return f32dist(rng); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return f32dist(rng); });
+        std::fill(y.begin(), y.end(), nanf(""));
+      }
+      const float* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const double e = std::exp(double(x_data[i]));
+        y_ref[i] = double(x_data[i]) * e / (1.0 + e);
+      }
+
+      // Prepare parameters.
+      union xnn_f32_silu_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vsilu(batch_size() * sizeof(float), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(5.0e-6, std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i];
+      }
+    }
+  }
+
   void Test(xnn_f32_vsqr_ukernel_function vsqr, xnn_init_f32_default_params_fn init_params = nullptr) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -642,6 +1080,83 @@ class VUnaryMicrokernelTester {
     }
   }
 
+  void Test(xnn_f16_vtanh_ukernel_function vtanh, xnn_init_f16_tanh_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-5.0f, 5.0f);
+
+    std::vector<uint16_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(uint16_t));
+    std::vector<uint16_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(uint16_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return fp16_ieee_from_fp32_value(f32dist(rng)); });
+        std::fill(y.begin(), y.end(), UINT16_C(0x7E00) /* NaN */);
+      }
+      const uint16_t* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = std::tanh(fp16_ieee_to_fp32_value(x_data[i]));
+      }
+
+      // Prepare parameters.
+      union xnn_f16_tanh_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vtanh(batch_size() * sizeof(uint16_t), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(
+            fp16_ieee_to_fp32_value(y[i]),
+            y_ref[i],
+            std::max(1.0e-3f, std::abs(y_ref[i]) * 1.0e-2f))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << fp16_ieee_to_fp32_value(x_data[i]);
+      }
+    }
+  }
+
+  void Test(xnn_f32_vtanh_ukernel_function vtanh, xnn_init_f32_tanh_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-10.0f, 10.0f);
+
+    std::vector<float> x(batch_size() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(float) : 0));
+    std::vector<double> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), [&]() { return f32dist(rng); });
+      } else {
+        std::generate(x.begin(), x.end(), [&]() { return f32dist(rng); });
+        std::fill(y.begin(), y.end(), nanf(""));
+      }
+      const float* x_data = inplace() ? y.data() : x.data();
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        y_ref[i] = std::tanh(double(x_data[i]));
+      }
+
+      // Prepare parameters.
+      union xnn_f32_tanh_params params;
+      init_params(&params);
+
+      // Call optimized micro-kernel.
+      vtanh(batch_size() * sizeof(float), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(y[i], y_ref[i], std::max(5.0e-6, std::abs(y_ref[i]) * 1.0e-5))
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << x[i];
+      }
+    }
+  }
+
   inline void Test(xnn_f32_vabs_ukernel_function vunary, OpType op_type, Variant variant = Variant::Native) const {
     Test(xnn_f32_vunary_ukernel_function(vunary), op_type, variant);
   }
@@ -774,6 +1289,98 @@ class VUnaryMicrokernelTester {
     }
   }
 
+  void Test(xnn_qs8_vhswish_ukernel_function vhswish, xnn_init_qs8_hswish_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      std::ref(rng));
+
+    std::vector<int8_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(int8_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(i8rng));
+      if (inplace()) {
+        std::copy(x.cbegin(), x.cend(), y.begin());
+      } else {
+        std::fill(y.begin(), y.end(), INT8_C(0xA5));
+      }
+      const int8_t* x_data = inplace() ? y.data() : x.data();
+
+      // Prepare parameters.
+      const int8_t output_min = int8_t(qmin() - 0x80);
+      const int8_t output_max = int8_t(qmax() - 0x80);
+      union xnn_qs8_hswish_params params;
+      init_params(&params, input_scale(), output_scale(),
+        int8_t(input_zero_point() - 0x80), int8_t(output_zero_point() - 0x80), output_min, output_max);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float x_value = input_scale() * float(int32_t(x_data[i]) - int32_t(input_zero_point() - 0x80));
+        const float y_value = x_value * std::min(std::max(x_value + 3.0f, 0.0f), 6.0f) / 6.0f;
+        y_ref[i] = std::min(std::max(y_value / output_scale() + float(output_zero_point() - 0x80),
+          float(output_min)), float(output_max));
+      }
+
+      // Call optimized micro-kernel.
+      vhswish(batch_size() * sizeof(int8_t), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(float(int32_t(y[i])), y_ref[i], 0.6f)
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << int32_t(x[i]);
+      }
+    }
+  }
+
+  void Test(xnn_qs8_vlrelu_ukernel_function vlrelu, xnn_init_qs8_lrelu_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    auto i8rng = std::bind(
+      std::uniform_int_distribution<int32_t>(std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max()),
+      std::ref(rng));
+
+    std::vector<int8_t> x(batch_size() + XNN_EXTRA_BYTES / sizeof(int8_t));
+    std::vector<int8_t> y(batch_size() + (inplace() ? XNN_EXTRA_BYTES / sizeof(int8_t) : 0));
+    std::vector<float> y_ref(batch_size());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(i8rng));
+      if (inplace()) {
+        std::copy(x.cbegin(), x.cend(), y.begin());
+      } else {
+        std::fill(y.begin(), y.end(), INT8_C(0xA5));
+      }
+      const int8_t* x_data = inplace() ? y.data() : x.data();
+
+      // Prepare parameters.
+      const int8_t output_min = int8_t(qmin() - 0x80);
+      const int8_t output_max = int8_t(qmax() - 0x80);
+      const float positive_scale = input_scale() / output_scale();
+      const float negative_scale = positive_scale * slope();
+      union xnn_qs8_lrelu_params params;
+      init_params(&params, positive_scale, negative_scale,
+        int8_t(input_zero_point() - 0x80), int8_t(output_zero_point() - 0x80), output_min, output_max);
+
+      // Compute reference results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        const float x_value = float(int32_t(x_data[i]) - int32_t(input_zero_point() - 0x80));
+        const float y_value = x_value * (x_value < 0.0f ? negative_scale : positive_scale);
+        y_ref[i] = std::min(std::max(y_value + float(output_zero_point() - 0x80),
+          float(output_min)), float(output_max));
+      }
+
+      // Call optimized micro-kernel.
+      vlrelu(batch_size() * sizeof(int8_t), x_data, y.data(), &params);
+
+      // Verify results.
+      for (size_t i = 0; i < batch_size(); i++) {
+        ASSERT_NEAR(float(int32_t(y[i])), y_ref[i], 0.6f)
+          << "at " << i << " / " << batch_size() << ", x[" << i << "] = " << int32_t(x[i]);
+      }
+    }
+  }
+
   void Test(xnn_u8_vclamp_ukernel_function vclamp, xnn_init_u8_minmax_params_fn init_params) const {
     std::random_device random_device;
     auto rng = std::mt19937(random_device());
@@ -819,6 +1426,10 @@ class VUnaryMicrokernelTester {
   float prescale_ = 1.0f;
   float alpha_ = 1.0f;
   float beta_ = 1.0f;
+  float input_scale_ = 1.25f;
+  int16_t input_zero_point_ = 129;
+  float output_scale_ = 0.75f;
+  int16_t output_zero_point_ = 133;
   uint8_t qmin_ = 0;
   uint8_t qmax_ = 255;
   size_t iterations_ = 15;
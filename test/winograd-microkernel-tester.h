@@ -0,0 +1,199 @@
+// Copyright 2022 Google LLC
+//
+// This source code is licensed under the BSD-style license found in the
+// LICENSE file in the root directory of this source tree.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include <xnnpack.h>
+#include <xnnpack/params-init.h>
+#include <xnnpack/params.h>
+
+
+class WinogradMicrokernelTester {
+ public:
+  inline WinogradMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline WinogradMicrokernelTester& transformed_stride(size_t transformed_stride) {
+    this->transformed_stride_ = transformed_stride;
+    return *this;
+  }
+
+  inline size_t transformed_stride() const {
+    return this->transformed_stride_ == 0 ? channels() : this->transformed_stride_;
+  }
+
+  inline WinogradMicrokernelTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline WinogradMicrokernelTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline WinogradMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void Test(xnn_f32_winograd_input_ukernel_function winograd_input) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<std::vector<float>> input(16, std::vector<float>(channels() + XNN_EXTRA_BYTES / sizeof(float)));
+    std::vector<const float*> input_pointers(16);
+    std::vector<float> output(15 * transformed_stride() + channels());
+    std::vector<float> output_ref(16 * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      for (size_t i = 0; i < 16; i++) {
+        std::generate(input[i].begin(), input[i].end(), [&]() { return f32dist(rng); });
+        input_pointers[i] = input[i].data();
+      }
+      std::fill(output.begin(), output.end(), nanf(""));
+
+      // Compute reference results: V = B^T * d * B.
+      static const float bt[4][4] = {
+        {1.0f,  0.0f, -1.0f,  0.0f},
+        {0.0f,  1.0f,  1.0f,  0.0f},
+        {0.0f, -1.0f,  1.0f,  0.0f},
+        {0.0f,  1.0f,  0.0f, -1.0f},
+      };
+      for (size_t c = 0; c < channels(); c++) {
+        for (size_t r = 0; r < 4; r++) {
+          for (size_t s = 0; s < 4; s++) {
+            double acc = 0.0;
+            for (size_t y = 0; y < 4; y++) {
+              for (size_t x = 0; x < 4; x++) {
+                acc += double(bt[r][y]) * double(input[y * 4 + x][c]) * double(bt[s][x]);
+              }
+            }
+            output_ref[(r * 4 + s) * channels() + c] = float(acc);
+          }
+        }
+      }
+
+      // Call optimized micro-kernel.
+      winograd_input(
+        channels() * sizeof(float),
+        input_pointers.data(),
+        output.data(),
+        transformed_stride() * sizeof(float));
+
+      // Verify results.
+      for (size_t p = 0; p < 16; p++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(output[p * transformed_stride() + c], output_ref[p * channels() + c], 1.0e-6f)
+            << "at position " << p << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+  void Test(xnn_f32_winograd_output_ukernel_function winograd_output, xnn_init_f32_minmax_params_fn init_params) const {
+    std::random_device random_device;
+    auto rng = std::mt19937(random_device());
+    std::uniform_real_distribution<float> f32dist(-1.0f, 1.0f);
+
+    std::vector<float> input(15 * transformed_stride() + channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<float> bias(channels() + XNN_EXTRA_BYTES / sizeof(float));
+    std::vector<std::vector<float>> output(4, std::vector<float>(channels()));
+    std::vector<float*> output_pointers(4);
+    std::vector<float> output_ref(4 * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), [&]() { return f32dist(rng); });
+      std::generate(bias.begin(), bias.end(), [&]() { return f32dist(rng); });
+      for (size_t i = 0; i < 4; i++) {
+        std::fill(output[i].begin(), output[i].end(), nanf(""));
+        output_pointers[i] = output[i].data();
+      }
+
+      // Compute reference results: Y = A^T * m * A + bias.
+      static const float at[2][4] = {
+        {1.0f, 1.0f,  1.0f,  0.0f},
+        {0.0f, 1.0f, -1.0f, -1.0f},
+      };
+      for (size_t c = 0; c < channels(); c++) {
+        for (size_t r = 0; r < 2; r++) {
+          for (size_t s = 0; s < 2; s++) {
+            double acc = double(bias[c]);
+            for (size_t y = 0; y < 4; y++) {
+              for (size_t x = 0; x < 4; x++) {
+                acc += double(at[r][y]) * double(input[(y * 4 + x) * transformed_stride() + c]) * double(at[s][x]);
+              }
+            }
+            output_ref[(r * 2 + s) * channels() + c] = float(acc);
+          }
+        }
+      }
+      const float accumulated_min = *std::min_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_max = *std::max_element(output_ref.cbegin(), output_ref.cend());
+      const float accumulated_range = accumulated_max - accumulated_min;
+      const float output_max = accumulated_max - accumulated_range / 255.0f * float(255 - qmax());
+      const float output_min = accumulated_min + accumulated_range / 255.0f * float(qmin());
+      for (float& output_value : output_ref) {
+        output_value = std::max<float>(std::min<float>(output_value, output_max), output_min);
+      }
+
+      // Prepare parameters.
+      xnn_f32_minmax_params params;
+      init_params(&params, output_min, output_max);
+
+      // Call optimized micro-kernel.
+      winograd_output(
+        channels() * sizeof(float),
+        input.data(), transformed_stride() * sizeof(float),
+        bias.data(),
+        output_pointers.data(),
+        &params);
+
+      // Verify results.
+      for (size_t p = 0; p < 4; p++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_NEAR(output[p][c], output_ref[p * channels() + c], 1.0e-5f)
+            << "at pixel " << p << ", channel " << c << " / " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t channels_{1};
+  size_t transformed_stride_{0};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
@@ -880,10 +880,18 @@ def generate_test_cases(ukernel, mr, nr, kr, sr, xw, k_block, init_fn,
     _, _, datatype, ukernel_type, _ = ukernel.split("_", 4)
     activation = None
   else:
-    _, datatype, ukernel_type, activation, _ = ukernel.split("_", 4)
+    # Mixed-datatype micro-kernels (e.g. f32_f16w, qd8_f32_qc8w) list the datatypes of all operands before the
+    # micro-kernel type, and the first datatype names the family.
+    parts = ukernel.split("_")
+    datatype = parts[1]
+    type_index = next(i for i, part in enumerate(parts) if part in ["gemm", "igemm", "gemv", "gemminc", "ppmm"])
+    ukernel_type, activation = parts[type_index:type_index + 2]
 
   if activation == "ukernel":
     activation = "linear"
+  # GEMV micro-kernels are GEMM micro-kernels specialized for MR=1, and share GEMM test cases.
+  if ukernel_type == "gemv":
+    ukernel_type = "gemm"
   test_args = [ukernel]
   if init_fn:
     test_args.append(init_fn)
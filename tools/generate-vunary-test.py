@@ -27,14 +27,18 @@ parser.set_defaults(defines=list())
 
 
 def split_ukernel_name(name):
-  match = re.match(r"^xnn_(s8|u8|f16|f32)_v(abs|clamp|elu|hswish|lrelu|neg|relu|rndd|rndne|rndu|rndz|sigmoid|sqr|sqrt)_(fact_)?ukernel__(.+)_x(\d+)$", name)
+  match = re.match(r"^xnn_(s8|u8|qs8|f16|f32)_v(abs|clamp|elu|exp|gelu|hswish|layernorm|log|lrelu|neg|relu|rndd|rndne|rndu|rndz|sigmoid|silu|sqr|sqrt|tanh)_(fact_)?ukernel__(.+)_x(\d+)$", name)
   if match is None:
     raise ValueError("Unexpected microkernel name: " + name)
   op_type = {
     "abs": "Abs",
     "clamp": "Clamp",
     "elu": "ELU",
+    "exp": "Exp",
+    "gelu": "GELU",
     "hswish": "HardSwish",
+    "layernorm": "LayerNorm",
+    "log": "Log",
     "lrelu": "LeakyReLU",
     "neg": "Negate",
     "relu": "ReLU",
@@ -43,8 +47,10 @@ def split_ukernel_name(name):
     "rndz": "RoundTowardsZero",
     "rndu": "RoundUp",
     "sigmoid": "Sigmoid",
+    "silu": "SiLU",
     "sqr": "Square",
     "sqrt": "SquareRoot",
+    "tanh": "Tanh",
   }[match.group(2)]
   batch_tile = int(match.group(5))
 
@@ -130,6 +136,81 @@ $if OP_TYPE == "Clamp":
     }
   }
 
+$if DATATYPE == "qs8":
+  TEST(${TEST_NAME}, input_scale) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      for (float input_scale : std::vector<float>({4.0f, 16.0f, 64.0f})) {
+        VUnaryMicrokernelTester()
+          .batch_size(batch_size)
+          .input_scale(input_scale)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, input_zero_point) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (int16_t input_zero_point = 2; input_zero_point < 10; input_zero_point += 3) {
+      for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+        VUnaryMicrokernelTester()
+          .batch_size(batch_size)
+          .input_zero_point(input_zero_point)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, output_scale) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      for (float output_scale : std::vector<float>({4.0f, 16.0f, 64.0f})) {
+        VUnaryMicrokernelTester()
+          .batch_size(batch_size)
+          .output_scale(output_scale)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, output_zero_point) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (int16_t output_zero_point = 2; output_zero_point < 10; output_zero_point += 3) {
+      for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+        VUnaryMicrokernelTester()
+          .batch_size(batch_size)
+          .output_zero_point(output_zero_point)
+          .Test(${", ".join(TEST_ARGS)});
+      }
+    }
+  }
+
+  TEST(${TEST_NAME}, qmin) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .qmin(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
+  TEST(${TEST_NAME}, qmax) {
+    $if ISA_CHECK:
+      ${ISA_CHECK};
+    for (size_t batch_size = 1; batch_size <= ${BATCH_TILE*5}; batch_size += ${max(1, BATCH_TILE-1)}) {
+      VUnaryMicrokernelTester()
+        .batch_size(batch_size)
+        .qmax(128)
+        .Test(${", ".join(TEST_ARGS)});
+    }
+  }
+
 $if OP_TYPE == "ELU":
   TEST(${TEST_NAME}, prescale) {
     $if ISA_CHECK:
@@ -209,7 +290,7 @@ def generate_test_cases(ukernel, op_type, init_fn, batch_tile, isa):
       test_args.append("VUnaryMicrokernelTester::OpType::" + op_type)
     if init_fn is not None:
       test_args.append(init_fn)
-  elif op_type not in ["Abs", "Negate", "Square", "SquareRoot"]:
+  elif op_type not in ["Abs", "LayerNorm", "Negate", "Square", "SquareRoot"]:
     test_args.append("VUnaryMicrokernelTester::OpType::" + op_type)
     if not isa:
       test_args.append("VUnaryMicrokernelTester::Variant::Scalar")